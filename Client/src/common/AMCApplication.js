@@ -104,7 +104,8 @@ export default class AMCApplication extends Common.AMCObject {
             DialogMap: new Map(),
 			ModuleMap: new Map(),
 			ItemMap: new Map(),			
-            FormEntityMap: new Map()
+            FormEntityMap: new Map(),
+			StateVersion: 0
         }
 		
 		this.SnackBar = {
@@ -354,59 +355,137 @@ export default class AMCApplication extends Common.AMCObject {
 
     retrieveStateUpdate() {
 
-        this.axiosGetRequest("/ui/state")
+		let stateURL = "/ui/state";
+		if (this.AppContent.StateVersion > 0)
+			stateURL = stateURL + "?sinceversion=" + this.AppContent.StateVersion;
+
+        this.axiosGetRequest(stateURL)
 
         .then(resultJSON => {
 			
-			this.AppContent.Pages = [];
-			this.AppContent.CustomPages = [];
-			this.AppContent.Dialogs = [];
-			this.AppContent.PageMap.clear ();
-			this.AppContent.CustomPageMap.clear ();
-			this.AppContent.DialogMap.clear ();
-			this.AppContent.ModuleMap.clear ();
-			this.AppContent.ItemMap.clear ();
-			
-            this.AppContent.MenuItems = resultJSON.data.menuitems;
-            this.AppContent.ToolbarItems = resultJSON.data.toolbaritems;
-
-            for (let pageJSON of resultJSON.data.pages) {
-				
-				let page = new AMCApplicationPage (this, pageJSON);
-				this.AppContent.Pages.push (page);
-                this.AppContent.PageMap.set(page.name, page);
-            }
-
-			if (resultJSON.data.custompages) {
-				for (let customPageJSON of resultJSON.data.custompages) {
-					
-					let custompage = new AMCApplicationCustomPage (this, customPageJSON);
-					
-					//alert (custompage.component);
-					
-					this.AppContent.CustomPages.push (custompage);
-					this.AppContent.CustomPageMap.set(custompage.name, custompage);
-
-				}
+			if (resultJSON.data.isdelta) {
+				this.mergeStateDelta (resultJSON.data);
+			} else {
+				this.replaceState (resultJSON.data);
 			}
-
-
-            for (let dialogJSON of resultJSON.data.dialogs) {
-				let dialog = new AMCApplicationDialog (this, dialogJSON);
-				this.AppContent.Dialogs.push (dialog);
-                this.AppContent.DialogMap.set(dialog.name, dialog);
-				
-            }
+			
+			if (resultJSON.data.stateversion)
+				this.AppContent.StateVersion = resultJSON.data.stateversion;
 
         })
         .catch(err => {
 			if (err.response) {
+				// Not modified: nothing has changed since the last known state version.
+				if (err.response.status === 304)
+					return;
+			
 				this.setStatusToError(err.response.data.message.toString ());
 			} else {
 				this.setStatusToError(err.toString ());
 			}
         });
     }
+	
+	
+	replaceState (stateJSON) {
+		
+		this.AppContent.Pages = [];
+		this.AppContent.CustomPages = [];
+		this.AppContent.Dialogs = [];
+		this.AppContent.PageMap.clear ();
+		this.AppContent.CustomPageMap.clear ();
+		this.AppContent.DialogMap.clear ();
+		this.AppContent.ModuleMap.clear ();
+		this.AppContent.ItemMap.clear ();
+		
+		this.AppContent.MenuItems = stateJSON.menuitems;
+		this.AppContent.ToolbarItems = stateJSON.toolbaritems;
+
+		for (let pageJSON of stateJSON.pages) {
+			
+			let page = new AMCApplicationPage (this, pageJSON);
+			this.AppContent.Pages.push (page);
+			this.AppContent.PageMap.set(page.name, page);
+		}
+
+		if (stateJSON.custompages) {
+			for (let customPageJSON of stateJSON.custompages) {
+				
+				let custompage = new AMCApplicationCustomPage (this, customPageJSON);
+				
+				//alert (custompage.component);
+				
+				this.AppContent.CustomPages.push (custompage);
+				this.AppContent.CustomPageMap.set(custompage.name, custompage);
+
+			}
+		}
+
+
+		for (let dialogJSON of stateJSON.dialogs) {
+			let dialog = new AMCApplicationDialog (this, dialogJSON);
+			this.AppContent.Dialogs.push (dialog);
+			this.AppContent.DialogMap.set(dialog.name, dialog);
+			
+		}
+		
+	}
+	
+	
+	mergeStateDelta (stateJSON) {
+		
+		// Delta states only contain the modules that have changed, grouped by their page.
+		if (stateJSON.pages) {
+			for (let pageJSON of stateJSON.pages) {
+				if (this.AppContent.PageMap.has (pageJSON.name))
+					this.mergeModulesOfPage (this.AppContent.PageMap.get (pageJSON.name), pageJSON.modules);
+			}
+		}
+
+		if (stateJSON.custompages) {
+			for (let customPageJSON of stateJSON.custompages) {
+				if (this.AppContent.CustomPageMap.has (customPageJSON.name))
+					this.mergeModulesOfPage (this.AppContent.CustomPageMap.get (customPageJSON.name), customPageJSON.modules);
+			}
+		}
+
+		if (stateJSON.dialogs) {
+			for (let dialogJSON of stateJSON.dialogs) {
+				if (this.AppContent.DialogMap.has (dialogJSON.name))
+					this.mergeModulesOfPage (this.AppContent.DialogMap.get (dialogJSON.name), dialogJSON.modules);
+			}
+		}
+		
+	}
+	
+	
+	mergeModulesOfPage (page, modulesJSON) {
+		
+		Assert.ArrayValue (modulesJSON);
+		
+		for (let moduleDefinitionJSON of modulesJSON) {
+			
+			let moduleIndex = page.modules.findIndex (module => module.uuid === moduleDefinitionJSON.uuid);
+			if (moduleIndex < 0)
+				continue;
+			
+			let moduleInstance = this.createModuleInstance (page, moduleDefinitionJSON);
+			if (!moduleInstance)
+				throw "Module type not found: " + moduleDefinitionJSON.type;
+			
+			let oldModule = page.modules[moduleIndex];
+			page.modules.splice (moduleIndex, 1, moduleInstance);
+			
+			if (page.moduleMap && (page.moduleMap.get (oldModule.name) === oldModule)) 
+				page.moduleMap.set (moduleInstance.name, moduleInstance);
+			
+			if (page.customModule === oldModule)
+				page.customModule = moduleInstance;
+			
+			this.addModule (moduleInstance);
+		}
+		
+	}
 
    
 	
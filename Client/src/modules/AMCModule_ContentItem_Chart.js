@@ -32,6 +32,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 import * as Assert from "../common/AMCAsserts.js";
 import * as Common from "../common/AMCCommon.js"
 
+// Charts are reduced on the server to the extrema of this many buckets
+const CHART_DOWNSAMPLINGWIDTH = 2048;
+
 
 export default 
 
@@ -82,7 +85,7 @@ class AMCApplicationItem_Content_Chart extends Common.AMCApplicationItem {
 		let application = this.getApplication ();
 		let normalizedUUID = this.dataseries;
 	
-		application.axiosGetArrayBufferRequest("/ui/chart/" + normalizedUUID)
+		application.axiosGetArrayBufferRequest("/ui/chart/" + normalizedUUID + "?downsampling=minmax&width=" + CHART_DOWNSAMPLINGWIDTH)
 				.then(responseData => {
 					var floatView = new Float32Array(responseData.data);
 					let dataLength = floatView.length;
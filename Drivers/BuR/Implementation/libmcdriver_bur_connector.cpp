@@ -92,13 +92,6 @@ struct sPLCToAMCFPacketVersion3 {
     uint32_t m_nDataChecksum;
 };
 
-struct sAMCFToPLCPacketSendInfo {
-    uint32_t m_CommandID;
-    uint32_t m_SequenceID;
-    uint32_t m_ClientID;
-    BurPacketCallback m_Callback;
-};
-
 #pragma pack(pop)
 
 
@@ -214,12 +207,19 @@ CDriver_BuRConnector::CDriver_BuRConnector(LibMCEnv::PDriverEnvironment pDriverE
     m_nSequenceID (1),
     m_nMaxPacketQueueSize (nMaxPacketQueueSize),
     m_nReceiveTimeoutInMS (1000),
-    m_pDriverEnvironment (pDriverEnvironment)
+    m_pDriverEnvironment (pDriverEnvironment),
+    m_bIOThreadIsRunning (false),
+    m_bStopIOThread (false),
+    m_nMaxPacketsInFlight (nMaxPacketQueueSize),
+    m_ClientIDGenerator (std::random_device ()())
 
 {
     if (pDriverEnvironment.get() == nullptr)
         throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDPARAM);
 
+    if (m_nMaxPacketsInFlight == 0)
+        m_nMaxPacketsInFlight = 1;
+
 }
 
 CDriver_BuRConnector::~CDriver_BuRConnector()
@@ -250,7 +250,9 @@ void CDriver_BuRConnector::queryParametersLegacy(BurPacketCallback callback)
     if (pConnection.get() != nullptr) {        
 
         if (m_ProtocolVersion == eDriver_BurProtocolVersion::Legacy) {
-            sendCommandToPLC(BUR_COMMAND_DIRECT_MACHINESTATUSLEGACY, callback);
+            std::vector<sAMCFToPLCPacketToSend> packetList;
+            packetList.push_back(makePacket(BUR_COMMAND_DIRECT_MACHINESTATUSLEGACY, callback));
+            submitPacketsToPLC(packetList, true);
         }
     }
 }
@@ -269,12 +271,14 @@ void CDriver_BuRConnector::queryParametersVersion3(LibMCEnv::PDriverStatusUpdate
     if ((pConnection.get() != nullptr) && (pJournal != nullptr)) {
 
         if (m_ProtocolVersion == eDriver_BurProtocolVersion::Version3) {
-            sendCommandToPLC(BUR_COMMAND_DIRECT_CURRENTJOURNALSTATUS, 
+            std::vector<sAMCFToPLCPacketToSend> packetList;
+            packetList.push_back(makePacket(BUR_COMMAND_DIRECT_CURRENTJOURNALSTATUS,
                 [pDriverUpdateInstance, pJournal](CDriver_BuRPacket* pPacket) {
 
                     pJournal->parseStatus(pPacket->getDataBuffer(), pDriverUpdateInstance);
 
-                });
+                }));
+            submitPacketsToPLC(packetList, true);
         }
 
     }
@@ -283,214 +287,350 @@ void CDriver_BuRConnector::queryParametersVersion3(LibMCEnv::PDriverStatusUpdate
 
 void CDriver_BuRConnector::sendCommandsToPLC(std::vector<sAMCFToPLCPacketToSend>& packetList)
 {
-    switch (m_ProtocolVersion) {
-        case eDriver_BurProtocolVersion::Legacy: 
-            sendCommandsToPLCLegacy(packetList);
-            break;
-        case eDriver_BurProtocolVersion::Version3:
-            sendCommandsToPLCVersion3(packetList);
-            break;
-        default:
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_UNKNOWNDRIVERPROTOCOLVERSION);
-    }
-
+    submitPacketsToPLC(packetList, false);
 }
 
-void CDriver_BuRConnector::sendCommandsToPLCVersion3(std::vector<sAMCFToPLCPacketToSend>& packetList)
+void CDriver_BuRConnector::submitPacketsToPLC(std::vector<sAMCFToPLCPacketToSend>& packetList, bool bIsStatusRequest)
 {
     if (packetList.empty())
         return;
 
-    if (m_pCurrentConnection == nullptr)
-        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_NOTCONNECTED);
+    if ((m_ProtocolVersion != eDriver_BurProtocolVersion::Legacy) && (m_ProtocolVersion != eDriver_BurProtocolVersion::Version3))
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_UNKNOWNDRIVERPROTOCOLVERSION);
 
-    std::default_random_engine generator;
-    std::uniform_int_distribution<int> distribution(1, 1024 * 1024 * 1024);
+    auto pBatch = std::make_shared<sDriver_BuRPacketBatch>();
+    pBatch->m_Packets = packetList;
+    pBatch->m_Replies.resize(packetList.size());
+    pBatch->m_nOpenReplies = packetList.size();
 
-    std::vector<sAMCFToPLCPacketVersion3> TCPPacketList;
-    std::vector<sAMCFToPLCPacketSendInfo> SendInfoList;
-
-    for (auto& packet : packetList) {
-        uint32_t nClientID = distribution(generator);
-
-        sAMCFToPLCPacketVersion3 TCPpacket;
-        TCPpacket.m_nSignature = m_nPacketSignature;
-        TCPpacket.m_nCommandID = packet.m_CommandID;
-        TCPpacket.m_nClientID = nClientID;
-        TCPpacket.m_nSequenceID = m_nSequenceID;
-        TCPpacket.m_Payload = packet.m_Payload;
-        TCPpacket.m_nChecksum = CRC::Calculate(&TCPpacket, ((intptr_t)(&TCPpacket.m_nChecksum) - (intptr_t)(&TCPpacket)), CRC::CRC_32());
-        TCPPacketList.push_back(TCPpacket);
-
-        // Store send info
-        sAMCFToPLCPacketSendInfo sendInfo;
-        sendInfo.m_CommandID = TCPpacket.m_nCommandID;
-        sendInfo.m_SequenceID = TCPpacket.m_nSequenceID;
-        sendInfo.m_ClientID = TCPpacket.m_nClientID;
-        sendInfo.m_Callback = packet.m_Callback;
-        SendInfoList.push_back(sendInfo);
+    {
+        std::unique_lock<std::mutex> queueLock(m_QueueMutex);
+        if (!m_bIOThreadIsRunning)
+            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_NOTCONNECTED);
 
-        m_nSequenceID++;
-    }
+        auto& queue = bIsStatusRequest ? m_StatusQueue : m_CommandQueue;
+        for (size_t nPacketIndex = 0; nPacketIndex < packetList.size(); nPacketIndex++)
+            queue.push_back(sDriver_BuRQueuedPacket{ pBatch, nPacketIndex });
+
+        m_QueueSignal.notify_all();
 
-    if (TCPPacketList.empty())
-        throw ELibMCDriver_BuRInterfaceException(LIBMCENV_ERROR_INTERNALERROR);
+        m_BatchSignal.wait(queueLock, [&pBatch] {
+            return (pBatch->m_nOpenReplies == 0) || (pBatch->m_pException != nullptr);
+        });
+    }
 
-    int index = 0;
-    for (auto& packetToSend : TCPPacketList) {
-        auto sendInfo = SendInfoList.at(index);
+    if (pBatch->m_pException != nullptr)
+        std::rethrow_exception(pBatch->m_pException);
 
-        if (packetToSend.m_nSequenceID != sendInfo.m_SequenceID)
-            throw ELibMCDriver_BuRInterfaceException(LIBMCENV_ERROR_INTERNALERROR);
+    // Callbacks are executed on the submitting thread, so they may safely capture local state of the caller.
+    for (size_t nPacketIndex = 0; nPacketIndex < pBatch->m_Packets.size(); nPacketIndex++) {
+        auto& callback = pBatch->m_Packets.at(nPacketIndex).m_Callback;
+        if (callback != nullptr)
+            callback(pBatch->m_Replies.at(nPacketIndex).get());
+    }
 
-        m_pCurrentConnection->SendBuffer (LibMCEnv::CInputVector<uint8_t> ((uint8_t*)&packetToSend, sizeof(sAMCFToPLCPacketVersion3)));
-        index++;
+}
 
+void CDriver_BuRConnector::startIOThread(LibMCEnv::PTCPIPConnection pConnection)
+{
+    if (pConnection.get() == nullptr)
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDPARAM);
 
+    {
+        std::lock_guard<std::mutex> sequenceLock(m_SequenceMapMutex);
+        m_InFlightPackets.clear();
     }
 
-    //index = 0;
-    for (auto& sendInfo : SendInfoList) {
+    {
+        std::lock_guard<std::mutex> queueLock(m_QueueMutex);
+        m_StatusQueue.clear();
+        m_CommandQueue.clear();
+        m_bStopIOThread = false;
+        m_bIOThreadIsRunning = true;
+    }
 
-        //auto sendInfo = SendInfoList.at(index);
+    m_IOThread = std::thread(&CDriver_BuRConnector::runIOThread, this, pConnection);
+}
 
-        auto pReceivedPacket = m_pCurrentConnection->ReceiveFixedPacket(sizeof(sPLCToAMCFPacketVersion3), m_nReceiveTimeoutInMS);
+void CDriver_BuRConnector::stopIOThread()
+{
+    {
+        std::lock_guard<std::mutex> queueLock(m_QueueMutex);
+        m_bStopIOThread = true;
+    }
+    m_QueueSignal.notify_all();
 
-        std::vector<uint8_t> recvBuffer;
-        pReceivedPacket->GetData(recvBuffer);
+    if (m_IOThread.joinable())
+        m_IOThread.join();
 
-        if (recvBuffer.size() != sizeof(sPLCToAMCFPacketVersion3))
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEERROR);
+    failAllPackets(std::make_exception_ptr(ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_NOTCONNECTED)));
 
-        const sPLCToAMCFPacketVersion3* receivedPacket = (const sPLCToAMCFPacketVersion3*)recvBuffer.data();
-        if (receivedPacket->m_nSignature != m_nPacketSignature) {
-            disconnect();
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDPACKETSIGNATURE);
-        }
+    std::lock_guard<std::mutex> queueLock(m_QueueMutex);
+    m_bStopIOThread = false;
+}
 
-        auto pPacket = std::make_shared<CDriver_BuRPacket>(sendInfo.m_CommandID, receivedPacket->m_nErrorCode);
+void CDriver_BuRConnector::runIOThread(LibMCEnv::PTCPIPConnection pConnection)
+{
+    try {
+        std::vector<sDriver_BuRQueuedPacket> packetsToSend;
+        std::vector<uint8_t> sendBuffer;
 
-        if (receivedPacket->m_nPayloadLength > BUR_MAX_PAYLOADLENGTH)
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDPACKETLENGTH);
+        while (true) {
+            size_t nPacketsInFlight;
+            {
+                std::lock_guard<std::mutex> sequenceLock(m_SequenceMapMutex);
+                nPacketsInFlight = m_InFlightPackets.size();
+            }
 
-        if (receivedPacket->m_nPayloadLength > 0) {
-            auto pPayloadPacket = m_pCurrentConnection->ReceiveFixedPacket(receivedPacket->m_nPayloadLength, m_nReceiveTimeoutInMS);
-            pPayloadPacket->GetData (pPacket->getDataBuffer());
-        }
+            packetsToSend.clear();
+            {
+                std::unique_lock<std::mutex> queueLock(m_QueueMutex);
+                if (nPacketsInFlight == 0) {
+                    m_QueueSignal.wait(queueLock, [this] {
+                        return m_bStopIOThread || !m_StatusQueue.empty() || !m_CommandQueue.empty();
+                    });
+                }
 
-        if (sendInfo.m_SequenceID != receivedPacket->m_nSequenceID)
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDCLIENTSEQUENCEID);
-        if (sendInfo.m_ClientID != receivedPacket->m_nClientID)
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDCLIENTID);
+                if (m_bStopIOThread)
+                    break;
+
+                while (nPacketsInFlight + packetsToSend.size() < m_nMaxPacketsInFlight) {
+                    if (!m_StatusQueue.empty()) {
+                        packetsToSend.push_back(m_StatusQueue.front());
+                        m_StatusQueue.pop_front();
+                    }
+                    else if (!m_CommandQueue.empty()) {
+                        packetsToSend.push_back(m_CommandQueue.front());
+                        m_CommandQueue.pop_front();
+                    }
+                    else
+                        break;
+                }
+            }
 
-        if (sendInfo.m_Callback != nullptr) {
-            auto callback = sendInfo.m_Callback;
-            callback(pPacket.get());
+            // All packets of one pass are written with a single send call.
+            sendBuffer.clear();
+            for (auto& queuedPacket : packetsToSend) {
+                if (m_ProtocolVersion == eDriver_BurProtocolVersion::Legacy)
+                    writePacketLegacy(queuedPacket, sendBuffer);
+                else
+                    writePacketVersion3(queuedPacket, sendBuffer);
+            }
+            if (!sendBuffer.empty())
+                pConnection->SendBuffer(sendBuffer);
+            nPacketsInFlight += packetsToSend.size();
+
+            if (nPacketsInFlight > 0) {
+                if (pConnection->WaitForData(BUR_IOTHREAD_POLLINTERVALINMS)) {
+                    if (m_ProtocolVersion == eDriver_BurProtocolVersion::Legacy)
+                        receivePacketLegacy(pConnection);
+                    else
+                        receivePacketVersion3(pConnection);
+                }
+                else {
+                    checkForReplyTimeout();
+                }
+            }
         }
+    }
+    catch (...) {
+        // The byte stream can not be resynchronized after an error, so the connection is dropped.
+        failAllPackets(std::current_exception());
 
-        //index++;
+        try {
+            pConnection->Disconnect();
+        }
+        catch (...) {
+        }
     }
 
 }
 
-void CDriver_BuRConnector::sendCommandsToPLCLegacy(std::vector<sAMCFToPLCPacketToSend>& packetList)
+void CDriver_BuRConnector::registerInFlightPacket(const sDriver_BuRQueuedPacket& queuedPacket, uint32_t nSequenceID, uint32_t nClientID)
 {
-    if (packetList.empty())
-        return;
+    sDriver_BuRInFlightPacket inFlightPacket;
+    inFlightPacket.m_pBatch = queuedPacket.m_pBatch;
+    inFlightPacket.m_nPacketIndex = queuedPacket.m_nPacketIndex;
+    inFlightPacket.m_nCommandID = queuedPacket.m_pBatch->m_Packets.at(queuedPacket.m_nPacketIndex).m_CommandID;
+    inFlightPacket.m_nClientID = nClientID;
+    inFlightPacket.m_SendTime = std::chrono::steady_clock::now();
 
-    if (m_pCurrentConnection == nullptr)
-        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_NOTCONNECTED);
+    std::lock_guard<std::mutex> sequenceLock(m_SequenceMapMutex);
+    m_InFlightPackets[nSequenceID] = inFlightPacket;
+}
 
-    std::default_random_engine generator;
-    std::uniform_int_distribution<int> distribution(1, 1024 * 1024 * 1024);
+void CDriver_BuRConnector::completeInFlightPacket(uint32_t nSequenceID, uint32_t nClientID, bool bUseReceivedCommandID, uint32_t nReceivedCommandID, uint32_t nErrorCode, std::vector<uint8_t>& payloadBuffer)
+{
+    sDriver_BuRInFlightPacket inFlightPacket;
+    {
+        std::lock_guard<std::mutex> sequenceLock(m_SequenceMapMutex);
+        auto iIter = m_InFlightPackets.find(nSequenceID);
+        if (iIter == m_InFlightPackets.end())
+            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDCLIENTSEQUENCEID, "received reply for unknown sequence ID: " + std::to_string(nSequenceID));
 
-    std::vector<sAMCFToPLCPacketLegacy> TCPPacketList;
-    std::vector<sAMCFToPLCPacketSendInfo> SendInfoList;
-
-    for (auto& packet : packetList) {
-        uint32_t nClientID = distribution(generator);
-
-        sAMCFToPLCPacketLegacy TCPpacket;
-        TCPpacket.m_nSignature = m_nPacketSignature;
-        TCPpacket.m_nCommandID = packet.m_CommandID;
-        TCPpacket.m_nMajorVersion = m_nMajorVersion;
-        TCPpacket.m_nMinorVersion = m_nMinorVersion;
-        TCPpacket.m_nPatchVersion = m_nPatchVersion;
-        TCPpacket.m_nBuildVersion = m_nBuildVersion;
-        TCPpacket.m_nClientID = nClientID;
-        TCPpacket.m_nSequenceID = m_nSequenceID;
-        TCPpacket.m_Payload = packet.m_Payload;
-        TCPpacket.m_nChecksum = CRC::Calculate(&TCPpacket, ((intptr_t)(&TCPpacket.m_nChecksum) - (intptr_t)(&TCPpacket)), CRC::CRC_32());
-        TCPPacketList.push_back(TCPpacket);
-
-        // Store send info
-        sAMCFToPLCPacketSendInfo sendInfo;
-        sendInfo.m_CommandID = TCPpacket.m_nCommandID;
-        sendInfo.m_SequenceID = TCPpacket.m_nSequenceID;
-        sendInfo.m_ClientID = TCPpacket.m_nClientID;
-        sendInfo.m_Callback = packet.m_Callback;
-        SendInfoList.push_back(sendInfo);
+        inFlightPacket = iIter->second;
+        m_InFlightPackets.erase(iIter);
+    }
 
-        m_nSequenceID++;
+    if (inFlightPacket.m_nClientID != nClientID)
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDCLIENTID);
+
+    auto pPacket = std::make_shared<CDriver_BuRPacket>(bUseReceivedCommandID ? nReceivedCommandID : inFlightPacket.m_nCommandID, nErrorCode);
+    pPacket->getDataBuffer().swap(payloadBuffer);
+
+    bool bBatchIsComplete = false;
+    {
+        std::lock_guard<std::mutex> queueLock(m_QueueMutex);
+        auto pBatch = inFlightPacket.m_pBatch;
+        pBatch->m_Replies.at(inFlightPacket.m_nPacketIndex) = pPacket;
+        if (pBatch->m_nOpenReplies > 0)
+            pBatch->m_nOpenReplies--;
+        bBatchIsComplete = (pBatch->m_nOpenReplies == 0);
     }
 
-    if (TCPPacketList.empty())
-        throw ELibMCDriver_BuRInterfaceException(LIBMCENV_ERROR_INTERNALERROR);
+    // Waiting threads are only woken once their whole batch has been answered.
+    if (bBatchIsComplete)
+        m_BatchSignal.notify_all();
+}
 
-    int index = 0;
-    for (auto& packetToSend : TCPPacketList) {
-        auto sendInfo = SendInfoList.at(index);
+void CDriver_BuRConnector::checkForReplyTimeout()
+{
+    auto currentTime = std::chrono::steady_clock::now();
 
-        if (packetToSend.m_nSequenceID != sendInfo.m_SequenceID)
-            throw ELibMCDriver_BuRInterfaceException(LIBMCENV_ERROR_INTERNALERROR);
+    std::lock_guard<std::mutex> sequenceLock(m_SequenceMapMutex);
+    for (auto& iIter : m_InFlightPackets) {
+        auto nWaitTimeInMS = std::chrono::duration_cast<std::chrono::milliseconds>(currentTime - iIter.second.m_SendTime).count();
+        if (nWaitTimeInMS > m_nReceiveTimeoutInMS)
+            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_COMMANDREACTIONTIMEOUT, "PLC did not reply to command " + std::to_string(iIter.second.m_nCommandID) + " (sequence ID " + std::to_string(iIter.first) + ")");
+    }
+}
 
-        m_pCurrentConnection->SendBuffer (LibMCEnv::CInputVector<uint8_t> ((uint8_t*)&packetToSend, sizeof(sAMCFToPLCPacketLegacy)));
-        index++;
+void CDriver_BuRConnector::failAllPackets(std::exception_ptr pException)
+{
+    std::vector<PDriver_BuRPacketBatch> failedBatches;
+    {
+        std::lock_guard<std::mutex> sequenceLock(m_SequenceMapMutex);
+        for (auto& iIter : m_InFlightPackets)
+            failedBatches.push_back(iIter.second.m_pBatch);
+        m_InFlightPackets.clear();
+    }
 
-        
+    {
+        std::lock_guard<std::mutex> queueLock(m_QueueMutex);
+        m_bIOThreadIsRunning = false;
+
+        for (auto& queuedPacket : m_StatusQueue)
+            failedBatches.push_back(queuedPacket.m_pBatch);
+        for (auto& queuedPacket : m_CommandQueue)
+            failedBatches.push_back(queuedPacket.m_pBatch);
+        m_StatusQueue.clear();
+        m_CommandQueue.clear();
+
+        for (auto pBatch : failedBatches) {
+            if (pBatch->m_pException == nullptr)
+                pBatch->m_pException = pException;
+        }
     }
 
-    //index = 0;
-    for (auto& sendInfo : SendInfoList) {
+    m_BatchSignal.notify_all();
+}
 
-        //auto sendInfo = SendInfoList.at(index);
+void CDriver_BuRConnector::writePacketVersion3(const sDriver_BuRQueuedPacket& queuedPacket, std::vector<uint8_t>& sendBuffer)
+{
+    auto& packet = queuedPacket.m_pBatch->m_Packets.at(queuedPacket.m_nPacketIndex);
+    std::uniform_int_distribution<uint32_t> distribution(1, 1024 * 1024 * 1024);
 
-        std::vector<uint8_t> recvBuffer;
-        auto pReceivedPacket = m_pCurrentConnection->ReceiveFixedPacket (sizeof(sPLCToAMCFPacketLegacy), m_nReceiveTimeoutInMS);
-        pReceivedPacket->GetData(recvBuffer);
+    sAMCFToPLCPacketVersion3 TCPpacket;
+    TCPpacket.m_nSignature = m_nPacketSignature;
+    TCPpacket.m_nCommandID = packet.m_CommandID;
+    TCPpacket.m_nClientID = distribution(m_ClientIDGenerator);
+    TCPpacket.m_nSequenceID = m_nSequenceID;
+    TCPpacket.m_Payload = packet.m_Payload;
+    TCPpacket.m_nChecksum = CRC::Calculate(&TCPpacket, ((intptr_t)(&TCPpacket.m_nChecksum) - (intptr_t)(&TCPpacket)), CRC::CRC_32());
+    m_nSequenceID++;
 
-        if (recvBuffer.size() != sizeof(sPLCToAMCFPacketLegacy))
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEERROR);
+    // Register before sending, so that the reply always finds its entry.
+    registerInFlightPacket(queuedPacket, TCPpacket.m_nSequenceID, TCPpacket.m_nClientID);
 
-        const sPLCToAMCFPacketLegacy* receivedPacket = (const sPLCToAMCFPacketLegacy*)recvBuffer.data();
-        if (receivedPacket->m_nSignature != m_nPacketSignature) {
-            disconnect();
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDPACKETSIGNATURE);
-        }
+    const uint8_t* pPacketData = (const uint8_t*)&TCPpacket;
+    sendBuffer.insert(sendBuffer.end(), pPacketData, pPacketData + sizeof(sAMCFToPLCPacketVersion3));
+}
 
-        auto pPacket = std::make_shared<CDriver_BuRPacket>(receivedPacket->m_nCommandID, receivedPacket->m_nErrorCode);
+void CDriver_BuRConnector::writePacketLegacy(const sDriver_BuRQueuedPacket& queuedPacket, std::vector<uint8_t>& sendBuffer)
+{
+    auto& packet = queuedPacket.m_pBatch->m_Packets.at(queuedPacket.m_nPacketIndex);
+    std::uniform_int_distribution<uint32_t> distribution(1, 1024 * 1024 * 1024);
 
-        if (receivedPacket->m_nMessageLen < sizeof(sPLCToAMCFPacketLegacy))
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDPACKETLENGTH);
+    sAMCFToPLCPacketLegacy TCPpacket;
+    TCPpacket.m_nSignature = m_nPacketSignature;
+    TCPpacket.m_nCommandID = packet.m_CommandID;
+    TCPpacket.m_nMajorVersion = m_nMajorVersion;
+    TCPpacket.m_nMinorVersion = m_nMinorVersion;
+    TCPpacket.m_nPatchVersion = m_nPatchVersion;
+    TCPpacket.m_nBuildVersion = m_nBuildVersion;
+    TCPpacket.m_nClientID = distribution(m_ClientIDGenerator);
+    TCPpacket.m_nSequenceID = m_nSequenceID;
+    TCPpacket.m_Payload = packet.m_Payload;
+    TCPpacket.m_nChecksum = CRC::Calculate(&TCPpacket, ((intptr_t)(&TCPpacket.m_nChecksum) - (intptr_t)(&TCPpacket)), CRC::CRC_32());
+    m_nSequenceID++;
 
-        uint32_t nDataLen = (receivedPacket->m_nMessageLen - sizeof(sPLCToAMCFPacketLegacy));
-        if (nDataLen > 0) {
-            auto pPayloadData = m_pCurrentConnection->ReceiveFixedPacket(nDataLen, m_nReceiveTimeoutInMS);
-            pPayloadData->GetData(pPacket->getDataBuffer());
-        }
+    registerInFlightPacket(queuedPacket, TCPpacket.m_nSequenceID, TCPpacket.m_nClientID);
+
+    const uint8_t* pPacketData = (const uint8_t*)&TCPpacket;
+    sendBuffer.insert(sendBuffer.end(), pPacketData, pPacketData + sizeof(sAMCFToPLCPacketLegacy));
+}
 
-        if (sendInfo.m_SequenceID != receivedPacket->m_nSequenceID)
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDCLIENTSEQUENCEID);
-        if (sendInfo.m_ClientID != receivedPacket->m_nClientID)
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDCLIENTID);
+void CDriver_BuRConnector::receivePacketVersion3(LibMCEnv::PTCPIPConnection pConnection)
+{
+    auto pReceivedPacket = pConnection->ReceiveFixedPacket(sizeof(sPLCToAMCFPacketVersion3), m_nReceiveTimeoutInMS);
 
-        if (sendInfo.m_Callback != nullptr) {
-            auto callback = sendInfo.m_Callback;
-            callback(pPacket.get());
-        }
+    std::vector<uint8_t> recvBuffer;
+    pReceivedPacket->GetData(recvBuffer);
 
-        //index++;
+    if (recvBuffer.size() != sizeof(sPLCToAMCFPacketVersion3))
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEERROR);
+
+    const sPLCToAMCFPacketVersion3* receivedPacket = (const sPLCToAMCFPacketVersion3*)recvBuffer.data();
+    if (receivedPacket->m_nSignature != m_nPacketSignature)
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDPACKETSIGNATURE);
+
+    if (receivedPacket->m_nPayloadLength > BUR_MAX_PAYLOADLENGTH)
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDPACKETLENGTH);
+
+    std::vector<uint8_t> payloadBuffer;
+    if (receivedPacket->m_nPayloadLength > 0) {
+        auto pPayloadPacket = pConnection->ReceiveFixedPacket(receivedPacket->m_nPayloadLength, m_nReceiveTimeoutInMS);
+        pPayloadPacket->GetData(payloadBuffer);
     }
+
+    completeInFlightPacket(receivedPacket->m_nSequenceID, receivedPacket->m_nClientID, false, 0, receivedPacket->m_nErrorCode, payloadBuffer);
+}
+
+void CDriver_BuRConnector::receivePacketLegacy(LibMCEnv::PTCPIPConnection pConnection)
+{
+    auto pReceivedPacket = pConnection->ReceiveFixedPacket(sizeof(sPLCToAMCFPacketLegacy), m_nReceiveTimeoutInMS);
+
+    std::vector<uint8_t> recvBuffer;
+    pReceivedPacket->GetData(recvBuffer);
+
+    if (recvBuffer.size() != sizeof(sPLCToAMCFPacketLegacy))
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEERROR);
+
+    const sPLCToAMCFPacketLegacy* receivedPacket = (const sPLCToAMCFPacketLegacy*)recvBuffer.data();
+    if (receivedPacket->m_nSignature != m_nPacketSignature)
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDPACKETSIGNATURE);
+
+    if ((receivedPacket->m_nMessageLen < sizeof(sPLCToAMCFPacketLegacy)) || (receivedPacket->m_nMessageLen - sizeof(sPLCToAMCFPacketLegacy) > BUR_MAX_PAYLOADLENGTH))
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDPACKETLENGTH);
+
+    std::vector<uint8_t> payloadBuffer;
+    uint32_t nDataLen = (receivedPacket->m_nMessageLen - sizeof(sPLCToAMCFPacketLegacy));
+    if (nDataLen > 0) {
+        auto pPayloadData = pConnection->ReceiveFixedPacket(nDataLen, m_nReceiveTimeoutInMS);
+        pPayloadData->GetData(payloadBuffer);
+    }
+
+    completeInFlightPacket(receivedPacket->m_nSequenceID, receivedPacket->m_nClientID, true, receivedPacket->m_nCommandID, receivedPacket->m_nErrorCode, payloadBuffer);
 }
 
 sAMCFToPLCPacketToSend CDriver_BuRConnector::makePacket(uint32_t nCommandID, BurPacketCallback callback)
@@ -709,10 +849,7 @@ void CDriver_BuRConnector::sendCommandToPLC(uint32_t nCommandID, sAMCFToPLCPacke
 
 void CDriver_BuRConnector::connect(const std::string& sIPAddress, const uint32_t nPort, const uint32_t nTimeout)
 {
-    {
-        std::lock_guard<std::mutex> lockGuard(m_ConnectionOrJournalMutex);
-        m_pCurrentConnection = nullptr;
-    }
+    disconnect();
 
     auto pConnection = m_pDriverEnvironment->CreateTCPIPConnection(sIPAddress, nPort, nTimeout);
 
@@ -721,6 +858,8 @@ void CDriver_BuRConnector::connect(const std::string& sIPAddress, const uint32_t
         m_pCurrentConnection = pConnection;
     }
 
+    startIOThread(pConnection);
+
     
 /*    std::thread connectionThread([this, sIPAddress, nPort] {
 
@@ -752,6 +891,9 @@ void CDriver_BuRConnector::connect(const std::string& sIPAddress, const uint32_t
 
 void CDriver_BuRConnector::disconnect()
 {
+    // The I/O thread must have finished before the socket is closed.
+    stopIOThread();
+
     std::lock_guard<std::mutex> lockGuard(m_ConnectionOrJournalMutex);
 
     if (m_pCurrentConnection.get() != nullptr) {
@@ -772,14 +914,16 @@ PDriver_BuRJournal CDriver_BuRConnector::retrieveJournalSchema()
 
     PDriver_BuRJournal pJournal;
 
-    sendCommandToPLC(BUR_COMMAND_DIRECT_CURRENTJOURNALSCHEMA, [&pJournal](CDriver_BuRPacket* pPacket) {
+    std::vector<sAMCFToPLCPacketToSend> packetList;
+    packetList.push_back(makePacket(BUR_COMMAND_DIRECT_CURRENTJOURNALSCHEMA, [&pJournal](CDriver_BuRPacket* pPacket) {
 
             auto schemaBuffer = pPacket->getDataBuffer();
 
             std::string schemaString(schemaBuffer.begin(), schemaBuffer.end());
             pJournal = std::make_shared<CDriver_BuRJournal>(schemaString);
 
-        });
+        }));
+    submitPacketsToPLC(packetList, true);
 
     if (pJournal == nullptr)
         throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_COULDNOTPARSEJOURNALSCHEMA);
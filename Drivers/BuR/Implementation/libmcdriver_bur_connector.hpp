@@ -44,7 +44,13 @@ Abstract: This is the class declaration of CDriver_BuR
 #include <map>
 #include <memory>
 #include <queue>
+#include <deque>
 #include <functional>
+#include <thread>
+#include <condition_variable>
+#include <chrono>
+#include <exception>
+#include <random>
 
 #define BUR_MINCUSTOMCOMMANDID 1024
 #define BUR_MAXCUSTOMCOMMANDID 65535
@@ -69,6 +75,9 @@ Abstract: This is the class declaration of CDriver_BuR
 
 #define BUR_MAX_PAYLOADLENGTH (1024 * 1024)
 
+// The I/O thread polls the socket in this interval while replies are outstanding, so that newly queued packets are sent without delay.
+#define BUR_IOTHREAD_POLLINTERVALINMS 1
+
 namespace LibMCDriver_BuR {
 namespace Impl {
 
@@ -110,6 +119,31 @@ public:
 
 typedef std::shared_ptr<CDriver_BuRPacket> PDriver_BuRPacket;
 
+
+// A list of packets that is submitted to the I/O thread as a whole.
+// The submitting thread waits until all replies have arrived and then executes the callbacks in order.
+struct sDriver_BuRPacketBatch {
+    std::vector<sAMCFToPLCPacketToSend> m_Packets;
+    std::vector<PDriver_BuRPacket> m_Replies;
+    size_t m_nOpenReplies;
+    std::exception_ptr m_pException;
+};
+
+typedef std::shared_ptr<sDriver_BuRPacketBatch> PDriver_BuRPacketBatch;
+
+struct sDriver_BuRQueuedPacket {
+    PDriver_BuRPacketBatch m_pBatch;
+    size_t m_nPacketIndex;
+};
+
+struct sDriver_BuRInFlightPacket {
+    PDriver_BuRPacketBatch m_pBatch;
+    size_t m_nPacketIndex;
+    uint32_t m_nCommandID;
+    uint32_t m_nClientID;
+    std::chrono::steady_clock::time_point m_SendTime;
+};
+
 class CDriver_BuRConnector {
 private:
 
@@ -138,7 +172,24 @@ protected:
     LibMCEnv::PTCPIPConnection m_pCurrentConnection;
 
     std::mutex m_ConnectionOrJournalMutex;
+
+    // All socket traffic runs on the I/O thread. Status requests are queued separately
+    // and are sent before any pending command, so that they are never stalled by long command lists.
+    std::thread m_IOThread;
+    std::mutex m_QueueMutex;
+    std::condition_variable m_QueueSignal;
+    std::condition_variable m_BatchSignal;
+    bool m_bIOThreadIsRunning;
+    bool m_bStopIOThread;
+    std::deque<sDriver_BuRQueuedPacket> m_StatusQueue;
+    std::deque<sDriver_BuRQueuedPacket> m_CommandQueue;
+
+    // Packets that have been sent but not answered, by sequence ID. Only the I/O thread modifies the map.
     std::mutex m_SequenceMapMutex;
+    std::map<uint32_t, sDriver_BuRInFlightPacket> m_InFlightPackets;
+    uint32_t m_nMaxPacketsInFlight;
+
+    std::mt19937 m_ClientIDGenerator;
 
     std::list<PDriver_BuRValue> m_DriverParameters;
     std::map<std::string, PDriver_BuRValue> m_DriverParameterMap;
@@ -150,8 +201,21 @@ protected:
 
     //PDriver_BuRPacket receiveCommandFromPLCEx (CDriver_BuRSocketConnection* pConnection);
 
-    void sendCommandsToPLCLegacy(std::vector<sAMCFToPLCPacketToSend>& packetList);
-    void sendCommandsToPLCVersion3(std::vector<sAMCFToPLCPacketToSend>& packetList);
+    void submitPacketsToPLC(std::vector<sAMCFToPLCPacketToSend>& packetList, bool bIsStatusRequest);
+
+    void startIOThread(LibMCEnv::PTCPIPConnection pConnection);
+    void stopIOThread();
+    void runIOThread(LibMCEnv::PTCPIPConnection pConnection);
+
+    void writePacketLegacy(const sDriver_BuRQueuedPacket& queuedPacket, std::vector<uint8_t>& sendBuffer);
+    void writePacketVersion3(const sDriver_BuRQueuedPacket& queuedPacket, std::vector<uint8_t>& sendBuffer);
+    void receivePacketLegacy(LibMCEnv::PTCPIPConnection pConnection);
+    void receivePacketVersion3(LibMCEnv::PTCPIPConnection pConnection);
+
+    void registerInFlightPacket(const sDriver_BuRQueuedPacket& queuedPacket, uint32_t nSequenceID, uint32_t nClientID);
+    void completeInFlightPacket(uint32_t nSequenceID, uint32_t nClientID, bool bUseReceivedCommandID, uint32_t nReceivedCommandID, uint32_t nErrorCode, std::vector<uint8_t>& payloadBuffer);
+    void checkForReplyTimeout();
+    void failAllPackets(std::exception_ptr pException);
 
 
 public:
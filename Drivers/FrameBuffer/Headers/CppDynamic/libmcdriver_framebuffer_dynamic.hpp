@@ -193,6 +193,7 @@ public:
 			case LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDSCREENSIZE: return "INVALIDSCREENSIZE";
 			case LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDDRAWBUFFER: return "INVALIDDRAWBUFFER";
 			case LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDLINELENGTH: return "INVALIDLINELENGTH";
+			case LIBMCDRIVER_FRAMEBUFFER_ERROR_FRAMEBUFFERIDENTIFIERALREADYEXISTS: return "FRAMEBUFFERIDENTIFIERALREADYEXISTS";
 		}
 		return "UNKNOWN";
 	}
@@ -224,6 +225,7 @@ public:
 			case LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDSCREENSIZE: return "invalid screen size";
 			case LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDDRAWBUFFER: return "invalid draw buffer";
 			case LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDLINELENGTH: return "invalid line length";
+			case LIBMCDRIVER_FRAMEBUFFER_ERROR_FRAMEBUFFERIDENTIFIERALREADYEXISTS: return "framebuffer identifier already exists";
 		}
 		return "unknown error";
 	}
@@ -0,0 +1,178 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+
+Abstract: This is the class definition of CFrameBufferDirtyRegion
+
+*/
+
+#include "libmcdriver_framebuffer_dirtyregion.hpp"
+
+#include <algorithm>
+
+using namespace LibMCDriver_FrameBuffer::Impl;
+
+static uint64_t rectangleArea(const sFrameBufferRectangle& rectangle)
+{
+    return (uint64_t)rectangle.m_nCountX * (uint64_t)rectangle.m_nCountY;
+}
+
+static sFrameBufferRectangle rectangleUnion(const sFrameBufferRectangle& first, const sFrameBufferRectangle& second)
+{
+    uint32_t nMinX = std::min(first.m_nX, second.m_nX);
+    uint32_t nMinY = std::min(first.m_nY, second.m_nY);
+    uint32_t nMaxX = std::max(first.m_nX + first.m_nCountX, second.m_nX + second.m_nCountX);
+    uint32_t nMaxY = std::max(first.m_nY + first.m_nCountY, second.m_nY + second.m_nCountY);
+
+    sFrameBufferRectangle result;
+    result.m_nX = nMinX;
+    result.m_nY = nMinY;
+    result.m_nCountX = nMaxX - nMinX;
+    result.m_nCountY = nMaxY - nMinY;
+    return result;
+}
+
+static bool rectanglesOverlap(const sFrameBufferRectangle& first, const sFrameBufferRectangle& second)
+{
+    return (first.m_nX < second.m_nX + second.m_nCountX) && (second.m_nX < first.m_nX + first.m_nCountX) &&
+        (first.m_nY < second.m_nY + second.m_nCountY) && (second.m_nY < first.m_nY + first.m_nCountY);
+}
+
+CFrameBufferDirtyRegion::CFrameBufferDirtyRegion(uint32_t nScreenWidth, uint32_t nScreenHeight)
+    : m_nScreenWidth(nScreenWidth), m_nScreenHeight(nScreenHeight)
+{
+    m_Rectangles.reserve(FRAMEBUFFER_MAXDIRTYRECTANGLES + 1);
+}
+
+CFrameBufferDirtyRegion::~CFrameBufferDirtyRegion()
+{
+
+}
+
+void CFrameBufferDirtyRegion::addRectangle(uint32_t nX, uint32_t nY, uint32_t nCountX, uint32_t nCountY)
+{
+    if ((nX >= m_nScreenWidth) || (nY >= m_nScreenHeight))
+        return;
+
+    sFrameBufferRectangle newRectangle;
+    newRectangle.m_nX = nX;
+    newRectangle.m_nY = nY;
+    newRectangle.m_nCountX = std::min(nCountX, m_nScreenWidth - nX);
+    newRectangle.m_nCountY = std::min(nCountY, m_nScreenHeight - nY);
+
+    if ((newRectangle.m_nCountX == 0) || (newRectangle.m_nCountY == 0))
+        return;
+
+    // Merge with every rectangle that overlaps or that adjoins without wasting area.
+    // A merged rectangle may in turn touch others, so the scan restarts after each merge.
+    bool bMerged = true;
+    while (bMerged) {
+        bMerged = false;
+
+        for (size_t nIndex = 0; nIndex < m_Rectangles.size(); nIndex++) {
+            auto& existingRectangle = m_Rectangles[nIndex];
+            sFrameBufferRectangle unionRectangle = rectangleUnion(existingRectangle, newRectangle);
+
+            if (rectangleArea(unionRectangle) == rectangleArea(existingRectangle))
+                return;
+
+            if (rectanglesOverlap(existingRectangle, newRectangle) ||
+                (rectangleArea(unionRectangle) <= rectangleArea(existingRectangle) + rectangleArea(newRectangle))) {
+                newRectangle = unionRectangle;
+                m_Rectangles[nIndex] = m_Rectangles.back();
+                m_Rectangles.pop_back();
+                bMerged = true;
+                break;
+            }
+        }
+    }
+
+    m_Rectangles.push_back(newRectangle);
+
+    if (m_Rectangles.size() > FRAMEBUFFER_MAXDIRTYRECTANGLES) {
+        sFrameBufferRectangle boundingBox = m_Rectangles.front();
+        for (auto& rectangle : m_Rectangles)
+            boundingBox = rectangleUnion(boundingBox, rectangle);
+
+        m_Rectangles.clear();
+        m_Rectangles.push_back(boundingBox);
+    }
+
+    // Copying a nearly complete screen in pieces is slower than copying it in one go.
+    if (getPixelCount() * 4 >= (uint64_t)m_nScreenWidth * (uint64_t)m_nScreenHeight * 3)
+        markFullScreen();
+}
+
+void CFrameBufferDirtyRegion::addRegion(const CFrameBufferDirtyRegion& region)
+{
+    for (auto& rectangle : region.m_Rectangles)
+        addRectangle(rectangle.m_nX, rectangle.m_nY, rectangle.m_nCountX, rectangle.m_nCountY);
+}
+
+void CFrameBufferDirtyRegion::markFullScreen()
+{
+    m_Rectangles.clear();
+
+    if ((m_nScreenWidth > 0) && (m_nScreenHeight > 0)) {
+        sFrameBufferRectangle screenRectangle;
+        screenRectangle.m_nX = 0;
+        screenRectangle.m_nY = 0;
+        screenRectangle.m_nCountX = m_nScreenWidth;
+        screenRectangle.m_nCountY = m_nScreenHeight;
+        m_Rectangles.push_back(screenRectangle);
+    }
+}
+
+void CFrameBufferDirtyRegion::clear()
+{
+    m_Rectangles.clear();
+}
+
+bool CFrameBufferDirtyRegion::isEmpty() const
+{
+    return m_Rectangles.empty();
+}
+
+bool CFrameBufferDirtyRegion::isFullScreen() const
+{
+    return (m_Rectangles.size() == 1) && (rectangleArea(m_Rectangles.front()) == (uint64_t)m_nScreenWidth * (uint64_t)m_nScreenHeight);
+}
+
+uint64_t CFrameBufferDirtyRegion::getPixelCount() const
+{
+    uint64_t nPixelCount = 0;
+    for (auto& rectangle : m_Rectangles)
+        nPixelCount += rectangleArea(rectangle);
+    return nPixelCount;
+}
+
+const std::vector<sFrameBufferRectangle>& CFrameBufferDirtyRegion::getRectangles() const
+{
+    return m_Rectangles;
+}
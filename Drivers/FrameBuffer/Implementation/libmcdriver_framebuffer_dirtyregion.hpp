@@ -0,0 +1,99 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+
+Abstract: This is the class declaration of CFrameBufferDirtyRegion
+
+*/
+
+
+#ifndef __LIBMCDRIVER_FRAMEBUFFER_DIRTYREGION
+#define __LIBMCDRIVER_FRAMEBUFFER_DIRTYREGION
+
+#include <vector>
+#include <cstdint>
+
+// Number of separate rectangles that are tracked before the region collapses into its bounding box.
+#define FRAMEBUFFER_MAXDIRTYRECTANGLES 32
+
+namespace LibMCDriver_FrameBuffer {
+namespace Impl {
+
+typedef struct _sFrameBufferRectangle {
+	uint32_t m_nX;
+	uint32_t m_nY;
+	uint32_t m_nCountX;
+	uint32_t m_nCountY;
+} sFrameBufferRectangle;
+
+
+/*************************************************************************************************************************
+ Class declaration of CFrameBufferDirtyRegion
+ Keeps the set of screen rectangles that have been drawn to since the region was last cleared.
+ Overlapping rectangles and rectangles whose union does not add any area are merged, so that
+ the list stays short and copying it never touches a pixel twice.
+**************************************************************************************************************************/
+
+class CFrameBufferDirtyRegion {
+private:
+
+	uint32_t m_nScreenWidth;
+	uint32_t m_nScreenHeight;
+
+	std::vector<sFrameBufferRectangle> m_Rectangles;
+
+public:
+
+	CFrameBufferDirtyRegion(uint32_t nScreenWidth, uint32_t nScreenHeight);
+
+	virtual ~CFrameBufferDirtyRegion();
+
+	// Adds a rectangle. Coordinates are clipped to the screen.
+	void addRectangle(uint32_t nX, uint32_t nY, uint32_t nCountX, uint32_t nCountY);
+
+	void addRegion(const CFrameBufferDirtyRegion& region);
+
+	void markFullScreen();
+
+	void clear();
+
+	bool isEmpty() const;
+
+	bool isFullScreen() const;
+
+	uint64_t getPixelCount() const;
+
+	const std::vector<sFrameBufferRectangle>& getRectangles() const;
+
+};
+
+} // namespace Impl
+} // namespace LibMCDriver_FrameBuffer
+
+#endif // __LIBMCDRIVER_FRAMEBUFFER_DIRTYREGION
@@ -35,6 +35,7 @@ Abstract: This is a stub class definition of CDriver_FrameBuffer
 #include "libmcdriver_framebuffer_interfaceexception.hpp"
 #include "libmcdriver_framebuffer_framebufferaccess.hpp"
 #include "libmcdriver_framebuffer_framebufferdevice.hpp"
+#include "libmcdriver_framebuffer_framebuffermemory.hpp"
 
 // Include custom headers here.
 #define __STRINGIZE(x) #x
@@ -90,7 +91,7 @@ void CDriver_FrameBuffer::QueryParametersEx(LibMCEnv::PDriverStatusUpdateSession
 
 bool CDriver_FrameBuffer::SupportsSimulation()
 {
-	return false;
+	return true;
 }
 
 bool CDriver_FrameBuffer::SupportsDevice()
@@ -105,12 +106,19 @@ bool CDriver_FrameBuffer::SupportsDevice()
 
 IFrameBufferAccess* CDriver_FrameBuffer::CreateFrameBufferSimulation(const std::string & sIdentifier, const LibMCDriver_FrameBuffer_uint32 nScreenWidth, const LibMCDriver_FrameBuffer_uint32 nScreenHeight, const LibMCDriver_FrameBuffer::eFrameBufferBitDepth eBitDepth)
 {
-	throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_NOTIMPLEMENTED);
+	checkIdentifier(sIdentifier);
+	checkIdentifierIsUnused(sIdentifier);
+
+	auto pInstance = std::make_shared<CFrameBufferMemoryInstance>(sIdentifier, nScreenWidth, nScreenHeight, eBitDepth, true);
+	m_Instances.insert(std::make_pair(sIdentifier, pInstance));
+
+	return new CFrameBufferAccess(pInstance);
 }
 
 IFrameBufferAccess* CDriver_FrameBuffer::OpenFrameBufferDevice(const std::string& sIdentifier, const std::string& sDeviceName, const bool bAllowSimulationFallback)
 {
 	checkIdentifier(sIdentifier);
+	checkIdentifierIsUnused(sIdentifier);
 	
 	PFrameBufferDeviceInstance pDevice;
 	
@@ -168,3 +176,9 @@ void CDriver_FrameBuffer::checkIdentifier(const std::string& sIdentifier)
 	}
 
 }
+
+void CDriver_FrameBuffer::checkIdentifierIsUnused(const std::string& sIdentifier)
+{
+	if (m_Instances.find(sIdentifier) != m_Instances.end())
+		throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_FRAMEBUFFERIDENTIFIERALREADYEXISTS, "framebuffer identifier already exists: " + sIdentifier);
+}
@@ -66,6 +66,8 @@ private:
 
 	void checkIdentifier(const std::string & sIdentifier);
 
+	void checkIdentifierIsUnused(const std::string & sIdentifier);
+
 public:
 
 	CDriver_FrameBuffer(const std::string & sName, LibMCEnv::PDriverEnvironment pDriverEnvironment);
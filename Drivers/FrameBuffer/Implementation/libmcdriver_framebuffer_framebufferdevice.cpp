@@ -114,22 +114,36 @@ CFrameBufferDeviceInstance::CFrameBufferDeviceInstance(const std::string& sIdent
         throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_COULDNOTMAPFRAMEBUFFERMEMORY);
     }
     
-    setDrawBuffer(m_pFramebufferPtr, m_nScanLineLength);
-
     LibMCDriver_FrameBuffer::sColor black;
     black.m_Red = 0;
     black.m_Green = 0;
     black.m_Blue = 0;
-    clearScreen(black);
+
+    // Both pages start out black, so that later flips only need to copy what has been drawn since.
+    uint32_t nPageCount = m_bDoubleBufferingEnabled ? 2 : 1;
+    for (uint32_t nPageIndex = 0; nPageIndex < nPageCount; nPageIndex++) {
+        setDrawBuffer(m_pFramebufferPtr + ((uint64_t)m_nScanLineLength * nScreenHeight * nPageIndex), m_nScanLineLength);
+        clearScreen(black);
+    }
 
     vinfo.yoffset = 0;
     ioctl(m_nFBDeviceHandle, FBIOPAN_DISPLAY, &vinfo);
 
     if (m_bDoubleBufferingEnabled) {
         m_nCurrentBufferIndex = 1;
-        setDrawBuffer(m_pFramebufferPtr + ((uint64_t)m_nScanLineLength * nScreenHeight), m_nScanLineLength);
+        m_ShadowBuffer.resize((size_t)m_nScanLineLength * nScreenHeight);
+        setDrawBuffer(m_ShadowBuffer.data(), m_nScanLineLength);
+        clearScreen(black);
+
+        for (uint32_t nPageIndex = 0; nPageIndex < 2; nPageIndex++)
+            m_pPageDirtyRegions[nPageIndex].reset(new CFrameBufferDirtyRegion(nScreenWidth, nScreenHeight));
+    }
+    else {
+        setDrawBuffer(m_pFramebufferPtr, m_nScanLineLength);
     }
 
+    clearDirtyRegion();
+
 #else
     throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_DEVICENOTSUPPORTEDONPLATFORM);
 #endif
@@ -159,25 +173,28 @@ void CFrameBufferDeviceInstance::flip()
         fb_var_screeninfo vinfo;
         if (ioctl(m_nFBDeviceHandle, FBIOGET_VSCREENINFO, &vinfo)) 
             throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_COULDNOTGETVARIABLESCREENINFO);
-        
+
+        // Both pages are now behind the shadow buffer by the rectangles of this frame.
+        // The hidden page is brought up to date and shown, the other page keeps its backlog for the next flip.
+        auto& frameRegion = getDirtyRegion();
+        m_pPageDirtyRegions[0]->addRegion(frameRegion);
+        m_pPageDirtyRegions[1]->addRegion(frameRegion);
+        clearDirtyRegion();
+
         uint32_t nScreenHeight = getScreenHeight();
+        uint8_t* pPagePtr = m_pFramebufferPtr + ((uint64_t)m_nScanLineLength * nScreenHeight * m_nCurrentBufferIndex);
+        copyRegion(*m_pPageDirtyRegions[m_nCurrentBufferIndex], m_ShadowBuffer.data(), pPagePtr);
+        m_pPageDirtyRegions[m_nCurrentBufferIndex]->clear();
+
         vinfo.yoffset = m_nCurrentBufferIndex * nScreenHeight;
         ioctl(m_nFBDeviceHandle, FBIOPAN_DISPLAY, &vinfo);
 
-        if (m_nCurrentBufferIndex == 0) {
-            m_nCurrentBufferIndex = 1;
-            setDrawBuffer(m_pFramebufferPtr + ((uint64_t)m_nScanLineLength * nScreenHeight), m_nScanLineLength);
-        }
-        else {
-            m_nCurrentBufferIndex = 0;
-            setDrawBuffer(m_pFramebufferPtr, m_nScanLineLength);
-
-        }
+        m_nCurrentBufferIndex = 1 - m_nCurrentBufferIndex;
 
 #endif
     }
     else {
-        setDrawBuffer(m_pFramebufferPtr, m_nScanLineLength);
+        clearDirtyRegion();
     }
 
 }
@@ -60,6 +60,11 @@ private:
 
 	uint32_t m_nScanLineLength;
 
+	// With double buffering, drawing goes to a shadow buffer in system memory. Each of the two pages
+	// remembers which rectangles changed since it was last shown, and only those are copied on flip.
+	std::vector<uint8_t> m_ShadowBuffer;
+	std::unique_ptr<CFrameBufferDirtyRegion> m_pPageDirtyRegions[2];
+
 
 public:
 	
@@ -34,6 +34,9 @@ Abstract: This is a stub class definition of CFrameBufferAccess
 #include "libmcdriver_framebuffer_framebufferinstance.hpp"
 #include "libmcdriver_framebuffer_interfaceexception.hpp"
 
+#include <cstring>
+#include <algorithm>
+
 using namespace LibMCDriver_FrameBuffer::Impl;
 
 CFrameBufferInstance::CFrameBufferInstance(const std::string& sIdentifier)
@@ -45,7 +48,7 @@ CFrameBufferInstance::CFrameBufferInstance(const std::string& sIdentifier)
     m_nLineLength (0)
 
 {
-
+    m_pDirtyRegion.reset(new CFrameBufferDirtyRegion(0, 0));
 }
 
 CFrameBufferInstance::~CFrameBufferInstance()
@@ -117,6 +120,8 @@ void CFrameBufferInstance::setPixel(const LibMCDriver_FrameBuffer_int32 nX, cons
                 }
 
             }
+
+            markDirty(nPositiveX, nPositiveY, 1, 1);
         }
     }
 }
@@ -180,7 +185,9 @@ void CFrameBufferInstance::fillRectangle(const LibMCDriver_FrameBuffer_int32 nX1
     uint32_t nCountX = (uint32_t) ((nMaxX - nMinX) + 1);
     uint32_t nCountY = (uint32_t) ((nMaxY - nMinY) + 1);
 
-    // Fill the rectangle based on the framebuffer's bit depth
+    // Encode the color once into the first pixel of the fill row
+    uint8_t pixelBytes[4];
+    size_t nBytesPerPixel;
     switch (m_BitDepth) {
     case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB565: {
 
@@ -190,70 +197,53 @@ void CFrameBufferInstance::fillRectangle(const LibMCDriver_FrameBuffer_int32 nX1
         uint32_t nBlue = RGBColor.m_Blue;
 
         uint16_t rawColor = ((nBlue & 0xF8) << 8) | ((nGreen & 0xFC) << 3) | (nRed >> 3);
-
-        // Fill the rectangle row by row
-        for (uint32_t nY = 0; nY < nCountY; nY++) {
-
-            uint16_t* pPixelPtr = (uint16_t*)(m_pDrawbufferPtr + (uint64_t)m_nLineLength * ((uint64_t)nY + nMinY)) + nMinX;
-
-            for (uint32_t nX = 0; nX < nCountX; nX++) {
-                *pPixelPtr = rawColor;
-                pPixelPtr++;
-            }
-        }
-
+        memcpy(pixelBytes, &rawColor, 2);
+        nBytesPerPixel = 2;
         break;
     }
 
-    case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB888: {
-
-        // Fill the rectangle row by row with 24-bit RGB values
-        for (uint32_t nY = 0; nY < nCountY; nY++) {
-
-            uint8_t* pPixelPtr = m_pDrawbufferPtr + (uint64_t)m_nLineLength * ((uint64_t)nY + nMinY) + (uint64_t) nMinX * 3;
-
-            for (uint32_t nX = 0; nX < nCountX; nX++) {
-                *pPixelPtr = RGBColor.m_Red;
-                pPixelPtr++;
-                *pPixelPtr = RGBColor.m_Green;
-                pPixelPtr++;
-                *pPixelPtr = RGBColor.m_Blue;
-                pPixelPtr++;
-            }
-        }
-
+    case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB888:
+        pixelBytes[0] = RGBColor.m_Red;
+        pixelBytes[1] = RGBColor.m_Green;
+        pixelBytes[2] = RGBColor.m_Blue;
+        nBytesPerPixel = 3;
         break;
-    }
-
-    case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGBA8888: {
-
-        // Fill the rectangle row by row with 32-bit RGBA values
-
-        for (uint32_t nY = 0; nY < nCountY; nY++) {
-
-            uint8_t* pPixelPtr = m_pDrawbufferPtr + (uint64_t)m_nLineLength * ((uint64_t)nY + nMinY) + (uint64_t)nMinX * 4;
-
-            for (uint32_t nX = 0; nX < nCountX; nX++) {
-                *pPixelPtr = RGBColor.m_Red;
-                pPixelPtr++;
-                *pPixelPtr = RGBColor.m_Green;
-                pPixelPtr++;
-                *pPixelPtr = RGBColor.m_Blue;
-                pPixelPtr++;
-                *pPixelPtr = 255; // Hardcoded alpha value (fully opaque)
-                pPixelPtr++;
-            }
-        }
 
+    case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGBA8888:
+        pixelBytes[0] = RGBColor.m_Red;
+        pixelBytes[1] = RGBColor.m_Green;
+        pixelBytes[2] = RGBColor.m_Blue;
+        pixelBytes[3] = 255; // Hardcoded alpha value (fully opaque)
+        nBytesPerPixel = 4;
         break;
-    }
 
     default:
         throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDPIXELFORMAT);
 
     }
 
+    // Build one row of the rectangle by doubling the filled part, so a row takes log2(CountX) copies
+    size_t nRowSize = (size_t)nCountX * nBytesPerPixel;
+    if (m_FillRowBuffer.size() < nRowSize)
+        m_FillRowBuffer.resize(nRowSize);
+
+    uint8_t* pRow = m_FillRowBuffer.data();
+    memcpy(pRow, pixelBytes, nBytesPerPixel);
+    size_t nFilledSize = nBytesPerPixel;
+    while (nFilledSize < nRowSize) {
+        size_t nCopySize = std::min(nFilledSize, nRowSize - nFilledSize);
+        memcpy(pRow + nFilledSize, pRow, nCopySize);
+        nFilledSize += nCopySize;
+    }
+
+    // Copy the row into the draw buffer. The draw buffer is never read, which matters for uncached device memory.
+    uint8_t* pLinePtr = m_pDrawbufferPtr + (uint64_t)m_nLineLength * (uint64_t)nMinY + (uint64_t)nMinX * nBytesPerPixel;
+    for (uint32_t nY = 0; nY < nCountY; nY++) {
+        memcpy(pLinePtr, pRow, nRowSize);
+        pLinePtr += m_nLineLength;
+    }
 
+    markDirty((uint32_t)nMinX, (uint32_t)nMinY, nCountX, nCountY);
 
 }
 
@@ -347,6 +337,8 @@ void CFrameBufferInstance::drawImage(const LibMCDriver_FrameBuffer_int32 nX, con
     // Write the relevant section of the image directly to the framebuffer memory
     pImage->WriteToRawMemory(nImageSectionStartX, nImageSectionStartY, nImageSectionCountX, nImageSectionCountY, imagePixelFormat, (LibMCEnv_pvoid)pTargetPtr, m_nLineLength);
 
+    markDirty(nFrameBufferCoordStartX, nFrameBufferCoordStartY, nImageSectionCountX, nImageSectionCountY);
+
 }
 
 void CFrameBufferInstance::setScreenResolution(uint32_t nScreenWidth, uint32_t nScreenHeight, LibMCDriver_FrameBuffer::eFrameBufferBitDepth bitDepth)
@@ -360,6 +352,8 @@ void CFrameBufferInstance::setScreenResolution(uint32_t nScreenWidth, uint32_t n
     m_nScreenWidth = nScreenWidth;
     m_nScreenHeight = nScreenHeight;
     m_BitDepth = bitDepth;
+
+    m_pDirtyRegion.reset(new CFrameBufferDirtyRegion(nScreenWidth, nScreenHeight));
 }
 
 void CFrameBufferInstance::setDrawBuffer(uint8_t* pDrawBuffer, uint32_t nLineLength)
@@ -373,3 +367,67 @@ void CFrameBufferInstance::setDrawBuffer(uint8_t* pDrawBuffer, uint32_t nLineLen
     m_nLineLength = nLineLength;
 }
 
+uint8_t* CFrameBufferInstance::getDrawBuffer()
+{
+    return m_pDrawbufferPtr;
+}
+
+uint32_t CFrameBufferInstance::getLineLength()
+{
+    return m_nLineLength;
+}
+
+uint32_t CFrameBufferInstance::getBytesPerPixel()
+{
+    switch (m_BitDepth) {
+    case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB565:
+        return 2;
+    case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB888:
+        return 3;
+    case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGBA8888:
+        return 4;
+    default:
+        throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDPIXELFORMAT);
+    }
+}
+
+void CFrameBufferInstance::markDirty(uint32_t nX, uint32_t nY, uint32_t nCountX, uint32_t nCountY)
+{
+    m_pDirtyRegion->addRectangle(nX, nY, nCountX, nCountY);
+}
+
+const CFrameBufferDirtyRegion& CFrameBufferInstance::getDirtyRegion()
+{
+    return *m_pDirtyRegion;
+}
+
+void CFrameBufferInstance::clearDirtyRegion()
+{
+    m_pDirtyRegion->clear();
+}
+
+void CFrameBufferInstance::copyRegion(const CFrameBufferDirtyRegion& region, const uint8_t* pSource, uint8_t* pTarget)
+{
+    if ((pSource == nullptr) || (pTarget == nullptr))
+        throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDDRAWBUFFER);
+
+    size_t nBytesPerPixel = getBytesPerPixel();
+
+    // A full screen region is one contiguous block if the lines have no padding
+    if (region.isFullScreen()) {
+        if (m_nLineLength == m_nScreenWidth * nBytesPerPixel) {
+            memcpy(pTarget, pSource, (size_t)m_nLineLength * m_nScreenHeight);
+            return;
+        }
+    }
+
+    for (auto& rectangle : region.getRectangles()) {
+        size_t nOffset = (size_t)m_nLineLength * rectangle.m_nY + (size_t)rectangle.m_nX * nBytesPerPixel;
+        size_t nRowSize = (size_t)rectangle.m_nCountX * nBytesPerPixel;
+
+        for (uint32_t nRow = 0; nRow < rectangle.m_nCountY; nRow++) {
+            memcpy(pTarget + nOffset, pSource + nOffset, nRowSize);
+            nOffset += m_nLineLength;
+        }
+    }
+}
@@ -36,6 +36,9 @@ Abstract: This is the class declaration of CFrameBufferAccess
 #define __LIBMCDRIVER_FRAMEBUFFER_FRAMEBUFFERINSTANCE
 
 #include "libmcdriver_framebuffer_interfaces.hpp"
+#include "libmcdriver_framebuffer_dirtyregion.hpp"
+
+#include <vector>
 
 #define FRAMEBUFFER_MINSCREENSIZE 128UL
 #define FRAMEBUFFER_MAXSCREENSIZE 16384UL
@@ -61,11 +64,28 @@ private:
 
 	LibMCDriver_FrameBuffer::eFrameBufferBitDepth m_BitDepth;
 
+	// Rectangles drawn to since the last flip.
+	std::unique_ptr<CFrameBufferDirtyRegion> m_pDirtyRegion;
+
+	// Scratch row that holds the pattern of a rectangle fill.
+	std::vector<uint8_t> m_FillRowBuffer;
+
+	void markDirty(uint32_t nX, uint32_t nY, uint32_t nCountX, uint32_t nCountY);
+
 protected:
 
 	void setScreenResolution (uint32_t nScreenWidth, uint32_t nScreenHeight, LibMCDriver_FrameBuffer::eFrameBufferBitDepth bitDepth);
 	void setDrawBuffer (uint8_t* pDrawBuffer, uint32_t nLineLength);
 
+	uint8_t* getDrawBuffer();
+	uint32_t getLineLength();
+	uint32_t getBytesPerPixel();
+
+	// Copies all rectangles of a region between two buffers with the same line length.
+	void copyRegion(const CFrameBufferDirtyRegion& region, const uint8_t* pSource, uint8_t* pTarget);
+
+	void clearDirtyRegion();
+
 public:
 
 	CFrameBufferInstance (const std::string & sIdentifier);
@@ -90,6 +110,8 @@ public:
 
 	void drawImage(const LibMCDriver_FrameBuffer_int32 nX, const LibMCDriver_FrameBuffer_int32 nY, LibMCEnv::PImageData pImage);
 
+	const CFrameBufferDirtyRegion& getDirtyRegion();
+
 };
 
 typedef std::shared_ptr<CFrameBufferInstance> PFrameBufferInstance;
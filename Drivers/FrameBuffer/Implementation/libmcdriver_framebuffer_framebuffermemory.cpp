@@ -0,0 +1,125 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+
+Abstract: This is the class definition of CFrameBufferMemoryInstance
+
+*/
+
+#include "libmcdriver_framebuffer_framebuffermemory.hpp"
+#include "libmcdriver_framebuffer_interfaceexception.hpp"
+
+// Scan lines are padded to a multiple of 16 bytes, like most framebuffer devices do.
+#define FRAMEBUFFER_MEMORYLINEALIGNMENT 16
+
+using namespace LibMCDriver_FrameBuffer::Impl;
+
+/*************************************************************************************************************************
+ Class definition of CFrameBufferMemoryInstance
+**************************************************************************************************************************/
+
+CFrameBufferMemoryInstance::CFrameBufferMemoryInstance(const std::string& sIdentifier, uint32_t nScreenWidth, uint32_t nScreenHeight, LibMCDriver_FrameBuffer::eFrameBufferBitDepth bitDepth, bool bDoubleBuffering)
+    : CFrameBufferInstance(sIdentifier),
+    m_bDoubleBufferingEnabled(bDoubleBuffering),
+    m_nScanLineLength(0),
+    m_nFlipCount(0),
+    m_nCopiedPixelCount(0)
+{
+    setScreenResolution(nScreenWidth, nScreenHeight, bitDepth);
+
+    uint32_t nRowSize = nScreenWidth * getBytesPerPixel();
+    m_nScanLineLength = ((nRowSize + FRAMEBUFFER_MEMORYLINEALIGNMENT - 1) / FRAMEBUFFER_MEMORYLINEALIGNMENT) * FRAMEBUFFER_MEMORYLINEALIGNMENT;
+
+    size_t nBufferSize = (size_t)m_nScanLineLength * nScreenHeight;
+    m_FrontBuffer.resize(nBufferSize, 0);
+
+    if (m_bDoubleBufferingEnabled) {
+        m_BackBuffer.resize(nBufferSize, 0);
+        setDrawBuffer(m_BackBuffer.data(), m_nScanLineLength);
+    }
+    else {
+        setDrawBuffer(m_FrontBuffer.data(), m_nScanLineLength);
+    }
+
+    LibMCDriver_FrameBuffer::sColor black;
+    black.m_Red = 0;
+    black.m_Green = 0;
+    black.m_Blue = 0;
+    clearScreen(black);
+
+    if (m_bDoubleBufferingEnabled)
+        flip();
+
+    clearDirtyRegion();
+    m_nFlipCount = 0;
+    m_nCopiedPixelCount = 0;
+}
+
+CFrameBufferMemoryInstance::~CFrameBufferMemoryInstance()
+{
+
+}
+
+void CFrameBufferMemoryInstance::flip()
+{
+    auto& dirtyRegion = getDirtyRegion();
+
+    if (m_bDoubleBufferingEnabled) {
+        copyRegion(dirtyRegion, m_BackBuffer.data(), m_FrontBuffer.data());
+        m_nCopiedPixelCount += dirtyRegion.getPixelCount();
+    }
+
+    clearDirtyRegion();
+    m_nFlipCount++;
+}
+
+bool CFrameBufferMemoryInstance::usesDoubleBuffering()
+{
+    return m_bDoubleBufferingEnabled;
+}
+
+const uint8_t* CFrameBufferMemoryInstance::getFrontBuffer()
+{
+    return m_FrontBuffer.data();
+}
+
+uint32_t CFrameBufferMemoryInstance::getScanLineLength()
+{
+    return m_nScanLineLength;
+}
+
+uint64_t CFrameBufferMemoryInstance::getFlipCount()
+{
+    return m_nFlipCount;
+}
+
+uint64_t CFrameBufferMemoryInstance::getCopiedPixelCount()
+{
+    return m_nCopiedPixelCount;
+}
@@ -119,6 +119,7 @@ typedef void * LibMCDriver_FrameBuffer_pvoid;
 #define LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDSCREENSIZE 1012 /** invalid screen size */
 #define LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDDRAWBUFFER 1013 /** invalid draw buffer */
 #define LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDLINELENGTH 1014 /** invalid line length */
+#define LIBMCDRIVER_FRAMEBUFFER_ERROR_FRAMEBUFFERIDENTIFIERALREADYEXISTS 1015 /** framebuffer identifier already exists */
 
 /*************************************************************************************************************************
  Error strings for LibMCDriver_FrameBuffer
@@ -150,6 +151,7 @@ inline const char * LIBMCDRIVER_FRAMEBUFFER_GETERRORSTRING (LibMCDriver_FrameBuf
     case LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDSCREENSIZE: return "invalid screen size";
     case LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDDRAWBUFFER: return "invalid draw buffer";
     case LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDLINELENGTH: return "invalid line length";
+    case LIBMCDRIVER_FRAMEBUFFER_ERROR_FRAMEBUFFERIDENTIFIERALREADYEXISTS: return "framebuffer identifier already exists";
     default: return "unknown error";
   }
 }
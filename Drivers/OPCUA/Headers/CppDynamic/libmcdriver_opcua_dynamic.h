@@ -255,6 +255,132 @@ typedef LibMCDriver_OPCUAResult (*PLibMCDriver_OPCUADriver_OPCUA_WriteDoublePtr)
 */
 typedef LibMCDriver_OPCUAResult (*PLibMCDriver_OPCUADriver_OPCUA_WriteStringPtr) (LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, const char * pValue);
 
+/**
+* Removes all entries from the read batch.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_OPCUAResult (*PLibMCDriver_OPCUADriver_OPCUA_ClearReadBatchPtr) (LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA);
+
+/**
+* Adds an integer node to the read batch.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to read
+* @param[in] eNodeType - Type of Node to read
+* @param[out] pEntryIndex - Index of the new batch entry.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_OPCUAResult (*PLibMCDriver_OPCUADriver_OPCUA_AddIntegerToReadBatchPtr) (LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, LibMCDriver_OPCUA::eUAIntegerType eNodeType, LibMCDriver_OPCUA_uint32 * pEntryIndex);
+
+/**
+* Adds a double node to the read batch.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to read
+* @param[in] eNodeType - Type of Node to read
+* @param[out] pEntryIndex - Index of the new batch entry.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_OPCUAResult (*PLibMCDriver_OPCUADriver_OPCUA_AddDoubleToReadBatchPtr) (LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, LibMCDriver_OPCUA::eUADoubleType eNodeType, LibMCDriver_OPCUA_uint32 * pEntryIndex);
+
+/**
+* Adds a string node to the read batch.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to read
+* @param[out] pEntryIndex - Index of the new batch entry.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_OPCUAResult (*PLibMCDriver_OPCUADriver_OPCUA_AddStringToReadBatchPtr) (LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, LibMCDriver_OPCUA_uint32 * pEntryIndex);
+
+/**
+* Reads all nodes of the read batch with a single read request. The batch stays in place and can be executed again. Fails if not connected or any node could not be read.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_OPCUAResult (*PLibMCDriver_OPCUADriver_OPCUA_ExecuteReadBatchPtr) (LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA);
+
+/**
+* Returns an integer value of the last executed read batch.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+* @param[out] pValue - Retrieved Node Value
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_OPCUAResult (*PLibMCDriver_OPCUADriver_OPCUA_GetBatchIntegerPtr) (LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nEntryIndex, LibMCDriver_OPCUA_int64 * pValue);
+
+/**
+* Returns a double value of the last executed read batch.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+* @param[out] pValue - Retrieved Node Value
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_OPCUAResult (*PLibMCDriver_OPCUADriver_OPCUA_GetBatchDoublePtr) (LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nEntryIndex, LibMCDriver_OPCUA_double * pValue);
+
+/**
+* Returns a string value of the last executed read batch.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+* @param[in] nValueBufferSize - size of the buffer (including trailing 0)
+* @param[out] pValueNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pValueBuffer -  buffer of Retrieved String Value, may be NULL
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_OPCUAResult (*PLibMCDriver_OPCUADriver_OPCUA_GetBatchStringPtr) (LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nEntryIndex, const LibMCDriver_OPCUA_uint32 nValueBufferSize, LibMCDriver_OPCUA_uint32* pValueNeededChars, char * pValueBuffer);
+
+/**
+* Queues an integer node value for the next FlushWriteQueue call.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to write
+* @param[in] eNodeType - Type of Node to write
+* @param[in] nValue - Node Value to write
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_OPCUAResult (*PLibMCDriver_OPCUADriver_OPCUA_QueueIntegerWritePtr) (LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, LibMCDriver_OPCUA::eUAIntegerType eNodeType, LibMCDriver_OPCUA_int64 nValue);
+
+/**
+* Queues a double node value for the next FlushWriteQueue call.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to write
+* @param[in] eNodeType - Type of Node to write
+* @param[in] dValue - Node Value to write
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_OPCUAResult (*PLibMCDriver_OPCUADriver_OPCUA_QueueDoubleWritePtr) (LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, LibMCDriver_OPCUA::eUADoubleType eNodeType, LibMCDriver_OPCUA_double dValue);
+
+/**
+* Queues a string node value for the next FlushWriteQueue call.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to write
+* @param[in] pValue - Node Value to write
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_OPCUAResult (*PLibMCDriver_OPCUADriver_OPCUA_QueueStringWritePtr) (LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, const char * pValue);
+
+/**
+* Writes all queued values with a single write request and empties the queue. Fails if not connected or any value could not be written.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_OPCUAResult (*PLibMCDriver_OPCUADriver_OPCUA_FlushWriteQueuePtr) (LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA);
+
 /*************************************************************************************************************************
  Global functions
 **************************************************************************************************************************/
@@ -350,6 +476,18 @@ typedef struct {
 	PLibMCDriver_OPCUADriver_OPCUA_WriteIntegerPtr m_Driver_OPCUA_WriteInteger;
 	PLibMCDriver_OPCUADriver_OPCUA_WriteDoublePtr m_Driver_OPCUA_WriteDouble;
 	PLibMCDriver_OPCUADriver_OPCUA_WriteStringPtr m_Driver_OPCUA_WriteString;
+	PLibMCDriver_OPCUADriver_OPCUA_ClearReadBatchPtr m_Driver_OPCUA_ClearReadBatch;
+	PLibMCDriver_OPCUADriver_OPCUA_AddIntegerToReadBatchPtr m_Driver_OPCUA_AddIntegerToReadBatch;
+	PLibMCDriver_OPCUADriver_OPCUA_AddDoubleToReadBatchPtr m_Driver_OPCUA_AddDoubleToReadBatch;
+	PLibMCDriver_OPCUADriver_OPCUA_AddStringToReadBatchPtr m_Driver_OPCUA_AddStringToReadBatch;
+	PLibMCDriver_OPCUADriver_OPCUA_ExecuteReadBatchPtr m_Driver_OPCUA_ExecuteReadBatch;
+	PLibMCDriver_OPCUADriver_OPCUA_GetBatchIntegerPtr m_Driver_OPCUA_GetBatchInteger;
+	PLibMCDriver_OPCUADriver_OPCUA_GetBatchDoublePtr m_Driver_OPCUA_GetBatchDouble;
+	PLibMCDriver_OPCUADriver_OPCUA_GetBatchStringPtr m_Driver_OPCUA_GetBatchString;
+	PLibMCDriver_OPCUADriver_OPCUA_QueueIntegerWritePtr m_Driver_OPCUA_QueueIntegerWrite;
+	PLibMCDriver_OPCUADriver_OPCUA_QueueDoubleWritePtr m_Driver_OPCUA_QueueDoubleWrite;
+	PLibMCDriver_OPCUADriver_OPCUA_QueueStringWritePtr m_Driver_OPCUA_QueueStringWrite;
+	PLibMCDriver_OPCUADriver_OPCUA_FlushWriteQueuePtr m_Driver_OPCUA_FlushWriteQueue;
 	PLibMCDriver_OPCUAGetVersionPtr m_GetVersion;
 	PLibMCDriver_OPCUAGetLastErrorPtr m_GetLastError;
 	PLibMCDriver_OPCUAReleaseInstancePtr m_ReleaseInstance;
@@ -248,6 +248,10 @@ public:
 			case LIBMCDRIVER_OPCUA_ERROR_COULDNOTWRITETOPAYLOAD: return "COULDNOTWRITETOPAYLOAD";
 			case LIBMCDRIVER_OPCUA_ERROR_INVALIDPAYLOADADDRESS: return "INVALIDPAYLOADADDRESS";
 			case LIBMCDRIVER_OPCUA_ERROR_COULDNOTCREATEOPCUACLIENT: return "COULDNOTCREATEOPCUACLIENT";
+			case LIBMCDRIVER_OPCUA_ERROR_NONODENAMEATTRIBUTE: return "NONODENAMEATTRIBUTE";
+			case LIBMCDRIVER_OPCUA_ERROR_INVALIDNODETYPE: return "INVALIDNODETYPE";
+			case LIBMCDRIVER_OPCUA_ERROR_INVALIDSUBSCRIPTIONNODE: return "INVALIDSUBSCRIPTIONNODE";
+			case LIBMCDRIVER_OPCUA_ERROR_DUPLICATESUBSCRIPTIONPARAMETER: return "DUPLICATESUBSCRIPTIONPARAMETER";
 		}
 		return "UNKNOWN";
 	}
@@ -338,6 +342,10 @@ public:
 			case LIBMCDRIVER_OPCUA_ERROR_COULDNOTWRITETOPAYLOAD: return "Could not write to payload.";
 			case LIBMCDRIVER_OPCUA_ERROR_INVALIDPAYLOADADDRESS: return "Invalid payload address.";
 			case LIBMCDRIVER_OPCUA_ERROR_COULDNOTCREATEOPCUACLIENT: return "Could not create OPCUA Client.";
+			case LIBMCDRIVER_OPCUA_ERROR_NONODENAMEATTRIBUTE: return "No node name attribute.";
+			case LIBMCDRIVER_OPCUA_ERROR_INVALIDNODETYPE: return "Invalid node type.";
+			case LIBMCDRIVER_OPCUA_ERROR_INVALIDSUBSCRIPTIONNODE: return "Invalid subscription node.";
+			case LIBMCDRIVER_OPCUA_ERROR_DUPLICATESUBSCRIPTIONPARAMETER: return "Duplicate subscription parameter.";
 		}
 		return "unknown error";
 	}
@@ -571,6 +579,18 @@ public:
 	inline void WriteInteger(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName, const eUAIntegerType eNodeType, const LibMCDriver_OPCUA_int64 nValue);
 	inline void WriteDouble(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName, const eUADoubleType eNodeType, const LibMCDriver_OPCUA_double dValue);
 	inline void WriteString(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName, const std::string & sValue);
+	inline void ClearReadBatch();
+	inline LibMCDriver_OPCUA_uint32 AddIntegerToReadBatch(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName, const eUAIntegerType eNodeType);
+	inline LibMCDriver_OPCUA_uint32 AddDoubleToReadBatch(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName, const eUADoubleType eNodeType);
+	inline LibMCDriver_OPCUA_uint32 AddStringToReadBatch(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName);
+	inline void ExecuteReadBatch();
+	inline LibMCDriver_OPCUA_int64 GetBatchInteger(const LibMCDriver_OPCUA_uint32 nEntryIndex);
+	inline LibMCDriver_OPCUA_double GetBatchDouble(const LibMCDriver_OPCUA_uint32 nEntryIndex);
+	inline std::string GetBatchString(const LibMCDriver_OPCUA_uint32 nEntryIndex);
+	inline void QueueIntegerWrite(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName, const eUAIntegerType eNodeType, const LibMCDriver_OPCUA_int64 nValue);
+	inline void QueueDoubleWrite(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName, const eUADoubleType eNodeType, const LibMCDriver_OPCUA_double dValue);
+	inline void QueueStringWrite(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName, const std::string & sValue);
+	inline void FlushWriteQueue();
 };
 	
 	/**
@@ -714,6 +734,18 @@ public:
 		pWrapperTable->m_Driver_OPCUA_WriteInteger = nullptr;
 		pWrapperTable->m_Driver_OPCUA_WriteDouble = nullptr;
 		pWrapperTable->m_Driver_OPCUA_WriteString = nullptr;
+		pWrapperTable->m_Driver_OPCUA_ClearReadBatch = nullptr;
+		pWrapperTable->m_Driver_OPCUA_AddIntegerToReadBatch = nullptr;
+		pWrapperTable->m_Driver_OPCUA_AddDoubleToReadBatch = nullptr;
+		pWrapperTable->m_Driver_OPCUA_AddStringToReadBatch = nullptr;
+		pWrapperTable->m_Driver_OPCUA_ExecuteReadBatch = nullptr;
+		pWrapperTable->m_Driver_OPCUA_GetBatchInteger = nullptr;
+		pWrapperTable->m_Driver_OPCUA_GetBatchDouble = nullptr;
+		pWrapperTable->m_Driver_OPCUA_GetBatchString = nullptr;
+		pWrapperTable->m_Driver_OPCUA_QueueIntegerWrite = nullptr;
+		pWrapperTable->m_Driver_OPCUA_QueueDoubleWrite = nullptr;
+		pWrapperTable->m_Driver_OPCUA_QueueStringWrite = nullptr;
+		pWrapperTable->m_Driver_OPCUA_FlushWriteQueue = nullptr;
 		pWrapperTable->m_GetVersion = nullptr;
 		pWrapperTable->m_GetLastError = nullptr;
 		pWrapperTable->m_ReleaseInstance = nullptr;
@@ -942,6 +974,114 @@ public:
 		if (pWrapperTable->m_Driver_OPCUA_WriteString == nullptr)
 			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_OPCUA_ClearReadBatch = (PLibMCDriver_OPCUADriver_OPCUA_ClearReadBatchPtr) GetProcAddress(hLibrary, "libmcdriver_opcua_driver_opcua_clearreadbatch");
+		#else // _WIN32
+		pWrapperTable->m_Driver_OPCUA_ClearReadBatch = (PLibMCDriver_OPCUADriver_OPCUA_ClearReadBatchPtr) dlsym(hLibrary, "libmcdriver_opcua_driver_opcua_clearreadbatch");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_OPCUA_ClearReadBatch == nullptr)
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_OPCUA_AddIntegerToReadBatch = (PLibMCDriver_OPCUADriver_OPCUA_AddIntegerToReadBatchPtr) GetProcAddress(hLibrary, "libmcdriver_opcua_driver_opcua_addintegertoreadbatch");
+		#else // _WIN32
+		pWrapperTable->m_Driver_OPCUA_AddIntegerToReadBatch = (PLibMCDriver_OPCUADriver_OPCUA_AddIntegerToReadBatchPtr) dlsym(hLibrary, "libmcdriver_opcua_driver_opcua_addintegertoreadbatch");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_OPCUA_AddIntegerToReadBatch == nullptr)
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_OPCUA_AddDoubleToReadBatch = (PLibMCDriver_OPCUADriver_OPCUA_AddDoubleToReadBatchPtr) GetProcAddress(hLibrary, "libmcdriver_opcua_driver_opcua_adddoubletoreadbatch");
+		#else // _WIN32
+		pWrapperTable->m_Driver_OPCUA_AddDoubleToReadBatch = (PLibMCDriver_OPCUADriver_OPCUA_AddDoubleToReadBatchPtr) dlsym(hLibrary, "libmcdriver_opcua_driver_opcua_adddoubletoreadbatch");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_OPCUA_AddDoubleToReadBatch == nullptr)
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_OPCUA_AddStringToReadBatch = (PLibMCDriver_OPCUADriver_OPCUA_AddStringToReadBatchPtr) GetProcAddress(hLibrary, "libmcdriver_opcua_driver_opcua_addstringtoreadbatch");
+		#else // _WIN32
+		pWrapperTable->m_Driver_OPCUA_AddStringToReadBatch = (PLibMCDriver_OPCUADriver_OPCUA_AddStringToReadBatchPtr) dlsym(hLibrary, "libmcdriver_opcua_driver_opcua_addstringtoreadbatch");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_OPCUA_AddStringToReadBatch == nullptr)
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_OPCUA_ExecuteReadBatch = (PLibMCDriver_OPCUADriver_OPCUA_ExecuteReadBatchPtr) GetProcAddress(hLibrary, "libmcdriver_opcua_driver_opcua_executereadbatch");
+		#else // _WIN32
+		pWrapperTable->m_Driver_OPCUA_ExecuteReadBatch = (PLibMCDriver_OPCUADriver_OPCUA_ExecuteReadBatchPtr) dlsym(hLibrary, "libmcdriver_opcua_driver_opcua_executereadbatch");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_OPCUA_ExecuteReadBatch == nullptr)
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_OPCUA_GetBatchInteger = (PLibMCDriver_OPCUADriver_OPCUA_GetBatchIntegerPtr) GetProcAddress(hLibrary, "libmcdriver_opcua_driver_opcua_getbatchinteger");
+		#else // _WIN32
+		pWrapperTable->m_Driver_OPCUA_GetBatchInteger = (PLibMCDriver_OPCUADriver_OPCUA_GetBatchIntegerPtr) dlsym(hLibrary, "libmcdriver_opcua_driver_opcua_getbatchinteger");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_OPCUA_GetBatchInteger == nullptr)
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_OPCUA_GetBatchDouble = (PLibMCDriver_OPCUADriver_OPCUA_GetBatchDoublePtr) GetProcAddress(hLibrary, "libmcdriver_opcua_driver_opcua_getbatchdouble");
+		#else // _WIN32
+		pWrapperTable->m_Driver_OPCUA_GetBatchDouble = (PLibMCDriver_OPCUADriver_OPCUA_GetBatchDoublePtr) dlsym(hLibrary, "libmcdriver_opcua_driver_opcua_getbatchdouble");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_OPCUA_GetBatchDouble == nullptr)
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_OPCUA_GetBatchString = (PLibMCDriver_OPCUADriver_OPCUA_GetBatchStringPtr) GetProcAddress(hLibrary, "libmcdriver_opcua_driver_opcua_getbatchstring");
+		#else // _WIN32
+		pWrapperTable->m_Driver_OPCUA_GetBatchString = (PLibMCDriver_OPCUADriver_OPCUA_GetBatchStringPtr) dlsym(hLibrary, "libmcdriver_opcua_driver_opcua_getbatchstring");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_OPCUA_GetBatchString == nullptr)
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_OPCUA_QueueIntegerWrite = (PLibMCDriver_OPCUADriver_OPCUA_QueueIntegerWritePtr) GetProcAddress(hLibrary, "libmcdriver_opcua_driver_opcua_queueintegerwrite");
+		#else // _WIN32
+		pWrapperTable->m_Driver_OPCUA_QueueIntegerWrite = (PLibMCDriver_OPCUADriver_OPCUA_QueueIntegerWritePtr) dlsym(hLibrary, "libmcdriver_opcua_driver_opcua_queueintegerwrite");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_OPCUA_QueueIntegerWrite == nullptr)
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_OPCUA_QueueDoubleWrite = (PLibMCDriver_OPCUADriver_OPCUA_QueueDoubleWritePtr) GetProcAddress(hLibrary, "libmcdriver_opcua_driver_opcua_queuedoublewrite");
+		#else // _WIN32
+		pWrapperTable->m_Driver_OPCUA_QueueDoubleWrite = (PLibMCDriver_OPCUADriver_OPCUA_QueueDoubleWritePtr) dlsym(hLibrary, "libmcdriver_opcua_driver_opcua_queuedoublewrite");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_OPCUA_QueueDoubleWrite == nullptr)
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_OPCUA_QueueStringWrite = (PLibMCDriver_OPCUADriver_OPCUA_QueueStringWritePtr) GetProcAddress(hLibrary, "libmcdriver_opcua_driver_opcua_queuestringwrite");
+		#else // _WIN32
+		pWrapperTable->m_Driver_OPCUA_QueueStringWrite = (PLibMCDriver_OPCUADriver_OPCUA_QueueStringWritePtr) dlsym(hLibrary, "libmcdriver_opcua_driver_opcua_queuestringwrite");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_OPCUA_QueueStringWrite == nullptr)
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_OPCUA_FlushWriteQueue = (PLibMCDriver_OPCUADriver_OPCUA_FlushWriteQueuePtr) GetProcAddress(hLibrary, "libmcdriver_opcua_driver_opcua_flushwritequeue");
+		#else // _WIN32
+		pWrapperTable->m_Driver_OPCUA_FlushWriteQueue = (PLibMCDriver_OPCUADriver_OPCUA_FlushWriteQueuePtr) dlsym(hLibrary, "libmcdriver_opcua_driver_opcua_flushwritequeue");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_OPCUA_FlushWriteQueue == nullptr)
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_GetVersion = (PLibMCDriver_OPCUAGetVersionPtr) GetProcAddress(hLibrary, "libmcdriver_opcua_getversion");
 		#else // _WIN32
@@ -1097,6 +1237,54 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_OPCUA_WriteString == nullptr) )
 			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdriver_opcua_driver_opcua_clearreadbatch", (void**)&(pWrapperTable->m_Driver_OPCUA_ClearReadBatch));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_OPCUA_ClearReadBatch == nullptr) )
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_opcua_driver_opcua_addintegertoreadbatch", (void**)&(pWrapperTable->m_Driver_OPCUA_AddIntegerToReadBatch));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_OPCUA_AddIntegerToReadBatch == nullptr) )
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_opcua_driver_opcua_adddoubletoreadbatch", (void**)&(pWrapperTable->m_Driver_OPCUA_AddDoubleToReadBatch));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_OPCUA_AddDoubleToReadBatch == nullptr) )
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_opcua_driver_opcua_addstringtoreadbatch", (void**)&(pWrapperTable->m_Driver_OPCUA_AddStringToReadBatch));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_OPCUA_AddStringToReadBatch == nullptr) )
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_opcua_driver_opcua_executereadbatch", (void**)&(pWrapperTable->m_Driver_OPCUA_ExecuteReadBatch));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_OPCUA_ExecuteReadBatch == nullptr) )
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_opcua_driver_opcua_getbatchinteger", (void**)&(pWrapperTable->m_Driver_OPCUA_GetBatchInteger));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_OPCUA_GetBatchInteger == nullptr) )
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_opcua_driver_opcua_getbatchdouble", (void**)&(pWrapperTable->m_Driver_OPCUA_GetBatchDouble));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_OPCUA_GetBatchDouble == nullptr) )
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_opcua_driver_opcua_getbatchstring", (void**)&(pWrapperTable->m_Driver_OPCUA_GetBatchString));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_OPCUA_GetBatchString == nullptr) )
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_opcua_driver_opcua_queueintegerwrite", (void**)&(pWrapperTable->m_Driver_OPCUA_QueueIntegerWrite));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_OPCUA_QueueIntegerWrite == nullptr) )
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_opcua_driver_opcua_queuedoublewrite", (void**)&(pWrapperTable->m_Driver_OPCUA_QueueDoubleWrite));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_OPCUA_QueueDoubleWrite == nullptr) )
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_opcua_driver_opcua_queuestringwrite", (void**)&(pWrapperTable->m_Driver_OPCUA_QueueStringWrite));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_OPCUA_QueueStringWrite == nullptr) )
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_opcua_driver_opcua_flushwritequeue", (void**)&(pWrapperTable->m_Driver_OPCUA_FlushWriteQueue));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_OPCUA_FlushWriteQueue == nullptr) )
+			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdriver_opcua_getversion", (void**)&(pWrapperTable->m_GetVersion));
 		if ( (eLookupError != 0) || (pWrapperTable->m_GetVersion == nullptr) )
 			return LIBMCDRIVER_OPCUA_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -1368,6 +1556,151 @@ public:
 	{
 		CheckError(m_pWrapper->m_WrapperTable.m_Driver_OPCUA_WriteString(m_pHandle, nNameSpace, sNodeName.c_str(), sValue.c_str()));
 	}
+	
+	/**
+	* CDriver_OPCUA::ClearReadBatch - Removes all entries from the read batch.
+	*/
+	void CDriver_OPCUA::ClearReadBatch()
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_OPCUA_ClearReadBatch(m_pHandle));
+	}
+	
+	/**
+	* CDriver_OPCUA::AddIntegerToReadBatch - Adds an integer node to the read batch.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to read
+	* @param[in] eNodeType - Type of Node to read
+	* @return Index of the new batch entry.
+	*/
+	LibMCDriver_OPCUA_uint32 CDriver_OPCUA::AddIntegerToReadBatch(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName, const eUAIntegerType eNodeType)
+	{
+		LibMCDriver_OPCUA_uint32 resultEntryIndex = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_OPCUA_AddIntegerToReadBatch(m_pHandle, nNameSpace, sNodeName.c_str(), eNodeType, &resultEntryIndex));
+		
+		return resultEntryIndex;
+	}
+	
+	/**
+	* CDriver_OPCUA::AddDoubleToReadBatch - Adds a double node to the read batch.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to read
+	* @param[in] eNodeType - Type of Node to read
+	* @return Index of the new batch entry.
+	*/
+	LibMCDriver_OPCUA_uint32 CDriver_OPCUA::AddDoubleToReadBatch(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName, const eUADoubleType eNodeType)
+	{
+		LibMCDriver_OPCUA_uint32 resultEntryIndex = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_OPCUA_AddDoubleToReadBatch(m_pHandle, nNameSpace, sNodeName.c_str(), eNodeType, &resultEntryIndex));
+		
+		return resultEntryIndex;
+	}
+	
+	/**
+	* CDriver_OPCUA::AddStringToReadBatch - Adds a string node to the read batch.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to read
+	* @return Index of the new batch entry.
+	*/
+	LibMCDriver_OPCUA_uint32 CDriver_OPCUA::AddStringToReadBatch(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName)
+	{
+		LibMCDriver_OPCUA_uint32 resultEntryIndex = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_OPCUA_AddStringToReadBatch(m_pHandle, nNameSpace, sNodeName.c_str(), &resultEntryIndex));
+		
+		return resultEntryIndex;
+	}
+	
+	/**
+	* CDriver_OPCUA::ExecuteReadBatch - Reads all nodes of the read batch with a single read request. The batch stays in place and can be executed again. Fails if not connected or any node could not be read.
+	*/
+	void CDriver_OPCUA::ExecuteReadBatch()
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_OPCUA_ExecuteReadBatch(m_pHandle));
+	}
+	
+	/**
+	* CDriver_OPCUA::GetBatchInteger - Returns an integer value of the last executed read batch.
+	* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+	* @return Retrieved Node Value
+	*/
+	LibMCDriver_OPCUA_int64 CDriver_OPCUA::GetBatchInteger(const LibMCDriver_OPCUA_uint32 nEntryIndex)
+	{
+		LibMCDriver_OPCUA_int64 resultValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_OPCUA_GetBatchInteger(m_pHandle, nEntryIndex, &resultValue));
+		
+		return resultValue;
+	}
+	
+	/**
+	* CDriver_OPCUA::GetBatchDouble - Returns a double value of the last executed read batch.
+	* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+	* @return Retrieved Node Value
+	*/
+	LibMCDriver_OPCUA_double CDriver_OPCUA::GetBatchDouble(const LibMCDriver_OPCUA_uint32 nEntryIndex)
+	{
+		LibMCDriver_OPCUA_double resultValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_OPCUA_GetBatchDouble(m_pHandle, nEntryIndex, &resultValue));
+		
+		return resultValue;
+	}
+	
+	/**
+	* CDriver_OPCUA::GetBatchString - Returns a string value of the last executed read batch.
+	* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+	* @return Retrieved String Value
+	*/
+	std::string CDriver_OPCUA::GetBatchString(const LibMCDriver_OPCUA_uint32 nEntryIndex)
+	{
+		LibMCDriver_OPCUA_uint32 bytesNeededValue = 0;
+		LibMCDriver_OPCUA_uint32 bytesWrittenValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_OPCUA_GetBatchString(m_pHandle, nEntryIndex, 0, &bytesNeededValue, nullptr));
+		std::vector<char> bufferValue(bytesNeededValue);
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_OPCUA_GetBatchString(m_pHandle, nEntryIndex, bytesNeededValue, &bytesWrittenValue, &bufferValue[0]));
+		
+		return std::string(&bufferValue[0]);
+	}
+	
+	/**
+	* CDriver_OPCUA::QueueIntegerWrite - Queues an integer node value for the next FlushWriteQueue call.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to write
+	* @param[in] eNodeType - Type of Node to write
+	* @param[in] nValue - Node Value to write
+	*/
+	void CDriver_OPCUA::QueueIntegerWrite(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName, const eUAIntegerType eNodeType, const LibMCDriver_OPCUA_int64 nValue)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_OPCUA_QueueIntegerWrite(m_pHandle, nNameSpace, sNodeName.c_str(), eNodeType, nValue));
+	}
+	
+	/**
+	* CDriver_OPCUA::QueueDoubleWrite - Queues a double node value for the next FlushWriteQueue call.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to write
+	* @param[in] eNodeType - Type of Node to write
+	* @param[in] dValue - Node Value to write
+	*/
+	void CDriver_OPCUA::QueueDoubleWrite(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName, const eUADoubleType eNodeType, const LibMCDriver_OPCUA_double dValue)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_OPCUA_QueueDoubleWrite(m_pHandle, nNameSpace, sNodeName.c_str(), eNodeType, dValue));
+	}
+	
+	/**
+	* CDriver_OPCUA::QueueStringWrite - Queues a string node value for the next FlushWriteQueue call.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to write
+	* @param[in] sValue - Node Value to write
+	*/
+	void CDriver_OPCUA::QueueStringWrite(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName, const std::string & sValue)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_OPCUA_QueueStringWrite(m_pHandle, nNameSpace, sNodeName.c_str(), sValue.c_str()));
+	}
+	
+	/**
+	* CDriver_OPCUA::FlushWriteQueue - Writes all queued values with a single write request and empties the queue. Fails if not connected or any value could not be written.
+	*/
+	void CDriver_OPCUA::FlushWriteQueue()
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_OPCUA_FlushWriteQueue(m_pHandle));
+	}
 
 } // namespace LibMCDriver_OPCUA
 
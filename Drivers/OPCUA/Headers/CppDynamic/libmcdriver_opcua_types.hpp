@@ -178,6 +178,10 @@ typedef void * LibMCDriver_OPCUA_pvoid;
 #define LIBMCDRIVER_OPCUA_ERROR_COULDNOTWRITETOPAYLOAD 1080 /** Could not write to payload. */
 #define LIBMCDRIVER_OPCUA_ERROR_INVALIDPAYLOADADDRESS 1081 /** Invalid payload address. */
 #define LIBMCDRIVER_OPCUA_ERROR_COULDNOTCREATEOPCUACLIENT 1082 /** Could not create OPCUA Client. */
+#define LIBMCDRIVER_OPCUA_ERROR_NONODENAMEATTRIBUTE 1083 /** No node name attribute. */
+#define LIBMCDRIVER_OPCUA_ERROR_INVALIDNODETYPE 1084 /** Invalid node type. */
+#define LIBMCDRIVER_OPCUA_ERROR_INVALIDSUBSCRIPTIONNODE 1085 /** Invalid subscription node. */
+#define LIBMCDRIVER_OPCUA_ERROR_DUPLICATESUBSCRIPTIONPARAMETER 1086 /** Duplicate subscription parameter. */
 
 /*************************************************************************************************************************
  Error strings for LibMCDriver_OPCUA
@@ -268,6 +272,10 @@ inline const char * LIBMCDRIVER_OPCUA_GETERRORSTRING (LibMCDriver_OPCUAResult nE
     case LIBMCDRIVER_OPCUA_ERROR_COULDNOTWRITETOPAYLOAD: return "Could not write to payload.";
     case LIBMCDRIVER_OPCUA_ERROR_INVALIDPAYLOADADDRESS: return "Invalid payload address.";
     case LIBMCDRIVER_OPCUA_ERROR_COULDNOTCREATEOPCUACLIENT: return "Could not create OPCUA Client.";
+    case LIBMCDRIVER_OPCUA_ERROR_NONODENAMEATTRIBUTE: return "No node name attribute.";
+    case LIBMCDRIVER_OPCUA_ERROR_INVALIDNODETYPE: return "Invalid node type.";
+    case LIBMCDRIVER_OPCUA_ERROR_INVALIDSUBSCRIPTIONNODE: return "Invalid subscription node.";
+    case LIBMCDRIVER_OPCUA_ERROR_DUPLICATESUBSCRIPTIONPARAMETER: return "Duplicate subscription parameter.";
     default: return "unknown error";
   }
 }
@@ -34,6 +34,7 @@ Abstract: This is a stub class definition of CDriver_OPCUA
 // Include custom headers here.
 #include "libmcdriver_opcua_driver_opcua.hpp"
 #include "libmcdriver_opcua_interfaceexception.hpp"
+#include "pugixml.hpp"
     
 #define __STRINGIZE(x) #x
 #define __STRINGIZE_VALUE_OF(x) __STRINGIZE(x)
@@ -78,12 +79,168 @@ COPCUA_DLLDirectoryCache::~COPCUA_DLLDirectoryCache()
 }
 
 
+static LibOpen62541::eUAIntegerType convertIntegerType(const LibMCDriver_OPCUA::eUAIntegerType eNodeType)
+{
+    switch (eNodeType) {
+        case LibMCDriver_OPCUA::eUAIntegerType::UAUInt8: return LibOpen62541::eUAIntegerType::UAUInt8;
+        case LibMCDriver_OPCUA::eUAIntegerType::UAUInt16: return LibOpen62541::eUAIntegerType::UAUInt16;
+        case LibMCDriver_OPCUA::eUAIntegerType::UAUInt32: return LibOpen62541::eUAIntegerType::UAUInt32;
+        case LibMCDriver_OPCUA::eUAIntegerType::UAUInt64: return LibOpen62541::eUAIntegerType::UAUInt64;
+        case LibMCDriver_OPCUA::eUAIntegerType::UAInt8: return LibOpen62541::eUAIntegerType::UAInt8;
+        case LibMCDriver_OPCUA::eUAIntegerType::UAInt16: return LibOpen62541::eUAIntegerType::UAInt16;
+        case LibMCDriver_OPCUA::eUAIntegerType::UAInt32: return LibOpen62541::eUAIntegerType::UAInt32;
+        case LibMCDriver_OPCUA::eUAIntegerType::UAInt64: return LibOpen62541::eUAIntegerType::UAInt64;
+        default: return LibOpen62541::eUAIntegerType::Unknown;
+    }
+}
+
+static LibOpen62541::eUADoubleType convertDoubleType(const LibMCDriver_OPCUA::eUADoubleType eNodeType)
+{
+    switch (eNodeType) {
+        case LibMCDriver_OPCUA::eUADoubleType::UAFloat32: return LibOpen62541::eUADoubleType::UAFloat32;
+        case LibMCDriver_OPCUA::eUADoubleType::UADouble64: return LibOpen62541::eUADoubleType::UADouble64;
+        default: return LibOpen62541::eUADoubleType::Unknown;
+    }
+}
+
+
+/*************************************************************************************************************************
+ Class definition of CDriver_OPCUAParameter
+**************************************************************************************************************************/
+
+CDriver_OPCUAParameter::CDriver_OPCUAParameter(const std::string& sName, const std::string& sDescription, uint32_t nNameSpace, const std::string& sNodeName, const eDriver_OPCUAParameterType eType, const LibOpen62541::eUAIntegerType eIntegerType, const LibOpen62541::eUADoubleType eDoubleType, double dSamplingIntervalInMS, double dDeadband)
+    : m_sName (sName), m_sDescription (sDescription), m_nNameSpace (nNameSpace), m_sNodeName (sNodeName), m_eType (eType), m_eIntegerType (eIntegerType), m_eDoubleType (eDoubleType), m_dSamplingIntervalInMS (dSamplingIntervalInMS), m_dDeadband (dDeadband)
+{
+
+}
+
+CDriver_OPCUAParameter::~CDriver_OPCUAParameter()
+{
+
+}
+
+std::string CDriver_OPCUAParameter::getName()
+{
+    return m_sName;
+}
+
+std::string CDriver_OPCUAParameter::getDescription()
+{
+    return m_sDescription;
+}
+
+uint32_t CDriver_OPCUAParameter::getNameSpace()
+{
+    return m_nNameSpace;
+}
+
+std::string CDriver_OPCUAParameter::getNodeName()
+{
+    return m_sNodeName;
+}
+
+eDriver_OPCUAParameterType CDriver_OPCUAParameter::getType()
+{
+    return m_eType;
+}
+
+LibOpen62541::eUAIntegerType CDriver_OPCUAParameter::getIntegerType()
+{
+    return m_eIntegerType;
+}
+
+LibOpen62541::eUADoubleType CDriver_OPCUAParameter::getDoubleType()
+{
+    return m_eDoubleType;
+}
+
+double CDriver_OPCUAParameter::getSamplingIntervalInMS()
+{
+    return m_dSamplingIntervalInMS;
+}
+
+double CDriver_OPCUAParameter::getDeadband()
+{
+    return m_dDeadband;
+}
+
+PDriver_OPCUAParameter readParameterFromXMLNode(pugi::xml_node& node, double dDefaultSamplingIntervalInMS)
+{
+    std::string sNodeType = node.name();
+
+    std::string sName = node.attribute("name").as_string();
+    if (sName.empty())
+        throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_NONAMEATTRIBUTE);
+
+    std::string sDescription = node.attribute("description").as_string();
+    if (sDescription.empty())
+        throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_NODESCRIPTIONATTRIBUTE, "parameter description missing: " + sName);
+
+    std::string sNodeName = node.attribute("nodename").as_string();
+    if (sNodeName.empty())
+        throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_NONODENAMEATTRIBUTE, "parameter node name missing: " + sName);
+
+    uint32_t nNameSpace = node.attribute("namespace").as_uint(0);
+
+    double dSamplingIntervalInMS = node.attribute("samplinginterval").as_double(dDefaultSamplingIntervalInMS);
+    double dDeadband = node.attribute("deadband").as_double(0.0);
+    if ((dSamplingIntervalInMS < 0.0) || (dDeadband < 0.0))
+        throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDPARAM, "invalid sampling interval or deadband: " + sName);
+
+    std::string sType = node.attribute("type").as_string();
+
+    if (sNodeType == "integer") {
+        LibOpen62541::eUAIntegerType eIntegerType = LibOpen62541::eUAIntegerType::Unknown;
+        if (sType == "uint8")
+            eIntegerType = LibOpen62541::eUAIntegerType::UAUInt8;
+        if (sType == "uint16")
+            eIntegerType = LibOpen62541::eUAIntegerType::UAUInt16;
+        if (sType == "uint32")
+            eIntegerType = LibOpen62541::eUAIntegerType::UAUInt32;
+        if (sType == "uint64")
+            eIntegerType = LibOpen62541::eUAIntegerType::UAUInt64;
+        if (sType == "int8")
+            eIntegerType = LibOpen62541::eUAIntegerType::UAInt8;
+        if (sType == "int16")
+            eIntegerType = LibOpen62541::eUAIntegerType::UAInt16;
+        if (sType == "int32")
+            eIntegerType = LibOpen62541::eUAIntegerType::UAInt32;
+        if (sType == "int64")
+            eIntegerType = LibOpen62541::eUAIntegerType::UAInt64;
+
+        if (eIntegerType == LibOpen62541::eUAIntegerType::Unknown)
+            throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDNODETYPE, "invalid integer node type: " + sName + "/" + sType);
+
+        return std::make_shared<CDriver_OPCUAParameter>(sName, sDescription, nNameSpace, sNodeName, eDriver_OPCUAParameterType::OPCUAParameter_Integer, eIntegerType, LibOpen62541::eUADoubleType::Unknown, dSamplingIntervalInMS, dDeadband);
+    }
+
+    if (sNodeType == "double") {
+        LibOpen62541::eUADoubleType eDoubleType = LibOpen62541::eUADoubleType::Unknown;
+        if (sType == "float")
+            eDoubleType = LibOpen62541::eUADoubleType::UAFloat32;
+        if (sType == "double")
+            eDoubleType = LibOpen62541::eUADoubleType::UADouble64;
+
+        if (eDoubleType == LibOpen62541::eUADoubleType::Unknown)
+            throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDNODETYPE, "invalid double node type: " + sName + "/" + sType);
+
+        return std::make_shared<CDriver_OPCUAParameter>(sName, sDescription, nNameSpace, sNodeName, eDriver_OPCUAParameterType::OPCUAParameter_Double, LibOpen62541::eUAIntegerType::Unknown, eDoubleType, dSamplingIntervalInMS, dDeadband);
+    }
+
+    if (sNodeType == "string")
+        return std::make_shared<CDriver_OPCUAParameter>(sName, sDescription, nNameSpace, sNodeName, eDriver_OPCUAParameterType::OPCUAParameter_String, LibOpen62541::eUAIntegerType::Unknown, LibOpen62541::eUADoubleType::Unknown, dSamplingIntervalInMS, 0.0);
+
+    throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDSUBSCRIPTIONNODE, "invalid subscription node: " + sNodeType);
+}
+
+
 /*************************************************************************************************************************
  Class definition of CDriver_OPCUA 
 **************************************************************************************************************************/
 
 CDriver_OPCUA::CDriver_OPCUA(const std::string& sName, LibMCEnv::PDriverEnvironment pDriverEnvironment)
-	: m_sName (sName), m_bSimulationMode (false), m_pDriverEnvironment (pDriverEnvironment), m_nMajorVersion (0), m_nMinorVersion (0), m_nPatchVersion (0)
+	: m_sName (sName), m_bSimulationMode (false), m_pDriverEnvironment (pDriverEnvironment), m_nMajorVersion (0), m_nMinorVersion (0), m_nPatchVersion (0),
+    m_dPublishingIntervalInMS (OPCUA_DEFAULTPUBLISHINGINTERVAL)
 {
 	if (pDriverEnvironment.get() == nullptr)
 		throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDPARAM);
@@ -102,6 +259,58 @@ CDriver_OPCUA::~CDriver_OPCUA()
 
 void CDriver_OPCUA::Configure(const std::string& sConfigurationString)
 {
+    // The configuration is optional. It lists the nodes that are monitored and mirrored into driver parameters:
+    // <driverconfiguration>
+    //   <subscription publishinginterval="50">
+    //     <integer name="..." description="..." namespace="2" nodename="..." type="int32" samplinginterval="10" deadband="1" />
+    //     <double name="..." description="..." namespace="2" nodename="..." type="double" samplinginterval="10" deadband="0.5" />
+    //     <string name="..." description="..." namespace="2" nodename="..." samplinginterval="100" />
+    //   </subscription>
+    // </driverconfiguration>
+    if (!sConfigurationString.empty()) {
+        pugi::xml_document doc;
+        pugi::xml_parse_result result = doc.load_string(sConfigurationString.c_str());
+        if (!result)
+            throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_COULDNOTPARSEDRIVERPROTOCOL);
+
+        pugi::xml_node configurationNode = doc.child("driverconfiguration");
+        if (configurationNode.empty())
+            throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDDRIVERPROTOCOL);
+
+        pugi::xml_node subscriptionNode = configurationNode.child("subscription");
+        if (!subscriptionNode.empty()) {
+            m_dPublishingIntervalInMS = subscriptionNode.attribute("publishinginterval").as_double(OPCUA_DEFAULTPUBLISHINGINTERVAL);
+            if (m_dPublishingIntervalInMS <= 0.0)
+                throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDPARAM, "invalid publishing interval: " + std::to_string(m_dPublishingIntervalInMS));
+
+            for (pugi::xml_node childNode : subscriptionNode.children()) {
+                PDriver_OPCUAParameter pParameter = readParameterFromXMLNode(childNode, m_dPublishingIntervalInMS);
+
+                if (m_SubscribedParameterMap.find(pParameter->getName()) != m_SubscribedParameterMap.end())
+                    throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_DUPLICATESUBSCRIPTIONPARAMETER, "duplicate subscription parameter: " + pParameter->getName());
+
+                m_SubscribedParameters.push_back(pParameter);
+                m_SubscribedParameterMap.insert(std::make_pair(pParameter->getName(), pParameter));
+
+                switch (pParameter->getType()) {
+                    case eDriver_OPCUAParameterType::OPCUAParameter_Integer:
+                        m_pDriverEnvironment->RegisterIntegerParameter(pParameter->getName(), pParameter->getDescription(), 0);
+                        break;
+
+                    case eDriver_OPCUAParameterType::OPCUAParameter_Double:
+                        m_pDriverEnvironment->RegisterDoubleParameter(pParameter->getName(), pParameter->getDescription(), 0.0);
+                        break;
+
+                    case eDriver_OPCUAParameterType::OPCUAParameter_String:
+                        m_pDriverEnvironment->RegisterStringParameter(pParameter->getName(), pParameter->getDescription(), "");
+                        break;
+
+                    default:
+                        break;
+                }
+            }
+        }
+    }
 
     m_pWorkingDirectory = m_pDriverEnvironment->CreateWorkingDirectory();
     m_pOpen62541DLL = m_pWorkingDirectory->StoreDriverData("open62541.dll", "open62541-x64");
@@ -156,6 +365,42 @@ void CDriver_OPCUA::QueryParametersEx(LibMCEnv::PDriverStatusUpdateSession pDriv
 {
     if (pDriverUpdateInstance.get() == nullptr)
         return;
+
+    if (m_bSimulationMode)
+        return;
+
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
+
+    if (m_MonitoredItemMap.empty() || (m_pClient.get() == nullptr))
+        return;
+
+    // The server only publishes values that have changed, so this does not cost a round trip per parameter.
+    m_pClient->ProcessSubscriptions(0);
+
+    LibOpen62541_uint32 nMonitoredItemID = 0;
+    while (m_pClient->PopChangedMonitoredItem(nMonitoredItemID)) {
+        auto iIter = m_MonitoredItemMap.find(nMonitoredItemID);
+        if (iIter == m_MonitoredItemMap.end())
+            continue;
+
+        auto pParameter = iIter->second;
+        switch (pParameter->getType()) {
+            case eDriver_OPCUAParameterType::OPCUAParameter_Integer:
+                pDriverUpdateInstance->SetIntegerParameter(pParameter->getName(), m_pClient->GetMonitoredItemInteger(nMonitoredItemID));
+                break;
+
+            case eDriver_OPCUAParameterType::OPCUAParameter_Double:
+                pDriverUpdateInstance->SetDoubleParameter(pParameter->getName(), m_pClient->GetMonitoredItemDouble(nMonitoredItemID));
+                break;
+
+            case eDriver_OPCUAParameterType::OPCUAParameter_String:
+                pDriverUpdateInstance->SetStringParameter(pParameter->getName(), m_pClient->GetMonitoredItemString(nMonitoredItemID));
+                break;
+
+            default:
+                break;
+        }
+    }
 }
 
 
@@ -171,6 +416,7 @@ bool CDriver_OPCUA::IsSimulationMode()
 
 void CDriver_OPCUA::DisableEncryption() 
 {
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
     m_pClient->DisableEncryption ();
 }
 
@@ -189,138 +435,175 @@ void CDriver_OPCUA::EnableEncryption(const std::string& sLocalCertificate, const
             eLibSecurityMode = LibOpen62541::eUASecurityMode::None;
     }
 
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
     m_pClient->EnableEncryption(sLocalCertificate, sPrivateKey, eLibSecurityMode);
 }
 
 bool CDriver_OPCUA::IsConnected()
 {
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
     return m_pClient->IsConnected();
 }
 
+void CDriver_OPCUA::createSubscription()
+{
+    m_MonitoredItemMap.clear();
+    if (m_SubscribedParameters.empty())
+        return;
+
+    LibOpen62541_uint32 nSubscriptionID = m_pClient->CreateSubscription(m_dPublishingIntervalInMS);
+
+    for (auto pParameter : m_SubscribedParameters) {
+        LibOpen62541_uint32 nMonitoredItemID = 0;
+
+        switch (pParameter->getType()) {
+            case eDriver_OPCUAParameterType::OPCUAParameter_Integer:
+                nMonitoredItemID = m_pClient->AddIntegerMonitoredItem(nSubscriptionID, pParameter->getNameSpace(), pParameter->getNodeName(), pParameter->getIntegerType(), pParameter->getSamplingIntervalInMS(), pParameter->getDeadband());
+                break;
+
+            case eDriver_OPCUAParameterType::OPCUAParameter_Double:
+                nMonitoredItemID = m_pClient->AddDoubleMonitoredItem(nSubscriptionID, pParameter->getNameSpace(), pParameter->getNodeName(), pParameter->getDoubleType(), pParameter->getSamplingIntervalInMS(), pParameter->getDeadband());
+                break;
+
+            case eDriver_OPCUAParameterType::OPCUAParameter_String:
+                nMonitoredItemID = m_pClient->AddStringMonitoredItem(nSubscriptionID, pParameter->getNameSpace(), pParameter->getNodeName(), pParameter->getSamplingIntervalInMS());
+                break;
+
+            default:
+                throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDNODETYPE, "invalid node type: " + pParameter->getName());
+        }
+
+        m_MonitoredItemMap.insert(std::make_pair(nMonitoredItemID, pParameter));
+    }
+}
+
 void CDriver_OPCUA::ConnectWithUserName(const std::string& sEndPointURL, const std::string& sUsername, const std::string& sPassword, const std::string& sApplicationURL)
 {
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
     m_pClient->ConnectUserName (sEndPointURL, sUsername, sPassword, sApplicationURL);
+
+    try {
+        createSubscription();
+    }
+    catch (...) {
+        m_MonitoredItemMap.clear();
+        m_pClient->Disconnect();
+        throw;
+    }
 }
 
 void CDriver_OPCUA::Disconnect()
 {
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
+    m_MonitoredItemMap.clear();
     m_pClient->Disconnect();
 }
 
 LibMCDriver_OPCUA_int64 CDriver_OPCUA::ReadInteger(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string& sNodeName, const LibMCDriver_OPCUA::eUAIntegerType eNodeType)
 {
-    LibOpen62541::eUAIntegerType eLibNodeType;
-    switch (eNodeType) {
-        case LibMCDriver_OPCUA::eUAIntegerType::UAUInt8:
-            eLibNodeType = LibOpen62541::eUAIntegerType::UAUInt8;
-            break;
-        case LibMCDriver_OPCUA::eUAIntegerType::UAUInt16:
-            eLibNodeType = LibOpen62541::eUAIntegerType::UAUInt16;
-            break;
-        case LibMCDriver_OPCUA::eUAIntegerType::UAUInt32:
-            eLibNodeType = LibOpen62541::eUAIntegerType::UAUInt32;
-            break;
-        case LibMCDriver_OPCUA::eUAIntegerType::UAUInt64:
-            eLibNodeType = LibOpen62541::eUAIntegerType::UAUInt64;
-            break;
-        case LibMCDriver_OPCUA::eUAIntegerType::UAInt8:
-            eLibNodeType = LibOpen62541::eUAIntegerType::UAInt8;
-            break;
-        case LibMCDriver_OPCUA::eUAIntegerType::UAInt16:
-            eLibNodeType = LibOpen62541::eUAIntegerType::UAInt16;
-            break;
-        case LibMCDriver_OPCUA::eUAIntegerType::UAInt32:
-            eLibNodeType = LibOpen62541::eUAIntegerType::UAInt32;
-            break;
-        case LibMCDriver_OPCUA::eUAIntegerType::UAInt64:
-            eLibNodeType = LibOpen62541::eUAIntegerType::UAInt64;
-            break;
-        default:
-            eLibNodeType = LibOpen62541::eUAIntegerType::Unknown;
-    }
-
-    return m_pClient->ReadInteger (nNameSpace, sNodeName, eLibNodeType);
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
+    return m_pClient->ReadInteger (nNameSpace, sNodeName, convertIntegerType (eNodeType));
 }
 
 LibMCDriver_OPCUA_double CDriver_OPCUA::ReadDouble(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string& sNodeName, const LibMCDriver_OPCUA::eUADoubleType eNodeType)
 {
-    LibOpen62541::eUADoubleType eLibNodeType;
-    switch (eNodeType) {
-    case LibMCDriver_OPCUA::eUADoubleType::UAFloat32:
-        eLibNodeType = LibOpen62541::eUADoubleType::UAFloat32;
-        break;
-    case LibMCDriver_OPCUA::eUADoubleType::UADouble64:
-        eLibNodeType = LibOpen62541::eUADoubleType::UADouble64;
-        break;
-    default:
-        eLibNodeType = LibOpen62541::eUADoubleType::Unknown;
-    }
-
-    return m_pClient->ReadDouble (nNameSpace, sNodeName, eLibNodeType);
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
+    return m_pClient->ReadDouble (nNameSpace, sNodeName, convertDoubleType (eNodeType));
 }
 
 std::string CDriver_OPCUA::ReadString(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string& sNodeName)
 {
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
     return m_pClient->ReadString(nNameSpace, sNodeName);
 }
 
 void CDriver_OPCUA::WriteInteger(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string& sNodeName, const LibMCDriver_OPCUA::eUAIntegerType eNodeType, const LibMCDriver_OPCUA_int64 nValue)
 {
-    LibOpen62541::eUAIntegerType eLibNodeType;
-    switch (eNodeType) {
-    case LibMCDriver_OPCUA::eUAIntegerType::UAUInt8:
-        eLibNodeType = LibOpen62541::eUAIntegerType::UAUInt8;
-        break;
-    case LibMCDriver_OPCUA::eUAIntegerType::UAUInt16:
-        eLibNodeType = LibOpen62541::eUAIntegerType::UAUInt16;
-        break;
-    case LibMCDriver_OPCUA::eUAIntegerType::UAUInt32:
-        eLibNodeType = LibOpen62541::eUAIntegerType::UAUInt32;
-        break;
-    case LibMCDriver_OPCUA::eUAIntegerType::UAUInt64:
-        eLibNodeType = LibOpen62541::eUAIntegerType::UAUInt64;
-        break;
-    case LibMCDriver_OPCUA::eUAIntegerType::UAInt8:
-        eLibNodeType = LibOpen62541::eUAIntegerType::UAInt8;
-        break;
-    case LibMCDriver_OPCUA::eUAIntegerType::UAInt16:
-        eLibNodeType = LibOpen62541::eUAIntegerType::UAInt16;
-        break;
-    case LibMCDriver_OPCUA::eUAIntegerType::UAInt32:
-        eLibNodeType = LibOpen62541::eUAIntegerType::UAInt32;
-        break;
-    case LibMCDriver_OPCUA::eUAIntegerType::UAInt64:
-        eLibNodeType = LibOpen62541::eUAIntegerType::UAInt64;
-        break;
-    default:
-        eLibNodeType = LibOpen62541::eUAIntegerType::Unknown;
-    }
-
-    m_pClient->WriteInteger(nNameSpace, sNodeName, eLibNodeType, nValue);
-
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
+    m_pClient->WriteInteger(nNameSpace, sNodeName, convertIntegerType (eNodeType), nValue);
 }
 
 void CDriver_OPCUA::WriteDouble(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string& sNodeName, const LibMCDriver_OPCUA::eUADoubleType eNodeType, const LibMCDriver_OPCUA_double dValue)
 {
-    LibOpen62541::eUADoubleType eLibNodeType;
-    switch (eNodeType) {
-    case LibMCDriver_OPCUA::eUADoubleType::UAFloat32:
-        eLibNodeType = LibOpen62541::eUADoubleType::UAFloat32;
-        break;
-    case LibMCDriver_OPCUA::eUADoubleType::UADouble64:
-        eLibNodeType = LibOpen62541::eUADoubleType::UADouble64;
-        break;
-    default:
-        eLibNodeType = LibOpen62541::eUADoubleType::Unknown;
-    }
-
-    m_pClient->WriteDouble(nNameSpace, sNodeName, eLibNodeType, dValue);
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
+    m_pClient->WriteDouble(nNameSpace, sNodeName, convertDoubleType (eNodeType), dValue);
 }
 
 
 void CDriver_OPCUA::WriteString(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string& sNodeName, const std::string& sValue)
 {
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
     m_pClient->WriteString(nNameSpace, sNodeName, sValue);
 }
 
+void CDriver_OPCUA::ClearReadBatch()
+{
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
+    m_pClient->ClearReadBatch();
+}
+
+LibMCDriver_OPCUA_uint32 CDriver_OPCUA::AddIntegerToReadBatch(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string& sNodeName, const LibMCDriver_OPCUA::eUAIntegerType eNodeType)
+{
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
+    return m_pClient->AddIntegerToReadBatch(nNameSpace, sNodeName, convertIntegerType(eNodeType));
+}
+
+LibMCDriver_OPCUA_uint32 CDriver_OPCUA::AddDoubleToReadBatch(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string& sNodeName, const LibMCDriver_OPCUA::eUADoubleType eNodeType)
+{
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
+    return m_pClient->AddDoubleToReadBatch(nNameSpace, sNodeName, convertDoubleType(eNodeType));
+}
+
+LibMCDriver_OPCUA_uint32 CDriver_OPCUA::AddStringToReadBatch(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string& sNodeName)
+{
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
+    return m_pClient->AddStringToReadBatch(nNameSpace, sNodeName);
+}
+
+void CDriver_OPCUA::ExecuteReadBatch()
+{
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
+    m_pClient->ExecuteReadBatch();
+}
+
+LibMCDriver_OPCUA_int64 CDriver_OPCUA::GetBatchInteger(const LibMCDriver_OPCUA_uint32 nEntryIndex)
+{
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
+    return m_pClient->GetBatchInteger(nEntryIndex);
+}
+
+LibMCDriver_OPCUA_double CDriver_OPCUA::GetBatchDouble(const LibMCDriver_OPCUA_uint32 nEntryIndex)
+{
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
+    return m_pClient->GetBatchDouble(nEntryIndex);
+}
+
+std::string CDriver_OPCUA::GetBatchString(const LibMCDriver_OPCUA_uint32 nEntryIndex)
+{
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
+    return m_pClient->GetBatchString(nEntryIndex);
+}
+
+void CDriver_OPCUA::QueueIntegerWrite(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string& sNodeName, const LibMCDriver_OPCUA::eUAIntegerType eNodeType, const LibMCDriver_OPCUA_int64 nValue)
+{
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
+    m_pClient->QueueIntegerWrite(nNameSpace, sNodeName, convertIntegerType(eNodeType), nValue);
+}
+
+void CDriver_OPCUA::QueueDoubleWrite(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string& sNodeName, const LibMCDriver_OPCUA::eUADoubleType eNodeType, const LibMCDriver_OPCUA_double dValue)
+{
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
+    m_pClient->QueueDoubleWrite(nNameSpace, sNodeName, convertDoubleType(eNodeType), dValue);
+}
 
+void CDriver_OPCUA::QueueStringWrite(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string& sNodeName, const std::string& sValue)
+{
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
+    m_pClient->QueueStringWrite(nNameSpace, sNodeName, sValue);
+}
+
+void CDriver_OPCUA::FlushWriteQueue()
+{
+    std::lock_guard<std::mutex> lockGuard(m_ClientMutex);
+    m_pClient->FlushWriteQueue();
+}
@@ -40,6 +40,11 @@ Abstract: This is the class declaration of CDriver_OPCUA
 
 // Parent classes
 #include "libmcdriver_opcua_driver.hpp"
+
+#include <mutex>
+#include <map>
+#include <vector>
+
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable : 4250)
@@ -53,6 +58,45 @@ namespace Impl {
  Class declaration of CDriver_OPCUA 
 **************************************************************************************************************************/
 
+#define OPCUA_DEFAULTPUBLISHINGINTERVAL 50.0
+
+enum class eDriver_OPCUAParameterType : int32_t {
+	OPCUAParameter_Unknown = 0,
+	OPCUAParameter_Integer = 1,
+	OPCUAParameter_Double = 2,
+	OPCUAParameter_String = 3
+};
+
+// A node that is monitored by the server and mirrored into a driver parameter.
+class CDriver_OPCUAParameter {
+private:
+	std::string m_sName;
+	std::string m_sDescription;
+	uint32_t m_nNameSpace;
+	std::string m_sNodeName;
+	eDriver_OPCUAParameterType m_eType;
+	LibOpen62541::eUAIntegerType m_eIntegerType;
+	LibOpen62541::eUADoubleType m_eDoubleType;
+	double m_dSamplingIntervalInMS;
+	double m_dDeadband;
+public:
+	CDriver_OPCUAParameter(const std::string& sName, const std::string& sDescription, uint32_t nNameSpace, const std::string& sNodeName, const eDriver_OPCUAParameterType eType, const LibOpen62541::eUAIntegerType eIntegerType, const LibOpen62541::eUADoubleType eDoubleType, double dSamplingIntervalInMS, double dDeadband);
+	virtual ~CDriver_OPCUAParameter();
+
+	std::string getName();
+	std::string getDescription();
+	uint32_t getNameSpace();
+	std::string getNodeName();
+	eDriver_OPCUAParameterType getType();
+	LibOpen62541::eUAIntegerType getIntegerType();
+	LibOpen62541::eUADoubleType getDoubleType();
+	double getSamplingIntervalInMS();
+	double getDeadband();
+
+};
+
+typedef std::shared_ptr<CDriver_OPCUAParameter> PDriver_OPCUAParameter;
+
 
 class CDriver_OPCUA : public virtual IDriver_OPCUA, public virtual CDriver {
 private:
@@ -77,6 +121,16 @@ protected:
 	LibOpen62541::PWrapper m_pLibraryWrapper;
 	LibOpen62541::POPCClient m_pClient;	
 
+	// QueryParametersEx might be called out of thread, so every access to the client is guarded.
+	std::mutex m_ClientMutex;
+
+	double m_dPublishingIntervalInMS;
+	std::vector<PDriver_OPCUAParameter> m_SubscribedParameters;
+	std::map<std::string, PDriver_OPCUAParameter> m_SubscribedParameterMap;
+	std::map<uint32_t, PDriver_OPCUAParameter> m_MonitoredItemMap;
+
+	void createSubscription();
+
 public:
 
 	CDriver_OPCUA(const std::string & sName, LibMCEnv::PDriverEnvironment pDriverEnvironment);
@@ -120,6 +174,30 @@ public:
 
 	void WriteString(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string& sNodeName, const std::string& sValue) override;
 
+	void ClearReadBatch() override;
+
+	LibMCDriver_OPCUA_uint32 AddIntegerToReadBatch(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string& sNodeName, const LibMCDriver_OPCUA::eUAIntegerType eNodeType) override;
+
+	LibMCDriver_OPCUA_uint32 AddDoubleToReadBatch(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string& sNodeName, const LibMCDriver_OPCUA::eUADoubleType eNodeType) override;
+
+	LibMCDriver_OPCUA_uint32 AddStringToReadBatch(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string& sNodeName) override;
+
+	void ExecuteReadBatch() override;
+
+	LibMCDriver_OPCUA_int64 GetBatchInteger(const LibMCDriver_OPCUA_uint32 nEntryIndex) override;
+
+	LibMCDriver_OPCUA_double GetBatchDouble(const LibMCDriver_OPCUA_uint32 nEntryIndex) override;
+
+	std::string GetBatchString(const LibMCDriver_OPCUA_uint32 nEntryIndex) override;
+
+	void QueueIntegerWrite(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string& sNodeName, const LibMCDriver_OPCUA::eUAIntegerType eNodeType, const LibMCDriver_OPCUA_int64 nValue) override;
+
+	void QueueDoubleWrite(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string& sNodeName, const LibMCDriver_OPCUA::eUADoubleType eNodeType, const LibMCDriver_OPCUA_double dValue) override;
+
+	void QueueStringWrite(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string& sNodeName, const std::string& sValue) override;
+
+	void FlushWriteQueue() override;
+
 };
 
 } // namespace Impl
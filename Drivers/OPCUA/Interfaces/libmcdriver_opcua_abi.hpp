@@ -268,6 +268,132 @@ LIBMCDRIVER_OPCUA_DECLSPEC LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcu
 */
 LIBMCDRIVER_OPCUA_DECLSPEC LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_writestring(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, const char * pValue);
 
+/**
+* Removes all entries from the read batch.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_OPCUA_DECLSPEC LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_clearreadbatch(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA);
+
+/**
+* Adds an integer node to the read batch.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to read
+* @param[in] eNodeType - Type of Node to read
+* @param[out] pEntryIndex - Index of the new batch entry.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_OPCUA_DECLSPEC LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_addintegertoreadbatch(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, LibMCDriver_OPCUA::eUAIntegerType eNodeType, LibMCDriver_OPCUA_uint32 * pEntryIndex);
+
+/**
+* Adds a double node to the read batch.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to read
+* @param[in] eNodeType - Type of Node to read
+* @param[out] pEntryIndex - Index of the new batch entry.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_OPCUA_DECLSPEC LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_adddoubletoreadbatch(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, LibMCDriver_OPCUA::eUADoubleType eNodeType, LibMCDriver_OPCUA_uint32 * pEntryIndex);
+
+/**
+* Adds a string node to the read batch.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to read
+* @param[out] pEntryIndex - Index of the new batch entry.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_OPCUA_DECLSPEC LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_addstringtoreadbatch(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, LibMCDriver_OPCUA_uint32 * pEntryIndex);
+
+/**
+* Reads all nodes of the read batch with a single read request. The batch stays in place and can be executed again. Fails if not connected or any node could not be read.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_OPCUA_DECLSPEC LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_executereadbatch(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA);
+
+/**
+* Returns an integer value of the last executed read batch.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+* @param[out] pValue - Retrieved Node Value
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_OPCUA_DECLSPEC LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_getbatchinteger(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nEntryIndex, LibMCDriver_OPCUA_int64 * pValue);
+
+/**
+* Returns a double value of the last executed read batch.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+* @param[out] pValue - Retrieved Node Value
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_OPCUA_DECLSPEC LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_getbatchdouble(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nEntryIndex, LibMCDriver_OPCUA_double * pValue);
+
+/**
+* Returns a string value of the last executed read batch.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+* @param[in] nValueBufferSize - size of the buffer (including trailing 0)
+* @param[out] pValueNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pValueBuffer -  buffer of Retrieved String Value, may be NULL
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_OPCUA_DECLSPEC LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_getbatchstring(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nEntryIndex, const LibMCDriver_OPCUA_uint32 nValueBufferSize, LibMCDriver_OPCUA_uint32* pValueNeededChars, char * pValueBuffer);
+
+/**
+* Queues an integer node value for the next FlushWriteQueue call.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to write
+* @param[in] eNodeType - Type of Node to write
+* @param[in] nValue - Node Value to write
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_OPCUA_DECLSPEC LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_queueintegerwrite(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, LibMCDriver_OPCUA::eUAIntegerType eNodeType, LibMCDriver_OPCUA_int64 nValue);
+
+/**
+* Queues a double node value for the next FlushWriteQueue call.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to write
+* @param[in] eNodeType - Type of Node to write
+* @param[in] dValue - Node Value to write
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_OPCUA_DECLSPEC LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_queuedoublewrite(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, LibMCDriver_OPCUA::eUADoubleType eNodeType, LibMCDriver_OPCUA_double dValue);
+
+/**
+* Queues a string node value for the next FlushWriteQueue call.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to write
+* @param[in] pValue - Node Value to write
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_OPCUA_DECLSPEC LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_queuestringwrite(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, const char * pValue);
+
+/**
+* Writes all queued values with a single write request and empties the queue. Fails if not connected or any value could not be written.
+*
+* @param[in] pDriver_OPCUA - Driver_OPCUA instance.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_OPCUA_DECLSPEC LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_flushwritequeue(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA);
+
 /*************************************************************************************************************************
  Global functions
 **************************************************************************************************************************/
@@ -410,6 +410,94 @@ public:
 	*/
 	virtual void WriteString(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName, const std::string & sValue) = 0;
 
+	/**
+	* IDriver_OPCUA::ClearReadBatch - Removes all entries from the read batch.
+	*/
+	virtual void ClearReadBatch() = 0;
+
+	/**
+	* IDriver_OPCUA::AddIntegerToReadBatch - Adds an integer node to the read batch.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to read
+	* @param[in] eNodeType - Type of Node to read
+	* @return Index of the new batch entry.
+	*/
+	virtual LibMCDriver_OPCUA_uint32 AddIntegerToReadBatch(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName, const LibMCDriver_OPCUA::eUAIntegerType eNodeType) = 0;
+
+	/**
+	* IDriver_OPCUA::AddDoubleToReadBatch - Adds a double node to the read batch.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to read
+	* @param[in] eNodeType - Type of Node to read
+	* @return Index of the new batch entry.
+	*/
+	virtual LibMCDriver_OPCUA_uint32 AddDoubleToReadBatch(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName, const LibMCDriver_OPCUA::eUADoubleType eNodeType) = 0;
+
+	/**
+	* IDriver_OPCUA::AddStringToReadBatch - Adds a string node to the read batch.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to read
+	* @return Index of the new batch entry.
+	*/
+	virtual LibMCDriver_OPCUA_uint32 AddStringToReadBatch(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName) = 0;
+
+	/**
+	* IDriver_OPCUA::ExecuteReadBatch - Reads all nodes of the read batch with a single read request. The batch stays in place and can be executed again. Fails if not connected or any node could not be read.
+	*/
+	virtual void ExecuteReadBatch() = 0;
+
+	/**
+	* IDriver_OPCUA::GetBatchInteger - Returns an integer value of the last executed read batch.
+	* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+	* @return Retrieved Node Value
+	*/
+	virtual LibMCDriver_OPCUA_int64 GetBatchInteger(const LibMCDriver_OPCUA_uint32 nEntryIndex) = 0;
+
+	/**
+	* IDriver_OPCUA::GetBatchDouble - Returns a double value of the last executed read batch.
+	* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+	* @return Retrieved Node Value
+	*/
+	virtual LibMCDriver_OPCUA_double GetBatchDouble(const LibMCDriver_OPCUA_uint32 nEntryIndex) = 0;
+
+	/**
+	* IDriver_OPCUA::GetBatchString - Returns a string value of the last executed read batch.
+	* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+	* @return Retrieved String Value
+	*/
+	virtual std::string GetBatchString(const LibMCDriver_OPCUA_uint32 nEntryIndex) = 0;
+
+	/**
+	* IDriver_OPCUA::QueueIntegerWrite - Queues an integer node value for the next FlushWriteQueue call.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to write
+	* @param[in] eNodeType - Type of Node to write
+	* @param[in] nValue - Node Value to write
+	*/
+	virtual void QueueIntegerWrite(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName, const LibMCDriver_OPCUA::eUAIntegerType eNodeType, const LibMCDriver_OPCUA_int64 nValue) = 0;
+
+	/**
+	* IDriver_OPCUA::QueueDoubleWrite - Queues a double node value for the next FlushWriteQueue call.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to write
+	* @param[in] eNodeType - Type of Node to write
+	* @param[in] dValue - Node Value to write
+	*/
+	virtual void QueueDoubleWrite(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName, const LibMCDriver_OPCUA::eUADoubleType eNodeType, const LibMCDriver_OPCUA_double dValue) = 0;
+
+	/**
+	* IDriver_OPCUA::QueueStringWrite - Queues a string node value for the next FlushWriteQueue call.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to write
+	* @param[in] sValue - Node Value to write
+	*/
+	virtual void QueueStringWrite(const LibMCDriver_OPCUA_uint32 nNameSpace, const std::string & sNodeName, const std::string & sValue) = 0;
+
+	/**
+	* IDriver_OPCUA::FlushWriteQueue - Writes all queued values with a single write request and empties the queue. Fails if not connected or any value could not be written.
+	*/
+	virtual void FlushWriteQueue() = 0;
+
 };
 
 typedef IBaseSharedPtr<IDriver_OPCUA> PIDriver_OPCUA;
@@ -700,6 +700,349 @@ LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_writestring(LibMCDriver_O
 	}
 }
 
+LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_clearreadbatch(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_OPCUA;
+
+	try {
+		IDriver_OPCUA* pIDriver_OPCUA = dynamic_cast<IDriver_OPCUA*>(pIBaseClass);
+		if (!pIDriver_OPCUA)
+			throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDCAST);
+		
+		pIDriver_OPCUA->ClearReadBatch();
+
+		return LIBMCDRIVER_OPCUA_SUCCESS;
+	}
+	catch (ELibMCDriver_OPCUAInterfaceException & Exception) {
+		return handleLibMCDriver_OPCUAException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_addintegertoreadbatch(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, eLibMCDriver_OPCUAUAIntegerType eNodeType, LibMCDriver_OPCUA_uint32 * pEntryIndex)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_OPCUA;
+
+	try {
+		if (pNodeName == nullptr)
+			throw ELibMCDriver_OPCUAInterfaceException (LIBMCDRIVER_OPCUA_ERROR_INVALIDPARAM);
+		if (pEntryIndex == nullptr)
+			throw ELibMCDriver_OPCUAInterfaceException (LIBMCDRIVER_OPCUA_ERROR_INVALIDPARAM);
+		std::string sNodeName(pNodeName);
+		IDriver_OPCUA* pIDriver_OPCUA = dynamic_cast<IDriver_OPCUA*>(pIBaseClass);
+		if (!pIDriver_OPCUA)
+			throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDCAST);
+		
+		*pEntryIndex = pIDriver_OPCUA->AddIntegerToReadBatch(nNameSpace, sNodeName, eNodeType);
+
+		return LIBMCDRIVER_OPCUA_SUCCESS;
+	}
+	catch (ELibMCDriver_OPCUAInterfaceException & Exception) {
+		return handleLibMCDriver_OPCUAException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_adddoubletoreadbatch(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, eLibMCDriver_OPCUAUADoubleType eNodeType, LibMCDriver_OPCUA_uint32 * pEntryIndex)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_OPCUA;
+
+	try {
+		if (pNodeName == nullptr)
+			throw ELibMCDriver_OPCUAInterfaceException (LIBMCDRIVER_OPCUA_ERROR_INVALIDPARAM);
+		if (pEntryIndex == nullptr)
+			throw ELibMCDriver_OPCUAInterfaceException (LIBMCDRIVER_OPCUA_ERROR_INVALIDPARAM);
+		std::string sNodeName(pNodeName);
+		IDriver_OPCUA* pIDriver_OPCUA = dynamic_cast<IDriver_OPCUA*>(pIBaseClass);
+		if (!pIDriver_OPCUA)
+			throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDCAST);
+		
+		*pEntryIndex = pIDriver_OPCUA->AddDoubleToReadBatch(nNameSpace, sNodeName, eNodeType);
+
+		return LIBMCDRIVER_OPCUA_SUCCESS;
+	}
+	catch (ELibMCDriver_OPCUAInterfaceException & Exception) {
+		return handleLibMCDriver_OPCUAException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_addstringtoreadbatch(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, LibMCDriver_OPCUA_uint32 * pEntryIndex)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_OPCUA;
+
+	try {
+		if (pNodeName == nullptr)
+			throw ELibMCDriver_OPCUAInterfaceException (LIBMCDRIVER_OPCUA_ERROR_INVALIDPARAM);
+		if (pEntryIndex == nullptr)
+			throw ELibMCDriver_OPCUAInterfaceException (LIBMCDRIVER_OPCUA_ERROR_INVALIDPARAM);
+		std::string sNodeName(pNodeName);
+		IDriver_OPCUA* pIDriver_OPCUA = dynamic_cast<IDriver_OPCUA*>(pIBaseClass);
+		if (!pIDriver_OPCUA)
+			throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDCAST);
+		
+		*pEntryIndex = pIDriver_OPCUA->AddStringToReadBatch(nNameSpace, sNodeName);
+
+		return LIBMCDRIVER_OPCUA_SUCCESS;
+	}
+	catch (ELibMCDriver_OPCUAInterfaceException & Exception) {
+		return handleLibMCDriver_OPCUAException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_executereadbatch(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_OPCUA;
+
+	try {
+		IDriver_OPCUA* pIDriver_OPCUA = dynamic_cast<IDriver_OPCUA*>(pIBaseClass);
+		if (!pIDriver_OPCUA)
+			throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDCAST);
+		
+		pIDriver_OPCUA->ExecuteReadBatch();
+
+		return LIBMCDRIVER_OPCUA_SUCCESS;
+	}
+	catch (ELibMCDriver_OPCUAInterfaceException & Exception) {
+		return handleLibMCDriver_OPCUAException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_getbatchinteger(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nEntryIndex, LibMCDriver_OPCUA_int64 * pValue)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_OPCUA;
+
+	try {
+		if (pValue == nullptr)
+			throw ELibMCDriver_OPCUAInterfaceException (LIBMCDRIVER_OPCUA_ERROR_INVALIDPARAM);
+		IDriver_OPCUA* pIDriver_OPCUA = dynamic_cast<IDriver_OPCUA*>(pIBaseClass);
+		if (!pIDriver_OPCUA)
+			throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDCAST);
+		
+		*pValue = pIDriver_OPCUA->GetBatchInteger(nEntryIndex);
+
+		return LIBMCDRIVER_OPCUA_SUCCESS;
+	}
+	catch (ELibMCDriver_OPCUAInterfaceException & Exception) {
+		return handleLibMCDriver_OPCUAException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_getbatchdouble(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nEntryIndex, LibMCDriver_OPCUA_double * pValue)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_OPCUA;
+
+	try {
+		if (pValue == nullptr)
+			throw ELibMCDriver_OPCUAInterfaceException (LIBMCDRIVER_OPCUA_ERROR_INVALIDPARAM);
+		IDriver_OPCUA* pIDriver_OPCUA = dynamic_cast<IDriver_OPCUA*>(pIBaseClass);
+		if (!pIDriver_OPCUA)
+			throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDCAST);
+		
+		*pValue = pIDriver_OPCUA->GetBatchDouble(nEntryIndex);
+
+		return LIBMCDRIVER_OPCUA_SUCCESS;
+	}
+	catch (ELibMCDriver_OPCUAInterfaceException & Exception) {
+		return handleLibMCDriver_OPCUAException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_getbatchstring(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nEntryIndex, const LibMCDriver_OPCUA_uint32 nValueBufferSize, LibMCDriver_OPCUA_uint32* pValueNeededChars, char * pValueBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_OPCUA;
+
+	try {
+		if ( (!pValueBuffer) && !(pValueNeededChars) )
+			throw ELibMCDriver_OPCUAInterfaceException (LIBMCDRIVER_OPCUA_ERROR_INVALIDPARAM);
+		std::string sValue("");
+		IDriver_OPCUA* pIDriver_OPCUA = dynamic_cast<IDriver_OPCUA*>(pIBaseClass);
+		if (!pIDriver_OPCUA)
+			throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pValueBuffer == nullptr);
+		if (isCacheCall) {
+			sValue = pIDriver_OPCUA->GetBatchString(nEntryIndex);
+
+			pIDriver_OPCUA->_setCache (new ParameterCache_1<std::string> (sValue));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIDriver_OPCUA->_getCache ());
+			if (cache == nullptr)
+				throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDCAST);
+			cache->retrieveData (sValue);
+			pIDriver_OPCUA->_setCache (nullptr);
+		}
+		
+		if (pValueNeededChars)
+			*pValueNeededChars = (LibMCDriver_OPCUA_uint32) (sValue.size()+1);
+		if (pValueBuffer) {
+			if (sValue.size() >= nValueBufferSize)
+				throw ELibMCDriver_OPCUAInterfaceException (LIBMCDRIVER_OPCUA_ERROR_BUFFERTOOSMALL);
+			for (size_t iValue = 0; iValue < sValue.size(); iValue++)
+				pValueBuffer[iValue] = sValue[iValue];
+			pValueBuffer[sValue.size()] = 0;
+		}
+		return LIBMCDRIVER_OPCUA_SUCCESS;
+	}
+	catch (ELibMCDriver_OPCUAInterfaceException & Exception) {
+		return handleLibMCDriver_OPCUAException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_queueintegerwrite(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, eLibMCDriver_OPCUAUAIntegerType eNodeType, LibMCDriver_OPCUA_int64 nValue)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_OPCUA;
+
+	try {
+		if (pNodeName == nullptr)
+			throw ELibMCDriver_OPCUAInterfaceException (LIBMCDRIVER_OPCUA_ERROR_INVALIDPARAM);
+		std::string sNodeName(pNodeName);
+		IDriver_OPCUA* pIDriver_OPCUA = dynamic_cast<IDriver_OPCUA*>(pIBaseClass);
+		if (!pIDriver_OPCUA)
+			throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDCAST);
+		
+		pIDriver_OPCUA->QueueIntegerWrite(nNameSpace, sNodeName, eNodeType, nValue);
+
+		return LIBMCDRIVER_OPCUA_SUCCESS;
+	}
+	catch (ELibMCDriver_OPCUAInterfaceException & Exception) {
+		return handleLibMCDriver_OPCUAException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_queuedoublewrite(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, eLibMCDriver_OPCUAUADoubleType eNodeType, LibMCDriver_OPCUA_double dValue)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_OPCUA;
+
+	try {
+		if (pNodeName == nullptr)
+			throw ELibMCDriver_OPCUAInterfaceException (LIBMCDRIVER_OPCUA_ERROR_INVALIDPARAM);
+		std::string sNodeName(pNodeName);
+		IDriver_OPCUA* pIDriver_OPCUA = dynamic_cast<IDriver_OPCUA*>(pIBaseClass);
+		if (!pIDriver_OPCUA)
+			throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDCAST);
+		
+		pIDriver_OPCUA->QueueDoubleWrite(nNameSpace, sNodeName, eNodeType, dValue);
+
+		return LIBMCDRIVER_OPCUA_SUCCESS;
+	}
+	catch (ELibMCDriver_OPCUAInterfaceException & Exception) {
+		return handleLibMCDriver_OPCUAException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_queuestringwrite(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA, LibMCDriver_OPCUA_uint32 nNameSpace, const char * pNodeName, const char * pValue)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_OPCUA;
+
+	try {
+		if (pNodeName == nullptr)
+			throw ELibMCDriver_OPCUAInterfaceException (LIBMCDRIVER_OPCUA_ERROR_INVALIDPARAM);
+		if (pValue == nullptr)
+			throw ELibMCDriver_OPCUAInterfaceException (LIBMCDRIVER_OPCUA_ERROR_INVALIDPARAM);
+		std::string sNodeName(pNodeName);
+		std::string sValue(pValue);
+		IDriver_OPCUA* pIDriver_OPCUA = dynamic_cast<IDriver_OPCUA*>(pIBaseClass);
+		if (!pIDriver_OPCUA)
+			throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDCAST);
+		
+		pIDriver_OPCUA->QueueStringWrite(nNameSpace, sNodeName, sValue);
+
+		return LIBMCDRIVER_OPCUA_SUCCESS;
+	}
+	catch (ELibMCDriver_OPCUAInterfaceException & Exception) {
+		return handleLibMCDriver_OPCUAException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_OPCUAResult libmcdriver_opcua_driver_opcua_flushwritequeue(LibMCDriver_OPCUA_Driver_OPCUA pDriver_OPCUA)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_OPCUA;
+
+	try {
+		IDriver_OPCUA* pIDriver_OPCUA = dynamic_cast<IDriver_OPCUA*>(pIBaseClass);
+		if (!pIDriver_OPCUA)
+			throw ELibMCDriver_OPCUAInterfaceException(LIBMCDRIVER_OPCUA_ERROR_INVALIDCAST);
+		
+		pIDriver_OPCUA->FlushWriteQueue();
+
+		return LIBMCDRIVER_OPCUA_SUCCESS;
+	}
+	catch (ELibMCDriver_OPCUAInterfaceException & Exception) {
+		return handleLibMCDriver_OPCUAException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 
 
 /*************************************************************************************************************************
@@ -753,6 +1096,30 @@ LibMCDriver_OPCUAResult LibMCDriver_OPCUA::Impl::LibMCDriver_OPCUA_GetProcAddres
 		*ppProcAddress = (void*) &libmcdriver_opcua_driver_opcua_writedouble;
 	if (sProcName == "libmcdriver_opcua_driver_opcua_writestring") 
 		*ppProcAddress = (void*) &libmcdriver_opcua_driver_opcua_writestring;
+	if (sProcName == "libmcdriver_opcua_driver_opcua_clearreadbatch") 
+		*ppProcAddress = (void*) &libmcdriver_opcua_driver_opcua_clearreadbatch;
+	if (sProcName == "libmcdriver_opcua_driver_opcua_addintegertoreadbatch") 
+		*ppProcAddress = (void*) &libmcdriver_opcua_driver_opcua_addintegertoreadbatch;
+	if (sProcName == "libmcdriver_opcua_driver_opcua_adddoubletoreadbatch") 
+		*ppProcAddress = (void*) &libmcdriver_opcua_driver_opcua_adddoubletoreadbatch;
+	if (sProcName == "libmcdriver_opcua_driver_opcua_addstringtoreadbatch") 
+		*ppProcAddress = (void*) &libmcdriver_opcua_driver_opcua_addstringtoreadbatch;
+	if (sProcName == "libmcdriver_opcua_driver_opcua_executereadbatch") 
+		*ppProcAddress = (void*) &libmcdriver_opcua_driver_opcua_executereadbatch;
+	if (sProcName == "libmcdriver_opcua_driver_opcua_getbatchinteger") 
+		*ppProcAddress = (void*) &libmcdriver_opcua_driver_opcua_getbatchinteger;
+	if (sProcName == "libmcdriver_opcua_driver_opcua_getbatchdouble") 
+		*ppProcAddress = (void*) &libmcdriver_opcua_driver_opcua_getbatchdouble;
+	if (sProcName == "libmcdriver_opcua_driver_opcua_getbatchstring") 
+		*ppProcAddress = (void*) &libmcdriver_opcua_driver_opcua_getbatchstring;
+	if (sProcName == "libmcdriver_opcua_driver_opcua_queueintegerwrite") 
+		*ppProcAddress = (void*) &libmcdriver_opcua_driver_opcua_queueintegerwrite;
+	if (sProcName == "libmcdriver_opcua_driver_opcua_queuedoublewrite") 
+		*ppProcAddress = (void*) &libmcdriver_opcua_driver_opcua_queuedoublewrite;
+	if (sProcName == "libmcdriver_opcua_driver_opcua_queuestringwrite") 
+		*ppProcAddress = (void*) &libmcdriver_opcua_driver_opcua_queuestringwrite;
+	if (sProcName == "libmcdriver_opcua_driver_opcua_flushwritequeue") 
+		*ppProcAddress = (void*) &libmcdriver_opcua_driver_opcua_flushwritequeue;
 	if (sProcName == "libmcdriver_opcua_getversion") 
 		*ppProcAddress = (void*) &libmcdriver_opcua_getversion;
 	if (sProcName == "libmcdriver_opcua_getlasterror") 
@@ -171,6 +171,246 @@ typedef LibOpen62541Result (*PLibOpen62541OPCClient_WriteDoublePtr) (LibOpen6254
 */
 typedef LibOpen62541Result (*PLibOpen62541OPCClient_WriteStringPtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nNameSpace, const char * pNodeName, const char * pValue);
 
+/**
+* Removes all entries from the read batch.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_ClearReadBatchPtr) (LibOpen62541_OPCClient pOPCClient);
+
+/**
+* Adds an integer node to the read batch.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to read
+* @param[in] eNodeType - Type of Node to read
+* @param[out] pEntryIndex - Index of the new batch entry.
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_AddIntegerToReadBatchPtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nNameSpace, const char * pNodeName, LibOpen62541::eUAIntegerType eNodeType, LibOpen62541_uint32 * pEntryIndex);
+
+/**
+* Adds a double node to the read batch.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to read
+* @param[in] eNodeType - Type of Node to read
+* @param[out] pEntryIndex - Index of the new batch entry.
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_AddDoubleToReadBatchPtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nNameSpace, const char * pNodeName, LibOpen62541::eUADoubleType eNodeType, LibOpen62541_uint32 * pEntryIndex);
+
+/**
+* Adds a string node to the read batch.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to read
+* @param[out] pEntryIndex - Index of the new batch entry.
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_AddStringToReadBatchPtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nNameSpace, const char * pNodeName, LibOpen62541_uint32 * pEntryIndex);
+
+/**
+* Reads all nodes of the read batch with a single read request. The batch stays in place and can be executed again. Fails if not connected or any node could not be read.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_ExecuteReadBatchPtr) (LibOpen62541_OPCClient pOPCClient);
+
+/**
+* Returns an integer value of the last executed read batch.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+* @param[out] pValue - Retrieved Node Value
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_GetBatchIntegerPtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nEntryIndex, LibOpen62541_int64 * pValue);
+
+/**
+* Returns a double value of the last executed read batch.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+* @param[out] pValue - Retrieved Node Value
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_GetBatchDoublePtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nEntryIndex, LibOpen62541_double * pValue);
+
+/**
+* Returns a string value of the last executed read batch.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+* @param[in] nValueBufferSize - size of the buffer (including trailing 0)
+* @param[out] pValueNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pValueBuffer -  buffer of Retrieved String Value, may be NULL
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_GetBatchStringPtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nEntryIndex, const LibOpen62541_uint32 nValueBufferSize, LibOpen62541_uint32* pValueNeededChars, char * pValueBuffer);
+
+/**
+* Queues an integer node value for the next FlushWriteQueue call.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to write
+* @param[in] eNodeType - Type of Node to write
+* @param[in] nValue - Node Value to write
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_QueueIntegerWritePtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nNameSpace, const char * pNodeName, LibOpen62541::eUAIntegerType eNodeType, LibOpen62541_int64 nValue);
+
+/**
+* Queues a double node value for the next FlushWriteQueue call.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to write
+* @param[in] eNodeType - Type of Node to write
+* @param[in] dValue - Node Value to write
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_QueueDoubleWritePtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nNameSpace, const char * pNodeName, LibOpen62541::eUADoubleType eNodeType, LibOpen62541_double dValue);
+
+/**
+* Queues a string node value for the next FlushWriteQueue call.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to write
+* @param[in] pValue - Node Value to write
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_QueueStringWritePtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nNameSpace, const char * pNodeName, const char * pValue);
+
+/**
+* Writes all queued values with a single write request and empties the queue. Fails if not connected or any value could not be written.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_FlushWriteQueuePtr) (LibOpen62541_OPCClient pOPCClient);
+
+/**
+* Creates a subscription on the server. Fails if not connected.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @param[in] dPublishingIntervalInMS - Publishing interval in milliseconds.
+* @param[out] pSubscriptionID - ID of the new subscription.
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_CreateSubscriptionPtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_double dPublishingIntervalInMS, LibOpen62541_uint32 * pSubscriptionID);
+
+/**
+* Deletes a subscription and all its monitored items.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @param[in] nSubscriptionID - Subscription ID
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_DeleteSubscriptionPtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nSubscriptionID);
+
+/**
+* Monitors an integer node value within a subscription.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @param[in] nSubscriptionID - Subscription ID
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to monitor
+* @param[in] eNodeType - Type of Node to monitor
+* @param[in] dSamplingIntervalInMS - Sampling interval of the server in milliseconds.
+* @param[in] dDeadband - Absolute deadband. Changes smaller than this value are not reported. 0 reports every change.
+* @param[out] pMonitoredItemID - ID of the new monitored item.
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_AddIntegerMonitoredItemPtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nSubscriptionID, LibOpen62541_uint32 nNameSpace, const char * pNodeName, LibOpen62541::eUAIntegerType eNodeType, LibOpen62541_double dSamplingIntervalInMS, LibOpen62541_double dDeadband, LibOpen62541_uint32 * pMonitoredItemID);
+
+/**
+* Monitors a double node value within a subscription.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @param[in] nSubscriptionID - Subscription ID
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to monitor
+* @param[in] eNodeType - Type of Node to monitor
+* @param[in] dSamplingIntervalInMS - Sampling interval of the server in milliseconds.
+* @param[in] dDeadband - Absolute deadband. Changes smaller than this value are not reported. 0 reports every change.
+* @param[out] pMonitoredItemID - ID of the new monitored item.
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_AddDoubleMonitoredItemPtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nSubscriptionID, LibOpen62541_uint32 nNameSpace, const char * pNodeName, LibOpen62541::eUADoubleType eNodeType, LibOpen62541_double dSamplingIntervalInMS, LibOpen62541_double dDeadband, LibOpen62541_uint32 * pMonitoredItemID);
+
+/**
+* Monitors a string node value within a subscription.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @param[in] nSubscriptionID - Subscription ID
+* @param[in] nNameSpace - Namespace ID
+* @param[in] pNodeName - Node to monitor
+* @param[in] dSamplingIntervalInMS - Sampling interval of the server in milliseconds.
+* @param[out] pMonitoredItemID - ID of the new monitored item.
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_AddStringMonitoredItemPtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nSubscriptionID, LibOpen62541_uint32 nNameSpace, const char * pNodeName, LibOpen62541_double dSamplingIntervalInMS, LibOpen62541_uint32 * pMonitoredItemID);
+
+/**
+* Processes incoming notifications of all subscriptions and keeps the publish requests going. Fails if not connected.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @param[in] nTimeOutInMS - Maximum time to wait for notifications in milliseconds. 0 processes only what has already arrived.
+* @param[out] pChangeCount - Number of changed monitored items that have not been popped yet.
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_ProcessSubscriptionsPtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nTimeOutInMS, LibOpen62541_uint32 * pChangeCount);
+
+/**
+* Returns the next monitored item that has changed since it was last popped.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @param[out] pMonitoredItemID - ID of the changed monitored item.
+* @param[out] pHasChanged - Returns false if no monitored item has changed.
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_PopChangedMonitoredItemPtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 * pMonitoredItemID, bool * pHasChanged);
+
+/**
+* Returns the last reported value of an integer monitored item.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @param[in] nMonitoredItemID - Monitored item ID
+* @param[out] pValue - Last reported Node Value
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_GetMonitoredItemIntegerPtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nMonitoredItemID, LibOpen62541_int64 * pValue);
+
+/**
+* Returns the last reported value of a double monitored item.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @param[in] nMonitoredItemID - Monitored item ID
+* @param[out] pValue - Last reported Node Value
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_GetMonitoredItemDoublePtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nMonitoredItemID, LibOpen62541_double * pValue);
+
+/**
+* Returns the last reported value of a string monitored item.
+*
+* @param[in] pOPCClient - OPCClient instance.
+* @param[in] nMonitoredItemID - Monitored item ID
+* @param[in] nValueBufferSize - size of the buffer (including trailing 0)
+* @param[out] pValueNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pValueBuffer -  buffer of Last reported String Value, may be NULL
+* @return error code or 0 (success)
+*/
+typedef LibOpen62541Result (*PLibOpen62541OPCClient_GetMonitoredItemStringPtr) (LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nMonitoredItemID, const LibOpen62541_uint32 nValueBufferSize, LibOpen62541_uint32* pValueNeededChars, char * pValueBuffer);
+
 /*************************************************************************************************************************
  Global functions
 **************************************************************************************************************************/
@@ -246,6 +486,28 @@ typedef struct {
 	PLibOpen62541OPCClient_WriteIntegerPtr m_OPCClient_WriteInteger;
 	PLibOpen62541OPCClient_WriteDoublePtr m_OPCClient_WriteDouble;
 	PLibOpen62541OPCClient_WriteStringPtr m_OPCClient_WriteString;
+	PLibOpen62541OPCClient_ClearReadBatchPtr m_OPCClient_ClearReadBatch;
+	PLibOpen62541OPCClient_AddIntegerToReadBatchPtr m_OPCClient_AddIntegerToReadBatch;
+	PLibOpen62541OPCClient_AddDoubleToReadBatchPtr m_OPCClient_AddDoubleToReadBatch;
+	PLibOpen62541OPCClient_AddStringToReadBatchPtr m_OPCClient_AddStringToReadBatch;
+	PLibOpen62541OPCClient_ExecuteReadBatchPtr m_OPCClient_ExecuteReadBatch;
+	PLibOpen62541OPCClient_GetBatchIntegerPtr m_OPCClient_GetBatchInteger;
+	PLibOpen62541OPCClient_GetBatchDoublePtr m_OPCClient_GetBatchDouble;
+	PLibOpen62541OPCClient_GetBatchStringPtr m_OPCClient_GetBatchString;
+	PLibOpen62541OPCClient_QueueIntegerWritePtr m_OPCClient_QueueIntegerWrite;
+	PLibOpen62541OPCClient_QueueDoubleWritePtr m_OPCClient_QueueDoubleWrite;
+	PLibOpen62541OPCClient_QueueStringWritePtr m_OPCClient_QueueStringWrite;
+	PLibOpen62541OPCClient_FlushWriteQueuePtr m_OPCClient_FlushWriteQueue;
+	PLibOpen62541OPCClient_CreateSubscriptionPtr m_OPCClient_CreateSubscription;
+	PLibOpen62541OPCClient_DeleteSubscriptionPtr m_OPCClient_DeleteSubscription;
+	PLibOpen62541OPCClient_AddIntegerMonitoredItemPtr m_OPCClient_AddIntegerMonitoredItem;
+	PLibOpen62541OPCClient_AddDoubleMonitoredItemPtr m_OPCClient_AddDoubleMonitoredItem;
+	PLibOpen62541OPCClient_AddStringMonitoredItemPtr m_OPCClient_AddStringMonitoredItem;
+	PLibOpen62541OPCClient_ProcessSubscriptionsPtr m_OPCClient_ProcessSubscriptions;
+	PLibOpen62541OPCClient_PopChangedMonitoredItemPtr m_OPCClient_PopChangedMonitoredItem;
+	PLibOpen62541OPCClient_GetMonitoredItemIntegerPtr m_OPCClient_GetMonitoredItemInteger;
+	PLibOpen62541OPCClient_GetMonitoredItemDoublePtr m_OPCClient_GetMonitoredItemDouble;
+	PLibOpen62541OPCClient_GetMonitoredItemStringPtr m_OPCClient_GetMonitoredItemString;
 	PLibOpen62541GetVersionPtr m_GetVersion;
 	PLibOpen62541GetLastErrorPtr m_GetLastError;
 	PLibOpen62541AcquireInstancePtr m_AcquireInstance;
@@ -182,6 +182,14 @@ public:
 			case LIBOPEN62541_ERROR_OPCUAVARIANTDATAISNULL: return "OPCUAVARIANTDATAISNULL";
 			case LIBOPEN62541_ERROR_OPCUASTRINGDATAISNULL: return "OPCUASTRINGDATAISNULL";
 			case LIBOPEN62541_ERROR_OPCUAWRITEINTEGEROUTOFBOUNDS: return "OPCUAWRITEINTEGEROUTOFBOUNDS";
+			case LIBOPEN62541_ERROR_INVALIDBATCHINDEX: return "INVALIDBATCHINDEX";
+			case LIBOPEN62541_ERROR_READBATCHNOTEXECUTED: return "READBATCHNOTEXECUTED";
+			case LIBOPEN62541_ERROR_COULDNOTCREATESUBSCRIPTION: return "COULDNOTCREATESUBSCRIPTION";
+			case LIBOPEN62541_ERROR_SUBSCRIPTIONNOTFOUND: return "SUBSCRIPTIONNOTFOUND";
+			case LIBOPEN62541_ERROR_COULDNOTCREATEMONITOREDITEM: return "COULDNOTCREATEMONITOREDITEM";
+			case LIBOPEN62541_ERROR_MONITOREDITEMNOTFOUND: return "MONITOREDITEMNOTFOUND";
+			case LIBOPEN62541_ERROR_MONITOREDITEMHASNOVALUE: return "MONITOREDITEMHASNOVALUE";
+			case LIBOPEN62541_ERROR_COULDNOTPROCESSSUBSCRIPTIONS: return "COULDNOTPROCESSSUBSCRIPTIONS";
 		}
 		return "UNKNOWN";
 	}
@@ -211,6 +219,14 @@ public:
 			case LIBOPEN62541_ERROR_OPCUAVARIANTDATAISNULL: return "OPCUA Variant data is null.";
 			case LIBOPEN62541_ERROR_OPCUASTRINGDATAISNULL: return "OPCUA String data is null.";
 			case LIBOPEN62541_ERROR_OPCUAWRITEINTEGEROUTOFBOUNDS: return "OPCUA Write integer out of bounds.";
+			case LIBOPEN62541_ERROR_INVALIDBATCHINDEX: return "Invalid batch entry index.";
+			case LIBOPEN62541_ERROR_READBATCHNOTEXECUTED: return "Read batch has not been executed.";
+			case LIBOPEN62541_ERROR_COULDNOTCREATESUBSCRIPTION: return "Could not create subscription.";
+			case LIBOPEN62541_ERROR_SUBSCRIPTIONNOTFOUND: return "Subscription not found.";
+			case LIBOPEN62541_ERROR_COULDNOTCREATEMONITOREDITEM: return "Could not create monitored item.";
+			case LIBOPEN62541_ERROR_MONITOREDITEMNOTFOUND: return "Monitored item not found.";
+			case LIBOPEN62541_ERROR_MONITOREDITEMHASNOVALUE: return "Monitored item has not received a value.";
+			case LIBOPEN62541_ERROR_COULDNOTPROCESSSUBSCRIPTIONS: return "Could not process subscriptions.";
 		}
 		return "unknown error";
 	}
@@ -415,6 +431,28 @@ public:
 	inline void WriteInteger(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const eUAIntegerType eNodeType, const LibOpen62541_int64 nValue);
 	inline void WriteDouble(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const eUADoubleType eNodeType, const LibOpen62541_double dValue);
 	inline void WriteString(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const std::string & sValue);
+	inline void ClearReadBatch();
+	inline LibOpen62541_uint32 AddIntegerToReadBatch(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const eUAIntegerType eNodeType);
+	inline LibOpen62541_uint32 AddDoubleToReadBatch(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const eUADoubleType eNodeType);
+	inline LibOpen62541_uint32 AddStringToReadBatch(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName);
+	inline void ExecuteReadBatch();
+	inline LibOpen62541_int64 GetBatchInteger(const LibOpen62541_uint32 nEntryIndex);
+	inline LibOpen62541_double GetBatchDouble(const LibOpen62541_uint32 nEntryIndex);
+	inline std::string GetBatchString(const LibOpen62541_uint32 nEntryIndex);
+	inline void QueueIntegerWrite(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const eUAIntegerType eNodeType, const LibOpen62541_int64 nValue);
+	inline void QueueDoubleWrite(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const eUADoubleType eNodeType, const LibOpen62541_double dValue);
+	inline void QueueStringWrite(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const std::string & sValue);
+	inline void FlushWriteQueue();
+	inline LibOpen62541_uint32 CreateSubscription(const LibOpen62541_double dPublishingIntervalInMS);
+	inline void DeleteSubscription(const LibOpen62541_uint32 nSubscriptionID);
+	inline LibOpen62541_uint32 AddIntegerMonitoredItem(const LibOpen62541_uint32 nSubscriptionID, const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const eUAIntegerType eNodeType, const LibOpen62541_double dSamplingIntervalInMS, const LibOpen62541_double dDeadband);
+	inline LibOpen62541_uint32 AddDoubleMonitoredItem(const LibOpen62541_uint32 nSubscriptionID, const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const eUADoubleType eNodeType, const LibOpen62541_double dSamplingIntervalInMS, const LibOpen62541_double dDeadband);
+	inline LibOpen62541_uint32 AddStringMonitoredItem(const LibOpen62541_uint32 nSubscriptionID, const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541_double dSamplingIntervalInMS);
+	inline LibOpen62541_uint32 ProcessSubscriptions(const LibOpen62541_uint32 nTimeOutInMS);
+	inline bool PopChangedMonitoredItem(LibOpen62541_uint32 & nMonitoredItemID);
+	inline LibOpen62541_int64 GetMonitoredItemInteger(const LibOpen62541_uint32 nMonitoredItemID);
+	inline LibOpen62541_double GetMonitoredItemDouble(const LibOpen62541_uint32 nMonitoredItemID);
+	inline std::string GetMonitoredItemString(const LibOpen62541_uint32 nMonitoredItemID);
 };
 	
 	/**
@@ -524,6 +562,28 @@ public:
 		pWrapperTable->m_OPCClient_WriteInteger = nullptr;
 		pWrapperTable->m_OPCClient_WriteDouble = nullptr;
 		pWrapperTable->m_OPCClient_WriteString = nullptr;
+		pWrapperTable->m_OPCClient_ClearReadBatch = nullptr;
+		pWrapperTable->m_OPCClient_AddIntegerToReadBatch = nullptr;
+		pWrapperTable->m_OPCClient_AddDoubleToReadBatch = nullptr;
+		pWrapperTable->m_OPCClient_AddStringToReadBatch = nullptr;
+		pWrapperTable->m_OPCClient_ExecuteReadBatch = nullptr;
+		pWrapperTable->m_OPCClient_GetBatchInteger = nullptr;
+		pWrapperTable->m_OPCClient_GetBatchDouble = nullptr;
+		pWrapperTable->m_OPCClient_GetBatchString = nullptr;
+		pWrapperTable->m_OPCClient_QueueIntegerWrite = nullptr;
+		pWrapperTable->m_OPCClient_QueueDoubleWrite = nullptr;
+		pWrapperTable->m_OPCClient_QueueStringWrite = nullptr;
+		pWrapperTable->m_OPCClient_FlushWriteQueue = nullptr;
+		pWrapperTable->m_OPCClient_CreateSubscription = nullptr;
+		pWrapperTable->m_OPCClient_DeleteSubscription = nullptr;
+		pWrapperTable->m_OPCClient_AddIntegerMonitoredItem = nullptr;
+		pWrapperTable->m_OPCClient_AddDoubleMonitoredItem = nullptr;
+		pWrapperTable->m_OPCClient_AddStringMonitoredItem = nullptr;
+		pWrapperTable->m_OPCClient_ProcessSubscriptions = nullptr;
+		pWrapperTable->m_OPCClient_PopChangedMonitoredItem = nullptr;
+		pWrapperTable->m_OPCClient_GetMonitoredItemInteger = nullptr;
+		pWrapperTable->m_OPCClient_GetMonitoredItemDouble = nullptr;
+		pWrapperTable->m_OPCClient_GetMonitoredItemString = nullptr;
 		pWrapperTable->m_GetVersion = nullptr;
 		pWrapperTable->m_GetLastError = nullptr;
 		pWrapperTable->m_AcquireInstance = nullptr;
@@ -679,6 +739,204 @@ public:
 		if (pWrapperTable->m_OPCClient_WriteString == nullptr)
 			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_ClearReadBatch = (PLibOpen62541OPCClient_ClearReadBatchPtr) GetProcAddress(hLibrary, "libopen62541_opcclient_clearreadbatch");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_ClearReadBatch = (PLibOpen62541OPCClient_ClearReadBatchPtr) dlsym(hLibrary, "libopen62541_opcclient_clearreadbatch");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_ClearReadBatch == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_AddIntegerToReadBatch = (PLibOpen62541OPCClient_AddIntegerToReadBatchPtr) GetProcAddress(hLibrary, "libopen62541_opcclient_addintegertoreadbatch");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_AddIntegerToReadBatch = (PLibOpen62541OPCClient_AddIntegerToReadBatchPtr) dlsym(hLibrary, "libopen62541_opcclient_addintegertoreadbatch");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_AddIntegerToReadBatch == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_AddDoubleToReadBatch = (PLibOpen62541OPCClient_AddDoubleToReadBatchPtr) GetProcAddress(hLibrary, "libopen62541_opcclient_adddoubletoreadbatch");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_AddDoubleToReadBatch = (PLibOpen62541OPCClient_AddDoubleToReadBatchPtr) dlsym(hLibrary, "libopen62541_opcclient_adddoubletoreadbatch");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_AddDoubleToReadBatch == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_AddStringToReadBatch = (PLibOpen62541OPCClient_AddStringToReadBatchPtr) GetProcAddress(hLibrary, "libopen62541_opcclient_addstringtoreadbatch");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_AddStringToReadBatch = (PLibOpen62541OPCClient_AddStringToReadBatchPtr) dlsym(hLibrary, "libopen62541_opcclient_addstringtoreadbatch");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_AddStringToReadBatch == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_ExecuteReadBatch = (PLibOpen62541OPCClient_ExecuteReadBatchPtr) GetProcAddress(hLibrary, "libopen62541_opcclient_executereadbatch");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_ExecuteReadBatch = (PLibOpen62541OPCClient_ExecuteReadBatchPtr) dlsym(hLibrary, "libopen62541_opcclient_executereadbatch");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_ExecuteReadBatch == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_GetBatchInteger = (PLibOpen62541OPCClient_GetBatchIntegerPtr) GetProcAddress(hLibrary, "libopen62541_opcclient_getbatchinteger");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_GetBatchInteger = (PLibOpen62541OPCClient_GetBatchIntegerPtr) dlsym(hLibrary, "libopen62541_opcclient_getbatchinteger");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_GetBatchInteger == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_GetBatchDouble = (PLibOpen62541OPCClient_GetBatchDoublePtr) GetProcAddress(hLibrary, "libopen62541_opcclient_getbatchdouble");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_GetBatchDouble = (PLibOpen62541OPCClient_GetBatchDoublePtr) dlsym(hLibrary, "libopen62541_opcclient_getbatchdouble");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_GetBatchDouble == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_GetBatchString = (PLibOpen62541OPCClient_GetBatchStringPtr) GetProcAddress(hLibrary, "libopen62541_opcclient_getbatchstring");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_GetBatchString = (PLibOpen62541OPCClient_GetBatchStringPtr) dlsym(hLibrary, "libopen62541_opcclient_getbatchstring");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_GetBatchString == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_QueueIntegerWrite = (PLibOpen62541OPCClient_QueueIntegerWritePtr) GetProcAddress(hLibrary, "libopen62541_opcclient_queueintegerwrite");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_QueueIntegerWrite = (PLibOpen62541OPCClient_QueueIntegerWritePtr) dlsym(hLibrary, "libopen62541_opcclient_queueintegerwrite");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_QueueIntegerWrite == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_QueueDoubleWrite = (PLibOpen62541OPCClient_QueueDoubleWritePtr) GetProcAddress(hLibrary, "libopen62541_opcclient_queuedoublewrite");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_QueueDoubleWrite = (PLibOpen62541OPCClient_QueueDoubleWritePtr) dlsym(hLibrary, "libopen62541_opcclient_queuedoublewrite");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_QueueDoubleWrite == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_QueueStringWrite = (PLibOpen62541OPCClient_QueueStringWritePtr) GetProcAddress(hLibrary, "libopen62541_opcclient_queuestringwrite");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_QueueStringWrite = (PLibOpen62541OPCClient_QueueStringWritePtr) dlsym(hLibrary, "libopen62541_opcclient_queuestringwrite");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_QueueStringWrite == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_FlushWriteQueue = (PLibOpen62541OPCClient_FlushWriteQueuePtr) GetProcAddress(hLibrary, "libopen62541_opcclient_flushwritequeue");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_FlushWriteQueue = (PLibOpen62541OPCClient_FlushWriteQueuePtr) dlsym(hLibrary, "libopen62541_opcclient_flushwritequeue");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_FlushWriteQueue == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_CreateSubscription = (PLibOpen62541OPCClient_CreateSubscriptionPtr) GetProcAddress(hLibrary, "libopen62541_opcclient_createsubscription");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_CreateSubscription = (PLibOpen62541OPCClient_CreateSubscriptionPtr) dlsym(hLibrary, "libopen62541_opcclient_createsubscription");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_CreateSubscription == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_DeleteSubscription = (PLibOpen62541OPCClient_DeleteSubscriptionPtr) GetProcAddress(hLibrary, "libopen62541_opcclient_deletesubscription");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_DeleteSubscription = (PLibOpen62541OPCClient_DeleteSubscriptionPtr) dlsym(hLibrary, "libopen62541_opcclient_deletesubscription");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_DeleteSubscription == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_AddIntegerMonitoredItem = (PLibOpen62541OPCClient_AddIntegerMonitoredItemPtr) GetProcAddress(hLibrary, "libopen62541_opcclient_addintegermonitoreditem");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_AddIntegerMonitoredItem = (PLibOpen62541OPCClient_AddIntegerMonitoredItemPtr) dlsym(hLibrary, "libopen62541_opcclient_addintegermonitoreditem");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_AddIntegerMonitoredItem == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_AddDoubleMonitoredItem = (PLibOpen62541OPCClient_AddDoubleMonitoredItemPtr) GetProcAddress(hLibrary, "libopen62541_opcclient_adddoublemonitoreditem");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_AddDoubleMonitoredItem = (PLibOpen62541OPCClient_AddDoubleMonitoredItemPtr) dlsym(hLibrary, "libopen62541_opcclient_adddoublemonitoreditem");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_AddDoubleMonitoredItem == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_AddStringMonitoredItem = (PLibOpen62541OPCClient_AddStringMonitoredItemPtr) GetProcAddress(hLibrary, "libopen62541_opcclient_addstringmonitoreditem");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_AddStringMonitoredItem = (PLibOpen62541OPCClient_AddStringMonitoredItemPtr) dlsym(hLibrary, "libopen62541_opcclient_addstringmonitoreditem");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_AddStringMonitoredItem == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_ProcessSubscriptions = (PLibOpen62541OPCClient_ProcessSubscriptionsPtr) GetProcAddress(hLibrary, "libopen62541_opcclient_processsubscriptions");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_ProcessSubscriptions = (PLibOpen62541OPCClient_ProcessSubscriptionsPtr) dlsym(hLibrary, "libopen62541_opcclient_processsubscriptions");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_ProcessSubscriptions == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_PopChangedMonitoredItem = (PLibOpen62541OPCClient_PopChangedMonitoredItemPtr) GetProcAddress(hLibrary, "libopen62541_opcclient_popchangedmonitoreditem");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_PopChangedMonitoredItem = (PLibOpen62541OPCClient_PopChangedMonitoredItemPtr) dlsym(hLibrary, "libopen62541_opcclient_popchangedmonitoreditem");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_PopChangedMonitoredItem == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_GetMonitoredItemInteger = (PLibOpen62541OPCClient_GetMonitoredItemIntegerPtr) GetProcAddress(hLibrary, "libopen62541_opcclient_getmonitorediteminteger");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_GetMonitoredItemInteger = (PLibOpen62541OPCClient_GetMonitoredItemIntegerPtr) dlsym(hLibrary, "libopen62541_opcclient_getmonitorediteminteger");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_GetMonitoredItemInteger == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_GetMonitoredItemDouble = (PLibOpen62541OPCClient_GetMonitoredItemDoublePtr) GetProcAddress(hLibrary, "libopen62541_opcclient_getmonitoreditemdouble");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_GetMonitoredItemDouble = (PLibOpen62541OPCClient_GetMonitoredItemDoublePtr) dlsym(hLibrary, "libopen62541_opcclient_getmonitoreditemdouble");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_GetMonitoredItemDouble == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OPCClient_GetMonitoredItemString = (PLibOpen62541OPCClient_GetMonitoredItemStringPtr) GetProcAddress(hLibrary, "libopen62541_opcclient_getmonitoreditemstring");
+		#else // _WIN32
+		pWrapperTable->m_OPCClient_GetMonitoredItemString = (PLibOpen62541OPCClient_GetMonitoredItemStringPtr) dlsym(hLibrary, "libopen62541_opcclient_getmonitoreditemstring");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OPCClient_GetMonitoredItemString == nullptr)
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_GetVersion = (PLibOpen62541GetVersionPtr) GetProcAddress(hLibrary, "libopen62541_getversion");
 		#else // _WIN32
@@ -793,6 +1051,94 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_WriteString == nullptr) )
 			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libopen62541_opcclient_clearreadbatch", (void**)&(pWrapperTable->m_OPCClient_ClearReadBatch));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_ClearReadBatch == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_addintegertoreadbatch", (void**)&(pWrapperTable->m_OPCClient_AddIntegerToReadBatch));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_AddIntegerToReadBatch == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_adddoubletoreadbatch", (void**)&(pWrapperTable->m_OPCClient_AddDoubleToReadBatch));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_AddDoubleToReadBatch == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_addstringtoreadbatch", (void**)&(pWrapperTable->m_OPCClient_AddStringToReadBatch));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_AddStringToReadBatch == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_executereadbatch", (void**)&(pWrapperTable->m_OPCClient_ExecuteReadBatch));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_ExecuteReadBatch == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_getbatchinteger", (void**)&(pWrapperTable->m_OPCClient_GetBatchInteger));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_GetBatchInteger == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_getbatchdouble", (void**)&(pWrapperTable->m_OPCClient_GetBatchDouble));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_GetBatchDouble == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_getbatchstring", (void**)&(pWrapperTable->m_OPCClient_GetBatchString));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_GetBatchString == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_queueintegerwrite", (void**)&(pWrapperTable->m_OPCClient_QueueIntegerWrite));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_QueueIntegerWrite == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_queuedoublewrite", (void**)&(pWrapperTable->m_OPCClient_QueueDoubleWrite));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_QueueDoubleWrite == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_queuestringwrite", (void**)&(pWrapperTable->m_OPCClient_QueueStringWrite));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_QueueStringWrite == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_flushwritequeue", (void**)&(pWrapperTable->m_OPCClient_FlushWriteQueue));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_FlushWriteQueue == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_createsubscription", (void**)&(pWrapperTable->m_OPCClient_CreateSubscription));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_CreateSubscription == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_deletesubscription", (void**)&(pWrapperTable->m_OPCClient_DeleteSubscription));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_DeleteSubscription == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_addintegermonitoreditem", (void**)&(pWrapperTable->m_OPCClient_AddIntegerMonitoredItem));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_AddIntegerMonitoredItem == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_adddoublemonitoreditem", (void**)&(pWrapperTable->m_OPCClient_AddDoubleMonitoredItem));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_AddDoubleMonitoredItem == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_addstringmonitoreditem", (void**)&(pWrapperTable->m_OPCClient_AddStringMonitoredItem));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_AddStringMonitoredItem == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_processsubscriptions", (void**)&(pWrapperTable->m_OPCClient_ProcessSubscriptions));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_ProcessSubscriptions == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_popchangedmonitoreditem", (void**)&(pWrapperTable->m_OPCClient_PopChangedMonitoredItem));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_PopChangedMonitoredItem == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_getmonitorediteminteger", (void**)&(pWrapperTable->m_OPCClient_GetMonitoredItemInteger));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_GetMonitoredItemInteger == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_getmonitoreditemdouble", (void**)&(pWrapperTable->m_OPCClient_GetMonitoredItemDouble));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_GetMonitoredItemDouble == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libopen62541_opcclient_getmonitoreditemstring", (void**)&(pWrapperTable->m_OPCClient_GetMonitoredItemString));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OPCClient_GetMonitoredItemString == nullptr) )
+			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libopen62541_getversion", (void**)&(pWrapperTable->m_GetVersion));
 		if ( (eLookupError != 0) || (pWrapperTable->m_GetVersion == nullptr) )
 			return LIBOPEN62541_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -962,6 +1308,293 @@ public:
 	{
 		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_WriteString(m_pHandle, nNameSpace, sNodeName.c_str(), sValue.c_str()));
 	}
+	
+	/**
+	* COPCClient::ClearReadBatch - Removes all entries from the read batch.
+	*/
+	void COPCClient::ClearReadBatch()
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_ClearReadBatch(m_pHandle));
+	}
+	
+	/**
+	* COPCClient::AddIntegerToReadBatch - Adds an integer node to the read batch.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to read
+	* @param[in] eNodeType - Type of Node to read
+	* @return Index of the new batch entry.
+	*/
+	LibOpen62541_uint32 COPCClient::AddIntegerToReadBatch(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const eUAIntegerType eNodeType)
+	{
+		LibOpen62541_uint32 resultEntryIndex = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_AddIntegerToReadBatch(m_pHandle, nNameSpace, sNodeName.c_str(), eNodeType, &resultEntryIndex));
+		
+		return resultEntryIndex;
+	}
+	
+	/**
+	* COPCClient::AddDoubleToReadBatch - Adds a double node to the read batch.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to read
+	* @param[in] eNodeType - Type of Node to read
+	* @return Index of the new batch entry.
+	*/
+	LibOpen62541_uint32 COPCClient::AddDoubleToReadBatch(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const eUADoubleType eNodeType)
+	{
+		LibOpen62541_uint32 resultEntryIndex = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_AddDoubleToReadBatch(m_pHandle, nNameSpace, sNodeName.c_str(), eNodeType, &resultEntryIndex));
+		
+		return resultEntryIndex;
+	}
+	
+	/**
+	* COPCClient::AddStringToReadBatch - Adds a string node to the read batch.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to read
+	* @return Index of the new batch entry.
+	*/
+	LibOpen62541_uint32 COPCClient::AddStringToReadBatch(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName)
+	{
+		LibOpen62541_uint32 resultEntryIndex = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_AddStringToReadBatch(m_pHandle, nNameSpace, sNodeName.c_str(), &resultEntryIndex));
+		
+		return resultEntryIndex;
+	}
+	
+	/**
+	* COPCClient::ExecuteReadBatch - Reads all nodes of the read batch with a single read request. The batch stays in place and can be executed again. Fails if not connected or any node could not be read.
+	*/
+	void COPCClient::ExecuteReadBatch()
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_ExecuteReadBatch(m_pHandle));
+	}
+	
+	/**
+	* COPCClient::GetBatchInteger - Returns an integer value of the last executed read batch.
+	* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+	* @return Retrieved Node Value
+	*/
+	LibOpen62541_int64 COPCClient::GetBatchInteger(const LibOpen62541_uint32 nEntryIndex)
+	{
+		LibOpen62541_int64 resultValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_GetBatchInteger(m_pHandle, nEntryIndex, &resultValue));
+		
+		return resultValue;
+	}
+	
+	/**
+	* COPCClient::GetBatchDouble - Returns a double value of the last executed read batch.
+	* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+	* @return Retrieved Node Value
+	*/
+	LibOpen62541_double COPCClient::GetBatchDouble(const LibOpen62541_uint32 nEntryIndex)
+	{
+		LibOpen62541_double resultValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_GetBatchDouble(m_pHandle, nEntryIndex, &resultValue));
+		
+		return resultValue;
+	}
+	
+	/**
+	* COPCClient::GetBatchString - Returns a string value of the last executed read batch.
+	* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+	* @return Retrieved String Value
+	*/
+	std::string COPCClient::GetBatchString(const LibOpen62541_uint32 nEntryIndex)
+	{
+		LibOpen62541_uint32 bytesNeededValue = 0;
+		LibOpen62541_uint32 bytesWrittenValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_GetBatchString(m_pHandle, nEntryIndex, 0, &bytesNeededValue, nullptr));
+		std::vector<char> bufferValue(bytesNeededValue);
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_GetBatchString(m_pHandle, nEntryIndex, bytesNeededValue, &bytesWrittenValue, &bufferValue[0]));
+		
+		return std::string(&bufferValue[0]);
+	}
+	
+	/**
+	* COPCClient::QueueIntegerWrite - Queues an integer node value for the next FlushWriteQueue call.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to write
+	* @param[in] eNodeType - Type of Node to write
+	* @param[in] nValue - Node Value to write
+	*/
+	void COPCClient::QueueIntegerWrite(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const eUAIntegerType eNodeType, const LibOpen62541_int64 nValue)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_QueueIntegerWrite(m_pHandle, nNameSpace, sNodeName.c_str(), eNodeType, nValue));
+	}
+	
+	/**
+	* COPCClient::QueueDoubleWrite - Queues a double node value for the next FlushWriteQueue call.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to write
+	* @param[in] eNodeType - Type of Node to write
+	* @param[in] dValue - Node Value to write
+	*/
+	void COPCClient::QueueDoubleWrite(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const eUADoubleType eNodeType, const LibOpen62541_double dValue)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_QueueDoubleWrite(m_pHandle, nNameSpace, sNodeName.c_str(), eNodeType, dValue));
+	}
+	
+	/**
+	* COPCClient::QueueStringWrite - Queues a string node value for the next FlushWriteQueue call.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to write
+	* @param[in] sValue - Node Value to write
+	*/
+	void COPCClient::QueueStringWrite(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const std::string & sValue)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_QueueStringWrite(m_pHandle, nNameSpace, sNodeName.c_str(), sValue.c_str()));
+	}
+	
+	/**
+	* COPCClient::FlushWriteQueue - Writes all queued values with a single write request and empties the queue. Fails if not connected or any value could not be written.
+	*/
+	void COPCClient::FlushWriteQueue()
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_FlushWriteQueue(m_pHandle));
+	}
+	
+	/**
+	* COPCClient::CreateSubscription - Creates a subscription on the server. Fails if not connected.
+	* @param[in] dPublishingIntervalInMS - Publishing interval in milliseconds.
+	* @return ID of the new subscription.
+	*/
+	LibOpen62541_uint32 COPCClient::CreateSubscription(const LibOpen62541_double dPublishingIntervalInMS)
+	{
+		LibOpen62541_uint32 resultSubscriptionID = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_CreateSubscription(m_pHandle, dPublishingIntervalInMS, &resultSubscriptionID));
+		
+		return resultSubscriptionID;
+	}
+	
+	/**
+	* COPCClient::DeleteSubscription - Deletes a subscription and all its monitored items.
+	* @param[in] nSubscriptionID - Subscription ID
+	*/
+	void COPCClient::DeleteSubscription(const LibOpen62541_uint32 nSubscriptionID)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_DeleteSubscription(m_pHandle, nSubscriptionID));
+	}
+	
+	/**
+	* COPCClient::AddIntegerMonitoredItem - Monitors an integer node value within a subscription.
+	* @param[in] nSubscriptionID - Subscription ID
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to monitor
+	* @param[in] eNodeType - Type of Node to monitor
+	* @param[in] dSamplingIntervalInMS - Sampling interval of the server in milliseconds.
+	* @param[in] dDeadband - Absolute deadband. Changes smaller than this value are not reported. 0 reports every change.
+	* @return ID of the new monitored item.
+	*/
+	LibOpen62541_uint32 COPCClient::AddIntegerMonitoredItem(const LibOpen62541_uint32 nSubscriptionID, const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const eUAIntegerType eNodeType, const LibOpen62541_double dSamplingIntervalInMS, const LibOpen62541_double dDeadband)
+	{
+		LibOpen62541_uint32 resultMonitoredItemID = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_AddIntegerMonitoredItem(m_pHandle, nSubscriptionID, nNameSpace, sNodeName.c_str(), eNodeType, dSamplingIntervalInMS, dDeadband, &resultMonitoredItemID));
+		
+		return resultMonitoredItemID;
+	}
+	
+	/**
+	* COPCClient::AddDoubleMonitoredItem - Monitors a double node value within a subscription.
+	* @param[in] nSubscriptionID - Subscription ID
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to monitor
+	* @param[in] eNodeType - Type of Node to monitor
+	* @param[in] dSamplingIntervalInMS - Sampling interval of the server in milliseconds.
+	* @param[in] dDeadband - Absolute deadband. Changes smaller than this value are not reported. 0 reports every change.
+	* @return ID of the new monitored item.
+	*/
+	LibOpen62541_uint32 COPCClient::AddDoubleMonitoredItem(const LibOpen62541_uint32 nSubscriptionID, const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const eUADoubleType eNodeType, const LibOpen62541_double dSamplingIntervalInMS, const LibOpen62541_double dDeadband)
+	{
+		LibOpen62541_uint32 resultMonitoredItemID = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_AddDoubleMonitoredItem(m_pHandle, nSubscriptionID, nNameSpace, sNodeName.c_str(), eNodeType, dSamplingIntervalInMS, dDeadband, &resultMonitoredItemID));
+		
+		return resultMonitoredItemID;
+	}
+	
+	/**
+	* COPCClient::AddStringMonitoredItem - Monitors a string node value within a subscription.
+	* @param[in] nSubscriptionID - Subscription ID
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to monitor
+	* @param[in] dSamplingIntervalInMS - Sampling interval of the server in milliseconds.
+	* @return ID of the new monitored item.
+	*/
+	LibOpen62541_uint32 COPCClient::AddStringMonitoredItem(const LibOpen62541_uint32 nSubscriptionID, const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541_double dSamplingIntervalInMS)
+	{
+		LibOpen62541_uint32 resultMonitoredItemID = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_AddStringMonitoredItem(m_pHandle, nSubscriptionID, nNameSpace, sNodeName.c_str(), dSamplingIntervalInMS, &resultMonitoredItemID));
+		
+		return resultMonitoredItemID;
+	}
+	
+	/**
+	* COPCClient::ProcessSubscriptions - Processes incoming notifications of all subscriptions and keeps the publish requests going. Fails if not connected.
+	* @param[in] nTimeOutInMS - Maximum time to wait for notifications in milliseconds. 0 processes only what has already arrived.
+	* @return Number of changed monitored items that have not been popped yet.
+	*/
+	LibOpen62541_uint32 COPCClient::ProcessSubscriptions(const LibOpen62541_uint32 nTimeOutInMS)
+	{
+		LibOpen62541_uint32 resultChangeCount = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_ProcessSubscriptions(m_pHandle, nTimeOutInMS, &resultChangeCount));
+		
+		return resultChangeCount;
+	}
+	
+	/**
+	* COPCClient::PopChangedMonitoredItem - Returns the next monitored item that has changed since it was last popped.
+	* @param[out] nMonitoredItemID - ID of the changed monitored item.
+	* @return Returns false if no monitored item has changed.
+	*/
+	bool COPCClient::PopChangedMonitoredItem(LibOpen62541_uint32 & nMonitoredItemID)
+	{
+		bool resultHasChanged = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_PopChangedMonitoredItem(m_pHandle, &nMonitoredItemID, &resultHasChanged));
+		
+		return resultHasChanged;
+	}
+	
+	/**
+	* COPCClient::GetMonitoredItemInteger - Returns the last reported value of an integer monitored item.
+	* @param[in] nMonitoredItemID - Monitored item ID
+	* @return Last reported Node Value
+	*/
+	LibOpen62541_int64 COPCClient::GetMonitoredItemInteger(const LibOpen62541_uint32 nMonitoredItemID)
+	{
+		LibOpen62541_int64 resultValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_GetMonitoredItemInteger(m_pHandle, nMonitoredItemID, &resultValue));
+		
+		return resultValue;
+	}
+	
+	/**
+	* COPCClient::GetMonitoredItemDouble - Returns the last reported value of a double monitored item.
+	* @param[in] nMonitoredItemID - Monitored item ID
+	* @return Last reported Node Value
+	*/
+	LibOpen62541_double COPCClient::GetMonitoredItemDouble(const LibOpen62541_uint32 nMonitoredItemID)
+	{
+		LibOpen62541_double resultValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_GetMonitoredItemDouble(m_pHandle, nMonitoredItemID, &resultValue));
+		
+		return resultValue;
+	}
+	
+	/**
+	* COPCClient::GetMonitoredItemString - Returns the last reported value of a string monitored item.
+	* @param[in] nMonitoredItemID - Monitored item ID
+	* @return Last reported String Value
+	*/
+	std::string COPCClient::GetMonitoredItemString(const LibOpen62541_uint32 nMonitoredItemID)
+	{
+		LibOpen62541_uint32 bytesNeededValue = 0;
+		LibOpen62541_uint32 bytesWrittenValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_GetMonitoredItemString(m_pHandle, nMonitoredItemID, 0, &bytesNeededValue, nullptr));
+		std::vector<char> bufferValue(bytesNeededValue);
+		CheckError(m_pWrapper->m_WrapperTable.m_OPCClient_GetMonitoredItemString(m_pHandle, nMonitoredItemID, bytesNeededValue, &bytesWrittenValue, &bufferValue[0]));
+		
+		return std::string(&bufferValue[0]);
+	}
 
 } // namespace LibOpen62541
 
@@ -117,6 +117,14 @@ typedef void * LibOpen62541_pvoid;
 #define LIBOPEN62541_ERROR_OPCUAVARIANTDATAISNULL 1019 /** OPCUA Variant data is null. */
 #define LIBOPEN62541_ERROR_OPCUASTRINGDATAISNULL 1020 /** OPCUA String data is null. */
 #define LIBOPEN62541_ERROR_OPCUAWRITEINTEGEROUTOFBOUNDS 1021 /** OPCUA Write integer out of bounds. */
+#define LIBOPEN62541_ERROR_INVALIDBATCHINDEX 1022 /** Invalid batch entry index. */
+#define LIBOPEN62541_ERROR_READBATCHNOTEXECUTED 1023 /** Read batch has not been executed. */
+#define LIBOPEN62541_ERROR_COULDNOTCREATESUBSCRIPTION 1024 /** Could not create subscription. */
+#define LIBOPEN62541_ERROR_SUBSCRIPTIONNOTFOUND 1025 /** Subscription not found. */
+#define LIBOPEN62541_ERROR_COULDNOTCREATEMONITOREDITEM 1026 /** Could not create monitored item. */
+#define LIBOPEN62541_ERROR_MONITOREDITEMNOTFOUND 1027 /** Monitored item not found. */
+#define LIBOPEN62541_ERROR_MONITOREDITEMHASNOVALUE 1028 /** Monitored item has not received a value. */
+#define LIBOPEN62541_ERROR_COULDNOTPROCESSSUBSCRIPTIONS 1029 /** Could not process subscriptions. */
 
 /*************************************************************************************************************************
  Error strings for LibOpen62541
@@ -146,6 +154,14 @@ inline const char * LIBOPEN62541_GETERRORSTRING (LibOpen62541Result nErrorCode)
     case LIBOPEN62541_ERROR_OPCUAVARIANTDATAISNULL: return "OPCUA Variant data is null.";
     case LIBOPEN62541_ERROR_OPCUASTRINGDATAISNULL: return "OPCUA String data is null.";
     case LIBOPEN62541_ERROR_OPCUAWRITEINTEGEROUTOFBOUNDS: return "OPCUA Write integer out of bounds.";
+    case LIBOPEN62541_ERROR_INVALIDBATCHINDEX: return "Invalid batch entry index.";
+    case LIBOPEN62541_ERROR_READBATCHNOTEXECUTED: return "Read batch has not been executed.";
+    case LIBOPEN62541_ERROR_COULDNOTCREATESUBSCRIPTION: return "Could not create subscription.";
+    case LIBOPEN62541_ERROR_SUBSCRIPTIONNOTFOUND: return "Subscription not found.";
+    case LIBOPEN62541_ERROR_COULDNOTCREATEMONITOREDITEM: return "Could not create monitored item.";
+    case LIBOPEN62541_ERROR_MONITOREDITEMNOTFOUND: return "Monitored item not found.";
+    case LIBOPEN62541_ERROR_MONITOREDITEMHASNOVALUE: return "Monitored item has not received a value.";
+    case LIBOPEN62541_ERROR_COULDNOTPROCESSSUBSCRIPTIONS: return "Could not process subscriptions.";
     default: return "unknown error";
   }
 }
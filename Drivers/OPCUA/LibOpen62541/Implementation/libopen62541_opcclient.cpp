@@ -31,30 +31,147 @@ Abstract: This is a stub class definition of COPCClient
 
 */
 
+
 #include "libopen62541_opcclient.hpp"
 #include "libopen62541_interfaceexception.hpp"
-
-#include <array>
+#include "libopen62541_valueconversion.hpp"
 
 using namespace LibOpen62541::Impl;
 
+static std::string nodeIdToString(const UA_NodeId& nodeId)
+{
+	if ((nodeId.identifierType != UA_NODEIDTYPE_STRING) || (nodeId.identifier.string.data == nullptr))
+		return "";
+
+	const char* pChars = (const char*)nodeId.identifier.string.data;
+	return std::string(pChars, pChars + nodeId.identifier.string.length);
+}
+
+/*************************************************************************************************************************
+ Class definition of COPCClientNodeEntry
+**************************************************************************************************************************/
+
+COPCClientNodeEntry::COPCClientNodeEntry(const std::string& sNodeName, eOPCClientValueType valueType, LibOpen62541::eUAIntegerType integerType, LibOpen62541::eUADoubleType doubleType)
+	: m_sNodeName (sNodeName), m_ValueType (valueType), m_IntegerType (integerType), m_DoubleType (doubleType)
+{
+
+}
+
+const std::string& COPCClientNodeEntry::getNodeName() const
+{
+	return m_sNodeName;
+}
+
+eOPCClientValueType COPCClientNodeEntry::getValueType() const
+{
+	return m_ValueType;
+}
+
+LibOpen62541::eUAIntegerType COPCClientNodeEntry::getIntegerType() const
+{
+	return m_IntegerType;
+}
+
+LibOpen62541::eUADoubleType COPCClientNodeEntry::getDoubleType() const
+{
+	return m_DoubleType;
+}
+
+LibOpen62541_int64 COPCClientNodeEntry::getIntegerValue(const UA_Variant* pVariant) const
+{
+	return COPCValueConversion::variantToInteger(pVariant, m_IntegerType, m_sNodeName);
+}
+
+LibOpen62541_double COPCClientNodeEntry::getDoubleValue(const UA_Variant* pVariant) const
+{
+	return COPCValueConversion::variantToDouble(pVariant, m_DoubleType, m_sNodeName);
+}
+
+std::string COPCClientNodeEntry::getStringValue(const UA_Variant* pVariant) const
+{
+	return COPCValueConversion::variantToString(pVariant, m_sNodeName);
+}
+
+
+/*************************************************************************************************************************
+ Class definition of COPCClientMonitoredItem
+**************************************************************************************************************************/
+
+COPCClientMonitoredItem::COPCClientMonitoredItem(uint32_t nMonitoredItemID, uint32_t nSubscriptionID, const std::string& sNodeName, eOPCClientValueType valueType, LibOpen62541::eUAIntegerType integerType, LibOpen62541::eUADoubleType doubleType)
+	: COPCClientNodeEntry (sNodeName, valueType, integerType, doubleType),
+	m_nMonitoredItemID (nMonitoredItemID),
+	m_nSubscriptionID (nSubscriptionID),
+	m_bHasValue (false),
+	m_bIsQueued (false)
+{
+	UA_Variant_init(&m_Value);
+}
+
+COPCClientMonitoredItem::~COPCClientMonitoredItem()
+{
+	UA_Variant_clear(&m_Value);
+}
+
+uint32_t COPCClientMonitoredItem::getMonitoredItemID() const
+{
+	return m_nMonitoredItemID;
+}
+
+uint32_t COPCClientMonitoredItem::getSubscriptionID() const
+{
+	return m_nSubscriptionID;
+}
+
+bool COPCClientMonitoredItem::updateValue(const UA_Variant* pValue)
+{
+	UA_Variant_clear(&m_Value);
+	m_bHasValue = (UA_Variant_copy(pValue, &m_Value) == UA_STATUSCODE_GOOD);
+	if (!m_bHasValue || m_bIsQueued)
+		return false;
+
+	m_bIsQueued = true;
+	return true;
+}
+
+void COPCClientMonitoredItem::clearQueued()
+{
+	m_bIsQueued = false;
+}
+
+bool COPCClientMonitoredItem::hasValue() const
+{
+	return m_bHasValue;
+}
+
+const UA_Variant* COPCClientMonitoredItem::getValue() const
+{
+	return &m_Value;
+}
+
+
 /*************************************************************************************************************************
  Class definition of COPCClient 
 **************************************************************************************************************************/
 
 COPCClient::COPCClient()
 	: m_Client (nullptr),
-	m_SecurityMode (LibOpen62541::eUASecurityMode::None) 
+	m_SecurityMode (LibOpen62541::eUASecurityMode::None),
+	m_bReadBatchExecuted (false),
+	m_nMonitoredItemCounter (0)
 {
-
+	UA_ReadResponse_init(&m_ReadBatchResponse);
 }
 
 COPCClient::~COPCClient()
 {
-	if (m_Client != nullptr) {
-		UA_Client_delete(m_Client);
-		m_Client = nullptr;
-	}
+	Disconnect();
+	ClearReadBatch();
+}
+
+void COPCClient::ensureConnection()
+{
+	if (m_Client == nullptr)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_NOTCONNECTED, "OPCUA client is not connected");
 }
 
 void COPCClient::EnableEncryption(const std::string& sLocalCertificate, const std::string& sPrivateKey, const LibOpen62541::eUASecurityMode eSecurityMode)
@@ -140,6 +257,12 @@ void COPCClient::Disconnect()
 		UA_Client_delete(m_Client);
 		m_Client = nullptr;
 	}
+
+	// Subscriptions live in the session and are gone with it. The read batch definition is kept for the next connection.
+	m_MonitoredItems.clear();
+	m_ChangedMonitoredItems.clear();
+	clearReadBatchResponse();
+	clearWriteQueue();
 }
 
 bool COPCClient::IsConnected()
@@ -149,457 +272,593 @@ bool COPCClient::IsConnected()
 
 LibOpen62541_int64 COPCClient::ReadInteger(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUAIntegerType eNodeType)
 {
-	UA_StatusCode statusCode;
-	int64_t nResultValue = 0;
-
-	if (m_Client == nullptr)
-		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_NOTCONNECTED, "OPCUA client is not connected");
+	ensureConnection();
 
-	UA_Variant* variantValue = UA_Variant_new();
-	try {
-		std::vector<char> charBuffer (sNodeName.begin (), sNodeName.end ());
-		charBuffer.push_back(0);
-
-		statusCode = UA_Client_readValueAttribute(m_Client, UA_NODEID_STRING(nNameSpace, charBuffer.data()), variantValue);
-		if (statusCode != UA_STATUSCODE_GOOD) 
-			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTREADVALUE, "could not read value " + sNodeName + " (" + std::to_string(statusCode) + ")");
+	COPCClientNodeEntry entry(sNodeName, eOPCClientValueType::Integer, eNodeType, eUADoubleType::Unknown);
 
-		switch (eNodeType) {
-			case eUAIntegerType::UAUInt8: {
-				if (!UA_Variant_hasScalarType(variantValue, &UA_TYPES[UA_TYPES_BYTE]))
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_READVALUEISOFINCORRECTTYPE, "read value is of incorrect type. " + sNodeName + " was supposed to be Uint8 (" + std::to_string(statusCode) + ")");
+	UA_Variant variantValue;
+	UA_Variant_init(&variantValue);
 
-				UA_Byte* pTypedValue = (UA_Byte*)variantValue->data;
-				if (pTypedValue == nullptr)
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAVARIANTDATAISNULL, "OPCUA variant data is null for " + sNodeName);
+	UA_StatusCode statusCode = UA_Client_readValueAttribute(m_Client, UA_NODEID_STRING(nNameSpace, (char*)sNodeName.c_str()), &variantValue);
+	if (statusCode != UA_STATUSCODE_GOOD)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTREADVALUE, "could not read value " + sNodeName + " (" + std::to_string(statusCode) + ")");
 
-				nResultValue = *pTypedValue;
-				break;
-			}
+	int64_t nResultValue = 0;
+	try {
+		nResultValue = entry.getIntegerValue(&variantValue);
+	}
+	catch (...) {
+		UA_Variant_clear(&variantValue);
+		throw;
+	}
 
-			case eUAIntegerType::UAUInt16: {
+	UA_Variant_clear(&variantValue);
 
-				if (!UA_Variant_hasScalarType(variantValue, &UA_TYPES[UA_TYPES_UINT16])) 
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_READVALUEISOFINCORRECTTYPE, "read value is of incorrect type. " + sNodeName + " was supposed to be Uint16 (" + std::to_string(statusCode) + ")");
+	return nResultValue;
+}
 
-				UA_UInt16* pTypedValue = (UA_UInt16*)variantValue->data;
-				if (pTypedValue == nullptr)
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAVARIANTDATAISNULL, "OPCUA variant data is null for " + sNodeName);
+LibOpen62541_double COPCClient::ReadDouble(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUADoubleType eNodeType)
+{
+	ensureConnection();
 
-				nResultValue = *pTypedValue;
-				break;
-			}
+	COPCClientNodeEntry entry(sNodeName, eOPCClientValueType::Double, eUAIntegerType::Unknown, eNodeType);
 
-			case eUAIntegerType::UAUInt32: {
-				if (!UA_Variant_hasScalarType(variantValue, &UA_TYPES[UA_TYPES_UINT32]))
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_READVALUEISOFINCORRECTTYPE, "read value is of incorrect type. " + sNodeName + " was supposed to be Uint32 (" + std::to_string(statusCode) + ")");
+	UA_Variant variantValue;
+	UA_Variant_init(&variantValue);
 
-				UA_UInt32* pTypedValue = (UA_UInt32*)variantValue->data;
-				if (pTypedValue == nullptr)
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAVARIANTDATAISNULL, "OPCUA variant data is null for " + sNodeName);
+	UA_StatusCode statusCode = UA_Client_readValueAttribute(m_Client, UA_NODEID_STRING(nNameSpace, (char*)sNodeName.c_str()), &variantValue);
+	if (statusCode != UA_STATUSCODE_GOOD)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTREADVALUE, "could not read value " + sNodeName + " (" + std::to_string(statusCode) + ")");
 
-				nResultValue = *pTypedValue;
-				break;
-			}
+	double dResultValue = 0.0;
+	try {
+		dResultValue = entry.getDoubleValue(&variantValue);
+	}
+	catch (...) {
+		UA_Variant_clear(&variantValue);
+		throw;
+	}
 
-			case eUAIntegerType::UAUInt64: {
-				if (!UA_Variant_hasScalarType(variantValue, &UA_TYPES[UA_TYPES_UINT64]))
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_READVALUEISOFINCORRECTTYPE, "read value is of incorrect type. " + sNodeName + " was supposed to be Uint64 (" + std::to_string(statusCode) + ")");
+	UA_Variant_clear(&variantValue);
 
-				UA_UInt64* pTypedValue = (UA_UInt64*)variantValue->data;
-				if (pTypedValue == nullptr)
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAVARIANTDATAISNULL, "OPCUA variant data is null for " + sNodeName);
+	return dResultValue;
+}
 
-				nResultValue = *pTypedValue;
-				break;
-			}
+std::string COPCClient::ReadString(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName)
+{
+	ensureConnection();
 
-			case eUAIntegerType::UAInt8: {
-				if (!UA_Variant_hasScalarType(variantValue, &UA_TYPES[UA_TYPES_SBYTE]))
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_READVALUEISOFINCORRECTTYPE, "read value is of incorrect type. " + sNodeName + " was supposed to be Int8 (" + std::to_string(statusCode) + ")");
+	COPCClientNodeEntry entry(sNodeName, eOPCClientValueType::String, eUAIntegerType::Unknown, eUADoubleType::Unknown);
 
-				UA_SByte* pTypedValue = (UA_SByte*)variantValue->data;
-				if (pTypedValue == nullptr)
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAVARIANTDATAISNULL, "OPCUA variant data is null for " + sNodeName);
+	UA_Variant variantValue;
+	UA_Variant_init(&variantValue);
 
-				nResultValue = *pTypedValue;
-				break;
-			}
+	UA_StatusCode statusCode = UA_Client_readValueAttribute(m_Client, UA_NODEID_STRING(nNameSpace, (char*)sNodeName.c_str()), &variantValue);
+	if (statusCode != UA_STATUSCODE_GOOD)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTREADVALUE, "could not read value " + sNodeName + " (" + std::to_string(statusCode) + ")");
 
-			case eUAIntegerType::UAInt16: {
-				if (!UA_Variant_hasScalarType(variantValue, &UA_TYPES[UA_TYPES_INT16]))
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_READVALUEISOFINCORRECTTYPE, "read value is of incorrect type. " + sNodeName + " was supposed to be Int16 (" + std::to_string(statusCode) + ")");
+	std::string sResultValue;
+	try {
+		sResultValue = entry.getStringValue(&variantValue);
+	}
+	catch (...) {
+		UA_Variant_clear(&variantValue);
+		throw;
+	}
 
-				UA_Int16* pTypedValue = (UA_Int16*)variantValue->data;
-				if (pTypedValue == nullptr)
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAVARIANTDATAISNULL, "OPCUA variant data is null for " + sNodeName);
+	UA_Variant_clear(&variantValue);
 
-				nResultValue = *pTypedValue;
-				break;
-			}
+	return sResultValue;
+}
 
-			case eUAIntegerType::UAInt32: {
-				if (!UA_Variant_hasScalarType(variantValue, &UA_TYPES[UA_TYPES_INT32]))
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_READVALUEISOFINCORRECTTYPE, "read value is of incorrect type. " + sNodeName + " was supposed to be Int32 (" + std::to_string(statusCode) + ")");
+void COPCClient::flushWriteValues(UA_WriteValue* pWriteValues, size_t nWriteValueCount)
+{
+	UA_WriteRequest wReq;
+	UA_WriteRequest_init(&wReq);
+	wReq.nodesToWrite = pWriteValues;
+	wReq.nodesToWriteSize = nWriteValueCount;
 
-				UA_Int32* pTypedValue = (UA_Int32*)variantValue->data;
-				if (pTypedValue == nullptr)
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAVARIANTDATAISNULL, "OPCUA variant data is null for " + sNodeName);
+	UA_WriteResponse wResp = UA_Client_Service_write(m_Client, wReq);
 
-				nResultValue = *pTypedValue;
-				break;
+	// The request does not own the write values, so it must not be cleared here.
+	UA_StatusCode statusCode = wResp.responseHeader.serviceResult;
+	std::string sFailedNodeName;
+
+	if (statusCode == UA_STATUSCODE_GOOD) {
+		if (wResp.resultsSize == nWriteValueCount) {
+			for (size_t nIndex = 0; nIndex < nWriteValueCount; nIndex++) {
+				if (wResp.results[nIndex] != UA_STATUSCODE_GOOD) {
+					statusCode = wResp.results[nIndex];
+					sFailedNodeName = nodeIdToString(pWriteValues[nIndex].nodeId);
+					break;
+				}
 			}
+		}
+		else {
+			statusCode = UA_STATUSCODE_BADUNEXPECTEDERROR;
+		}
+	}
+	else {
+		if (nWriteValueCount == 1)
+			sFailedNodeName = nodeIdToString(pWriteValues[0].nodeId);
+	}
 
-			case eUAIntegerType::UAInt64: {
-				if (!UA_Variant_hasScalarType(variantValue, &UA_TYPES[UA_TYPES_INT64]))
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_READVALUEISOFINCORRECTTYPE, "read value is of incorrect type. " + sNodeName + " was supposed to be Int64 (" + std::to_string(statusCode) + ")");
-
-				UA_Int64* pTypedValue = (UA_Int64*)variantValue->data;
-				if (pTypedValue == nullptr)
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAVARIANTDATAISNULL, "OPCUA variant data is null for " + sNodeName);
+	UA_WriteResponse_clear(&wResp);
 
-				nResultValue = *pTypedValue;
-				break;
-			}
+	if (statusCode != UA_STATUSCODE_GOOD) {
+		if (sFailedNodeName.empty())
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTWRITEVALUE, "could not write " + std::to_string(nWriteValueCount) + " values (" + std::to_string(statusCode) + ")");
 
-			default:
-				throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDINTEGERNODETYPE);
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTWRITEVALUE, "could not write value to " + sFailedNodeName + " (" + std::to_string(statusCode) + ")");
+	}
+}
 
-		}
+void COPCClient::WriteInteger(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUAIntegerType eNodeType, const LibOpen62541_int64 nValue)
+{
+	ensureConnection();
 
-		UA_Variant* valueToDelete = variantValue;
-		variantValue = nullptr;
+	UA_WriteValue writeValue;
+	UA_WriteValue_init(&writeValue);
 
-		UA_Variant_delete(valueToDelete);
+	try {
+		COPCValueConversion::integerToVariant(&writeValue.value.value, eNodeType, nValue);
+		writeValue.value.hasValue = true;
+		writeValue.nodeId = UA_NODEID_STRING_ALLOC(nNameSpace, sNodeName.c_str());
+		writeValue.attributeId = UA_ATTRIBUTEID_VALUE;
 
+		flushWriteValues(&writeValue, 1);
 	}
 	catch (...) {
-		if (variantValue != nullptr)
-			UA_Variant_delete(variantValue);
-
+		UA_WriteValue_clear(&writeValue);
 		throw;
 	}
 
-	return nResultValue;
-
-
+	UA_WriteValue_clear(&writeValue);
 }
 
-LibOpen62541_double COPCClient::ReadDouble(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUADoubleType eNodeType)
+void COPCClient::WriteDouble(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUADoubleType eNodeType, const LibOpen62541_double dValue)
 {
-	UA_StatusCode statusCode;
-	double dResultValue = 0;
+	ensureConnection();
 
-	if (m_Client == nullptr)
-		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_NOTCONNECTED, "OPCUA client is not connected");
+	UA_WriteValue writeValue;
+	UA_WriteValue_init(&writeValue);
 
-	UA_Variant* variantValue = UA_Variant_new();
 	try {
-		std::vector<char> charBuffer(sNodeName.begin(), sNodeName.end());
-		charBuffer.push_back(0);
+		COPCValueConversion::doubleToVariant(&writeValue.value.value, eNodeType, dValue);
+		writeValue.value.hasValue = true;
+		writeValue.nodeId = UA_NODEID_STRING_ALLOC(nNameSpace, sNodeName.c_str());
+		writeValue.attributeId = UA_ATTRIBUTEID_VALUE;
 
-		statusCode = UA_Client_readValueAttribute(m_Client, UA_NODEID_STRING(nNameSpace, charBuffer.data()), variantValue);
-		if (statusCode != UA_STATUSCODE_GOOD)
-			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTREADVALUE, "could not read value " + sNodeName + " (" + std::to_string(statusCode) + ")");
+		flushWriteValues(&writeValue, 1);
+	}
+	catch (...) {
+		UA_WriteValue_clear(&writeValue);
+		throw;
+	}
 
-		switch (eNodeType) {
-			case eUADoubleType::UAFloat32: {
-				if (!UA_Variant_hasScalarType(variantValue, &UA_TYPES[UA_TYPES_FLOAT]))
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_READVALUEISOFINCORRECTTYPE, "read value is of incorrect type. " + sNodeName + " was supposed to be Float (" + std::to_string(statusCode) + ")");
+	UA_WriteValue_clear(&writeValue);
+}
 
-				UA_Float* pTypedValue = (UA_Float*) variantValue->data;
-				if (pTypedValue == nullptr)
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAVARIANTDATAISNULL, "OPCUA variant data is null for " + sNodeName);
+void COPCClient::WriteString(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const std::string & sValue)
+{
+	ensureConnection();
 
-				dResultValue = *pTypedValue;
-				break;
-			}
+	UA_WriteValue writeValue;
+	UA_WriteValue_init(&writeValue);
 
-			case eUADoubleType::UADouble64: {
-				if (!UA_Variant_hasScalarType(variantValue, &UA_TYPES[UA_TYPES_FLOAT]))
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_READVALUEISOFINCORRECTTYPE, "read value is of incorrect type. " + sNodeName + " was supposed to be Float (" + std::to_string(statusCode) + ")");
+	try {
+		COPCValueConversion::stringToVariant(&writeValue.value.value, sValue);
+		writeValue.value.hasValue = true;
+		writeValue.nodeId = UA_NODEID_STRING_ALLOC(nNameSpace, sNodeName.c_str());
+		writeValue.attributeId = UA_ATTRIBUTEID_VALUE;
 
-				UA_Float* pTypedValue = (UA_Float*)variantValue->data;
-				if (pTypedValue == nullptr)
-					throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAVARIANTDATAISNULL, "OPCUA variant data is null for " + sNodeName);
+		flushWriteValues(&writeValue, 1);
+	}
+	catch (...) {
+		UA_WriteValue_clear(&writeValue);
+		throw;
+	}
 
-				dResultValue = *pTypedValue;
-				break;
-			}
+	UA_WriteValue_clear(&writeValue);
+}
 
-			default:
-				throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDFLOATNODETYPE);
+void COPCClient::clearReadBatchResponse()
+{
+	UA_ReadResponse_clear(&m_ReadBatchResponse);
+	m_bReadBatchExecuted = false;
+}
 
-		}
+void COPCClient::ClearReadBatch()
+{
+	for (auto& readValueId : m_ReadBatchNodes)
+		UA_ReadValueId_clear(&readValueId);
 
-		UA_Variant* valueToDelete = variantValue;
-		variantValue = nullptr;
+	m_ReadBatchNodes.clear();
+	m_ReadBatchEntries.clear();
+	clearReadBatchResponse();
+}
 
-		UA_Variant_delete(valueToDelete);
+uint32_t COPCClient::addBatchEntry(const LibOpen62541_uint32 nNameSpace, const std::string& sNodeName, const COPCClientNodeEntry& entry)
+{
+	UA_ReadValueId readValueId;
+	UA_ReadValueId_init(&readValueId);
+	readValueId.nodeId = UA_NODEID_STRING_ALLOC(nNameSpace, sNodeName.c_str());
+	readValueId.attributeId = UA_ATTRIBUTEID_VALUE;
 
+	try {
+		m_ReadBatchEntries.push_back(entry);
+		m_ReadBatchNodes.push_back(readValueId);
 	}
 	catch (...) {
-		if (variantValue != nullptr)
-			UA_Variant_delete(variantValue);
-
+		if (m_ReadBatchEntries.size() > m_ReadBatchNodes.size())
+			m_ReadBatchEntries.pop_back();
+		UA_ReadValueId_clear(&readValueId);
 		throw;
 	}
 
-	return dResultValue;
-
+	// Results of earlier executions do not cover the new entry.
+	clearReadBatchResponse();
 
+	return (uint32_t)(m_ReadBatchNodes.size() - 1);
 }
 
-std::string COPCClient::ReadString(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName)
+LibOpen62541_uint32 COPCClient::AddIntegerToReadBatch(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUAIntegerType eNodeType)
 {
-	UA_StatusCode statusCode;
-	std::string sResultValue;
+	if ((eNodeType == eUAIntegerType::Unknown) || ((int32_t)eNodeType > (int32_t)eUAIntegerType::UAInt64))
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDINTEGERNODETYPE);
 
-	if (m_Client == nullptr)
-		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_NOTCONNECTED, "OPCUA client is not connected");
+	return addBatchEntry(nNameSpace, sNodeName, COPCClientNodeEntry(sNodeName, eOPCClientValueType::Integer, eNodeType, eUADoubleType::Unknown));
+}
 
-	UA_Variant* variantValue = UA_Variant_new();
-	try {
-		std::vector<char> charBuffer(sNodeName.begin(), sNodeName.end());
-		charBuffer.push_back(0);
+LibOpen62541_uint32 COPCClient::AddDoubleToReadBatch(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUADoubleType eNodeType)
+{
+	if ((eNodeType != eUADoubleType::UAFloat32) && (eNodeType != eUADoubleType::UADouble64))
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDFLOATNODETYPE);
 
-		statusCode = UA_Client_readValueAttribute(m_Client, UA_NODEID_STRING(nNameSpace, charBuffer.data()), variantValue);
-		if (statusCode != UA_STATUSCODE_GOOD)
-			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTREADVALUE, "could not read value " + sNodeName + " (" + std::to_string(statusCode) + ")");
+	return addBatchEntry(nNameSpace, sNodeName, COPCClientNodeEntry(sNodeName, eOPCClientValueType::Double, eUAIntegerType::Unknown, eNodeType));
+}
 
-		if (!UA_Variant_hasScalarType(variantValue, &UA_TYPES[UA_TYPES_STRING]))
-				throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_READVALUEISOFINCORRECTTYPE, "read value is of incorrect type. " + sNodeName + " was supposed to be String (" + std::to_string(statusCode) + ")");
+LibOpen62541_uint32 COPCClient::AddStringToReadBatch(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName)
+{
+	return addBatchEntry(nNameSpace, sNodeName, COPCClientNodeEntry(sNodeName, eOPCClientValueType::String, eUAIntegerType::Unknown, eUADoubleType::Unknown));
+}
 
-		UA_String* pTypedValue = (UA_String*)variantValue->data;
-		if (pTypedValue == nullptr)
-			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAVARIANTDATAISNULL, "OPCUA variant data is null for " + sNodeName);
+void COPCClient::ExecuteReadBatch()
+{
+	ensureConnection();
 
-		const char * pDataChar = (const char*) pTypedValue->data;
-		if (pDataChar == nullptr)
-			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUASTRINGDATAISNULL, "OPCUA String data is null: " + sNodeName);
+	clearReadBatchResponse();
+	if (m_ReadBatchNodes.empty()) {
+		m_bReadBatchExecuted = true;
+		return;
+	}
 
-		sResultValue = std::string(pDataChar, pDataChar + pTypedValue->length);
+	UA_ReadRequest request;
+	UA_ReadRequest_init(&request);
+	request.nodesToRead = m_ReadBatchNodes.data();
+	request.nodesToReadSize = m_ReadBatchNodes.size();
+	request.timestampsToReturn = UA_TIMESTAMPSTORETURN_NEITHER;
 
-		UA_Variant* valueToDelete = variantValue;
-		variantValue = nullptr;
+	// The request does not own the node ids, so it must not be cleared here.
+	m_ReadBatchResponse = UA_Client_Service_read(m_Client, request);
 
-		UA_Variant_delete(valueToDelete);
+	UA_StatusCode statusCode = m_ReadBatchResponse.responseHeader.serviceResult;
+	if (statusCode != UA_STATUSCODE_GOOD) {
+		clearReadBatchResponse();
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTREADVALUE, "could not read " + std::to_string(m_ReadBatchNodes.size()) + " values (" + std::to_string(statusCode) + ")");
+	}
 
+	if (m_ReadBatchResponse.resultsSize != m_ReadBatchNodes.size()) {
+		clearReadBatchResponse();
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTREADVALUE, "read response does not match read batch");
 	}
-	catch (...) {
-		if (variantValue != nullptr)
-			UA_Variant_delete(variantValue);
 
-		throw;
+	for (size_t nIndex = 0; nIndex < m_ReadBatchResponse.resultsSize; nIndex++) {
+		UA_DataValue& dataValue = m_ReadBatchResponse.results[nIndex];
+		statusCode = dataValue.hasStatus ? dataValue.status : UA_STATUSCODE_GOOD;
+		if ((statusCode != UA_STATUSCODE_GOOD) || (!dataValue.hasValue)) {
+			std::string sNodeName = m_ReadBatchEntries.at(nIndex).getNodeName();
+			clearReadBatchResponse();
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTREADVALUE, "could not read value " + sNodeName + " (" + std::to_string(statusCode) + ")");
+		}
 	}
 
-	return sResultValue;
+	m_bReadBatchExecuted = true;
 }
 
-void COPCClient::WriteInteger(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUAIntegerType eNodeType, const LibOpen62541_int64 nValue)
+const UA_Variant* COPCClient::getBatchVariant(const LibOpen62541_uint32 nEntryIndex, eOPCClientValueType valueType)
 {
-	std::array<uint8_t, 8> writeDataBuffer;
-	for (auto & value : writeDataBuffer)
-		value = 0;
+	if (nEntryIndex >= m_ReadBatchEntries.size())
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDBATCHINDEX, "invalid batch entry index: " + std::to_string(nEntryIndex));
 
-	if (m_Client == nullptr)
-		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_NOTCONNECTED, "OPCUA client is not connected");
+	if (!m_bReadBatchExecuted)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_READBATCHNOTEXECUTED);
 
-	UA_DataType* pDataType;
-	switch (eNodeType) {
-		case eUAIntegerType::UAUInt8: {
-			pDataType = &UA_TYPES[UA_TYPES_BYTE];
-			if ((nValue < 0) || (nValue >= 256))
-				throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAWRITEINTEGEROUTOFBOUNDS, "OPCUA write integer out of bounds: " + std::to_string (nValue));
+	auto& entry = m_ReadBatchEntries.at(nEntryIndex);
+	if (entry.getValueType() != valueType)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_READVALUEISOFINCORRECTTYPE, "batch entry " + entry.getNodeName() + " has been added with a different type");
 
-			uint8_t* pTargetPtr = writeDataBuffer.data();
-			*pTargetPtr = (uint8_t) nValue;
-
-			break;
-		}
+	return &m_ReadBatchResponse.results[nEntryIndex].value;
+}
 
-		case eUAIntegerType::UAUInt16: {
-			pDataType = &UA_TYPES[UA_TYPES_UINT16];
-			if ((nValue < 0) || (nValue >= 65536))
-				throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAWRITEINTEGEROUTOFBOUNDS, "OPCUA write integer out of bounds" + std::to_string(nValue));
+LibOpen62541_int64 COPCClient::GetBatchInteger(const LibOpen62541_uint32 nEntryIndex)
+{
+	const UA_Variant* pVariant = getBatchVariant(nEntryIndex, eOPCClientValueType::Integer);
+	return m_ReadBatchEntries.at(nEntryIndex).getIntegerValue(pVariant);
+}
 
-			uint16_t* pTargetPtr = (uint16_t *) writeDataBuffer.data();
-			*pTargetPtr = (uint16_t)nValue;
+LibOpen62541_double COPCClient::GetBatchDouble(const LibOpen62541_uint32 nEntryIndex)
+{
+	const UA_Variant* pVariant = getBatchVariant(nEntryIndex, eOPCClientValueType::Double);
+	return m_ReadBatchEntries.at(nEntryIndex).getDoubleValue(pVariant);
+}
 
-			break;
-		}
+std::string COPCClient::GetBatchString(const LibOpen62541_uint32 nEntryIndex)
+{
+	const UA_Variant* pVariant = getBatchVariant(nEntryIndex, eOPCClientValueType::String);
+	return m_ReadBatchEntries.at(nEntryIndex).getStringValue(pVariant);
+}
 
-		case eUAIntegerType::UAUInt32: {
-			pDataType = &UA_TYPES[UA_TYPES_UINT32];
-			if ((nValue < 0) || (nValue > 0x100000000LL))
-				throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAWRITEINTEGEROUTOFBOUNDS, "OPCUA write integer out of bounds" + std::to_string(nValue));
+void COPCClient::clearWriteQueue()
+{
+	for (auto& writeValue : m_WriteQueue)
+		UA_WriteValue_clear(&writeValue);
 
-			uint32_t* pTargetPtr = (uint32_t*)writeDataBuffer.data();
-			*pTargetPtr = (uint32_t)nValue;
+	m_WriteQueue.clear();
+}
 
-			break;
-		}
+void COPCClient::queueWrite(const LibOpen62541_uint32 nNameSpace, const std::string& sNodeName, UA_Variant* pValue)
+{
+	UA_WriteValue writeValue;
+	UA_WriteValue_init(&writeValue);
+	writeValue.nodeId = UA_NODEID_STRING_ALLOC(nNameSpace, sNodeName.c_str());
+	writeValue.attributeId = UA_ATTRIBUTEID_VALUE;
+	writeValue.value.hasValue = true;
+	writeValue.value.value = *pValue;
+	UA_Variant_init(pValue);
 
-		case eUAIntegerType::UAUInt64: {
-			pDataType = &UA_TYPES[UA_TYPES_UINT64];
+	try {
+		m_WriteQueue.push_back(writeValue);
+	}
+	catch (...) {
+		UA_WriteValue_clear(&writeValue);
+		throw;
+	}
+}
 
-			if (nValue < 0)
-				throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAWRITEINTEGEROUTOFBOUNDS, "OPCUA write integer out of bounds" + std::to_string(nValue));
+void COPCClient::QueueIntegerWrite(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUAIntegerType eNodeType, const LibOpen62541_int64 nValue)
+{
+	UA_Variant value;
+	UA_Variant_init(&value);
+	COPCValueConversion::integerToVariant(&value, eNodeType, nValue);
 
-			uint64_t* pTargetPtr = (uint64_t*)writeDataBuffer.data();
-			*pTargetPtr = (uint64_t)nValue;
+	queueWrite(nNameSpace, sNodeName, &value);
+}
 
-			break;
-		}
+void COPCClient::QueueDoubleWrite(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUADoubleType eNodeType, const LibOpen62541_double dValue)
+{
+	UA_Variant value;
+	UA_Variant_init(&value);
+	COPCValueConversion::doubleToVariant(&value, eNodeType, dValue);
 
-		case eUAIntegerType::UAInt8: {
-			pDataType = &UA_TYPES[UA_TYPES_BYTE];
-			if ((nValue < -127) || (nValue >= 128))
-				throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAWRITEINTEGEROUTOFBOUNDS, "OPCUA write integer out of bounds: " + std::to_string(nValue));
+	queueWrite(nNameSpace, sNodeName, &value);
+}
 
-			int8_t* pTargetPtr = (int8_t*)writeDataBuffer.data();
-			*pTargetPtr = (int8_t)nValue;
+void COPCClient::QueueStringWrite(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const std::string & sValue)
+{
+	UA_Variant value;
+	UA_Variant_init(&value);
+	COPCValueConversion::stringToVariant(&value, sValue);
 
-			break;
-		}
+	queueWrite(nNameSpace, sNodeName, &value);
+}
 
-		case eUAIntegerType::UAInt16: {
-			pDataType = &UA_TYPES[UA_TYPES_INT16];
-			if ((nValue < -32767) || (nValue >= 32768))
-				throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAWRITEINTEGEROUTOFBOUNDS, "OPCUA write integer out of bounds" + std::to_string(nValue));
+void COPCClient::FlushWriteQueue()
+{
+	ensureConnection();
 
-			int16_t* pTargetPtr = (int16_t*)writeDataBuffer.data();
-			*pTargetPtr = (int16_t)nValue;
+	if (m_WriteQueue.empty())
+		return;
 
-			break;
-		}
+	try {
+		flushWriteValues(m_WriteQueue.data(), m_WriteQueue.size());
+	}
+	catch (...) {
+		clearWriteQueue();
+		throw;
+	}
 
-		case eUAIntegerType::UAInt32: {
-			pDataType = &UA_TYPES[UA_TYPES_INT32];
-			if ((nValue < INT32_MIN) || (nValue > INT32_MAX))
-				throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAWRITEINTEGEROUTOFBOUNDS, "OPCUA write integer out of bounds" + std::to_string(nValue));
+	clearWriteQueue();
+}
 
-			int32_t* pTargetPtr = (int32_t*)writeDataBuffer.data();
-			*pTargetPtr = (int32_t)nValue;
+void COPCClient::onDataChange(UA_Client* pClient, UA_UInt32 nSubscriptionID, void* pSubscriptionContext, UA_UInt32 nMonitoredItemID, void* pMonitoredItemContext, UA_DataValue* pValue)
+{
+	COPCClient* pOwner = (COPCClient*)pSubscriptionContext;
+	COPCClientMonitoredItem* pItem = (COPCClientMonitoredItem*)pMonitoredItemContext;
+	if ((pOwner == nullptr) || (pItem == nullptr) || (pValue == nullptr))
+		return;
 
-			break;
-		}
+	if (!pValue->hasValue)
+		return;
+	if (pValue->hasStatus && (pValue->status != UA_STATUSCODE_GOOD))
+		return;
 
-		case eUAIntegerType::UAInt64: {
-			pDataType = &UA_TYPES[UA_TYPES_INT64];
+	// Called from within the open62541 event loop, which must not see any exceptions.
+	try {
+		if (pItem->updateValue(&pValue->value))
+			pOwner->m_ChangedMonitoredItems.push_back(pItem->getMonitoredItemID());
+	}
+	catch (...) {
+		pItem->clearQueued();
+	}
+}
 
-			int64_t* pTargetPtr = (int64_t*)writeDataBuffer.data();
-			*pTargetPtr = (int64_t)nValue;
+LibOpen62541_uint32 COPCClient::CreateSubscription(const LibOpen62541_double dPublishingIntervalInMS)
+{
+	ensureConnection();
 
-			break;
-		}
+	if (dPublishingIntervalInMS < 0.0)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDPARAM, "invalid publishing interval: " + std::to_string(dPublishingIntervalInMS));
 
-		default:
-			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDINTEGERNODETYPE);
+	UA_CreateSubscriptionRequest request = UA_CreateSubscriptionRequest_default();
+	request.requestedPublishingInterval = dPublishingIntervalInMS;
 
-	}
+	UA_CreateSubscriptionResponse response = UA_Client_Subscriptions_create(m_Client, request, this, nullptr, nullptr);
+	UA_StatusCode statusCode = response.responseHeader.serviceResult;
+	uint32_t nSubscriptionID = response.subscriptionId;
+	UA_CreateSubscriptionResponse_clear(&response);
 
-	UA_WriteRequest wReq;
-	UA_WriteRequest_init(&wReq);
-	wReq.nodesToWrite = UA_WriteValue_new();
-	wReq.nodesToWriteSize = 1;
-	wReq.nodesToWrite[0].nodeId = UA_NODEID_STRING_ALLOC(nNameSpace, sNodeName.c_str ());
-	wReq.nodesToWrite[0].attributeId = UA_ATTRIBUTEID_VALUE;
-	wReq.nodesToWrite[0].value.hasValue = true;
-	wReq.nodesToWrite[0].value.value.storageType = UA_VARIANT_DATA_NODELETE; /* do not free the integer on deletion */
+	if (statusCode != UA_STATUSCODE_GOOD)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTCREATESUBSCRIPTION, "could not create OPCUA subscription (" + std::to_string(statusCode) + ")");
 
-	wReq.nodesToWrite[0].value.value.type = pDataType;
-	wReq.nodesToWrite[0].value.value.data = writeDataBuffer.data();
+	return nSubscriptionID;
+}
 
-	UA_WriteResponse wResp = UA_Client_Service_write(m_Client, wReq);
+void COPCClient::DeleteSubscription(const LibOpen62541_uint32 nSubscriptionID)
+{
+	ensureConnection();
 
-	auto serviceResult = wResp.responseHeader.serviceResult;
-	UA_WriteRequest_clear(&wReq);
-	UA_WriteResponse_clear(&wResp);
+	UA_StatusCode statusCode = UA_Client_Subscriptions_deleteSingle(m_Client, nSubscriptionID);
 
-	if (serviceResult != UA_STATUSCODE_GOOD)
-		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTWRITEVALUE, "could not write value to " + sNodeName);
+	auto iIter = m_MonitoredItems.begin();
+	while (iIter != m_MonitoredItems.end()) {
+		if (iIter->second->getSubscriptionID() == nSubscriptionID)
+			iIter = m_MonitoredItems.erase(iIter);
+		else
+			iIter++;
+	}
 
+	if (statusCode != UA_STATUSCODE_GOOD)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_SUBSCRIPTIONNOTFOUND, "could not delete OPCUA subscription " + std::to_string(nSubscriptionID) + " (" + std::to_string(statusCode) + ")");
 }
 
-void COPCClient::WriteDouble(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUADoubleType eNodeType, const LibOpen62541_double dValue)
+uint32_t COPCClient::addMonitoredItem(const LibOpen62541_uint32 nSubscriptionID, const LibOpen62541_uint32 nNameSpace, const std::string& sNodeName, eOPCClientValueType valueType, LibOpen62541::eUAIntegerType integerType, LibOpen62541::eUADoubleType doubleType, const LibOpen62541_double dSamplingIntervalInMS, const LibOpen62541_double dDeadband)
 {
-	std::array<uint8_t, 8> writeDataBuffer;
-	for (auto& value : writeDataBuffer)
-		value = 0;
+	ensureConnection();
+
+	if (dSamplingIntervalInMS < 0.0)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDPARAM, "invalid sampling interval: " + std::to_string(dSamplingIntervalInMS));
+	if (dDeadband < 0.0)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDPARAM, "invalid deadband: " + std::to_string(dDeadband));
+
+	uint32_t nMonitoredItemID = m_nMonitoredItemCounter + 1;
+	std::unique_ptr<COPCClientMonitoredItem> pItem(new COPCClientMonitoredItem(nMonitoredItemID, nSubscriptionID, sNodeName, valueType, integerType, doubleType));
+
+	UA_MonitoredItemCreateRequest request = UA_MonitoredItemCreateRequest_default(UA_NODEID_STRING_ALLOC(nNameSpace, sNodeName.c_str()));
+	request.requestedParameters.samplingInterval = dSamplingIntervalInMS;
+	request.requestedParameters.queueSize = 1;
+	request.requestedParameters.discardOldest = true;
+
+	// Only numeric nodes accept a deadband filter.
+	UA_DataChangeFilter filter;
+	UA_DataChangeFilter_init(&filter);
+	if (dDeadband > 0.0) {
+		filter.trigger = UA_DATACHANGETRIGGER_STATUSVALUE;
+		filter.deadbandType = UA_DEADBANDTYPE_ABSOLUTE;
+		filter.deadbandValue = dDeadband;
+
+		request.requestedParameters.filter.encoding = UA_EXTENSIONOBJECT_DECODED_NODELETE;
+		request.requestedParameters.filter.content.decoded.type = &UA_TYPES[UA_TYPES_DATACHANGEFILTER];
+		request.requestedParameters.filter.content.decoded.data = &filter;
+	}
 
-	if (m_Client == nullptr)
-		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_NOTCONNECTED, "OPCUA client is not connected");
+	UA_MonitoredItemCreateResult result = UA_Client_MonitoredItems_createDataChange(m_Client, nSubscriptionID, UA_TIMESTAMPSTORETURN_NEITHER, request, pItem.get(), onDataChange, nullptr);
+	UA_MonitoredItemCreateRequest_clear(&request);
 
-	UA_DataType* pDataType;
-	switch (eNodeType) {
-	case eUADoubleType::UAFloat32: {
-		pDataType = &UA_TYPES[UA_TYPES_FLOAT];
-		float* pTargetPtr = (float*)writeDataBuffer.data();
-		*pTargetPtr = (float)dValue;
-		break;
-	}
+	UA_StatusCode statusCode = result.statusCode;
+	UA_MonitoredItemCreateResult_clear(&result);
 
-	case eUADoubleType::UADouble64: {
-		pDataType = &UA_TYPES[UA_TYPES_DOUBLE];
-		double* pTargetPtr = (double*)writeDataBuffer.data();
-		*pTargetPtr = (double)dValue;
-		break;
-	}
+	if (statusCode != UA_STATUSCODE_GOOD)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTCREATEMONITOREDITEM, "could not monitor " + sNodeName + " (" + std::to_string(statusCode) + ")");
+
+	m_MonitoredItems.insert(std::make_pair(nMonitoredItemID, std::move(pItem)));
+	m_nMonitoredItemCounter = nMonitoredItemID;
 
+	return nMonitoredItemID;
+}
+
+LibOpen62541_uint32 COPCClient::AddIntegerMonitoredItem(const LibOpen62541_uint32 nSubscriptionID, const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUAIntegerType eNodeType, const LibOpen62541_double dSamplingIntervalInMS, const LibOpen62541_double dDeadband)
+{
+	if ((eNodeType == eUAIntegerType::Unknown) || ((int32_t)eNodeType > (int32_t)eUAIntegerType::UAInt64))
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDINTEGERNODETYPE);
+
+	return addMonitoredItem(nSubscriptionID, nNameSpace, sNodeName, eOPCClientValueType::Integer, eNodeType, eUADoubleType::Unknown, dSamplingIntervalInMS, dDeadband);
+}
 
-	default:
+LibOpen62541_uint32 COPCClient::AddDoubleMonitoredItem(const LibOpen62541_uint32 nSubscriptionID, const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUADoubleType eNodeType, const LibOpen62541_double dSamplingIntervalInMS, const LibOpen62541_double dDeadband)
+{
+	if ((eNodeType != eUADoubleType::UAFloat32) && (eNodeType != eUADoubleType::UADouble64))
 		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDFLOATNODETYPE);
-	}
 
-	UA_WriteRequest wReq;
-	UA_WriteRequest_init(&wReq);
-	wReq.nodesToWrite = UA_WriteValue_new();
-	wReq.nodesToWriteSize = 1;
-	wReq.nodesToWrite[0].nodeId = UA_NODEID_STRING_ALLOC(nNameSpace, sNodeName.c_str());
-	wReq.nodesToWrite[0].attributeId = UA_ATTRIBUTEID_VALUE;
-	wReq.nodesToWrite[0].value.hasValue = true;
-	wReq.nodesToWrite[0].value.value.storageType = UA_VARIANT_DATA_NODELETE; /* do not free the float on deletion */
+	return addMonitoredItem(nSubscriptionID, nNameSpace, sNodeName, eOPCClientValueType::Double, eUAIntegerType::Unknown, eNodeType, dSamplingIntervalInMS, dDeadband);
+}
 
-	wReq.nodesToWrite[0].value.value.type = pDataType;
-	wReq.nodesToWrite[0].value.value.data = writeDataBuffer.data();
+LibOpen62541_uint32 COPCClient::AddStringMonitoredItem(const LibOpen62541_uint32 nSubscriptionID, const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541_double dSamplingIntervalInMS)
+{
+	return addMonitoredItem(nSubscriptionID, nNameSpace, sNodeName, eOPCClientValueType::String, eUAIntegerType::Unknown, eUADoubleType::Unknown, dSamplingIntervalInMS, 0.0);
+}
 
-	UA_WriteResponse wResp = UA_Client_Service_write(m_Client, wReq);
+LibOpen62541_uint32 COPCClient::ProcessSubscriptions(const LibOpen62541_uint32 nTimeOutInMS)
+{
+	ensureConnection();
 
-	auto serviceResult = wResp.responseHeader.serviceResult;
-	UA_WriteRequest_clear(&wReq);
-	UA_WriteResponse_clear(&wResp);
+	// Dispatches the received publish responses to onDataChange and sends new publish requests.
+	UA_StatusCode statusCode = UA_Client_run_iterate(m_Client, nTimeOutInMS);
+	if (statusCode != UA_STATUSCODE_GOOD)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTPROCESSSUBSCRIPTIONS, "could not process OPCUA subscriptions (" + std::to_string(statusCode) + ")");
 
-	if (serviceResult != UA_STATUSCODE_GOOD)
-		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTWRITEVALUE, "could not write value to " + sNodeName);
+	return (uint32_t)m_ChangedMonitoredItems.size();
 }
 
-void COPCClient::WriteString(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const std::string & sValue)
+bool COPCClient::PopChangedMonitoredItem(LibOpen62541_uint32 & nMonitoredItemID)
 {
+	while (!m_ChangedMonitoredItems.empty()) {
+		uint32_t nChangedItemID = m_ChangedMonitoredItems.front();
+		m_ChangedMonitoredItems.pop_front();
+
+		// Items of deleted subscriptions might still be queued.
+		auto iIter = m_MonitoredItems.find(nChangedItemID);
+		if (iIter != m_MonitoredItems.end()) {
+			iIter->second->clearQueued();
+			nMonitoredItemID = nChangedItemID;
+			return true;
+		}
+	}
 
-	if (m_Client == nullptr)
-		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_NOTCONNECTED, "OPCUA client is not connected");
+	nMonitoredItemID = 0;
+	return false;
+}
 
-	UA_String stringValue = UA_String_fromChars(sValue.c_str());
+COPCClientMonitoredItem* COPCClient::findMonitoredItem(const LibOpen62541_uint32 nMonitoredItemID, eOPCClientValueType valueType)
+{
+	auto iIter = m_MonitoredItems.find(nMonitoredItemID);
+	if (iIter == m_MonitoredItems.end())
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_MONITOREDITEMNOTFOUND, "monitored item not found: " + std::to_string(nMonitoredItemID));
 
-	UA_WriteRequest wReq;
-	UA_WriteRequest_init(&wReq);
-	wReq.nodesToWrite = UA_WriteValue_new();
-	wReq.nodesToWriteSize = 1;
-	wReq.nodesToWrite[0].nodeId = UA_NODEID_STRING_ALLOC(nNameSpace, sNodeName.c_str());
-	wReq.nodesToWrite[0].attributeId = UA_ATTRIBUTEID_VALUE;
-	wReq.nodesToWrite[0].value.hasValue = true;
-	
-	UA_Variant_setScalar(&wReq.nodesToWrite[0].value.value, &stringValue, &UA_TYPES[UA_TYPES_STRING]);
+	COPCClientMonitoredItem* pItem = iIter->second.get();
+	if (pItem->getValueType() != valueType)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_READVALUEISOFINCORRECTTYPE, "monitored item " + pItem->getNodeName() + " has been added with a different type");
 
-	UA_WriteResponse wResp = UA_Client_Service_write(m_Client, wReq);
+	if (!pItem->hasValue())
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_MONITOREDITEMHASNOVALUE, "monitored item has not received a value: " + pItem->getNodeName());
 
-	auto serviceResult = wResp.responseHeader.serviceResult;
-	UA_WriteRequest_clear(&wReq);
-	UA_WriteResponse_clear(&wResp);
+	return pItem;
+}
 
-	if (serviceResult != UA_STATUSCODE_GOOD)
-		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTWRITEVALUE, "could not write value to " + sNodeName);
+LibOpen62541_int64 COPCClient::GetMonitoredItemInteger(const LibOpen62541_uint32 nMonitoredItemID)
+{
+	COPCClientMonitoredItem* pItem = findMonitoredItem(nMonitoredItemID, eOPCClientValueType::Integer);
+	return pItem->getIntegerValue(pItem->getValue());
+}
 
+LibOpen62541_double COPCClient::GetMonitoredItemDouble(const LibOpen62541_uint32 nMonitoredItemID)
+{
+	COPCClientMonitoredItem* pItem = findMonitoredItem(nMonitoredItemID, eOPCClientValueType::Double);
+	return pItem->getDoubleValue(pItem->getValue());
 }
 
+std::string COPCClient::GetMonitoredItemString(const LibOpen62541_uint32 nMonitoredItemID)
+{
+	COPCClientMonitoredItem* pItem = findMonitoredItem(nMonitoredItemID, eOPCClientValueType::String);
+	return pItem->getStringValue(pItem->getValue());
+}
@@ -49,6 +49,12 @@ Abstract: This is the class declaration of COPCClient
 #include <open62541/client_highlevel.h>
 #include <open62541/plugin/log_stdout.h>
 #include <open62541/plugin/securitypolicy.h>
+#include <open62541/client_subscriptions.h>
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <memory>
 
 namespace LibOpen62541 {
 namespace Impl {
@@ -58,6 +64,57 @@ namespace Impl {
  Class declaration of COPCClient 
 **************************************************************************************************************************/
 
+enum class eOPCClientValueType : int32_t {
+	Unknown = 0,
+	Integer = 1,
+	Double = 2,
+	String = 3
+};
+
+class COPCClientNodeEntry {
+private:
+	std::string m_sNodeName;
+	eOPCClientValueType m_ValueType;
+	LibOpen62541::eUAIntegerType m_IntegerType;
+	LibOpen62541::eUADoubleType m_DoubleType;
+
+public:
+	COPCClientNodeEntry(const std::string& sNodeName, eOPCClientValueType valueType, LibOpen62541::eUAIntegerType integerType, LibOpen62541::eUADoubleType doubleType);
+
+	const std::string& getNodeName() const;
+	eOPCClientValueType getValueType() const;
+	LibOpen62541::eUAIntegerType getIntegerType() const;
+	LibOpen62541::eUADoubleType getDoubleType() const;
+
+	LibOpen62541_int64 getIntegerValue(const UA_Variant* pVariant) const;
+	LibOpen62541_double getDoubleValue(const UA_Variant* pVariant) const;
+	std::string getStringValue(const UA_Variant* pVariant) const;
+};
+
+// Stores the last value the server has published for a monitored item.
+class COPCClientMonitoredItem : public COPCClientNodeEntry {
+private:
+	uint32_t m_nMonitoredItemID;
+	uint32_t m_nSubscriptionID;
+	UA_Variant m_Value;
+	bool m_bHasValue;
+	bool m_bIsQueued;
+
+public:
+	COPCClientMonitoredItem(uint32_t nMonitoredItemID, uint32_t nSubscriptionID, const std::string& sNodeName, eOPCClientValueType valueType, LibOpen62541::eUAIntegerType integerType, LibOpen62541::eUADoubleType doubleType);
+	~COPCClientMonitoredItem();
+
+	uint32_t getMonitoredItemID() const;
+	uint32_t getSubscriptionID() const;
+
+	// Returns true if the item needs to be queued as changed.
+	bool updateValue(const UA_Variant* pValue);
+	void clearQueued();
+
+	bool hasValue() const;
+	const UA_Variant* getValue() const;
+};
+
 class COPCClient : public virtual IOPCClient, public virtual CBase {
 private:
 
@@ -67,6 +124,39 @@ private:
 	std::string m_sPrivateKey;
 	LibOpen62541::eUASecurityMode m_SecurityMode;
 
+	// Read batch. The node ids are built once and reused for every execution.
+	std::vector<COPCClientNodeEntry> m_ReadBatchEntries;
+	std::vector<UA_ReadValueId> m_ReadBatchNodes;
+	UA_ReadResponse m_ReadBatchResponse;
+	bool m_bReadBatchExecuted;
+
+	std::vector<UA_WriteValue> m_WriteQueue;
+
+	std::map<uint32_t, std::unique_ptr<COPCClientMonitoredItem>> m_MonitoredItems;
+	std::deque<uint32_t> m_ChangedMonitoredItems;
+	uint32_t m_nMonitoredItemCounter;
+
+	static void onDataChange(UA_Client* pClient, UA_UInt32 nSubscriptionID, void* pSubscriptionContext, UA_UInt32 nMonitoredItemID, void* pMonitoredItemContext, UA_DataValue* pValue);
+
+	void ensureConnection();
+
+	uint32_t addBatchEntry(const LibOpen62541_uint32 nNameSpace, const std::string& sNodeName, const COPCClientNodeEntry& entry);
+
+	const UA_Variant* getBatchVariant(const LibOpen62541_uint32 nEntryIndex, eOPCClientValueType valueType);
+
+	// Takes ownership of the variant data.
+	void queueWrite(const LibOpen62541_uint32 nNameSpace, const std::string& sNodeName, UA_Variant* pValue);
+
+	void flushWriteValues(UA_WriteValue* pWriteValues, size_t nWriteValueCount);
+
+	uint32_t addMonitoredItem(const LibOpen62541_uint32 nSubscriptionID, const LibOpen62541_uint32 nNameSpace, const std::string& sNodeName, eOPCClientValueType valueType, LibOpen62541::eUAIntegerType integerType, LibOpen62541::eUADoubleType doubleType, const LibOpen62541_double dSamplingIntervalInMS, const LibOpen62541_double dDeadband);
+
+	COPCClientMonitoredItem* findMonitoredItem(const LibOpen62541_uint32 nMonitoredItemID, eOPCClientValueType valueType);
+
+	void clearReadBatchResponse();
+
+	void clearWriteQueue();
+
 public:
 
 	COPCClient();
@@ -95,6 +185,50 @@ public:
 
 	void WriteString(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const std::string & sValue) override;
 
+	void ClearReadBatch() override;
+
+	LibOpen62541_uint32 AddIntegerToReadBatch(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUAIntegerType eNodeType) override;
+
+	LibOpen62541_uint32 AddDoubleToReadBatch(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUADoubleType eNodeType) override;
+
+	LibOpen62541_uint32 AddStringToReadBatch(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName) override;
+
+	void ExecuteReadBatch() override;
+
+	LibOpen62541_int64 GetBatchInteger(const LibOpen62541_uint32 nEntryIndex) override;
+
+	LibOpen62541_double GetBatchDouble(const LibOpen62541_uint32 nEntryIndex) override;
+
+	std::string GetBatchString(const LibOpen62541_uint32 nEntryIndex) override;
+
+	void QueueIntegerWrite(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUAIntegerType eNodeType, const LibOpen62541_int64 nValue) override;
+
+	void QueueDoubleWrite(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUADoubleType eNodeType, const LibOpen62541_double dValue) override;
+
+	void QueueStringWrite(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const std::string & sValue) override;
+
+	void FlushWriteQueue() override;
+
+	LibOpen62541_uint32 CreateSubscription(const LibOpen62541_double dPublishingIntervalInMS) override;
+
+	void DeleteSubscription(const LibOpen62541_uint32 nSubscriptionID) override;
+
+	LibOpen62541_uint32 AddIntegerMonitoredItem(const LibOpen62541_uint32 nSubscriptionID, const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUAIntegerType eNodeType, const LibOpen62541_double dSamplingIntervalInMS, const LibOpen62541_double dDeadband) override;
+
+	LibOpen62541_uint32 AddDoubleMonitoredItem(const LibOpen62541_uint32 nSubscriptionID, const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUADoubleType eNodeType, const LibOpen62541_double dSamplingIntervalInMS, const LibOpen62541_double dDeadband) override;
+
+	LibOpen62541_uint32 AddStringMonitoredItem(const LibOpen62541_uint32 nSubscriptionID, const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541_double dSamplingIntervalInMS) override;
+
+	LibOpen62541_uint32 ProcessSubscriptions(const LibOpen62541_uint32 nTimeOutInMS) override;
+
+	bool PopChangedMonitoredItem(LibOpen62541_uint32 & nMonitoredItemID) override;
+
+	LibOpen62541_int64 GetMonitoredItemInteger(const LibOpen62541_uint32 nMonitoredItemID) override;
+
+	LibOpen62541_double GetMonitoredItemDouble(const LibOpen62541_uint32 nMonitoredItemID) override;
+
+	std::string GetMonitoredItemString(const LibOpen62541_uint32 nMonitoredItemID) override;
+
 };
 
 } // namespace Impl
@@ -0,0 +1,219 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class definition of COPCValueConversion
+
+*/
+
+
+#include "libopen62541_valueconversion.hpp"
+#include "libopen62541_interfaceexception.hpp"
+
+using namespace LibOpen62541::Impl;
+
+
+/*************************************************************************************************************************
+ Class definition of COPCValueConversion
+**************************************************************************************************************************/
+
+const UA_DataType* COPCValueConversion::getIntegerDataType(const LibOpen62541::eUAIntegerType eNodeType)
+{
+	switch (eNodeType) {
+		case LibOpen62541::eUAIntegerType::UAUInt8: return &UA_TYPES[UA_TYPES_BYTE];
+		case LibOpen62541::eUAIntegerType::UAUInt16: return &UA_TYPES[UA_TYPES_UINT16];
+		case LibOpen62541::eUAIntegerType::UAUInt32: return &UA_TYPES[UA_TYPES_UINT32];
+		case LibOpen62541::eUAIntegerType::UAUInt64: return &UA_TYPES[UA_TYPES_UINT64];
+		case LibOpen62541::eUAIntegerType::UAInt8: return &UA_TYPES[UA_TYPES_SBYTE];
+		case LibOpen62541::eUAIntegerType::UAInt16: return &UA_TYPES[UA_TYPES_INT16];
+		case LibOpen62541::eUAIntegerType::UAInt32: return &UA_TYPES[UA_TYPES_INT32];
+		case LibOpen62541::eUAIntegerType::UAInt64: return &UA_TYPES[UA_TYPES_INT64];
+		default:
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDINTEGERNODETYPE);
+	}
+}
+
+const UA_DataType* COPCValueConversion::getDoubleDataType(const LibOpen62541::eUADoubleType eNodeType)
+{
+	switch (eNodeType) {
+		case LibOpen62541::eUADoubleType::UAFloat32: return &UA_TYPES[UA_TYPES_FLOAT];
+		case LibOpen62541::eUADoubleType::UADouble64: return &UA_TYPES[UA_TYPES_DOUBLE];
+		default:
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDFLOATNODETYPE);
+	}
+}
+
+std::string COPCValueConversion::getIntegerTypeName(const LibOpen62541::eUAIntegerType eNodeType)
+{
+	switch (eNodeType) {
+		case LibOpen62541::eUAIntegerType::UAUInt8: return "Uint8";
+		case LibOpen62541::eUAIntegerType::UAUInt16: return "Uint16";
+		case LibOpen62541::eUAIntegerType::UAUInt32: return "Uint32";
+		case LibOpen62541::eUAIntegerType::UAUInt64: return "Uint64";
+		case LibOpen62541::eUAIntegerType::UAInt8: return "Int8";
+		case LibOpen62541::eUAIntegerType::UAInt16: return "Int16";
+		case LibOpen62541::eUAIntegerType::UAInt32: return "Int32";
+		case LibOpen62541::eUAIntegerType::UAInt64: return "Int64";
+		default:
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDINTEGERNODETYPE);
+	}
+}
+
+std::string COPCValueConversion::getDoubleTypeName(const LibOpen62541::eUADoubleType eNodeType)
+{
+	switch (eNodeType) {
+		case LibOpen62541::eUADoubleType::UAFloat32: return "Float";
+		case LibOpen62541::eUADoubleType::UADouble64: return "Double";
+		default:
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDFLOATNODETYPE);
+	}
+}
+
+void COPCValueConversion::checkIntegerBounds(const LibOpen62541::eUAIntegerType eNodeType, const LibOpen62541_int64 nValue)
+{
+	bool bIsInBounds;
+
+	switch (eNodeType) {
+		case LibOpen62541::eUAIntegerType::UAUInt8: bIsInBounds = (nValue >= 0) && (nValue <= UINT8_MAX); break;
+		case LibOpen62541::eUAIntegerType::UAUInt16: bIsInBounds = (nValue >= 0) && (nValue <= UINT16_MAX); break;
+		case LibOpen62541::eUAIntegerType::UAUInt32: bIsInBounds = (nValue >= 0) && (nValue <= (LibOpen62541_int64)UINT32_MAX); break;
+		case LibOpen62541::eUAIntegerType::UAUInt64: bIsInBounds = (nValue >= 0); break;
+		case LibOpen62541::eUAIntegerType::UAInt8: bIsInBounds = (nValue >= INT8_MIN) && (nValue <= INT8_MAX); break;
+		case LibOpen62541::eUAIntegerType::UAInt16: bIsInBounds = (nValue >= INT16_MIN) && (nValue <= INT16_MAX); break;
+		case LibOpen62541::eUAIntegerType::UAInt32: bIsInBounds = (nValue >= INT32_MIN) && (nValue <= INT32_MAX); break;
+		case LibOpen62541::eUAIntegerType::UAInt64: bIsInBounds = true; break;
+		default:
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDINTEGERNODETYPE);
+	}
+
+	if (!bIsInBounds)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAWRITEINTEGEROUTOFBOUNDS, "OPCUA write integer out of bounds: " + std::to_string(nValue));
+}
+
+void COPCValueConversion::integerToVariant(UA_Variant* pVariant, const LibOpen62541::eUAIntegerType eNodeType, const LibOpen62541_int64 nValue)
+{
+	checkIntegerBounds(eNodeType, nValue);
+	const UA_DataType* pDataType = getIntegerDataType(eNodeType);
+
+	UA_StatusCode statusCode;
+	switch (eNodeType) {
+		case LibOpen62541::eUAIntegerType::UAUInt8: { UA_Byte typedValue = (UA_Byte)nValue; statusCode = UA_Variant_setScalarCopy(pVariant, &typedValue, pDataType); break; }
+		case LibOpen62541::eUAIntegerType::UAUInt16: { UA_UInt16 typedValue = (UA_UInt16)nValue; statusCode = UA_Variant_setScalarCopy(pVariant, &typedValue, pDataType); break; }
+		case LibOpen62541::eUAIntegerType::UAUInt32: { UA_UInt32 typedValue = (UA_UInt32)nValue; statusCode = UA_Variant_setScalarCopy(pVariant, &typedValue, pDataType); break; }
+		case LibOpen62541::eUAIntegerType::UAUInt64: { UA_UInt64 typedValue = (UA_UInt64)nValue; statusCode = UA_Variant_setScalarCopy(pVariant, &typedValue, pDataType); break; }
+		case LibOpen62541::eUAIntegerType::UAInt8: { UA_SByte typedValue = (UA_SByte)nValue; statusCode = UA_Variant_setScalarCopy(pVariant, &typedValue, pDataType); break; }
+		case LibOpen62541::eUAIntegerType::UAInt16: { UA_Int16 typedValue = (UA_Int16)nValue; statusCode = UA_Variant_setScalarCopy(pVariant, &typedValue, pDataType); break; }
+		case LibOpen62541::eUAIntegerType::UAInt32: { UA_Int32 typedValue = (UA_Int32)nValue; statusCode = UA_Variant_setScalarCopy(pVariant, &typedValue, pDataType); break; }
+		default: { UA_Int64 typedValue = (UA_Int64)nValue; statusCode = UA_Variant_setScalarCopy(pVariant, &typedValue, pDataType); break; }
+	}
+
+	if (statusCode != UA_STATUSCODE_GOOD)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTWRITEVALUE, "could not create OPCUA variant (" + std::to_string(statusCode) + ")");
+}
+
+void COPCValueConversion::doubleToVariant(UA_Variant* pVariant, const LibOpen62541::eUADoubleType eNodeType, const LibOpen62541_double dValue)
+{
+	const UA_DataType* pDataType = getDoubleDataType(eNodeType);
+
+	UA_StatusCode statusCode;
+	if (eNodeType == LibOpen62541::eUADoubleType::UAFloat32) {
+		UA_Float typedValue = (UA_Float)dValue;
+		statusCode = UA_Variant_setScalarCopy(pVariant, &typedValue, pDataType);
+	}
+	else {
+		UA_Double typedValue = (UA_Double)dValue;
+		statusCode = UA_Variant_setScalarCopy(pVariant, &typedValue, pDataType);
+	}
+
+	if (statusCode != UA_STATUSCODE_GOOD)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTWRITEVALUE, "could not create OPCUA variant (" + std::to_string(statusCode) + ")");
+}
+
+void COPCValueConversion::stringToVariant(UA_Variant* pVariant, const std::string& sValue)
+{
+	UA_String stringValue;
+	stringValue.length = sValue.length();
+	stringValue.data = (UA_Byte*)sValue.data();
+
+	UA_StatusCode statusCode = UA_Variant_setScalarCopy(pVariant, &stringValue, &UA_TYPES[UA_TYPES_STRING]);
+	if (statusCode != UA_STATUSCODE_GOOD)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_COULDNOTWRITEVALUE, "could not create OPCUA variant (" + std::to_string(statusCode) + ")");
+}
+
+LibOpen62541_int64 COPCValueConversion::variantToInteger(const UA_Variant* pVariant, const LibOpen62541::eUAIntegerType eNodeType, const std::string& sNodeName)
+{
+	if (!UA_Variant_hasScalarType(pVariant, getIntegerDataType(eNodeType)))
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_READVALUEISOFINCORRECTTYPE, "read value is of incorrect type. " + sNodeName + " was supposed to be " + getIntegerTypeName(eNodeType));
+
+	if (pVariant->data == nullptr)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAVARIANTDATAISNULL, "OPCUA variant data is null for " + sNodeName);
+
+	switch (eNodeType) {
+		case LibOpen62541::eUAIntegerType::UAUInt8: return *(UA_Byte*)pVariant->data;
+		case LibOpen62541::eUAIntegerType::UAUInt16: return *(UA_UInt16*)pVariant->data;
+		case LibOpen62541::eUAIntegerType::UAUInt32: return *(UA_UInt32*)pVariant->data;
+		case LibOpen62541::eUAIntegerType::UAUInt64: return (LibOpen62541_int64) *(UA_UInt64*)pVariant->data;
+		case LibOpen62541::eUAIntegerType::UAInt8: return *(UA_SByte*)pVariant->data;
+		case LibOpen62541::eUAIntegerType::UAInt16: return *(UA_Int16*)pVariant->data;
+		case LibOpen62541::eUAIntegerType::UAInt32: return *(UA_Int32*)pVariant->data;
+		default: return *(UA_Int64*)pVariant->data;
+	}
+}
+
+LibOpen62541_double COPCValueConversion::variantToDouble(const UA_Variant* pVariant, const LibOpen62541::eUADoubleType eNodeType, const std::string& sNodeName)
+{
+	if (!UA_Variant_hasScalarType(pVariant, getDoubleDataType(eNodeType)))
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_READVALUEISOFINCORRECTTYPE, "read value is of incorrect type. " + sNodeName + " was supposed to be " + getDoubleTypeName(eNodeType));
+
+	if (pVariant->data == nullptr)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAVARIANTDATAISNULL, "OPCUA variant data is null for " + sNodeName);
+
+	if (eNodeType == LibOpen62541::eUADoubleType::UAFloat32)
+		return *(UA_Float*)pVariant->data;
+
+	return *(UA_Double*)pVariant->data;
+}
+
+std::string COPCValueConversion::variantToString(const UA_Variant* pVariant, const std::string& sNodeName)
+{
+	if (!UA_Variant_hasScalarType(pVariant, &UA_TYPES[UA_TYPES_STRING]))
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_READVALUEISOFINCORRECTTYPE, "read value is of incorrect type. " + sNodeName + " was supposed to be String");
+
+	UA_String* pTypedValue = (UA_String*)pVariant->data;
+	if (pTypedValue == nullptr)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUAVARIANTDATAISNULL, "OPCUA variant data is null for " + sNodeName);
+
+	if (pTypedValue->length == 0)
+		return "";
+
+	const char* pDataChar = (const char*)pTypedValue->data;
+	if (pDataChar == nullptr)
+		throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_OPCUASTRINGDATAISNULL, "OPCUA String data is null: " + sNodeName);
+
+	return std::string(pDataChar, pDataChar + pTypedValue->length);
+}
@@ -0,0 +1,78 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: Conversion between typed OPC UA scalar variants and the integer, double and string values of the interface
+
+*/
+
+
+#ifndef __LIBOPEN62541_VALUECONVERSION
+#define __LIBOPEN62541_VALUECONVERSION
+
+#include "libopen62541_types.hpp"
+
+#include <open62541/types.h>
+
+#include <string>
+
+namespace LibOpen62541 {
+namespace Impl {
+
+
+/*************************************************************************************************************************
+ Class declaration of COPCValueConversion
+**************************************************************************************************************************/
+
+// Single and batched node access as well as subscriptions share these, so that every path encodes and checks the same types.
+class COPCValueConversion {
+public:
+
+	static const UA_DataType* getIntegerDataType(const LibOpen62541::eUAIntegerType eNodeType);
+	static const UA_DataType* getDoubleDataType(const LibOpen62541::eUADoubleType eNodeType);
+
+	static std::string getIntegerTypeName(const LibOpen62541::eUAIntegerType eNodeType);
+	static std::string getDoubleTypeName(const LibOpen62541::eUADoubleType eNodeType);
+
+	// Throws if the value can not be represented by the node type.
+	static void checkIntegerBounds(const LibOpen62541::eUAIntegerType eNodeType, const LibOpen62541_int64 nValue);
+
+	static void integerToVariant(UA_Variant* pVariant, const LibOpen62541::eUAIntegerType eNodeType, const LibOpen62541_int64 nValue);
+	static void doubleToVariant(UA_Variant* pVariant, const LibOpen62541::eUADoubleType eNodeType, const LibOpen62541_double dValue);
+	static void stringToVariant(UA_Variant* pVariant, const std::string& sValue);
+
+	static LibOpen62541_int64 variantToInteger(const UA_Variant* pVariant, const LibOpen62541::eUAIntegerType eNodeType, const std::string& sNodeName);
+	static LibOpen62541_double variantToDouble(const UA_Variant* pVariant, const LibOpen62541::eUADoubleType eNodeType, const std::string& sNodeName);
+	static std::string variantToString(const UA_Variant* pVariant, const std::string& sNodeName);
+
+};
+
+} // namespace Impl
+} // namespace LibOpen62541
+
+#endif // __LIBOPEN62541_VALUECONVERSION
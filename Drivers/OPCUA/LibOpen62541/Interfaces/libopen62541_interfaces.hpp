@@ -327,6 +327,176 @@ public:
 	*/
 	virtual void WriteString(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const std::string & sValue) = 0;
 
+	/**
+	* IOPCClient::ClearReadBatch - Removes all entries from the read batch.
+	*/
+	virtual void ClearReadBatch() = 0;
+
+	/**
+	* IOPCClient::AddIntegerToReadBatch - Adds an integer node to the read batch.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to read
+	* @param[in] eNodeType - Type of Node to read
+	* @return Index of the new batch entry.
+	*/
+	virtual LibOpen62541_uint32 AddIntegerToReadBatch(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUAIntegerType eNodeType) = 0;
+
+	/**
+	* IOPCClient::AddDoubleToReadBatch - Adds a double node to the read batch.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to read
+	* @param[in] eNodeType - Type of Node to read
+	* @return Index of the new batch entry.
+	*/
+	virtual LibOpen62541_uint32 AddDoubleToReadBatch(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUADoubleType eNodeType) = 0;
+
+	/**
+	* IOPCClient::AddStringToReadBatch - Adds a string node to the read batch.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to read
+	* @return Index of the new batch entry.
+	*/
+	virtual LibOpen62541_uint32 AddStringToReadBatch(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName) = 0;
+
+	/**
+	* IOPCClient::ExecuteReadBatch - Reads all nodes of the read batch with a single read request. The batch stays in place and can be executed again. Fails if not connected or any node could not be read.
+	*/
+	virtual void ExecuteReadBatch() = 0;
+
+	/**
+	* IOPCClient::GetBatchInteger - Returns an integer value of the last executed read batch.
+	* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+	* @return Retrieved Node Value
+	*/
+	virtual LibOpen62541_int64 GetBatchInteger(const LibOpen62541_uint32 nEntryIndex) = 0;
+
+	/**
+	* IOPCClient::GetBatchDouble - Returns a double value of the last executed read batch.
+	* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+	* @return Retrieved Node Value
+	*/
+	virtual LibOpen62541_double GetBatchDouble(const LibOpen62541_uint32 nEntryIndex) = 0;
+
+	/**
+	* IOPCClient::GetBatchString - Returns a string value of the last executed read batch.
+	* @param[in] nEntryIndex - Index of the batch entry, as returned by the Add call.
+	* @return Retrieved String Value
+	*/
+	virtual std::string GetBatchString(const LibOpen62541_uint32 nEntryIndex) = 0;
+
+	/**
+	* IOPCClient::QueueIntegerWrite - Queues an integer node value for the next FlushWriteQueue call.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to write
+	* @param[in] eNodeType - Type of Node to write
+	* @param[in] nValue - Node Value to write
+	*/
+	virtual void QueueIntegerWrite(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUAIntegerType eNodeType, const LibOpen62541_int64 nValue) = 0;
+
+	/**
+	* IOPCClient::QueueDoubleWrite - Queues a double node value for the next FlushWriteQueue call.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to write
+	* @param[in] eNodeType - Type of Node to write
+	* @param[in] dValue - Node Value to write
+	*/
+	virtual void QueueDoubleWrite(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUADoubleType eNodeType, const LibOpen62541_double dValue) = 0;
+
+	/**
+	* IOPCClient::QueueStringWrite - Queues a string node value for the next FlushWriteQueue call.
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to write
+	* @param[in] sValue - Node Value to write
+	*/
+	virtual void QueueStringWrite(const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const std::string & sValue) = 0;
+
+	/**
+	* IOPCClient::FlushWriteQueue - Writes all queued values with a single write request and empties the queue. Fails if not connected or any value could not be written.
+	*/
+	virtual void FlushWriteQueue() = 0;
+
+	/**
+	* IOPCClient::CreateSubscription - Creates a subscription on the server. Fails if not connected.
+	* @param[in] dPublishingIntervalInMS - Publishing interval in milliseconds.
+	* @return ID of the new subscription.
+	*/
+	virtual LibOpen62541_uint32 CreateSubscription(const LibOpen62541_double dPublishingIntervalInMS) = 0;
+
+	/**
+	* IOPCClient::DeleteSubscription - Deletes a subscription and all its monitored items.
+	* @param[in] nSubscriptionID - Subscription ID
+	*/
+	virtual void DeleteSubscription(const LibOpen62541_uint32 nSubscriptionID) = 0;
+
+	/**
+	* IOPCClient::AddIntegerMonitoredItem - Monitors an integer node value within a subscription.
+	* @param[in] nSubscriptionID - Subscription ID
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to monitor
+	* @param[in] eNodeType - Type of Node to monitor
+	* @param[in] dSamplingIntervalInMS - Sampling interval of the server in milliseconds.
+	* @param[in] dDeadband - Absolute deadband. Changes smaller than this value are not reported. 0 reports every change.
+	* @return ID of the new monitored item.
+	*/
+	virtual LibOpen62541_uint32 AddIntegerMonitoredItem(const LibOpen62541_uint32 nSubscriptionID, const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUAIntegerType eNodeType, const LibOpen62541_double dSamplingIntervalInMS, const LibOpen62541_double dDeadband) = 0;
+
+	/**
+	* IOPCClient::AddDoubleMonitoredItem - Monitors a double node value within a subscription.
+	* @param[in] nSubscriptionID - Subscription ID
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to monitor
+	* @param[in] eNodeType - Type of Node to monitor
+	* @param[in] dSamplingIntervalInMS - Sampling interval of the server in milliseconds.
+	* @param[in] dDeadband - Absolute deadband. Changes smaller than this value are not reported. 0 reports every change.
+	* @return ID of the new monitored item.
+	*/
+	virtual LibOpen62541_uint32 AddDoubleMonitoredItem(const LibOpen62541_uint32 nSubscriptionID, const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541::eUADoubleType eNodeType, const LibOpen62541_double dSamplingIntervalInMS, const LibOpen62541_double dDeadband) = 0;
+
+	/**
+	* IOPCClient::AddStringMonitoredItem - Monitors a string node value within a subscription.
+	* @param[in] nSubscriptionID - Subscription ID
+	* @param[in] nNameSpace - Namespace ID
+	* @param[in] sNodeName - Node to monitor
+	* @param[in] dSamplingIntervalInMS - Sampling interval of the server in milliseconds.
+	* @return ID of the new monitored item.
+	*/
+	virtual LibOpen62541_uint32 AddStringMonitoredItem(const LibOpen62541_uint32 nSubscriptionID, const LibOpen62541_uint32 nNameSpace, const std::string & sNodeName, const LibOpen62541_double dSamplingIntervalInMS) = 0;
+
+	/**
+	* IOPCClient::ProcessSubscriptions - Processes incoming notifications of all subscriptions and keeps the publish requests going. Fails if not connected.
+	* @param[in] nTimeOutInMS - Maximum time to wait for notifications in milliseconds. 0 processes only what has already arrived.
+	* @return Number of changed monitored items that have not been popped yet.
+	*/
+	virtual LibOpen62541_uint32 ProcessSubscriptions(const LibOpen62541_uint32 nTimeOutInMS) = 0;
+
+	/**
+	* IOPCClient::PopChangedMonitoredItem - Returns the next monitored item that has changed since it was last popped.
+	* @param[out] nMonitoredItemID - ID of the changed monitored item.
+	* @return Returns false if no monitored item has changed.
+	*/
+	virtual bool PopChangedMonitoredItem(LibOpen62541_uint32 & nMonitoredItemID) = 0;
+
+	/**
+	* IOPCClient::GetMonitoredItemInteger - Returns the last reported value of an integer monitored item.
+	* @param[in] nMonitoredItemID - Monitored item ID
+	* @return Last reported Node Value
+	*/
+	virtual LibOpen62541_int64 GetMonitoredItemInteger(const LibOpen62541_uint32 nMonitoredItemID) = 0;
+
+	/**
+	* IOPCClient::GetMonitoredItemDouble - Returns the last reported value of a double monitored item.
+	* @param[in] nMonitoredItemID - Monitored item ID
+	* @return Last reported Node Value
+	*/
+	virtual LibOpen62541_double GetMonitoredItemDouble(const LibOpen62541_uint32 nMonitoredItemID) = 0;
+
+	/**
+	* IOPCClient::GetMonitoredItemString - Returns the last reported value of a string monitored item.
+	* @param[in] nMonitoredItemID - Monitored item ID
+	* @return Last reported String Value
+	*/
+	virtual std::string GetMonitoredItemString(const LibOpen62541_uint32 nMonitoredItemID) = 0;
+
 };
 
 typedef IBaseSharedPtr<IOPCClient> PIOPCClient;
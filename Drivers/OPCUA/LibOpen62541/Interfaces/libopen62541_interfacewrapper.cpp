@@ -535,6 +535,640 @@ LibOpen62541Result libopen62541_opcclient_writestring(LibOpen62541_OPCClient pOP
 	}
 }
 
+LibOpen62541Result libopen62541_opcclient_clearreadbatch(LibOpen62541_OPCClient pOPCClient)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		pIOPCClient->ClearReadBatch();
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_addintegertoreadbatch(LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nNameSpace, const char * pNodeName, eLibOpen62541UAIntegerType eNodeType, LibOpen62541_uint32 * pEntryIndex)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		if (pNodeName == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		if (pEntryIndex == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		std::string sNodeName(pNodeName);
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		*pEntryIndex = pIOPCClient->AddIntegerToReadBatch(nNameSpace, sNodeName, eNodeType);
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_adddoubletoreadbatch(LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nNameSpace, const char * pNodeName, eLibOpen62541UADoubleType eNodeType, LibOpen62541_uint32 * pEntryIndex)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		if (pNodeName == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		if (pEntryIndex == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		std::string sNodeName(pNodeName);
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		*pEntryIndex = pIOPCClient->AddDoubleToReadBatch(nNameSpace, sNodeName, eNodeType);
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_addstringtoreadbatch(LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nNameSpace, const char * pNodeName, LibOpen62541_uint32 * pEntryIndex)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		if (pNodeName == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		if (pEntryIndex == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		std::string sNodeName(pNodeName);
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		*pEntryIndex = pIOPCClient->AddStringToReadBatch(nNameSpace, sNodeName);
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_executereadbatch(LibOpen62541_OPCClient pOPCClient)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		pIOPCClient->ExecuteReadBatch();
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_getbatchinteger(LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nEntryIndex, LibOpen62541_int64 * pValue)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		if (pValue == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		*pValue = pIOPCClient->GetBatchInteger(nEntryIndex);
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_getbatchdouble(LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nEntryIndex, LibOpen62541_double * pValue)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		if (pValue == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		*pValue = pIOPCClient->GetBatchDouble(nEntryIndex);
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_getbatchstring(LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nEntryIndex, const LibOpen62541_uint32 nValueBufferSize, LibOpen62541_uint32* pValueNeededChars, char * pValueBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		if ( (!pValueBuffer) && !(pValueNeededChars) )
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		std::string sValue("");
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pValueBuffer == nullptr);
+		if (isCacheCall) {
+			sValue = pIOPCClient->GetBatchString(nEntryIndex);
+
+			pIOPCClient->_setCache (new ParameterCache_1<std::string> (sValue));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIOPCClient->_getCache ());
+			if (cache == nullptr)
+				throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+			cache->retrieveData (sValue);
+			pIOPCClient->_setCache (nullptr);
+		}
+		
+		if (pValueNeededChars)
+			*pValueNeededChars = (LibOpen62541_uint32) (sValue.size()+1);
+		if (pValueBuffer) {
+			if (sValue.size() >= nValueBufferSize)
+				throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_BUFFERTOOSMALL);
+			for (size_t iValue = 0; iValue < sValue.size(); iValue++)
+				pValueBuffer[iValue] = sValue[iValue];
+			pValueBuffer[sValue.size()] = 0;
+		}
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_queueintegerwrite(LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nNameSpace, const char * pNodeName, eLibOpen62541UAIntegerType eNodeType, LibOpen62541_int64 nValue)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		if (pNodeName == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		std::string sNodeName(pNodeName);
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		pIOPCClient->QueueIntegerWrite(nNameSpace, sNodeName, eNodeType, nValue);
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_queuedoublewrite(LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nNameSpace, const char * pNodeName, eLibOpen62541UADoubleType eNodeType, LibOpen62541_double dValue)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		if (pNodeName == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		std::string sNodeName(pNodeName);
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		pIOPCClient->QueueDoubleWrite(nNameSpace, sNodeName, eNodeType, dValue);
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_queuestringwrite(LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nNameSpace, const char * pNodeName, const char * pValue)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		if (pNodeName == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		if (pValue == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		std::string sNodeName(pNodeName);
+		std::string sValue(pValue);
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		pIOPCClient->QueueStringWrite(nNameSpace, sNodeName, sValue);
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_flushwritequeue(LibOpen62541_OPCClient pOPCClient)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		pIOPCClient->FlushWriteQueue();
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_createsubscription(LibOpen62541_OPCClient pOPCClient, LibOpen62541_double dPublishingIntervalInMS, LibOpen62541_uint32 * pSubscriptionID)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		if (pSubscriptionID == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		*pSubscriptionID = pIOPCClient->CreateSubscription(dPublishingIntervalInMS);
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_deletesubscription(LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nSubscriptionID)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		pIOPCClient->DeleteSubscription(nSubscriptionID);
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_addintegermonitoreditem(LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nSubscriptionID, LibOpen62541_uint32 nNameSpace, const char * pNodeName, eLibOpen62541UAIntegerType eNodeType, LibOpen62541_double dSamplingIntervalInMS, LibOpen62541_double dDeadband, LibOpen62541_uint32 * pMonitoredItemID)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		if (pNodeName == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		if (pMonitoredItemID == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		std::string sNodeName(pNodeName);
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		*pMonitoredItemID = pIOPCClient->AddIntegerMonitoredItem(nSubscriptionID, nNameSpace, sNodeName, eNodeType, dSamplingIntervalInMS, dDeadband);
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_adddoublemonitoreditem(LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nSubscriptionID, LibOpen62541_uint32 nNameSpace, const char * pNodeName, eLibOpen62541UADoubleType eNodeType, LibOpen62541_double dSamplingIntervalInMS, LibOpen62541_double dDeadband, LibOpen62541_uint32 * pMonitoredItemID)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		if (pNodeName == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		if (pMonitoredItemID == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		std::string sNodeName(pNodeName);
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		*pMonitoredItemID = pIOPCClient->AddDoubleMonitoredItem(nSubscriptionID, nNameSpace, sNodeName, eNodeType, dSamplingIntervalInMS, dDeadband);
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_addstringmonitoreditem(LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nSubscriptionID, LibOpen62541_uint32 nNameSpace, const char * pNodeName, LibOpen62541_double dSamplingIntervalInMS, LibOpen62541_uint32 * pMonitoredItemID)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		if (pNodeName == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		if (pMonitoredItemID == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		std::string sNodeName(pNodeName);
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		*pMonitoredItemID = pIOPCClient->AddStringMonitoredItem(nSubscriptionID, nNameSpace, sNodeName, dSamplingIntervalInMS);
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_processsubscriptions(LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nTimeOutInMS, LibOpen62541_uint32 * pChangeCount)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		if (pChangeCount == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		*pChangeCount = pIOPCClient->ProcessSubscriptions(nTimeOutInMS);
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_popchangedmonitoreditem(LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 * pMonitoredItemID, bool * pHasChanged)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		if (!pMonitoredItemID)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		if (pHasChanged == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		*pHasChanged = pIOPCClient->PopChangedMonitoredItem(*pMonitoredItemID);
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_getmonitorediteminteger(LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nMonitoredItemID, LibOpen62541_int64 * pValue)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		if (pValue == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		*pValue = pIOPCClient->GetMonitoredItemInteger(nMonitoredItemID);
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_getmonitoreditemdouble(LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nMonitoredItemID, LibOpen62541_double * pValue)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		if (pValue == nullptr)
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		*pValue = pIOPCClient->GetMonitoredItemDouble(nMonitoredItemID);
+
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibOpen62541Result libopen62541_opcclient_getmonitoreditemstring(LibOpen62541_OPCClient pOPCClient, LibOpen62541_uint32 nMonitoredItemID, const LibOpen62541_uint32 nValueBufferSize, LibOpen62541_uint32* pValueNeededChars, char * pValueBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pOPCClient;
+
+	try {
+		if ( (!pValueBuffer) && !(pValueNeededChars) )
+			throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_INVALIDPARAM);
+		std::string sValue("");
+		IOPCClient* pIOPCClient = dynamic_cast<IOPCClient*>(pIBaseClass);
+		if (!pIOPCClient)
+			throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pValueBuffer == nullptr);
+		if (isCacheCall) {
+			sValue = pIOPCClient->GetMonitoredItemString(nMonitoredItemID);
+
+			pIOPCClient->_setCache (new ParameterCache_1<std::string> (sValue));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIOPCClient->_getCache ());
+			if (cache == nullptr)
+				throw ELibOpen62541InterfaceException(LIBOPEN62541_ERROR_INVALIDCAST);
+			cache->retrieveData (sValue);
+			pIOPCClient->_setCache (nullptr);
+		}
+		
+		if (pValueNeededChars)
+			*pValueNeededChars = (LibOpen62541_uint32) (sValue.size()+1);
+		if (pValueBuffer) {
+			if (sValue.size() >= nValueBufferSize)
+				throw ELibOpen62541InterfaceException (LIBOPEN62541_ERROR_BUFFERTOOSMALL);
+			for (size_t iValue = 0; iValue < sValue.size(); iValue++)
+				pValueBuffer[iValue] = sValue[iValue];
+			pValueBuffer[sValue.size()] = 0;
+		}
+		return LIBOPEN62541_SUCCESS;
+	}
+	catch (ELibOpen62541InterfaceException & Exception) {
+		return handleLibOpen62541Exception(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 
 
 /*************************************************************************************************************************
@@ -572,6 +1206,50 @@ LibOpen62541Result LibOpen62541::Impl::LibOpen62541_GetProcAddress (const char *
 		*ppProcAddress = (void*) &libopen62541_opcclient_writedouble;
 	if (sProcName == "libopen62541_opcclient_writestring") 
 		*ppProcAddress = (void*) &libopen62541_opcclient_writestring;
+	if (sProcName == "libopen62541_opcclient_clearreadbatch") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_clearreadbatch;
+	if (sProcName == "libopen62541_opcclient_addintegertoreadbatch") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_addintegertoreadbatch;
+	if (sProcName == "libopen62541_opcclient_adddoubletoreadbatch") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_adddoubletoreadbatch;
+	if (sProcName == "libopen62541_opcclient_addstringtoreadbatch") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_addstringtoreadbatch;
+	if (sProcName == "libopen62541_opcclient_executereadbatch") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_executereadbatch;
+	if (sProcName == "libopen62541_opcclient_getbatchinteger") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_getbatchinteger;
+	if (sProcName == "libopen62541_opcclient_getbatchdouble") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_getbatchdouble;
+	if (sProcName == "libopen62541_opcclient_getbatchstring") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_getbatchstring;
+	if (sProcName == "libopen62541_opcclient_queueintegerwrite") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_queueintegerwrite;
+	if (sProcName == "libopen62541_opcclient_queuedoublewrite") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_queuedoublewrite;
+	if (sProcName == "libopen62541_opcclient_queuestringwrite") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_queuestringwrite;
+	if (sProcName == "libopen62541_opcclient_flushwritequeue") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_flushwritequeue;
+	if (sProcName == "libopen62541_opcclient_createsubscription") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_createsubscription;
+	if (sProcName == "libopen62541_opcclient_deletesubscription") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_deletesubscription;
+	if (sProcName == "libopen62541_opcclient_addintegermonitoreditem") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_addintegermonitoreditem;
+	if (sProcName == "libopen62541_opcclient_adddoublemonitoreditem") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_adddoublemonitoreditem;
+	if (sProcName == "libopen62541_opcclient_addstringmonitoreditem") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_addstringmonitoreditem;
+	if (sProcName == "libopen62541_opcclient_processsubscriptions") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_processsubscriptions;
+	if (sProcName == "libopen62541_opcclient_popchangedmonitoreditem") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_popchangedmonitoreditem;
+	if (sProcName == "libopen62541_opcclient_getmonitorediteminteger") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_getmonitorediteminteger;
+	if (sProcName == "libopen62541_opcclient_getmonitoreditemdouble") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_getmonitoreditemdouble;
+	if (sProcName == "libopen62541_opcclient_getmonitoreditemstring") 
+		*ppProcAddress = (void*) &libopen62541_opcclient_getmonitoreditemstring;
 	if (sProcName == "libopen62541_getversion") 
 		*ppProcAddress = (void*) &libopen62541_getversion;
 	if (sProcName == "libopen62541_getlasterror") 
@@ -558,6 +558,15 @@ typedef LibMCDriver_ScanLabResult (*PLibMCDriver_ScanLabRTCRecording_Backtransfo
 */
 typedef LibMCDriver_ScanLabResult (*PLibMCDriver_ScanLabRTCRecording_AddTargetPositionsToDataTablePtr) (LibMCDriver_ScanLab_RTCRecording pRTCRecording, LibMCEnv_DataTable pDataTable, const char * pColumnIdentifierX, const char * pColumnDescriptionX, const char * pColumnIdentifierY, const char * pColumnDescriptionY);
 
+/**
+* Streams full recording chunks into a compressed temporary file on a background thread, so that long recordings only keep a bounded number of chunks in memory. Must be called before any data has been recorded.
+*
+* @param[in] pRTCRecording - RTCRecording instance.
+* @param[in] nMaxChunksInMemory - Maximum number of full chunks that are queued for writing. Recording blocks if the writer falls behind. MUST be between 1 and 1024.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_ScanLabResult (*PLibMCDriver_ScanLabRTCRecording_EnableSpillToDiskPtr) (LibMCDriver_ScanLab_RTCRecording pRTCRecording, LibMCDriver_ScanLab_uint32 nMaxChunksInMemory);
+
 /*************************************************************************************************************************
  Class definition for GPIOSequence
 **************************************************************************************************************************/
@@ -3182,6 +3191,7 @@ typedef struct {
 	PLibMCDriver_ScanLabRTCRecording_AddBacktransformedZPositionsToDataTablePtr m_RTCRecording_AddBacktransformedZPositionsToDataTable;
 	PLibMCDriver_ScanLabRTCRecording_BacktransformRawZCoordinatePtr m_RTCRecording_BacktransformRawZCoordinate;
 	PLibMCDriver_ScanLabRTCRecording_AddTargetPositionsToDataTablePtr m_RTCRecording_AddTargetPositionsToDataTable;
+	PLibMCDriver_ScanLabRTCRecording_EnableSpillToDiskPtr m_RTCRecording_EnableSpillToDisk;
 	PLibMCDriver_ScanLabGPIOSequence_GetIdentifierPtr m_GPIOSequence_GetIdentifier;
 	PLibMCDriver_ScanLabGPIOSequence_ClearPtr m_GPIOSequence_Clear;
 	PLibMCDriver_ScanLabGPIOSequence_AddOutputPtr m_GPIOSequence_AddOutput;
@@ -373,6 +373,11 @@ public:
 			case LIBMCDRIVER_SCANLAB_ERROR_INVALIDLASERPOWERMAPPING: return "INVALIDLASERPOWERMAPPING";
 			case LIBMCDRIVER_SCANLAB_ERROR_COULDNOTCONVERTLASERPOWERTOWATTS: return "COULDNOTCONVERTLASERPOWERTOWATTS";
 			case LIBMCDRIVER_SCANLAB_ERROR_COULDNOTCONVERTLASERPOWERTOPERCENT: return "COULDNOTCONVERTLASERPOWERTOPERCENT";
+			case LIBMCDRIVER_SCANLAB_ERROR_COULDNOTWRITERECORDINGSPILLFILE: return "COULDNOTWRITERECORDINGSPILLFILE";
+			case LIBMCDRIVER_SCANLAB_ERROR_COULDNOTREADRECORDINGSPILLFILE: return "COULDNOTREADRECORDINGSPILLFILE";
+			case LIBMCDRIVER_SCANLAB_ERROR_INVALIDRECORDINGSPILLDATA: return "INVALIDRECORDINGSPILLDATA";
+			case LIBMCDRIVER_SCANLAB_ERROR_RECORDINGSPILLINGMUSTBEENABLEDBEFORERECORDING: return "RECORDINGSPILLINGMUSTBEENABLEDBEFORERECORDING";
+			case LIBMCDRIVER_SCANLAB_ERROR_INVALIDMAXCHUNKSINMEMORY: return "INVALIDMAXCHUNKSINMEMORY";
 		}
 		return "UNKNOWN";
 	}
@@ -548,6 +553,11 @@ public:
 			case LIBMCDRIVER_SCANLAB_ERROR_INVALIDLASERPOWERMAPPING: return "Invalid laser power mapping.";
 			case LIBMCDRIVER_SCANLAB_ERROR_COULDNOTCONVERTLASERPOWERTOWATTS: return "Could not convert laser power to watts.";
 			case LIBMCDRIVER_SCANLAB_ERROR_COULDNOTCONVERTLASERPOWERTOPERCENT: return "Could not convert laser power to percent.";
+			case LIBMCDRIVER_SCANLAB_ERROR_COULDNOTWRITERECORDINGSPILLFILE: return "Could not write recording spill file.";
+			case LIBMCDRIVER_SCANLAB_ERROR_COULDNOTREADRECORDINGSPILLFILE: return "Could not read recording spill file.";
+			case LIBMCDRIVER_SCANLAB_ERROR_INVALIDRECORDINGSPILLDATA: return "Invalid recording spill data.";
+			case LIBMCDRIVER_SCANLAB_ERROR_RECORDINGSPILLINGMUSTBEENABLEDBEFORERECORDING: return "Recording spilling must be enabled before recording.";
+			case LIBMCDRIVER_SCANLAB_ERROR_INVALIDMAXCHUNKSINMEMORY: return "Invalid maximum number of chunks in memory.";
 		}
 		return "unknown error";
 	}
@@ -851,6 +861,7 @@ public:
 	inline void AddBacktransformedZPositionsToDataTable(classParam<LibMCEnv::CDataTable> pDataTable, const std::string & sColumnIdentifierZ, const std::string & sColumnDescriptionZ);
 	inline LibMCDriver_ScanLab_double BacktransformRawZCoordinate(const LibMCDriver_ScanLab_int32 nRawCoordinateZ);
 	inline void AddTargetPositionsToDataTable(classParam<LibMCEnv::CDataTable> pDataTable, const std::string & sColumnIdentifierX, const std::string & sColumnDescriptionX, const std::string & sColumnIdentifierY, const std::string & sColumnDescriptionY);
+	inline void EnableSpillToDisk(const LibMCDriver_ScanLab_uint32 nMaxChunksInMemory);
 };
 	
 /*************************************************************************************************************************
@@ -1391,6 +1402,7 @@ public:
 		pWrapperTable->m_RTCRecording_AddBacktransformedZPositionsToDataTable = nullptr;
 		pWrapperTable->m_RTCRecording_BacktransformRawZCoordinate = nullptr;
 		pWrapperTable->m_RTCRecording_AddTargetPositionsToDataTable = nullptr;
+		pWrapperTable->m_RTCRecording_EnableSpillToDisk = nullptr;
 		pWrapperTable->m_GPIOSequence_GetIdentifier = nullptr;
 		pWrapperTable->m_GPIOSequence_Clear = nullptr;
 		pWrapperTable->m_GPIOSequence_AddOutput = nullptr;
@@ -2112,6 +2124,15 @@ public:
 		if (pWrapperTable->m_RTCRecording_AddTargetPositionsToDataTable == nullptr)
 			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_RTCRecording_EnableSpillToDisk = (PLibMCDriver_ScanLabRTCRecording_EnableSpillToDiskPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_rtcrecording_enablespilltodisk");
+		#else // _WIN32
+		pWrapperTable->m_RTCRecording_EnableSpillToDisk = (PLibMCDriver_ScanLabRTCRecording_EnableSpillToDiskPtr) dlsym(hLibrary, "libmcdriver_scanlab_rtcrecording_enablespilltodisk");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_RTCRecording_EnableSpillToDisk == nullptr)
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_GPIOSequence_GetIdentifier = (PLibMCDriver_ScanLabGPIOSequence_GetIdentifierPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_gpiosequence_getidentifier");
 		#else // _WIN32
@@ -4548,6 +4569,10 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_RTCRecording_AddTargetPositionsToDataTable == nullptr) )
 			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdriver_scanlab_rtcrecording_enablespilltodisk", (void**)&(pWrapperTable->m_RTCRecording_EnableSpillToDisk));
+		if ( (eLookupError != 0) || (pWrapperTable->m_RTCRecording_EnableSpillToDisk == nullptr) )
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdriver_scanlab_gpiosequence_getidentifier", (void**)&(pWrapperTable->m_GPIOSequence_GetIdentifier));
 		if ( (eLookupError != 0) || (pWrapperTable->m_GPIOSequence_GetIdentifier == nullptr) )
 			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -6107,6 +6132,15 @@ public:
 		CheckError(m_pWrapper->m_WrapperTable.m_RTCRecording_AddTargetPositionsToDataTable(m_pHandle, hDataTable, sColumnIdentifierX.c_str(), sColumnDescriptionX.c_str(), sColumnIdentifierY.c_str(), sColumnDescriptionY.c_str()));
 	}
 	
+	/**
+	* CRTCRecording::EnableSpillToDisk - Streams full recording chunks into a compressed temporary file on a background thread, so that long recordings only keep a bounded number of chunks in memory. Must be called before any data has been recorded.
+	* @param[in] nMaxChunksInMemory - Maximum number of full chunks that are queued for writing. Recording blocks if the writer falls behind. MUST be between 1 and 1024.
+	*/
+	void CRTCRecording::EnableSpillToDisk(const LibMCDriver_ScanLab_uint32 nMaxChunksInMemory)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_RTCRecording_EnableSpillToDisk(m_pHandle, nMaxChunksInMemory));
+	}
+	
 	/**
 	 * Method definitions for class CGPIOSequence
 	 */
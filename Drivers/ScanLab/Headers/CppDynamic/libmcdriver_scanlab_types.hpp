@@ -263,6 +263,11 @@ typedef void * LibMCDriver_ScanLab_pvoid;
 #define LIBMCDRIVER_SCANLAB_ERROR_INVALIDLASERPOWERMAPPING 1158 /** Invalid laser power mapping. */
 #define LIBMCDRIVER_SCANLAB_ERROR_COULDNOTCONVERTLASERPOWERTOWATTS 1159 /** Could not convert laser power to watts. */
 #define LIBMCDRIVER_SCANLAB_ERROR_COULDNOTCONVERTLASERPOWERTOPERCENT 1160 /** Could not convert laser power to percent. */
+#define LIBMCDRIVER_SCANLAB_ERROR_COULDNOTWRITERECORDINGSPILLFILE 1161 /** Could not write recording spill file. */
+#define LIBMCDRIVER_SCANLAB_ERROR_COULDNOTREADRECORDINGSPILLFILE 1162 /** Could not read recording spill file. */
+#define LIBMCDRIVER_SCANLAB_ERROR_INVALIDRECORDINGSPILLDATA 1163 /** Invalid recording spill data. */
+#define LIBMCDRIVER_SCANLAB_ERROR_RECORDINGSPILLINGMUSTBEENABLEDBEFORERECORDING 1164 /** Recording spilling must be enabled before recording. */
+#define LIBMCDRIVER_SCANLAB_ERROR_INVALIDMAXCHUNKSINMEMORY 1165 /** Invalid maximum number of chunks in memory. */
 
 /*************************************************************************************************************************
  Error strings for LibMCDriver_ScanLab
@@ -438,6 +443,11 @@ inline const char * LIBMCDRIVER_SCANLAB_GETERRORSTRING (LibMCDriver_ScanLabResul
     case LIBMCDRIVER_SCANLAB_ERROR_INVALIDLASERPOWERMAPPING: return "Invalid laser power mapping.";
     case LIBMCDRIVER_SCANLAB_ERROR_COULDNOTCONVERTLASERPOWERTOWATTS: return "Could not convert laser power to watts.";
     case LIBMCDRIVER_SCANLAB_ERROR_COULDNOTCONVERTLASERPOWERTOPERCENT: return "Could not convert laser power to percent.";
+    case LIBMCDRIVER_SCANLAB_ERROR_COULDNOTWRITERECORDINGSPILLFILE: return "Could not write recording spill file.";
+    case LIBMCDRIVER_SCANLAB_ERROR_COULDNOTREADRECORDINGSPILLFILE: return "Could not read recording spill file.";
+    case LIBMCDRIVER_SCANLAB_ERROR_INVALIDRECORDINGSPILLDATA: return "Invalid recording spill data.";
+    case LIBMCDRIVER_SCANLAB_ERROR_RECORDINGSPILLINGMUSTBEENABLEDBEFORERECORDING: return "Recording spilling must be enabled before recording.";
+    case LIBMCDRIVER_SCANLAB_ERROR_INVALIDMAXCHUNKSINMEMORY: return "Invalid maximum number of chunks in memory.";
     default: return "unknown error";
   }
 }
@@ -2096,7 +2096,7 @@ IRTCRecording* CRTCContext::PrepareRecording(const bool bKeepInMemory, const boo
 	if (bKeepInMemory)
 		m_Recordings.insert(std::make_pair (pInstance->getUUID(), pInstance));
 
-	return new CRTCRecording(pInstance);
+	return new CRTCRecording(pInstance, m_pDriverEnvironment);
 }
 
 bool CRTCContext::HasRecording(const std::string& sUUID)
@@ -2117,7 +2117,7 @@ IRTCRecording* CRTCContext::FindRecording(const std::string& sUUID)
 	auto iIter = m_Recordings.find(sNormalizedUUID);
 	if (iIter != m_Recordings.end())
 	{
-		return new CRTCRecording(iIter->second);
+		return new CRTCRecording(iIter->second, m_pDriverEnvironment);
 	}
 	else
 	{
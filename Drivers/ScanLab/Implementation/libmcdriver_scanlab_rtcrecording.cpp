@@ -41,11 +41,13 @@ using namespace LibMCDriver_ScanLab::Impl;
 /*************************************************************************************************************************
  Class definition of CRTCRecording 
 **************************************************************************************************************************/
-CRTCRecording::CRTCRecording(PRTCRecordingInstance pInstance)
-	: m_pInstance(pInstance)
+CRTCRecording::CRTCRecording(PRTCRecordingInstance pInstance, LibMCEnv::PDriverEnvironment pDriverEnvironment)
+	: m_pInstance(pInstance), m_pDriverEnvironment (pDriverEnvironment)
 {
 	if (pInstance.get() == nullptr)
 		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+	if (pDriverEnvironment.get() == nullptr)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
 
 }
 
@@ -177,3 +179,8 @@ void CRTCRecording::AddTargetPositionsToDataTable(LibMCEnv::PDataTable pDataTabl
 	m_pInstance->addTargetPositionsToDataTable(pDataTable, sColumnIdentifierX, sColumnDescriptionX, sColumnIdentifierY, sColumnDescriptionY);
 }
 
+void CRTCRecording::EnableSpillToDisk(const LibMCDriver_ScanLab_uint32 nMaxChunksInMemory)
+{
+	m_pInstance->enableSpillToDisk(m_pDriverEnvironment->CreateWorkingDirectory(), nMaxChunksInMemory);
+}
+
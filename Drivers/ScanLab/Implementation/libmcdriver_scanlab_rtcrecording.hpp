@@ -60,10 +60,11 @@ namespace Impl {
 class CRTCRecording : public virtual IRTCRecording, public virtual CBase {
 private:
 	PRTCRecordingInstance m_pInstance;
+	LibMCEnv::PDriverEnvironment m_pDriverEnvironment;
 
 public:
 
-	CRTCRecording(PRTCRecordingInstance pInstance);
+	CRTCRecording(PRTCRecordingInstance pInstance, LibMCEnv::PDriverEnvironment pDriverEnvironment);
 
 	virtual ~CRTCRecording();
 
@@ -105,6 +106,8 @@ public:
 
 	void AddTargetPositionsToDataTable(LibMCEnv::PDataTable pDataTable, const std::string& sColumnIdentifierX, const std::string& sColumnDescriptionX, const std::string& sColumnIdentifierY, const std::string& sColumnDescriptionY) override;
 
+	void EnableSpillToDisk(const LibMCDriver_ScanLab_uint32 nMaxChunksInMemory) override;
+
 };
 
 } // namespace Impl
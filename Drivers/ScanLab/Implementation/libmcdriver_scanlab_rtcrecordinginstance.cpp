@@ -37,9 +37,20 @@ Abstract: This is a stub class definition of CRTCRecording
 using namespace LibMCDriver_ScanLab::Impl;
 
 #include <thread>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define RTC_RECORDING_USESSE2
+#endif
 
 CRTCRecordingChunk::CRTCRecordingChunk(uint64_t nStartEntryIndex, size_t nChunkSize)
-	: m_nStartEntryIndex (nStartEntryIndex), m_nWriteOffset (0)
+	: m_nStartEntryIndex (nStartEntryIndex), 
+	m_nChunkSize (nChunkSize), 
+	m_nWriteOffset (0), 
+	m_bIsSpilled (false), 
+	m_nSpillOffset (0), 
+	m_nSpillSize (0)
 {
 	if (nChunkSize == 0)
 		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDCHUNKSIZE);
@@ -55,7 +66,7 @@ CRTCRecordingChunk::~CRTCRecordingChunk()
 
 size_t CRTCRecordingChunk::getChunkSize()
 {
-	return m_Buffer.size ();
+	return m_nChunkSize;
 }
 
 uint64_t CRTCRecordingChunk::getStartEntryIndex()
@@ -83,13 +94,13 @@ int32_t CRTCRecordingChunk::getRecordEntry(uint64_t nAbsoluteEntryIndex)
 	if (nLocalIndex >= m_Buffer.size ())
 		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_CHUNKENTRYINDEXOUTOFBOUNDS);
 
-	return m_Buffer.at (nAbsoluteEntryIndex);
+	return m_Buffer.at (nLocalIndex);
 }
 
 
 bool CRTCRecordingChunk::isFull()
 {
-	return (m_nWriteOffset >= m_Buffer.size());
+	return (m_nWriteOffset >= m_nChunkSize);
 }
 
 int32_t* CRTCRecordingChunk::reserveDataBuffer(uint32_t nCount, uint32_t& nEntriesToRead)
@@ -116,6 +127,39 @@ int32_t* CRTCRecordingChunk::reserveDataBuffer(uint32_t nCount, uint32_t& nEntri
 	return &m_Buffer.at(nResultOffset);
 }
 
+uint32_t CRTCRecordingChunk::getEntryCount()
+{
+	return m_nWriteOffset;
+}
+
+bool CRTCRecordingChunk::isSpilled()
+{
+	return m_bIsSpilled;
+}
+
+uint64_t CRTCRecordingChunk::getSpillOffset()
+{
+	return m_nSpillOffset;
+}
+
+uint32_t CRTCRecordingChunk::getSpillSize()
+{
+	return m_nSpillSize;
+}
+
+void CRTCRecordingChunk::releaseToSpillFile(uint64_t nSpillOffset, uint32_t nSpillSize)
+{
+	if (!isFull ())
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDRECORDINGSPILLDATA, "only full chunks can be spilled");
+
+	m_nSpillOffset = nSpillOffset;
+	m_nSpillSize = nSpillSize;
+	m_bIsSpilled = true;
+
+	std::vector<int32_t> emptyBuffer;
+	m_Buffer.swap(emptyBuffer);
+}
+
 
 CRTCRecordingChannel::CRTCRecordingChannel(const std::string& sChannelName, uint32_t nRTCChannelID, const LibMCDriver_ScanLab::eRTCChannelType eChannelType, size_t nChunkSize)
 	: m_sChannelName (sChannelName), 
@@ -155,8 +199,13 @@ int32_t* CRTCRecordingChannel::reserveDataBuffer(uint32_t nCount, uint32_t& nEnt
 	}
 
 	if (m_pCurrentChunk.get() != nullptr) {
-		if (m_pCurrentChunk->isFull())
+		if (m_pCurrentChunk->isFull()) {
+			// The previous reservation has been filled by now, so the chunk can be handed over.
+			if (m_pSpillWriter.get() != nullptr)
+				m_pSpillWriter->queueChunk(m_pCurrentChunk);
+
 			m_pCurrentChunk = nullptr;
+		}
 	}
 
 	if (m_pCurrentChunk.get() == nullptr) {
@@ -171,6 +220,25 @@ int32_t* CRTCRecordingChannel::reserveDataBuffer(uint32_t nCount, uint32_t& nEnt
 
 }
 
+void CRTCRecordingChannel::setSpillWriter(PRTCRecordingSpillWriter pSpillWriter)
+{
+	if (m_nEntryCount > 0)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_RECORDINGSPILLINGMUSTBEENABLEDBEFORERECORDING, "channel has already recorded data: " + m_sChannelName);
+
+	m_pSpillWriter = pSpillWriter;
+}
+
+void CRTCRecordingChannel::readChunkValues(PRTCRecordingChunk pChunk, int32_t* pTarget, uint32_t nCount)
+{
+	if (m_pSpillWriter.get() != nullptr) {
+		m_pSpillWriter->readChunkValues(pChunk, pTarget, nCount);
+	}
+	else {
+		auto& buffer = pChunk->getBuffer();
+		std::copy(buffer.begin(), buffer.begin() + nCount, pTarget);
+	}
+}
+
 uint32_t CRTCRecordingChannel::getRTCChannelID()
 {
 	return m_nRTCChannelID;
@@ -318,6 +386,9 @@ int32_t CRTCRecordingChannel::getRecordEntry(uint64_t nEntryIndex)
 
 	auto pChunk = m_Chunks.at(nChunkIndex);
 
+	if (m_pSpillWriter.get() != nullptr)
+		return m_pSpillWriter->getRecordEntry(pChunk, nEntryIndex);
+
 	return pChunk->getRecordEntry(nEntryIndex);
 
 }
@@ -332,23 +403,13 @@ void CRTCRecordingChannel::getAllRecordEntries(uint64_t nValuesBufferSize, uint6
 			throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_BUFFERTOOSMALL);
 
 		uint64_t nIndex = 0;
-		int32_t* pTarget = pValuesBuffer;
 		for (auto pChunk : m_Chunks) {
-			if (nIndex < m_nEntryCount) {
-
-
-				auto& buffer = pChunk->getBuffer();
-				for (int32_t value : buffer) {
-					*pTarget = value;
-					nIndex++;
-					pTarget++;
-
-					if (nIndex >= m_nEntryCount)
-						break;
-				}
-			} else {
+			if (nIndex >= m_nEntryCount)
 				break;
-			}
+
+			uint32_t nCount = (uint32_t) std::min<uint64_t> (pChunk->getEntryCount(), m_nEntryCount - nIndex);
+			readChunkValues(pChunk, &pValuesBuffer[nIndex], nCount);
+			nIndex += nCount;
 		}
 
 	}
@@ -365,16 +426,27 @@ void CRTCRecordingChannel::getAllScaledRecordEntries(uint64_t nValuesBufferSize,
 		if (m_nEntryCount > nValuesBufferSize)
 			throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_BUFFERTOOSMALL);
 
+		// Spilled chunks are decoded one at a time, so the raw values never need to be held completely.
+		std::vector<int32_t> decodeBuffer;
+
 		uint64_t nIndex = 0;
-		double* pTarget = pValuesBuffer;
 		for (auto pChunk : m_Chunks) {
-			auto& buffer = pChunk->getBuffer();
-			for (int32_t value : buffer) {
-				*pTarget = ((double)value * dScaleFactor) + dOffset;
-				nIndex++;
-				pTarget++;
+			if (nIndex >= m_nEntryCount)
+				break;
+
+			uint32_t nCount = (uint32_t) std::min<uint64_t> (pChunk->getEntryCount(), m_nEntryCount - nIndex);
+			const int32_t* pSource = nullptr;
+			if (m_pSpillWriter.get() != nullptr) {
+				decodeBuffer.resize(nCount);
+				m_pSpillWriter->readChunkValues(pChunk, decodeBuffer.data(), nCount);
+				pSource = decodeBuffer.data();
+			}
+			else {
+				pSource = pChunk->getBuffer().data();
 			}
 
+			CRTCRecordingInstance::scaleRecordValues(pSource, &pValuesBuffer[nIndex], nCount, dScaleFactor, dOffset);
+			nIndex += nCount;
 		}
 
 	}
@@ -444,7 +516,10 @@ CRTCRecordingInstance::CRTCRecordingInstance(const std::string& sUUID, PScanLabS
 
 CRTCRecordingInstance::~CRTCRecordingInstance()
 {
-
+	// Stop the writer thread before the spill file is released.
+	m_pSpillWriter = nullptr;
+	m_pSpillFile = nullptr;
+	m_pSpillDirectory = nullptr;
 }
 
 
@@ -526,6 +601,8 @@ PRTCRecordingChannel CRTCRecordingInstance::addChannel(const std::string& sChann
 		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_CHANNELTYPECANNOTBEUNDEFINED);
 
 	auto pChannel = std::make_shared<CRTCRecordingChannel>(sChannelName, nChannelID, eChannelType, m_nChunkSize);
+	if (m_pSpillWriter.get() != nullptr)
+		pChannel->setSpillWriter(m_pSpillWriter);
 
 	m_Channels.at(nChannelID - 1) = pChannel;
 	m_ChannelMap.insert(std::make_pair (sChannelName, pChannel));
@@ -1012,4 +1089,49 @@ void CRTCRecordingInstance::addTargetPositionsToDataTable(LibMCEnv::PDataTable p
 
 }
 
+void CRTCRecordingInstance::enableSpillToDisk(LibMCEnv::PWorkingDirectory pWorkingDirectory, uint32_t nMaxChunksInMemory)
+{
+	std::lock_guard<std::mutex> lockGuard(m_Mutex);
 
+	if (pWorkingDirectory.get() == nullptr)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+
+	if (m_pSpillWriter.get() != nullptr)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_RECORDINGSPILLINGMUSTBEENABLEDBEFORERECORDING, "recording spilling is already enabled");
+
+	for (auto iIter : m_ChannelMap) {
+		if (iIter.second->getRecordCount() > 0)
+			throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_RECORDINGSPILLINGMUSTBEENABLEDBEFORERECORDING, "channel has already recorded data: " + iIter.first);
+	}
+
+	auto pSpillFile = pWorkingDirectory->AddManagedTempFile("rtcspill");
+	auto pSpillWriter = std::make_shared<CRTCRecordingSpillWriter>(pSpillFile->GetAbsoluteFileName(), nMaxChunksInMemory);
+
+	for (auto iIter : m_ChannelMap)
+		iIter.second->setSpillWriter(pSpillWriter);
+
+	m_pSpillDirectory = pWorkingDirectory;
+	m_pSpillFile = pSpillFile;
+	m_pSpillWriter = pSpillWriter;
+}
+
+void CRTCRecordingInstance::scaleRecordValues(const int32_t* pSource, double* pTarget, size_t nCount, double dScaleFactor, double dOffset)
+{
+	size_t nIndex = 0;
+
+#ifdef RTC_RECORDING_USESSE2
+	// Multiply and add are kept separate, so that the results are identical to the scalar loop.
+	__m128d vScaleFactor = _mm_set1_pd(dScaleFactor);
+	__m128d vOffset = _mm_set1_pd(dOffset);
+	for (; nIndex + 4 <= nCount; nIndex += 4) {
+		__m128i vValues = _mm_loadu_si128((const __m128i*) &pSource[nIndex]);
+		__m128d vLow = _mm_cvtepi32_pd(vValues);
+		__m128d vHigh = _mm_cvtepi32_pd(_mm_shuffle_epi32(vValues, _MM_SHUFFLE(1, 0, 3, 2)));
+		_mm_storeu_pd(&pTarget[nIndex], _mm_add_pd(_mm_mul_pd(vLow, vScaleFactor), vOffset));
+		_mm_storeu_pd(&pTarget[nIndex + 2], _mm_add_pd(_mm_mul_pd(vHigh, vScaleFactor), vOffset));
+	}
+#endif
+
+	for (; nIndex < nCount; nIndex++)
+		pTarget[nIndex] = ((double)pSource[nIndex] * dScaleFactor) + dOffset;
+}
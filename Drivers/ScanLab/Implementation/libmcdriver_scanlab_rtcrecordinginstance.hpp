@@ -39,6 +39,7 @@ Abstract: This is the class declaration of CRTCRecording
 
 // Include custom headers here.
 #include "libmcdriver_scanlab_sdk.hpp"
+#include "libmcdriver_scanlab_rtcrecordingspillwriter.hpp"
 #include <map>
 #include <array>
 #include <mutex>
@@ -69,10 +70,16 @@ class CRTCRecordingChunk
 {
 private:
 	uint64_t m_nStartEntryIndex;
+	size_t m_nChunkSize;
 	std::vector<int32_t> m_Buffer;
 
 	uint32_t m_nWriteOffset;
 
+	// Spill state, which is owned by the spill writer once the chunk has been queued.
+	bool m_bIsSpilled;
+	uint64_t m_nSpillOffset;
+	uint32_t m_nSpillSize;
+
 public:
 	CRTCRecordingChunk(uint64_t nStartEntryIndex, size_t nChunkSize);
 
@@ -92,6 +99,16 @@ public:
 
 	int32_t* reserveDataBuffer(uint32_t nCount, uint32_t& nEntriesToRead);
 
+	uint32_t getEntryCount();
+
+	bool isSpilled();
+
+	uint64_t getSpillOffset();
+
+	uint32_t getSpillSize();
+
+	// Frees the value buffer after the chunk has been written to the spill file.
+	void releaseToSpillFile(uint64_t nSpillOffset, uint32_t nSpillSize);
 
 };
 
@@ -111,6 +128,10 @@ private:
 	size_t m_nChunkSize;
 	std::vector<PRTCRecordingChunk> m_Chunks;
 
+	PRTCRecordingSpillWriter m_pSpillWriter;
+
+	void readChunkValues(PRTCRecordingChunk pChunk, int32_t* pTarget, uint32_t nCount);
+
 public:
 	CRTCRecordingChannel(const std::string& sChannelName, uint32_t nRTCChannelID, const LibMCDriver_ScanLab::eRTCChannelType eChannelType, size_t nChunkSize);
 
@@ -135,6 +156,8 @@ public:
 	void getAllScaledRecordEntries(uint64_t nValuesBufferSize, uint64_t* pValuesNeededCount, double* pValuesBuffer, double dScaleFactor, double dOffset);
 
 	int32_t* reserveDataBuffer(uint32_t nCount, uint32_t& nEntriesToRead);
+
+	void setSpillWriter(PRTCRecordingSpillWriter pSpillWriter);
 };
 
 
@@ -163,6 +186,10 @@ private:
 
 	std::array<PRTCRecordingChannel, RTC_CHANNELCOUNT> m_Channels;
 
+	LibMCEnv::PWorkingDirectory m_pSpillDirectory;
+	LibMCEnv::PWorkingFile m_pSpillFile;
+	PRTCRecordingSpillWriter m_pSpillWriter;
+
 	void readRecordedDataBlockFromRTC(uint32_t DataStart, uint32_t DataEnd);
 
 	static std::string normalizeChannelName(const std::string& sChannelName);
@@ -212,6 +239,11 @@ public:
 	double backtransformRawZCoordinate(const int32_t nRawCoordinateZ);
 
 	void addTargetPositionsToDataTable(LibMCEnv::PDataTable pDataTable, const std::string& sColumnIdentifierX, const std::string& sColumnDescriptionX, const std::string& sColumnIdentifierY, const std::string& sColumnDescriptionY);
+
+	void enableSpillToDisk(LibMCEnv::PWorkingDirectory pWorkingDirectory, uint32_t nMaxChunksInMemory);
+
+	// Converts raw values into scaled doubles, using SSE2 where available.
+	static void scaleRecordValues(const int32_t* pSource, double* pTarget, size_t nCount, double dScaleFactor, double dOffset);
 	
 };
 
@@ -0,0 +1,276 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class definition of CRTCRecordingSpillWriter
+
+*/
+
+#include "libmcdriver_scanlab_rtcrecordingspillwriter.hpp"
+#include "libmcdriver_scanlab_rtcrecordinginstance.hpp"
+#include "libmcdriver_scanlab_interfaceexception.hpp"
+
+#include "lz4/lz4.h"
+
+using namespace LibMCDriver_ScanLab::Impl;
+
+
+CRTCRecordingSpillWriter::CRTCRecordingSpillWriter(const std::string& sFileName, uint32_t nMaxPendingChunks)
+	: m_nSpillStreamSize (0),
+	m_nMaxPendingChunks (nMaxPendingChunks),
+	m_bStopWorker (false),
+	m_pCachedChunk (nullptr)
+{
+	if ((nMaxPendingChunks < RTC_SPILL_MAXCHUNKSINMEMORY_MIN) || (nMaxPendingChunks > RTC_SPILL_MAXCHUNKSINMEMORY_MAX))
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDMAXCHUNKSINMEMORY, "invalid maximum number of chunks in memory: " + std::to_string(nMaxPendingChunks));
+
+	m_SpillStream.open(sFileName, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!m_SpillStream.is_open())
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_COULDNOTWRITERECORDINGSPILLFILE, "could not create recording spill file: " + sFileName);
+
+	m_WorkerThread = std::thread(&CRTCRecordingSpillWriter::runWorker, this);
+}
+
+CRTCRecordingSpillWriter::~CRTCRecordingSpillWriter()
+{
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		m_bStopWorker = true;
+	}
+	m_QueueCondition.notify_all();
+
+	if (m_WorkerThread.joinable())
+		m_WorkerThread.join();
+
+	m_SpillStream.close();
+}
+
+
+void CRTCRecordingSpillWriter::encodeChunkValues(const int32_t* pValues, uint32_t nCount, std::vector<uint32_t>& deltaBuffer, std::vector<uint8_t>& encodedBuffer)
+{
+	if ((pValues == nullptr) || (nCount == 0))
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+
+	// Positions and most other channels change slowly, so the deltas are small and zigzag encoding
+	// leaves their upper bytes zero, which is what LZ4 compresses well.
+	deltaBuffer.resize(nCount);
+	uint32_t* pDelta = deltaBuffer.data();
+	uint32_t nPreviousValue = 0;
+	for (uint32_t nIndex = 0; nIndex < nCount; nIndex++) {
+		uint32_t nValue = (uint32_t)pValues[nIndex];
+		int32_t nDelta = (int32_t)(nValue - nPreviousValue);
+		pDelta[nIndex] = ((uint32_t)nDelta << 1) ^ (uint32_t)(nDelta >> 31);
+		nPreviousValue = nValue;
+	}
+
+	int nSourceSize = (int)(nCount * sizeof(uint32_t));
+	encodedBuffer.resize(LZ4_compressBound(nSourceSize));
+
+	int nEncodedSize = LZ4_compress_default((const char*)pDelta, (char*)encodedBuffer.data(), nSourceSize, (int)encodedBuffer.size());
+	if (nEncodedSize <= 0)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_COULDNOTWRITERECORDINGSPILLFILE, "could not compress recording chunk");
+
+	encodedBuffer.resize(nEncodedSize);
+}
+
+void CRTCRecordingSpillWriter::decodeChunkValues(const uint8_t* pEncodedData, uint32_t nEncodedSize, int32_t* pTarget, uint32_t nCount)
+{
+	if ((pEncodedData == nullptr) || (pTarget == nullptr) || (nCount == 0))
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+
+	int nTargetSize = (int)(nCount * sizeof(int32_t));
+	int nDecodedSize = LZ4_decompress_safe((const char*)pEncodedData, (char*)pTarget, (int)nEncodedSize, nTargetSize);
+	if (nDecodedSize != nTargetSize)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDRECORDINGSPILLDATA, "could not decompress recording chunk");
+
+	uint32_t nPreviousValue = 0;
+	for (uint32_t nIndex = 0; nIndex < nCount; nIndex++) {
+		uint32_t nZigZag = (uint32_t)pTarget[nIndex];
+		nPreviousValue += (nZigZag >> 1) ^ (0 - (nZigZag & 1));
+		pTarget[nIndex] = (int32_t)nPreviousValue;
+	}
+}
+
+
+void CRTCRecordingSpillWriter::runWorker()
+{
+	std::vector<uint32_t> deltaBuffer;
+	std::vector<uint8_t> encodedBuffer;
+
+	while (true) {
+		PRTCRecordingChunk pChunk;
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_QueueCondition.wait(lock, [this] { return m_bStopWorker || !m_PendingChunks.empty(); });
+			if (m_bStopWorker)
+				return;
+
+			// The chunk stays queued until it is written, so that it counts against the memory limit.
+			pChunk = m_PendingChunks.front();
+		}
+
+		try {
+			// Full chunks are not modified anymore, so encoding does not need the lock.
+			encodeChunkValues(pChunk->getBuffer().data(), pChunk->getEntryCount(), deltaBuffer, encodedBuffer);
+
+			{
+				std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+				m_SpillStream.clear();
+				m_SpillStream.seekp(m_nSpillStreamSize);
+				m_SpillStream.write((const char*)encodedBuffer.data(), encodedBuffer.size());
+				if (!m_SpillStream.good())
+					throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_COULDNOTWRITERECORDINGSPILLFILE, "could not write recording chunk at offset " + std::to_string(m_nSpillStreamSize));
+
+				pChunk->releaseToSpillFile(m_nSpillStreamSize, (uint32_t)encodedBuffer.size());
+				m_nSpillStreamSize += encodedBuffer.size();
+
+				m_PendingChunks.pop_front();
+			}
+		}
+		catch (std::exception& E) {
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			m_sWorkerError = std::string("recording spill writer failed: ") + E.what();
+			m_bStopWorker = true;
+		}
+
+		m_QueueCondition.notify_all();
+	}
+}
+
+void CRTCRecordingSpillWriter::checkWorkerError()
+{
+	if (!m_sWorkerError.empty())
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_COULDNOTWRITERECORDINGSPILLFILE, m_sWorkerError);
+}
+
+
+void CRTCRecordingSpillWriter::queueChunk(PRTCRecordingChunk pChunk)
+{
+	if (pChunk.get() == nullptr)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+
+	if (pChunk->getEntryCount() == 0)
+		return;
+
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_QueueCondition.wait(lock, [this] { return m_bStopWorker || (m_PendingChunks.size() < m_nMaxPendingChunks); });
+		checkWorkerError();
+
+		m_PendingChunks.push_back(pChunk);
+	}
+
+	m_QueueCondition.notify_all();
+}
+
+void CRTCRecordingSpillWriter::flush()
+{
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	m_QueueCondition.wait(lock, [this] { return m_bStopWorker || m_PendingChunks.empty(); });
+	checkWorkerError();
+}
+
+
+void CRTCRecordingSpillWriter::readSpilledChunk(CRTCRecordingChunk* pChunk, int32_t* pTarget, uint32_t nCount)
+{
+	// Needs to be called with the lock held.
+	if (nCount != pChunk->getEntryCount())
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDRECORDINGSPILLDATA, "spilled chunks can only be read as a whole");
+
+	uint32_t nSpillSize = pChunk->getSpillSize();
+	m_ReadBuffer.resize(nSpillSize);
+
+	m_SpillStream.clear();
+	m_SpillStream.seekg(pChunk->getSpillOffset());
+	m_SpillStream.read((char*)m_ReadBuffer.data(), nSpillSize);
+	if ((!m_SpillStream.good()) || (m_SpillStream.gcount() != (std::streamsize)nSpillSize))
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_COULDNOTREADRECORDINGSPILLFILE, "could not read recording chunk at offset " + std::to_string(pChunk->getSpillOffset()));
+
+	decodeChunkValues(m_ReadBuffer.data(), nSpillSize, pTarget, nCount);
+}
+
+void CRTCRecordingSpillWriter::readChunkValues(PRTCRecordingChunk pChunk, int32_t* pTarget, uint32_t nCount)
+{
+	if ((pChunk.get() == nullptr) || (pTarget == nullptr))
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+
+	if (nCount == 0)
+		return;
+
+	std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+	if (pChunk->isSpilled()) {
+		if (m_pCachedChunk == pChunk) {
+			std::copy(m_CachedValues.begin(), m_CachedValues.begin() + nCount, pTarget);
+		}
+		else {
+			readSpilledChunk(pChunk.get(), pTarget, nCount);
+		}
+	}
+	else {
+		if (nCount > pChunk->getEntryCount())
+			throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_CHUNKENTRYINDEXOUTOFBOUNDS);
+
+		auto& buffer = pChunk->getBuffer();
+		std::copy(buffer.begin(), buffer.begin() + nCount, pTarget);
+	}
+
+}
+
+int32_t CRTCRecordingSpillWriter::getRecordEntry(PRTCRecordingChunk pChunk, uint64_t nAbsoluteEntryIndex)
+{
+	if (pChunk.get() == nullptr)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+
+	std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+	if (!pChunk->isSpilled())
+		return pChunk->getRecordEntry(nAbsoluteEntryIndex);
+
+	if (nAbsoluteEntryIndex < pChunk->getStartEntryIndex())
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_CHUNKENTRYINDEXOUTOFBOUNDS);
+	uint64_t nLocalIndex = nAbsoluteEntryIndex - pChunk->getStartEntryIndex();
+	if (nLocalIndex >= pChunk->getEntryCount())
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_CHUNKENTRYINDEXOUTOFBOUNDS);
+
+	if (m_pCachedChunk != pChunk) {
+		m_pCachedChunk = nullptr;
+		m_CachedValues.resize(pChunk->getEntryCount());
+		readSpilledChunk(pChunk.get(), m_CachedValues.data(), pChunk->getEntryCount());
+		m_pCachedChunk = pChunk;
+	}
+
+	return m_CachedValues.at(nLocalIndex);
+}
+
+uint64_t CRTCRecordingSpillWriter::getSpillFileSize()
+{
+	std::lock_guard<std::mutex> lockGuard(m_Mutex);
+	return m_nSpillStreamSize;
+}
@@ -0,0 +1,128 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class declaration of CRTCRecordingSpillWriter
+
+*/
+
+
+#ifndef __LIBMCDRIVER_SCANLAB_RTCRECORDINGSPILLWRITER
+#define __LIBMCDRIVER_SCANLAB_RTCRECORDINGSPILLWRITER
+
+#include <memory>
+#include <vector>
+#include <deque>
+#include <string>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+#define RTC_SPILL_MAXCHUNKSINMEMORY_MIN 1
+#define RTC_SPILL_MAXCHUNKSINMEMORY_MAX 1024
+#define RTC_SPILL_MAXCHUNKSINMEMORY_DEFAULT 4
+
+
+namespace LibMCDriver_ScanLab {
+namespace Impl {
+
+class CRTCRecordingChunk;
+typedef std::shared_ptr<CRTCRecordingChunk> PRTCRecordingChunk;
+
+
+/*************************************************************************************************************************
+ Class declaration of CRTCRecordingSpillWriter
+
+ Writes full recording chunks into a temporary file on a background thread and frees their memory afterwards.
+ Each chunk is stored as one LZ4 block of the zigzag encoded deltas between consecutive values.
+ The chunks keep track of their block location, so the file itself has no directory.
+**************************************************************************************************************************/
+
+class CRTCRecordingSpillWriter
+{
+private:
+
+	std::fstream m_SpillStream;
+	uint64_t m_nSpillStreamSize;
+
+	uint32_t m_nMaxPendingChunks;
+
+	// Guards the stream, the pending queue and the spill state of all chunks.
+	std::mutex m_Mutex;
+	std::condition_variable m_QueueCondition;
+	std::deque<PRTCRecordingChunk> m_PendingChunks;
+	bool m_bStopWorker;
+	std::string m_sWorkerError;
+
+	std::thread m_WorkerThread;
+
+	// Single chunk decode cache for random access reads.
+	PRTCRecordingChunk m_pCachedChunk;
+	std::vector<int32_t> m_CachedValues;
+
+	std::vector<uint8_t> m_ReadBuffer;
+
+	void runWorker();
+
+	void checkWorkerError();
+
+	void readSpilledChunk(CRTCRecordingChunk* pChunk, int32_t* pTarget, uint32_t nCount);
+
+public:
+
+	static void encodeChunkValues(const int32_t* pValues, uint32_t nCount, std::vector<uint32_t>& deltaBuffer, std::vector<uint8_t>& encodedBuffer);
+
+	static void decodeChunkValues(const uint8_t* pEncodedData, uint32_t nEncodedSize, int32_t* pTarget, uint32_t nCount);
+
+	CRTCRecordingSpillWriter(const std::string& sFileName, uint32_t nMaxPendingChunks);
+
+	virtual ~CRTCRecordingSpillWriter();
+
+	// Hands over a full chunk. Blocks while the maximum number of chunks is waiting to be written.
+	void queueChunk(PRTCRecordingChunk pChunk);
+
+	// Blocks until all queued chunks have been written.
+	void flush();
+
+	// Copies the first nCount values of a chunk, regardless if it is still in memory or has been spilled.
+	void readChunkValues(PRTCRecordingChunk pChunk, int32_t* pTarget, uint32_t nCount);
+
+	int32_t getRecordEntry(PRTCRecordingChunk pChunk, uint64_t nAbsoluteEntryIndex);
+
+	uint64_t getSpillFileSize();
+
+};
+
+typedef std::shared_ptr<CRTCRecordingSpillWriter> PRTCRecordingSpillWriter;
+
+
+} // namespace Impl
+} // namespace LibMCDriver_ScanLab
+
+#endif // __LIBMCDRIVER_SCANLAB_RTCRECORDINGSPILLWRITER
@@ -571,6 +571,15 @@ LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_rtcre
 */
 LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_rtcrecording_addtargetpositionstodatatable(LibMCDriver_ScanLab_RTCRecording pRTCRecording, LibMCEnv_DataTable pDataTable, const char * pColumnIdentifierX, const char * pColumnDescriptionX, const char * pColumnIdentifierY, const char * pColumnDescriptionY);
 
+/**
+* Streams full recording chunks into a compressed temporary file on a background thread, so that long recordings only keep a bounded number of chunks in memory. Must be called before any data has been recorded.
+*
+* @param[in] pRTCRecording - RTCRecording instance.
+* @param[in] nMaxChunksInMemory - Maximum number of full chunks that are queued for writing. Recording blocks if the writer falls behind. MUST be between 1 and 1024.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_rtcrecording_enablespilltodisk(LibMCDriver_ScanLab_RTCRecording pRTCRecording, LibMCDriver_ScanLab_uint32 nMaxChunksInMemory);
+
 /*************************************************************************************************************************
  Class definition for GPIOSequence
 **************************************************************************************************************************/
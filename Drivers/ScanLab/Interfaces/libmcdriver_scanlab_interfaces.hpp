@@ -786,6 +786,12 @@ public:
 	*/
 	virtual void AddTargetPositionsToDataTable(LibMCEnv::PDataTable pDataTable, const std::string & sColumnIdentifierX, const std::string & sColumnDescriptionX, const std::string & sColumnIdentifierY, const std::string & sColumnDescriptionY) = 0;
 
+	/**
+	* IRTCRecording::EnableSpillToDisk - Streams full recording chunks into a compressed temporary file on a background thread, so that long recordings only keep a bounded number of chunks in memory. Must be called before any data has been recorded.
+	* @param[in] nMaxChunksInMemory - Maximum number of full chunks that are queued for writing. Recording blocks if the writer falls behind. MUST be between 1 and 1024.
+	*/
+	virtual void EnableSpillToDisk(const LibMCDriver_ScanLab_uint32 nMaxChunksInMemory) = 0;
+
 };
 
 typedef IBaseSharedPtr<IRTCRecording> PIRTCRecording;
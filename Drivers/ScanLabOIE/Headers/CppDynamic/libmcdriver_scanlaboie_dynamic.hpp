@@ -247,6 +247,7 @@ public:
 			case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDOIEDEVICESTATE: return "INVALIDOIEDEVICESTATE";
 			case LIBMCDRIVER_SCANLABOIE_ERROR_FREQUENCYCHANGENOTALLOWED: return "FREQUENCYCHANGENOTALLOWED";
 			case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGFREQUENCY: return "INVALIDRECORDINGFREQUENCY";
+			case LIBMCDRIVER_SCANLABOIE_ERROR_RECORDINGCAPACITYEXCEEDED: return "RECORDINGCAPACITYEXCEEDED";
 		}
 		return "UNKNOWN";
 	}
@@ -324,6 +325,7 @@ public:
 			case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDOIEDEVICESTATE: return "Invalid OIE device state.";
 			case LIBMCDRIVER_SCANLABOIE_ERROR_FREQUENCYCHANGENOTALLOWED: return "Frequency change not allowed.";
 			case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGFREQUENCY: return "Invalid recording frequency.";
+			case LIBMCDRIVER_SCANLABOIE_ERROR_RECORDINGCAPACITYEXCEEDED: return "Recording capacity exceeded.";
 		}
 		return "unknown error";
 	}
@@ -597,6 +599,8 @@ public:
 	inline void AddScaledSensorSignalsToDataTable(const LibMCDriver_ScanLabOIE_uint32 nSignalIndex, classParam<LibMCEnv::CDataTable> pDataTable, const std::string & sColumnIdentifier, const std::string & sColumnDescription, const LibMCDriver_ScanLabOIE_double dScaleFactor, const LibMCDriver_ScanLabOIE_double dOffset);
 	inline void AddAdditionalSignalsToDataTable(const LibMCDriver_ScanLabOIE_uint32 nAdditionalIndex, classParam<LibMCEnv::CDataTable> pDataTable, const std::string & sColumnIdentifier, const std::string & sColumnDescription);
 	inline void AddScaledAdditionalSignalsToDataTable(const LibMCDriver_ScanLabOIE_uint32 nAdditionalIndex, classParam<LibMCEnv::CDataTable> pDataTable, const std::string & sColumnIdentifier, const std::string & sColumnDescription, const LibMCDriver_ScanLabOIE_double dScaleFactor, const LibMCDriver_ScanLabOIE_double dOffset);
+	inline void AddAllSignalsToDataTable(classParam<LibMCEnv::CDataTable> pDataTable, const std::string & sColumnPrefix);
+	inline void RenderSensorSignalsToField(const LibMCDriver_ScanLabOIE_uint32 nSignalIndex, classParam<LibMCEnv::CDiscreteFieldData2D> pField, const LibMCDriver_ScanLabOIE_double dScaleFactor, const LibMCDriver_ScanLabOIE_double dOffset, const LibMCDriver_ScanLabOIE_double dDefaultValue);
 };
 	
 /*************************************************************************************************************************
@@ -839,6 +843,8 @@ public:
 		pWrapperTable->m_DataRecording_AddScaledSensorSignalsToDataTable = nullptr;
 		pWrapperTable->m_DataRecording_AddAdditionalSignalsToDataTable = nullptr;
 		pWrapperTable->m_DataRecording_AddScaledAdditionalSignalsToDataTable = nullptr;
+		pWrapperTable->m_DataRecording_AddAllSignalsToDataTable = nullptr;
+		pWrapperTable->m_DataRecording_RenderSensorSignalsToField = nullptr;
 		pWrapperTable->m_OIEDevice_GetDeviceName = nullptr;
 		pWrapperTable->m_OIEDevice_SetHostName = nullptr;
 		pWrapperTable->m_OIEDevice_GetHostName = nullptr;
@@ -1302,6 +1308,24 @@ public:
 		if (pWrapperTable->m_DataRecording_AddScaledAdditionalSignalsToDataTable == nullptr)
 			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_DataRecording_AddAllSignalsToDataTable = (PLibMCDriver_ScanLabOIEDataRecording_AddAllSignalsToDataTablePtr) GetProcAddress(hLibrary, "libmcdriver_scanlaboie_datarecording_addallsignalstodatatable");
+		#else // _WIN32
+		pWrapperTable->m_DataRecording_AddAllSignalsToDataTable = (PLibMCDriver_ScanLabOIEDataRecording_AddAllSignalsToDataTablePtr) dlsym(hLibrary, "libmcdriver_scanlaboie_datarecording_addallsignalstodatatable");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_DataRecording_AddAllSignalsToDataTable == nullptr)
+			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_DataRecording_RenderSensorSignalsToField = (PLibMCDriver_ScanLabOIEDataRecording_RenderSensorSignalsToFieldPtr) GetProcAddress(hLibrary, "libmcdriver_scanlaboie_datarecording_rendersensorsignalstofield");
+		#else // _WIN32
+		pWrapperTable->m_DataRecording_RenderSensorSignalsToField = (PLibMCDriver_ScanLabOIEDataRecording_RenderSensorSignalsToFieldPtr) dlsym(hLibrary, "libmcdriver_scanlaboie_datarecording_rendersensorsignalstofield");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_DataRecording_RenderSensorSignalsToField == nullptr)
+			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_OIEDevice_GetDeviceName = (PLibMCDriver_ScanLabOIEOIEDevice_GetDeviceNamePtr) GetProcAddress(hLibrary, "libmcdriver_scanlaboie_oiedevice_getdevicename");
 		#else // _WIN32
@@ -1955,6 +1979,14 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_DataRecording_AddScaledAdditionalSignalsToDataTable == nullptr) )
 			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdriver_scanlaboie_datarecording_addallsignalstodatatable", (void**)&(pWrapperTable->m_DataRecording_AddAllSignalsToDataTable));
+		if ( (eLookupError != 0) || (pWrapperTable->m_DataRecording_AddAllSignalsToDataTable == nullptr) )
+			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlaboie_datarecording_rendersensorsignalstofield", (void**)&(pWrapperTable->m_DataRecording_RenderSensorSignalsToField));
+		if ( (eLookupError != 0) || (pWrapperTable->m_DataRecording_RenderSensorSignalsToField == nullptr) )
+			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdriver_scanlaboie_oiedevice_getdevicename", (void**)&(pWrapperTable->m_OIEDevice_GetDeviceName));
 		if ( (eLookupError != 0) || (pWrapperTable->m_OIEDevice_GetDeviceName == nullptr) )
 			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -2712,6 +2744,31 @@ public:
 		CheckError(m_pWrapper->m_WrapperTable.m_DataRecording_AddScaledAdditionalSignalsToDataTable(m_pHandle, nAdditionalIndex, hDataTable, sColumnIdentifier.c_str(), sColumnDescription.c_str(), dScaleFactor, dOffset));
 	}
 	
+	/**
+	* CDataRecording::AddAllSignalsToDataTable - Writes packet numbers, measurement tags, coordinates and all signal channels of the recording to a data table. All columns are taken from the same snapshot of the recording and have the same length. Column identifiers are the prefix followed by packetnumber, measurementtag, x, y, sensor_N, rtc_N and additional_N.
+	* @param[in] pDataTable - Data table instance to write to.
+	* @param[in] sColumnPrefix - Prefix of all column identifiers. May be empty.
+	*/
+	void CDataRecording::AddAllSignalsToDataTable(classParam<LibMCEnv::CDataTable> pDataTable, const std::string & sColumnPrefix)
+	{
+		LibMCEnvHandle hDataTable = pDataTable.GetHandle();
+		CheckError(m_pWrapper->m_WrapperTable.m_DataRecording_AddAllSignalsToDataTable(m_pHandle, hDataTable, sColumnPrefix.c_str()));
+	}
+	
+	/**
+	* CDataRecording::RenderSensorSignalsToField - Renders a certain sensor channel into a discrete field, averaging all records per pixel by their X and Y coordinates. The field values will be the transform RawValue times ScaleFactor + Offset.
+	* @param[in] nSignalIndex - Index of the signal to render. 0-based. MUST be smaller than SensorSignalCount.
+	* @param[in] pField - Field instance to render into. Origin and DPI of the field define the mapping of the coordinates.
+	* @param[in] dScaleFactor - Factor that the raw value is scaled with.
+	* @param[in] dOffset - Offset that the raw value is scaled with.
+	* @param[in] dDefaultValue - Value of pixels that do not contain any record.
+	*/
+	void CDataRecording::RenderSensorSignalsToField(const LibMCDriver_ScanLabOIE_uint32 nSignalIndex, classParam<LibMCEnv::CDiscreteFieldData2D> pField, const LibMCDriver_ScanLabOIE_double dScaleFactor, const LibMCDriver_ScanLabOIE_double dOffset, const LibMCDriver_ScanLabOIE_double dDefaultValue)
+	{
+		LibMCEnvHandle hField = pField.GetHandle();
+		CheckError(m_pWrapper->m_WrapperTable.m_DataRecording_RenderSensorSignalsToField(m_pHandle, nSignalIndex, hField, dScaleFactor, dOffset, dDefaultValue));
+	}
+	
 	/**
 	 * Method definitions for class COIEDevice
 	 */
@@ -78,16 +78,16 @@ LibMCDriver_ScanLabOIE_uint64 CDataRecording::GetRecordCount()
 
 void CDataRecording::GetRecordInformation(const LibMCDriver_ScanLabOIE_uint32 nIndex, LibMCDriver_ScanLabOIE_uint32 & nPacketNumber, LibMCDriver_ScanLabOIE_double & dX, LibMCDriver_ScanLabOIE_double & dY)
 {
-	auto pRecord = m_pDataRecordingInstance->getRecord(nIndex);
-	nPacketNumber = pRecord->m_nPacketNumber;
-	dX = pRecord->m_dX;
-	dY = pRecord->m_dY;
+	auto record = m_pDataRecordingInstance->getRecord(nIndex);
+	nPacketNumber = record.m_nPacketNumber;
+	dX = record.m_dX;
+	dY = record.m_dY;
 }
 
 LibMCDriver_ScanLabOIE_uint32 CDataRecording::GetMeasurementTag(const LibMCDriver_ScanLabOIE_uint32 nIndex)
 {
-	auto pRecord = m_pDataRecordingInstance->getRecord(nIndex);
-	return pRecord->m_nMeasurementTag;
+	auto record = m_pDataRecordingInstance->getRecord(nIndex);
+	return record.m_nMeasurementTag;
 
 }
 
@@ -159,10 +159,16 @@ void CDataRecording::GetAllCoordinates(LibMCDriver_ScanLabOIE_uint64 nXArrayBuff
 	if (pYArrayNeededCount != nullptr)
 		*pYArrayNeededCount = nRecordCount;
 
-	if (pXArrayBuffer != nullptr)
-		m_pDataRecordingInstance->copyAllXCoordinates(pXArrayBuffer, nXArrayBufferSize);
-	if (pYArrayBuffer != nullptr)
-		m_pDataRecordingInstance->copyAllYCoordinates(pYArrayBuffer, nYArrayBufferSize);
+	if (pXArrayBuffer != nullptr) {
+		if (nXArrayBufferSize < nRecordCount)
+			throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
+		m_pDataRecordingInstance->copyAllXCoordinates(pXArrayBuffer, nRecordCount);
+	}
+	if (pYArrayBuffer != nullptr) {
+		if (nYArrayBufferSize < nRecordCount)
+			throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
+		m_pDataRecordingInstance->copyAllYCoordinates(pYArrayBuffer, nRecordCount);
+	}
 
 }
 
@@ -172,8 +178,11 @@ void CDataRecording::GetAllPacketNumbers(LibMCDriver_ScanLabOIE_uint64 nPacketNu
 	if (pPacketNumersNeededCount != nullptr)
 		*pPacketNumersNeededCount = nRecordCount;
 
-	if (pPacketNumersBuffer != nullptr)
-		m_pDataRecordingInstance->copyAllPacketNumbers(pPacketNumersBuffer, nPacketNumersBufferSize);
+	if (pPacketNumersBuffer != nullptr) {
+		if (nPacketNumersBufferSize < nRecordCount)
+			throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
+		m_pDataRecordingInstance->copyAllPacketNumbers(pPacketNumersBuffer, nRecordCount);
+	}
 }
 
 void CDataRecording::GetAllMeasurementTags(LibMCDriver_ScanLabOIE_uint64 nMeasurementTagsBufferSize, LibMCDriver_ScanLabOIE_uint64* pMeasurementTagsNeededCount, LibMCDriver_ScanLabOIE_uint32* pMeasurementTagsBuffer)
@@ -182,8 +191,11 @@ void CDataRecording::GetAllMeasurementTags(LibMCDriver_ScanLabOIE_uint64 nMeasur
 	if (pMeasurementTagsNeededCount != nullptr)
 		*pMeasurementTagsNeededCount = nRecordCount;
 
-	if (pMeasurementTagsBuffer != nullptr)
-		m_pDataRecordingInstance->copyAllMeasurementTags(pMeasurementTagsBuffer, nMeasurementTagsBufferSize);
+	if (pMeasurementTagsBuffer != nullptr) {
+		if (nMeasurementTagsBufferSize < nRecordCount)
+			throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
+		m_pDataRecordingInstance->copyAllMeasurementTags(pMeasurementTagsBuffer, nRecordCount);
+	}
 
 }
 
@@ -193,8 +205,11 @@ void CDataRecording::GetAllRTCSignals(const LibMCDriver_ScanLabOIE_uint32 nRTCIn
 	if (pSignalsNeededCount != nullptr)
 		*pSignalsNeededCount = nRecordCount;
 
-	if (pSignalsBuffer != nullptr)
-		m_pDataRecordingInstance->copyAllRTCSignalsByIndex(nRTCIndex, pSignalsBuffer, nSignalsBufferSize);
+	if (pSignalsBuffer != nullptr) {
+		if (nSignalsBufferSize < nRecordCount)
+			throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
+		m_pDataRecordingInstance->copyAllRTCSignalsByIndex(nRTCIndex, pSignalsBuffer, nRecordCount);
+	}
 }
 
 void CDataRecording::GetAllSensorSignals(const LibMCDriver_ScanLabOIE_uint32 nSignalIndex, LibMCDriver_ScanLabOIE_uint64 nSignalsBufferSize, LibMCDriver_ScanLabOIE_uint64* pSignalsNeededCount, LibMCDriver_ScanLabOIE_int32 * pSignalsBuffer)
@@ -203,8 +218,11 @@ void CDataRecording::GetAllSensorSignals(const LibMCDriver_ScanLabOIE_uint32 nSi
 	if (pSignalsNeededCount != nullptr)
 		*pSignalsNeededCount = nRecordCount;
 
-	if (pSignalsBuffer != nullptr)
-		m_pDataRecordingInstance->copyAllSensorSignalsByIndex(nSignalIndex, pSignalsBuffer, nSignalsBufferSize);
+	if (pSignalsBuffer != nullptr) {
+		if (nSignalsBufferSize < nRecordCount)
+			throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
+		m_pDataRecordingInstance->copyAllSensorSignalsByIndex(nSignalIndex, pSignalsBuffer, nRecordCount);
+	}
 }
 
 void CDataRecording::GetAllAdditionalSignals(const LibMCDriver_ScanLabOIE_uint32 nAdditionalIndex, LibMCDriver_ScanLabOIE_uint64 nSignalsBufferSize, LibMCDriver_ScanLabOIE_uint64* pSignalsNeededCount, LibMCDriver_ScanLabOIE_int32* pSignalsBuffer)
@@ -213,8 +231,11 @@ void CDataRecording::GetAllAdditionalSignals(const LibMCDriver_ScanLabOIE_uint32
 	if (pSignalsNeededCount != nullptr)
 		*pSignalsNeededCount = nRecordCount;
 
-	if (pSignalsBuffer != nullptr)
-		m_pDataRecordingInstance->copyAllAdditionalSignalsByIndex(nAdditionalIndex, pSignalsBuffer, nSignalsBufferSize);
+	if (pSignalsBuffer != nullptr) {
+		if (nSignalsBufferSize < nRecordCount)
+			throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
+		m_pDataRecordingInstance->copyAllAdditionalSignalsByIndex(nAdditionalIndex, pSignalsBuffer, nRecordCount);
+	}
 
 }
 
@@ -409,3 +430,98 @@ void CDataRecording::AddScaledAdditionalSignalsToDataTable(const LibMCDriver_Sca
 
 }
 
+void CDataRecording::AddAllSignalsToDataTable(LibMCEnv::PDataTable pDataTable, const std::string& sColumnPrefix)
+{
+	if (pDataTable.get() == nullptr)
+		throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+
+	// All columns are copied from the same snapshot, even if the recording is still being written.
+	size_t nRecordCount = m_pDataRecordingInstance->getRecordCount();
+
+	std::vector<uint32_t> uint32Buffer;
+	std::vector<double> doubleBuffer;
+	std::vector<int32_t> int32Buffer;
+	uint32Buffer.resize(nRecordCount);
+	doubleBuffer.resize(nRecordCount);
+	int32Buffer.resize(nRecordCount);
+
+	pDataTable->AddColumn(sColumnPrefix + "packetnumber", "Packet number", LibMCEnv::eDataTableColumnType::Uint32Column);
+	pDataTable->AddColumn(sColumnPrefix + "measurementtag", "Measurement tag", LibMCEnv::eDataTableColumnType::Uint32Column);
+	pDataTable->AddColumn(sColumnPrefix + "x", "X coordinate", LibMCEnv::eDataTableColumnType::DoubleColumn);
+	pDataTable->AddColumn(sColumnPrefix + "y", "Y coordinate", LibMCEnv::eDataTableColumnType::DoubleColumn);
+
+	if (nRecordCount > 0) {
+		m_pDataRecordingInstance->copyAllPacketNumbers(uint32Buffer.data(), nRecordCount);
+		pDataTable->SetUint32ColumnValues(sColumnPrefix + "packetnumber", uint32Buffer);
+		m_pDataRecordingInstance->copyAllMeasurementTags(uint32Buffer.data(), nRecordCount);
+		pDataTable->SetUint32ColumnValues(sColumnPrefix + "measurementtag", uint32Buffer);
+		m_pDataRecordingInstance->copyAllXCoordinates(doubleBuffer.data(), nRecordCount);
+		pDataTable->SetDoubleColumnValues(sColumnPrefix + "x", doubleBuffer);
+		m_pDataRecordingInstance->copyAllYCoordinates(doubleBuffer.data(), nRecordCount);
+		pDataTable->SetDoubleColumnValues(sColumnPrefix + "y", doubleBuffer);
+	}
+
+	uint32_t nSensorSignalCount = m_pDataRecordingInstance->getSensorValuesPerRecord();
+	for (uint32_t nSignalIndex = 0; nSignalIndex < nSensorSignalCount; nSignalIndex++) {
+		std::string sIdentifier = sColumnPrefix + "sensor_" + std::to_string(nSignalIndex);
+		pDataTable->AddColumn(sIdentifier, "Sensor signal " + std::to_string(nSignalIndex), LibMCEnv::eDataTableColumnType::Int32Column);
+		if (nRecordCount > 0) {
+			m_pDataRecordingInstance->copyAllSensorSignalsByIndex(nSignalIndex, int32Buffer.data(), nRecordCount);
+			pDataTable->SetInt32ColumnValues(sIdentifier, int32Buffer);
+		}
+	}
+
+	uint32_t nRTCSignalCount = m_pDataRecordingInstance->getRTCValuesPerRecord();
+	for (uint32_t nRTCIndex = 0; nRTCIndex < nRTCSignalCount; nRTCIndex++) {
+		std::string sIdentifier = sColumnPrefix + "rtc_" + std::to_string(nRTCIndex);
+		pDataTable->AddColumn(sIdentifier, "RTC signal " + std::to_string(nRTCIndex), LibMCEnv::eDataTableColumnType::Int32Column);
+		if (nRecordCount > 0) {
+			m_pDataRecordingInstance->copyAllRTCSignalsByIndex(nRTCIndex, int32Buffer.data(), nRecordCount);
+			pDataTable->SetInt32ColumnValues(sIdentifier, int32Buffer);
+		}
+	}
+
+	uint32_t nAdditionalSignalCount = m_pDataRecordingInstance->getAdditionalValuesPerRecord();
+	for (uint32_t nAdditionalIndex = 0; nAdditionalIndex < nAdditionalSignalCount; nAdditionalIndex++) {
+		std::string sIdentifier = sColumnPrefix + "additional_" + std::to_string(nAdditionalIndex);
+		pDataTable->AddColumn(sIdentifier, "Additional signal " + std::to_string(nAdditionalIndex), LibMCEnv::eDataTableColumnType::Int32Column);
+		if (nRecordCount > 0) {
+			m_pDataRecordingInstance->copyAllAdditionalSignalsByIndex(nAdditionalIndex, int32Buffer.data(), nRecordCount);
+			pDataTable->SetInt32ColumnValues(sIdentifier, int32Buffer);
+		}
+	}
+
+}
+
+void CDataRecording::RenderSensorSignalsToField(const LibMCDriver_ScanLabOIE_uint32 nSignalIndex, LibMCEnv::PDiscreteFieldData2D pField, const LibMCDriver_ScanLabOIE_double dScaleFactor, const LibMCDriver_ScanLabOIE_double dOffset, const LibMCDriver_ScanLabOIE_double dDefaultValue)
+{
+	if (pField.get() == nullptr)
+		throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+
+	if (nSignalIndex >= GetSensorSignalCount())
+		throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDSIGNALINDEX);
+
+	size_t nRecordCount = m_pDataRecordingInstance->getRecordCount();
+
+	std::vector<double> xCoordinates;
+	std::vector<double> yCoordinates;
+	std::vector<double> values;
+	xCoordinates.resize(nRecordCount);
+	yCoordinates.resize(nRecordCount);
+	values.resize(nRecordCount);
+
+	m_pDataRecordingInstance->copyAllXCoordinates(xCoordinates.data(), nRecordCount);
+	m_pDataRecordingInstance->copyAllYCoordinates(yCoordinates.data(), nRecordCount);
+	m_pDataRecordingInstance->copyAllScaledSensorSignalsByIndex(nSignalIndex, values.data(), nRecordCount, dScaleFactor, dOffset);
+
+	std::vector<LibMCEnv::sFieldData2DPoint> pointValues;
+	pointValues.resize(nRecordCount);
+	for (size_t nRecordIndex = 0; nRecordIndex < nRecordCount; nRecordIndex++) {
+		auto& pointValue = pointValues.at(nRecordIndex);
+		pointValue.m_Coordinates[0] = xCoordinates[nRecordIndex];
+		pointValue.m_Coordinates[1] = yCoordinates[nRecordIndex];
+		pointValue.m_Value = values[nRecordIndex];
+	}
+
+	pField->RenderAveragePointValues(dDefaultValue, LibMCEnv::eFieldSamplingMode::FloorCoordinate, 0.0, 0.0, pointValues);
+}
@@ -115,6 +115,10 @@ public:
 
 	void AddScaledAdditionalSignalsToDataTable(const LibMCDriver_ScanLabOIE_uint32 nAdditionalIndex, LibMCEnv::PDataTable pDataTable, const std::string& sColumnIdentifier, const std::string& sColumnDescription, const LibMCDriver_ScanLabOIE_double dScaleFactor, const LibMCDriver_ScanLabOIE_double dOffset) override;
 
+	void AddAllSignalsToDataTable(LibMCEnv::PDataTable pDataTable, const std::string& sColumnPrefix) override;
+
+	void RenderSensorSignalsToField(const LibMCDriver_ScanLabOIE_uint32 nSignalIndex, LibMCEnv::PDiscreteFieldData2D pField, const LibMCDriver_ScanLabOIE_double dScaleFactor, const LibMCDriver_ScanLabOIE_double dOffset, const LibMCDriver_ScanLabOIE_double dDefaultValue) override;
+
 };
 
 } // namespace Impl
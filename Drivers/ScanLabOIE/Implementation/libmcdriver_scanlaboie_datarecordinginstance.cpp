@@ -37,7 +37,6 @@ Abstract: This is a stub class definition of CDeviceConfiguration
 #include <stdexcept>
 using namespace LibMCDriver_ScanLabOIE::Impl;
 
-#define DATARECORDING_MINBUFFERSIZEINVALUES 256
 #define DATARECORDING_MINBUFFERSIZEINRECORDS 256
 #define DATARECORDING_MAXBUFFERSIZEINRECORDS (1024 * 1024)
 
@@ -45,42 +44,67 @@ using namespace LibMCDriver_ScanLabOIE::Impl;
 #include <iostream>
 #include <cstring>
 
-CDataRecordingBuffer::CDataRecordingBuffer(size_t nBufferSizeInValues)
-    : m_nCurrentPosition(0)
+CDataRecordingPage::CDataRecordingPage(size_t nCapacity, uint32_t nValuesPerRecord)
+    : m_nCapacity (nCapacity), m_nValuesPerRecord (nValuesPerRecord)
 {
-    m_RawData.resize(nBufferSizeInValues);
+    if (nCapacity == 0)
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDBUFFERSIZE);
+
+    m_PacketNumbers.resize(nCapacity);
+    m_MeasurementTags.resize(nCapacity);
+    m_XCoordinates.resize(nCapacity);
+    m_YCoordinates.resize(nCapacity);
+    m_SignalData.resize(nCapacity * (size_t)nValuesPerRecord);
 }
 
-CDataRecordingBuffer::~CDataRecordingBuffer()
+CDataRecordingPage::~CDataRecordingPage()
 {
 
 }
 
-bool CDataRecordingBuffer::hasSpace(size_t nValueCount)
+size_t CDataRecordingPage::getCapacity()
 {
-    if (nValueCount == 0)
-        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+    return m_nCapacity;
+}
 
-    return (m_nCurrentPosition + nValueCount) <= m_RawData.size();
+uint32_t* CDataRecordingPage::getPacketNumbers()
+{
+    return m_PacketNumbers.data();
 }
 
-int32_t* CDataRecordingBuffer::allocData(size_t nValueCount)
+uint32_t* CDataRecordingPage::getMeasurementTags()
 {
-    if (nValueCount == 0)
-        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
-    if ((m_nCurrentPosition + nValueCount) > m_RawData.size())
-        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFEROVERFLOW);
+    return m_MeasurementTags.data();
+}
 
-    int32_t * pData = &m_RawData.at(m_nCurrentPosition);
-    m_nCurrentPosition += nValueCount;
+double* CDataRecordingPage::getXCoordinates()
+{
+    return m_XCoordinates.data();
+}
 
-    return pData;
+double* CDataRecordingPage::getYCoordinates()
+{
+    return m_YCoordinates.data();
+}
+
+int32_t* CDataRecordingPage::getSignalData(uint32_t nValueIndex)
+{
+    if (nValueIndex >= m_nValuesPerRecord)
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
 
+    return &m_SignalData.at((size_t)nValueIndex * m_nCapacity);
 }
 
 
 CDataRecordingInstance::CDataRecordingInstance(uint32_t nSensorValuesPerRecord, uint32_t nRTCValuesPerRecord, uint32_t nAdditionalValuesPerRecord, uint32_t nBufferSizeInRecords)
-    : m_nBufferSizeInRecords (nBufferSizeInRecords)
+    : m_nPublishedRecordCount (0),
+    m_nWriteIndex (0),
+    m_pWritePage (nullptr),
+    m_nWritePageOffset (0),
+    m_pWriteSignalData (nullptr),
+    m_bRecordIsStarted (false),
+    m_nCurrentEntryDataIndex (0),
+    m_nBufferSizeInRecords (nBufferSizeInRecords)
 {
     if (nSensorValuesPerRecord <= 0)
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDVALUESPERRECORD);
@@ -100,8 +124,8 @@ CDataRecordingInstance::CDataRecordingInstance(uint32_t nSensorValuesPerRecord,
     if (nBufferSizeInRecords > DATARECORDING_MAXBUFFERSIZEINRECORDS)
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDBUFFERSIZE);
 
-    m_nValueCountPerBuffer = (size_t)m_nValuesPerRecord * (size_t)nBufferSizeInRecords;
-    memset((void*)&m_CurrentEntry, 0, sizeof(m_CurrentEntry));
+    for (auto & pageBlock : m_PageDirectory)
+        pageBlock.store(nullptr, std::memory_order_relaxed);
 }
 
 CDataRecordingInstance::~CDataRecordingInstance()
@@ -109,59 +133,126 @@ CDataRecordingInstance::~CDataRecordingInstance()
 
 }
 
+CDataRecordingPage* CDataRecordingInstance::getPage(size_t nPageIndex)
+{
+    size_t nBlockIndex = nPageIndex / SCANLABOIE_DATARECORDDIRECTORYSIZE;
+    if (nBlockIndex >= SCANLABOIE_DATARECORDDIRECTORYSIZE)
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINDEX);
+
+    sDataRecordingPageBlock* pPageBlock = m_PageDirectory[nBlockIndex].load(std::memory_order_acquire);
+    if (pPageBlock == nullptr)
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINDEX);
+
+    CDataRecordingPage* pPage = (*pPageBlock)[nPageIndex % SCANLABOIE_DATARECORDDIRECTORYSIZE].load(std::memory_order_acquire);
+    if (pPage == nullptr)
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINDEX);
+
+    return pPage;
+}
+
+CDataRecordingPage* CDataRecordingInstance::allocatePage(size_t nPageIndex)
+{
+    size_t nBlockIndex = nPageIndex / SCANLABOIE_DATARECORDDIRECTORYSIZE;
+    if (nBlockIndex >= SCANLABOIE_DATARECORDDIRECTORYSIZE)
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_RECORDINGCAPACITYEXCEEDED);
+
+    sDataRecordingPageBlock* pPageBlock = m_PageDirectory[nBlockIndex].load(std::memory_order_relaxed);
+    if (pPageBlock == nullptr) {
+        std::unique_ptr<sDataRecordingPageBlock> pNewPageBlock(new sDataRecordingPageBlock);
+        for (auto& page : *pNewPageBlock)
+            page.store(nullptr, std::memory_order_relaxed);
+
+        pPageBlock = pNewPageBlock.get();
+        m_PageBlocks.push_back(std::move(pNewPageBlock));
+        m_PageDirectory[nBlockIndex].store(pPageBlock, std::memory_order_release);
+    }
+
+    auto pNewPage = std::make_unique<CDataRecordingPage>(m_nBufferSizeInRecords, m_nValuesPerRecord);
+    CDataRecordingPage* pPage = pNewPage.get();
+    m_Pages.push_back(std::move(pNewPage));
+    (*pPageBlock)[nPageIndex % SCANLABOIE_DATARECORDDIRECTORYSIZE].store(pPage, std::memory_order_release);
+
+    return pPage;
+}
+
+void CDataRecordingInstance::iteratePageSegments(size_t nRecordCount, std::function<void(CDataRecordingPage* pPage, size_t nFirstRecordIndex, size_t nSegmentSize)> segmentCallback)
+{
+    size_t nPageSize = m_nBufferSizeInRecords;
+    size_t nFirstRecordIndex = 0;
+    size_t nPageIndex = 0;
+
+    while (nFirstRecordIndex < nRecordCount) {
+        size_t nSegmentSize = nRecordCount - nFirstRecordIndex;
+        if (nSegmentSize > nPageSize)
+            nSegmentSize = nPageSize;
+
+        segmentCallback(getPage(nPageIndex), nFirstRecordIndex, nSegmentSize);
+
+        nFirstRecordIndex += nSegmentSize;
+        nPageIndex++;
+    }
+}
+
+void CDataRecordingInstance::checkRecordCount(size_t nRecordCount)
+{
+    if (nRecordCount > getRecordCount())
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINDEX);
+}
+
 void CDataRecordingInstance::startRecord (uint32_t nPacketNumber, uint32_t nMeasurementTag, double dX, double dY)
 {
-    if (m_pCurrentBuffer.get() == nullptr) {
-        m_pCurrentBuffer = std::make_shared<CDataRecordingBuffer>(m_nValueCountPerBuffer);
-        m_Buffers.push_back(m_pCurrentBuffer);
+    // An unfinished record is simply overwritten.
+    size_t nPageIndex = m_nWriteIndex / m_nBufferSizeInRecords;
+    m_nWritePageOffset = m_nWriteIndex % m_nBufferSizeInRecords;
+
+    if ((m_pWritePage == nullptr) || (m_nWritePageOffset == 0)) {
+        if (m_Pages.size() > nPageIndex)
+            m_pWritePage = m_Pages.at(nPageIndex).get();
+        else
+            m_pWritePage = allocatePage(nPageIndex);
     }
-    
-    m_CurrentEntry.m_dX = dX;
-    m_CurrentEntry.m_dY = dY;
-    m_CurrentEntry.m_nPacketNumber = nPacketNumber;
-    m_CurrentEntry.m_nMeasurementTag = nMeasurementTag;
-    m_CurrentEntry.m_pData = m_pCurrentBuffer->allocData (m_nValuesPerRecord);
-    m_nCurrentEntryDataIndex = 0;
 
-    // If buffer is full, alloc a new buffer the next iteration
-    if (!m_pCurrentBuffer->hasSpace(m_nValuesPerRecord))
-        m_pCurrentBuffer = nullptr;
+    m_pWritePage->getPacketNumbers()[m_nWritePageOffset] = nPacketNumber;
+    m_pWritePage->getMeasurementTags()[m_nWritePageOffset] = nMeasurementTag;
+    m_pWritePage->getXCoordinates()[m_nWritePageOffset] = dX;
+    m_pWritePage->getYCoordinates()[m_nWritePageOffset] = dY;
+
+    // Signal arrays of a page are stored one after another, so value N of the record lives at N * page capacity.
+    m_pWriteSignalData = m_pWritePage->getSignalData(0) + m_nWritePageOffset;
+
+    m_nCurrentEntryDataIndex = 0;
+    m_bRecordIsStarted = true;
 }
 
 void CDataRecordingInstance::recordValue(int32_t nValue)
 {
     if (m_nCurrentEntryDataIndex >= m_nValuesPerRecord) 
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_TOOMANYVALUESINPACKET);
-    if (m_CurrentEntry.m_pData == nullptr)
+    if (!m_bRecordIsStarted)
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_PACKETISNOTRECORDING);
 
-    m_CurrentEntry.m_pData[m_nCurrentEntryDataIndex] = nValue;
+    m_pWriteSignalData[(size_t)m_nCurrentEntryDataIndex * m_nBufferSizeInRecords] = nValue;
     m_nCurrentEntryDataIndex++;
 
 }
 
 void CDataRecordingInstance::finishRecord()
 {
-    //std::cout << "finishing record: " << m_nCurrentEntryDataIndex << " of " << m_nValuesPerPacket << std::endl;
-
     if (m_nCurrentEntryDataIndex < m_nValuesPerRecord)
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_NOTENOUGHVALUESINPACKET);
-    if (m_CurrentEntry.m_pData == nullptr)
+    if (!m_bRecordIsStarted)
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_PACKETISNOTRECORDING);
 
-    size_t nNewIndex = 0;
-    auto & newEntry = m_Entries.allocDataRef (nNewIndex);
-    newEntry = m_CurrentEntry;
+    m_bRecordIsStarted = false;
+    m_nWriteIndex++;
 
-    m_CurrentEntry.m_dX = 0.0;
-    m_CurrentEntry.m_dY = 0.0;
-    m_CurrentEntry.m_nPacketNumber = 0;
-    m_CurrentEntry.m_pData = nullptr;
+    // Publishes the record to all readers.
+    m_nPublishedRecordCount.store(m_nWriteIndex, std::memory_order_release);
 }
 
 size_t CDataRecordingInstance::getRecordCount()
 {
-    return m_Entries.getCount();
+    return (size_t) m_nPublishedRecordCount.load(std::memory_order_acquire);
 }
 
 
@@ -174,17 +265,16 @@ void CDataRecordingInstance::writeToFile(const std::string& sFileName)
 
     fStream << "packet number, X, Y, value 0, value 1, ...." << std::endl;
 
-    size_t nCount = m_Entries.getCount();
-    for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
-        auto & entry = m_Entries.getDataRef(nIndex);
-        fStream << entry.m_nPacketNumber << ", " << entry.m_dX << ", " << entry.m_dY;
-        for (uint32_t nIndex = 0; nIndex < m_nValuesPerRecord; nIndex++)
-            fStream << ", " << entry.m_pData[nIndex];
-
-        fStream << std::endl;
-
-    }
+    size_t nCount = getRecordCount();
+    iteratePageSegments(nCount, [this, &fStream](CDataRecordingPage* pPage, size_t nFirstRecordIndex, size_t nSegmentSize) {
+        for (size_t nIndex = 0; nIndex < nSegmentSize; nIndex++) {
+            fStream << pPage->getPacketNumbers()[nIndex] << ", " << pPage->getXCoordinates()[nIndex] << ", " << pPage->getYCoordinates()[nIndex];
+            for (uint32_t nValueIndex = 0; nValueIndex < m_nValuesPerRecord; nValueIndex++)
+                fStream << ", " << pPage->getSignalData(nValueIndex)[nIndex];
 
+            fStream << std::endl;
+        }
+    });
 
     fStream.close();
 }
@@ -211,12 +301,21 @@ uint32_t CDataRecordingInstance::getBufferSizeInRecords()
     return m_nBufferSizeInRecords;
 }
 
-sDataRecordingEntry* CDataRecordingInstance::getRecord(uint32_t nIndex)
+sDataRecordingEntry CDataRecordingInstance::getRecord(size_t nIndex)
 {
-    if (nIndex >= m_Entries.getCount())
+    if (nIndex >= getRecordCount())
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINDEX);
 
-    return m_Entries.getData(nIndex);
+    CDataRecordingPage* pPage = getPage(nIndex / m_nBufferSizeInRecords);
+    size_t nPageOffset = nIndex % m_nBufferSizeInRecords;
+
+    sDataRecordingEntry entry;
+    entry.m_nPacketNumber = pPage->getPacketNumbers()[nPageOffset];
+    entry.m_nMeasurementTag = pPage->getMeasurementTags()[nPageOffset];
+    entry.m_dX = pPage->getXCoordinates()[nPageOffset];
+    entry.m_dY = pPage->getYCoordinates()[nPageOffset];
+
+    return entry;
 }
 
 PDataRecordingInstance CDataRecordingInstance::createEmptyDuplicate()
@@ -224,163 +323,129 @@ PDataRecordingInstance CDataRecordingInstance::createEmptyDuplicate()
     return std::make_shared<CDataRecordingInstance>(m_nSensorValueCount, m_nRTCValueCount, m_nAdditionalValueCount, m_nBufferSizeInRecords);
 }
 
-int32_t* CDataRecordingInstance::getRTCData(size_t nRecordIndex)
+void CDataRecordingInstance::copySignalsOfRecord(size_t nRecordIndex, uint32_t nFirstValueIndex, uint32_t nValueCount, int32_t* pSignalBuffer)
 {
-    if (m_nRTCValueCount == 0)
-        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_NORTCVALUESAVAILABLE);
+    if (nRecordIndex >= getRecordCount())
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINDEX);
 
-    auto pRecord = m_Entries.getData(nRecordIndex);
-    return &pRecord->m_pData[m_nFirstRTCValueIndex];
+    CDataRecordingPage* pPage = getPage(nRecordIndex / m_nBufferSizeInRecords);
+    size_t nPageOffset = nRecordIndex % m_nBufferSizeInRecords;
+
+    for (uint32_t nIndex = 0; nIndex < nValueCount; nIndex++)
+        pSignalBuffer[nIndex] = pPage->getSignalData(nFirstValueIndex + nIndex)[nPageOffset];
 }
 
-int32_t* CDataRecordingInstance::getSensorData(size_t nRecordIndex)
+void CDataRecordingInstance::copySignalValues(uint32_t nValueIndex, int32_t* pSignalBuffer, size_t nRecordCount)
 {
-    if (m_nSensorValueCount == 0)
-        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_NOSENSORVALUESAVAILABLE);
-
-    auto pRecord = m_Entries.getData(nRecordIndex);
-    return &pRecord->m_pData[m_nFirstSensorValueIndex];
+    iteratePageSegments(nRecordCount, [nValueIndex, pSignalBuffer](CDataRecordingPage* pPage, size_t nFirstRecordIndex, size_t nSegmentSize) {
+        memcpy(&pSignalBuffer[nFirstRecordIndex], pPage->getSignalData(nValueIndex), nSegmentSize * sizeof(int32_t));
+    });
 }
 
-int32_t* CDataRecordingInstance::getAdditionalData(size_t nRecordIndex)
+void CDataRecordingInstance::copyScaledSignalValues(uint32_t nValueIndex, double* pSignalBuffer, size_t nRecordCount, double dScaleFactor, double dOffset)
 {
-    if (m_nAdditionalValueCount == 0)
-        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_NOADDITIONALVALUESAVAILABLE);
-
-    auto pRecord = m_Entries.getData(nRecordIndex);
-    return &pRecord->m_pData[m_nFirstAdditionalValueIndex];
+    iteratePageSegments(nRecordCount, [nValueIndex, pSignalBuffer, dScaleFactor, dOffset](CDataRecordingPage* pPage, size_t nFirstRecordIndex, size_t nSegmentSize) {
+        const int32_t* pSource = pPage->getSignalData(nValueIndex);
+        double* pTarget = &pSignalBuffer[nFirstRecordIndex];
+        for (size_t nIndex = 0; nIndex < nSegmentSize; nIndex++)
+            pTarget[nIndex] = pSource[nIndex] * dScaleFactor + dOffset;
+    });
 }
 
 
-
 void CDataRecordingInstance::copyRTCSignals(size_t nRecordIndex, int32_t* pRTCSignalBuffer, size_t nRTCSignalBufferSize)
 {
-    uint32_t nRTCValuesPerRecord = getRTCValuesPerRecord();
-    int32_t* pRTCData = getRTCData(nRecordIndex);
+    if (m_nRTCValueCount == 0)
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_NORTCVALUESAVAILABLE);
 
-    if (nRTCSignalBufferSize < (size_t)nRTCValuesPerRecord)
+    if (nRTCSignalBufferSize < (size_t)m_nRTCValueCount)
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
 
-    for (uint32_t nIndex = 0; nIndex < nRTCValuesPerRecord; nIndex++)
-        pRTCSignalBuffer[nIndex] = pRTCData[nIndex];
-
+    copySignalsOfRecord(nRecordIndex, m_nFirstRTCValueIndex, m_nRTCValueCount, pRTCSignalBuffer);
 }
 
 
 void CDataRecordingInstance::copySensorSignals(size_t nRecordIndex, int32_t* pSensorSignalBuffer, size_t nSensorSignalBufferSize)
 {
-    uint32_t nSensorValuesPerRecord = getSensorValuesPerRecord();
-    int32_t* pSensorData = getSensorData(nRecordIndex);
+    if (m_nSensorValueCount == 0)
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_NOSENSORVALUESAVAILABLE);
 
-    if (nSensorSignalBufferSize < (size_t)nSensorValuesPerRecord)
+    if (nSensorSignalBufferSize < (size_t)m_nSensorValueCount)
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
 
-    for (uint32_t nIndex = 0; nIndex < nSensorValuesPerRecord; nIndex++)
-        pSensorSignalBuffer[nIndex] = pSensorData[nIndex];
-
+    copySignalsOfRecord(nRecordIndex, m_nFirstSensorValueIndex, m_nSensorValueCount, pSensorSignalBuffer);
 }
 
 
 void CDataRecordingInstance::copyAdditionalSignals(size_t nRecordIndex, int32_t* pAdditionalSignalBuffer, size_t nAdditionalSignalBufferSize)
 {
-    uint32_t nAdditionalValuesPerRecord = getAdditionalValuesPerRecord();
-    int32_t* pAdditionalData = getAdditionalData(nRecordIndex);
+    if (m_nAdditionalValueCount == 0)
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_NOADDITIONALVALUESAVAILABLE);
 
-    if (nAdditionalSignalBufferSize < (size_t)nAdditionalValuesPerRecord)
+    if (nAdditionalSignalBufferSize < (size_t)m_nAdditionalValueCount)
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
 
-    for (uint32_t nIndex = 0; nIndex < nAdditionalValuesPerRecord; nIndex++)
-        pAdditionalSignalBuffer[nIndex] = pAdditionalData[nIndex];
-
+    copySignalsOfRecord(nRecordIndex, m_nFirstAdditionalValueIndex, m_nAdditionalValueCount, pAdditionalSignalBuffer);
 }
 
-void CDataRecordingInstance::copyAllXCoordinates(double* pCoordinateBuffer, size_t nCoordinateBufferSize)
+void CDataRecordingInstance::copyAllXCoordinates(double* pCoordinateBuffer, size_t nRecordCount)
 {
-    size_t nRecordCount = getRecordCount();
     if (nRecordCount == 0)
         return;
 
     if (pCoordinateBuffer == nullptr)
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+    checkRecordCount(nRecordCount);
 
-    if (nCoordinateBufferSize < nRecordCount)
-        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
-
-    double * pTarget = pCoordinateBuffer;
-    for (size_t nIndex = 0; nIndex < nRecordCount; nIndex++) {
-        auto pRecord = m_Entries.getData(nIndex);
-        *pTarget = pRecord->m_dX;
-        pTarget++;
-    }
-
+    iteratePageSegments(nRecordCount, [pCoordinateBuffer](CDataRecordingPage* pPage, size_t nFirstRecordIndex, size_t nSegmentSize) {
+        memcpy(&pCoordinateBuffer[nFirstRecordIndex], pPage->getXCoordinates(), nSegmentSize * sizeof(double));
+    });
 }
 
-void CDataRecordingInstance::copyAllYCoordinates(double* pCoordinateBuffer, size_t nCoordinateBufferSize)
+void CDataRecordingInstance::copyAllYCoordinates(double* pCoordinateBuffer, size_t nRecordCount)
 {
-    size_t nRecordCount = getRecordCount();
     if (nRecordCount == 0)
         return;
 
     if (pCoordinateBuffer == nullptr)
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+    checkRecordCount(nRecordCount);
 
-    if (nCoordinateBufferSize < nRecordCount)
-        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
-
-    double* pTarget = pCoordinateBuffer;
-    for (size_t nIndex = 0; nIndex < nRecordCount; nIndex++) {
-        auto pRecord = m_Entries.getData(nIndex);
-        *pTarget = pRecord->m_dY;
-        pTarget++;
-    }
-
+    iteratePageSegments(nRecordCount, [pCoordinateBuffer](CDataRecordingPage* pPage, size_t nFirstRecordIndex, size_t nSegmentSize) {
+        memcpy(&pCoordinateBuffer[nFirstRecordIndex], pPage->getYCoordinates(), nSegmentSize * sizeof(double));
+    });
 }
 
-void CDataRecordingInstance::copyAllMeasurementTags(uint32_t* pMeasurementTagBuffer, size_t nMeasurementTagBufferSize)
+void CDataRecordingInstance::copyAllMeasurementTags(uint32_t* pMeasurementTagBuffer, size_t nRecordCount)
 {
-    size_t nRecordCount = getRecordCount();
     if (nRecordCount == 0)
         return;
 
     if (pMeasurementTagBuffer == nullptr)
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+    checkRecordCount(nRecordCount);
 
-    if (nMeasurementTagBufferSize < nRecordCount)
-        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
-
-    uint32_t* pTarget = pMeasurementTagBuffer;
-    for (size_t nIndex = 0; nIndex < nRecordCount; nIndex++) {
-        auto pRecord = m_Entries.getData(nIndex);
-        *pTarget = pRecord->m_nMeasurementTag;
-        pTarget++;
-    }
-
+    iteratePageSegments(nRecordCount, [pMeasurementTagBuffer](CDataRecordingPage* pPage, size_t nFirstRecordIndex, size_t nSegmentSize) {
+        memcpy(&pMeasurementTagBuffer[nFirstRecordIndex], pPage->getMeasurementTags(), nSegmentSize * sizeof(uint32_t));
+    });
 }
 
-void CDataRecordingInstance::copyAllPacketNumbers(uint32_t * pPacketNumberBuffer, size_t nPacketNumberBufferSize)
+void CDataRecordingInstance::copyAllPacketNumbers(uint32_t * pPacketNumberBuffer, size_t nRecordCount)
 {
-    size_t nRecordCount = getRecordCount();
     if (nRecordCount == 0)
         return;
 
     if (pPacketNumberBuffer == nullptr)
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+    checkRecordCount(nRecordCount);
 
-    if (nPacketNumberBufferSize < nRecordCount)
-        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
-
-    uint32_t* pTarget = pPacketNumberBuffer;
-    for (size_t nIndex = 0; nIndex < nRecordCount; nIndex++) {
-        auto pRecord = m_Entries.getData(nIndex);
-        *pTarget = pRecord->m_nPacketNumber;
-        pTarget++;
-    }
-
+    iteratePageSegments(nRecordCount, [pPacketNumberBuffer](CDataRecordingPage* pPage, size_t nFirstRecordIndex, size_t nSegmentSize) {
+        memcpy(&pPacketNumberBuffer[nFirstRecordIndex], pPage->getPacketNumbers(), nSegmentSize * sizeof(uint32_t));
+    });
 }
 
-void CDataRecordingInstance::copyAllRTCSignalsByIndex(uint32_t nRTCIndex, int32_t* pRTCSignalBuffer, size_t nRTCSignalBufferSize)
+void CDataRecordingInstance::copyAllRTCSignalsByIndex(uint32_t nRTCIndex, int32_t* pRTCSignalBuffer, size_t nRecordCount)
 {
-    size_t nRecordCount = getRecordCount();
     if (nRecordCount == 0)
         return;
 
@@ -389,21 +454,13 @@ void CDataRecordingInstance::copyAllRTCSignalsByIndex(uint32_t nRTCIndex, int32_
 
     if (pRTCSignalBuffer == nullptr)
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+    checkRecordCount(nRecordCount);
 
-    if (nRTCSignalBufferSize < nRecordCount)
-        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
-
-    int32_t* pTarget = pRTCSignalBuffer;
-    for (size_t nRecordIndex = 0; nRecordIndex < nRecordCount; nRecordIndex++) {
-        int32_t* pRTCData = getRTCData(nRecordIndex);
-        *pTarget = pRTCData[nRTCIndex];
-        pTarget++;
-    }
+    copySignalValues(m_nFirstRTCValueIndex + nRTCIndex, pRTCSignalBuffer, nRecordCount);
 }
 
-void CDataRecordingInstance::copyAllScaledRTCSignalsByIndex(uint32_t nRTCIndex, double* pRTCSignalBuffer, size_t nRTCSignalBufferSize, double dScaleFactor, double dOffset)
+void CDataRecordingInstance::copyAllScaledRTCSignalsByIndex(uint32_t nRTCIndex, double* pRTCSignalBuffer, size_t nRecordCount, double dScaleFactor, double dOffset)
 {
-    size_t nRecordCount = getRecordCount();
     if (nRecordCount == 0)
         return;
 
@@ -412,22 +469,14 @@ void CDataRecordingInstance::copyAllScaledRTCSignalsByIndex(uint32_t nRTCIndex,
 
     if (pRTCSignalBuffer == nullptr)
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+    checkRecordCount(nRecordCount);
 
-    if (nRTCSignalBufferSize < nRecordCount)
-        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
-
-    double* pTarget = pRTCSignalBuffer;
-    for (size_t nRecordIndex = 0; nRecordIndex < nRecordCount; nRecordIndex++) {
-        int32_t* pRTCData = getRTCData(nRecordIndex);
-        *pTarget = pRTCData[nRTCIndex] * dScaleFactor + dOffset;
-        pTarget++;
-    }
+    copyScaledSignalValues(m_nFirstRTCValueIndex + nRTCIndex, pRTCSignalBuffer, nRecordCount, dScaleFactor, dOffset);
 }
 
 
-void CDataRecordingInstance::copyAllSensorSignalsByIndex(uint32_t nSensorIndex, int32_t* pSensorSignalBuffer, size_t nSensorSignalBufferSize)
+void CDataRecordingInstance::copyAllSensorSignalsByIndex(uint32_t nSensorIndex, int32_t* pSensorSignalBuffer, size_t nRecordCount)
 {
-    size_t nRecordCount = getRecordCount();
     if (nRecordCount == 0)
         return;
 
@@ -436,23 +485,14 @@ void CDataRecordingInstance::copyAllSensorSignalsByIndex(uint32_t nSensorIndex,
 
     if (pSensorSignalBuffer == nullptr)
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+    checkRecordCount(nRecordCount);
 
-    if (nSensorSignalBufferSize < nRecordCount)
-        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
-
-    int32_t* pTarget = pSensorSignalBuffer;
-    for (size_t nRecordIndex = 0; nRecordIndex < nRecordCount; nRecordIndex++) {
-        int32_t* pSensorData = getSensorData(nRecordIndex);
-        *pTarget = pSensorData[nSensorIndex];
-        pTarget++;
-    }
-
+    copySignalValues(m_nFirstSensorValueIndex + nSensorIndex, pSensorSignalBuffer, nRecordCount);
 }
 
 
-void CDataRecordingInstance::copyAllScaledSensorSignalsByIndex(uint32_t nSensorIndex, double* pSensorSignalBuffer, size_t nSensorSignalBufferSize, double dScaleFactor, double dOffset)
+void CDataRecordingInstance::copyAllScaledSensorSignalsByIndex(uint32_t nSensorIndex, double* pSensorSignalBuffer, size_t nRecordCount, double dScaleFactor, double dOffset)
 {
-    size_t nRecordCount = getRecordCount();
     if (nRecordCount == 0)
         return;
 
@@ -461,22 +501,13 @@ void CDataRecordingInstance::copyAllScaledSensorSignalsByIndex(uint32_t nSensorI
 
     if (pSensorSignalBuffer == nullptr)
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+    checkRecordCount(nRecordCount);
 
-    if (nSensorSignalBufferSize < nRecordCount)
-        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
-
-    double* pTarget = pSensorSignalBuffer;
-    for (size_t nRecordIndex = 0; nRecordIndex < nRecordCount; nRecordIndex++) {
-        int32_t* pSensorData = getSensorData(nRecordIndex);
-        *pTarget = pSensorData[nSensorIndex] * dScaleFactor + dOffset;
-        pTarget++;
-    }
-
+    copyScaledSignalValues(m_nFirstSensorValueIndex + nSensorIndex, pSensorSignalBuffer, nRecordCount, dScaleFactor, dOffset);
 }
 
-void CDataRecordingInstance::copyAllAdditionalSignalsByIndex(uint32_t nAdditionalIndex, int32_t* pAdditionalSignalBuffer, size_t nAdditionalSignalBufferSize)
+void CDataRecordingInstance::copyAllAdditionalSignalsByIndex(uint32_t nAdditionalIndex, int32_t* pAdditionalSignalBuffer, size_t nRecordCount)
 {
-    size_t nRecordCount = getRecordCount();
     if (nRecordCount == 0)
         return;
 
@@ -485,22 +516,13 @@ void CDataRecordingInstance::copyAllAdditionalSignalsByIndex(uint32_t nAdditiona
 
     if (pAdditionalSignalBuffer == nullptr)
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+    checkRecordCount(nRecordCount);
 
-    if (nAdditionalSignalBufferSize < nRecordCount)
-        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
-
-    int32_t* pTarget = pAdditionalSignalBuffer;
-    for (size_t nRecordIndex = 0; nRecordIndex < nRecordCount; nRecordIndex++) {
-        int32_t* pAdditionalData = getAdditionalData(nRecordIndex);
-        *pTarget = pAdditionalData[nAdditionalIndex];
-        pTarget++;
-    }
-
+    copySignalValues(m_nFirstAdditionalValueIndex + nAdditionalIndex, pAdditionalSignalBuffer, nRecordCount);
 }
 
-void CDataRecordingInstance::copyAllScaledAdditionalSignalsByIndex(uint32_t nAdditionalIndex, double* pAdditionalSignalBuffer, size_t nAdditionalSignalBufferSize, double dScaleFactor, double dOffset)
+void CDataRecordingInstance::copyAllScaledAdditionalSignalsByIndex(uint32_t nAdditionalIndex, double* pAdditionalSignalBuffer, size_t nRecordCount, double dScaleFactor, double dOffset)
 {
-    size_t nRecordCount = getRecordCount();
     if (nRecordCount == 0)
         return;
 
@@ -509,16 +531,8 @@ void CDataRecordingInstance::copyAllScaledAdditionalSignalsByIndex(uint32_t nAdd
 
     if (pAdditionalSignalBuffer == nullptr)
         throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+    checkRecordCount(nRecordCount);
 
-    if (nAdditionalSignalBufferSize < nRecordCount)
-        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_BUFFERTOOSMALL);
-
-    double* pTarget = pAdditionalSignalBuffer;
-    for (size_t nRecordIndex = 0; nRecordIndex < nRecordCount; nRecordIndex++) {
-        int32_t* pAdditionalData = getAdditionalData(nRecordIndex);
-        *pTarget = pAdditionalData[nAdditionalIndex] * dScaleFactor + dOffset;
-        pTarget++;
-    }
-
+    copyScaledSignalValues(m_nFirstAdditionalValueIndex + nAdditionalIndex, pAdditionalSignalBuffer, nRecordCount, dScaleFactor, dOffset);
 }
 
@@ -37,7 +37,6 @@ Abstract: This is the class declaration of CDeviceConfiguration
 
 #include "libmcdriver_scanlaboie_interfaces.hpp"
 #include "libmcdriver_scanlaboie_sdk.hpp"
-#include "libmcdriver_scanlaboie_pagedvector.hpp"
 
 // Parent classes
 #include "libmcdriver_scanlaboie_base.hpp"
@@ -50,33 +49,55 @@ Abstract: This is the class declaration of CDeviceConfiguration
 #include <vector>
 #include <list>
 #include <fstream>
+#include <atomic>
+#include <array>
+#include <memory>
+#include <functional>
 
 namespace LibMCDriver_ScanLabOIE {
 namespace Impl {
 
-#define SCANLABOIE_DATARECORDPAGESIZE (1024 * 256)
+// The page directory has two levels of SCANLABOIE_DATARECORDDIRECTORYSIZE entries each.
+#define SCANLABOIE_DATARECORDDIRECTORYSIZE 4096
 
 /*************************************************************************************************************************
- Class declaration of CDeviceConfiguration 
+ Class declaration of CDataRecordingPage
 **************************************************************************************************************************/
 
-class CDataRecordingBuffer {
+// A page holds a fixed number of records in structure-of-arrays layout:
+// One contiguous array for packet numbers, measurement tags, X and Y, and one contiguous array per signal.
+class CDataRecordingPage {
 private:
-    std::vector<int32_t> m_RawData;
-    size_t m_nCurrentPosition;
+    size_t m_nCapacity;
+    uint32_t m_nValuesPerRecord;
+
+    std::vector<uint32_t> m_PacketNumbers;
+    std::vector<uint32_t> m_MeasurementTags;
+    std::vector<double> m_XCoordinates;
+    std::vector<double> m_YCoordinates;
+    std::vector<int32_t> m_SignalData;
+
 public:
 
-    CDataRecordingBuffer(size_t nBufferSizeInValues);
+    CDataRecordingPage(size_t nCapacity, uint32_t nValuesPerRecord);
+
+    virtual ~CDataRecordingPage();
+
+    size_t getCapacity();
 
-    virtual ~CDataRecordingBuffer();
+    uint32_t* getPacketNumbers();
 
-    bool hasSpace(size_t nValueCount);
+    uint32_t* getMeasurementTags();
 
-    int32_t* allocData(size_t nValueCount);
+    double* getXCoordinates();
+
+    double* getYCoordinates();
+
+    int32_t* getSignalData(uint32_t nValueIndex);
 
 };
 
-typedef std::shared_ptr<CDataRecordingBuffer> PDataRecordingBuffer;
+typedef std::unique_ptr<CDataRecordingPage> UDataRecordingPage;
 
 typedef struct _sDataRecordingEntry
 {
@@ -84,26 +105,41 @@ typedef struct _sDataRecordingEntry
     uint32_t m_nMeasurementTag;
     double m_dX;
     double m_dY;
-    int32_t* m_pData;
 
 } sDataRecordingEntry;
 
+typedef std::array<std::atomic<CDataRecordingPage*>, SCANLABOIE_DATARECORDDIRECTORYSIZE> sDataRecordingPageBlock;
+
 
+/*************************************************************************************************************************
+ Class declaration of CDataRecordingInstance
+**************************************************************************************************************************/
 
 class CDataRecordingInstance;
 
 typedef std::shared_ptr<CDataRecordingInstance> PDataRecordingInstance;
 
+// A recording has a single producer, the OIE packet callback, and any number of readers.
+// The producer fills the record at index RecordCount and publishes it by incrementing the record count.
+// Pages are never moved or freed while the recording exists, so readers only need to snapshot the
+// record count and never have to take a lock.
 class CDataRecordingInstance {
 private:
 
-    std::vector<PDataRecordingBuffer> m_Buffers;
-    PDataRecordingBuffer m_pCurrentBuffer;
+    // Owned by the producer. Readers access pages only via the page directory.
+    std::vector<UDataRecordingPage> m_Pages;
+    std::vector<std::unique_ptr<sDataRecordingPageBlock>> m_PageBlocks;
+    std::array<std::atomic<sDataRecordingPageBlock*>, SCANLABOIE_DATARECORDDIRECTORYSIZE> m_PageDirectory;
 
-    sDataRecordingEntry m_CurrentEntry;
-    uint32_t m_nCurrentEntryDataIndex;
+    std::atomic<uint64_t> m_nPublishedRecordCount;
 
-    CPagedVector<sDataRecordingEntry, SCANLABOIE_DATARECORDPAGESIZE> m_Entries;
+    // Producer state of the current record
+    size_t m_nWriteIndex;
+    CDataRecordingPage* m_pWritePage;
+    size_t m_nWritePageOffset;
+    int32_t* m_pWriteSignalData;
+    bool m_bRecordIsStarted;
+    uint32_t m_nCurrentEntryDataIndex;
 
     uint32_t m_nValuesPerRecord;
 
@@ -115,11 +151,21 @@ private:
     uint32_t m_nAdditionalValueCount;
 
     uint32_t m_nBufferSizeInRecords;
-    size_t m_nValueCountPerBuffer;
-    
-    int32_t* getRTCData (size_t nRecordIndex);
-    int32_t* getSensorData(size_t nRecordIndex);
-    int32_t* getAdditionalData(size_t nRecordIndex);
+
+    CDataRecordingPage* getPage(size_t nPageIndex);
+
+    CDataRecordingPage* allocatePage(size_t nPageIndex);
+
+    // Calls the callback for each page segment of the first nRecordCount records. nRecordCount MUST NOT exceed the published record count.
+    void iteratePageSegments(size_t nRecordCount, std::function<void(CDataRecordingPage* pPage, size_t nFirstRecordIndex, size_t nSegmentSize)> segmentCallback);
+
+    void checkRecordCount(size_t nRecordCount);
+
+    void copySignalValues(uint32_t nValueIndex, int32_t* pSignalBuffer, size_t nRecordCount);
+
+    void copyScaledSignalValues(uint32_t nValueIndex, double* pSignalBuffer, size_t nRecordCount, double dScaleFactor, double dOffset);
+
+    void copySignalsOfRecord(size_t nRecordIndex, uint32_t nFirstValueIndex, uint32_t nValueCount, int32_t* pSignalBuffer);
 
 public:
 
@@ -133,6 +179,7 @@ public:
 
     void finishRecord();
 
+    // Returns the number of published records. Every record below this count is complete and immutable.
     size_t getRecordCount();
 
     uint32_t getAdditionalValuesPerRecord ();
@@ -149,29 +196,31 @@ public:
     
     void copyAdditionalSignals(size_t nRecordIndex, int32_t* pAdditionalSignalBuffer, size_t nAdditionalSignalBufferSize);
 
-    void copyAllXCoordinates(double * pCoordinateBuffer, size_t nCoordinateBufferSize);
+    // The copyAll functions copy the first nRecordCount records, which allows readers to work on a consistent snapshot.
+    // nRecordCount MUST NOT exceed getRecordCount.
+    void copyAllXCoordinates(double * pCoordinateBuffer, size_t nRecordCount);
 
-    void copyAllYCoordinates(double* pCoordinateBuffer, size_t nCoordinateBufferSize);
+    void copyAllYCoordinates(double* pCoordinateBuffer, size_t nRecordCount);
 
-    void copyAllPacketNumbers(uint32_t* pPacketNumberBuffer, size_t nPacketNumberBufferSize);
+    void copyAllPacketNumbers(uint32_t* pPacketNumberBuffer, size_t nRecordCount);
 
-    void copyAllMeasurementTags(uint32_t* pMeasurementTagBuffer, size_t nMeasurementTagBufferSize);
+    void copyAllMeasurementTags(uint32_t* pMeasurementTagBuffer, size_t nRecordCount);
 
-    void copyAllRTCSignalsByIndex(uint32_t nRTCIndex, int32_t* pRTCSignalBuffer, size_t nRTCSignalBufferSize);
+    void copyAllRTCSignalsByIndex(uint32_t nRTCIndex, int32_t* pRTCSignalBuffer, size_t nRecordCount);
 
-    void copyAllScaledRTCSignalsByIndex(uint32_t nRTCIndex, double* pRTCSignalBuffer, size_t nRTCSignalBufferSize, double dScaleFactor, double dOffset);
+    void copyAllScaledRTCSignalsByIndex(uint32_t nRTCIndex, double* pRTCSignalBuffer, size_t nRecordCount, double dScaleFactor, double dOffset);
 
-    void copyAllSensorSignalsByIndex(uint32_t nSensorIndex, int32_t* pSensorSignalBuffer, size_t nSensorSignalBufferSize);
+    void copyAllSensorSignalsByIndex(uint32_t nSensorIndex, int32_t* pSensorSignalBuffer, size_t nRecordCount);
 
-    void copyAllScaledSensorSignalsByIndex(uint32_t nSensorIndex, double* pSensorSignalBuffer, size_t nSensorSignalBufferSize, double dScaleFactor, double dOffset);
+    void copyAllScaledSensorSignalsByIndex(uint32_t nSensorIndex, double* pSensorSignalBuffer, size_t nRecordCount, double dScaleFactor, double dOffset);
 
-    void copyAllAdditionalSignalsByIndex(uint32_t nAdditionalIndex, int32_t* pAdditionalSignalBuffer, size_t nAdditionalSignalBufferSize);
+    void copyAllAdditionalSignalsByIndex(uint32_t nAdditionalIndex, int32_t* pAdditionalSignalBuffer, size_t nRecordCount);
 
-    void copyAllScaledAdditionalSignalsByIndex(uint32_t nAdditionalIndex, double* pAdditionalSignalBuffer, size_t nAdditionalSignalBufferSize, double dScaleFactor, double dOffset);
+    void copyAllScaledAdditionalSignalsByIndex(uint32_t nAdditionalIndex, double* pAdditionalSignalBuffer, size_t nRecordCount, double dScaleFactor, double dOffset);
 
     void writeToFile(const std::string & sFileName);
 
-    sDataRecordingEntry* getRecord (uint32_t nIndex);
+    sDataRecordingEntry getRecord (size_t nIndex);
 
     PDataRecordingInstance createEmptyDuplicate ();
 
@@ -40,6 +40,7 @@ Abstract: This is a stub class definition of COIEDevice
 #include <iostream>
 #include <cstring>
 #include <sstream>
+#include <thread>
 
 // Include custom headers here.
 using namespace LibMCDriver_ScanLabOIE::Impl;
@@ -117,7 +118,8 @@ COIEDeviceInstance::COIEDeviceInstance(PScanLabOIESDK pOIESDK, oie_instance pIns
 	  m_nPacketReceiveCounter (0),
 	  m_nPacketReceiveSkipCounter (1),
 	  m_DeviceDriverType(eOIEDeviceDriverType::Unknown),
-	  m_RecordingFrequency(LibMCDriver_ScanLabOIE::eOIERecordingFrequency::Record100kHz)
+	  m_RecordingFrequency(LibMCDriver_ScanLabOIE::eOIERecordingFrequency::Record100kHz),
+	  m_pRecordingInWrite (nullptr)
 
 {
 	if ((pOIESDK.get() == nullptr) || (pInstance == nullptr) || (pWorkingDirectory.get () == nullptr) || (pDeviceConfiguration == nullptr))
@@ -721,9 +723,16 @@ void COIEDeviceInstance::onPacketEvent(oie_device device, const oie_pkt* pkt)
 
 			if ((device == m_pDevice) && (pkt != nullptr)) {
 
-				std::lock_guard<std::mutex> lockGuard(m_RecordingMutex);
+				// The recording is only exchanged under the lock. The packet itself is appended lock-free,
+				// as the recording instance allows a single writer and concurrent readers.
+				PDataRecordingInstance pDataRecording;
+				{
+					std::lock_guard<std::mutex> lockGuard(m_RecordingMutex);
+					pDataRecording = m_pCurrentDataRecording;
+					m_pRecordingInWrite.store(pDataRecording.get());
+				}
 
-				if (m_pCurrentDataRecording.get() != nullptr) {
+				if (pDataRecording.get() != nullptr) {
 
 
 					double dX = 0.0;
@@ -744,7 +753,7 @@ void COIEDeviceInstance::onPacketEvent(oie_device device, const oie_pkt* pkt)
 						std::cout << "Measurement tag" << *pMeasurementTag << " at packet ID " << *pPacketNumber << std::endl;
 					}*/
 
-					m_pCurrentDataRecording->startRecord(*pPacketNumber, *pMeasurementTag, dX, dY);
+					pDataRecording->startRecord(*pPacketNumber, *pMeasurementTag, dX, dY);
 					/*if (n_LastReceivedMeasurementTag != *pMeasurementTag) {
 						std::cout << "New Measurement tag" << *pMeasurementTag << " at packet ID " << *pPacketNumber << std::endl;
 					}*/
@@ -758,7 +767,7 @@ void COIEDeviceInstance::onPacketEvent(oie_device device, const oie_pkt* pkt)
 					{
 						int32_t nValue = 0;
 						m_pOIESDK->checkError(m_pOIESDK->oie_pkt_get_sensor_signal(pkt, sensorSignalIndex, &nValue));
-						m_pCurrentDataRecording->recordValue(nValue);
+						pDataRecording->recordValue(nValue);
 					}
 
 					// record RTC values second
@@ -769,7 +778,7 @@ void COIEDeviceInstance::onPacketEvent(oie_device device, const oie_pkt* pkt)
 						int32_t nValue = 0;
 						m_pOIESDK->checkError(m_pOIESDK->oie_pkt_get_rtc_signal(pkt, rtcSignalIndex, &nValue));
 
-						m_pCurrentDataRecording->recordValue(nValue);
+						pDataRecording->recordValue(nValue);
 					}
 
 					// Record additional values last
@@ -782,13 +791,15 @@ void COIEDeviceInstance::onPacketEvent(oie_device device, const oie_pkt* pkt)
 						m_pOIESDK->checkError(m_pOIESDK->oie_pkt_get_app_data(pkt, additionalSignalIndex, &nValue));
 						//std::cout << "   - index #" << additionalSignalIndex << ": " << nValue << std::endl;
 
-						m_pCurrentDataRecording->recordValue(nValue);
+						pDataRecording->recordValue(nValue);
 					}
 
 
-					m_pCurrentDataRecording->finishRecord();
+					pDataRecording->finishRecord();
 
 				}
+
+				m_pRecordingInWrite.store(nullptr);
 			}
 			else {
 				//std::cout << "Packet event: with null" << std::endl;
@@ -803,6 +814,7 @@ void COIEDeviceInstance::onPacketEvent(oie_device device, const oie_pkt* pkt)
 	}
 	catch (...) {
 		//std::cout << "error getting data" << std::endl;
+		m_pRecordingInWrite.store(nullptr);
 	}
 }
 
@@ -820,6 +832,13 @@ void COIEDeviceInstance::onErrorEvent(oie_device device, oie_error error, int32_
 }
 
 
+void COIEDeviceInstance::waitForRecordingWrite(CDataRecordingInstance* pRecording)
+{
+	// The packet callback fetches its recording under m_RecordingMutex, so this only waits for at most one packet.
+	while ((pRecording != nullptr) && (m_pRecordingInWrite.load() == pRecording))
+		std::this_thread::yield();
+}
+
 PDataRecordingInstance COIEDeviceInstance::RetrieveCurrentRecording()
 {
 	std::lock_guard<std::mutex> lockGuard(m_RecordingMutex);
@@ -830,6 +849,9 @@ PDataRecordingInstance COIEDeviceInstance::RetrieveCurrentRecording()
 		m_pCurrentDataRecording = nullptr;
 		m_pCurrentDataRecording = pOldRecording->createEmptyDuplicate();
 
+		// Make sure that no packet is appended to the recording after it has been handed out.
+		waitForRecordingWrite(pOldRecording.get());
+
 		return pOldRecording;
 	}
 	else {
@@ -114,8 +114,14 @@ protected:
 	// For OIE Version 3 (100kHz mode), we need to specify the RTC Ethernet IP Address
 	std::string m_sRTC6IPAddress;
 
+	// Only guards the exchange of m_pCurrentDataRecording. Packets are appended outside of the lock.
 	std::mutex m_RecordingMutex;
 
+	// Recording that the packet callback is currently appending to, or nullptr.
+	std::atomic<CDataRecordingInstance*> m_pRecordingInWrite;
+
+	void waitForRecordingWrite(CDataRecordingInstance* pRecording);
+
 	void ensureConnectivity();
 	void removeDevice(bool bCheckForError);
 
@@ -516,6 +516,29 @@ LIBMCDRIVER_SCANLABOIE_DECLSPEC LibMCDriver_ScanLabOIEResult libmcdriver_scanlab
 */
 LIBMCDRIVER_SCANLABOIE_DECLSPEC LibMCDriver_ScanLabOIEResult libmcdriver_scanlaboie_datarecording_addscaledadditionalsignalstodatatable(LibMCDriver_ScanLabOIE_DataRecording pDataRecording, LibMCDriver_ScanLabOIE_uint32 nAdditionalIndex, LibMCEnv_DataTable pDataTable, const char * pColumnIdentifier, const char * pColumnDescription, LibMCDriver_ScanLabOIE_double dScaleFactor, LibMCDriver_ScanLabOIE_double dOffset);
 
+/**
+* Writes packet numbers, measurement tags, coordinates and all signal channels of the recording to a data table. All columns are taken from the same snapshot of the recording and have the same length. Column identifiers are the prefix followed by packetnumber, measurementtag, x, y, sensor_N, rtc_N and additional_N.
+*
+* @param[in] pDataRecording - DataRecording instance.
+* @param[in] pDataTable - Data table instance to write to.
+* @param[in] pColumnPrefix - Prefix of all column identifiers. May be empty.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLABOIE_DECLSPEC LibMCDriver_ScanLabOIEResult libmcdriver_scanlaboie_datarecording_addallsignalstodatatable(LibMCDriver_ScanLabOIE_DataRecording pDataRecording, LibMCEnv_DataTable pDataTable, const char * pColumnPrefix);
+
+/**
+* Renders a certain sensor channel into a discrete field, averaging all records per pixel by their X and Y coordinates. The field values will be the transform RawValue times ScaleFactor + Offset.
+*
+* @param[in] pDataRecording - DataRecording instance.
+* @param[in] nSignalIndex - Index of the signal to render. 0-based. MUST be smaller than SensorSignalCount.
+* @param[in] pField - Field instance to render into. Origin and DPI of the field define the mapping of the coordinates.
+* @param[in] dScaleFactor - Factor that the raw value is scaled with.
+* @param[in] dOffset - Offset that the raw value is scaled with.
+* @param[in] dDefaultValue - Value of pixels that do not contain any record.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLABOIE_DECLSPEC LibMCDriver_ScanLabOIEResult libmcdriver_scanlaboie_datarecording_rendersensorsignalstofield(LibMCDriver_ScanLabOIE_DataRecording pDataRecording, LibMCDriver_ScanLabOIE_uint32 nSignalIndex, LibMCEnv_DiscreteFieldData2D pField, LibMCDriver_ScanLabOIE_double dScaleFactor, LibMCDriver_ScanLabOIE_double dOffset, LibMCDriver_ScanLabOIE_double dDefaultValue);
+
 /*************************************************************************************************************************
  Class definition for OIEDevice
 **************************************************************************************************************************/
@@ -603,6 +603,23 @@ public:
 	*/
 	virtual void AddScaledAdditionalSignalsToDataTable(const LibMCDriver_ScanLabOIE_uint32 nAdditionalIndex, LibMCEnv::PDataTable pDataTable, const std::string & sColumnIdentifier, const std::string & sColumnDescription, const LibMCDriver_ScanLabOIE_double dScaleFactor, const LibMCDriver_ScanLabOIE_double dOffset) = 0;
 
+	/**
+	* IDataRecording::AddAllSignalsToDataTable - Writes packet numbers, measurement tags, coordinates and all signal channels of the recording to a data table. All columns are taken from the same snapshot of the recording and have the same length. Column identifiers are the prefix followed by packetnumber, measurementtag, x, y, sensor_N, rtc_N and additional_N.
+	* @param[in] pDataTable - Data table instance to write to.
+	* @param[in] sColumnPrefix - Prefix of all column identifiers. May be empty.
+	*/
+	virtual void AddAllSignalsToDataTable(LibMCEnv::PDataTable pDataTable, const std::string & sColumnPrefix) = 0;
+
+	/**
+	* IDataRecording::RenderSensorSignalsToField - Renders a certain sensor channel into a discrete field, averaging all records per pixel by their X and Y coordinates. The field values will be the transform RawValue times ScaleFactor + Offset.
+	* @param[in] nSignalIndex - Index of the signal to render. 0-based. MUST be smaller than SensorSignalCount.
+	* @param[in] pField - Field instance to render into. Origin and DPI of the field define the mapping of the coordinates.
+	* @param[in] dScaleFactor - Factor that the raw value is scaled with.
+	* @param[in] dOffset - Offset that the raw value is scaled with.
+	* @param[in] dDefaultValue - Value of pixels that do not contain any record.
+	*/
+	virtual void RenderSensorSignalsToField(const LibMCDriver_ScanLabOIE_uint32 nSignalIndex, LibMCEnv::PDiscreteFieldData2D pField, const LibMCDriver_ScanLabOIE_double dScaleFactor, const LibMCDriver_ScanLabOIE_double dOffset, const LibMCDriver_ScanLabOIE_double dDefaultValue) = 0;
+
 };
 
 typedef IBaseSharedPtr<IDataRecording> PIDataRecording;
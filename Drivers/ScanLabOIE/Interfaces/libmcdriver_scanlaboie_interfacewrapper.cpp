@@ -1347,6 +1347,67 @@ LibMCDriver_ScanLabOIEResult libmcdriver_scanlaboie_datarecording_addscaledaddit
 	}
 }
 
+LibMCDriver_ScanLabOIEResult libmcdriver_scanlaboie_datarecording_addallsignalstodatatable(LibMCDriver_ScanLabOIE_DataRecording pDataRecording, LibMCEnv_DataTable pDataTable, const char * pColumnPrefix)
+{
+	IBase* pIBaseClass = (IBase *)pDataRecording;
+
+	try {
+		if (pColumnPrefix == nullptr)
+			throw ELibMCDriver_ScanLabOIEInterfaceException (LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+		LibMCEnv::PDataTable pIDataTable = std::make_shared<LibMCEnv::CDataTable>(CWrapper::sPLibMCEnvWrapper.get(), pDataTable);
+		CWrapper::sPLibMCEnvWrapper->AcquireInstance(pIDataTable.get());
+		if (!pIDataTable)
+			throw ELibMCDriver_ScanLabOIEInterfaceException (LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDCAST);
+		
+		std::string sColumnPrefix(pColumnPrefix);
+		IDataRecording* pIDataRecording = dynamic_cast<IDataRecording*>(pIBaseClass);
+		if (!pIDataRecording)
+			throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDCAST);
+		
+		pIDataRecording->AddAllSignalsToDataTable(pIDataTable, sColumnPrefix);
+
+		return LIBMCDRIVER_SCANLABOIE_SUCCESS;
+	}
+	catch (ELibMCDriver_ScanLabOIEInterfaceException & Exception) {
+		return handleLibMCDriver_ScanLabOIEException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_ScanLabOIEResult libmcdriver_scanlaboie_datarecording_rendersensorsignalstofield(LibMCDriver_ScanLabOIE_DataRecording pDataRecording, LibMCDriver_ScanLabOIE_uint32 nSignalIndex, LibMCEnv_DiscreteFieldData2D pField, LibMCDriver_ScanLabOIE_double dScaleFactor, LibMCDriver_ScanLabOIE_double dOffset, LibMCDriver_ScanLabOIE_double dDefaultValue)
+{
+	IBase* pIBaseClass = (IBase *)pDataRecording;
+
+	try {
+		LibMCEnv::PDiscreteFieldData2D pIField = std::make_shared<LibMCEnv::CDiscreteFieldData2D>(CWrapper::sPLibMCEnvWrapper.get(), pField);
+		CWrapper::sPLibMCEnvWrapper->AcquireInstance(pIField.get());
+		if (!pIField)
+			throw ELibMCDriver_ScanLabOIEInterfaceException (LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDCAST);
+		
+		IDataRecording* pIDataRecording = dynamic_cast<IDataRecording*>(pIBaseClass);
+		if (!pIDataRecording)
+			throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDCAST);
+		
+		pIDataRecording->RenderSensorSignalsToField(nSignalIndex, pIField, dScaleFactor, dOffset, dDefaultValue);
+
+		return LIBMCDRIVER_SCANLABOIE_SUCCESS;
+	}
+	catch (ELibMCDriver_ScanLabOIEInterfaceException & Exception) {
+		return handleLibMCDriver_ScanLabOIEException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 
 /*************************************************************************************************************************
  Class implementation for OIEDevice
@@ -2817,6 +2878,10 @@ LibMCDriver_ScanLabOIEResult LibMCDriver_ScanLabOIE::Impl::LibMCDriver_ScanLabOI
 		*ppProcAddress = (void*) &libmcdriver_scanlaboie_datarecording_addadditionalsignalstodatatable;
 	if (sProcName == "libmcdriver_scanlaboie_datarecording_addscaledadditionalsignalstodatatable") 
 		*ppProcAddress = (void*) &libmcdriver_scanlaboie_datarecording_addscaledadditionalsignalstodatatable;
+	if (sProcName == "libmcdriver_scanlaboie_datarecording_addallsignalstodatatable") 
+		*ppProcAddress = (void*) &libmcdriver_scanlaboie_datarecording_addallsignalstodatatable;
+	if (sProcName == "libmcdriver_scanlaboie_datarecording_rendersensorsignalstofield") 
+		*ppProcAddress = (void*) &libmcdriver_scanlaboie_datarecording_rendersensorsignalstofield;
 	if (sProcName == "libmcdriver_scanlaboie_oiedevice_getdevicename") 
 		*ppProcAddress = (void*) &libmcdriver_scanlaboie_oiedevice_getdevicename;
 	if (sProcName == "libmcdriver_scanlaboie_oiedevice_sethostname") 
@@ -165,6 +165,7 @@ typedef void * LibMCDriver_ScanLabOIE_pvoid;
 #define LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDOIEDEVICESTATE 1058 /** Invalid OIE device state. */
 #define LIBMCDRIVER_SCANLABOIE_ERROR_FREQUENCYCHANGENOTALLOWED 1059 /** Frequency change not allowed. */
 #define LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGFREQUENCY 1060 /** Invalid recording frequency. */
+#define LIBMCDRIVER_SCANLABOIE_ERROR_RECORDINGCAPACITYEXCEEDED 1061 /** Recording capacity exceeded. */
 
 /*************************************************************************************************************************
  Error strings for LibMCDriver_ScanLabOIE
@@ -242,6 +243,7 @@ inline const char * LIBMCDRIVER_SCANLABOIE_GETERRORSTRING (LibMCDriver_ScanLabOI
     case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDOIEDEVICESTATE: return "Invalid OIE device state.";
     case LIBMCDRIVER_SCANLABOIE_ERROR_FREQUENCYCHANGENOTALLOWED: return "Frequency change not allowed.";
     case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGFREQUENCY: return "Invalid recording frequency.";
+    case LIBMCDRIVER_SCANLABOIE_ERROR_RECORDINGCAPACITYEXCEEDED: return "Recording capacity exceeded.";
     default: return "unknown error";
   }
 }
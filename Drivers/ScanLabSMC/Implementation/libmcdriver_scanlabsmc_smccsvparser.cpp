@@ -34,67 +34,34 @@ Abstract: This is the class definition of CSMCCSVParser
 #include "libmcdriver_scanlabsmc_smccsvparser.hpp"
 #include "libmcdriver_scanlabsmc_interfaceexception.hpp"
 
-#include <fstream>
 #include <stdexcept>
 #include <charconv>
 #include <string_view>
 #include <ctime>
 #include <cmath>
+#include <thread>
+#include <exception>
 
 #include <cctype> // for std::tolower
 #include <iostream>
 
+// Chunks smaller than this are not worth a thread of their own.
+#define SMCCSVPARSER_MINCHUNKSIZE (4 * 1024 * 1024)
+
 using namespace LibMCDriver_ScanLabSMC::Impl;
 
 CSMCCSVParser::CSMCCSVParser(const std::string& sAbsoluteFileNameUTF8, char delimiter)
     : m_delimiter(delimiter)
 {
-
-#ifdef _WIN32
-    if (sAbsoluteFileNameUTF8.length() > 65536)
-        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
-
-    int nLength = (int)sAbsoluteFileNameUTF8.length();
-    int nBufferSize = nLength * 2 + 2;
-    std::vector<wchar_t> wsLibraryFileName(nBufferSize);
-    int nResult = MultiByteToWideChar(CP_UTF8, 0, sAbsoluteFileNameUTF8.c_str(), nLength, &wsLibraryFileName[0], nBufferSize);
-    if (nResult == 0)
-        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONFILENAME);
-
-    std::ifstream file(wsLibraryFileName.data(), std::ios::binary);
-#else
-    std::ifstream file(sAbsoluteFileNameUTF8, std::ios::binary);
-#endif
-
-    if (!file.is_open())
-        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTOOPENSIMULATIONFILE);
-
-    file.seekg(0, std::ios::end);
-    std::streamsize size = file.tellg();
-    file.seekg(0, std::ios::beg);
-
-    m_fileBuff.resize(static_cast<size_t>(size));
-    if (!file.read(m_fileBuff.data(), size)) {
-        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTREADSIMULATIONFILE);
-    }
+    m_pMappedFile = std::make_shared<CSMCMappedFile>(sAbsoluteFileNameUTF8);
 }
 
 void CSMCCSVParser::Parse(const std::vector<FieldBinding>& field_bindings)
 {
-    const char* data = m_fileBuff.data();
-    const char* end = data + m_fileBuff.size();
-
-    const char* lineStart = data;
-    const char* ptr = data;
-
-    double timestamp = 0.0;
-
-    size_t prevTsIdx = 0;
-    size_t currTsIdx = 0;
-
     std::vector<ParserFunc> parsers;
     std::vector<ExtenderFunc> extenders;
     std::vector<InterpolatorFunc> interpolators;
+    std::vector<AppenderFunc> appenders;
 
     void* ts_target = nullptr;
 
@@ -105,9 +72,135 @@ void CSMCCSVParser::Parse(const std::vector<FieldBinding>& field_bindings)
             parsers.push_back(GetParser(field_bindings[i].meta.type));
             extenders.push_back(GetExtender(field_bindings[i].meta.type));
             interpolators.push_back(GetInterpolator(field_bindings[i].meta.type));
+            appenders.push_back(GetAppender(field_bindings[i].meta.type));
         }
     }
 
+    const char* data = m_pMappedFile->getData();
+    size_t dataSize = m_pMappedFile->getSize();
+    if ((data == nullptr) || (dataSize == 0))
+        return;
+
+    std::vector<sSMCMappedFileChunk> chunks;
+    size_t threadCount = CSMCMappedFile::getParserThreadCount(dataSize, SMCCSVPARSER_MINCHUNKSIZE);
+    m_pMappedFile->splitIntoLineChunks(0, SMCCSVPARSER_MINCHUNKSIZE, threadCount, chunks);
+
+    if (chunks.size() <= 1) {
+        RangeResult result = ParseRange(data, data + dataSize, field_bindings, parsers, extenders, interpolators, 0.0);
+        m_rowCount += result.RowCount;
+        return;
+    }
+
+    // Every chunk is parsed into its own containers.
+    std::vector<std::vector<std::shared_ptr<void>>> chunkTargets(chunks.size());
+    std::vector<std::vector<FieldBinding>> chunkBindings(chunks.size());
+    std::vector<RangeResult> chunkResults(chunks.size());
+
+    for (size_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex) {
+        for (auto& binding : field_bindings) {
+            std::shared_ptr<void> chunkTarget;
+            if (binding.target != nullptr)
+                chunkTarget = CreateTarget(binding.meta.type);
+
+            chunkTargets[chunkIndex].push_back(chunkTarget);
+            chunkBindings[chunkIndex].push_back({ binding.meta, chunkTarget.get() });
+        }
+    }
+
+    // Count the rows of every chunk first, so that each chunk starts with the exact timestamp a sequential parse would produce.
+    std::vector<size_t> chunkRowCounts(chunks.size());
+    RunChunksInParallel(chunks.size(), [&](size_t chunkIndex) {
+        chunkRowCounts[chunkIndex] = CountRows(data + chunks[chunkIndex].m_nStart, data + chunks[chunkIndex].m_nEnd);
+    });
+
+    std::vector<double> chunkStartTimestamps(chunks.size());
+    size_t precedingRows = m_rowCount;
+    for (size_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex) {
+        chunkStartTimestamps[chunkIndex] = (double)(precedingRows * CSMCCSVParser::TimestampDefaultInc);
+        precedingRows += chunkRowCounts[chunkIndex];
+    }
+
+    RunChunksInParallel(chunks.size(), [&](size_t chunkIndex) {
+        chunkResults[chunkIndex] = ParseRange(data + chunks[chunkIndex].m_nStart, data + chunks[chunkIndex].m_nEnd, chunkBindings[chunkIndex], parsers, extenders, interpolators, chunkStartTimestamps[chunkIndex]);
+    });
+
+    // Merge the chunks in file order.
+    auto vec_ts = static_cast<std::vector<double>*>(ts_target);
+    bool hasPreviousRow = false;
+    size_t prevTsIdx = 0;
+
+    for (size_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex) {
+        auto& chunkResult = chunkResults[chunkIndex];
+        if (chunkResult.RowCount == 0)
+            continue;
+
+        size_t chunkTsBase = 0;
+        if (vec_ts != nullptr) {
+            chunkTsBase = vec_ts->size();
+
+            for (size_t i = 0; i < field_bindings.size(); ++i) {
+                if (field_bindings[i].meta.type == FieldParserType::Timestamp) {
+                    auto chunk_ts = static_cast<std::vector<double>*>(chunkTargets[chunkIndex][i].get());
+                    if (chunk_ts != nullptr) {
+                        vec_ts->insert(vec_ts->end(), chunk_ts->begin(), chunk_ts->end());
+                    }
+                    break;
+                }
+            }
+        }
+
+        size_t parserIndex = 0;
+        for (size_t i = 0; i < field_bindings.size(); ++i) {
+            if (field_bindings[i].meta.type == FieldParserType::Timestamp)
+                continue;
+
+            void* chunkTarget = chunkTargets[chunkIndex][i].get();
+            if (appenders[parserIndex] && field_bindings[i].target && chunkTarget) {
+                appenders[parserIndex](field_bindings[i].target, chunkTarget);
+            }
+
+            chunkTargets[chunkIndex][i].reset();
+            ++parserIndex;
+        }
+
+        // The rows at the chunk border have not been interpolated against each other yet.
+        if (hasPreviousRow && (vec_ts != nullptr) && (chunkTsBase != prevTsIdx)) {
+            parserIndex = 0;
+            while (parserIndex < interpolators.size()) {
+                if (interpolators[parserIndex] && field_bindings[parserIndex].target) {
+                    interpolators[parserIndex](prevTsIdx, chunkTsBase, field_bindings[parserIndex].target, ts_target);
+                }
+                ++parserIndex;
+            }
+        }
+
+        hasPreviousRow = true;
+        prevTsIdx = chunkTsBase + chunkResult.LastRowTsIdx;
+        m_rowCount += chunkResult.RowCount;
+    }
+}
+
+CSMCCSVParser::RangeResult CSMCCSVParser::ParseRange(const char* rangeStart, const char* rangeEnd, const std::vector<FieldBinding>& field_bindings,
+    const std::vector<ParserFunc>& parsers, const std::vector<ExtenderFunc>& extenders, const std::vector<InterpolatorFunc>& interpolators, double startTimestamp)
+{
+    RangeResult result;
+
+    const char* end = rangeEnd;
+
+    const char* lineStart = rangeStart;
+    const char* ptr = rangeStart;
+
+    double timestamp = startTimestamp;
+
+    size_t prevTsIdx = 0;
+    size_t currTsIdx = 0;
+
+    void* ts_target = nullptr;
+    for (auto& binding : field_bindings) {
+        if (binding.meta.type == FieldParserType::Timestamp)
+            ts_target = binding.target;
+    }
+
     while (ptr < end) {
         const char* lineEnd = nullptr;
         bool isLineEnd = false;
@@ -191,12 +284,70 @@ void CSMCCSVParser::Parse(const std::vector<FieldBinding>& field_bindings)
                     ++parserIndex;
                 }
 
-                ++m_rowCount;
+                result.LastRowTsIdx = currTsIdx;
+                ++result.RowCount;
             }
 
             lineStart = ptr;
         }
     }
+
+    return result;
+}
+
+size_t CSMCCSVParser::CountRows(const char* rangeStart, const char* rangeEnd)
+{
+    size_t rowCount = 0;
+
+    const char* lineStart = rangeStart;
+    const char* ptr = rangeStart;
+
+    while (ptr < rangeEnd) {
+        if ((*ptr == '\r') || (*ptr == '\n')) {
+            if ((ptr > lineStart) && (*lineStart != '#'))
+                ++rowCount;
+
+            if ((*ptr == '\r') && (ptr + 1 < rangeEnd) && (*(ptr + 1) == '\n'))
+                ++ptr;
+
+            ++ptr;
+            lineStart = ptr;
+        }
+        else {
+            ++ptr;
+        }
+    }
+
+    if ((rangeEnd > lineStart) && (*lineStart != '#'))
+        ++rowCount;
+
+    return rowCount;
+}
+
+void CSMCCSVParser::RunChunksInParallel(size_t chunkCount, const std::function<void(size_t)>& chunkFunc)
+{
+    std::vector<std::exception_ptr> chunkExceptions(chunkCount);
+    std::vector<std::thread> workerThreads;
+    workerThreads.reserve(chunkCount);
+
+    for (size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex) {
+        workerThreads.push_back(std::thread([&, chunkIndex]() {
+            try {
+                chunkFunc(chunkIndex);
+            }
+            catch (...) {
+                chunkExceptions[chunkIndex] = std::current_exception();
+            }
+        }));
+    }
+
+    for (auto& workerThread : workerThreads)
+        workerThread.join();
+
+    for (auto& chunkException : chunkExceptions) {
+        if (chunkException)
+            std::rethrow_exception(chunkException);
+    }
 }
 
 void CSMCCSVParser::ParseComment(const char* lineStart, size_t length)
@@ -250,23 +401,17 @@ void CSMCCSVParser::ParseValue(const char* data, size_t length, void* target, vo
         --length;
     }
 
-    if constexpr (std::is_same_v<T, int> || std::is_same_v<T, uint32_t>)
+    // std::from_chars does not accept an explicit plus sign
+    if (length > 0 && *data == '+') {
+        ++data;
+        --length;
+    }
+
+    if constexpr (std::is_same_v<T, int> || std::is_same_v<T, uint32_t> || std::is_same_v<T, double>)
     {
         auto [ptr, ec] = std::from_chars(data, data + length, value);
         vec->push_back((ec == std::errc()) ? value : 0);
     }
-    else if constexpr (std::is_same_v<T, double>)
-    {
-        try {
-            // Convert to std::string to support + or - and decimal parsing via stod
-            std::string str(data, length);
-            value = std::stod(str);
-            vec->push_back(value);
-        }
-        catch (...) {
-            vec->push_back(0.0); // fallback on failure
-        }
-    }
     else
     {
         throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_CSVPARSERUNKNOWNFIELDPARSERTYPE);
@@ -324,6 +469,24 @@ void CSMCCSVParser::InterpolateVector(size_t idx_from, size_t idx_to, void* targ
     }
 }
 
+template<typename T>
+void CSMCCSVParser::AppendVector(void* target, void* source)
+{
+    auto* vec = static_cast<std::vector<T>*>(target);
+    auto* src = static_cast<std::vector<T>*>(source);
+
+    if (vec->empty()) {
+        vec->swap(*src);
+    }
+    else {
+        vec->reserve(vec->size() + src->size());
+        vec->insert(vec->end(), std::make_move_iterator(src->begin()), std::make_move_iterator(src->end()));
+    }
+
+    src->clear();
+    src->shrink_to_fit();
+}
+
 void CSMCCSVParser::ParseBool(const char* data, size_t length, void* target, void* ts_target)
 {
     auto* vec = static_cast<std::vector<bool>*>(target);
@@ -451,6 +614,54 @@ CSMCCSVParser::InterpolatorFunc CSMCCSVParser::GetInterpolator(FieldParserType t
     }
 }
 
+CSMCCSVParser::AppenderFunc CSMCCSVParser::GetAppender(FieldParserType type)
+{
+    switch (type) {
+    case FieldParserType::None:
+        return nullptr;
+    case FieldParserType::Timestamp:
+        return nullptr;
+    case FieldParserType::Int:
+        return static_cast<AppenderFunc>(&CSMCCSVParser::AppendVector<int32_t>);
+    case FieldParserType::UInt32:
+        return static_cast<AppenderFunc>(&CSMCCSVParser::AppendVector<uint32_t>);
+    case FieldParserType::Double:
+        return static_cast<AppenderFunc>(&CSMCCSVParser::AppendVector<double>);
+    case FieldParserType::Bool:
+        return static_cast<AppenderFunc>(&CSMCCSVParser::AppendVector<bool>);
+    case FieldParserType::String:
+        return static_cast<AppenderFunc>(&CSMCCSVParser::AppendVector<std::string>);
+    case FieldParserType::LaserSignal:
+        return static_cast<AppenderFunc>(&CSMCCSVParser::AppendVector<uint32_t>);
+    default:
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_CSVPARSERUNKNOWNFIELDPARSERTYPE);
+    }
+}
+
+std::shared_ptr<void> CSMCCSVParser::CreateTarget(FieldParserType type)
+{
+    switch (type) {
+    case FieldParserType::None:
+        return nullptr;
+    case FieldParserType::Timestamp:
+        return std::make_shared<std::vector<double>>();
+    case FieldParserType::Int:
+        return std::make_shared<std::vector<int32_t>>();
+    case FieldParserType::UInt32:
+        return std::make_shared<std::vector<uint32_t>>();
+    case FieldParserType::Double:
+        return std::make_shared<std::vector<double>>();
+    case FieldParserType::Bool:
+        return std::make_shared<std::vector<bool>>();
+    case FieldParserType::String:
+        return std::make_shared<std::vector<std::string>>();
+    case FieldParserType::LaserSignal:
+        return std::make_shared<std::vector<uint32_t>>();
+    default:
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_CSVPARSERUNKNOWNFIELDPARSERTYPE);
+    }
+}
+
 void CSMCCSVParser::ParseLaserSignal_Internal(const char* data, size_t length, void* target, void* ts_target)
 {
     if (!target || !data || length == 0)
@@ -35,9 +35,11 @@ Abstract: This is the class declaration of CSMCCSVParser
 #define __LIBMCDRIVER_SCANLABSMC_SMCCSVPARSER
 
 #include "libmcdriver_scanlabsmc_interfaces.hpp"
+#include "libmcdriver_scanlabsmc_smcmappedfile.hpp"
 
 #include <string>
 #include <vector>
+#include <memory>
 #include <functional>
 
 
@@ -46,8 +48,8 @@ namespace LibMCDriver_ScanLabSMC {
 namespace Impl {
 
     /**
-        * @brief A fast single-pass CSV parser that loads the file into memory
-        *        and parses fields without copying using pointer slicing.
+        * @brief A fast CSV parser that memory-maps the file and parses fields without copying using pointer slicing.
+        *        Large files are split into line-aligned row ranges which are parsed in parallel and merged in order.
         */
     class CSMCCSVParser {
     public:
@@ -206,7 +208,15 @@ namespace Impl {
         using InterpolatorFunc = std::function<void(size_t, size_t, void*, void*)>;
 
         /**
-            * @brief Constructs the parser and loads the entire file into memory.
+         * @brief Function type used to append the values of a chunk-local data vector to the final target vector.
+         *
+         * @param target Pointer to the target data vector (e.g., std::vector<T>).
+         * @param source Pointer to the chunk-local data vector of the same type.
+         */
+        using AppenderFunc = std::function<void(void*, void*)>;
+
+        /**
+            * @brief Constructs the parser and maps the entire file into memory.
             * @param filename Path to the CSV file.
             * @param delimiter Delimiter character used in the CSV (e.g. ',', ';').
             */
@@ -295,6 +305,15 @@ namespace Impl {
         template<typename T>
         static void InterpolateVector(size_t idx_from, size_t idx_to, void* target, void* ts_target);
 
+        /**
+         * @brief Moves all values of a chunk-local vector to the end of the target vector.
+         * @tparam T The value type.
+         * @param target Pointer to the output vector (std::vector<T>*).
+         * @param source Pointer to the chunk-local vector (std::vector<T>*).
+         */
+        template<typename T>
+        static void AppendVector(void* target, void* source);
+
         /**
          * @brief Parses a complex laser signal structure and stores toggle states in the target vector.
          * @param data Pointer to the character buffer.
@@ -340,6 +359,52 @@ namespace Impl {
          */
         static CSMCCSVParser::InterpolatorFunc GetInterpolator(FieldParserType type);
 
+        /**
+         * @brief Retrieves the appender function for the given field type.
+         * @param type The type of the field to merge.
+         * @return A function pointer to the corresponding appender.
+         */
+        static CSMCCSVParser::AppenderFunc GetAppender(FieldParserType type);
+
+        /**
+         * @brief Creates an empty chunk-local container that matches the target container of a field type.
+         * @param type The type of the field.
+         * @return The container, or nullptr for fields that are skipped.
+         */
+        static std::shared_ptr<void> CreateTarget(FieldParserType type);
+
+        /**
+         * @brief Parser state of a contiguous range of rows.
+         */
+        struct RangeResult {
+            size_t RowCount = 0;          ///< Number of data rows in the range.
+            size_t LastRowTsIdx = 0;      ///< Index of the timestamp of the last data row in the range.
+        };
+
+        /**
+         * @brief Parses all rows within a byte range of the file into the given bindings.
+         * @param rangeStart First byte of the range. Must be at the beginning of a line.
+         * @param rangeEnd End of the range. Must be at the end of a line or the end of the file.
+         * @param field_bindings Bindings to fill.
+         * @param startTimestamp Timestamp of the first row of the range.
+         * @return Row count and timestamp index of the last row of the range.
+         */
+        RangeResult ParseRange(const char* rangeStart, const char* rangeEnd, const std::vector<FieldBinding>& field_bindings,
+            const std::vector<ParserFunc>& parsers, const std::vector<ExtenderFunc>& extenders, const std::vector<InterpolatorFunc>& interpolators, double startTimestamp);
+
+        /**
+         * @brief Counts the data rows within a byte range of the file, using the same line rules as ParseRange.
+         * @param rangeStart First byte of the range. Must be at the beginning of a line.
+         * @param rangeEnd End of the range. Must be at the end of a line or the end of the file.
+         * @return Number of non-empty, non-comment lines.
+         */
+        static size_t CountRows(const char* rangeStart, const char* rangeEnd);
+
+        /**
+         * @brief Calls chunkFunc for every chunk index on its own worker thread and rethrows the first failure.
+         */
+        static void RunChunksInParallel(size_t chunkCount, const std::function<void(size_t)>& chunkFunc);
+
         /**
          * @brief Represents a laser toggle sub-cycle with timing.
          */
@@ -357,7 +422,7 @@ namespace Impl {
          */
         static void ParseLaserSignal_Internal(const char* data, size_t length, void* target, void* ts_target);
 
-        std::vector<char> m_fileBuff;   ///< Raw file contents held in memory
+        PSMCMappedFile m_pMappedFile;   ///< Raw file contents mapped into memory
         char m_delimiter;               ///< CSV field delimiter character
         size_t m_rowCount = 0;          ///< Number of parsed data rows
     };
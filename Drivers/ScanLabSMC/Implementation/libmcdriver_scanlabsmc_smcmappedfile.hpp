@@ -0,0 +1,103 @@
+/*++
+
+Copyright (C) 2023 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+
+
+Abstract: This is the class declaration of CSMCMappedFile
+
+*/
+
+
+#ifndef __LIBMCDRIVER_SCANLABSMC_SMCMAPPEDFILE
+#define __LIBMCDRIVER_SCANLABSMC_SMCMAPPEDFILE
+
+#include "libmcdriver_scanlabsmc_interfaces.hpp"
+
+#include <string>
+#include <vector>
+#include <memory>
+
+
+namespace LibMCDriver_ScanLabSMC {
+namespace Impl {
+
+	typedef struct _sSMCMappedFileChunk {
+		size_t m_nStart;
+		size_t m_nEnd;
+	} sSMCMappedFileChunk;
+
+	/**
+	 * @brief Read-only memory mapping of a simulation or log record file.
+	 *        Parsers tokenize directly on the mapped bytes instead of copying the file to the heap.
+	 */
+	class CSMCMappedFile {
+	private:
+
+		const char* m_pData;
+		size_t m_nSize;
+
+#ifdef _WIN32
+		void* m_hFile;
+		void* m_hMapping;
+#else
+		int m_nFileDescriptor;
+#endif
+
+	public:
+
+		CSMCMappedFile(const std::string& sAbsoluteFileNameUTF8);
+
+		virtual ~CSMCMappedFile();
+
+		const char* getData();
+
+		size_t getSize();
+
+		/**
+		 * @brief Splits the byte range [nStartOffset, size) into consecutive chunks that begin and end on line boundaries.
+		 * @param nStartOffset Offset to start splitting at. Must be at the beginning of a line.
+		 * @param nMinimumChunkSize Chunks are never split smaller than this size in bytes.
+		 * @param nMaximumChunkCount Maximum number of chunks to return (e.g. the number of worker threads).
+		 * @param chunks Returns the chunk list in file order.
+		 */
+		void splitIntoLineChunks(size_t nStartOffset, size_t nMinimumChunkSize, size_t nMaximumChunkCount, std::vector<sSMCMappedFileChunk>& chunks);
+
+		/**
+		 * @brief Returns the number of worker threads that should be used to parse files of a given size.
+		 */
+		static size_t getParserThreadCount(size_t nDataSize, size_t nMinimumChunkSize);
+
+	};
+
+	typedef std::shared_ptr<CSMCMappedFile> PSMCMappedFile;
+
+} // namespace Impl
+} // namespace LibMCDriver_ScanLabSMC
+
+#endif // __LIBMCDRIVER_SCANLABSMC_SMCMAPPEDFILE
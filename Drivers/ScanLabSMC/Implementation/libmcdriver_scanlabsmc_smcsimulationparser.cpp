@@ -41,121 +41,252 @@ Abstract: This is a stub class definition of CSMCJob
 #include <thread>
 #include <iostream>
 #include <algorithm>
-#include <fstream>
 #include <sstream>
+#include <charconv>
+#include <cstring>
+#include <exception>
 
 #ifdef _WIN32
 #endif
 
+// Chunks smaller than this are not worth a thread of their own.
+#define SMCSIMULATIONPARSER_MINCHUNKSIZE (4 * 1024 * 1024)
+
 using namespace LibMCDriver_ScanLabSMC::Impl;
 
+typedef std::pair<const char*, const char*> SMCSimulationField;
+
+static int32_t smcSimulationParseInt(const SMCSimulationField& field)
+{
+    const char* pStart = field.first;
+    while ((pStart < field.second) && ((*pStart == ' ') || (*pStart == '\t') || (*pStart == '+')))
+        pStart++;
+
+    int32_t nValue = 0;
+    auto result = std::from_chars(pStart, field.second, nValue);
+    if (result.ec != std::errc())
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONDATA);
+
+    return nValue;
+}
+
+static double smcSimulationParseDouble(const SMCSimulationField& field)
+{
+    const char* pStart = field.first;
+    while ((pStart < field.second) && ((*pStart == ' ') || (*pStart == '\t') || (*pStart == '+')))
+        pStart++;
+
+    double dValue = 0.0;
+    auto result = std::from_chars(pStart, field.second, dValue);
+    if (result.ec != std::errc())
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONDATA);
+
+    return dValue;
+}
+
+static const SMCSimulationField& smcSimulationGetField(const std::vector<SMCSimulationField>& fields, int nIndex)
+{
+    if ((nIndex < 0) || ((size_t)nIndex >= fields.size()))
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONDATA);
+
+    return fields[(size_t)nIndex];
+}
+
 CSMCSimulationParser::CSMCSimulationParser(const std::string& sAbsoluteFileNameUTF8)
 {
-    
-#ifdef _WIN32
-    if (sAbsoluteFileNameUTF8.length () > 65536)
-        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
-
-    int nLength = (int)sAbsoluteFileNameUTF8.length();
-    int nBufferSize = nLength * 2 + 2;
-    std::vector<wchar_t> wsLibraryFileName(nBufferSize);
-    int nResult = MultiByteToWideChar(CP_UTF8, 0, sAbsoluteFileNameUTF8.c_str(), nLength, &wsLibraryFileName[0], nBufferSize);
-    if (nResult == 0)
-        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONFILENAME);
-
-    std::ifstream file(wsLibraryFileName.data (), std::ios::in);
-#else
-    std::ifstream file(sAbsoluteFileNameUTF8, std::ios::in);
-#endif
+    CSMCMappedFile mappedFile(sAbsoluteFileNameUTF8);
 
+    const char* pData = mappedFile.getData();
+    size_t nSize = mappedFile.getSize();
+    if ((pData == nullptr) || (nSize == 0))
+        return;
 
-    if (!file.is_open ()) 
-        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTOOPENSIMULATIONFILE);
-    
-    std::string line;
-    double timestamp = 0;
+    // The header must precede all data lines, so read it sequentially up to the first data line.
     int numberOfCoordinates = 0;
+    size_t nDataOffset = 0;
+    while (nDataOffset < nSize) {
+        const char* pLineStart = pData + nDataOffset;
+        const char* pLineEnd = (const char*)memchr(pLineStart, '\n', nSize - nDataOffset);
+        if (pLineEnd == nullptr)
+            pLineEnd = pData + nSize;
+
+        if ((*pLineStart == '+') || (*pLineStart == '-'))
+            break;
+
+        parseHeaderLine(pLineStart, pLineEnd, numberOfCoordinates);
+
+        nDataOffset = (pLineEnd - pData);
+        if (nDataOffset < nSize)
+            nDataOffset++;
+    }
+
+    std::vector<sSMCMappedFileChunk> chunks;
+    size_t nThreadCount = CSMCMappedFile::getParserThreadCount(nSize - nDataOffset, SMCSIMULATIONPARSER_MINCHUNKSIZE);
+    mappedFile.splitIntoLineChunks(nDataOffset, SMCSIMULATIONPARSER_MINCHUNKSIZE, nThreadCount, chunks);
+
+    std::vector<sSMCSimulationChunkResult> chunkResults(chunks.size());
+
+    if (chunks.size() == 1) {
+        parseChunk(pData + chunks[0].m_nStart, pData + chunks[0].m_nEnd, numberOfCoordinates, chunkResults[0]);
+    }
+    else if (chunks.size() > 1) {
+        std::vector<std::exception_ptr> chunkExceptions(chunks.size());
+        std::vector<std::thread> workerThreads;
+        workerThreads.reserve(chunks.size());
+
+        for (size_t nChunkIndex = 0; nChunkIndex < chunks.size(); nChunkIndex++) {
+            workerThreads.push_back(std::thread([&, nChunkIndex]() {
+                try {
+                    parseChunk(pData + chunks[nChunkIndex].m_nStart, pData + chunks[nChunkIndex].m_nEnd, numberOfCoordinates, chunkResults[nChunkIndex]);
+                }
+                catch (...) {
+                    chunkExceptions[nChunkIndex] = std::current_exception();
+                }
+            }));
+        }
+
+        for (auto& workerThread : workerThreads)
+            workerThread.join();
+
+        for (auto& chunkException : chunkExceptions) {
+            if (chunkException)
+                std::rethrow_exception(chunkException);
+        }
+    }
+
+    // Every data row advances the timestamp by 10 microsteps, so each chunk can be shifted by the rows that precede it.
+    // Row timestamps are whole numbers, so the shift is exact and the delays are added in the same order as a sequential parse.
+    size_t nTotalEntryCount = 0;
+    for (auto& chunkResult : chunkResults)
+        nTotalEntryCount += chunkResult.m_Entries.size();
+
+    m_Entries.reserve(nTotalEntryCount);
+
+    double dChunkTimestampOffset = 0.0;
+    for (auto& chunkResult : chunkResults) {
+        size_t nEntryCount = chunkResult.m_Entries.size();
+        for (size_t nEntryIndex = 0; nEntryIndex < nEntryCount; nEntryIndex++) {
+            auto& entry = chunkResult.m_Entries[nEntryIndex];
+            entry.m_dTimestamp = (entry.m_dTimestamp + dChunkTimestampOffset) + chunkResult.m_TimeSteps[nEntryIndex];
+            m_Entries.push_back(entry);
+        }
+
+        dChunkTimestampOffset += (double)chunkResult.m_nRowCount * 10.0;
+        chunkResult.m_Entries.clear();
+        chunkResult.m_Entries.shrink_to_fit();
+        chunkResult.m_TimeSteps.clear();
+        chunkResult.m_TimeSteps.shrink_to_fit();
+    }
+
+    std::sort(m_Entries.begin(), m_Entries.end(),
+        [](const sSMCSimulationEntry& x, const sSMCSimulationEntry& y) { return x.m_dTimestamp < y.m_dTimestamp; });
+
+}
+
+void CSMCSimulationParser::parseHeaderLine(const char* pLineStart, const char* pLineEnd, int& nNumberOfCoordinates)
+{
+    std::string line(pLineStart, pLineEnd);
+    if (line.rfind("<!--Simulation output", 0) != 0)
+        return;
+
     int scanDevices = 0;
     int stages = 0;
 
-        while (std::getline(file, line)) {
-
-            if (!line.empty()) {
-                if (line.rfind("<!--Simulation output", 0) == 0) {
-                    std::istringstream iss(line);
-                    std::string item;
-                    while (iss >> item) {
-                        if (item.find("ScanDevices") == 0) {
-                            scanDevices = std::stoi(item.substr(13, item.size() - 14));
-                        }
-                        else if (item.find("Stage") == 0 && item.find("StageDelay") != 0) {
-                            std::string stagesRaw = item.substr(7, item.size() - 8);
-                            stages = (stagesRaw == "None") ? 0 : std::stoi(stagesRaw.substr(5));
-                        }
-                    }
-                    numberOfCoordinates = scanDevices * 2 + stages * 2;
-                }
+    std::istringstream iss(line);
+    std::string item;
+    while (iss >> item) {
+        if (item.find("ScanDevices") == 0) {
+            scanDevices = std::stoi(item.substr(13, item.size() - 14));
+        }
+        else if (item.find("Stage") == 0 && item.find("StageDelay") != 0) {
+            std::string stagesRaw = item.substr(7, item.size() - 8);
+            stages = (stagesRaw == "None") ? 0 : std::stoi(stagesRaw.substr(5));
+        }
+    }
 
-                if (line[0] == '+' || line[0] == '-') {
-                    std::istringstream iss(line);
-                    std::string token;
-                    std::vector<std::string> data;
+    nNumberOfCoordinates = scanDevices * 2 + stages * 2;
+}
 
-                    sSMCSimulationEntry newEntry;
+void CSMCSimulationParser::parseChunk(const char* pChunkStart, const char* pChunkEnd, int nNumberOfCoordinates, sSMCSimulationChunkResult& result)
+{
+    result.m_Entries.clear();
+    result.m_TimeSteps.clear();
+    result.m_nRowCount = 0;
 
-                    while (std::getline(iss, token, ';')) {
-                        data.push_back(token);
-                    }
+    // Rough guess of the row count to avoid most reallocations.
+    result.m_Entries.reserve((size_t)(pChunkEnd - pChunkStart) / 64);
+    result.m_TimeSteps.reserve((size_t)(pChunkEnd - pChunkStart) / 64);
 
-                    if (data.size() > 3) {
-                        int numLaserOnDelays = std::stoi(data[numberOfCoordinates]);
-                        int numLaserOffDelays = std::stoi(data[numberOfCoordinates + 1 + numLaserOnDelays]);
-
-                        newEntry.m_dCoordinates[0] = std::stod(data[0]);
-                        newEntry.m_dCoordinates[1] = std::stod(data[1]);
-                        newEntry.m_dCoordinates[2] = 0.0;
-
-                        newEntry.m_dLaserToggle = std::stoi(data[numberOfCoordinates + 2 + numLaserOnDelays + numLaserOffDelays]);
-                        newEntry.m_dActiveChannel1 = std::stod(data[numberOfCoordinates + 3 + numLaserOnDelays + numLaserOffDelays]);
-                        newEntry.m_dActiveChannel2 = std::stod(data[numberOfCoordinates + 4 + numLaserOnDelays + numLaserOffDelays]);
-                        newEntry.m_CommandIndex = std::stoi(data[numberOfCoordinates + 5 + numLaserOnDelays + numLaserOffDelays]);
-
-                        double tempTimestamp = timestamp + 10;
-                        if (numLaserOnDelays > 0) {
-                            for (int i = 0; i < numLaserOnDelays; i++) {
-                                double timeStep = std::stod(data[numberOfCoordinates + 1 + i]);
-                                timestamp = tempTimestamp + timeStep;
-
-                                newEntry.m_dTimestamp = timestamp;
-                                m_Entries.push_back(newEntry);
-                            }
-                            timestamp = tempTimestamp;
-                        }
-                        if (numLaserOffDelays > 0) {
-                            for (int i = 0; i < numLaserOffDelays; i++) {
-                                double timeStep = std::stod(data[numberOfCoordinates + 2 + numLaserOnDelays + i]);
-                                timestamp = tempTimestamp + timeStep;
-
-                                newEntry.m_dTimestamp = timestamp;
-                                m_Entries.push_back(newEntry);
-                            }
-                            timestamp = tempTimestamp;
-                        }
-                        if (numLaserOnDelays == 0 && numLaserOffDelays == 0) {
-
-                            newEntry.m_dTimestamp = tempTimestamp;
-                            m_Entries.push_back(newEntry);
-
-                            timestamp += 10;
-                        }
+    std::vector<SMCSimulationField> data;
+    data.reserve(64);
+
+    double timestamp = 0;
+
+    const char* pLineStart = pChunkStart;
+    while (pLineStart < pChunkEnd) {
+        const char* pLineEnd = (const char*)memchr(pLineStart, '\n', pChunkEnd - pLineStart);
+        if (pLineEnd == nullptr)
+            pLineEnd = pChunkEnd;
+
+        if ((pLineStart < pLineEnd) && ((*pLineStart == '+') || (*pLineStart == '-'))) {
+
+            // Tokenize in place, the fields point into the mapped file.
+            data.clear();
+            const char* pFieldStart = pLineStart;
+            for (const char* pChar = pLineStart; pChar < pLineEnd; pChar++) {
+                if (*pChar == ';') {
+                    data.push_back(std::make_pair(pFieldStart, pChar));
+                    pFieldStart = pChar + 1;
+                }
+            }
+            if (pFieldStart < pLineEnd)
+                data.push_back(std::make_pair(pFieldStart, pLineEnd));
+
+            if (data.size() > 3) {
+                sSMCSimulationEntry newEntry;
+
+                int numLaserOnDelays = smcSimulationParseInt(smcSimulationGetField(data, nNumberOfCoordinates));
+                int numLaserOffDelays = smcSimulationParseInt(smcSimulationGetField(data, nNumberOfCoordinates + 1 + numLaserOnDelays));
+
+                newEntry.m_dCoordinates[0] = smcSimulationParseDouble(data[0]);
+                newEntry.m_dCoordinates[1] = smcSimulationParseDouble(data[1]);
+                newEntry.m_dCoordinates[2] = 0.0;
+
+                newEntry.m_dLaserToggle = smcSimulationParseInt(smcSimulationGetField(data, nNumberOfCoordinates + 2 + numLaserOnDelays + numLaserOffDelays));
+                newEntry.m_dActiveChannel1 = smcSimulationParseDouble(smcSimulationGetField(data, nNumberOfCoordinates + 3 + numLaserOnDelays + numLaserOffDelays));
+                newEntry.m_dActiveChannel2 = smcSimulationParseDouble(smcSimulationGetField(data, nNumberOfCoordinates + 4 + numLaserOnDelays + numLaserOffDelays));
+                newEntry.m_CommandIndex = smcSimulationParseInt(smcSimulationGetField(data, nNumberOfCoordinates + 5 + numLaserOnDelays + numLaserOffDelays));
+
+                double tempTimestamp = timestamp + 10;
+                if (numLaserOnDelays > 0) {
+                    for (int i = 0; i < numLaserOnDelays; i++) {
+                        double timeStep = smcSimulationParseDouble(smcSimulationGetField(data, nNumberOfCoordinates + 1 + i));
+                        newEntry.m_dTimestamp = tempTimestamp;
+                        result.m_Entries.push_back(newEntry);
+                        result.m_TimeSteps.push_back(timeStep);
+                    }
+                }
+                if (numLaserOffDelays > 0) {
+                    for (int i = 0; i < numLaserOffDelays; i++) {
+                        double timeStep = smcSimulationParseDouble(smcSimulationGetField(data, nNumberOfCoordinates + 2 + numLaserOnDelays + i));
+                        newEntry.m_dTimestamp = tempTimestamp;
+                        result.m_Entries.push_back(newEntry);
+                        result.m_TimeSteps.push_back(timeStep);
                     }
                 }
+                if (numLaserOnDelays == 0 && numLaserOffDelays == 0) {
+                    newEntry.m_dTimestamp = tempTimestamp;
+                    result.m_Entries.push_back(newEntry);
+                    result.m_TimeSteps.push_back(0.0);
+                }
+
+                timestamp = tempTimestamp;
+                result.m_nRowCount++;
             }
         }
 
-        std::sort(m_Entries.begin(), m_Entries.end(),
-            [](const sSMCSimulationEntry& x, const sSMCSimulationEntry& y) { return x.m_dTimestamp < y.m_dTimestamp; });
-
+        pLineStart = pLineEnd + 1;
+    }
 }
 
 CSMCSimulationParser::~CSMCSimulationParser()
@@ -38,6 +38,7 @@ Abstract: This is the class declaration of CSMCJob
 #include "libmcdriver_scanlabsmc_interfaces.hpp"
 
 #include "libmcdriver_scanlabsmc_smccontexthandle.hpp"
+#include "libmcdriver_scanlabsmc_smcmappedfile.hpp"
 #include "libmcdriver_scanlabsmc_sdk.hpp"
 
 
@@ -55,11 +56,24 @@ typedef struct _sSMCSimulationEntry {
 } sSMCSimulationEntry;
 
 
+typedef struct _sSMCSimulationChunkResult {
+	std::vector<sSMCSimulationEntry> m_Entries;
+	std::vector<double> m_TimeSteps;
+	size_t m_nRowCount;
+} sSMCSimulationChunkResult;
+
+
 class CSMCSimulationParser {
 private:
 
 	std::vector<sSMCSimulationEntry> m_Entries;
 
+	// Parses all data lines within the given byte range. Entry timestamps are the row timestamps relative to the start
+	// of the chunk, the laser delay of each entry is returned separately and added after the chunk has been placed.
+	static void parseChunk(const char* pChunkStart, const char* pChunkEnd, int nNumberOfCoordinates, sSMCSimulationChunkResult& result);
+
+	static void parseHeaderLine(const char* pLineStart, const char* pLineEnd, int& nNumberOfCoordinates);
+
 public:
 
 	CSMCSimulationParser(const std::string & sAbsoluteFileName);
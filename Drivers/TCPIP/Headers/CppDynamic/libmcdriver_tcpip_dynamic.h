@@ -218,6 +218,55 @@ typedef LibMCDriver_TCPIPResult (*PLibMCDriver_TCPIPDriver_TCPIP_WaitForDataPtr)
 */
 typedef LibMCDriver_TCPIPResult (*PLibMCDriver_TCPIPDriver_TCPIP_ReceivePacketPtr) (LibMCDriver_TCPIP_Driver_TCPIP pDriver_TCPIP, LibMCDriver_TCPIP_uint32 nPacketSize, LibMCDriver_TCPIP_uint32 nTimeOutInMS, LibMCDriver_TCPIP_Driver_TCPIPPacket * pPacket);
 
+/**
+* Runs the following connections on the shared event driven I/O engine instead of a blocking socket. Only engine connections honour the receive timeout of ReceivePacket. Framed connections always use the engine. Takes effect with the next connect.
+*
+* @param[in] pDriver_TCPIP - Driver_TCPIP instance.
+* @param[in] bUseIOEngine - If true, connections use the I/O engine. Default is false.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_TCPIPResult (*PLibMCDriver_TCPIPDriver_TCPIP_SetUseIOEnginePtr) (LibMCDriver_TCPIP_Driver_TCPIP pDriver_TCPIP, bool bUseIOEngine);
+
+/**
+* Splits the received byte stream into packets that start with a length header. Takes effect with the next connect.
+*
+* @param[in] pDriver_TCPIP - Driver_TCPIP instance.
+* @param[in] nHeaderSize - Size of the length header in bytes. MUST be 1, 2 or 4.
+* @param[in] bBigEndian - If true, the length header is big endian.
+* @param[in] bLengthIncludesHeader - If true, the length value includes the header itself.
+* @param[in] nMaxPacketSize - Maximum payload size in bytes. Larger frames close the connection.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_TCPIPResult (*PLibMCDriver_TCPIPDriver_TCPIP_SetLengthPrefixFramingPtr) (LibMCDriver_TCPIP_Driver_TCPIP pDriver_TCPIP, LibMCDriver_TCPIP_uint32 nHeaderSize, bool bBigEndian, bool bLengthIncludesHeader, LibMCDriver_TCPIP_uint32 nMaxPacketSize);
+
+/**
+* Splits the received byte stream into packets that end with a delimiter. Takes effect with the next connect.
+*
+* @param[in] pDriver_TCPIP - Driver_TCPIP instance.
+* @param[in] pDelimiter - Delimiter sequence, for example a line feed. MUST not be empty.
+* @param[in] nMaxPacketSize - Maximum payload size in bytes. Larger frames close the connection.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_TCPIPResult (*PLibMCDriver_TCPIPDriver_TCPIP_SetDelimiterFramingPtr) (LibMCDriver_TCPIP_Driver_TCPIP pDriver_TCPIP, const char * pDelimiter, LibMCDriver_TCPIP_uint32 nMaxPacketSize);
+
+/**
+* Returns to unframed fixed size packet reception. Takes effect with the next connect.
+*
+* @param[in] pDriver_TCPIP - Driver_TCPIP instance.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_TCPIPResult (*PLibMCDriver_TCPIPDriver_TCPIP_DisableFramingPtr) (LibMCDriver_TCPIP_Driver_TCPIP pDriver_TCPIP);
+
+/**
+* Receives the next complete frame. The frame header or delimiter is not part of the packet data. Fails if there is a connection error.
+*
+* @param[in] pDriver_TCPIP - Driver_TCPIP instance.
+* @param[in] nTimeOutInMS - timeout in Milliseconds.
+* @param[out] pPacket - Received packet. Empty if no frame arrived within the timeout.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_TCPIPResult (*PLibMCDriver_TCPIPDriver_TCPIP_ReceiveFramedPacketPtr) (LibMCDriver_TCPIP_Driver_TCPIP pDriver_TCPIP, LibMCDriver_TCPIP_uint32 nTimeOutInMS, LibMCDriver_TCPIP_Driver_TCPIPPacket * pPacket);
+
 /*************************************************************************************************************************
  Global functions
 **************************************************************************************************************************/
@@ -310,6 +359,11 @@ typedef struct {
 	PLibMCDriver_TCPIPDriver_TCPIP_SendBufferPtr m_Driver_TCPIP_SendBuffer;
 	PLibMCDriver_TCPIPDriver_TCPIP_WaitForDataPtr m_Driver_TCPIP_WaitForData;
 	PLibMCDriver_TCPIPDriver_TCPIP_ReceivePacketPtr m_Driver_TCPIP_ReceivePacket;
+	PLibMCDriver_TCPIPDriver_TCPIP_SetUseIOEnginePtr m_Driver_TCPIP_SetUseIOEngine;
+	PLibMCDriver_TCPIPDriver_TCPIP_SetLengthPrefixFramingPtr m_Driver_TCPIP_SetLengthPrefixFraming;
+	PLibMCDriver_TCPIPDriver_TCPIP_SetDelimiterFramingPtr m_Driver_TCPIP_SetDelimiterFraming;
+	PLibMCDriver_TCPIPDriver_TCPIP_DisableFramingPtr m_Driver_TCPIP_DisableFraming;
+	PLibMCDriver_TCPIPDriver_TCPIP_ReceiveFramedPacketPtr m_Driver_TCPIP_ReceiveFramedPacket;
 	PLibMCDriver_TCPIPGetVersionPtr m_GetVersion;
 	PLibMCDriver_TCPIPGetLastErrorPtr m_GetLastError;
 	PLibMCDriver_TCPIPReleaseInstancePtr m_ReleaseInstance;
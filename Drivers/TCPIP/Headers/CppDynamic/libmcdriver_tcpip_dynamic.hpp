@@ -189,6 +189,12 @@ public:
 			case LIBMCDRIVER_TCPIP_ERROR_CONNECTIONCLOSED: return "CONNECTIONCLOSED";
 			case LIBMCDRIVER_TCPIP_ERROR_RECEIVEERROR: return "RECEIVEERROR";
 			case LIBMCDRIVER_TCPIP_ERROR_SENDCOUNTEXCEEDSMAXIMUM: return "SENDCOUNTEXCEEDSMAXIMUM";
+			case LIBMCDRIVER_TCPIP_ERROR_FRAMINGNOTCONFIGURED: return "FRAMINGNOTCONFIGURED";
+			case LIBMCDRIVER_TCPIP_ERROR_FRAMINGISACTIVE: return "FRAMINGISACTIVE";
+			case LIBMCDRIVER_TCPIP_ERROR_INVALIDFRAMINGPARAMETERS: return "INVALIDFRAMINGPARAMETERS";
+			case LIBMCDRIVER_TCPIP_ERROR_FRAMETOOLARGE: return "FRAMETOOLARGE";
+			case LIBMCDRIVER_TCPIP_ERROR_COULDNOTCREATEIOENGINE: return "COULDNOTCREATEIOENGINE";
+			case LIBMCDRIVER_TCPIP_ERROR_RECEIVETIMEOUT: return "RECEIVETIMEOUT";
 		}
 		return "UNKNOWN";
 	}
@@ -216,6 +222,12 @@ public:
 			case LIBMCDRIVER_TCPIP_ERROR_CONNECTIONCLOSED: return "Connection closed.";
 			case LIBMCDRIVER_TCPIP_ERROR_RECEIVEERROR: return "Receive error.";
 			case LIBMCDRIVER_TCPIP_ERROR_SENDCOUNTEXCEEDSMAXIMUM: return "Send count exceeds maximum.";
+			case LIBMCDRIVER_TCPIP_ERROR_FRAMINGNOTCONFIGURED: return "No packet framing has been configured.";
+			case LIBMCDRIVER_TCPIP_ERROR_FRAMINGISACTIVE: return "Fixed size packets can not be received while packet framing is active.";
+			case LIBMCDRIVER_TCPIP_ERROR_INVALIDFRAMINGPARAMETERS: return "Invalid packet framing parameters.";
+			case LIBMCDRIVER_TCPIP_ERROR_FRAMETOOLARGE: return "Received frame exceeds the maximum packet size.";
+			case LIBMCDRIVER_TCPIP_ERROR_COULDNOTCREATEIOENGINE: return "Could not create socket I/O engine.";
+			case LIBMCDRIVER_TCPIP_ERROR_RECEIVETIMEOUT: return "Receive timeout.";
 		}
 		return "unknown error";
 	}
@@ -463,6 +475,11 @@ public:
 	inline void SendBuffer(const CInputVector<LibMCDriver_TCPIP_uint8> & BufferBuffer);
 	inline bool WaitForData(const LibMCDriver_TCPIP_uint32 nTimeOutInMS);
 	inline PDriver_TCPIPPacket ReceivePacket(const LibMCDriver_TCPIP_uint32 nPacketSize, const LibMCDriver_TCPIP_uint32 nTimeOutInMS);
+	inline void SetUseIOEngine(const bool bUseIOEngine);
+	inline void SetLengthPrefixFraming(const LibMCDriver_TCPIP_uint32 nHeaderSize, const bool bBigEndian, const bool bLengthIncludesHeader, const LibMCDriver_TCPIP_uint32 nMaxPacketSize);
+	inline void SetDelimiterFraming(const std::string & sDelimiter, const LibMCDriver_TCPIP_uint32 nMaxPacketSize);
+	inline void DisableFraming();
+	inline PDriver_TCPIPPacket ReceiveFramedPacket(const LibMCDriver_TCPIP_uint32 nTimeOutInMS);
 };
 	
 	/**
@@ -603,6 +620,11 @@ public:
 		pWrapperTable->m_Driver_TCPIP_SendBuffer = nullptr;
 		pWrapperTable->m_Driver_TCPIP_WaitForData = nullptr;
 		pWrapperTable->m_Driver_TCPIP_ReceivePacket = nullptr;
+		pWrapperTable->m_Driver_TCPIP_SetUseIOEngine = nullptr;
+		pWrapperTable->m_Driver_TCPIP_SetLengthPrefixFraming = nullptr;
+		pWrapperTable->m_Driver_TCPIP_SetDelimiterFraming = nullptr;
+		pWrapperTable->m_Driver_TCPIP_DisableFraming = nullptr;
+		pWrapperTable->m_Driver_TCPIP_ReceiveFramedPacket = nullptr;
 		pWrapperTable->m_GetVersion = nullptr;
 		pWrapperTable->m_GetLastError = nullptr;
 		pWrapperTable->m_ReleaseInstance = nullptr;
@@ -804,6 +826,51 @@ public:
 		if (pWrapperTable->m_Driver_TCPIP_ReceivePacket == nullptr)
 			return LIBMCDRIVER_TCPIP_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_TCPIP_SetUseIOEngine = (PLibMCDriver_TCPIPDriver_TCPIP_SetUseIOEnginePtr) GetProcAddress(hLibrary, "libmcdriver_tcpip_driver_tcpip_setuseioengine");
+		#else // _WIN32
+		pWrapperTable->m_Driver_TCPIP_SetUseIOEngine = (PLibMCDriver_TCPIPDriver_TCPIP_SetUseIOEnginePtr) dlsym(hLibrary, "libmcdriver_tcpip_driver_tcpip_setuseioengine");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_TCPIP_SetUseIOEngine == nullptr)
+			return LIBMCDRIVER_TCPIP_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_TCPIP_SetLengthPrefixFraming = (PLibMCDriver_TCPIPDriver_TCPIP_SetLengthPrefixFramingPtr) GetProcAddress(hLibrary, "libmcdriver_tcpip_driver_tcpip_setlengthprefixframing");
+		#else // _WIN32
+		pWrapperTable->m_Driver_TCPIP_SetLengthPrefixFraming = (PLibMCDriver_TCPIPDriver_TCPIP_SetLengthPrefixFramingPtr) dlsym(hLibrary, "libmcdriver_tcpip_driver_tcpip_setlengthprefixframing");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_TCPIP_SetLengthPrefixFraming == nullptr)
+			return LIBMCDRIVER_TCPIP_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_TCPIP_SetDelimiterFraming = (PLibMCDriver_TCPIPDriver_TCPIP_SetDelimiterFramingPtr) GetProcAddress(hLibrary, "libmcdriver_tcpip_driver_tcpip_setdelimiterframing");
+		#else // _WIN32
+		pWrapperTable->m_Driver_TCPIP_SetDelimiterFraming = (PLibMCDriver_TCPIPDriver_TCPIP_SetDelimiterFramingPtr) dlsym(hLibrary, "libmcdriver_tcpip_driver_tcpip_setdelimiterframing");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_TCPIP_SetDelimiterFraming == nullptr)
+			return LIBMCDRIVER_TCPIP_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_TCPIP_DisableFraming = (PLibMCDriver_TCPIPDriver_TCPIP_DisableFramingPtr) GetProcAddress(hLibrary, "libmcdriver_tcpip_driver_tcpip_disableframing");
+		#else // _WIN32
+		pWrapperTable->m_Driver_TCPIP_DisableFraming = (PLibMCDriver_TCPIPDriver_TCPIP_DisableFramingPtr) dlsym(hLibrary, "libmcdriver_tcpip_driver_tcpip_disableframing");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_TCPIP_DisableFraming == nullptr)
+			return LIBMCDRIVER_TCPIP_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_TCPIP_ReceiveFramedPacket = (PLibMCDriver_TCPIPDriver_TCPIP_ReceiveFramedPacketPtr) GetProcAddress(hLibrary, "libmcdriver_tcpip_driver_tcpip_receiveframedpacket");
+		#else // _WIN32
+		pWrapperTable->m_Driver_TCPIP_ReceiveFramedPacket = (PLibMCDriver_TCPIPDriver_TCPIP_ReceiveFramedPacketPtr) dlsym(hLibrary, "libmcdriver_tcpip_driver_tcpip_receiveframedpacket");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_TCPIP_ReceiveFramedPacket == nullptr)
+			return LIBMCDRIVER_TCPIP_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_GetVersion = (PLibMCDriver_TCPIPGetVersionPtr) GetProcAddress(hLibrary, "libmcdriver_tcpip_getversion");
 		#else // _WIN32
@@ -947,6 +1014,26 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_TCPIP_ReceivePacket == nullptr) )
 			return LIBMCDRIVER_TCPIP_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdriver_tcpip_driver_tcpip_setuseioengine", (void**)&(pWrapperTable->m_Driver_TCPIP_SetUseIOEngine));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_TCPIP_SetUseIOEngine == nullptr) )
+			return LIBMCDRIVER_TCPIP_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_tcpip_driver_tcpip_setlengthprefixframing", (void**)&(pWrapperTable->m_Driver_TCPIP_SetLengthPrefixFraming));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_TCPIP_SetLengthPrefixFraming == nullptr) )
+			return LIBMCDRIVER_TCPIP_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_tcpip_driver_tcpip_setdelimiterframing", (void**)&(pWrapperTable->m_Driver_TCPIP_SetDelimiterFraming));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_TCPIP_SetDelimiterFraming == nullptr) )
+			return LIBMCDRIVER_TCPIP_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_tcpip_driver_tcpip_disableframing", (void**)&(pWrapperTable->m_Driver_TCPIP_DisableFraming));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_TCPIP_DisableFraming == nullptr) )
+			return LIBMCDRIVER_TCPIP_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_tcpip_driver_tcpip_receiveframedpacket", (void**)&(pWrapperTable->m_Driver_TCPIP_ReceiveFramedPacket));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_TCPIP_ReceiveFramedPacket == nullptr) )
+			return LIBMCDRIVER_TCPIP_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdriver_tcpip_getversion", (void**)&(pWrapperTable->m_GetVersion));
 		if ( (eLookupError != 0) || (pWrapperTable->m_GetVersion == nullptr) )
 			return LIBMCDRIVER_TCPIP_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -1184,6 +1271,61 @@ public:
 		}
 		return std::make_shared<CDriver_TCPIPPacket>(m_pWrapper, hPacket);
 	}
+	
+	/**
+	* CDriver_TCPIP::SetUseIOEngine - Runs the following connections on the shared event driven I/O engine instead of a blocking socket. Only engine connections honour the receive timeout of ReceivePacket. Framed connections always use the engine. Takes effect with the next connect.
+	* @param[in] bUseIOEngine - If true, connections use the I/O engine. Default is false.
+	*/
+	void CDriver_TCPIP::SetUseIOEngine(const bool bUseIOEngine)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_TCPIP_SetUseIOEngine(m_pHandle, bUseIOEngine));
+	}
+	
+	/**
+	* CDriver_TCPIP::SetLengthPrefixFraming - Splits the received byte stream into packets that start with a length header. Takes effect with the next connect.
+	* @param[in] nHeaderSize - Size of the length header in bytes. MUST be 1, 2 or 4.
+	* @param[in] bBigEndian - If true, the length header is big endian.
+	* @param[in] bLengthIncludesHeader - If true, the length value includes the header itself.
+	* @param[in] nMaxPacketSize - Maximum payload size in bytes. Larger frames close the connection.
+	*/
+	void CDriver_TCPIP::SetLengthPrefixFraming(const LibMCDriver_TCPIP_uint32 nHeaderSize, const bool bBigEndian, const bool bLengthIncludesHeader, const LibMCDriver_TCPIP_uint32 nMaxPacketSize)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_TCPIP_SetLengthPrefixFraming(m_pHandle, nHeaderSize, bBigEndian, bLengthIncludesHeader, nMaxPacketSize));
+	}
+	
+	/**
+	* CDriver_TCPIP::SetDelimiterFraming - Splits the received byte stream into packets that end with a delimiter. Takes effect with the next connect.
+	* @param[in] sDelimiter - Delimiter sequence, for example a line feed. MUST not be empty.
+	* @param[in] nMaxPacketSize - Maximum payload size in bytes. Larger frames close the connection.
+	*/
+	void CDriver_TCPIP::SetDelimiterFraming(const std::string & sDelimiter, const LibMCDriver_TCPIP_uint32 nMaxPacketSize)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_TCPIP_SetDelimiterFraming(m_pHandle, sDelimiter.c_str(), nMaxPacketSize));
+	}
+	
+	/**
+	* CDriver_TCPIP::DisableFraming - Returns to unframed fixed size packet reception. Takes effect with the next connect.
+	*/
+	void CDriver_TCPIP::DisableFraming()
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_TCPIP_DisableFraming(m_pHandle));
+	}
+	
+	/**
+	* CDriver_TCPIP::ReceiveFramedPacket - Receives the next complete frame. The frame header or delimiter is not part of the packet data. Fails if there is a connection error.
+	* @param[in] nTimeOutInMS - timeout in Milliseconds.
+	* @return Received packet. Empty if no frame arrived within the timeout.
+	*/
+	PDriver_TCPIPPacket CDriver_TCPIP::ReceiveFramedPacket(const LibMCDriver_TCPIP_uint32 nTimeOutInMS)
+	{
+		LibMCDriver_TCPIPHandle hPacket = nullptr;
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_TCPIP_ReceiveFramedPacket(m_pHandle, nTimeOutInMS, &hPacket));
+		
+		if (!hPacket) {
+			CheckError(LIBMCDRIVER_TCPIP_ERROR_INVALIDPARAM);
+		}
+		return std::make_shared<CDriver_TCPIPPacket>(m_pWrapper, hPacket);
+	}
 
 } // namespace LibMCDriver_TCPIP
 
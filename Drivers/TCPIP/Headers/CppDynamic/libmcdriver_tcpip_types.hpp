@@ -115,6 +115,12 @@ typedef void * LibMCDriver_TCPIP_pvoid;
 #define LIBMCDRIVER_TCPIP_ERROR_CONNECTIONCLOSED 1008 /** Connection closed. */
 #define LIBMCDRIVER_TCPIP_ERROR_RECEIVEERROR 1009 /** Receive error. */
 #define LIBMCDRIVER_TCPIP_ERROR_SENDCOUNTEXCEEDSMAXIMUM 1010 /** Send count exceeds maximum. */
+#define LIBMCDRIVER_TCPIP_ERROR_FRAMINGNOTCONFIGURED 1011 /** No packet framing has been configured. */
+#define LIBMCDRIVER_TCPIP_ERROR_FRAMINGISACTIVE 1012 /** Fixed size packets can not be received while packet framing is active. */
+#define LIBMCDRIVER_TCPIP_ERROR_INVALIDFRAMINGPARAMETERS 1013 /** Invalid packet framing parameters. */
+#define LIBMCDRIVER_TCPIP_ERROR_FRAMETOOLARGE 1014 /** Received frame exceeds the maximum packet size. */
+#define LIBMCDRIVER_TCPIP_ERROR_COULDNOTCREATEIOENGINE 1015 /** Could not create socket I/O engine. */
+#define LIBMCDRIVER_TCPIP_ERROR_RECEIVETIMEOUT 1016 /** Receive timeout. */
 
 /*************************************************************************************************************************
  Error strings for LibMCDriver_TCPIP
@@ -142,6 +148,12 @@ inline const char * LIBMCDRIVER_TCPIP_GETERRORSTRING (LibMCDriver_TCPIPResult nE
     case LIBMCDRIVER_TCPIP_ERROR_CONNECTIONCLOSED: return "Connection closed.";
     case LIBMCDRIVER_TCPIP_ERROR_RECEIVEERROR: return "Receive error.";
     case LIBMCDRIVER_TCPIP_ERROR_SENDCOUNTEXCEEDSMAXIMUM: return "Send count exceeds maximum.";
+    case LIBMCDRIVER_TCPIP_ERROR_FRAMINGNOTCONFIGURED: return "No packet framing has been configured.";
+    case LIBMCDRIVER_TCPIP_ERROR_FRAMINGISACTIVE: return "Fixed size packets can not be received while packet framing is active.";
+    case LIBMCDRIVER_TCPIP_ERROR_INVALIDFRAMINGPARAMETERS: return "Invalid packet framing parameters.";
+    case LIBMCDRIVER_TCPIP_ERROR_FRAMETOOLARGE: return "Received frame exceeds the maximum packet size.";
+    case LIBMCDRIVER_TCPIP_ERROR_COULDNOTCREATEIOENGINE: return "Could not create socket I/O engine.";
+    case LIBMCDRIVER_TCPIP_ERROR_RECEIVETIMEOUT: return "Receive timeout.";
     default: return "unknown error";
   }
 }
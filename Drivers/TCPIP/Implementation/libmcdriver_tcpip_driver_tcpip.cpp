@@ -40,6 +40,7 @@ Abstract: This is a stub class definition of CDriver_TCPIP
 #define __STRINGIZE_VALUE_OF(x) __STRINGIZE(x)
 
 #define TCPIPDRIVER_MAXSENDCOUNT (1024UL * 1024UL * 1024UL)
+#define TCPIPDRIVER_MAXRECEIVECOUNT (1024UL * 1024UL * 256UL)
 
 using namespace LibMCDriver_TCPIP::Impl;
 
@@ -48,14 +49,14 @@ using namespace LibMCDriver_TCPIP::Impl;
  Class definition of CDriver_TCPIP 
 **************************************************************************************************************************/
 CDriver_TCPIP::CDriver_TCPIP(const std::string& sName, LibMCEnv::PDriverEnvironment pDriverEnvironment)
-	: m_sName(sName), m_pDriverEnvironment(pDriverEnvironment), m_bSimulationMode(false)
+	: m_sName(sName), m_pDriverEnvironment(pDriverEnvironment), m_bSimulationMode(false), m_bUseIOEngine(false), m_nConnectionID(0), m_bFramingIsActive(false)
 {
 
 }
 
 CDriver_TCPIP::~CDriver_TCPIP()
 {
-
+	Disconnect();
 }
 
 void CDriver_TCPIP::Configure(const std::string& sConfigurationString)
@@ -106,9 +107,43 @@ bool CDriver_TCPIP::IsSimulationMode()
 
 void CDriver_TCPIP::Connect(const std::string& sIPAddress, const LibMCDriver_TCPIP_uint32 nPort, const LibMCDriver_TCPIP_uint32 nTimeout)
 {
-	m_pSocketConnection = nullptr;
+	Disconnect();
+
+	// Blocking sockets have the lowest latency for a single connection. The engine pays off with many connections per process.
+	if (!(m_bUseIOEngine || m_FramerFactory)) {
+		m_pSocketConnection = std::make_shared< CDriver_TCPIPSocketConnection>(sIPAddress, nPort);
+		return;
+	}
 
-	m_pSocketConnection = std::make_shared< CDriver_TCPIPSocketConnection>(sIPAddress, nPort);
+	if (m_pIOEngine.get() == nullptr)
+		m_pIOEngine = CDriver_TCPIPIOEngine::getSharedEngine();
+
+	// The engine thread only refers to the queue, so late callbacks after a disconnect are harmless.
+	auto pReceiveQueue = std::make_shared<sDriver_TCPIPReceiveQueue>();
+	pReceiveQueue->m_nQueuedBytes = 0;
+	pReceiveQueue->m_bIsClosed = false;
+	pReceiveQueue->m_nErrorCode = 0;
+
+	auto packetCallback = [pReceiveQueue](uint64_t nConnectionID, std::vector<CDriver_TCPIPPacketView>& Packets) {
+		std::lock_guard<std::mutex> queueLock(pReceiveQueue->m_Mutex);
+		for (auto& packet : Packets) {
+			pReceiveQueue->m_nQueuedBytes += packet.getSize();
+			pReceiveQueue->m_Packets.push_back(packet);
+		}
+		pReceiveQueue->m_Signal.notify_all();
+	};
+
+	auto closeCallback = [pReceiveQueue](uint64_t nConnectionID, uint32_t nErrorCode, const std::string& sErrorMessage) {
+		std::lock_guard<std::mutex> queueLock(pReceiveQueue->m_Mutex);
+		pReceiveQueue->m_bIsClosed = true;
+		pReceiveQueue->m_nErrorCode = nErrorCode;
+		pReceiveQueue->m_sErrorMessage = sErrorMessage;
+		pReceiveQueue->m_Signal.notify_all();
+	};
+
+	m_nConnectionID = m_pIOEngine->connect(sIPAddress, nPort, nTimeout, m_FramerFactory, packetCallback, closeCallback);
+	m_pReceiveQueue = pReceiveQueue;
+	m_bFramingIsActive = (bool)m_FramerFactory;
 }
 
 void CDriver_TCPIP::Disconnect()
@@ -117,19 +152,53 @@ void CDriver_TCPIP::Disconnect()
 		m_pSocketConnection->disconnect();
 	m_pSocketConnection = nullptr;
 
+	if ((m_pIOEngine.get() != nullptr) && (m_nConnectionID != 0))
+		m_pIOEngine->closeConnection(m_nConnectionID);
+
+	m_nConnectionID = 0;
+	m_pReceiveQueue = nullptr;
+	m_bFramingIsActive = false;
 }
 
-void CDriver_TCPIP::SendBuffer(const LibMCDriver_TCPIP_uint64 nBufferBufferSize, const LibMCDriver_TCPIP_uint8* pBufferBuffer)
+std::shared_ptr<sDriver_TCPIPReceiveQueue> CDriver_TCPIP::getConnectedReceiveQueue()
 {
-
-	if (m_pSocketConnection.get () == nullptr)
+	if ((m_pReceiveQueue.get() == nullptr) || (m_nConnectionID == 0))
 		throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_DRIVERNOTCONNECTED);
 
+	return m_pReceiveQueue;
+}
+
+bool CDriver_TCPIP::waitForQueue(std::unique_lock<std::mutex>& queueLock, sDriver_TCPIPReceiveQueue* pQueue, uint32_t nTimeOutInMS, std::function<bool()> predicate)
+{
+	auto fullPredicate = [pQueue, &predicate] {
+		return predicate() || pQueue->m_bIsClosed;
+	};
+
+	if (nTimeOutInMS == 0)
+		pQueue->m_Signal.wait(queueLock, fullPredicate);
+	else
+		pQueue->m_Signal.wait_for(queueLock, std::chrono::milliseconds(nTimeOutInMS), fullPredicate);
+
+	return predicate();
+}
+
+void CDriver_TCPIP::SendBuffer(const LibMCDriver_TCPIP_uint64 nBufferBufferSize, const LibMCDriver_TCPIP_uint8* pBufferBuffer)
+{
+	if (m_pSocketConnection.get() == nullptr)
+		getConnectedReceiveQueue();
+
 	if ((nBufferBufferSize > 0) && (pBufferBuffer != nullptr)) {
 		if (nBufferBufferSize > TCPIPDRIVER_MAXSENDCOUNT)
 			throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_SENDCOUNTEXCEEDSMAXIMUM);
 
-		m_pSocketConnection->sendBuffer(pBufferBuffer, (size_t) nBufferBufferSize);
+		if (m_pSocketConnection.get() != nullptr) {
+			m_pSocketConnection->sendBuffer(pBufferBuffer, (size_t)nBufferBufferSize);
+			return;
+		}
+
+		// The caller's buffer is only valid during this call, so it is copied once and then sent asynchronously.
+		auto pSendBuffer = std::make_shared<std::vector<uint8_t>>(pBufferBuffer, pBufferBuffer + nBufferBufferSize);
+		m_pIOEngine->send(m_nConnectionID, { pSendBuffer });
 	}
 
 }
@@ -137,30 +206,152 @@ void CDriver_TCPIP::SendBuffer(const LibMCDriver_TCPIP_uint64 nBufferBufferSize,
 
 bool CDriver_TCPIP::WaitForData(const LibMCDriver_TCPIP_uint32 nTimeOutInMS)
 {
-	if (m_pSocketConnection.get() == nullptr)
-		throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_DRIVERNOTCONNECTED);
+	if (m_pSocketConnection.get() != nullptr)
+		return m_pSocketConnection->waitForData(nTimeOutInMS);
+
+	auto pReceiveQueue = getConnectedReceiveQueue();
 
-	return m_pSocketConnection->waitForData(nTimeOutInMS);
+	std::unique_lock<std::mutex> queueLock(pReceiveQueue->m_Mutex);
+	if (!pReceiveQueue->m_Packets.empty())
+		return true;
+	if ((nTimeOutInMS == 0) || pReceiveQueue->m_bIsClosed)
+		return false;
+
+	return pReceiveQueue->m_Signal.wait_for(queueLock, std::chrono::milliseconds(nTimeOutInMS), [&pReceiveQueue] {
+		return (!pReceiveQueue->m_Packets.empty()) || pReceiveQueue->m_bIsClosed;
+	}) && (!pReceiveQueue->m_Packets.empty());
 }
 
 
 IDriver_TCPIPPacket* CDriver_TCPIP::ReceivePacket(const LibMCDriver_TCPIP_uint32 nPacketSize, const LibMCDriver_TCPIP_uint32 nTimeOutInMS) 
 {
-	if (m_pSocketConnection.get() == nullptr)
-		throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_DRIVERNOTCONNECTED);
+	// Blocking connections wait until the packet is complete, regardless of the timeout.
+	if (m_pSocketConnection.get() != nullptr) {
+		std::unique_ptr<CDriver_TCPIPPacket> pPacket(new CDriver_TCPIPPacket());
+		m_pSocketConnection->receiveBuffer(pPacket->getBufferDataReference(), nPacketSize, true);
+
+		return pPacket.release();
+	}
+
+	auto pReceiveQueue = getConnectedReceiveQueue();
+
+	if (m_bFramingIsActive)
+		throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_FRAMINGISACTIVE);
+	if (nPacketSize > TCPIPDRIVER_MAXRECEIVECOUNT)
+		throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_RECEIVECOUNTEXCEEDSMAXIMUM);
+
+	std::unique_lock<std::mutex> queueLock(pReceiveQueue->m_Mutex);
+
+	// Engine connections honour the timeout. A timeout of 0 waits until the packet is complete or the connection closes.
+	if (!waitForQueue(queueLock, pReceiveQueue.get(), nTimeOutInMS, [&pReceiveQueue, nPacketSize] { return pReceiveQueue->m_nQueuedBytes >= nPacketSize; })) {
+		if (pReceiveQueue->m_bIsClosed) {
+			if (pReceiveQueue->m_nErrorCode != 0)
+				throw ELibMCDriver_TCPIPInterfaceException(pReceiveQueue->m_nErrorCode, pReceiveQueue->m_sErrorMessage);
+			throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_CONNECTIONCLOSED);
+		}
+		throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_RECEIVETIMEOUT);
+	}
+
+	auto& packets = pReceiveQueue->m_Packets;
+	pReceiveQueue->m_nQueuedBytes -= nPacketSize;
+
+	// Packets within a single received chunk are handed out without copying.
+	if ((nPacketSize > 0) && (packets.front().getSize() >= nPacketSize)) {
+		auto& frontPacket = packets.front();
+		std::unique_ptr<CDriver_TCPIPPacket> pPacket(new CDriver_TCPIPPacket(frontPacket.subView(0, nPacketSize)));
+		if (frontPacket.getSize() == nPacketSize)
+			packets.pop_front();
+		else
+			frontPacket = frontPacket.subView(nPacketSize, frontPacket.getSize() - nPacketSize);
+
+		return pPacket.release();
+	}
 
 	std::unique_ptr<CDriver_TCPIPPacket> pPacket(new CDriver_TCPIPPacket());
-	m_pSocketConnection->receiveBuffer(pPacket->getBufferDataReference (), nPacketSize, true);
+	auto& bufferData = pPacket->getBufferDataReference();
+	bufferData.reserve(nPacketSize);
+
+	while (bufferData.size() < nPacketSize) {
+		auto& frontPacket = packets.front();
+		size_t nCount = std::min(frontPacket.getSize(), (size_t)nPacketSize - bufferData.size());
+		bufferData.insert(bufferData.end(), frontPacket.getData(), frontPacket.getData() + nCount);
+
+		if (nCount == frontPacket.getSize())
+			packets.pop_front();
+		else
+			frontPacket = frontPacket.subView(nCount, frontPacket.getSize() - nCount);
+	}
 
 	return pPacket.release();
 
 }
 
+void CDriver_TCPIP::SetUseIOEngine(const bool bUseIOEngine)
+{
+	m_bUseIOEngine = bUseIOEngine;
+}
+
+void CDriver_TCPIP::SetLengthPrefixFraming(const LibMCDriver_TCPIP_uint32 nHeaderSize, const bool bBigEndian, const bool bLengthIncludesHeader, const LibMCDriver_TCPIP_uint32 nMaxPacketSize)
+{
+	// Validates the parameters right away, instead of at the next connect.
+	CDriver_TCPIPLengthPrefixFramer framer(nHeaderSize, bBigEndian, bLengthIncludesHeader, nMaxPacketSize);
+
+	m_FramerFactory = [nHeaderSize, bBigEndian, bLengthIncludesHeader, nMaxPacketSize]() -> PDriver_TCPIPFramer {
+		return std::make_shared<CDriver_TCPIPLengthPrefixFramer>(nHeaderSize, bBigEndian, bLengthIncludesHeader, nMaxPacketSize);
+	};
+}
+
+void CDriver_TCPIP::SetDelimiterFraming(const std::string& sDelimiter, const LibMCDriver_TCPIP_uint32 nMaxPacketSize)
+{
+	CDriver_TCPIPDelimiterFramer framer(sDelimiter, nMaxPacketSize);
+
+	m_FramerFactory = [sDelimiter, nMaxPacketSize]() -> PDriver_TCPIPFramer {
+		return std::make_shared<CDriver_TCPIPDelimiterFramer>(sDelimiter, nMaxPacketSize);
+	};
+}
+
+void CDriver_TCPIP::DisableFraming()
+{
+	m_FramerFactory = nullptr;
+}
+
+IDriver_TCPIPPacket* CDriver_TCPIP::ReceiveFramedPacket(const LibMCDriver_TCPIP_uint32 nTimeOutInMS)
+{
+	if (m_pSocketConnection.get() != nullptr)
+		throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_FRAMINGNOTCONFIGURED);
+
+	auto pReceiveQueue = getConnectedReceiveQueue();
+
+	if (!m_bFramingIsActive)
+		throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_FRAMINGNOTCONFIGURED);
+
+	std::unique_lock<std::mutex> queueLock(pReceiveQueue->m_Mutex);
+	if (!waitForQueue(queueLock, pReceiveQueue.get(), nTimeOutInMS, [&pReceiveQueue] { return !pReceiveQueue->m_Packets.empty(); })) {
+		if (pReceiveQueue->m_bIsClosed) {
+			if (pReceiveQueue->m_nErrorCode != 0)
+				throw ELibMCDriver_TCPIPInterfaceException(pReceiveQueue->m_nErrorCode, pReceiveQueue->m_sErrorMessage);
+			throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_CONNECTIONCLOSED);
+		}
+
+		return new CDriver_TCPIPPacket();
+	}
+
+	std::unique_ptr<CDriver_TCPIPPacket> pPacket(new CDriver_TCPIPPacket(pReceiveQueue->m_Packets.front()));
+	pReceiveQueue->m_nQueuedBytes -= pReceiveQueue->m_Packets.front().getSize();
+	pReceiveQueue->m_Packets.pop_front();
+
+	return pPacket.release();
+}
+
 bool CDriver_TCPIP::IsConnected()
 {
 	if (m_pSocketConnection.get() != nullptr) {
 		return m_pSocketConnection->isConnected();
 	}
 
+	if ((m_pIOEngine.get() != nullptr) && (m_nConnectionID != 0)) {
+		return m_pIOEngine->isConnected(m_nConnectionID);
+	}
+
 	return false;
 }
@@ -37,6 +37,7 @@ Abstract: This is the class declaration of CDriver_TCPIP
 
 #include "libmcdriver_tcpip_interfaces.hpp"
 #include "libmcdriver_tcpip_sockets.hpp"
+#include "libmcdriver_tcpip_ioengine.hpp"
 
 // Parent classes
 #include "libmcdriver_tcpip_driver.hpp"
@@ -46,12 +47,29 @@ Abstract: This is the class declaration of CDriver_TCPIP
 #endif
 
 // Include custom headers here.
+#include <deque>
+#include <condition_variable>
 
 
 namespace LibMCDriver_TCPIP {
 namespace Impl {
 
 
+/*************************************************************************************************************************
+ Received packets of a connection. Filled by the I/O engine thread.
+**************************************************************************************************************************/
+
+struct sDriver_TCPIPReceiveQueue {
+	std::mutex m_Mutex;
+	std::condition_variable m_Signal;
+	std::deque<CDriver_TCPIPPacketView> m_Packets;
+	size_t m_nQueuedBytes;
+	bool m_bIsClosed;
+	uint32_t m_nErrorCode;
+	std::string m_sErrorMessage;
+};
+
+
 /*************************************************************************************************************************
  Class declaration of CDriver_TCPIP 
 **************************************************************************************************************************/
@@ -65,8 +83,27 @@ private:
 
 	bool m_bSimulationMode;
 
+	// Selects the I/O engine for the next connection. Blocking socket connections are the default.
+	bool m_bUseIOEngine;
+
 	std::shared_ptr<CDriver_TCPIPSocketConnection> m_pSocketConnection;
 
+	PDriver_TCPIPIOEngine m_pIOEngine;
+
+	uint64_t m_nConnectionID;
+
+	std::shared_ptr<sDriver_TCPIPReceiveQueue> m_pReceiveQueue;
+
+	// Framing of the next connection. An empty factory receives the unframed byte stream.
+	TCPIPFramerFactory m_FramerFactory;
+
+	// Framing of the current connection.
+	bool m_bFramingIsActive;
+
+	std::shared_ptr<sDriver_TCPIPReceiveQueue> getConnectedReceiveQueue();
+
+	bool waitForQueue(std::unique_lock<std::mutex>& queueLock, sDriver_TCPIPReceiveQueue* pQueue, uint32_t nTimeOutInMS, std::function<bool()> predicate);
+
 protected:
 
 public:
@@ -101,6 +138,16 @@ public:
 
 	IDriver_TCPIPPacket* ReceivePacket(const LibMCDriver_TCPIP_uint32 nPacketSize, const LibMCDriver_TCPIP_uint32 nTimeOutInMS) override;
 
+	void SetUseIOEngine(const bool bUseIOEngine) override;
+
+	void SetLengthPrefixFraming(const LibMCDriver_TCPIP_uint32 nHeaderSize, const bool bBigEndian, const bool bLengthIncludesHeader, const LibMCDriver_TCPIP_uint32 nMaxPacketSize) override;
+
+	void SetDelimiterFraming(const std::string& sDelimiter, const LibMCDriver_TCPIP_uint32 nMaxPacketSize) override;
+
+	void DisableFraming() override;
+
+	IDriver_TCPIPPacket* ReceiveFramedPacket(const LibMCDriver_TCPIP_uint32 nTimeOutInMS) override;
+
 	bool IsConnected() override;
 };
 
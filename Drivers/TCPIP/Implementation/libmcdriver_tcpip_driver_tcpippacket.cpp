@@ -35,6 +35,8 @@ Abstract: This is a stub class definition of CDriver_TCPIPPacket
 #include "libmcdriver_tcpip_interfaceexception.hpp"
 
 // Include custom headers here.
+#include <cstring>
+
 #define TCPIPDRIVER_MAXPACKETSIZE (1024UL * 1024UL * 1024UL)
 
 using namespace LibMCDriver_TCPIP::Impl;
@@ -43,6 +45,13 @@ using namespace LibMCDriver_TCPIP::Impl;
  Class definition of CDriver_TCPIPPacket 
 **************************************************************************************************************************/
 CDriver_TCPIPPacket::CDriver_TCPIPPacket()
+    : m_bUsesView(false)
+{
+
+}
+
+CDriver_TCPIPPacket::CDriver_TCPIPPacket(const CDriver_TCPIPPacketView& View)
+    : m_View(View), m_bUsesView(true)
 {
 
 }
@@ -52,20 +61,35 @@ CDriver_TCPIPPacket::~CDriver_TCPIPPacket()
 
 }
 
-LibMCDriver_TCPIP_uint32 CDriver_TCPIPPacket::GetSize()
+void CDriver_TCPIPPacket::getPacketData(const uint8_t*& pData, uint64_t& nSize)
 {
-    if (m_BufferData.size() > TCPIPDRIVER_MAXPACKETSIZE)
+    if (m_bUsesView) {
+        pData = m_View.getData();
+        nSize = m_View.getSize();
+    }
+    else {
+        pData = m_BufferData.data();
+        nSize = m_BufferData.size();
+    }
+
+    if (nSize > TCPIPDRIVER_MAXPACKETSIZE)
         throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_RECEIVECOUNTEXCEEDSMAXIMUM);
+}
 
-    return (uint32_t) m_BufferData.size();
+LibMCDriver_TCPIP_uint32 CDriver_TCPIPPacket::GetSize()
+{
+    const uint8_t* pData = nullptr;
+    uint64_t nPacketSize = 0;
+    getPacketData(pData, nPacketSize);
+
+    return (uint32_t) nPacketSize;
 }
 
 void CDriver_TCPIPPacket::GetData(LibMCDriver_TCPIP_uint64 nBufferBufferSize, LibMCDriver_TCPIP_uint64* pBufferNeededCount, LibMCDriver_TCPIP_uint8 * pBufferBuffer)
 {
-    uint64_t nPacketSize = m_BufferData.size();
-    if (nPacketSize > TCPIPDRIVER_MAXPACKETSIZE)
-        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_RECEIVECOUNTEXCEEDSMAXIMUM);
-
+    const uint8_t* pData = nullptr;
+    uint64_t nPacketSize = 0;
+    getPacketData(pData, nPacketSize);
 
     if (pBufferNeededCount != nullptr)
         *pBufferNeededCount = nPacketSize;
@@ -75,16 +99,8 @@ void CDriver_TCPIPPacket::GetData(LibMCDriver_TCPIP_uint64 nBufferBufferSize, Li
         if (nBufferBufferSize < nPacketSize)
             throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_BUFFERTOOSMALL);
 
-        
-        if (nPacketSize > 0) {
-            uint8_t* pSrc = m_BufferData.data();
-            uint8_t* pDst = pBufferBuffer;
-            for (uint64_t nIndex = 0; nIndex < nPacketSize; nIndex++) {
-                *pDst = *pSrc;
-                pDst++;
-                pSrc++;
-            }
-        }
+        if (nPacketSize > 0)
+            memcpy(pBufferBuffer, pData, (size_t)nPacketSize);
     }
 }
 
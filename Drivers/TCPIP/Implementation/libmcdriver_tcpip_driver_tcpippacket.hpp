@@ -36,6 +36,7 @@ Abstract: This is the class declaration of CDriver_TCPIPPacket
 #define __LIBMCDRIVER_TCPIP_DRIVER_TCPIPPACKET
 
 #include "libmcdriver_tcpip_interfaces.hpp"
+#include "libmcdriver_tcpip_framing.hpp"
 
 // Parent classes
 #include "libmcdriver_tcpip_base.hpp"
@@ -63,9 +64,16 @@ protected:
 
     std::vector<uint8_t> m_BufferData;
 
+    // Packets that were received by the I/O engine refer to the receive buffer instead of owning a copy.
+    CDriver_TCPIPPacketView m_View;
+    bool m_bUsesView;
+
+    void getPacketData(const uint8_t*& pData, uint64_t& nSize);
+
 public:
 
     CDriver_TCPIPPacket();
+    CDriver_TCPIPPacket(const CDriver_TCPIPPacketView& View);
     virtual ~CDriver_TCPIPPacket();
 
 	LibMCDriver_TCPIP_uint32 GetSize() override;
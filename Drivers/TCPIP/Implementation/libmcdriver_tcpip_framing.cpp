@@ -0,0 +1,310 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: Pooled receive buffers and packet framing of the TCP/IP I/O engine
+
+*/
+
+#include "libmcdriver_tcpip_framing.hpp"
+#include "libmcdriver_tcpip_interfaceexception.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace LibMCDriver_TCPIP::Impl;
+
+// Receive calls are never issued with less free space than this.
+#define TCPIPFRAMING_MINIMUMRECEIVESPACE 4096
+
+CDriver_TCPIPBufferBlock::CDriver_TCPIPBufferBlock(size_t nCapacity)
+    : m_Data(nCapacity)
+{
+}
+
+uint8_t* CDriver_TCPIPBufferBlock::getData()
+{
+    return m_Data.data();
+}
+
+size_t CDriver_TCPIPBufferBlock::getCapacity()
+{
+    return m_Data.size();
+}
+
+
+CDriver_TCPIPBufferPool::CDriver_TCPIPBufferPool(size_t nBlockSize, size_t nMaxFreeBlocks)
+    : m_nBlockSize(std::max(nBlockSize, (size_t)TCPIPFRAMING_MINIMUMRECEIVESPACE)), m_nMaxFreeBlocks(nMaxFreeBlocks)
+{
+}
+
+PDriver_TCPIPBufferBlock CDriver_TCPIPBufferPool::acquireBlock(size_t nMinimumSize)
+{
+    if (nMinimumSize > m_nBlockSize)
+        return std::make_shared<CDriver_TCPIPBufferBlock>(nMinimumSize);
+
+    std::unique_ptr<CDriver_TCPIPBufferBlock> pBlock;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        if (!m_FreeBlocks.empty()) {
+            pBlock = std::move(m_FreeBlocks.back());
+            m_FreeBlocks.pop_back();
+        }
+    }
+
+    if (pBlock.get() == nullptr)
+        pBlock.reset(new CDriver_TCPIPBufferBlock(m_nBlockSize));
+
+    std::weak_ptr<CDriver_TCPIPBufferPool> pWeakPool = shared_from_this();
+    return PDriver_TCPIPBufferBlock(pBlock.release(), [pWeakPool](CDriver_TCPIPBufferBlock* pReleasedBlock) {
+        auto pPool = pWeakPool.lock();
+        if (pPool.get() != nullptr)
+            pPool->releaseBlock(pReleasedBlock);
+        else
+            delete pReleasedBlock;
+    });
+}
+
+void CDriver_TCPIPBufferPool::releaseBlock(CDriver_TCPIPBufferBlock* pBlock)
+{
+    std::unique_ptr<CDriver_TCPIPBufferBlock> pOwnedBlock(pBlock);
+
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    if (m_FreeBlocks.size() < m_nMaxFreeBlocks)
+        m_FreeBlocks.push_back(std::move(pOwnedBlock));
+}
+
+size_t CDriver_TCPIPBufferPool::getBlockSize()
+{
+    return m_nBlockSize;
+}
+
+
+CDriver_TCPIPPacketView::CDriver_TCPIPPacketView()
+    : m_pData(nullptr), m_nSize(0)
+{
+}
+
+CDriver_TCPIPPacketView::CDriver_TCPIPPacketView(PDriver_TCPIPBufferBlock pBlock, size_t nOffset, size_t nSize)
+    : m_pBlock(pBlock), m_pData(nullptr), m_nSize(nSize)
+{
+    if (pBlock.get() == nullptr)
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_INVALIDPARAM);
+    if ((nOffset > pBlock->getCapacity()) || (nSize > pBlock->getCapacity() - nOffset))
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_INVALIDPARAM);
+
+    m_pData = pBlock->getData() + nOffset;
+}
+
+const uint8_t* CDriver_TCPIPPacketView::getData() const
+{
+    return m_pData;
+}
+
+size_t CDriver_TCPIPPacketView::getSize() const
+{
+    return m_nSize;
+}
+
+CDriver_TCPIPPacketView CDriver_TCPIPPacketView::subView(size_t nOffset, size_t nSize) const
+{
+    if ((nOffset > m_nSize) || (nSize > m_nSize - nOffset))
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_INVALIDPARAM);
+
+    CDriver_TCPIPPacketView view(*this);
+    view.m_pData += nOffset;
+    view.m_nSize = nSize;
+    return view;
+}
+
+
+bool CDriver_TCPIPRawFramer::findFrame(const uint8_t* pData, size_t nSize, size_t& nPayloadOffset, size_t& nPayloadSize, size_t& nFrameSize, size_t& nRequiredSize)
+{
+    nRequiredSize = 0;
+    if (nSize == 0)
+        return false;
+
+    nPayloadOffset = 0;
+    nPayloadSize = nSize;
+    nFrameSize = nSize;
+    return true;
+}
+
+
+CDriver_TCPIPLengthPrefixFramer::CDriver_TCPIPLengthPrefixFramer(uint32_t nHeaderSize, bool bBigEndian, bool bLengthIncludesHeader, uint32_t nMaxPacketSize)
+    : m_nHeaderSize(nHeaderSize), m_bBigEndian(bBigEndian), m_bLengthIncludesHeader(bLengthIncludesHeader), m_nMaxPacketSize(nMaxPacketSize)
+{
+    if ((nHeaderSize != 1) && (nHeaderSize != 2) && (nHeaderSize != 4))
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_INVALIDFRAMINGPARAMETERS, "invalid length header size: " + std::to_string(nHeaderSize));
+    if (nMaxPacketSize == 0)
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_INVALIDFRAMINGPARAMETERS, "invalid maximum packet size");
+}
+
+bool CDriver_TCPIPLengthPrefixFramer::findFrame(const uint8_t* pData, size_t nSize, size_t& nPayloadOffset, size_t& nPayloadSize, size_t& nFrameSize, size_t& nRequiredSize)
+{
+    nRequiredSize = m_nHeaderSize;
+    if (nSize < m_nHeaderSize)
+        return false;
+
+    uint64_t nLength = 0;
+    for (uint32_t nIndex = 0; nIndex < m_nHeaderSize; nIndex++) {
+        uint32_t nByteIndex = m_bBigEndian ? nIndex : (m_nHeaderSize - 1 - nIndex);
+        nLength = (nLength << 8) | pData[nByteIndex];
+    }
+
+    if (m_bLengthIncludesHeader) {
+        if (nLength < m_nHeaderSize)
+            throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_RECEIVEERROR, "invalid frame length: " + std::to_string(nLength));
+        nLength -= m_nHeaderSize;
+    }
+
+    if (nLength > m_nMaxPacketSize)
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_FRAMETOOLARGE, "frame length " + std::to_string(nLength) + " exceeds " + std::to_string(m_nMaxPacketSize));
+
+    nRequiredSize = m_nHeaderSize + (size_t)nLength;
+    if (nSize < nRequiredSize)
+        return false;
+
+    nPayloadOffset = m_nHeaderSize;
+    nPayloadSize = (size_t)nLength;
+    nFrameSize = nRequiredSize;
+    nRequiredSize = 0;
+    return true;
+}
+
+
+CDriver_TCPIPDelimiterFramer::CDriver_TCPIPDelimiterFramer(const std::string& sDelimiter, uint32_t nMaxPacketSize)
+    : m_sDelimiter(sDelimiter), m_nMaxPacketSize(nMaxPacketSize), m_nScanPosition(0)
+{
+    if (sDelimiter.empty())
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_INVALIDFRAMINGPARAMETERS, "empty frame delimiter");
+    if (nMaxPacketSize == 0)
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_INVALIDFRAMINGPARAMETERS, "invalid maximum packet size");
+}
+
+bool CDriver_TCPIPDelimiterFramer::findFrame(const uint8_t* pData, size_t nSize, size_t& nPayloadOffset, size_t& nPayloadSize, size_t& nFrameSize, size_t& nRequiredSize)
+{
+    nRequiredSize = 0;
+
+    const uint8_t* pDelimiter = (const uint8_t*)m_sDelimiter.data();
+    size_t nDelimiterLength = m_sDelimiter.size();
+
+    const uint8_t* pEnd = pData + nSize;
+    const uint8_t* pFound = std::search(pData + std::min(m_nScanPosition, nSize), pEnd, pDelimiter, pDelimiter + nDelimiterLength);
+
+    if (pFound == pEnd) {
+        // A delimiter might straddle the end of the data, so the next search starts in front of it.
+        m_nScanPosition = (nSize >= nDelimiterLength) ? (nSize - nDelimiterLength + 1) : 0;
+
+        if (nSize > (size_t)m_nMaxPacketSize + nDelimiterLength)
+            throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_FRAMETOOLARGE, "no delimiter within " + std::to_string(m_nMaxPacketSize) + " bytes");
+        return false;
+    }
+
+    size_t nPosition = (size_t)(pFound - pData);
+    if (nPosition > m_nMaxPacketSize)
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_FRAMETOOLARGE, "frame length " + std::to_string(nPosition) + " exceeds " + std::to_string(m_nMaxPacketSize));
+
+    m_nScanPosition = 0;
+    nPayloadOffset = 0;
+    nPayloadSize = nPosition;
+    nFrameSize = nPosition + nDelimiterLength;
+    return true;
+}
+
+
+CDriver_TCPIPFrameReader::CDriver_TCPIPFrameReader(PDriver_TCPIPBufferPool pPool, PDriver_TCPIPFramer pFramer)
+    : m_pPool(pPool), m_pFramer(pFramer), m_nReadPosition(0), m_nWritePosition(0), m_nRequiredSize(0)
+{
+    if ((pPool.get() == nullptr) || (pFramer.get() == nullptr))
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_INVALIDPARAM);
+}
+
+uint8_t* CDriver_TCPIPFrameReader::prepareReceive(size_t& nFreeSize)
+{
+    size_t nPendingSize = m_nWritePosition - m_nReadPosition;
+
+    if ((m_pBlock.get() != nullptr) && (nPendingSize == 0) && (m_pBlock.use_count() == 1)) {
+        // No packet view refers to the block anymore, so it can be refilled from the start.
+        m_nReadPosition = 0;
+        m_nWritePosition = 0;
+    }
+
+    bool bNeedsNewBlock = (m_pBlock.get() == nullptr);
+    if (!bNeedsNewBlock) {
+        size_t nCapacity = m_pBlock->getCapacity();
+        if (nCapacity - m_nWritePosition < TCPIPFRAMING_MINIMUMRECEIVESPACE)
+            bNeedsNewBlock = true;
+        if ((m_nRequiredSize > 0) && (nCapacity - m_nReadPosition < m_nRequiredSize))
+            bNeedsNewBlock = true;
+    }
+
+    if (bNeedsNewBlock) {
+        // Frames of unknown length double the buffer, so that long frames are only copied a logarithmic number of times.
+        size_t nNewSize = std::max(nPendingSize + std::max(nPendingSize, (size_t)TCPIPFRAMING_MINIMUMRECEIVESPACE), m_nRequiredSize + TCPIPFRAMING_MINIMUMRECEIVESPACE);
+        PDriver_TCPIPBufferBlock pNewBlock = m_pPool->acquireBlock(nNewSize);
+
+        if (nPendingSize > 0)
+            memcpy(pNewBlock->getData(), m_pBlock->getData() + m_nReadPosition, nPendingSize);
+
+        m_pBlock = pNewBlock;
+        m_nReadPosition = 0;
+        m_nWritePosition = nPendingSize;
+    }
+
+    nFreeSize = m_pBlock->getCapacity() - m_nWritePosition;
+    return m_pBlock->getData() + m_nWritePosition;
+}
+
+void CDriver_TCPIPFrameReader::commitReceive(size_t nCount)
+{
+    if ((m_pBlock.get() == nullptr) || (nCount > m_pBlock->getCapacity() - m_nWritePosition))
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_INVALIDPARAM);
+
+    m_nWritePosition += nCount;
+}
+
+void CDriver_TCPIPFrameReader::extractFrames(std::vector<CDriver_TCPIPPacketView>& Frames)
+{
+    while (m_nReadPosition < m_nWritePosition) {
+        size_t nPayloadOffset = 0;
+        size_t nPayloadSize = 0;
+        size_t nFrameSize = 0;
+        size_t nRequiredSize = 0;
+
+        if (!m_pFramer->findFrame(m_pBlock->getData() + m_nReadPosition, m_nWritePosition - m_nReadPosition, nPayloadOffset, nPayloadSize, nFrameSize, nRequiredSize)) {
+            m_nRequiredSize = nRequiredSize;
+            return;
+        }
+
+        Frames.push_back(CDriver_TCPIPPacketView(m_pBlock, m_nReadPosition + nPayloadOffset, nPayloadSize));
+        m_nReadPosition += nFrameSize;
+    }
+
+    m_nRequiredSize = 0;
+}
@@ -0,0 +1,178 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: Pooled receive buffers and packet framing of the TCP/IP I/O engine
+
+*/
+
+
+#ifndef __LIBMCDRIVER_TCPIP_FRAMING
+#define __LIBMCDRIVER_TCPIP_FRAMING
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <functional>
+#include <cstdint>
+
+
+namespace LibMCDriver_TCPIP {
+namespace Impl {
+
+
+class CDriver_TCPIPBufferPool;
+
+// A receive buffer. Blocks are shared between the frame reader that fills them and all packet views that point into them.
+class CDriver_TCPIPBufferBlock {
+private:
+    std::vector<uint8_t> m_Data;
+public:
+    CDriver_TCPIPBufferBlock(size_t nCapacity);
+
+    uint8_t* getData();
+    size_t getCapacity();
+};
+
+typedef std::shared_ptr<CDriver_TCPIPBufferBlock> PDriver_TCPIPBufferBlock;
+
+
+// Recycles fixed size blocks. A block returns to the pool when its last reference is released.
+// Oversized blocks are not pooled.
+class CDriver_TCPIPBufferPool : public std::enable_shared_from_this<CDriver_TCPIPBufferPool> {
+private:
+    std::mutex m_Mutex;
+    std::vector<std::unique_ptr<CDriver_TCPIPBufferBlock>> m_FreeBlocks;
+    size_t m_nBlockSize;
+    size_t m_nMaxFreeBlocks;
+
+    void releaseBlock(CDriver_TCPIPBufferBlock* pBlock);
+
+public:
+    CDriver_TCPIPBufferPool(size_t nBlockSize, size_t nMaxFreeBlocks);
+
+    PDriver_TCPIPBufferBlock acquireBlock(size_t nMinimumSize);
+
+    size_t getBlockSize();
+};
+
+typedef std::shared_ptr<CDriver_TCPIPBufferPool> PDriver_TCPIPBufferPool;
+
+
+// A read-only window into a receive block. Copying a view does not copy any packet data.
+class CDriver_TCPIPPacketView {
+private:
+    PDriver_TCPIPBufferBlock m_pBlock;
+    const uint8_t* m_pData;
+    size_t m_nSize;
+public:
+    CDriver_TCPIPPacketView();
+    CDriver_TCPIPPacketView(PDriver_TCPIPBufferBlock pBlock, size_t nOffset, size_t nSize);
+
+    const uint8_t* getData() const;
+    size_t getSize() const;
+
+    CDriver_TCPIPPacketView subView(size_t nOffset, size_t nSize) const;
+};
+
+
+// Splits a byte stream into frames.
+class CDriver_TCPIPFramer {
+public:
+    virtual ~CDriver_TCPIPFramer() {}
+
+    // Returns true if pData starts with a complete frame. Otherwise nRequiredSize is set to the full
+    // frame size if it is already known, or 0. Throws FRAMETOOLARGE if the frame can never be accepted.
+    virtual bool findFrame(const uint8_t* pData, size_t nSize, size_t& nPayloadOffset, size_t& nPayloadSize, size_t& nFrameSize, size_t& nRequiredSize) = 0;
+};
+
+typedef std::shared_ptr<CDriver_TCPIPFramer> PDriver_TCPIPFramer;
+typedef std::function<PDriver_TCPIPFramer()> TCPIPFramerFactory;
+
+
+// Passes on every received chunk unchanged.
+class CDriver_TCPIPRawFramer : public CDriver_TCPIPFramer {
+public:
+    bool findFrame(const uint8_t* pData, size_t nSize, size_t& nPayloadOffset, size_t& nPayloadSize, size_t& nFrameSize, size_t& nRequiredSize) override;
+};
+
+
+// Frames start with an unsigned length header of 1, 2 or 4 bytes.
+class CDriver_TCPIPLengthPrefixFramer : public CDriver_TCPIPFramer {
+private:
+    uint32_t m_nHeaderSize;
+    bool m_bBigEndian;
+    bool m_bLengthIncludesHeader;
+    uint32_t m_nMaxPacketSize;
+public:
+    CDriver_TCPIPLengthPrefixFramer(uint32_t nHeaderSize, bool bBigEndian, bool bLengthIncludesHeader, uint32_t nMaxPacketSize);
+
+    bool findFrame(const uint8_t* pData, size_t nSize, size_t& nPayloadOffset, size_t& nPayloadSize, size_t& nFrameSize, size_t& nRequiredSize) override;
+};
+
+
+// Frames end with a delimiter sequence. The search resumes where the last unsuccessful search stopped.
+class CDriver_TCPIPDelimiterFramer : public CDriver_TCPIPFramer {
+private:
+    std::string m_sDelimiter;
+    uint32_t m_nMaxPacketSize;
+    size_t m_nScanPosition;
+public:
+    CDriver_TCPIPDelimiterFramer(const std::string& sDelimiter, uint32_t nMaxPacketSize);
+
+    bool findFrame(const uint8_t* pData, size_t nSize, size_t& nPayloadOffset, size_t& nPayloadSize, size_t& nFrameSize, size_t& nRequiredSize) override;
+};
+
+
+// Receives into pooled blocks and cuts complete frames out of them. Only the unfinished tail of a block
+// is ever copied, when it does not fit into the remaining space.
+class CDriver_TCPIPFrameReader {
+private:
+    PDriver_TCPIPBufferPool m_pPool;
+    PDriver_TCPIPFramer m_pFramer;
+    PDriver_TCPIPBufferBlock m_pBlock;
+    size_t m_nReadPosition;
+    size_t m_nWritePosition;
+    size_t m_nRequiredSize;
+
+public:
+    CDriver_TCPIPFrameReader(PDriver_TCPIPBufferPool pPool, PDriver_TCPIPFramer pFramer);
+
+    // Returns the free space that the next receive call may fill.
+    uint8_t* prepareReceive(size_t& nFreeSize);
+
+    void commitReceive(size_t nCount);
+
+    void extractFrames(std::vector<CDriver_TCPIPPacketView>& Frames);
+};
+
+} // namespace Impl
+} // namespace LibMCDriver_TCPIP
+
+#endif // __LIBMCDRIVER_TCPIP_FRAMING
@@ -0,0 +1,1009 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: Event driven socket I/O engine of the TCP/IP driver
+
+*/
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include <windows.h>
+
+typedef SOCKET TCPIPEngineSocket;
+typedef WSAPOLLFD TCPIPEnginePollFD;
+
+#define TCPIPENGINE_INVALIDSOCKET INVALID_SOCKET
+#define TCPIPENGINE_CLOSESOCKET closesocket
+#define TCPIPENGINE_POLL WSAPoll
+#define TCPIPENGINE_SHUTDOWNBOTH SD_BOTH
+#else
+
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <errno.h>
+#include <unistd.h>
+
+typedef int TCPIPEngineSocket;
+typedef struct pollfd TCPIPEnginePollFD;
+
+#define TCPIPENGINE_INVALIDSOCKET -1
+#define TCPIPENGINE_CLOSESOCKET close
+#define TCPIPENGINE_POLL poll
+#define TCPIPENGINE_SHUTDOWNBOTH SHUT_RDWR
+#endif //_WIN32
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#define TCPIPENGINE_USEEPOLL
+#endif //__linux__
+
+#ifdef MSG_NOSIGNAL
+#define TCPIPENGINE_SENDFLAGS MSG_NOSIGNAL
+#else
+#define TCPIPENGINE_SENDFLAGS 0
+#endif
+
+#include "libmcdriver_tcpip_ioengine.hpp"
+#include "libmcdriver_tcpip_sockets.hpp"
+#include "libmcdriver_tcpip_interfaceexception.hpp"
+
+#include <deque>
+#include <condition_variable>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+using namespace LibMCDriver_TCPIP::Impl;
+
+// Wait time of the engine loop. Changes to the socket set wake the engine up right away.
+#define TCPIPENGINE_TICKINMS 10
+#define TCPIPENGINE_MAXEVENTS 64
+#define TCPIPENGINE_MAXGATHERBUFFERS 64
+#define TCPIPENGINE_MAXREADSPERWAKEUP 16
+#define TCPIPENGINE_MAXRECEIVECHUNK (1024 * 1024 * 16)
+#define TCPIPENGINE_MAXQUEUEDSENDBYTES (1024 * 1024 * 64)
+#define TCPIPENGINE_RECEIVEBLOCKSIZE (1024 * 64)
+#define TCPIPENGINE_MAXPOOLEDBLOCKS 256
+
+// ID of the wake up event in the poll set. Connection and listener IDs start at 1.
+#define TCPIPENGINE_WAKEUPID 0
+
+
+namespace LibMCDriver_TCPIP {
+namespace Impl {
+
+    struct sDriver_TCPIPEngineConnection {
+        uint64_t m_nConnectionID;
+        uint64_t m_Socket;
+
+        // Only accessed by the engine thread.
+        std::unique_ptr<CDriver_TCPIPFrameReader> m_pFrameReader;
+        TCPIPPacketCallback m_PacketCallback;
+        TCPIPCloseCallback m_CloseCallback;
+
+        // Guarded by m_SendMutex. The socket is closed under this mutex, so that senders never write to a recycled handle.
+        std::mutex m_SendMutex;
+        std::condition_variable m_SendSignal;
+        std::deque<PDriver_TCPIPSendBuffer> m_SendQueue;
+        size_t m_nSendOffset;
+        size_t m_nQueuedBytes;
+        bool m_bIsOpen;
+        uint32_t m_nCloseErrorCode;
+        std::string m_sCloseErrorMessage;
+
+        std::atomic<bool> m_bWantsWrite;
+    };
+
+    struct sDriver_TCPIPEngineListener {
+        uint64_t m_nListenerID;
+        uint64_t m_Socket;
+        TCPIPFramerFactory m_FramerFactory;
+        TCPIPPacketCallback m_PacketCallback;
+        TCPIPCloseCallback m_CloseCallback;
+        TCPIPAcceptCallback m_AcceptCallback;
+    };
+
+} // namespace Impl
+} // namespace LibMCDriver_TCPIP
+
+
+static int getLastSocketError()
+{
+#ifdef _WIN32
+    return WSAGetLastError();
+#else
+    return errno;
+#endif
+}
+
+static bool socketErrorIsWouldBlock(int nError)
+{
+#ifdef _WIN32
+    return (nError == WSAEWOULDBLOCK);
+#else
+    return (nError == EAGAIN) || (nError == EWOULDBLOCK);
+#endif
+}
+
+static bool socketErrorIsInterrupt(int nError)
+{
+#ifdef _WIN32
+    return (nError == WSAEINTR);
+#else
+    return (nError == EINTR);
+#endif
+}
+
+static void prepareSocket(TCPIPEngineSocket Socket, bool bNoDelay)
+{
+#ifdef _WIN32
+    u_long nNonBlocking = 1;
+    ioctlsocket(Socket, FIONBIO, &nNonBlocking);
+#else
+    int nFlags = fcntl(Socket, F_GETFL, 0);
+    fcntl(Socket, F_SETFL, nFlags | O_NONBLOCK);
+#ifdef SO_NOSIGPIPE
+    int nNoSigPipe = 1;
+    setsockopt(Socket, SOL_SOCKET, SO_NOSIGPIPE, &nNoSigPipe, sizeof(nNoSigPipe));
+#endif
+#endif //_WIN32
+
+    if (bNoDelay) {
+        // Writes are already gathered, so Nagle's algorithm would only add latency.
+        int nNoDelay = 1;
+        setsockopt(Socket, IPPROTO_TCP, TCP_NODELAY, (const char*)&nNoDelay, sizeof(nNoDelay));
+    }
+}
+
+// Interface exceptions append their error code to the message. The close callback reports both separately.
+static std::string getExceptionMessage(ELibMCDriver_TCPIPInterfaceException& E)
+{
+    std::string sMessage = E.what();
+    std::string sCodeSuffix = " (" + std::to_string(E.getErrorCode()) + ")";
+    if ((sMessage.size() >= sCodeSuffix.size()) && (sMessage.compare(sMessage.size() - sCodeSuffix.size(), sCodeSuffix.size(), sCodeSuffix) == 0))
+        sMessage.resize(sMessage.size() - sCodeSuffix.size());
+    return sMessage;
+}
+
+static PDriver_TCPIPFramer createFramer(const TCPIPFramerFactory& FramerFactory)
+{
+    PDriver_TCPIPFramer pFramer;
+    if (FramerFactory)
+        pFramer = FramerFactory();
+    if (pFramer.get() == nullptr)
+        pFramer = std::make_shared<CDriver_TCPIPRawFramer>();
+    return pFramer;
+}
+
+#ifndef TCPIPENGINE_USEEPOLL
+// WSAPoll only waits for sockets, so the wake up event is a loopback UDP socket that is connected to itself.
+static TCPIPEngineSocket createWakeupSocket()
+{
+    TCPIPEngineSocket Socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (Socket == TCPIPENGINE_INVALIDSOCKET)
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_COULDNOTCREATEIOENGINE, "could not create wake up socket: " + std::to_string(getLastSocketError()));
+
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+
+    socklen_t nAddressLength = sizeof(address);
+    if ((bind(Socket, (struct sockaddr*)&address, sizeof(address)) != 0) ||
+        (getsockname(Socket, (struct sockaddr*)&address, &nAddressLength) != 0) ||
+        (connect(Socket, (struct sockaddr*)&address, sizeof(address)) != 0)) {
+        int nError = getLastSocketError();
+        TCPIPENGINE_CLOSESOCKET(Socket);
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_COULDNOTCREATEIOENGINE, "could not bind wake up socket: " + std::to_string(nError));
+    }
+
+    prepareSocket(Socket, false);
+
+    return Socket;
+}
+#endif //TCPIPENGINE_USEEPOLL
+
+
+CDriver_TCPIPIOEngine::CDriver_TCPIPIOEngine(size_t nReceiveBlockSize, size_t nMaxPooledBlocks)
+    : m_nNextID(TCPIPENGINE_WAKEUPID + 1), m_bStopThread(false), m_PollHandle(-1), m_WakeupHandle(-1), m_bPollSetChanged(true)
+{
+    CDriver_TCPIPSocketConnection::initializeNetworking();
+
+    m_pBufferPool = std::make_shared<CDriver_TCPIPBufferPool>(nReceiveBlockSize, nMaxPooledBlocks);
+
+#ifdef TCPIPENGINE_USEEPOLL
+    int nPollHandle = epoll_create1(EPOLL_CLOEXEC);
+    if (nPollHandle < 0)
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_COULDNOTCREATEIOENGINE, "could not create epoll instance: " + std::to_string(errno));
+
+    int nWakeupHandle = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (nWakeupHandle < 0) {
+        close(nPollHandle);
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_COULDNOTCREATEIOENGINE, "could not create wake up event: " + std::to_string(errno));
+    }
+
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.u64 = TCPIPENGINE_WAKEUPID;
+    if (epoll_ctl(nPollHandle, EPOLL_CTL_ADD, nWakeupHandle, &event) < 0) {
+        close(nWakeupHandle);
+        close(nPollHandle);
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_COULDNOTCREATEIOENGINE, "could not register wake up event: " + std::to_string(errno));
+    }
+
+    m_PollHandle = nPollHandle;
+    m_WakeupHandle = nWakeupHandle;
+#else
+    m_WakeupHandle = (int64_t)createWakeupSocket();
+#endif //TCPIPENGINE_USEEPOLL
+
+    m_Thread = std::thread(&CDriver_TCPIPIOEngine::runThread, this);
+    m_ThreadID = m_Thread.get_id();
+}
+
+CDriver_TCPIPIOEngine::~CDriver_TCPIPIOEngine()
+{
+    m_bStopThread = true;
+    wakeUp();
+    if (m_Thread.joinable())
+        m_Thread.join();
+
+    for (auto iIter : m_Connections) {
+        std::lock_guard<std::mutex> sendLock(iIter.second->m_SendMutex);
+        iIter.second->m_bIsOpen = false;
+        TCPIPENGINE_CLOSESOCKET((TCPIPEngineSocket)iIter.second->m_Socket);
+        iIter.second->m_SendQueue.clear();
+        iIter.second->m_SendSignal.notify_all();
+    }
+    m_Connections.clear();
+
+    for (auto iIter : m_Listeners)
+        TCPIPENGINE_CLOSESOCKET((TCPIPEngineSocket)iIter.second->m_Socket);
+    m_Listeners.clear();
+
+#ifdef TCPIPENGINE_USEEPOLL
+    close((int)m_WakeupHandle);
+    close((int)m_PollHandle);
+#else
+    TCPIPENGINE_CLOSESOCKET((TCPIPEngineSocket)m_WakeupHandle);
+#endif
+}
+
+void CDriver_TCPIPIOEngine::wakeUp()
+{
+#ifdef TCPIPENGINE_USEEPOLL
+    uint64_t nValue = 1;
+    if (write((int)m_WakeupHandle, &nValue, sizeof(nValue)) < 0) {
+        // The counter can only overflow if the engine thread is not running anymore.
+    }
+#else
+    char nValue = 1;
+    if (::send((TCPIPEngineSocket)m_WakeupHandle, &nValue, 1, 0) < 0) {
+        // A full socket buffer means that a wake up is already pending.
+    }
+#endif
+}
+
+void CDriver_TCPIPIOEngine::registerSocket(uint64_t nID, uint64_t Socket, bool bWantsWrite, bool bIsNew)
+{
+#ifdef TCPIPENGINE_USEEPOLL
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN | EPOLLRDHUP | (bWantsWrite ? EPOLLOUT : 0);
+    event.data.u64 = nID;
+    if (epoll_ctl((int)m_PollHandle, bIsNew ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, (int)Socket, &event) < 0)
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_COULDNOTCREATEIOENGINE, "could not register socket: " + std::to_string(errno));
+#else
+    m_bPollSetChanged = true;
+    wakeUp();
+#endif
+}
+
+void CDriver_TCPIPIOEngine::unregisterSocket(uint64_t Socket)
+{
+#ifdef TCPIPENGINE_USEEPOLL
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    epoll_ctl((int)m_PollHandle, EPOLL_CTL_DEL, (int)Socket, &event);
+#else
+    m_bPollSetChanged = true;
+#endif
+}
+
+void CDriver_TCPIPIOEngine::runThread()
+{
+#ifdef TCPIPENGINE_USEEPOLL
+    std::vector<struct epoll_event> events(TCPIPENGINE_MAXEVENTS);
+#else
+    std::vector<TCPIPEnginePollFD> pollEntries;
+    std::vector<uint64_t> pollIDs;
+#endif
+
+    while (!m_bStopThread) {
+
+#ifdef TCPIPENGINE_USEEPOLL
+        int nEventCount = epoll_wait((int)m_PollHandle, events.data(), (int)events.size(), TCPIPENGINE_TICKINMS);
+        for (int nIndex = 0; nIndex < nEventCount; nIndex++) {
+            uint64_t nID = events[nIndex].data.u64;
+            uint32_t nEvents = events[nIndex].events;
+
+            if (nID == TCPIPENGINE_WAKEUPID) {
+                uint64_t nValue = 0;
+                while (read((int)m_WakeupHandle, &nValue, sizeof(nValue)) > 0) {
+                }
+            }
+            else {
+                handleSocketEvent(nID, (nEvents & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) != 0, (nEvents & EPOLLOUT) != 0);
+            }
+        }
+#else
+        // The poll set is only rebuilt after sockets were added, removed or changed their write interest.
+        if (m_bPollSetChanged.exchange(false)) {
+            pollEntries.clear();
+            pollIDs.clear();
+
+            TCPIPEnginePollFD wakeupEntry;
+            memset(&wakeupEntry, 0, sizeof(wakeupEntry));
+            wakeupEntry.fd = (TCPIPEngineSocket)m_WakeupHandle;
+            wakeupEntry.events = POLLIN;
+            pollEntries.push_back(wakeupEntry);
+            pollIDs.push_back(TCPIPENGINE_WAKEUPID);
+
+            std::lock_guard<std::mutex> lockGuard(m_Mutex);
+            for (auto iIter : m_Listeners) {
+                TCPIPEnginePollFD entry;
+                memset(&entry, 0, sizeof(entry));
+                entry.fd = (TCPIPEngineSocket)iIter.second->m_Socket;
+                entry.events = POLLIN;
+                pollEntries.push_back(entry);
+                pollIDs.push_back(iIter.first);
+            }
+            for (auto iIter : m_Connections) {
+                TCPIPEnginePollFD entry;
+                memset(&entry, 0, sizeof(entry));
+                entry.fd = (TCPIPEngineSocket)iIter.second->m_Socket;
+                entry.events = POLLIN | (iIter.second->m_bWantsWrite ? POLLOUT : 0);
+                pollEntries.push_back(entry);
+                pollIDs.push_back(iIter.first);
+            }
+        }
+
+        int nEventCount = TCPIPENGINE_POLL(pollEntries.data(), (unsigned long)pollEntries.size(), TCPIPENGINE_TICKINMS);
+        if (nEventCount > 0) {
+            for (size_t nIndex = 0; nIndex < pollEntries.size(); nIndex++) {
+                auto nEvents = pollEntries[nIndex].revents;
+                if (nEvents == 0)
+                    continue;
+
+                if (pollIDs[nIndex] == TCPIPENGINE_WAKEUPID) {
+                    char wakeupBuffer[64];
+                    while (recv((TCPIPEngineSocket)m_WakeupHandle, wakeupBuffer, sizeof(wakeupBuffer), 0) > 0) {
+                    }
+                }
+                else {
+                    handleSocketEvent(pollIDs[nIndex], (nEvents & (POLLIN | POLLHUP | POLLERR)) != 0, (nEvents & POLLOUT) != 0);
+                }
+            }
+        }
+#endif //TCPIPENGINE_USEEPOLL
+
+        processPendingCloses();
+    }
+}
+
+void CDriver_TCPIPIOEngine::handleSocketEvent(uint64_t nID, bool bReadable, bool bWritable)
+{
+    PDriver_TCPIPEngineConnection pConnection;
+    PDriver_TCPIPEngineListener pListener;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        auto iConnectionIter = m_Connections.find(nID);
+        if (iConnectionIter != m_Connections.end()) {
+            pConnection = iConnectionIter->second;
+        }
+        else {
+            auto iListenerIter = m_Listeners.find(nID);
+            if (iListenerIter != m_Listeners.end())
+                pListener = iListenerIter->second;
+        }
+    }
+
+    try {
+        if (pListener.get() != nullptr) {
+            if (bReadable)
+                acceptConnections(pListener);
+        }
+
+        if (pConnection.get() != nullptr) {
+            if (bWritable)
+                writeConnection(pConnection);
+            if (bReadable)
+                readConnection(pConnection);
+        }
+    }
+    catch (std::exception& E) {
+        if (pConnection.get() != nullptr)
+            closeConnectionInternal(pConnection, LIBMCDRIVER_TCPIP_ERROR_GENERICEXCEPTION, E.what());
+    }
+    catch (...) {
+        if (pConnection.get() != nullptr)
+            closeConnectionInternal(pConnection, LIBMCDRIVER_TCPIP_ERROR_GENERICEXCEPTION, "unhandled exception");
+    }
+}
+
+PDriver_TCPIPEngineConnection CDriver_TCPIPIOEngine::addConnection(uint64_t Socket, TCPIPFramerFactory FramerFactory, TCPIPPacketCallback PacketCallback, TCPIPCloseCallback CloseCallback)
+{
+    auto pConnection = std::make_shared<sDriver_TCPIPEngineConnection>();
+    pConnection->m_Socket = Socket;
+    pConnection->m_PacketCallback = PacketCallback;
+    pConnection->m_CloseCallback = CloseCallback;
+    pConnection->m_nSendOffset = 0;
+    pConnection->m_nQueuedBytes = 0;
+    pConnection->m_bIsOpen = true;
+    pConnection->m_nCloseErrorCode = 0;
+    pConnection->m_bWantsWrite = false;
+
+    try {
+        pConnection->m_pFrameReader.reset(new CDriver_TCPIPFrameReader(m_pBufferPool, createFramer(FramerFactory)));
+
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        pConnection->m_nConnectionID = m_nNextID;
+        m_nNextID++;
+
+        registerSocket(pConnection->m_nConnectionID, Socket, false, true);
+        m_Connections.insert(std::make_pair(pConnection->m_nConnectionID, pConnection));
+    }
+    catch (...) {
+        TCPIPENGINE_CLOSESOCKET((TCPIPEngineSocket)Socket);
+        throw;
+    }
+
+    return pConnection;
+}
+
+PDriver_TCPIPEngineConnection CDriver_TCPIPIOEngine::findConnection(uint64_t nConnectionID)
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    auto iIter = m_Connections.find(nConnectionID);
+    if (iIter != m_Connections.end())
+        return iIter->second;
+
+    return nullptr;
+}
+
+uint64_t CDriver_TCPIPIOEngine::connect(const std::string& sIPAddress, uint32_t nPort, uint32_t nTimeOutInMS, TCPIPFramerFactory FramerFactory, TCPIPPacketCallback PacketCallback, TCPIPCloseCallback CloseCallback)
+{
+    struct addrinfo hints;
+    struct addrinfo* pAddressInfo = nullptr;
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_protocol = IPPROTO_TCP;
+
+    std::string sPort = std::to_string(nPort);
+    int nResult = getaddrinfo(sIPAddress.c_str(), sPort.c_str(), &hints, &pAddressInfo);
+    if ((nResult != 0) || (pAddressInfo == nullptr))
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_COULDNOTGETADDRESSINFO, "could not get address info of " + sIPAddress + ":" + sPort + " (#" + std::to_string(nResult) + ")");
+
+    TCPIPEngineSocket ConnectSocket = TCPIPENGINE_INVALIDSOCKET;
+
+    for (struct addrinfo* pAddress = pAddressInfo; pAddress != nullptr; pAddress = pAddress->ai_next) {
+        ConnectSocket = socket(pAddress->ai_family, pAddress->ai_socktype, pAddress->ai_protocol);
+        if (ConnectSocket == TCPIPENGINE_INVALIDSOCKET)
+            continue;
+
+        prepareSocket(ConnectSocket, true);
+
+        bool bConnected = (::connect(ConnectSocket, pAddress->ai_addr, (int)pAddress->ai_addrlen) == 0);
+        if (!bConnected) {
+            int nError = getLastSocketError();
+#ifdef _WIN32
+            bool bInProgress = (nError == WSAEWOULDBLOCK);
+#else
+            bool bInProgress = (nError == EINPROGRESS);
+#endif
+            if (bInProgress) {
+                TCPIPEnginePollFD entry;
+                memset(&entry, 0, sizeof(entry));
+                entry.fd = ConnectSocket;
+                entry.events = POLLOUT;
+
+                if (TCPIPENGINE_POLL(&entry, 1, (nTimeOutInMS > 0) ? (int)nTimeOutInMS : -1) > 0) {
+                    int nSocketError = 0;
+                    socklen_t nSocketErrorLength = sizeof(nSocketError);
+                    if (getsockopt(ConnectSocket, SOL_SOCKET, SO_ERROR, (char*)&nSocketError, &nSocketErrorLength) == 0)
+                        bConnected = (nSocketError == 0);
+                }
+            }
+        }
+
+        if (bConnected)
+            break;
+
+        TCPIPENGINE_CLOSESOCKET(ConnectSocket);
+        ConnectSocket = TCPIPENGINE_INVALIDSOCKET;
+    }
+
+    freeaddrinfo(pAddressInfo);
+
+    if (ConnectSocket == TCPIPENGINE_INVALIDSOCKET)
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_COULDNOTCONNECT, "could not connect to " + sIPAddress + ":" + sPort);
+
+    auto pConnection = addConnection((uint64_t)ConnectSocket, FramerFactory, PacketCallback, CloseCallback);
+    return pConnection->m_nConnectionID;
+}
+
+uint64_t CDriver_TCPIPIOEngine::listen(const std::string& sIPAddress, uint32_t nPort, uint32_t& nBoundPort, TCPIPFramerFactory FramerFactory, TCPIPPacketCallback PacketCallback, TCPIPCloseCallback CloseCallback, TCPIPAcceptCallback AcceptCallback)
+{
+    struct addrinfo hints;
+    struct addrinfo* pAddressInfo = nullptr;
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_protocol = IPPROTO_TCP;
+    hints.ai_flags = AI_PASSIVE;
+
+    std::string sPort = std::to_string(nPort);
+    int nResult = getaddrinfo(sIPAddress.empty() ? nullptr : sIPAddress.c_str(), sPort.c_str(), &hints, &pAddressInfo);
+    if ((nResult != 0) || (pAddressInfo == nullptr))
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_COULDNOTGETADDRESSINFO, "could not get address info of " + sIPAddress + ":" + sPort + " (#" + std::to_string(nResult) + ")");
+
+    TCPIPEngineSocket ListenSocket = socket(pAddressInfo->ai_family, pAddressInfo->ai_socktype, pAddressInfo->ai_protocol);
+    if (ListenSocket == TCPIPENGINE_INVALIDSOCKET) {
+        freeaddrinfo(pAddressInfo);
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_COULDNOTCREATESOCKET, "could not create socket: " + std::to_string(getLastSocketError()));
+    }
+
+    int nReuseAddress = 1;
+    setsockopt(ListenSocket, SOL_SOCKET, SO_REUSEADDR, (const char*)&nReuseAddress, sizeof(nReuseAddress));
+
+    bool bSuccess = (bind(ListenSocket, pAddressInfo->ai_addr, (int)pAddressInfo->ai_addrlen) == 0) && (::listen(ListenSocket, SOMAXCONN) == 0);
+    freeaddrinfo(pAddressInfo);
+
+    struct sockaddr_storage boundAddress;
+    socklen_t nBoundAddressLength = sizeof(boundAddress);
+    memset(&boundAddress, 0, sizeof(boundAddress));
+    if (bSuccess)
+        bSuccess = (getsockname(ListenSocket, (struct sockaddr*)&boundAddress, &nBoundAddressLength) == 0);
+
+    if (!bSuccess) {
+        int nError = getLastSocketError();
+        TCPIPENGINE_CLOSESOCKET(ListenSocket);
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_COULDNOTCREATESOCKET, "could not listen on " + sIPAddress + ":" + sPort + " (#" + std::to_string(nError) + ")");
+    }
+
+    if (boundAddress.ss_family == AF_INET6)
+        nBoundPort = ntohs(((struct sockaddr_in6*)&boundAddress)->sin6_port);
+    else
+        nBoundPort = ntohs(((struct sockaddr_in*)&boundAddress)->sin_port);
+
+    prepareSocket(ListenSocket, false);
+
+    auto pListener = std::make_shared<sDriver_TCPIPEngineListener>();
+    pListener->m_Socket = (uint64_t)ListenSocket;
+    pListener->m_FramerFactory = FramerFactory;
+    pListener->m_PacketCallback = PacketCallback;
+    pListener->m_CloseCallback = CloseCallback;
+    pListener->m_AcceptCallback = AcceptCallback;
+
+    try {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        pListener->m_nListenerID = m_nNextID;
+        m_nNextID++;
+
+        registerSocket(pListener->m_nListenerID, pListener->m_Socket, false, true);
+        m_Listeners.insert(std::make_pair(pListener->m_nListenerID, pListener));
+    }
+    catch (...) {
+        TCPIPENGINE_CLOSESOCKET(ListenSocket);
+        throw;
+    }
+
+    return pListener->m_nListenerID;
+}
+
+void CDriver_TCPIPIOEngine::stopListening(uint64_t nListenerID)
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        m_PendingCloses.push_back(nListenerID);
+    }
+    wakeUp();
+}
+
+void CDriver_TCPIPIOEngine::acceptConnections(PDriver_TCPIPEngineListener pListener)
+{
+    while (!m_bStopThread) {
+        TCPIPEngineSocket AcceptedSocket = accept((TCPIPEngineSocket)pListener->m_Socket, nullptr, nullptr);
+        if (AcceptedSocket == TCPIPENGINE_INVALIDSOCKET) {
+            if (socketErrorIsInterrupt(getLastSocketError()))
+                continue;
+            return;
+        }
+
+        prepareSocket(AcceptedSocket, true);
+
+        auto pConnection = addConnection((uint64_t)AcceptedSocket, pListener->m_FramerFactory, pListener->m_PacketCallback, pListener->m_CloseCallback);
+        if (pListener->m_AcceptCallback)
+            pListener->m_AcceptCallback(pConnection->m_nConnectionID);
+    }
+}
+
+void CDriver_TCPIPIOEngine::readConnection(PDriver_TCPIPEngineConnection pConnection)
+{
+    std::vector<CDriver_TCPIPPacketView> Packets;
+    bool bClose = false;
+    uint32_t nErrorCode = 0;
+    std::string sErrorMessage;
+
+    // Only the engine thread closes sockets, so the handle stays valid during the whole read.
+    TCPIPEngineSocket Socket = (TCPIPEngineSocket)pConnection->m_Socket;
+
+    try {
+        for (uint32_t nRound = 0; nRound < TCPIPENGINE_MAXREADSPERWAKEUP; nRound++) {
+            size_t nFreeSize = 0;
+            uint8_t* pReceiveBuffer = pConnection->m_pFrameReader->prepareReceive(nFreeSize);
+            int nChunkSize = (int)std::min(nFreeSize, (size_t)TCPIPENGINE_MAXRECEIVECHUNK);
+
+            int nBytesReceived = (int)recv(Socket, (char*)pReceiveBuffer, nChunkSize, 0);
+            if (nBytesReceived > 0) {
+                pConnection->m_pFrameReader->commitReceive(nBytesReceived);
+                pConnection->m_pFrameReader->extractFrames(Packets);
+
+                if (nBytesReceived < nChunkSize)
+                    break;
+            }
+            else if (nBytesReceived == 0) {
+                bClose = true;
+                break;
+            }
+            else {
+                int nError = getLastSocketError();
+                if (socketErrorIsInterrupt(nError))
+                    continue;
+
+                if (!socketErrorIsWouldBlock(nError)) {
+                    bClose = true;
+                    nErrorCode = LIBMCDRIVER_TCPIP_ERROR_RECEIVEERROR;
+                    sErrorMessage = "socket receive error: " + std::to_string(nError);
+                }
+                break;
+            }
+        }
+    }
+    catch (ELibMCDriver_TCPIPInterfaceException& E) {
+        bClose = true;
+        nErrorCode = E.getErrorCode();
+        sErrorMessage = getExceptionMessage(E);
+    }
+
+    // Frames that were complete before an error are still delivered.
+    if ((!Packets.empty()) && pConnection->m_PacketCallback)
+        pConnection->m_PacketCallback(pConnection->m_nConnectionID, Packets);
+
+    if (bClose)
+        closeConnectionInternal(pConnection, nErrorCode, sErrorMessage);
+}
+
+void CDriver_TCPIPIOEngine::writeConnection(PDriver_TCPIPEngineConnection pConnection)
+{
+    bool bSuccess = true;
+    {
+        std::lock_guard<std::mutex> sendLock(pConnection->m_SendMutex);
+        bSuccess = flushSendQueue(pConnection.get());
+
+        if (bSuccess && pConnection->m_SendQueue.empty() && pConnection->m_bWantsWrite) {
+            pConnection->m_bWantsWrite = false;
+            registerSocket(pConnection->m_nConnectionID, pConnection->m_Socket, false, false);
+        }
+
+        pConnection->m_SendSignal.notify_all();
+    }
+
+    if (!bSuccess)
+        closeConnectionInternal(pConnection, LIBMCDRIVER_TCPIP_ERROR_SENDERROR, "socket send error: " + std::to_string(getLastSocketError()));
+}
+
+bool CDriver_TCPIPIOEngine::flushSendQueue(sDriver_TCPIPEngineConnection* pConnection)
+{
+    if (!pConnection->m_bIsOpen) {
+        pConnection->m_SendQueue.clear();
+        pConnection->m_nQueuedBytes = 0;
+        return true;
+    }
+
+    TCPIPEngineSocket Socket = (TCPIPEngineSocket)pConnection->m_Socket;
+
+    while (!pConnection->m_SendQueue.empty()) {
+
+        size_t nBufferCount = std::min(pConnection->m_SendQueue.size(), (size_t)TCPIPENGINE_MAXGATHERBUFFERS);
+        size_t nBatchSize = 0;
+
+#ifdef _WIN32
+        WSABUF gatherBuffers[TCPIPENGINE_MAXGATHERBUFFERS];
+        for (size_t nIndex = 0; nIndex < nBufferCount; nIndex++) {
+            auto& pBuffer = pConnection->m_SendQueue[nIndex];
+            size_t nOffset = (nIndex == 0) ? pConnection->m_nSendOffset : 0;
+            gatherBuffers[nIndex].buf = (CHAR*)(pBuffer->data() + nOffset);
+            gatherBuffers[nIndex].len = (ULONG)(pBuffer->size() - nOffset);
+            nBatchSize += gatherBuffers[nIndex].len;
+        }
+
+        DWORD nBytesSent = 0;
+        if (WSASend(Socket, gatherBuffers, (DWORD)nBufferCount, &nBytesSent, 0, nullptr, nullptr) == SOCKET_ERROR) {
+            int nError = getLastSocketError();
+            if (socketErrorIsWouldBlock(nError))
+                return true;
+            return false;
+        }
+        size_t nBytesWritten = nBytesSent;
+#else
+        struct iovec gatherBuffers[TCPIPENGINE_MAXGATHERBUFFERS];
+        for (size_t nIndex = 0; nIndex < nBufferCount; nIndex++) {
+            auto& pBuffer = pConnection->m_SendQueue[nIndex];
+            size_t nOffset = (nIndex == 0) ? pConnection->m_nSendOffset : 0;
+            gatherBuffers[nIndex].iov_base = (void*)(pBuffer->data() + nOffset);
+            gatherBuffers[nIndex].iov_len = pBuffer->size() - nOffset;
+            nBatchSize += gatherBuffers[nIndex].iov_len;
+        }
+
+        struct msghdr message;
+        memset(&message, 0, sizeof(message));
+        message.msg_iov = gatherBuffers;
+        message.msg_iovlen = nBufferCount;
+
+        ssize_t nBytesSent = sendmsg(Socket, &message, TCPIPENGINE_SENDFLAGS);
+        if (nBytesSent < 0) {
+            int nError = getLastSocketError();
+            if (socketErrorIsInterrupt(nError))
+                continue;
+            if (socketErrorIsWouldBlock(nError))
+                return true;
+            return false;
+        }
+        size_t nBytesWritten = (size_t)nBytesSent;
+#endif //_WIN32
+
+        pConnection->m_nQueuedBytes -= nBytesWritten;
+
+        size_t nRemaining = nBytesWritten;
+        while (nRemaining > 0) {
+            size_t nFrontSize = pConnection->m_SendQueue.front()->size() - pConnection->m_nSendOffset;
+            if (nRemaining >= nFrontSize) {
+                nRemaining -= nFrontSize;
+                pConnection->m_SendQueue.pop_front();
+                pConnection->m_nSendOffset = 0;
+            }
+            else {
+                pConnection->m_nSendOffset += nRemaining;
+                nRemaining = 0;
+            }
+        }
+
+        // A short write means that the socket buffer is full.
+        if (nBytesWritten < nBatchSize)
+            return true;
+    }
+
+    return true;
+}
+
+void CDriver_TCPIPIOEngine::send(uint64_t nConnectionID, const std::vector<PDriver_TCPIPSendBuffer>& Buffers)
+{
+    auto pConnection = findConnection(nConnectionID);
+    if (pConnection.get() == nullptr)
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_DRIVERNOTCONNECTED);
+
+    bool bIsEngineThread = (std::this_thread::get_id() == m_ThreadID);
+    bool bSuccess = true;
+    {
+        std::unique_lock<std::mutex> sendLock(pConnection->m_SendMutex);
+
+        // The engine thread drains the queue itself, so it must never wait for it.
+        if (!bIsEngineThread) {
+            pConnection->m_SendSignal.wait(sendLock, [&pConnection] {
+                return (!pConnection->m_bIsOpen) || (pConnection->m_nQueuedBytes < TCPIPENGINE_MAXQUEUEDSENDBYTES);
+            });
+        }
+
+        if (!pConnection->m_bIsOpen)
+            throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_CONNECTIONCLOSED);
+
+        bool bQueueWasEmpty = pConnection->m_SendQueue.empty();
+        for (auto& pBuffer : Buffers) {
+            if ((pBuffer.get() != nullptr) && (!pBuffer->empty())) {
+                pConnection->m_SendQueue.push_back(pBuffer);
+                pConnection->m_nQueuedBytes += pBuffer->size();
+            }
+        }
+
+        // Otherwise the engine thread is already waiting for the socket to become writable.
+        if (bQueueWasEmpty)
+            bSuccess = flushSendQueue(pConnection.get());
+
+        if (bSuccess) {
+            if ((!pConnection->m_SendQueue.empty()) && (!pConnection->m_bWantsWrite)) {
+                pConnection->m_bWantsWrite = true;
+                registerSocket(pConnection->m_nConnectionID, pConnection->m_Socket, true, false);
+            }
+        }
+        else {
+            pConnection->m_bIsOpen = false;
+            pConnection->m_nCloseErrorCode = LIBMCDRIVER_TCPIP_ERROR_SENDERROR;
+            pConnection->m_sCloseErrorMessage = "socket send error: " + std::to_string(getLastSocketError());
+            pConnection->m_SendQueue.clear();
+            pConnection->m_nQueuedBytes = 0;
+            pConnection->m_SendSignal.notify_all();
+        }
+    }
+
+    if (!bSuccess) {
+        {
+            std::lock_guard<std::mutex> lockGuard(m_Mutex);
+            m_PendingCloses.push_back(nConnectionID);
+        }
+        wakeUp();
+
+        throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_SENDERROR);
+    }
+}
+
+void CDriver_TCPIPIOEngine::closeConnection(uint64_t nConnectionID)
+{
+    auto pConnection = findConnection(nConnectionID);
+    if (pConnection.get() == nullptr)
+        return;
+
+    {
+        std::lock_guard<std::mutex> sendLock(pConnection->m_SendMutex);
+        if (pConnection->m_bIsOpen) {
+            pConnection->m_bIsOpen = false;
+            // Unblocks the engine thread, which closes the handle.
+            shutdown((TCPIPEngineSocket)pConnection->m_Socket, TCPIPENGINE_SHUTDOWNBOTH);
+        }
+        pConnection->m_SendQueue.clear();
+        pConnection->m_nQueuedBytes = 0;
+        pConnection->m_SendSignal.notify_all();
+    }
+
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        m_PendingCloses.push_back(nConnectionID);
+    }
+    wakeUp();
+}
+
+bool CDriver_TCPIPIOEngine::isConnected(uint64_t nConnectionID)
+{
+    auto pConnection = findConnection(nConnectionID);
+    if (pConnection.get() == nullptr)
+        return false;
+
+    std::lock_guard<std::mutex> sendLock(pConnection->m_SendMutex);
+    return pConnection->m_bIsOpen;
+}
+
+void CDriver_TCPIPIOEngine::processPendingCloses()
+{
+    std::vector<uint64_t> pendingCloses;
+    std::vector<PDriver_TCPIPEngineListener> closedListeners;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        if (m_PendingCloses.empty())
+            return;
+
+        pendingCloses.swap(m_PendingCloses);
+
+        for (auto nID : pendingCloses) {
+            auto iListenerIter = m_Listeners.find(nID);
+            if (iListenerIter != m_Listeners.end()) {
+                closedListeners.push_back(iListenerIter->second);
+                m_Listeners.erase(iListenerIter);
+            }
+        }
+    }
+
+    for (auto pListener : closedListeners) {
+        unregisterSocket(pListener->m_Socket);
+        TCPIPENGINE_CLOSESOCKET((TCPIPEngineSocket)pListener->m_Socket);
+    }
+
+    for (auto nID : pendingCloses) {
+        auto pConnection = findConnection(nID);
+        if (pConnection.get() != nullptr) {
+            uint32_t nErrorCode = 0;
+            std::string sErrorMessage;
+            {
+                std::lock_guard<std::mutex> sendLock(pConnection->m_SendMutex);
+                nErrorCode = pConnection->m_nCloseErrorCode;
+                sErrorMessage = pConnection->m_sCloseErrorMessage;
+            }
+            closeConnectionInternal(pConnection, nErrorCode, sErrorMessage);
+        }
+    }
+}
+
+void CDriver_TCPIPIOEngine::closeConnectionInternal(PDriver_TCPIPEngineConnection pConnection, uint32_t nErrorCode, const std::string& sErrorMessage)
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        if (m_Connections.erase(pConnection->m_nConnectionID) == 0)
+            return;
+    }
+
+    {
+        std::lock_guard<std::mutex> sendLock(pConnection->m_SendMutex);
+        pConnection->m_bIsOpen = false;
+        unregisterSocket(pConnection->m_Socket);
+        TCPIPENGINE_CLOSESOCKET((TCPIPEngineSocket)pConnection->m_Socket);
+        pConnection->m_SendQueue.clear();
+        pConnection->m_nQueuedBytes = 0;
+        pConnection->m_SendSignal.notify_all();
+    }
+
+    pConnection->m_pFrameReader.reset();
+
+    if (pConnection->m_CloseCallback) {
+        try {
+            pConnection->m_CloseCallback(pConnection->m_nConnectionID, nErrorCode, sErrorMessage);
+        }
+        catch (...) {
+        }
+    }
+}
+
+std::shared_ptr<CDriver_TCPIPIOEngine> CDriver_TCPIPIOEngine::getSharedEngine()
+{
+    static std::mutex s_SharedEngineMutex;
+    static std::weak_ptr<CDriver_TCPIPIOEngine> s_pSharedEngine;
+
+    std::lock_guard<std::mutex> lockGuard(s_SharedEngineMutex);
+    auto pEngine = s_pSharedEngine.lock();
+    if (pEngine.get() == nullptr) {
+        pEngine = std::make_shared<CDriver_TCPIPIOEngine>(TCPIPENGINE_RECEIVEBLOCKSIZE, TCPIPENGINE_MAXPOOLEDBLOCKS);
+        s_pSharedEngine = pEngine;
+    }
+
+    return pEngine;
+}
@@ -0,0 +1,146 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: Event driven socket I/O engine of the TCP/IP driver
+
+*/
+
+
+#ifndef __LIBMCDRIVER_TCPIP_IOENGINE
+#define __LIBMCDRIVER_TCPIP_IOENGINE
+
+#include "libmcdriver_tcpip_framing.hpp"
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <functional>
+
+
+namespace LibMCDriver_TCPIP {
+namespace Impl {
+
+
+typedef std::shared_ptr<const std::vector<uint8_t>> PDriver_TCPIPSendBuffer;
+
+// Called on the engine thread with all frames that one read has completed.
+typedef std::function<void(uint64_t nConnectionID, std::vector<CDriver_TCPIPPacketView>& Packets)> TCPIPPacketCallback;
+
+// Called on the engine thread once a connection is gone. nErrorCode is 0 if the peer or the owner closed it.
+typedef std::function<void(uint64_t nConnectionID, uint32_t nErrorCode, const std::string& sErrorMessage)> TCPIPCloseCallback;
+
+typedef std::function<void(uint64_t nConnectionID)> TCPIPAcceptCallback;
+
+struct sDriver_TCPIPEngineConnection;
+struct sDriver_TCPIPEngineListener;
+
+typedef std::shared_ptr<sDriver_TCPIPEngineConnection> PDriver_TCPIPEngineConnection;
+typedef std::shared_ptr<sDriver_TCPIPEngineListener> PDriver_TCPIPEngineListener;
+
+
+// Multiplexes any number of non-blocking connections on a single thread. Linux uses epoll,
+// other platforms fall back to poll (WSAPoll on Windows) with a loopback socket as wake up event.
+// Receiving is done by the engine thread only. Sends are written directly from the calling thread
+// as long as the socket accepts them, and are queued for the engine thread otherwise.
+class CDriver_TCPIPIOEngine {
+private:
+
+    std::mutex m_Mutex;
+    std::map<uint64_t, PDriver_TCPIPEngineConnection> m_Connections;
+    std::map<uint64_t, PDriver_TCPIPEngineListener> m_Listeners;
+    std::vector<uint64_t> m_PendingCloses;
+    uint64_t m_nNextID;
+
+    PDriver_TCPIPBufferPool m_pBufferPool;
+
+    std::thread m_Thread;
+    std::thread::id m_ThreadID;
+    std::atomic<bool> m_bStopThread;
+
+    int64_t m_PollHandle;
+    int64_t m_WakeupHandle;
+
+    // Only used by the poll fallback, which keeps its poll set until the registered sockets change.
+    std::atomic<bool> m_bPollSetChanged;
+
+    void runThread();
+    void wakeUp();
+
+    void registerSocket(uint64_t nID, uint64_t Socket, bool bWantsWrite, bool bIsNew);
+    void unregisterSocket(uint64_t Socket);
+
+    PDriver_TCPIPEngineConnection addConnection(uint64_t Socket, TCPIPFramerFactory FramerFactory, TCPIPPacketCallback PacketCallback, TCPIPCloseCallback CloseCallback);
+    PDriver_TCPIPEngineConnection findConnection(uint64_t nConnectionID);
+
+    void handleSocketEvent(uint64_t nID, bool bReadable, bool bWritable);
+    void acceptConnections(PDriver_TCPIPEngineListener pListener);
+    void readConnection(PDriver_TCPIPEngineConnection pConnection);
+    void writeConnection(PDriver_TCPIPEngineConnection pConnection);
+    void processPendingCloses();
+    void closeConnectionInternal(PDriver_TCPIPEngineConnection pConnection, uint32_t nErrorCode, const std::string& sErrorMessage);
+
+    // Must be called with the connection's send mutex locked. Returns false on a socket error.
+    bool flushSendQueue(sDriver_TCPIPEngineConnection* pConnection);
+
+public:
+
+    CDriver_TCPIPIOEngine(size_t nReceiveBlockSize, size_t nMaxPooledBlocks);
+    ~CDriver_TCPIPIOEngine();
+
+    // Connects synchronously and hands the socket to the engine. A timeout of 0 waits for the system connect timeout.
+    uint64_t connect(const std::string& sIPAddress, uint32_t nPort, uint32_t nTimeOutInMS, TCPIPFramerFactory FramerFactory, TCPIPPacketCallback PacketCallback, TCPIPCloseCallback CloseCallback);
+
+    // Listens on the given port. Port 0 binds an ephemeral port, which is returned in nBoundPort.
+    uint64_t listen(const std::string& sIPAddress, uint32_t nPort, uint32_t& nBoundPort, TCPIPFramerFactory FramerFactory, TCPIPPacketCallback PacketCallback, TCPIPCloseCallback CloseCallback, TCPIPAcceptCallback AcceptCallback);
+
+    void stopListening(uint64_t nListenerID);
+
+    // Sends the buffers in order as one gathered write. The buffers are referenced until they have been written.
+    // Blocks while the connection has too much unsent data queued, unless called from the engine thread.
+    void send(uint64_t nConnectionID, const std::vector<PDriver_TCPIPSendBuffer>& Buffers);
+
+    void closeConnection(uint64_t nConnectionID);
+
+    bool isConnected(uint64_t nConnectionID);
+
+    // Returns the engine that all driver instances of the process share.
+    static std::shared_ptr<CDriver_TCPIPIOEngine> getSharedEngine();
+
+};
+
+typedef std::shared_ptr<CDriver_TCPIPIOEngine> PDriver_TCPIPIOEngine;
+
+} // namespace Impl
+} // namespace LibMCDriver_TCPIP
+
+#endif // __LIBMCDRIVER_TCPIP_IOENGINE
@@ -392,6 +392,40 @@ public:
 	*/
 	virtual IDriver_TCPIPPacket * ReceivePacket(const LibMCDriver_TCPIP_uint32 nPacketSize, const LibMCDriver_TCPIP_uint32 nTimeOutInMS) = 0;
 
+	/**
+	* IDriver_TCPIP::SetUseIOEngine - Runs the following connections on the shared event driven I/O engine instead of a blocking socket. Only engine connections honour the receive timeout of ReceivePacket. Framed connections always use the engine. Takes effect with the next connect.
+	* @param[in] bUseIOEngine - If true, connections use the I/O engine. Default is false.
+	*/
+	virtual void SetUseIOEngine(const bool bUseIOEngine) = 0;
+
+	/**
+	* IDriver_TCPIP::SetLengthPrefixFraming - Splits the received byte stream into packets that start with a length header. Takes effect with the next connect.
+	* @param[in] nHeaderSize - Size of the length header in bytes. MUST be 1, 2 or 4.
+	* @param[in] bBigEndian - If true, the length header is big endian.
+	* @param[in] bLengthIncludesHeader - If true, the length value includes the header itself.
+	* @param[in] nMaxPacketSize - Maximum payload size in bytes. Larger frames close the connection.
+	*/
+	virtual void SetLengthPrefixFraming(const LibMCDriver_TCPIP_uint32 nHeaderSize, const bool bBigEndian, const bool bLengthIncludesHeader, const LibMCDriver_TCPIP_uint32 nMaxPacketSize) = 0;
+
+	/**
+	* IDriver_TCPIP::SetDelimiterFraming - Splits the received byte stream into packets that end with a delimiter. Takes effect with the next connect.
+	* @param[in] sDelimiter - Delimiter sequence, for example a line feed. MUST not be empty.
+	* @param[in] nMaxPacketSize - Maximum payload size in bytes. Larger frames close the connection.
+	*/
+	virtual void SetDelimiterFraming(const std::string & sDelimiter, const LibMCDriver_TCPIP_uint32 nMaxPacketSize) = 0;
+
+	/**
+	* IDriver_TCPIP::DisableFraming - Returns to unframed fixed size packet reception. Takes effect with the next connect.
+	*/
+	virtual void DisableFraming() = 0;
+
+	/**
+	* IDriver_TCPIP::ReceiveFramedPacket - Receives the next complete frame. The frame header or delimiter is not part of the packet data. Fails if there is a connection error.
+	* @param[in] nTimeOutInMS - timeout in Milliseconds.
+	* @return Received packet. Empty if no frame arrived within the timeout.
+	*/
+	virtual IDriver_TCPIPPacket * ReceiveFramedPacket(const LibMCDriver_TCPIP_uint32 nTimeOutInMS) = 0;
+
 };
 
 typedef IBaseSharedPtr<IDriver_TCPIP> PIDriver_TCPIP;
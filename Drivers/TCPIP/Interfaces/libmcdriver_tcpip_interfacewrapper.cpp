@@ -580,6 +580,133 @@ LibMCDriver_TCPIPResult libmcdriver_tcpip_driver_tcpip_receivepacket(LibMCDriver
 	}
 }
 
+LibMCDriver_TCPIPResult libmcdriver_tcpip_driver_tcpip_setuseioengine(LibMCDriver_TCPIP_Driver_TCPIP pDriver_TCPIP, bool bUseIOEngine)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_TCPIP;
+
+	try {
+		IDriver_TCPIP* pIDriver_TCPIP = dynamic_cast<IDriver_TCPIP*>(pIBaseClass);
+		if (!pIDriver_TCPIP)
+			throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_INVALIDCAST);
+		
+		pIDriver_TCPIP->SetUseIOEngine(bUseIOEngine);
+
+		return LIBMCDRIVER_TCPIP_SUCCESS;
+	}
+	catch (ELibMCDriver_TCPIPInterfaceException & Exception) {
+		return handleLibMCDriver_TCPIPException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_TCPIPResult libmcdriver_tcpip_driver_tcpip_setlengthprefixframing(LibMCDriver_TCPIP_Driver_TCPIP pDriver_TCPIP, LibMCDriver_TCPIP_uint32 nHeaderSize, bool bBigEndian, bool bLengthIncludesHeader, LibMCDriver_TCPIP_uint32 nMaxPacketSize)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_TCPIP;
+
+	try {
+		IDriver_TCPIP* pIDriver_TCPIP = dynamic_cast<IDriver_TCPIP*>(pIBaseClass);
+		if (!pIDriver_TCPIP)
+			throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_INVALIDCAST);
+		
+		pIDriver_TCPIP->SetLengthPrefixFraming(nHeaderSize, bBigEndian, bLengthIncludesHeader, nMaxPacketSize);
+
+		return LIBMCDRIVER_TCPIP_SUCCESS;
+	}
+	catch (ELibMCDriver_TCPIPInterfaceException & Exception) {
+		return handleLibMCDriver_TCPIPException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_TCPIPResult libmcdriver_tcpip_driver_tcpip_setdelimiterframing(LibMCDriver_TCPIP_Driver_TCPIP pDriver_TCPIP, const char * pDelimiter, LibMCDriver_TCPIP_uint32 nMaxPacketSize)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_TCPIP;
+
+	try {
+		if (pDelimiter == nullptr)
+			throw ELibMCDriver_TCPIPInterfaceException (LIBMCDRIVER_TCPIP_ERROR_INVALIDPARAM);
+		std::string sDelimiter(pDelimiter);
+		IDriver_TCPIP* pIDriver_TCPIP = dynamic_cast<IDriver_TCPIP*>(pIBaseClass);
+		if (!pIDriver_TCPIP)
+			throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_INVALIDCAST);
+		
+		pIDriver_TCPIP->SetDelimiterFraming(sDelimiter, nMaxPacketSize);
+
+		return LIBMCDRIVER_TCPIP_SUCCESS;
+	}
+	catch (ELibMCDriver_TCPIPInterfaceException & Exception) {
+		return handleLibMCDriver_TCPIPException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_TCPIPResult libmcdriver_tcpip_driver_tcpip_disableframing(LibMCDriver_TCPIP_Driver_TCPIP pDriver_TCPIP)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_TCPIP;
+
+	try {
+		IDriver_TCPIP* pIDriver_TCPIP = dynamic_cast<IDriver_TCPIP*>(pIBaseClass);
+		if (!pIDriver_TCPIP)
+			throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_INVALIDCAST);
+		
+		pIDriver_TCPIP->DisableFraming();
+
+		return LIBMCDRIVER_TCPIP_SUCCESS;
+	}
+	catch (ELibMCDriver_TCPIPInterfaceException & Exception) {
+		return handleLibMCDriver_TCPIPException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_TCPIPResult libmcdriver_tcpip_driver_tcpip_receiveframedpacket(LibMCDriver_TCPIP_Driver_TCPIP pDriver_TCPIP, LibMCDriver_TCPIP_uint32 nTimeOutInMS, LibMCDriver_TCPIP_Driver_TCPIPPacket * pPacket)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_TCPIP;
+
+	try {
+		if (pPacket == nullptr)
+			throw ELibMCDriver_TCPIPInterfaceException (LIBMCDRIVER_TCPIP_ERROR_INVALIDPARAM);
+		IBase* pBasePacket(nullptr);
+		IDriver_TCPIP* pIDriver_TCPIP = dynamic_cast<IDriver_TCPIP*>(pIBaseClass);
+		if (!pIDriver_TCPIP)
+			throw ELibMCDriver_TCPIPInterfaceException(LIBMCDRIVER_TCPIP_ERROR_INVALIDCAST);
+		
+		pBasePacket = pIDriver_TCPIP->ReceiveFramedPacket(nTimeOutInMS);
+
+		*pPacket = (IBase*)(pBasePacket);
+		return LIBMCDRIVER_TCPIP_SUCCESS;
+	}
+	catch (ELibMCDriver_TCPIPInterfaceException & Exception) {
+		return handleLibMCDriver_TCPIPException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 
 
 /*************************************************************************************************************************
@@ -627,6 +754,16 @@ LibMCDriver_TCPIPResult LibMCDriver_TCPIP::Impl::LibMCDriver_TCPIP_GetProcAddres
 		*ppProcAddress = (void*) &libmcdriver_tcpip_driver_tcpip_waitfordata;
 	if (sProcName == "libmcdriver_tcpip_driver_tcpip_receivepacket") 
 		*ppProcAddress = (void*) &libmcdriver_tcpip_driver_tcpip_receivepacket;
+	if (sProcName == "libmcdriver_tcpip_driver_tcpip_setuseioengine") 
+		*ppProcAddress = (void*) &libmcdriver_tcpip_driver_tcpip_setuseioengine;
+	if (sProcName == "libmcdriver_tcpip_driver_tcpip_setlengthprefixframing") 
+		*ppProcAddress = (void*) &libmcdriver_tcpip_driver_tcpip_setlengthprefixframing;
+	if (sProcName == "libmcdriver_tcpip_driver_tcpip_setdelimiterframing") 
+		*ppProcAddress = (void*) &libmcdriver_tcpip_driver_tcpip_setdelimiterframing;
+	if (sProcName == "libmcdriver_tcpip_driver_tcpip_disableframing") 
+		*ppProcAddress = (void*) &libmcdriver_tcpip_driver_tcpip_disableframing;
+	if (sProcName == "libmcdriver_tcpip_driver_tcpip_receiveframedpacket") 
+		*ppProcAddress = (void*) &libmcdriver_tcpip_driver_tcpip_receiveframedpacket;
 	if (sProcName == "libmcdriver_tcpip_getversion") 
 		*ppProcAddress = (void*) &libmcdriver_tcpip_getversion;
 	if (sProcName == "libmcdriver_tcpip_getlasterror") 
@@ -770,6 +770,21 @@ public:
 			case LIBMC_ERROR_INVALIDFRONTENDMODULEPATH: return "INVALIDFRONTENDMODULEPATH";
 			case LIBMC_ERROR_INVALIDFRONTENDATTRIBUTENAME: return "INVALIDFRONTENDATTRIBUTENAME";
 			case LIBMC_ERROR_DUPLICATEFRONTENDATTRIBUTENAME: return "DUPLICATEFRONTENDATTRIBUTENAME";
+			case LIBMC_ERROR_INVALIDSCHEDULERMODE: return "INVALIDSCHEDULERMODE";
+			case LIBMC_ERROR_INVALIDSCHEDULERWORKERCOUNT: return "INVALIDSCHEDULERWORKERCOUNT";
+			case LIBMC_ERROR_DUPLICATESCHEDULERTASK: return "DUPLICATESCHEDULERTASK";
+			case LIBMC_ERROR_DUPLICATESCATTERPLOTCHANNELCOLUMN: return "DUPLICATESCATTERPLOTCHANNELCOLUMN";
+			case LIBMC_ERROR_INVALIDPOINTCHANNELENCODING: return "INVALIDPOINTCHANNELENCODING";
+			case LIBMC_ERROR_INVALIDPOINTCHANNELCOMPRESSION: return "INVALIDPOINTCHANNELCOMPRESSION";
+			case LIBMC_ERROR_COULDNOTCOMPRESSPOINTCHANNEL: return "COULDNOTCOMPRESSPOINTCHANNEL";
+			case LIBMC_ERROR_INVALIDDATASERIESDOWNSAMPLINGMODE: return "INVALIDDATASERIESDOWNSAMPLINGMODE";
+			case LIBMC_ERROR_INVALIDDATASERIESDOWNSAMPLINGWIDTH: return "INVALIDDATASERIESDOWNSAMPLINGWIDTH";
+			case LIBMC_ERROR_INVALIDDATASERIESTIMERANGE: return "INVALIDDATASERIESTIMERANGE";
+			case LIBMC_ERROR_UNKNOWNDRIVERDEPENDENCY: return "UNKNOWNDRIVERDEPENDENCY";
+			case LIBMC_ERROR_CYCLICDRIVERDEPENDENCY: return "CYCLICDRIVERDEPENDENCY";
+			case LIBMC_ERROR_DRIVERDEPENDENCYFAILED: return "DRIVERDEPENDENCYFAILED";
+			case LIBMC_ERROR_ASYNCFILEWRITEQUEUESTOPPED: return "ASYNCFILEWRITEQUEUESTOPPED";
+			case LIBMC_ERROR_ASYNCFILEWRITEFAILED: return "ASYNCFILEWRITEFAILED";
 		}
 		return "UNKNOWN";
 	}
@@ -1374,6 +1389,21 @@ public:
 			case LIBMC_ERROR_INVALIDFRONTENDMODULEPATH: return "Invalid frontend module path.";
 			case LIBMC_ERROR_INVALIDFRONTENDATTRIBUTENAME: return "Invalid frontend attribute name.";
 			case LIBMC_ERROR_DUPLICATEFRONTENDATTRIBUTENAME: return "Duplicate frontend attribute name.";
+			case LIBMC_ERROR_INVALIDSCHEDULERMODE: return "Invalid state machine scheduler mode.";
+			case LIBMC_ERROR_INVALIDSCHEDULERWORKERCOUNT: return "Invalid state machine scheduler worker count.";
+			case LIBMC_ERROR_DUPLICATESCHEDULERTASK: return "Duplicate state machine scheduler task.";
+			case LIBMC_ERROR_DUPLICATESCATTERPLOTCHANNELCOLUMN: return "Duplicate scatterplot channel column.";
+			case LIBMC_ERROR_INVALIDPOINTCHANNELENCODING: return "Invalid point channel encoding.";
+			case LIBMC_ERROR_INVALIDPOINTCHANNELCOMPRESSION: return "Invalid point channel compression.";
+			case LIBMC_ERROR_COULDNOTCOMPRESSPOINTCHANNEL: return "Could not compress point channel.";
+			case LIBMC_ERROR_INVALIDDATASERIESDOWNSAMPLINGMODE: return "Invalid data series downsampling mode.";
+			case LIBMC_ERROR_INVALIDDATASERIESDOWNSAMPLINGWIDTH: return "Invalid data series downsampling width.";
+			case LIBMC_ERROR_INVALIDDATASERIESTIMERANGE: return "Invalid data series time range.";
+			case LIBMC_ERROR_UNKNOWNDRIVERDEPENDENCY: return "Unknown driver dependency.";
+			case LIBMC_ERROR_CYCLICDRIVERDEPENDENCY: return "Cyclic driver dependency.";
+			case LIBMC_ERROR_DRIVERDEPENDENCYFAILED: return "Driver dependency failed to initialize.";
+			case LIBMC_ERROR_ASYNCFILEWRITEQUEUESTOPPED: return "Asynchronous file write queue has been stopped.";
+			case LIBMC_ERROR_ASYNCFILEWRITEFAILED: return "Asynchronous file write failed.";
 		}
 		return "unknown error";
 	}
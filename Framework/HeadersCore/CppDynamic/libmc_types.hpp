@@ -692,6 +692,21 @@ typedef void * LibMC_pvoid;
 #define LIBMC_ERROR_INVALIDFRONTENDMODULEPATH 676 /** Invalid frontend module path. */
 #define LIBMC_ERROR_INVALIDFRONTENDATTRIBUTENAME 677 /** Invalid frontend attribute name. */
 #define LIBMC_ERROR_DUPLICATEFRONTENDATTRIBUTENAME 678 /** Duplicate frontend attribute name. */
+#define LIBMC_ERROR_INVALIDSCHEDULERMODE 679 /** Invalid state machine scheduler mode. */
+#define LIBMC_ERROR_INVALIDSCHEDULERWORKERCOUNT 680 /** Invalid state machine scheduler worker count. */
+#define LIBMC_ERROR_DUPLICATESCHEDULERTASK 681 /** Duplicate state machine scheduler task. */
+#define LIBMC_ERROR_DUPLICATESCATTERPLOTCHANNELCOLUMN 682 /** Duplicate scatterplot channel column. */
+#define LIBMC_ERROR_INVALIDPOINTCHANNELENCODING 683 /** Invalid point channel encoding. */
+#define LIBMC_ERROR_INVALIDPOINTCHANNELCOMPRESSION 684 /** Invalid point channel compression. */
+#define LIBMC_ERROR_COULDNOTCOMPRESSPOINTCHANNEL 685 /** Could not compress point channel. */
+#define LIBMC_ERROR_INVALIDDATASERIESDOWNSAMPLINGMODE 686 /** Invalid data series downsampling mode. */
+#define LIBMC_ERROR_INVALIDDATASERIESDOWNSAMPLINGWIDTH 687 /** Invalid data series downsampling width. */
+#define LIBMC_ERROR_INVALIDDATASERIESTIMERANGE 688 /** Invalid data series time range. */
+#define LIBMC_ERROR_UNKNOWNDRIVERDEPENDENCY 689 /** Unknown driver dependency. */
+#define LIBMC_ERROR_CYCLICDRIVERDEPENDENCY 690 /** Cyclic driver dependency. */
+#define LIBMC_ERROR_DRIVERDEPENDENCYFAILED 691 /** Driver dependency failed to initialize. */
+#define LIBMC_ERROR_ASYNCFILEWRITEQUEUESTOPPED 692 /** Asynchronous file write queue has been stopped. */
+#define LIBMC_ERROR_ASYNCFILEWRITEFAILED 693 /** Asynchronous file write failed. */
 
 /*************************************************************************************************************************
  Error strings for LibMC
@@ -1296,6 +1311,21 @@ inline const char * LIBMC_GETERRORSTRING (LibMCResult nErrorCode) {
     case LIBMC_ERROR_INVALIDFRONTENDMODULEPATH: return "Invalid frontend module path.";
     case LIBMC_ERROR_INVALIDFRONTENDATTRIBUTENAME: return "Invalid frontend attribute name.";
     case LIBMC_ERROR_DUPLICATEFRONTENDATTRIBUTENAME: return "Duplicate frontend attribute name.";
+    case LIBMC_ERROR_INVALIDSCHEDULERMODE: return "Invalid state machine scheduler mode.";
+    case LIBMC_ERROR_INVALIDSCHEDULERWORKERCOUNT: return "Invalid state machine scheduler worker count.";
+    case LIBMC_ERROR_DUPLICATESCHEDULERTASK: return "Duplicate state machine scheduler task.";
+    case LIBMC_ERROR_DUPLICATESCATTERPLOTCHANNELCOLUMN: return "Duplicate scatterplot channel column.";
+    case LIBMC_ERROR_INVALIDPOINTCHANNELENCODING: return "Invalid point channel encoding.";
+    case LIBMC_ERROR_INVALIDPOINTCHANNELCOMPRESSION: return "Invalid point channel compression.";
+    case LIBMC_ERROR_COULDNOTCOMPRESSPOINTCHANNEL: return "Could not compress point channel.";
+    case LIBMC_ERROR_INVALIDDATASERIESDOWNSAMPLINGMODE: return "Invalid data series downsampling mode.";
+    case LIBMC_ERROR_INVALIDDATASERIESDOWNSAMPLINGWIDTH: return "Invalid data series downsampling width.";
+    case LIBMC_ERROR_INVALIDDATASERIESTIMERANGE: return "Invalid data series time range.";
+    case LIBMC_ERROR_UNKNOWNDRIVERDEPENDENCY: return "Unknown driver dependency.";
+    case LIBMC_ERROR_CYCLICDRIVERDEPENDENCY: return "Cyclic driver dependency.";
+    case LIBMC_ERROR_DRIVERDEPENDENCYFAILED: return "Driver dependency failed to initialize.";
+    case LIBMC_ERROR_ASYNCFILEWRITEQUEUESTOPPED: return "Asynchronous file write queue has been stopped.";
+    case LIBMC_ERROR_ASYNCFILEWRITEFAILED: return "Asynchronous file write failed.";
     default: return "unknown error";
   }
 }
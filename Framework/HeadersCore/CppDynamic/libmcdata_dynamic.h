@@ -694,6 +694,18 @@ typedef LibMCDataResult (*PLibMCDataJournalReader_GetChunkCountPtr) (LibMCData_J
 */
 typedef LibMCDataResult (*PLibMCDataJournalReader_GetChunkInformationPtr) (LibMCData_JournalReader pJournalReader, LibMCData_uint32 nChunkIndex, LibMCData_uint64 * pStartTimeStamp, LibMCData_uint64 * pEndTimeStamp);
 
+/**
+* Returns the per variable summaries of a chunk. Summaries are stored at write time, older chunks are summarized on the fly.
+*
+* @param[in] pJournalReader - JournalReader instance.
+* @param[in] nChunkIndex - Index of the Chunk to read. Fails if chunk index is not found.
+* @param[in] nSummariesBufferSize - Number of elements in buffer
+* @param[out] pSummariesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pSummariesBuffer - JournalChunkVariableSummary  buffer of Summary of each variable that is contained in the chunk.
+* @return error code or 0 (success)
+*/
+typedef LibMCDataResult (*PLibMCDataJournalReader_ReadChunkSummariesPtr) (LibMCData_JournalReader pJournalReader, LibMCData_uint32 nChunkIndex, const LibMCData_uint64 nSummariesBufferSize, LibMCData_uint64* pSummariesNeededCount, LibMCData::sJournalChunkVariableSummary * pSummariesBuffer);
+
 /*************************************************************************************************************************
  Class definition for StorageStream
 **************************************************************************************************************************/
@@ -2012,6 +2024,19 @@ typedef LibMCDataResult (*PLibMCDataBuildJobHandler_FindJobOfDataPtr) (LibMCData
 */
 typedef LibMCDataResult (*PLibMCDataBuildJobHandler_ListJobsByStatusPtr) (LibMCData_BuildJobHandler pBuildJobHandler, LibMCData::eBuildJobStatus eStatus, LibMCData_BuildJobIterator * pIteratorInstance);
 
+/**
+* Retrieves one page of build jobs with a given status, newest first. Pages are addressed by the timestamp and UUID of the last job of the previous page, so that the query only reads the rows it returns.
+*
+* @param[in] pBuildJobHandler - BuildJobHandler instance.
+* @param[in] eStatus - Job Status to list.
+* @param[in] pCursorTimestamp - Timestamp of the last job of the previous page. Empty string for the first page.
+* @param[in] pCursorUUID - UUID of the last job of the previous page. Ignored if CursorTimestamp is empty.
+* @param[in] nMaxCount - Maximum number of jobs to return. MUST be positive.
+* @param[out] pIteratorInstance - Build Job Iterator Instance. Contains less than MaxCount jobs if the last page has been reached.
+* @return error code or 0 (success)
+*/
+typedef LibMCDataResult (*PLibMCDataBuildJobHandler_ListJobsByStatusPagePtr) (LibMCData_BuildJobHandler pBuildJobHandler, LibMCData::eBuildJobStatus eStatus, const char * pCursorTimestamp, const char * pCursorUUID, LibMCData_uint32 nMaxCount, LibMCData_BuildJobIterator * pIteratorInstance);
+
 /**
 * Converts a status enum to a string identifier.
 *
@@ -2056,6 +2081,21 @@ typedef LibMCDataResult (*PLibMCDataBuildJobHandler_RetrieveJobExecutionPtr) (Li
 */
 typedef LibMCDataResult (*PLibMCDataBuildJobHandler_ListJobExecutionsPtr) (LibMCData_BuildJobHandler pBuildJobHandler, const char * pMinTimestamp, const char * pMaxTimestamp, const char * pJournalUUIDFilter, LibMCData_BuildJobExecutionIterator * pIteratorInstance);
 
+/**
+* Retrieves one page of build executions, filtered by time or journal, newest first. Pages are addressed by the start timestamp and UUID of the last execution of the previous page.
+*
+* @param[in] pBuildJobHandler - BuildJobHandler instance.
+* @param[in] pMinTimestamp - Minimum Timestamp in ISO8601 UTC format. May be empty for no filter.
+* @param[in] pMaxTimestamp - Maximum Timestamp in ISO8601 UTC format. May be empty for no filter.
+* @param[in] pJournalUUIDFilter - UUID of the journal to filter from. Ignored if empty string.
+* @param[in] pCursorTimestamp - Start timestamp of the last execution of the previous page in ISO8601 UTC format. Empty string for the first page.
+* @param[in] pCursorUUID - UUID of the last execution of the previous page. Ignored if CursorTimestamp is empty.
+* @param[in] nMaxCount - Maximum number of executions to return. MUST be positive.
+* @param[out] pIteratorInstance - Returns the list of execution instances that are queried. Contains less than MaxCount executions if the last page has been reached.
+* @return error code or 0 (success)
+*/
+typedef LibMCDataResult (*PLibMCDataBuildJobHandler_ListJobExecutionsPagePtr) (LibMCData_BuildJobHandler pBuildJobHandler, const char * pMinTimestamp, const char * pMaxTimestamp, const char * pJournalUUIDFilter, const char * pCursorTimestamp, const char * pCursorUUID, LibMCData_uint32 nMaxCount, LibMCData_BuildJobExecutionIterator * pIteratorInstance);
+
 /*************************************************************************************************************************
  Class definition for UserList
 **************************************************************************************************************************/
@@ -3227,6 +3267,7 @@ typedef struct {
 	PLibMCDataJournalReader_GetAliasInformationPtr m_JournalReader_GetAliasInformation;
 	PLibMCDataJournalReader_GetChunkCountPtr m_JournalReader_GetChunkCount;
 	PLibMCDataJournalReader_GetChunkInformationPtr m_JournalReader_GetChunkInformation;
+	PLibMCDataJournalReader_ReadChunkSummariesPtr m_JournalReader_ReadChunkSummaries;
 	PLibMCDataStorageStream_GetUUIDPtr m_StorageStream_GetUUID;
 	PLibMCDataStorageStream_GetTimeStampPtr m_StorageStream_GetTimeStamp;
 	PLibMCDataStorageStream_GetContextIdentifierPtr m_StorageStream_GetContextIdentifier;
@@ -3348,10 +3389,12 @@ typedef struct {
 	PLibMCDataBuildJobHandler_RetrieveJobPtr m_BuildJobHandler_RetrieveJob;
 	PLibMCDataBuildJobHandler_FindJobOfDataPtr m_BuildJobHandler_FindJobOfData;
 	PLibMCDataBuildJobHandler_ListJobsByStatusPtr m_BuildJobHandler_ListJobsByStatus;
+	PLibMCDataBuildJobHandler_ListJobsByStatusPagePtr m_BuildJobHandler_ListJobsByStatusPage;
 	PLibMCDataBuildJobHandler_ConvertBuildStatusToStringPtr m_BuildJobHandler_ConvertBuildStatusToString;
 	PLibMCDataBuildJobHandler_ConvertStringToBuildStatusPtr m_BuildJobHandler_ConvertStringToBuildStatus;
 	PLibMCDataBuildJobHandler_RetrieveJobExecutionPtr m_BuildJobHandler_RetrieveJobExecution;
 	PLibMCDataBuildJobHandler_ListJobExecutionsPtr m_BuildJobHandler_ListJobExecutions;
+	PLibMCDataBuildJobHandler_ListJobExecutionsPagePtr m_BuildJobHandler_ListJobExecutionsPage;
 	PLibMCDataUserList_CountPtr m_UserList_Count;
 	PLibMCDataUserList_GetUserPropertiesPtr m_UserList_GetUserProperties;
 	PLibMCDataLoginHandler_UserExistsPtr m_LoginHandler_UserExists;
@@ -650,6 +650,10 @@ public:
 			case LIBMCDATA_ERROR_COULDNOTFINDMACHINECONFIGURATIONTYPE: return "COULDNOTFINDMACHINECONFIGURATIONTYPE";
 			case LIBMCDATA_ERROR_INVALIDSTORAGESTREAMSIZE: return "INVALIDSTORAGESTREAMSIZE";
 			case LIBMCDATA_ERROR_COULDNOTUPDATEBUILDNAME: return "COULDNOTUPDATEBUILDNAME";
+			case LIBMCDATA_ERROR_INVALIDJOURNALCHUNKENCODING: return "INVALIDJOURNALCHUNKENCODING";
+			case LIBMCDATA_ERROR_COULDNOTCOMPRESSJOURNALCHUNK: return "COULDNOTCOMPRESSJOURNALCHUNK";
+			case LIBMCDATA_ERROR_COULDNOTMAPJOURNALFILE: return "COULDNOTMAPJOURNALFILE";
+			case LIBMCDATA_ERROR_INVALIDPAGESIZE: return "INVALIDPAGESIZE";
 		}
 		return "UNKNOWN";
 	}
@@ -1027,6 +1031,10 @@ public:
 			case LIBMCDATA_ERROR_COULDNOTFINDMACHINECONFIGURATIONTYPE: return "Could not find machine configuration type.";
 			case LIBMCDATA_ERROR_INVALIDSTORAGESTREAMSIZE: return "Storage stream size for build is zero.";
 			case LIBMCDATA_ERROR_COULDNOTUPDATEBUILDNAME: return "Could not update build name";
+			case LIBMCDATA_ERROR_INVALIDJOURNALCHUNKENCODING: return "Invalid journal chunk encoding.";
+			case LIBMCDATA_ERROR_COULDNOTCOMPRESSJOURNALCHUNK: return "Could not compress journal chunk.";
+			case LIBMCDATA_ERROR_COULDNOTMAPJOURNALFILE: return "Could not memory map journal file.";
+			case LIBMCDATA_ERROR_INVALIDPAGESIZE: return "Invalid page size";
 		}
 		return "unknown error";
 	}
@@ -1434,6 +1442,7 @@ public:
 	inline void GetAliasInformation(const LibMCData_uint32 nAliasIndex, std::string & sAliasName, std::string & sSourceVariableName);
 	inline LibMCData_uint32 GetChunkCount();
 	inline void GetChunkInformation(const LibMCData_uint32 nChunkIndex, LibMCData_uint64 & nStartTimeStamp, LibMCData_uint64 & nEndTimeStamp);
+	inline void ReadChunkSummaries(const LibMCData_uint32 nChunkIndex, std::vector<sJournalChunkVariableSummary> & SummariesBuffer);
 };
 	
 /*************************************************************************************************************************
@@ -1763,10 +1772,12 @@ public:
 	inline PBuildJob RetrieveJob(const std::string & sJobUUID);
 	inline PBuildJob FindJobOfData(const std::string & sDataUUID);
 	inline PBuildJobIterator ListJobsByStatus(const eBuildJobStatus eStatus);
+	inline PBuildJobIterator ListJobsByStatusPage(const eBuildJobStatus eStatus, const std::string & sCursorTimestamp, const std::string & sCursorUUID, const LibMCData_uint32 nMaxCount);
 	inline std::string ConvertBuildStatusToString(const eBuildJobStatus eStatus);
 	inline eBuildJobStatus ConvertStringToBuildStatus(const std::string & sString);
 	inline PBuildJobExecution RetrieveJobExecution(const std::string & sExecutionUUID);
 	inline PBuildJobExecutionIterator ListJobExecutions(const std::string & sMinTimestamp, const std::string & sMaxTimestamp, const std::string & sJournalUUIDFilter);
+	inline PBuildJobExecutionIterator ListJobExecutionsPage(const std::string & sMinTimestamp, const std::string & sMaxTimestamp, const std::string & sJournalUUIDFilter, const std::string & sCursorTimestamp, const std::string & sCursorUUID, const LibMCData_uint32 nMaxCount);
 };
 	
 /*************************************************************************************************************************
@@ -2157,6 +2168,7 @@ public:
 		pWrapperTable->m_JournalReader_GetAliasInformation = nullptr;
 		pWrapperTable->m_JournalReader_GetChunkCount = nullptr;
 		pWrapperTable->m_JournalReader_GetChunkInformation = nullptr;
+		pWrapperTable->m_JournalReader_ReadChunkSummaries = nullptr;
 		pWrapperTable->m_StorageStream_GetUUID = nullptr;
 		pWrapperTable->m_StorageStream_GetTimeStamp = nullptr;
 		pWrapperTable->m_StorageStream_GetContextIdentifier = nullptr;
@@ -2278,10 +2290,12 @@ public:
 		pWrapperTable->m_BuildJobHandler_RetrieveJob = nullptr;
 		pWrapperTable->m_BuildJobHandler_FindJobOfData = nullptr;
 		pWrapperTable->m_BuildJobHandler_ListJobsByStatus = nullptr;
+		pWrapperTable->m_BuildJobHandler_ListJobsByStatusPage = nullptr;
 		pWrapperTable->m_BuildJobHandler_ConvertBuildStatusToString = nullptr;
 		pWrapperTable->m_BuildJobHandler_ConvertStringToBuildStatus = nullptr;
 		pWrapperTable->m_BuildJobHandler_RetrieveJobExecution = nullptr;
 		pWrapperTable->m_BuildJobHandler_ListJobExecutions = nullptr;
+		pWrapperTable->m_BuildJobHandler_ListJobExecutionsPage = nullptr;
 		pWrapperTable->m_UserList_Count = nullptr;
 		pWrapperTable->m_UserList_GetUserProperties = nullptr;
 		pWrapperTable->m_LoginHandler_UserExists = nullptr;
@@ -2934,6 +2948,15 @@ public:
 		if (pWrapperTable->m_JournalReader_GetChunkInformation == nullptr)
 			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_JournalReader_ReadChunkSummaries = (PLibMCDataJournalReader_ReadChunkSummariesPtr) GetProcAddress(hLibrary, "libmcdata_journalreader_readchunksummaries");
+		#else // _WIN32
+		pWrapperTable->m_JournalReader_ReadChunkSummaries = (PLibMCDataJournalReader_ReadChunkSummariesPtr) dlsym(hLibrary, "libmcdata_journalreader_readchunksummaries");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_JournalReader_ReadChunkSummaries == nullptr)
+			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_StorageStream_GetUUID = (PLibMCDataStorageStream_GetUUIDPtr) GetProcAddress(hLibrary, "libmcdata_storagestream_getuuid");
 		#else // _WIN32
@@ -4023,6 +4046,15 @@ public:
 		if (pWrapperTable->m_BuildJobHandler_ListJobsByStatus == nullptr)
 			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_BuildJobHandler_ListJobsByStatusPage = (PLibMCDataBuildJobHandler_ListJobsByStatusPagePtr) GetProcAddress(hLibrary, "libmcdata_buildjobhandler_listjobsbystatuspage");
+		#else // _WIN32
+		pWrapperTable->m_BuildJobHandler_ListJobsByStatusPage = (PLibMCDataBuildJobHandler_ListJobsByStatusPagePtr) dlsym(hLibrary, "libmcdata_buildjobhandler_listjobsbystatuspage");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_BuildJobHandler_ListJobsByStatusPage == nullptr)
+			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_BuildJobHandler_ConvertBuildStatusToString = (PLibMCDataBuildJobHandler_ConvertBuildStatusToStringPtr) GetProcAddress(hLibrary, "libmcdata_buildjobhandler_convertbuildstatustostring");
 		#else // _WIN32
@@ -4059,6 +4091,15 @@ public:
 		if (pWrapperTable->m_BuildJobHandler_ListJobExecutions == nullptr)
 			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_BuildJobHandler_ListJobExecutionsPage = (PLibMCDataBuildJobHandler_ListJobExecutionsPagePtr) GetProcAddress(hLibrary, "libmcdata_buildjobhandler_listjobexecutionspage");
+		#else // _WIN32
+		pWrapperTable->m_BuildJobHandler_ListJobExecutionsPage = (PLibMCDataBuildJobHandler_ListJobExecutionsPagePtr) dlsym(hLibrary, "libmcdata_buildjobhandler_listjobexecutionspage");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_BuildJobHandler_ListJobExecutionsPage == nullptr)
+			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_UserList_Count = (PLibMCDataUserList_CountPtr) GetProcAddress(hLibrary, "libmcdata_userlist_count");
 		#else // _WIN32
@@ -5181,6 +5222,10 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_JournalReader_GetChunkInformation == nullptr) )
 			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdata_journalreader_readchunksummaries", (void**)&(pWrapperTable->m_JournalReader_ReadChunkSummaries));
+		if ( (eLookupError != 0) || (pWrapperTable->m_JournalReader_ReadChunkSummaries == nullptr) )
+			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdata_storagestream_getuuid", (void**)&(pWrapperTable->m_StorageStream_GetUUID));
 		if ( (eLookupError != 0) || (pWrapperTable->m_StorageStream_GetUUID == nullptr) )
 			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -5665,6 +5710,10 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_BuildJobHandler_ListJobsByStatus == nullptr) )
 			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdata_buildjobhandler_listjobsbystatuspage", (void**)&(pWrapperTable->m_BuildJobHandler_ListJobsByStatusPage));
+		if ( (eLookupError != 0) || (pWrapperTable->m_BuildJobHandler_ListJobsByStatusPage == nullptr) )
+			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdata_buildjobhandler_convertbuildstatustostring", (void**)&(pWrapperTable->m_BuildJobHandler_ConvertBuildStatusToString));
 		if ( (eLookupError != 0) || (pWrapperTable->m_BuildJobHandler_ConvertBuildStatusToString == nullptr) )
 			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -5681,6 +5730,10 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_BuildJobHandler_ListJobExecutions == nullptr) )
 			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdata_buildjobhandler_listjobexecutionspage", (void**)&(pWrapperTable->m_BuildJobHandler_ListJobExecutionsPage));
+		if ( (eLookupError != 0) || (pWrapperTable->m_BuildJobHandler_ListJobExecutionsPage == nullptr) )
+			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdata_userlist_count", (void**)&(pWrapperTable->m_UserList_Count));
 		if ( (eLookupError != 0) || (pWrapperTable->m_UserList_Count == nullptr) )
 			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -6925,6 +6978,20 @@ public:
 		CheckError(m_pWrapper->m_WrapperTable.m_JournalReader_GetChunkInformation(m_pHandle, nChunkIndex, &nStartTimeStamp, &nEndTimeStamp));
 	}
 	
+	/**
+	* CJournalReader::ReadChunkSummaries - Returns the per variable summaries of a chunk. Summaries are stored at write time, older chunks are summarized on the fly.
+	* @param[in] nChunkIndex - Index of the Chunk to read. Fails if chunk index is not found.
+	* @param[out] SummariesBuffer - Summary of each variable that is contained in the chunk.
+	*/
+	void CJournalReader::ReadChunkSummaries(const LibMCData_uint32 nChunkIndex, std::vector<sJournalChunkVariableSummary> & SummariesBuffer)
+	{
+		LibMCData_uint64 elementsNeededSummaries = 0;
+		LibMCData_uint64 elementsWrittenSummaries = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_JournalReader_ReadChunkSummaries(m_pHandle, nChunkIndex, 0, &elementsNeededSummaries, nullptr));
+		SummariesBuffer.resize((size_t) elementsNeededSummaries);
+		CheckError(m_pWrapper->m_WrapperTable.m_JournalReader_ReadChunkSummaries(m_pHandle, nChunkIndex, elementsNeededSummaries, &elementsWrittenSummaries, SummariesBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CStorageStream
 	 */
@@ -8641,6 +8708,25 @@ public:
 		return std::make_shared<CBuildJobIterator>(m_pWrapper, hIteratorInstance);
 	}
 	
+	/**
+	* CBuildJobHandler::ListJobsByStatusPage - Retrieves one page of build jobs with a given status, newest first. Pages are addressed by the timestamp and UUID of the last job of the previous page, so that the query only reads the rows it returns.
+	* @param[in] eStatus - Job Status to list.
+	* @param[in] sCursorTimestamp - Timestamp of the last job of the previous page. Empty string for the first page.
+	* @param[in] sCursorUUID - UUID of the last job of the previous page. Ignored if CursorTimestamp is empty.
+	* @param[in] nMaxCount - Maximum number of jobs to return. MUST be positive.
+	* @return Build Job Iterator Instance. Contains less than MaxCount jobs if the last page has been reached.
+	*/
+	PBuildJobIterator CBuildJobHandler::ListJobsByStatusPage(const eBuildJobStatus eStatus, const std::string & sCursorTimestamp, const std::string & sCursorUUID, const LibMCData_uint32 nMaxCount)
+	{
+		LibMCDataHandle hIteratorInstance = nullptr;
+		CheckError(m_pWrapper->m_WrapperTable.m_BuildJobHandler_ListJobsByStatusPage(m_pHandle, eStatus, sCursorTimestamp.c_str(), sCursorUUID.c_str(), nMaxCount, &hIteratorInstance));
+		
+		if (!hIteratorInstance) {
+			CheckError(LIBMCDATA_ERROR_INVALIDPARAM);
+		}
+		return std::make_shared<CBuildJobIterator>(m_pWrapper, hIteratorInstance);
+	}
+	
 	/**
 	* CBuildJobHandler::ConvertBuildStatusToString - Converts a status enum to a string identifier.
 	* @param[in] eStatus - Status Enum.
@@ -8705,6 +8791,27 @@ public:
 		return std::make_shared<CBuildJobExecutionIterator>(m_pWrapper, hIteratorInstance);
 	}
 	
+	/**
+	* CBuildJobHandler::ListJobExecutionsPage - Retrieves one page of build executions, filtered by time or journal, newest first. Pages are addressed by the start timestamp and UUID of the last execution of the previous page.
+	* @param[in] sMinTimestamp - Minimum Timestamp in ISO8601 UTC format. May be empty for no filter.
+	* @param[in] sMaxTimestamp - Maximum Timestamp in ISO8601 UTC format. May be empty for no filter.
+	* @param[in] sJournalUUIDFilter - UUID of the journal to filter from. Ignored if empty string.
+	* @param[in] sCursorTimestamp - Start timestamp of the last execution of the previous page in ISO8601 UTC format. Empty string for the first page.
+	* @param[in] sCursorUUID - UUID of the last execution of the previous page. Ignored if CursorTimestamp is empty.
+	* @param[in] nMaxCount - Maximum number of executions to return. MUST be positive.
+	* @return Returns the list of execution instances that are queried. Contains less than MaxCount executions if the last page has been reached.
+	*/
+	PBuildJobExecutionIterator CBuildJobHandler::ListJobExecutionsPage(const std::string & sMinTimestamp, const std::string & sMaxTimestamp, const std::string & sJournalUUIDFilter, const std::string & sCursorTimestamp, const std::string & sCursorUUID, const LibMCData_uint32 nMaxCount)
+	{
+		LibMCDataHandle hIteratorInstance = nullptr;
+		CheckError(m_pWrapper->m_WrapperTable.m_BuildJobHandler_ListJobExecutionsPage(m_pHandle, sMinTimestamp.c_str(), sMaxTimestamp.c_str(), sJournalUUIDFilter.c_str(), sCursorTimestamp.c_str(), sCursorUUID.c_str(), nMaxCount, &hIteratorInstance));
+		
+		if (!hIteratorInstance) {
+			CheckError(LIBMCDATA_ERROR_INVALIDPARAM);
+		}
+		return std::make_shared<CBuildJobExecutionIterator>(m_pWrapper, hIteratorInstance);
+	}
+	
 	/**
 	 * Method definitions for class CUserList
 	 */
@@ -465,6 +465,10 @@ typedef void * LibMCData_pvoid;
 #define LIBMCDATA_ERROR_COULDNOTFINDMACHINECONFIGURATIONTYPE 438 /** Could not find machine configuration type. */
 #define LIBMCDATA_ERROR_INVALIDSTORAGESTREAMSIZE 439 /** Storage stream size for build is zero. */
 #define LIBMCDATA_ERROR_COULDNOTUPDATEBUILDNAME 440 /** Could not update build name */
+#define LIBMCDATA_ERROR_INVALIDJOURNALCHUNKENCODING 441 /** Invalid journal chunk encoding. */
+#define LIBMCDATA_ERROR_COULDNOTCOMPRESSJOURNALCHUNK 442 /** Could not compress journal chunk. */
+#define LIBMCDATA_ERROR_COULDNOTMAPJOURNALFILE 443 /** Could not memory map journal file. */
+#define LIBMCDATA_ERROR_INVALIDPAGESIZE 444 /** Invalid page size */
 
 /*************************************************************************************************************************
  Error strings for LibMCData
@@ -842,6 +846,10 @@ inline const char * LIBMCDATA_GETERRORSTRING (LibMCDataResult nErrorCode) {
     case LIBMCDATA_ERROR_COULDNOTFINDMACHINECONFIGURATIONTYPE: return "Could not find machine configuration type.";
     case LIBMCDATA_ERROR_INVALIDSTORAGESTREAMSIZE: return "Storage stream size for build is zero.";
     case LIBMCDATA_ERROR_COULDNOTUPDATEBUILDNAME: return "Could not update build name";
+    case LIBMCDATA_ERROR_INVALIDJOURNALCHUNKENCODING: return "Invalid journal chunk encoding.";
+    case LIBMCDATA_ERROR_COULDNOTCOMPRESSJOURNALCHUNK: return "Could not compress journal chunk.";
+    case LIBMCDATA_ERROR_COULDNOTMAPJOURNALFILE: return "Could not memory map journal file.";
+    case LIBMCDATA_ERROR_INVALIDPAGESIZE: return "Invalid page size";
     default: return "unknown error";
   }
 }
@@ -960,6 +968,17 @@ namespace LibMCData {
       LibMCData_uint32 m_EntryCount;
   } sJournalChunkVariableInfo;
   
+  typedef struct sJournalChunkVariableSummary {
+      LibMCData_uint32 m_VariableIndex;
+      LibMCData_uint32 m_EntryCount;
+      LibMCData_uint32 m_FirstTimeStamp;
+      LibMCData_uint32 m_LastTimeStamp;
+      LibMCData_int64 m_MinValue;
+      LibMCData_int64 m_MaxValue;
+      LibMCData_int64 m_LastValue;
+      LibMCData_double m_ValueSum;
+  } sJournalChunkVariableSummary;
+  
   #pragma pack ()
   
   /*************************************************************************************************************************
@@ -1007,6 +1026,7 @@ typedef LibMCData::eBuildJobStatus eLibMCDataBuildJobStatus;
 typedef LibMCData::eCustomDataType eLibMCDataCustomDataType;
 typedef LibMCData::eBuildJobExecutionStatus eLibMCDataBuildJobExecutionStatus;
 typedef LibMCData::sJournalChunkVariableInfo sLibMCDataJournalChunkVariableInfo;
+typedef LibMCData::sJournalChunkVariableSummary sLibMCDataJournalChunkVariableSummary;
 typedef LibMCData::LogCallback LibMCDataLogCallback;
 typedef LibMCData::StreamReadCallback LibMCDataStreamReadCallback;
 typedef LibMCData::StreamSeekCallback LibMCDataStreamSeekCallback;
@@ -617,6 +617,19 @@ typedef LibMCEnvResult (*PLibMCEnvImageLoader_CreateImageFromRawRGBA32DataPtr) (
 */
 typedef LibMCEnvResult (*PLibMCEnvImageLoader_CreateImageFromRawYUY2DataPtr) (LibMCEnv_ImageLoader pImageLoader, LibMCEnv_uint64 nYUY2DataBufferSize, const LibMCEnv_uint8 * pYUY2DataBuffer, LibMCEnv_uint32 nPixelSizeX, LibMCEnv_uint32 nPixelSizeY, LibMCEnv_double dDPIValueX, LibMCEnv_double dDPIValueY, LibMCEnv::eImagePixelFormat ePixelFormat, LibMCEnv_ImageData * pImageDataInstance);
 
+/**
+* Encodes raw YUY2 camera data as JPEG without converting it to RGB first. The chroma channels keep their horizontal subsampling.
+*
+* @param[in] pImageLoader - ImageLoader instance.
+* @param[in] nYUY2DataBufferSize - Number of elements in buffer
+* @param[in] pYUY2DataBuffer - uint8 buffer of YUY2 data. MUST contain PixelSizeX * PixelSizeY * 2 bytes.
+* @param[in] nPixelSizeX - Pixel size in X. MUST be positive and even.
+* @param[in] nPixelSizeY - Pixel size in Y. MUST be positive.
+* @param[out] pJPEGImageDataInstance - JPEG instance with the encoded data.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvImageLoader_CreateJPEGImageFromRawYUY2DataPtr) (LibMCEnv_ImageLoader pImageLoader, LibMCEnv_uint64 nYUY2DataBufferSize, const LibMCEnv_uint8 * pYUY2DataBuffer, LibMCEnv_uint32 nPixelSizeX, LibMCEnv_uint32 nPixelSizeY, LibMCEnv_JPEGImageData * pJPEGImageDataInstance);
+
 /*************************************************************************************************************************
  Class definition for VideoStream
 **************************************************************************************************************************/
@@ -1084,10 +1097,46 @@ typedef LibMCEnvResult (*PLibMCEnvDiscreteFieldData2D_AddFieldPtr) (LibMCEnv_Dis
 */
 typedef LibMCEnvResult (*PLibMCEnvDiscreteFieldData2D_DuplicatePtr) (LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, LibMCEnv_DiscreteFieldData2D * pNewField);
 
+/**
+* Returns if the field values are stored in single precision. Default is false.
+*
+* @param[in] pDiscreteFieldData2D - DiscreteFieldData2D instance.
+* @param[out] pSinglePrecision - If true, field values are stored as 32 bit floats.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDiscreteFieldData2D_GetSinglePrecisionStoragePtr) (LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, bool * pSinglePrecision);
+
+/**
+* Converts the field values to single or double precision storage. Single precision halves the memory and bandwidth of all field operations. Values are still passed in and out as doubles.
+*
+* @param[in] pDiscreteFieldData2D - DiscreteFieldData2D instance.
+* @param[in] bSinglePrecision - If true, field values are stored as 32 bit floats. If false, field values are stored as 64 bit doubles.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDiscreteFieldData2D_SetSinglePrecisionStoragePtr) (LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, bool bSinglePrecision);
+
 /*************************************************************************************************************************
  Class definition for DataTableWriteOptions
 **************************************************************************************************************************/
 
+/**
+* Returns if the column data is compressed when writing the data table. Default is false.
+*
+* @param[in] pDataTableWriteOptions - DataTableWriteOptions instance.
+* @param[out] pCompressColumns - If true, each column is stored LZ4 compressed.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableWriteOptions_GetCompressColumnsPtr) (LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, bool * pCompressColumns);
+
+/**
+* Sets if the column data shall be compressed when writing the data table. Compressed data tables can not be read by older versions.
+*
+* @param[in] pDataTableWriteOptions - DataTableWriteOptions instance.
+* @param[in] bCompressColumns - If true, each column is stored LZ4 compressed. Integer columns are delta encoded before compression.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableWriteOptions_SetCompressColumnsPtr) (LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, bool bCompressColumns);
+
 /*************************************************************************************************************************
  Class definition for DataTableCSVWriteOptions
 **************************************************************************************************************************/
@@ -1112,6 +1161,24 @@ typedef LibMCEnvResult (*PLibMCEnvDataTableCSVWriteOptions_GetSeparatorPtr) (Lib
 */
 typedef LibMCEnvResult (*PLibMCEnvDataTableCSVWriteOptions_SetSeparatorPtr) (LibMCEnv_DataTableCSVWriteOptions pDataTableCSVWriteOptions, const char * pSeparator);
 
+/**
+* Returns if double values are written with full precision. Default is false.
+*
+* @param[in] pDataTableCSVWriteOptions - DataTableCSVWriteOptions instance.
+* @param[out] pRoundTripDoubles - If true, double values are written in their shortest form that reads back to the identical value. If false, double values are rounded to three decimal places.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableCSVWriteOptions_GetRoundTripDoublesPtr) (LibMCEnv_DataTableCSVWriteOptions pDataTableCSVWriteOptions, bool * pRoundTripDoubles);
+
+/**
+* Sets if double values are written with full precision.
+*
+* @param[in] pDataTableCSVWriteOptions - DataTableCSVWriteOptions instance.
+* @param[in] bRoundTripDoubles - If true, double values are written in their shortest form that reads back to the identical value. If false, double values are rounded to three decimal places.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableCSVWriteOptions_SetRoundTripDoublesPtr) (LibMCEnv_DataTableCSVWriteOptions pDataTableCSVWriteOptions, bool bRoundTripDoubles);
+
 /*************************************************************************************************************************
  Class definition for ScatterPlotDataColumn
 **************************************************************************************************************************/
@@ -5140,6 +5207,30 @@ typedef LibMCEnvResult (*PLibMCEnvWorkingDirectory_AddBufferedWriterPtr) (LibMCE
 */
 typedef LibMCEnvResult (*PLibMCEnvWorkingDirectory_AddBufferedWriterTempFilePtr) (LibMCEnv_WorkingDirectory pWorkingDirectory, const char * pExtension, LibMCEnv_uint32 nBufferSizeInkB, LibMCEnv_WorkingFileWriter * pWriterInstance);
 
+/**
+* Adds an asynchronous buffered writer to the directory. Full buffers are written by a background I/O thread, while new data is collected in a second buffer.
+*
+* @param[in] pWorkingDirectory - WorkingDirectory instance.
+* @param[in] pFileName - filename to store to. Can not include any path delimiters or ..
+* @param[in] nBufferSizeInkB - Size of each of the two memory buffers in kB. MUST be larger than 0 and smaller than 1048576.
+* @param[in] bSyncOnFinish - If true, finishing the writer blocks until the file content has reached the storage device.
+* @param[out] pWriterInstance - Working file writer instance.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvWorkingDirectory_AddAsyncBufferedWriterPtr) (LibMCEnv_WorkingDirectory pWorkingDirectory, const char * pFileName, LibMCEnv_uint32 nBufferSizeInkB, bool bSyncOnFinish, LibMCEnv_WorkingFileWriter * pWriterInstance);
+
+/**
+* Adds an asynchronous buffered writer to the directory with a temporary file name.
+*
+* @param[in] pWorkingDirectory - WorkingDirectory instance.
+* @param[in] pExtension - extension of the file to store. MAY be an empty string. MUST only include up to 64 alphanumeric characters.
+* @param[in] nBufferSizeInkB - Size of each of the two memory buffers in kB. MUST be larger than 0 and smaller than 1048576.
+* @param[in] bSyncOnFinish - If true, finishing the writer blocks until the file content has reached the storage device.
+* @param[out] pWriterInstance - Working file writer instance.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvWorkingDirectory_AddAsyncBufferedWriterTempFilePtr) (LibMCEnv_WorkingDirectory pWorkingDirectory, const char * pExtension, LibMCEnv_uint32 nBufferSizeInkB, bool bSyncOnFinish, LibMCEnv_WorkingFileWriter * pWriterInstance);
+
 /*************************************************************************************************************************
  Class definition for XMLDocumentAttribute
 **************************************************************************************************************************/
@@ -8024,6 +8115,33 @@ typedef LibMCEnvResult (*PLibMCEnvJournalVariable_ComputeDoubleSamplePtr) (LibMC
 */
 typedef LibMCEnvResult (*PLibMCEnvJournalVariable_ComputeIntegerSamplePtr) (LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nTimeInMicroSeconds, LibMCEnv_int64 * pSampleValue);
 
+/**
+* Computes minimum, maximum, mean and last value of the recorded entries over consecutive buckets of fixed length.
+*
+* @param[in] pJournalVariable - JournalVariable instance.
+* @param[in] nStartTimeInMicroSeconds - Start time of the first bucket.
+* @param[in] nIntervalInMicroSeconds - Length of each bucket. MUST be larger than 0.
+* @param[in] nBucketCount - Number of buckets. MUST be larger than 0.
+* @param[in] nBucketsBufferSize - Number of elements in buffer
+* @param[out] pBucketsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pBucketsBuffer - JournalBucketStatistics  buffer of Statistics of each bucket, in increasing order. Buckets without entries have a SampleCount of 0.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvJournalVariable_ComputeBucketStatisticsPtr) (LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nIntervalInMicroSeconds, LibMCEnv_uint32 nBucketCount, const LibMCEnv_uint64 nBucketsBufferSize, LibMCEnv_uint64* pBucketsNeededCount, LibMCEnv::sJournalBucketStatistics * pBucketsBuffer);
+
+/**
+* Returns all recorded entries of the variable within a time interval. Only available for historic journals.
+*
+* @param[in] pJournalVariable - JournalVariable instance.
+* @param[in] nStartTimeInMicroSeconds - Start of the interval. Entries at this time are included.
+* @param[in] nEndTimeInMicroSeconds - End of the interval. Entries at this time are excluded.
+* @param[in] nTimeStreamEntriesBufferSize - Number of elements in buffer
+* @param[out] pTimeStreamEntriesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pTimeStreamEntriesBuffer - TimeStreamEntry  buffer of Recorded entries in increasing order of time.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvJournalVariable_ReceiveRawTimeStreamPtr) (LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nEndTimeInMicroSeconds, const LibMCEnv_uint64 nTimeStreamEntriesBufferSize, LibMCEnv_uint64* pTimeStreamEntriesNeededCount, LibMCEnv::sTimeStreamEntry * pTimeStreamEntriesBuffer);
+
 /*************************************************************************************************************************
  Class definition for Alert
 **************************************************************************************************************************/
@@ -8217,6 +8335,21 @@ typedef LibMCEnvResult (*PLibMCEnvLogEntryList_GetEntryTimePtr) (LibMCEnv_LogEnt
 */
 typedef LibMCEnvResult (*PLibMCEnvJournalHandler_RetrieveJournalVariablePtr) (LibMCEnv_JournalHandler pJournalHandler, const char * pVariableName, LibMCEnv_JournalVariable * pJournalVariable);
 
+/**
+* Computes minimum, maximum, mean and last value of several variables over consecutive buckets of fixed length. The recorded data is read only once for all variables.
+*
+* @param[in] pJournalHandler - JournalHandler instance.
+* @param[in] pVariableNames - Semicolon separated list of variable or alias names. Fails if a variable does not exist or is not numeric.
+* @param[in] nStartTimeInMicroSeconds - Start time of the first bucket.
+* @param[in] nIntervalInMicroSeconds - Length of each bucket. MUST be larger than 0.
+* @param[in] nBucketCount - Number of buckets per variable. MUST be larger than 0.
+* @param[in] nBucketsBufferSize - Number of elements in buffer
+* @param[out] pBucketsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pBucketsBuffer - JournalBucketStatistics  buffer of Statistics of all buckets of the first variable in increasing order, followed by the buckets of the next variable. Buckets without entries have a SampleCount of 0.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvJournalHandler_ComputeBucketStatisticsPtr) (LibMCEnv_JournalHandler pJournalHandler, const char * pVariableNames, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nIntervalInMicroSeconds, LibMCEnv_uint32 nBucketCount, const LibMCEnv_uint64 nBucketsBufferSize, LibMCEnv_uint64* pBucketsNeededCount, LibMCEnv::sJournalBucketStatistics * pBucketsBuffer);
+
 /**
 * Retrieves the reference start time of the journal.
 *
@@ -10744,6 +10877,7 @@ typedef struct {
 	PLibMCEnvImageLoader_CreateImageFromRawRGB24DataPtr m_ImageLoader_CreateImageFromRawRGB24Data;
 	PLibMCEnvImageLoader_CreateImageFromRawRGBA32DataPtr m_ImageLoader_CreateImageFromRawRGBA32Data;
 	PLibMCEnvImageLoader_CreateImageFromRawYUY2DataPtr m_ImageLoader_CreateImageFromRawYUY2Data;
+	PLibMCEnvImageLoader_CreateJPEGImageFromRawYUY2DataPtr m_ImageLoader_CreateJPEGImageFromRawYUY2Data;
 	PLibMCEnvVideoStream_GetUUIDPtr m_VideoStream_GetUUID;
 	PLibMCEnvVideoStream_GetWidthPtr m_VideoStream_GetWidth;
 	PLibMCEnvVideoStream_GetHeightPtr m_VideoStream_GetHeight;
@@ -10788,8 +10922,14 @@ typedef struct {
 	PLibMCEnvDiscreteFieldData2D_TransformFieldPtr m_DiscreteFieldData2D_TransformField;
 	PLibMCEnvDiscreteFieldData2D_AddFieldPtr m_DiscreteFieldData2D_AddField;
 	PLibMCEnvDiscreteFieldData2D_DuplicatePtr m_DiscreteFieldData2D_Duplicate;
+	PLibMCEnvDiscreteFieldData2D_GetSinglePrecisionStoragePtr m_DiscreteFieldData2D_GetSinglePrecisionStorage;
+	PLibMCEnvDiscreteFieldData2D_SetSinglePrecisionStoragePtr m_DiscreteFieldData2D_SetSinglePrecisionStorage;
+	PLibMCEnvDataTableWriteOptions_GetCompressColumnsPtr m_DataTableWriteOptions_GetCompressColumns;
+	PLibMCEnvDataTableWriteOptions_SetCompressColumnsPtr m_DataTableWriteOptions_SetCompressColumns;
 	PLibMCEnvDataTableCSVWriteOptions_GetSeparatorPtr m_DataTableCSVWriteOptions_GetSeparator;
 	PLibMCEnvDataTableCSVWriteOptions_SetSeparatorPtr m_DataTableCSVWriteOptions_SetSeparator;
+	PLibMCEnvDataTableCSVWriteOptions_GetRoundTripDoublesPtr m_DataTableCSVWriteOptions_GetRoundTripDoubles;
+	PLibMCEnvDataTableCSVWriteOptions_SetRoundTripDoublesPtr m_DataTableCSVWriteOptions_SetRoundTripDoubles;
 	PLibMCEnvScatterPlotDataColumn_GetColumnIdentifierPtr m_ScatterPlotDataColumn_GetColumnIdentifier;
 	PLibMCEnvScatterPlotDataColumn_GetScaleFactorPtr m_ScatterPlotDataColumn_GetScaleFactor;
 	PLibMCEnvScatterPlotDataColumn_GetOffsetFactorPtr m_ScatterPlotDataColumn_GetOffsetFactor;
@@ -11174,6 +11314,8 @@ typedef struct {
 	PLibMCEnvWorkingDirectory_RetrieveAllFilesPtr m_WorkingDirectory_RetrieveAllFiles;
 	PLibMCEnvWorkingDirectory_AddBufferedWriterPtr m_WorkingDirectory_AddBufferedWriter;
 	PLibMCEnvWorkingDirectory_AddBufferedWriterTempFilePtr m_WorkingDirectory_AddBufferedWriterTempFile;
+	PLibMCEnvWorkingDirectory_AddAsyncBufferedWriterPtr m_WorkingDirectory_AddAsyncBufferedWriter;
+	PLibMCEnvWorkingDirectory_AddAsyncBufferedWriterTempFilePtr m_WorkingDirectory_AddAsyncBufferedWriterTempFile;
 	PLibMCEnvXMLDocumentAttribute_GetNameSpacePtr m_XMLDocumentAttribute_GetNameSpace;
 	PLibMCEnvXMLDocumentAttribute_GetNamePtr m_XMLDocumentAttribute_GetName;
 	PLibMCEnvXMLDocumentAttribute_GetValuePtr m_XMLDocumentAttribute_GetValue;
@@ -11447,6 +11589,8 @@ typedef struct {
 	PLibMCEnvJournalVariable_GetVariableNamePtr m_JournalVariable_GetVariableName;
 	PLibMCEnvJournalVariable_ComputeDoubleSamplePtr m_JournalVariable_ComputeDoubleSample;
 	PLibMCEnvJournalVariable_ComputeIntegerSamplePtr m_JournalVariable_ComputeIntegerSample;
+	PLibMCEnvJournalVariable_ComputeBucketStatisticsPtr m_JournalVariable_ComputeBucketStatistics;
+	PLibMCEnvJournalVariable_ReceiveRawTimeStreamPtr m_JournalVariable_ReceiveRawTimeStream;
 	PLibMCEnvAlert_GetUUIDPtr m_Alert_GetUUID;
 	PLibMCEnvAlert_IsActivePtr m_Alert_IsActive;
 	PLibMCEnvAlert_GetAlertLevelPtr m_Alert_GetAlertLevel;
@@ -11464,6 +11608,7 @@ typedef struct {
 	PLibMCEnvLogEntryList_GetEntryPtr m_LogEntryList_GetEntry;
 	PLibMCEnvLogEntryList_GetEntryTimePtr m_LogEntryList_GetEntryTime;
 	PLibMCEnvJournalHandler_RetrieveJournalVariablePtr m_JournalHandler_RetrieveJournalVariable;
+	PLibMCEnvJournalHandler_ComputeBucketStatisticsPtr m_JournalHandler_ComputeBucketStatistics;
 	PLibMCEnvJournalHandler_GetStartTimePtr m_JournalHandler_GetStartTime;
 	PLibMCEnvJournalHandler_GetEndTimePtr m_JournalHandler_GetEndTime;
 	PLibMCEnvJournalHandler_GetJournalLifeTimeInMicrosecondsPtr m_JournalHandler_GetJournalLifeTimeInMicroseconds;
@@ -711,6 +711,12 @@ public:
 			case LIBMCENV_ERROR_UNDEFINEDINTERNALSIGNALPHASE: return "UNDEFINEDINTERNALSIGNALPHASE";
 			case LIBMCENV_ERROR_INVALIDREACTIONTIMEOUT: return "INVALIDREACTIONTIMEOUT";
 			case LIBMCENV_ERROR_COULDNOTSETREACTIONTIMEOUT: return "COULDNOTSETREACTIONTIMEOUT";
+			case LIBMCENV_ERROR_INVALIDDATATABLECOLUMNENCODING: return "INVALIDDATATABLECOLUMNENCODING";
+			case LIBMCENV_ERROR_COULDNOTCOMPRESSDATATABLECOLUMN: return "COULDNOTCOMPRESSDATATABLECOLUMN";
+			case LIBMCENV_ERROR_COULDNOTDECOMPRESSDATATABLECOLUMN: return "COULDNOTDECOMPRESSDATATABLECOLUMN";
+			case LIBMCENV_ERROR_EMPTYDISCRETEVALUES: return "EMPTYDISCRETEVALUES";
+			case LIBMCENV_ERROR_DISCRETEVALUEMAPPINGMISMATCH: return "DISCRETEVALUEMAPPINGMISMATCH";
+			case LIBMCENV_ERROR_YUY2PIXELWIDTHMUSTBEEVEN: return "YUY2PIXELWIDTHMUSTBEEVEN";
 		}
 		return "UNKNOWN";
 	}
@@ -969,6 +975,12 @@ public:
 			case LIBMCENV_ERROR_UNDEFINEDINTERNALSIGNALPHASE: return "Undefined internal signal phase.";
 			case LIBMCENV_ERROR_INVALIDREACTIONTIMEOUT: return "Invalid reaction timeout.";
 			case LIBMCENV_ERROR_COULDNOTSETREACTIONTIMEOUT: return "Could not set reaction timeout.";
+			case LIBMCENV_ERROR_INVALIDDATATABLECOLUMNENCODING: return "Invalid datatable column encoding";
+			case LIBMCENV_ERROR_COULDNOTCOMPRESSDATATABLECOLUMN: return "Could not compress datatable column";
+			case LIBMCENV_ERROR_COULDNOTDECOMPRESSDATATABLECOLUMN: return "Could not decompress datatable column";
+			case LIBMCENV_ERROR_EMPTYDISCRETEVALUES: return "Discrete values array is empty";
+			case LIBMCENV_ERROR_DISCRETEVALUEMAPPINGMISMATCH: return "Discrete value mapping has a different size";
+			case LIBMCENV_ERROR_YUY2PIXELWIDTHMUSTBEEVEN: return "YUY2 pixel width must be even for JPEG encoding";
 		}
 		return "unknown error";
 	}
@@ -1412,6 +1424,7 @@ public:
 	inline PImageData CreateImageFromRawRGB24Data(const CInputVector<LibMCEnv_uint8> & RGB24DataBuffer, const LibMCEnv_uint32 nPixelSizeX, const LibMCEnv_uint32 nPixelSizeY, const LibMCEnv_double dDPIValueX, const LibMCEnv_double dDPIValueY, const eImagePixelFormat ePixelFormat);
 	inline PImageData CreateImageFromRawRGBA32Data(const CInputVector<LibMCEnv_uint8> & RGBA32DataBuffer, const LibMCEnv_uint32 nPixelSizeX, const LibMCEnv_uint32 nPixelSizeY, const LibMCEnv_double dDPIValueX, const LibMCEnv_double dDPIValueY, const eImagePixelFormat ePixelFormat);
 	inline PImageData CreateImageFromRawYUY2Data(const CInputVector<LibMCEnv_uint8> & YUY2DataBuffer, const LibMCEnv_uint32 nPixelSizeX, const LibMCEnv_uint32 nPixelSizeY, const LibMCEnv_double dDPIValueX, const LibMCEnv_double dDPIValueY, const eImagePixelFormat ePixelFormat);
+	inline PJPEGImageData CreateJPEGImageFromRawYUY2Data(const CInputVector<LibMCEnv_uint8> & YUY2DataBuffer, const LibMCEnv_uint32 nPixelSizeX, const LibMCEnv_uint32 nPixelSizeY);
 };
 	
 /*************************************************************************************************************************
@@ -1520,6 +1533,8 @@ public:
 	inline void TransformField(const LibMCEnv_double dScale, const LibMCEnv_double dOffset);
 	inline void AddField(classParam<CDiscreteFieldData2D> pOtherField, const LibMCEnv_double dScale, const LibMCEnv_double dOffset);
 	inline PDiscreteFieldData2D Duplicate();
+	inline bool GetSinglePrecisionStorage();
+	inline void SetSinglePrecisionStorage(const bool bSinglePrecision);
 };
 	
 /*************************************************************************************************************************
@@ -1536,6 +1551,8 @@ public:
 	{
 	}
 	
+	inline bool GetCompressColumns();
+	inline void SetCompressColumns(const bool bCompressColumns);
 };
 	
 /*************************************************************************************************************************
@@ -1554,6 +1571,8 @@ public:
 	
 	inline std::string GetSeparator();
 	inline void SetSeparator(const std::string & sSeparator);
+	inline bool GetRoundTripDoubles();
+	inline void SetRoundTripDoubles(const bool bRoundTripDoubles);
 };
 	
 /*************************************************************************************************************************
@@ -2386,6 +2405,8 @@ public:
 	inline PWorkingFileIterator RetrieveAllFiles();
 	inline PWorkingFileWriter AddBufferedWriter(const std::string & sFileName, const LibMCEnv_uint32 nBufferSizeInkB);
 	inline PWorkingFileWriter AddBufferedWriterTempFile(const std::string & sExtension, const LibMCEnv_uint32 nBufferSizeInkB);
+	inline PWorkingFileWriter AddAsyncBufferedWriter(const std::string & sFileName, const LibMCEnv_uint32 nBufferSizeInkB, const bool bSyncOnFinish);
+	inline PWorkingFileWriter AddAsyncBufferedWriterTempFile(const std::string & sExtension, const LibMCEnv_uint32 nBufferSizeInkB, const bool bSyncOnFinish);
 };
 	
 /*************************************************************************************************************************
@@ -2995,6 +3016,8 @@ public:
 	inline std::string GetVariableName();
 	inline LibMCEnv_double ComputeDoubleSample(const LibMCEnv_uint64 nTimeInMicroSeconds);
 	inline LibMCEnv_int64 ComputeIntegerSample(const LibMCEnv_uint64 nTimeInMicroSeconds);
+	inline void ComputeBucketStatistics(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nIntervalInMicroSeconds, const LibMCEnv_uint32 nBucketCount, std::vector<sJournalBucketStatistics> & BucketsBuffer);
+	inline void ReceiveRawTimeStream(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, std::vector<sTimeStreamEntry> & TimeStreamEntriesBuffer);
 };
 	
 /*************************************************************************************************************************
@@ -3076,6 +3099,7 @@ public:
 	}
 	
 	inline PJournalVariable RetrieveJournalVariable(const std::string & sVariableName);
+	inline void ComputeBucketStatistics(const std::string & sVariableNames, const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nIntervalInMicroSeconds, const LibMCEnv_uint32 nBucketCount, std::vector<sJournalBucketStatistics> & BucketsBuffer);
 	inline PDateTime GetStartTime();
 	inline PDateTime GetEndTime();
 	inline LibMCEnv_uint64 GetJournalLifeTimeInMicroseconds();
@@ -3558,6 +3582,7 @@ public:
 		pWrapperTable->m_ImageLoader_CreateImageFromRawRGB24Data = nullptr;
 		pWrapperTable->m_ImageLoader_CreateImageFromRawRGBA32Data = nullptr;
 		pWrapperTable->m_ImageLoader_CreateImageFromRawYUY2Data = nullptr;
+		pWrapperTable->m_ImageLoader_CreateJPEGImageFromRawYUY2Data = nullptr;
 		pWrapperTable->m_VideoStream_GetUUID = nullptr;
 		pWrapperTable->m_VideoStream_GetWidth = nullptr;
 		pWrapperTable->m_VideoStream_GetHeight = nullptr;
@@ -3602,8 +3627,14 @@ public:
 		pWrapperTable->m_DiscreteFieldData2D_TransformField = nullptr;
 		pWrapperTable->m_DiscreteFieldData2D_AddField = nullptr;
 		pWrapperTable->m_DiscreteFieldData2D_Duplicate = nullptr;
+		pWrapperTable->m_DiscreteFieldData2D_GetSinglePrecisionStorage = nullptr;
+		pWrapperTable->m_DiscreteFieldData2D_SetSinglePrecisionStorage = nullptr;
+		pWrapperTable->m_DataTableWriteOptions_GetCompressColumns = nullptr;
+		pWrapperTable->m_DataTableWriteOptions_SetCompressColumns = nullptr;
 		pWrapperTable->m_DataTableCSVWriteOptions_GetSeparator = nullptr;
 		pWrapperTable->m_DataTableCSVWriteOptions_SetSeparator = nullptr;
+		pWrapperTable->m_DataTableCSVWriteOptions_GetRoundTripDoubles = nullptr;
+		pWrapperTable->m_DataTableCSVWriteOptions_SetRoundTripDoubles = nullptr;
 		pWrapperTable->m_ScatterPlotDataColumn_GetColumnIdentifier = nullptr;
 		pWrapperTable->m_ScatterPlotDataColumn_GetScaleFactor = nullptr;
 		pWrapperTable->m_ScatterPlotDataColumn_GetOffsetFactor = nullptr;
@@ -3988,6 +4019,8 @@ public:
 		pWrapperTable->m_WorkingDirectory_RetrieveAllFiles = nullptr;
 		pWrapperTable->m_WorkingDirectory_AddBufferedWriter = nullptr;
 		pWrapperTable->m_WorkingDirectory_AddBufferedWriterTempFile = nullptr;
+		pWrapperTable->m_WorkingDirectory_AddAsyncBufferedWriter = nullptr;
+		pWrapperTable->m_WorkingDirectory_AddAsyncBufferedWriterTempFile = nullptr;
 		pWrapperTable->m_XMLDocumentAttribute_GetNameSpace = nullptr;
 		pWrapperTable->m_XMLDocumentAttribute_GetName = nullptr;
 		pWrapperTable->m_XMLDocumentAttribute_GetValue = nullptr;
@@ -4261,6 +4294,8 @@ public:
 		pWrapperTable->m_JournalVariable_GetVariableName = nullptr;
 		pWrapperTable->m_JournalVariable_ComputeDoubleSample = nullptr;
 		pWrapperTable->m_JournalVariable_ComputeIntegerSample = nullptr;
+		pWrapperTable->m_JournalVariable_ComputeBucketStatistics = nullptr;
+		pWrapperTable->m_JournalVariable_ReceiveRawTimeStream = nullptr;
 		pWrapperTable->m_Alert_GetUUID = nullptr;
 		pWrapperTable->m_Alert_IsActive = nullptr;
 		pWrapperTable->m_Alert_GetAlertLevel = nullptr;
@@ -4278,6 +4313,7 @@ public:
 		pWrapperTable->m_LogEntryList_GetEntry = nullptr;
 		pWrapperTable->m_LogEntryList_GetEntryTime = nullptr;
 		pWrapperTable->m_JournalHandler_RetrieveJournalVariable = nullptr;
+		pWrapperTable->m_JournalHandler_ComputeBucketStatistics = nullptr;
 		pWrapperTable->m_JournalHandler_GetStartTime = nullptr;
 		pWrapperTable->m_JournalHandler_GetEndTime = nullptr;
 		pWrapperTable->m_JournalHandler_GetJournalLifeTimeInMicroseconds = nullptr;
@@ -4988,6 +5024,15 @@ public:
 		if (pWrapperTable->m_ImageLoader_CreateImageFromRawYUY2Data == nullptr)
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_ImageLoader_CreateJPEGImageFromRawYUY2Data = (PLibMCEnvImageLoader_CreateJPEGImageFromRawYUY2DataPtr) GetProcAddress(hLibrary, "libmcenv_imageloader_createjpegimagefromrawyuy2data");
+		#else // _WIN32
+		pWrapperTable->m_ImageLoader_CreateJPEGImageFromRawYUY2Data = (PLibMCEnvImageLoader_CreateJPEGImageFromRawYUY2DataPtr) dlsym(hLibrary, "libmcenv_imageloader_createjpegimagefromrawyuy2data");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ImageLoader_CreateJPEGImageFromRawYUY2Data == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_VideoStream_GetUUID = (PLibMCEnvVideoStream_GetUUIDPtr) GetProcAddress(hLibrary, "libmcenv_videostream_getuuid");
 		#else // _WIN32
@@ -5384,6 +5429,42 @@ public:
 		if (pWrapperTable->m_DiscreteFieldData2D_Duplicate == nullptr)
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_DiscreteFieldData2D_GetSinglePrecisionStorage = (PLibMCEnvDiscreteFieldData2D_GetSinglePrecisionStoragePtr) GetProcAddress(hLibrary, "libmcenv_discretefielddata2d_getsingleprecisionstorage");
+		#else // _WIN32
+		pWrapperTable->m_DiscreteFieldData2D_GetSinglePrecisionStorage = (PLibMCEnvDiscreteFieldData2D_GetSinglePrecisionStoragePtr) dlsym(hLibrary, "libmcenv_discretefielddata2d_getsingleprecisionstorage");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_DiscreteFieldData2D_GetSinglePrecisionStorage == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_DiscreteFieldData2D_SetSinglePrecisionStorage = (PLibMCEnvDiscreteFieldData2D_SetSinglePrecisionStoragePtr) GetProcAddress(hLibrary, "libmcenv_discretefielddata2d_setsingleprecisionstorage");
+		#else // _WIN32
+		pWrapperTable->m_DiscreteFieldData2D_SetSinglePrecisionStorage = (PLibMCEnvDiscreteFieldData2D_SetSinglePrecisionStoragePtr) dlsym(hLibrary, "libmcenv_discretefielddata2d_setsingleprecisionstorage");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_DiscreteFieldData2D_SetSinglePrecisionStorage == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_DataTableWriteOptions_GetCompressColumns = (PLibMCEnvDataTableWriteOptions_GetCompressColumnsPtr) GetProcAddress(hLibrary, "libmcenv_datatablewriteoptions_getcompresscolumns");
+		#else // _WIN32
+		pWrapperTable->m_DataTableWriteOptions_GetCompressColumns = (PLibMCEnvDataTableWriteOptions_GetCompressColumnsPtr) dlsym(hLibrary, "libmcenv_datatablewriteoptions_getcompresscolumns");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_DataTableWriteOptions_GetCompressColumns == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_DataTableWriteOptions_SetCompressColumns = (PLibMCEnvDataTableWriteOptions_SetCompressColumnsPtr) GetProcAddress(hLibrary, "libmcenv_datatablewriteoptions_setcompresscolumns");
+		#else // _WIN32
+		pWrapperTable->m_DataTableWriteOptions_SetCompressColumns = (PLibMCEnvDataTableWriteOptions_SetCompressColumnsPtr) dlsym(hLibrary, "libmcenv_datatablewriteoptions_setcompresscolumns");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_DataTableWriteOptions_SetCompressColumns == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_DataTableCSVWriteOptions_GetSeparator = (PLibMCEnvDataTableCSVWriteOptions_GetSeparatorPtr) GetProcAddress(hLibrary, "libmcenv_datatablecsvwriteoptions_getseparator");
 		#else // _WIN32
@@ -5402,6 +5483,24 @@ public:
 		if (pWrapperTable->m_DataTableCSVWriteOptions_SetSeparator == nullptr)
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_DataTableCSVWriteOptions_GetRoundTripDoubles = (PLibMCEnvDataTableCSVWriteOptions_GetRoundTripDoublesPtr) GetProcAddress(hLibrary, "libmcenv_datatablecsvwriteoptions_getroundtripdoubles");
+		#else // _WIN32
+		pWrapperTable->m_DataTableCSVWriteOptions_GetRoundTripDoubles = (PLibMCEnvDataTableCSVWriteOptions_GetRoundTripDoublesPtr) dlsym(hLibrary, "libmcenv_datatablecsvwriteoptions_getroundtripdoubles");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_DataTableCSVWriteOptions_GetRoundTripDoubles == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_DataTableCSVWriteOptions_SetRoundTripDoubles = (PLibMCEnvDataTableCSVWriteOptions_SetRoundTripDoublesPtr) GetProcAddress(hLibrary, "libmcenv_datatablecsvwriteoptions_setroundtripdoubles");
+		#else // _WIN32
+		pWrapperTable->m_DataTableCSVWriteOptions_SetRoundTripDoubles = (PLibMCEnvDataTableCSVWriteOptions_SetRoundTripDoublesPtr) dlsym(hLibrary, "libmcenv_datatablecsvwriteoptions_setroundtripdoubles");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_DataTableCSVWriteOptions_SetRoundTripDoubles == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_ScatterPlotDataColumn_GetColumnIdentifier = (PLibMCEnvScatterPlotDataColumn_GetColumnIdentifierPtr) GetProcAddress(hLibrary, "libmcenv_scatterplotdatacolumn_getcolumnidentifier");
 		#else // _WIN32
@@ -8858,6 +8957,24 @@ public:
 		if (pWrapperTable->m_WorkingDirectory_AddBufferedWriterTempFile == nullptr)
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_WorkingDirectory_AddAsyncBufferedWriter = (PLibMCEnvWorkingDirectory_AddAsyncBufferedWriterPtr) GetProcAddress(hLibrary, "libmcenv_workingdirectory_addasyncbufferedwriter");
+		#else // _WIN32
+		pWrapperTable->m_WorkingDirectory_AddAsyncBufferedWriter = (PLibMCEnvWorkingDirectory_AddAsyncBufferedWriterPtr) dlsym(hLibrary, "libmcenv_workingdirectory_addasyncbufferedwriter");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_WorkingDirectory_AddAsyncBufferedWriter == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_WorkingDirectory_AddAsyncBufferedWriterTempFile = (PLibMCEnvWorkingDirectory_AddAsyncBufferedWriterTempFilePtr) GetProcAddress(hLibrary, "libmcenv_workingdirectory_addasyncbufferedwritertempfile");
+		#else // _WIN32
+		pWrapperTable->m_WorkingDirectory_AddAsyncBufferedWriterTempFile = (PLibMCEnvWorkingDirectory_AddAsyncBufferedWriterTempFilePtr) dlsym(hLibrary, "libmcenv_workingdirectory_addasyncbufferedwritertempfile");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_WorkingDirectory_AddAsyncBufferedWriterTempFile == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_XMLDocumentAttribute_GetNameSpace = (PLibMCEnvXMLDocumentAttribute_GetNameSpacePtr) GetProcAddress(hLibrary, "libmcenv_xmldocumentattribute_getnamespace");
 		#else // _WIN32
@@ -11315,6 +11432,24 @@ public:
 		if (pWrapperTable->m_JournalVariable_ComputeIntegerSample == nullptr)
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_JournalVariable_ComputeBucketStatistics = (PLibMCEnvJournalVariable_ComputeBucketStatisticsPtr) GetProcAddress(hLibrary, "libmcenv_journalvariable_computebucketstatistics");
+		#else // _WIN32
+		pWrapperTable->m_JournalVariable_ComputeBucketStatistics = (PLibMCEnvJournalVariable_ComputeBucketStatisticsPtr) dlsym(hLibrary, "libmcenv_journalvariable_computebucketstatistics");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_JournalVariable_ComputeBucketStatistics == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_JournalVariable_ReceiveRawTimeStream = (PLibMCEnvJournalVariable_ReceiveRawTimeStreamPtr) GetProcAddress(hLibrary, "libmcenv_journalvariable_receiverawtimestream");
+		#else // _WIN32
+		pWrapperTable->m_JournalVariable_ReceiveRawTimeStream = (PLibMCEnvJournalVariable_ReceiveRawTimeStreamPtr) dlsym(hLibrary, "libmcenv_journalvariable_receiverawtimestream");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_JournalVariable_ReceiveRawTimeStream == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Alert_GetUUID = (PLibMCEnvAlert_GetUUIDPtr) GetProcAddress(hLibrary, "libmcenv_alert_getuuid");
 		#else // _WIN32
@@ -11468,6 +11603,15 @@ public:
 		if (pWrapperTable->m_JournalHandler_RetrieveJournalVariable == nullptr)
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_JournalHandler_ComputeBucketStatistics = (PLibMCEnvJournalHandler_ComputeBucketStatisticsPtr) GetProcAddress(hLibrary, "libmcenv_journalhandler_computebucketstatistics");
+		#else // _WIN32
+		pWrapperTable->m_JournalHandler_ComputeBucketStatistics = (PLibMCEnvJournalHandler_ComputeBucketStatisticsPtr) dlsym(hLibrary, "libmcenv_journalhandler_computebucketstatistics");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_JournalHandler_ComputeBucketStatistics == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_JournalHandler_GetStartTime = (PLibMCEnvJournalHandler_GetStartTimePtr) GetProcAddress(hLibrary, "libmcenv_journalhandler_getstarttime");
 		#else // _WIN32
@@ -13728,6 +13872,10 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_ImageLoader_CreateImageFromRawYUY2Data == nullptr) )
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcenv_imageloader_createjpegimagefromrawyuy2data", (void**)&(pWrapperTable->m_ImageLoader_CreateJPEGImageFromRawYUY2Data));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ImageLoader_CreateJPEGImageFromRawYUY2Data == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcenv_videostream_getuuid", (void**)&(pWrapperTable->m_VideoStream_GetUUID));
 		if ( (eLookupError != 0) || (pWrapperTable->m_VideoStream_GetUUID == nullptr) )
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -13904,6 +14052,22 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_DiscreteFieldData2D_Duplicate == nullptr) )
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcenv_discretefielddata2d_getsingleprecisionstorage", (void**)&(pWrapperTable->m_DiscreteFieldData2D_GetSinglePrecisionStorage));
+		if ( (eLookupError != 0) || (pWrapperTable->m_DiscreteFieldData2D_GetSinglePrecisionStorage == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_discretefielddata2d_setsingleprecisionstorage", (void**)&(pWrapperTable->m_DiscreteFieldData2D_SetSinglePrecisionStorage));
+		if ( (eLookupError != 0) || (pWrapperTable->m_DiscreteFieldData2D_SetSinglePrecisionStorage == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_datatablewriteoptions_getcompresscolumns", (void**)&(pWrapperTable->m_DataTableWriteOptions_GetCompressColumns));
+		if ( (eLookupError != 0) || (pWrapperTable->m_DataTableWriteOptions_GetCompressColumns == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_datatablewriteoptions_setcompresscolumns", (void**)&(pWrapperTable->m_DataTableWriteOptions_SetCompressColumns));
+		if ( (eLookupError != 0) || (pWrapperTable->m_DataTableWriteOptions_SetCompressColumns == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcenv_datatablecsvwriteoptions_getseparator", (void**)&(pWrapperTable->m_DataTableCSVWriteOptions_GetSeparator));
 		if ( (eLookupError != 0) || (pWrapperTable->m_DataTableCSVWriteOptions_GetSeparator == nullptr) )
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -13912,6 +14076,14 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_DataTableCSVWriteOptions_SetSeparator == nullptr) )
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcenv_datatablecsvwriteoptions_getroundtripdoubles", (void**)&(pWrapperTable->m_DataTableCSVWriteOptions_GetRoundTripDoubles));
+		if ( (eLookupError != 0) || (pWrapperTable->m_DataTableCSVWriteOptions_GetRoundTripDoubles == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_datatablecsvwriteoptions_setroundtripdoubles", (void**)&(pWrapperTable->m_DataTableCSVWriteOptions_SetRoundTripDoubles));
+		if ( (eLookupError != 0) || (pWrapperTable->m_DataTableCSVWriteOptions_SetRoundTripDoubles == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcenv_scatterplotdatacolumn_getcolumnidentifier", (void**)&(pWrapperTable->m_ScatterPlotDataColumn_GetColumnIdentifier));
 		if ( (eLookupError != 0) || (pWrapperTable->m_ScatterPlotDataColumn_GetColumnIdentifier == nullptr) )
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -15448,6 +15620,14 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_WorkingDirectory_AddBufferedWriterTempFile == nullptr) )
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcenv_workingdirectory_addasyncbufferedwriter", (void**)&(pWrapperTable->m_WorkingDirectory_AddAsyncBufferedWriter));
+		if ( (eLookupError != 0) || (pWrapperTable->m_WorkingDirectory_AddAsyncBufferedWriter == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_workingdirectory_addasyncbufferedwritertempfile", (void**)&(pWrapperTable->m_WorkingDirectory_AddAsyncBufferedWriterTempFile));
+		if ( (eLookupError != 0) || (pWrapperTable->m_WorkingDirectory_AddAsyncBufferedWriterTempFile == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcenv_xmldocumentattribute_getnamespace", (void**)&(pWrapperTable->m_XMLDocumentAttribute_GetNameSpace));
 		if ( (eLookupError != 0) || (pWrapperTable->m_XMLDocumentAttribute_GetNameSpace == nullptr) )
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -16540,6 +16720,14 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_JournalVariable_ComputeIntegerSample == nullptr) )
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcenv_journalvariable_computebucketstatistics", (void**)&(pWrapperTable->m_JournalVariable_ComputeBucketStatistics));
+		if ( (eLookupError != 0) || (pWrapperTable->m_JournalVariable_ComputeBucketStatistics == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_journalvariable_receiverawtimestream", (void**)&(pWrapperTable->m_JournalVariable_ReceiveRawTimeStream));
+		if ( (eLookupError != 0) || (pWrapperTable->m_JournalVariable_ReceiveRawTimeStream == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcenv_alert_getuuid", (void**)&(pWrapperTable->m_Alert_GetUUID));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Alert_GetUUID == nullptr) )
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -16608,6 +16796,10 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_JournalHandler_RetrieveJournalVariable == nullptr) )
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcenv_journalhandler_computebucketstatistics", (void**)&(pWrapperTable->m_JournalHandler_ComputeBucketStatistics));
+		if ( (eLookupError != 0) || (pWrapperTable->m_JournalHandler_ComputeBucketStatistics == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcenv_journalhandler_getstarttime", (void**)&(pWrapperTable->m_JournalHandler_GetStartTime));
 		if ( (eLookupError != 0) || (pWrapperTable->m_JournalHandler_GetStartTime == nullptr) )
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -18209,6 +18401,24 @@ public:
 		return std::make_shared<CImageData>(m_pWrapper, hImageDataInstance);
 	}
 	
+	/**
+	* CImageLoader::CreateJPEGImageFromRawYUY2Data - Encodes raw YUY2 camera data as JPEG without converting it to RGB first. The chroma channels keep their horizontal subsampling.
+	* @param[in] YUY2DataBuffer - YUY2 data. MUST contain PixelSizeX * PixelSizeY * 2 bytes.
+	* @param[in] nPixelSizeX - Pixel size in X. MUST be positive and even.
+	* @param[in] nPixelSizeY - Pixel size in Y. MUST be positive.
+	* @return JPEG instance with the encoded data.
+	*/
+	PJPEGImageData CImageLoader::CreateJPEGImageFromRawYUY2Data(const CInputVector<LibMCEnv_uint8> & YUY2DataBuffer, const LibMCEnv_uint32 nPixelSizeX, const LibMCEnv_uint32 nPixelSizeY)
+	{
+		LibMCEnvHandle hJPEGImageDataInstance = nullptr;
+		CheckError(m_pWrapper->m_WrapperTable.m_ImageLoader_CreateJPEGImageFromRawYUY2Data(m_pHandle, (LibMCEnv_uint64)YUY2DataBuffer.size(), YUY2DataBuffer.data(), nPixelSizeX, nPixelSizeY, &hJPEGImageDataInstance));
+		
+		if (!hJPEGImageDataInstance) {
+			CheckError(LIBMCENV_ERROR_INVALIDPARAM);
+		}
+		return std::make_shared<CJPEGImageData>(m_pWrapper, hJPEGImageDataInstance);
+	}
+	
 	/**
 	 * Method definitions for class CVideoStream
 	 */
@@ -18759,10 +18969,52 @@ public:
 		return std::make_shared<CDiscreteFieldData2D>(m_pWrapper, hNewField);
 	}
 	
+	/**
+	* CDiscreteFieldData2D::GetSinglePrecisionStorage - Returns if the field values are stored in single precision. Default is false.
+	* @return If true, field values are stored as 32 bit floats.
+	*/
+	bool CDiscreteFieldData2D::GetSinglePrecisionStorage()
+	{
+		bool resultSinglePrecision = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_DiscreteFieldData2D_GetSinglePrecisionStorage(m_pHandle, &resultSinglePrecision));
+		
+		return resultSinglePrecision;
+	}
+	
+	/**
+	* CDiscreteFieldData2D::SetSinglePrecisionStorage - Converts the field values to single or double precision storage. Single precision halves the memory and bandwidth of all field operations. Values are still passed in and out as doubles.
+	* @param[in] bSinglePrecision - If true, field values are stored as 32 bit floats. If false, field values are stored as 64 bit doubles.
+	*/
+	void CDiscreteFieldData2D::SetSinglePrecisionStorage(const bool bSinglePrecision)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_DiscreteFieldData2D_SetSinglePrecisionStorage(m_pHandle, bSinglePrecision));
+	}
+	
 	/**
 	 * Method definitions for class CDataTableWriteOptions
 	 */
 	
+	/**
+	* CDataTableWriteOptions::GetCompressColumns - Returns if the column data is compressed when writing the data table. Default is false.
+	* @return If true, each column is stored LZ4 compressed.
+	*/
+	bool CDataTableWriteOptions::GetCompressColumns()
+	{
+		bool resultCompressColumns = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_DataTableWriteOptions_GetCompressColumns(m_pHandle, &resultCompressColumns));
+		
+		return resultCompressColumns;
+	}
+	
+	/**
+	* CDataTableWriteOptions::SetCompressColumns - Sets if the column data shall be compressed when writing the data table. Compressed data tables can not be read by older versions.
+	* @param[in] bCompressColumns - If true, each column is stored LZ4 compressed. Integer columns are delta encoded before compression.
+	*/
+	void CDataTableWriteOptions::SetCompressColumns(const bool bCompressColumns)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_DataTableWriteOptions_SetCompressColumns(m_pHandle, bCompressColumns));
+	}
+	
 	/**
 	 * Method definitions for class CDataTableCSVWriteOptions
 	 */
@@ -18791,6 +19043,27 @@ public:
 		CheckError(m_pWrapper->m_WrapperTable.m_DataTableCSVWriteOptions_SetSeparator(m_pHandle, sSeparator.c_str()));
 	}
 	
+	/**
+	* CDataTableCSVWriteOptions::GetRoundTripDoubles - Returns if double values are written with full precision. Default is false.
+	* @return If true, double values are written in their shortest form that reads back to the identical value. If false, double values are rounded to three decimal places.
+	*/
+	bool CDataTableCSVWriteOptions::GetRoundTripDoubles()
+	{
+		bool resultRoundTripDoubles = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_DataTableCSVWriteOptions_GetRoundTripDoubles(m_pHandle, &resultRoundTripDoubles));
+		
+		return resultRoundTripDoubles;
+	}
+	
+	/**
+	* CDataTableCSVWriteOptions::SetRoundTripDoubles - Sets if double values are written with full precision.
+	* @param[in] bRoundTripDoubles - If true, double values are written in their shortest form that reads back to the identical value. If false, double values are rounded to three decimal places.
+	*/
+	void CDataTableCSVWriteOptions::SetRoundTripDoubles(const bool bRoundTripDoubles)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_DataTableCSVWriteOptions_SetRoundTripDoubles(m_pHandle, bRoundTripDoubles));
+	}
+	
 	/**
 	 * Method definitions for class CScatterPlotDataColumn
 	 */
@@ -24011,6 +24284,42 @@ public:
 		return std::make_shared<CWorkingFileWriter>(m_pWrapper, hWriterInstance);
 	}
 	
+	/**
+	* CWorkingDirectory::AddAsyncBufferedWriter - Adds an asynchronous buffered writer to the directory. Full buffers are written by a background I/O thread, while new data is collected in a second buffer.
+	* @param[in] sFileName - filename to store to. Can not include any path delimiters or ..
+	* @param[in] nBufferSizeInkB - Size of each of the two memory buffers in kB. MUST be larger than 0 and smaller than 1048576.
+	* @param[in] bSyncOnFinish - If true, finishing the writer blocks until the file content has reached the storage device.
+	* @return Working file writer instance.
+	*/
+	PWorkingFileWriter CWorkingDirectory::AddAsyncBufferedWriter(const std::string & sFileName, const LibMCEnv_uint32 nBufferSizeInkB, const bool bSyncOnFinish)
+	{
+		LibMCEnvHandle hWriterInstance = nullptr;
+		CheckError(m_pWrapper->m_WrapperTable.m_WorkingDirectory_AddAsyncBufferedWriter(m_pHandle, sFileName.c_str(), nBufferSizeInkB, bSyncOnFinish, &hWriterInstance));
+		
+		if (!hWriterInstance) {
+			CheckError(LIBMCENV_ERROR_INVALIDPARAM);
+		}
+		return std::make_shared<CWorkingFileWriter>(m_pWrapper, hWriterInstance);
+	}
+	
+	/**
+	* CWorkingDirectory::AddAsyncBufferedWriterTempFile - Adds an asynchronous buffered writer to the directory with a temporary file name.
+	* @param[in] sExtension - extension of the file to store. MAY be an empty string. MUST only include up to 64 alphanumeric characters.
+	* @param[in] nBufferSizeInkB - Size of each of the two memory buffers in kB. MUST be larger than 0 and smaller than 1048576.
+	* @param[in] bSyncOnFinish - If true, finishing the writer blocks until the file content has reached the storage device.
+	* @return Working file writer instance.
+	*/
+	PWorkingFileWriter CWorkingDirectory::AddAsyncBufferedWriterTempFile(const std::string & sExtension, const LibMCEnv_uint32 nBufferSizeInkB, const bool bSyncOnFinish)
+	{
+		LibMCEnvHandle hWriterInstance = nullptr;
+		CheckError(m_pWrapper->m_WrapperTable.m_WorkingDirectory_AddAsyncBufferedWriterTempFile(m_pHandle, sExtension.c_str(), nBufferSizeInkB, bSyncOnFinish, &hWriterInstance));
+		
+		if (!hWriterInstance) {
+			CheckError(LIBMCENV_ERROR_INVALIDPARAM);
+		}
+		return std::make_shared<CWorkingFileWriter>(m_pWrapper, hWriterInstance);
+	}
+	
 	/**
 	 * Method definitions for class CXMLDocumentAttribute
 	 */
@@ -27647,6 +27956,37 @@ public:
 		return resultSampleValue;
 	}
 	
+	/**
+	* CJournalVariable::ComputeBucketStatistics - Computes minimum, maximum, mean and last value of the recorded entries over consecutive buckets of fixed length.
+	* @param[in] nStartTimeInMicroSeconds - Start time of the first bucket.
+	* @param[in] nIntervalInMicroSeconds - Length of each bucket. MUST be larger than 0.
+	* @param[in] nBucketCount - Number of buckets. MUST be larger than 0.
+	* @param[out] BucketsBuffer - Statistics of each bucket, in increasing order. Buckets without entries have a SampleCount of 0.
+	*/
+	void CJournalVariable::ComputeBucketStatistics(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nIntervalInMicroSeconds, const LibMCEnv_uint32 nBucketCount, std::vector<sJournalBucketStatistics> & BucketsBuffer)
+	{
+		LibMCEnv_uint64 elementsNeededBuckets = 0;
+		LibMCEnv_uint64 elementsWrittenBuckets = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_JournalVariable_ComputeBucketStatistics(m_pHandle, nStartTimeInMicroSeconds, nIntervalInMicroSeconds, nBucketCount, 0, &elementsNeededBuckets, nullptr));
+		BucketsBuffer.resize((size_t) elementsNeededBuckets);
+		CheckError(m_pWrapper->m_WrapperTable.m_JournalVariable_ComputeBucketStatistics(m_pHandle, nStartTimeInMicroSeconds, nIntervalInMicroSeconds, nBucketCount, elementsNeededBuckets, &elementsWrittenBuckets, BucketsBuffer.data()));
+	}
+	
+	/**
+	* CJournalVariable::ReceiveRawTimeStream - Returns all recorded entries of the variable within a time interval. Only available for historic journals.
+	* @param[in] nStartTimeInMicroSeconds - Start of the interval. Entries at this time are included.
+	* @param[in] nEndTimeInMicroSeconds - End of the interval. Entries at this time are excluded.
+	* @param[out] TimeStreamEntriesBuffer - Recorded entries in increasing order of time.
+	*/
+	void CJournalVariable::ReceiveRawTimeStream(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, std::vector<sTimeStreamEntry> & TimeStreamEntriesBuffer)
+	{
+		LibMCEnv_uint64 elementsNeededTimeStreamEntries = 0;
+		LibMCEnv_uint64 elementsWrittenTimeStreamEntries = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_JournalVariable_ReceiveRawTimeStream(m_pHandle, nStartTimeInMicroSeconds, nEndTimeInMicroSeconds, 0, &elementsNeededTimeStreamEntries, nullptr));
+		TimeStreamEntriesBuffer.resize((size_t) elementsNeededTimeStreamEntries);
+		CheckError(m_pWrapper->m_WrapperTable.m_JournalVariable_ReceiveRawTimeStream(m_pHandle, nStartTimeInMicroSeconds, nEndTimeInMicroSeconds, elementsNeededTimeStreamEntries, &elementsWrittenTimeStreamEntries, TimeStreamEntriesBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CAlert
 	 */
@@ -27903,6 +28243,23 @@ public:
 		return std::make_shared<CJournalVariable>(m_pWrapper, hJournalVariable);
 	}
 	
+	/**
+	* CJournalHandler::ComputeBucketStatistics - Computes minimum, maximum, mean and last value of several variables over consecutive buckets of fixed length. The recorded data is read only once for all variables.
+	* @param[in] sVariableNames - Semicolon separated list of variable or alias names. Fails if a variable does not exist or is not numeric.
+	* @param[in] nStartTimeInMicroSeconds - Start time of the first bucket.
+	* @param[in] nIntervalInMicroSeconds - Length of each bucket. MUST be larger than 0.
+	* @param[in] nBucketCount - Number of buckets per variable. MUST be larger than 0.
+	* @param[out] BucketsBuffer - Statistics of all buckets of the first variable in increasing order, followed by the buckets of the next variable. Buckets without entries have a SampleCount of 0.
+	*/
+	void CJournalHandler::ComputeBucketStatistics(const std::string & sVariableNames, const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nIntervalInMicroSeconds, const LibMCEnv_uint32 nBucketCount, std::vector<sJournalBucketStatistics> & BucketsBuffer)
+	{
+		LibMCEnv_uint64 elementsNeededBuckets = 0;
+		LibMCEnv_uint64 elementsWrittenBuckets = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_JournalHandler_ComputeBucketStatistics(m_pHandle, sVariableNames.c_str(), nStartTimeInMicroSeconds, nIntervalInMicroSeconds, nBucketCount, 0, &elementsNeededBuckets, nullptr));
+		BucketsBuffer.resize((size_t) elementsNeededBuckets);
+		CheckError(m_pWrapper->m_WrapperTable.m_JournalHandler_ComputeBucketStatistics(m_pHandle, sVariableNames.c_str(), nStartTimeInMicroSeconds, nIntervalInMicroSeconds, nBucketCount, elementsNeededBuckets, &elementsWrittenBuckets, BucketsBuffer.data()));
+	}
+	
 	/**
 	* CJournalHandler::GetStartTime - Retrieves the reference start time of the journal.
 	* @return DateTime Instance
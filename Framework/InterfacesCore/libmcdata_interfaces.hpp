@@ -801,6 +801,15 @@ public:
 	*/
 	virtual void GetChunkInformation(const LibMCData_uint32 nChunkIndex, LibMCData_uint64 & nStartTimeStamp, LibMCData_uint64 & nEndTimeStamp) = 0;
 
+	/**
+	* IJournalReader::ReadChunkSummaries - Returns the per variable summaries of a chunk. Summaries are stored at write time, older chunks are summarized on the fly.
+	* @param[in] nChunkIndex - Index of the Chunk to read. Fails if chunk index is not found.
+	* @param[in] nSummariesBufferSize - Number of elements in buffer
+	* @param[out] pSummariesNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pSummariesBuffer - JournalChunkVariableSummary buffer of Summary of each variable that is contained in the chunk.
+	*/
+	virtual void ReadChunkSummaries(const LibMCData_uint32 nChunkIndex, LibMCData_uint64 nSummariesBufferSize, LibMCData_uint64* pSummariesNeededCount, LibMCData::sJournalChunkVariableSummary * pSummariesBuffer) = 0;
+
 };
 
 typedef IBaseSharedPtr<IJournalReader> PIJournalReader;
@@ -1765,6 +1774,16 @@ public:
 	*/
 	virtual IBuildJobIterator * ListJobsByStatus(const LibMCData::eBuildJobStatus eStatus) = 0;
 
+	/**
+	* IBuildJobHandler::ListJobsByStatusPage - Retrieves one page of build jobs with a given status, newest first. Pages are addressed by the timestamp and UUID of the last job of the previous page, so that the query only reads the rows it returns.
+	* @param[in] eStatus - Job Status to list.
+	* @param[in] sCursorTimestamp - Timestamp of the last job of the previous page. Empty string for the first page.
+	* @param[in] sCursorUUID - UUID of the last job of the previous page. Ignored if CursorTimestamp is empty.
+	* @param[in] nMaxCount - Maximum number of jobs to return. MUST be positive.
+	* @return Build Job Iterator Instance. Contains less than MaxCount jobs if the last page has been reached.
+	*/
+	virtual IBuildJobIterator * ListJobsByStatusPage(const LibMCData::eBuildJobStatus eStatus, const std::string & sCursorTimestamp, const std::string & sCursorUUID, const LibMCData_uint32 nMaxCount) = 0;
+
 	/**
 	* IBuildJobHandler::ConvertBuildStatusToString - Converts a status enum to a string identifier.
 	* @param[in] eStatus - Status Enum.
@@ -1795,6 +1814,18 @@ public:
 	*/
 	virtual IBuildJobExecutionIterator * ListJobExecutions(const std::string & sMinTimestamp, const std::string & sMaxTimestamp, const std::string & sJournalUUIDFilter) = 0;
 
+	/**
+	* IBuildJobHandler::ListJobExecutionsPage - Retrieves one page of build executions, filtered by time or journal, newest first. Pages are addressed by the start timestamp and UUID of the last execution of the previous page.
+	* @param[in] sMinTimestamp - Minimum Timestamp in ISO8601 UTC format. May be empty for no filter.
+	* @param[in] sMaxTimestamp - Maximum Timestamp in ISO8601 UTC format. May be empty for no filter.
+	* @param[in] sJournalUUIDFilter - UUID of the journal to filter from. Ignored if empty string.
+	* @param[in] sCursorTimestamp - Start timestamp of the last execution of the previous page in ISO8601 UTC format. Empty string for the first page.
+	* @param[in] sCursorUUID - UUID of the last execution of the previous page. Ignored if CursorTimestamp is empty.
+	* @param[in] nMaxCount - Maximum number of executions to return. MUST be positive.
+	* @return Returns the list of execution instances that are queried. Contains less than MaxCount executions if the last page has been reached.
+	*/
+	virtual IBuildJobExecutionIterator * ListJobExecutionsPage(const std::string & sMinTimestamp, const std::string & sMaxTimestamp, const std::string & sJournalUUIDFilter, const std::string & sCursorTimestamp, const std::string & sCursorUUID, const LibMCData_uint32 nMaxCount) = 0;
+
 };
 
 typedef IBaseSharedPtr<IBuildJobHandler> PIBuildJobHandler;
@@ -2089,6 +2089,32 @@ LibMCDataResult libmcdata_journalreader_getchunkinformation(LibMCData_JournalRea
 	}
 }
 
+LibMCDataResult libmcdata_journalreader_readchunksummaries(LibMCData_JournalReader pJournalReader, LibMCData_uint32 nChunkIndex, const LibMCData_uint64 nSummariesBufferSize, LibMCData_uint64* pSummariesNeededCount, sLibMCDataJournalChunkVariableSummary * pSummariesBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pJournalReader;
+
+	try {
+		if ((!pSummariesBuffer) && !(pSummariesNeededCount))
+			throw ELibMCDataInterfaceException (LIBMCDATA_ERROR_INVALIDPARAM);
+		IJournalReader* pIJournalReader = dynamic_cast<IJournalReader*>(pIBaseClass);
+		if (!pIJournalReader)
+			throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDCAST);
+		
+		pIJournalReader->ReadChunkSummaries(nChunkIndex, nSummariesBufferSize, pSummariesNeededCount, pSummariesBuffer);
+
+		return LIBMCDATA_SUCCESS;
+	}
+	catch (ELibMCDataInterfaceException & Exception) {
+		return handleLibMCDataException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 
 /*************************************************************************************************************************
  Class implementation for StorageStream
@@ -6401,6 +6427,40 @@ LibMCDataResult libmcdata_buildjobhandler_listjobsbystatus(LibMCData_BuildJobHan
 	}
 }
 
+LibMCDataResult libmcdata_buildjobhandler_listjobsbystatuspage(LibMCData_BuildJobHandler pBuildJobHandler, eLibMCDataBuildJobStatus eStatus, const char * pCursorTimestamp, const char * pCursorUUID, LibMCData_uint32 nMaxCount, LibMCData_BuildJobIterator * pIteratorInstance)
+{
+	IBase* pIBaseClass = (IBase *)pBuildJobHandler;
+
+	try {
+		if (pCursorTimestamp == nullptr)
+			throw ELibMCDataInterfaceException (LIBMCDATA_ERROR_INVALIDPARAM);
+		if (pCursorUUID == nullptr)
+			throw ELibMCDataInterfaceException (LIBMCDATA_ERROR_INVALIDPARAM);
+		if (pIteratorInstance == nullptr)
+			throw ELibMCDataInterfaceException (LIBMCDATA_ERROR_INVALIDPARAM);
+		std::string sCursorTimestamp(pCursorTimestamp);
+		std::string sCursorUUID(pCursorUUID);
+		IBase* pBaseIteratorInstance(nullptr);
+		IBuildJobHandler* pIBuildJobHandler = dynamic_cast<IBuildJobHandler*>(pIBaseClass);
+		if (!pIBuildJobHandler)
+			throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDCAST);
+		
+		pBaseIteratorInstance = pIBuildJobHandler->ListJobsByStatusPage(eStatus, sCursorTimestamp, sCursorUUID, nMaxCount);
+
+		*pIteratorInstance = (IBase*)(pBaseIteratorInstance);
+		return LIBMCDATA_SUCCESS;
+	}
+	catch (ELibMCDataInterfaceException & Exception) {
+		return handleLibMCDataException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 LibMCDataResult libmcdata_buildjobhandler_convertbuildstatustostring(LibMCData_BuildJobHandler pBuildJobHandler, eLibMCDataBuildJobStatus eStatus, const LibMCData_uint32 nStringBufferSize, LibMCData_uint32* pStringNeededChars, char * pStringBuffer)
 {
 	IBase* pIBaseClass = (IBase *)pBuildJobHandler;
@@ -6546,6 +6606,49 @@ LibMCDataResult libmcdata_buildjobhandler_listjobexecutions(LibMCData_BuildJobHa
 	}
 }
 
+LibMCDataResult libmcdata_buildjobhandler_listjobexecutionspage(LibMCData_BuildJobHandler pBuildJobHandler, const char * pMinTimestamp, const char * pMaxTimestamp, const char * pJournalUUIDFilter, const char * pCursorTimestamp, const char * pCursorUUID, LibMCData_uint32 nMaxCount, LibMCData_BuildJobExecutionIterator * pIteratorInstance)
+{
+	IBase* pIBaseClass = (IBase *)pBuildJobHandler;
+
+	try {
+		if (pMinTimestamp == nullptr)
+			throw ELibMCDataInterfaceException (LIBMCDATA_ERROR_INVALIDPARAM);
+		if (pMaxTimestamp == nullptr)
+			throw ELibMCDataInterfaceException (LIBMCDATA_ERROR_INVALIDPARAM);
+		if (pJournalUUIDFilter == nullptr)
+			throw ELibMCDataInterfaceException (LIBMCDATA_ERROR_INVALIDPARAM);
+		if (pCursorTimestamp == nullptr)
+			throw ELibMCDataInterfaceException (LIBMCDATA_ERROR_INVALIDPARAM);
+		if (pCursorUUID == nullptr)
+			throw ELibMCDataInterfaceException (LIBMCDATA_ERROR_INVALIDPARAM);
+		if (pIteratorInstance == nullptr)
+			throw ELibMCDataInterfaceException (LIBMCDATA_ERROR_INVALIDPARAM);
+		std::string sMinTimestamp(pMinTimestamp);
+		std::string sMaxTimestamp(pMaxTimestamp);
+		std::string sJournalUUIDFilter(pJournalUUIDFilter);
+		std::string sCursorTimestamp(pCursorTimestamp);
+		std::string sCursorUUID(pCursorUUID);
+		IBase* pBaseIteratorInstance(nullptr);
+		IBuildJobHandler* pIBuildJobHandler = dynamic_cast<IBuildJobHandler*>(pIBaseClass);
+		if (!pIBuildJobHandler)
+			throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDCAST);
+		
+		pBaseIteratorInstance = pIBuildJobHandler->ListJobExecutionsPage(sMinTimestamp, sMaxTimestamp, sJournalUUIDFilter, sCursorTimestamp, sCursorUUID, nMaxCount);
+
+		*pIteratorInstance = (IBase*)(pBaseIteratorInstance);
+		return LIBMCDATA_SUCCESS;
+	}
+	catch (ELibMCDataInterfaceException & Exception) {
+		return handleLibMCDataException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 
 /*************************************************************************************************************************
  Class implementation for UserList
@@ -10277,6 +10380,8 @@ LibMCDataResult LibMCData::Impl::LibMCData_GetProcAddress (const char * pProcNam
 		*ppProcAddress = (void*) &libmcdata_journalreader_getchunkcount;
 	if (sProcName == "libmcdata_journalreader_getchunkinformation") 
 		*ppProcAddress = (void*) &libmcdata_journalreader_getchunkinformation;
+	if (sProcName == "libmcdata_journalreader_readchunksummaries") 
+		*ppProcAddress = (void*) &libmcdata_journalreader_readchunksummaries;
 	if (sProcName == "libmcdata_storagestream_getuuid") 
 		*ppProcAddress = (void*) &libmcdata_storagestream_getuuid;
 	if (sProcName == "libmcdata_storagestream_gettimestamp") 
@@ -10519,6 +10624,8 @@ LibMCDataResult LibMCData::Impl::LibMCData_GetProcAddress (const char * pProcNam
 		*ppProcAddress = (void*) &libmcdata_buildjobhandler_findjobofdata;
 	if (sProcName == "libmcdata_buildjobhandler_listjobsbystatus") 
 		*ppProcAddress = (void*) &libmcdata_buildjobhandler_listjobsbystatus;
+	if (sProcName == "libmcdata_buildjobhandler_listjobsbystatuspage") 
+		*ppProcAddress = (void*) &libmcdata_buildjobhandler_listjobsbystatuspage;
 	if (sProcName == "libmcdata_buildjobhandler_convertbuildstatustostring") 
 		*ppProcAddress = (void*) &libmcdata_buildjobhandler_convertbuildstatustostring;
 	if (sProcName == "libmcdata_buildjobhandler_convertstringtobuildstatus") 
@@ -10527,6 +10634,8 @@ LibMCDataResult LibMCData::Impl::LibMCData_GetProcAddress (const char * pProcNam
 		*ppProcAddress = (void*) &libmcdata_buildjobhandler_retrievejobexecution;
 	if (sProcName == "libmcdata_buildjobhandler_listjobexecutions") 
 		*ppProcAddress = (void*) &libmcdata_buildjobhandler_listjobexecutions;
+	if (sProcName == "libmcdata_buildjobhandler_listjobexecutionspage") 
+		*ppProcAddress = (void*) &libmcdata_buildjobhandler_listjobexecutionspage;
 	if (sProcName == "libmcdata_userlist_count") 
 		*ppProcAddress = (void*) &libmcdata_userlist_count;
 	if (sProcName == "libmcdata_userlist_getuserproperties") 
@@ -630,6 +630,19 @@ LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_imageloader_createimagefromrawrgba32da
 */
 LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_imageloader_createimagefromrawyuy2data(LibMCEnv_ImageLoader pImageLoader, LibMCEnv_uint64 nYUY2DataBufferSize, const LibMCEnv_uint8 * pYUY2DataBuffer, LibMCEnv_uint32 nPixelSizeX, LibMCEnv_uint32 nPixelSizeY, LibMCEnv_double dDPIValueX, LibMCEnv_double dDPIValueY, LibMCEnv::eImagePixelFormat ePixelFormat, LibMCEnv_ImageData * pImageDataInstance);
 
+/**
+* Encodes raw YUY2 camera data as JPEG without converting it to RGB first. The chroma channels keep their horizontal subsampling.
+*
+* @param[in] pImageLoader - ImageLoader instance.
+* @param[in] nYUY2DataBufferSize - Number of elements in buffer
+* @param[in] pYUY2DataBuffer - uint8 buffer of YUY2 data. MUST contain PixelSizeX * PixelSizeY * 2 bytes.
+* @param[in] nPixelSizeX - Pixel size in X. MUST be positive and even.
+* @param[in] nPixelSizeY - Pixel size in Y. MUST be positive.
+* @param[out] pJPEGImageDataInstance - JPEG instance with the encoded data.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_imageloader_createjpegimagefromrawyuy2data(LibMCEnv_ImageLoader pImageLoader, LibMCEnv_uint64 nYUY2DataBufferSize, const LibMCEnv_uint8 * pYUY2DataBuffer, LibMCEnv_uint32 nPixelSizeX, LibMCEnv_uint32 nPixelSizeY, LibMCEnv_JPEGImageData * pJPEGImageDataInstance);
+
 /*************************************************************************************************************************
  Class definition for VideoStream
 **************************************************************************************************************************/
@@ -1097,10 +1110,46 @@ LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_discretefielddata2d_addfield(LibMCEnv_
 */
 LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_discretefielddata2d_duplicate(LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, LibMCEnv_DiscreteFieldData2D * pNewField);
 
+/**
+* Returns if the field values are stored in single precision. Default is false.
+*
+* @param[in] pDiscreteFieldData2D - DiscreteFieldData2D instance.
+* @param[out] pSinglePrecision - If true, field values are stored as 32 bit floats.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_discretefielddata2d_getsingleprecisionstorage(LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, bool * pSinglePrecision);
+
+/**
+* Converts the field values to single or double precision storage. Single precision halves the memory and bandwidth of all field operations. Values are still passed in and out as doubles.
+*
+* @param[in] pDiscreteFieldData2D - DiscreteFieldData2D instance.
+* @param[in] bSinglePrecision - If true, field values are stored as 32 bit floats. If false, field values are stored as 64 bit doubles.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_discretefielddata2d_setsingleprecisionstorage(LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, bool bSinglePrecision);
+
 /*************************************************************************************************************************
  Class definition for DataTableWriteOptions
 **************************************************************************************************************************/
 
+/**
+* Returns if the column data is compressed when writing the data table. Default is false.
+*
+* @param[in] pDataTableWriteOptions - DataTableWriteOptions instance.
+* @param[out] pCompressColumns - If true, each column is stored LZ4 compressed.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_datatablewriteoptions_getcompresscolumns(LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, bool * pCompressColumns);
+
+/**
+* Sets if the column data shall be compressed when writing the data table. Compressed data tables can not be read by older versions.
+*
+* @param[in] pDataTableWriteOptions - DataTableWriteOptions instance.
+* @param[in] bCompressColumns - If true, each column is stored LZ4 compressed. Integer columns are delta encoded before compression.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_datatablewriteoptions_setcompresscolumns(LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, bool bCompressColumns);
+
 /*************************************************************************************************************************
  Class definition for DataTableCSVWriteOptions
 **************************************************************************************************************************/
@@ -1125,6 +1174,24 @@ LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_datatablecsvwriteoptions_getseparator(
 */
 LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_datatablecsvwriteoptions_setseparator(LibMCEnv_DataTableCSVWriteOptions pDataTableCSVWriteOptions, const char * pSeparator);
 
+/**
+* Returns if double values are written with full precision. Default is false.
+*
+* @param[in] pDataTableCSVWriteOptions - DataTableCSVWriteOptions instance.
+* @param[out] pRoundTripDoubles - If true, double values are written in their shortest form that reads back to the identical value. If false, double values are rounded to three decimal places.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_datatablecsvwriteoptions_getroundtripdoubles(LibMCEnv_DataTableCSVWriteOptions pDataTableCSVWriteOptions, bool * pRoundTripDoubles);
+
+/**
+* Sets if double values are written with full precision.
+*
+* @param[in] pDataTableCSVWriteOptions - DataTableCSVWriteOptions instance.
+* @param[in] bRoundTripDoubles - If true, double values are written in their shortest form that reads back to the identical value. If false, double values are rounded to three decimal places.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_datatablecsvwriteoptions_setroundtripdoubles(LibMCEnv_DataTableCSVWriteOptions pDataTableCSVWriteOptions, bool bRoundTripDoubles);
+
 /*************************************************************************************************************************
  Class definition for ScatterPlotDataColumn
 **************************************************************************************************************************/
@@ -5153,6 +5220,30 @@ LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_workingdirectory_addbufferedwriter(Lib
 */
 LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_workingdirectory_addbufferedwritertempfile(LibMCEnv_WorkingDirectory pWorkingDirectory, const char * pExtension, LibMCEnv_uint32 nBufferSizeInkB, LibMCEnv_WorkingFileWriter * pWriterInstance);
 
+/**
+* Adds an asynchronous buffered writer to the directory. Full buffers are written by a background I/O thread, while new data is collected in a second buffer.
+*
+* @param[in] pWorkingDirectory - WorkingDirectory instance.
+* @param[in] pFileName - filename to store to. Can not include any path delimiters or ..
+* @param[in] nBufferSizeInkB - Size of each of the two memory buffers in kB. MUST be larger than 0 and smaller than 1048576.
+* @param[in] bSyncOnFinish - If true, finishing the writer blocks until the file content has reached the storage device.
+* @param[out] pWriterInstance - Working file writer instance.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_workingdirectory_addasyncbufferedwriter(LibMCEnv_WorkingDirectory pWorkingDirectory, const char * pFileName, LibMCEnv_uint32 nBufferSizeInkB, bool bSyncOnFinish, LibMCEnv_WorkingFileWriter * pWriterInstance);
+
+/**
+* Adds an asynchronous buffered writer to the directory with a temporary file name.
+*
+* @param[in] pWorkingDirectory - WorkingDirectory instance.
+* @param[in] pExtension - extension of the file to store. MAY be an empty string. MUST only include up to 64 alphanumeric characters.
+* @param[in] nBufferSizeInkB - Size of each of the two memory buffers in kB. MUST be larger than 0 and smaller than 1048576.
+* @param[in] bSyncOnFinish - If true, finishing the writer blocks until the file content has reached the storage device.
+* @param[out] pWriterInstance - Working file writer instance.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_workingdirectory_addasyncbufferedwritertempfile(LibMCEnv_WorkingDirectory pWorkingDirectory, const char * pExtension, LibMCEnv_uint32 nBufferSizeInkB, bool bSyncOnFinish, LibMCEnv_WorkingFileWriter * pWriterInstance);
+
 /*************************************************************************************************************************
  Class definition for XMLDocumentAttribute
 **************************************************************************************************************************/
@@ -8037,6 +8128,33 @@ LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_journalvariable_computedoublesample(Li
 */
 LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_journalvariable_computeintegersample(LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nTimeInMicroSeconds, LibMCEnv_int64 * pSampleValue);
 
+/**
+* Computes minimum, maximum, mean and last value of the recorded entries over consecutive buckets of fixed length.
+*
+* @param[in] pJournalVariable - JournalVariable instance.
+* @param[in] nStartTimeInMicroSeconds - Start time of the first bucket.
+* @param[in] nIntervalInMicroSeconds - Length of each bucket. MUST be larger than 0.
+* @param[in] nBucketCount - Number of buckets. MUST be larger than 0.
+* @param[in] nBucketsBufferSize - Number of elements in buffer
+* @param[out] pBucketsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pBucketsBuffer - JournalBucketStatistics  buffer of Statistics of each bucket, in increasing order. Buckets without entries have a SampleCount of 0.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_journalvariable_computebucketstatistics(LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nIntervalInMicroSeconds, LibMCEnv_uint32 nBucketCount, const LibMCEnv_uint64 nBucketsBufferSize, LibMCEnv_uint64* pBucketsNeededCount, LibMCEnv::sJournalBucketStatistics * pBucketsBuffer);
+
+/**
+* Returns all recorded entries of the variable within a time interval. Only available for historic journals.
+*
+* @param[in] pJournalVariable - JournalVariable instance.
+* @param[in] nStartTimeInMicroSeconds - Start of the interval. Entries at this time are included.
+* @param[in] nEndTimeInMicroSeconds - End of the interval. Entries at this time are excluded.
+* @param[in] nTimeStreamEntriesBufferSize - Number of elements in buffer
+* @param[out] pTimeStreamEntriesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pTimeStreamEntriesBuffer - TimeStreamEntry  buffer of Recorded entries in increasing order of time.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_journalvariable_receiverawtimestream(LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nEndTimeInMicroSeconds, const LibMCEnv_uint64 nTimeStreamEntriesBufferSize, LibMCEnv_uint64* pTimeStreamEntriesNeededCount, LibMCEnv::sTimeStreamEntry * pTimeStreamEntriesBuffer);
+
 /*************************************************************************************************************************
  Class definition for Alert
 **************************************************************************************************************************/
@@ -8230,6 +8348,21 @@ LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_logentrylist_getentrytime(LibMCEnv_Log
 */
 LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_journalhandler_retrievejournalvariable(LibMCEnv_JournalHandler pJournalHandler, const char * pVariableName, LibMCEnv_JournalVariable * pJournalVariable);
 
+/**
+* Computes minimum, maximum, mean and last value of several variables over consecutive buckets of fixed length. The recorded data is read only once for all variables.
+*
+* @param[in] pJournalHandler - JournalHandler instance.
+* @param[in] pVariableNames - Semicolon separated list of variable or alias names. Fails if a variable does not exist or is not numeric.
+* @param[in] nStartTimeInMicroSeconds - Start time of the first bucket.
+* @param[in] nIntervalInMicroSeconds - Length of each bucket. MUST be larger than 0.
+* @param[in] nBucketCount - Number of buckets per variable. MUST be larger than 0.
+* @param[in] nBucketsBufferSize - Number of elements in buffer
+* @param[out] pBucketsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pBucketsBuffer - JournalBucketStatistics  buffer of Statistics of all buckets of the first variable in increasing order, followed by the buckets of the next variable. Buckets without entries have a SampleCount of 0.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_journalhandler_computebucketstatistics(LibMCEnv_JournalHandler pJournalHandler, const char * pVariableNames, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nIntervalInMicroSeconds, LibMCEnv_uint32 nBucketCount, const LibMCEnv_uint64 nBucketsBufferSize, LibMCEnv_uint64* pBucketsNeededCount, LibMCEnv::sJournalBucketStatistics * pBucketsBuffer);
+
 /**
 * Retrieves the reference start time of the journal.
 *
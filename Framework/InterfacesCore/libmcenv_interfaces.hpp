@@ -827,6 +827,16 @@ public:
 	*/
 	virtual IImageData * CreateImageFromRawYUY2Data(const LibMCEnv_uint64 nYUY2DataBufferSize, const LibMCEnv_uint8 * pYUY2DataBuffer, const LibMCEnv_uint32 nPixelSizeX, const LibMCEnv_uint32 nPixelSizeY, const LibMCEnv_double dDPIValueX, const LibMCEnv_double dDPIValueY, const LibMCEnv::eImagePixelFormat ePixelFormat) = 0;
 
+	/**
+	* IImageLoader::CreateJPEGImageFromRawYUY2Data - Encodes raw YUY2 camera data as JPEG without converting it to RGB first. The chroma channels keep their horizontal subsampling.
+	* @param[in] nYUY2DataBufferSize - Number of elements in buffer
+	* @param[in] pYUY2DataBuffer - YUY2 data. MUST contain PixelSizeX * PixelSizeY * 2 bytes.
+	* @param[in] nPixelSizeX - Pixel size in X. MUST be positive and even.
+	* @param[in] nPixelSizeY - Pixel size in Y. MUST be positive.
+	* @return JPEG instance with the encoded data.
+	*/
+	virtual IJPEGImageData * CreateJPEGImageFromRawYUY2Data(const LibMCEnv_uint64 nYUY2DataBufferSize, const LibMCEnv_uint8 * pYUY2DataBuffer, const LibMCEnv_uint32 nPixelSizeX, const LibMCEnv_uint32 nPixelSizeY) = 0;
+
 };
 
 typedef IBaseSharedPtr<IImageLoader> PIImageLoader;
@@ -1186,6 +1196,18 @@ public:
 	*/
 	virtual IDiscreteFieldData2D * Duplicate() = 0;
 
+	/**
+	* IDiscreteFieldData2D::GetSinglePrecisionStorage - Returns if the field values are stored in single precision. Default is false.
+	* @return If true, field values are stored as 32 bit floats.
+	*/
+	virtual bool GetSinglePrecisionStorage() = 0;
+
+	/**
+	* IDiscreteFieldData2D::SetSinglePrecisionStorage - Converts the field values to single or double precision storage. Single precision halves the memory and bandwidth of all field operations. Values are still passed in and out as doubles.
+	* @param[in] bSinglePrecision - If true, field values are stored as 32 bit floats. If false, field values are stored as 64 bit doubles.
+	*/
+	virtual void SetSinglePrecisionStorage(const bool bSinglePrecision) = 0;
+
 };
 
 typedef IBaseSharedPtr<IDiscreteFieldData2D> PIDiscreteFieldData2D;
@@ -1197,6 +1219,18 @@ typedef IBaseSharedPtr<IDiscreteFieldData2D> PIDiscreteFieldData2D;
 
 class IDataTableWriteOptions : public virtual IBase {
 public:
+	/**
+	* IDataTableWriteOptions::GetCompressColumns - Returns if the column data is compressed when writing the data table. Default is false.
+	* @return If true, each column is stored LZ4 compressed.
+	*/
+	virtual bool GetCompressColumns() = 0;
+
+	/**
+	* IDataTableWriteOptions::SetCompressColumns - Sets if the column data shall be compressed when writing the data table. Compressed data tables can not be read by older versions.
+	* @param[in] bCompressColumns - If true, each column is stored LZ4 compressed. Integer columns are delta encoded before compression.
+	*/
+	virtual void SetCompressColumns(const bool bCompressColumns) = 0;
+
 };
 
 typedef IBaseSharedPtr<IDataTableWriteOptions> PIDataTableWriteOptions;
@@ -1220,6 +1254,18 @@ public:
 	*/
 	virtual void SetSeparator(const std::string & sSeparator) = 0;
 
+	/**
+	* IDataTableCSVWriteOptions::GetRoundTripDoubles - Returns if double values are written with full precision. Default is false.
+	* @return If true, double values are written in their shortest form that reads back to the identical value. If false, double values are rounded to three decimal places.
+	*/
+	virtual bool GetRoundTripDoubles() = 0;
+
+	/**
+	* IDataTableCSVWriteOptions::SetRoundTripDoubles - Sets if double values are written with full precision.
+	* @param[in] bRoundTripDoubles - If true, double values are written in their shortest form that reads back to the identical value. If false, double values are rounded to three decimal places.
+	*/
+	virtual void SetRoundTripDoubles(const bool bRoundTripDoubles) = 0;
+
 };
 
 typedef IBaseSharedPtr<IDataTableCSVWriteOptions> PIDataTableCSVWriteOptions;
@@ -4164,6 +4210,24 @@ public:
 	*/
 	virtual IWorkingFileWriter * AddBufferedWriterTempFile(const std::string & sExtension, const LibMCEnv_uint32 nBufferSizeInkB) = 0;
 
+	/**
+	* IWorkingDirectory::AddAsyncBufferedWriter - Adds an asynchronous buffered writer to the directory. Full buffers are written by a background I/O thread, while new data is collected in a second buffer.
+	* @param[in] sFileName - filename to store to. Can not include any path delimiters or ..
+	* @param[in] nBufferSizeInkB - Size of each of the two memory buffers in kB. MUST be larger than 0 and smaller than 1048576.
+	* @param[in] bSyncOnFinish - If true, finishing the writer blocks until the file content has reached the storage device.
+	* @return Working file writer instance.
+	*/
+	virtual IWorkingFileWriter * AddAsyncBufferedWriter(const std::string & sFileName, const LibMCEnv_uint32 nBufferSizeInkB, const bool bSyncOnFinish) = 0;
+
+	/**
+	* IWorkingDirectory::AddAsyncBufferedWriterTempFile - Adds an asynchronous buffered writer to the directory with a temporary file name.
+	* @param[in] sExtension - extension of the file to store. MAY be an empty string. MUST only include up to 64 alphanumeric characters.
+	* @param[in] nBufferSizeInkB - Size of each of the two memory buffers in kB. MUST be larger than 0 and smaller than 1048576.
+	* @param[in] bSyncOnFinish - If true, finishing the writer blocks until the file content has reached the storage device.
+	* @return Working file writer instance.
+	*/
+	virtual IWorkingFileWriter * AddAsyncBufferedWriterTempFile(const std::string & sExtension, const LibMCEnv_uint32 nBufferSizeInkB, const bool bSyncOnFinish) = 0;
+
 };
 
 typedef IBaseSharedPtr<IWorkingDirectory> PIWorkingDirectory;
@@ -6286,6 +6350,27 @@ public:
 	*/
 	virtual LibMCEnv_int64 ComputeIntegerSample(const LibMCEnv_uint64 nTimeInMicroSeconds) = 0;
 
+	/**
+	* IJournalVariable::ComputeBucketStatistics - Computes minimum, maximum, mean and last value of the recorded entries over consecutive buckets of fixed length.
+	* @param[in] nStartTimeInMicroSeconds - Start time of the first bucket.
+	* @param[in] nIntervalInMicroSeconds - Length of each bucket. MUST be larger than 0.
+	* @param[in] nBucketCount - Number of buckets. MUST be larger than 0.
+	* @param[in] nBucketsBufferSize - Number of elements in buffer
+	* @param[out] pBucketsNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pBucketsBuffer - JournalBucketStatistics buffer of Statistics of each bucket, in increasing order. Buckets without entries have a SampleCount of 0.
+	*/
+	virtual void ComputeBucketStatistics(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nIntervalInMicroSeconds, const LibMCEnv_uint32 nBucketCount, LibMCEnv_uint64 nBucketsBufferSize, LibMCEnv_uint64* pBucketsNeededCount, LibMCEnv::sJournalBucketStatistics * pBucketsBuffer) = 0;
+
+	/**
+	* IJournalVariable::ReceiveRawTimeStream - Returns all recorded entries of the variable within a time interval. Only available for historic journals.
+	* @param[in] nStartTimeInMicroSeconds - Start of the interval. Entries at this time are included.
+	* @param[in] nEndTimeInMicroSeconds - End of the interval. Entries at this time are excluded.
+	* @param[in] nTimeStreamEntriesBufferSize - Number of elements in buffer
+	* @param[out] pTimeStreamEntriesNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pTimeStreamEntriesBuffer - TimeStreamEntry buffer of Recorded entries in increasing order of time.
+	*/
+	virtual void ReceiveRawTimeStream(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, LibMCEnv_uint64 nTimeStreamEntriesBufferSize, LibMCEnv_uint64* pTimeStreamEntriesNeededCount, LibMCEnv::sTimeStreamEntry * pTimeStreamEntriesBuffer) = 0;
+
 };
 
 typedef IBaseSharedPtr<IJournalVariable> PIJournalVariable;
@@ -6440,6 +6525,18 @@ public:
 	*/
 	virtual IJournalVariable * RetrieveJournalVariable(const std::string & sVariableName) = 0;
 
+	/**
+	* IJournalHandler::ComputeBucketStatistics - Computes minimum, maximum, mean and last value of several variables over consecutive buckets of fixed length. The recorded data is read only once for all variables.
+	* @param[in] sVariableNames - Semicolon separated list of variable or alias names. Fails if a variable does not exist or is not numeric.
+	* @param[in] nStartTimeInMicroSeconds - Start time of the first bucket.
+	* @param[in] nIntervalInMicroSeconds - Length of each bucket. MUST be larger than 0.
+	* @param[in] nBucketCount - Number of buckets per variable. MUST be larger than 0.
+	* @param[in] nBucketsBufferSize - Number of elements in buffer
+	* @param[out] pBucketsNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pBucketsBuffer - JournalBucketStatistics buffer of Statistics of all buckets of the first variable in increasing order, followed by the buckets of the next variable. Buckets without entries have a SampleCount of 0.
+	*/
+	virtual void ComputeBucketStatistics(const std::string & sVariableNames, const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nIntervalInMicroSeconds, const LibMCEnv_uint32 nBucketCount, LibMCEnv_uint64 nBucketsBufferSize, LibMCEnv_uint64* pBucketsNeededCount, LibMCEnv::sJournalBucketStatistics * pBucketsBuffer) = 0;
+
 	/**
 	* IJournalHandler::GetStartTime - Retrieves the reference start time of the journal.
 	* @return DateTime Instance
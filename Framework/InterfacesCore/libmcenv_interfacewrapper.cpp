@@ -1545,6 +1545,36 @@ LibMCEnvResult libmcenv_imageloader_createimagefromrawyuy2data(LibMCEnv_ImageLoa
 	}
 }
 
+LibMCEnvResult libmcenv_imageloader_createjpegimagefromrawyuy2data(LibMCEnv_ImageLoader pImageLoader, LibMCEnv_uint64 nYUY2DataBufferSize, const LibMCEnv_uint8 * pYUY2DataBuffer, LibMCEnv_uint32 nPixelSizeX, LibMCEnv_uint32 nPixelSizeY, LibMCEnv_JPEGImageData * pJPEGImageDataInstance)
+{
+	IBase* pIBaseClass = (IBase *)pImageLoader;
+
+	try {
+		if ( (!pYUY2DataBuffer) && (nYUY2DataBufferSize>0))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (pJPEGImageDataInstance == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IBase* pBaseJPEGImageDataInstance(nullptr);
+		IImageLoader* pIImageLoader = dynamic_cast<IImageLoader*>(pIBaseClass);
+		if (!pIImageLoader)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pBaseJPEGImageDataInstance = pIImageLoader->CreateJPEGImageFromRawYUY2Data(nYUY2DataBufferSize, pYUY2DataBuffer, nPixelSizeX, nPixelSizeY);
+
+		*pJPEGImageDataInstance = (IBase*)(pBaseJPEGImageDataInstance);
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 
 /*************************************************************************************************************************
  Class implementation for VideoStream
@@ -2774,10 +2804,111 @@ LibMCEnvResult libmcenv_discretefielddata2d_duplicate(LibMCEnv_DiscreteFieldData
 	}
 }
 
+LibMCEnvResult libmcenv_discretefielddata2d_getsingleprecisionstorage(LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, bool * pSinglePrecision)
+{
+	IBase* pIBaseClass = (IBase *)pDiscreteFieldData2D;
+
+	try {
+		if (pSinglePrecision == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDiscreteFieldData2D* pIDiscreteFieldData2D = dynamic_cast<IDiscreteFieldData2D*>(pIBaseClass);
+		if (!pIDiscreteFieldData2D)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pSinglePrecision = pIDiscreteFieldData2D->GetSinglePrecisionStorage();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_discretefielddata2d_setsingleprecisionstorage(LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, bool bSinglePrecision)
+{
+	IBase* pIBaseClass = (IBase *)pDiscreteFieldData2D;
+
+	try {
+		IDiscreteFieldData2D* pIDiscreteFieldData2D = dynamic_cast<IDiscreteFieldData2D*>(pIBaseClass);
+		if (!pIDiscreteFieldData2D)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDiscreteFieldData2D->SetSinglePrecisionStorage(bSinglePrecision);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 
 /*************************************************************************************************************************
  Class implementation for DataTableWriteOptions
 **************************************************************************************************************************/
+LibMCEnvResult libmcenv_datatablewriteoptions_getcompresscolumns(LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, bool * pCompressColumns)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableWriteOptions;
+
+	try {
+		if (pCompressColumns == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableWriteOptions* pIDataTableWriteOptions = dynamic_cast<IDataTableWriteOptions*>(pIBaseClass);
+		if (!pIDataTableWriteOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pCompressColumns = pIDataTableWriteOptions->GetCompressColumns();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablewriteoptions_setcompresscolumns(LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, bool bCompressColumns)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableWriteOptions;
+
+	try {
+		IDataTableWriteOptions* pIDataTableWriteOptions = dynamic_cast<IDataTableWriteOptions*>(pIBaseClass);
+		if (!pIDataTableWriteOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableWriteOptions->SetCompressColumns(bCompressColumns);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+
 
 /*************************************************************************************************************************
  Class implementation for DataTableCSVWriteOptions
@@ -2857,6 +2988,56 @@ LibMCEnvResult libmcenv_datatablecsvwriteoptions_setseparator(LibMCEnv_DataTable
 	}
 }
 
+LibMCEnvResult libmcenv_datatablecsvwriteoptions_getroundtripdoubles(LibMCEnv_DataTableCSVWriteOptions pDataTableCSVWriteOptions, bool * pRoundTripDoubles)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableCSVWriteOptions;
+
+	try {
+		if (pRoundTripDoubles == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableCSVWriteOptions* pIDataTableCSVWriteOptions = dynamic_cast<IDataTableCSVWriteOptions*>(pIBaseClass);
+		if (!pIDataTableCSVWriteOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pRoundTripDoubles = pIDataTableCSVWriteOptions->GetRoundTripDoubles();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablecsvwriteoptions_setroundtripdoubles(LibMCEnv_DataTableCSVWriteOptions pDataTableCSVWriteOptions, bool bRoundTripDoubles)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableCSVWriteOptions;
+
+	try {
+		IDataTableCSVWriteOptions* pIDataTableCSVWriteOptions = dynamic_cast<IDataTableCSVWriteOptions*>(pIBaseClass);
+		if (!pIDataTableCSVWriteOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableCSVWriteOptions->SetRoundTripDoubles(bRoundTripDoubles);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 
 /*************************************************************************************************************************
  Class implementation for ScatterPlotDataColumn
@@ -15049,6 +15230,68 @@ LibMCEnvResult libmcenv_workingdirectory_addbufferedwritertempfile(LibMCEnv_Work
 	}
 }
 
+LibMCEnvResult libmcenv_workingdirectory_addasyncbufferedwriter(LibMCEnv_WorkingDirectory pWorkingDirectory, const char * pFileName, LibMCEnv_uint32 nBufferSizeInkB, bool bSyncOnFinish, LibMCEnv_WorkingFileWriter * pWriterInstance)
+{
+	IBase* pIBaseClass = (IBase *)pWorkingDirectory;
+
+	try {
+		if (pFileName == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (pWriterInstance == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sFileName(pFileName);
+		IBase* pBaseWriterInstance(nullptr);
+		IWorkingDirectory* pIWorkingDirectory = dynamic_cast<IWorkingDirectory*>(pIBaseClass);
+		if (!pIWorkingDirectory)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pBaseWriterInstance = pIWorkingDirectory->AddAsyncBufferedWriter(sFileName, nBufferSizeInkB, bSyncOnFinish);
+
+		*pWriterInstance = (IBase*)(pBaseWriterInstance);
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_workingdirectory_addasyncbufferedwritertempfile(LibMCEnv_WorkingDirectory pWorkingDirectory, const char * pExtension, LibMCEnv_uint32 nBufferSizeInkB, bool bSyncOnFinish, LibMCEnv_WorkingFileWriter * pWriterInstance)
+{
+	IBase* pIBaseClass = (IBase *)pWorkingDirectory;
+
+	try {
+		if (pExtension == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (pWriterInstance == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sExtension(pExtension);
+		IBase* pBaseWriterInstance(nullptr);
+		IWorkingDirectory* pIWorkingDirectory = dynamic_cast<IWorkingDirectory*>(pIBaseClass);
+		if (!pIWorkingDirectory)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pBaseWriterInstance = pIWorkingDirectory->AddAsyncBufferedWriterTempFile(sExtension, nBufferSizeInkB, bSyncOnFinish);
+
+		*pWriterInstance = (IBase*)(pBaseWriterInstance);
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 
 /*************************************************************************************************************************
  Class implementation for XMLDocumentAttribute
@@ -23710,6 +23953,58 @@ LibMCEnvResult libmcenv_journalvariable_computeintegersample(LibMCEnv_JournalVar
 	}
 }
 
+LibMCEnvResult libmcenv_journalvariable_computebucketstatistics(LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nIntervalInMicroSeconds, LibMCEnv_uint32 nBucketCount, const LibMCEnv_uint64 nBucketsBufferSize, LibMCEnv_uint64* pBucketsNeededCount, sLibMCEnvJournalBucketStatistics * pBucketsBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pJournalVariable;
+
+	try {
+		if ((!pBucketsBuffer) && !(pBucketsNeededCount))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IJournalVariable* pIJournalVariable = dynamic_cast<IJournalVariable*>(pIBaseClass);
+		if (!pIJournalVariable)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIJournalVariable->ComputeBucketStatistics(nStartTimeInMicroSeconds, nIntervalInMicroSeconds, nBucketCount, nBucketsBufferSize, pBucketsNeededCount, pBucketsBuffer);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_journalvariable_receiverawtimestream(LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nEndTimeInMicroSeconds, const LibMCEnv_uint64 nTimeStreamEntriesBufferSize, LibMCEnv_uint64* pTimeStreamEntriesNeededCount, sLibMCEnvTimeStreamEntry * pTimeStreamEntriesBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pJournalVariable;
+
+	try {
+		if ((!pTimeStreamEntriesBuffer) && !(pTimeStreamEntriesNeededCount))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IJournalVariable* pIJournalVariable = dynamic_cast<IJournalVariable*>(pIBaseClass);
+		if (!pIJournalVariable)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIJournalVariable->ReceiveRawTimeStream(nStartTimeInMicroSeconds, nEndTimeInMicroSeconds, nTimeStreamEntriesBufferSize, pTimeStreamEntriesNeededCount, pTimeStreamEntriesBuffer);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 
 /*************************************************************************************************************************
  Class implementation for Alert
@@ -24332,6 +24627,35 @@ LibMCEnvResult libmcenv_journalhandler_retrievejournalvariable(LibMCEnv_JournalH
 	}
 }
 
+LibMCEnvResult libmcenv_journalhandler_computebucketstatistics(LibMCEnv_JournalHandler pJournalHandler, const char * pVariableNames, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nIntervalInMicroSeconds, LibMCEnv_uint32 nBucketCount, const LibMCEnv_uint64 nBucketsBufferSize, LibMCEnv_uint64* pBucketsNeededCount, sLibMCEnvJournalBucketStatistics * pBucketsBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pJournalHandler;
+
+	try {
+		if (pVariableNames == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if ((!pBucketsBuffer) && !(pBucketsNeededCount))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sVariableNames(pVariableNames);
+		IJournalHandler* pIJournalHandler = dynamic_cast<IJournalHandler*>(pIBaseClass);
+		if (!pIJournalHandler)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIJournalHandler->ComputeBucketStatistics(sVariableNames, nStartTimeInMicroSeconds, nIntervalInMicroSeconds, nBucketCount, nBucketsBufferSize, pBucketsNeededCount, pBucketsBuffer);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 LibMCEnvResult libmcenv_journalhandler_getstarttime(LibMCEnv_JournalHandler pJournalHandler, LibMCEnv_DateTime * pDateTimeInstance)
 {
 	IBase* pIBaseClass = (IBase *)pJournalHandler;
@@ -32175,6 +32499,8 @@ LibMCEnvResult LibMCEnv::Impl::LibMCEnv_GetProcAddress (const char * pProcName,
 		*ppProcAddress = (void*) &libmcenv_imageloader_createimagefromrawrgba32data;
 	if (sProcName == "libmcenv_imageloader_createimagefromrawyuy2data") 
 		*ppProcAddress = (void*) &libmcenv_imageloader_createimagefromrawyuy2data;
+	if (sProcName == "libmcenv_imageloader_createjpegimagefromrawyuy2data") 
+		*ppProcAddress = (void*) &libmcenv_imageloader_createjpegimagefromrawyuy2data;
 	if (sProcName == "libmcenv_videostream_getuuid") 
 		*ppProcAddress = (void*) &libmcenv_videostream_getuuid;
 	if (sProcName == "libmcenv_videostream_getwidth") 
@@ -32263,10 +32589,22 @@ LibMCEnvResult LibMCEnv::Impl::LibMCEnv_GetProcAddress (const char * pProcName,
 		*ppProcAddress = (void*) &libmcenv_discretefielddata2d_addfield;
 	if (sProcName == "libmcenv_discretefielddata2d_duplicate") 
 		*ppProcAddress = (void*) &libmcenv_discretefielddata2d_duplicate;
+	if (sProcName == "libmcenv_discretefielddata2d_getsingleprecisionstorage") 
+		*ppProcAddress = (void*) &libmcenv_discretefielddata2d_getsingleprecisionstorage;
+	if (sProcName == "libmcenv_discretefielddata2d_setsingleprecisionstorage") 
+		*ppProcAddress = (void*) &libmcenv_discretefielddata2d_setsingleprecisionstorage;
+	if (sProcName == "libmcenv_datatablewriteoptions_getcompresscolumns") 
+		*ppProcAddress = (void*) &libmcenv_datatablewriteoptions_getcompresscolumns;
+	if (sProcName == "libmcenv_datatablewriteoptions_setcompresscolumns") 
+		*ppProcAddress = (void*) &libmcenv_datatablewriteoptions_setcompresscolumns;
 	if (sProcName == "libmcenv_datatablecsvwriteoptions_getseparator") 
 		*ppProcAddress = (void*) &libmcenv_datatablecsvwriteoptions_getseparator;
 	if (sProcName == "libmcenv_datatablecsvwriteoptions_setseparator") 
 		*ppProcAddress = (void*) &libmcenv_datatablecsvwriteoptions_setseparator;
+	if (sProcName == "libmcenv_datatablecsvwriteoptions_getroundtripdoubles") 
+		*ppProcAddress = (void*) &libmcenv_datatablecsvwriteoptions_getroundtripdoubles;
+	if (sProcName == "libmcenv_datatablecsvwriteoptions_setroundtripdoubles") 
+		*ppProcAddress = (void*) &libmcenv_datatablecsvwriteoptions_setroundtripdoubles;
 	if (sProcName == "libmcenv_scatterplotdatacolumn_getcolumnidentifier") 
 		*ppProcAddress = (void*) &libmcenv_scatterplotdatacolumn_getcolumnidentifier;
 	if (sProcName == "libmcenv_scatterplotdatacolumn_getscalefactor") 
@@ -33035,6 +33373,10 @@ LibMCEnvResult LibMCEnv::Impl::LibMCEnv_GetProcAddress (const char * pProcName,
 		*ppProcAddress = (void*) &libmcenv_workingdirectory_addbufferedwriter;
 	if (sProcName == "libmcenv_workingdirectory_addbufferedwritertempfile") 
 		*ppProcAddress = (void*) &libmcenv_workingdirectory_addbufferedwritertempfile;
+	if (sProcName == "libmcenv_workingdirectory_addasyncbufferedwriter") 
+		*ppProcAddress = (void*) &libmcenv_workingdirectory_addasyncbufferedwriter;
+	if (sProcName == "libmcenv_workingdirectory_addasyncbufferedwritertempfile") 
+		*ppProcAddress = (void*) &libmcenv_workingdirectory_addasyncbufferedwritertempfile;
 	if (sProcName == "libmcenv_xmldocumentattribute_getnamespace") 
 		*ppProcAddress = (void*) &libmcenv_xmldocumentattribute_getnamespace;
 	if (sProcName == "libmcenv_xmldocumentattribute_getname") 
@@ -33581,6 +33923,10 @@ LibMCEnvResult LibMCEnv::Impl::LibMCEnv_GetProcAddress (const char * pProcName,
 		*ppProcAddress = (void*) &libmcenv_journalvariable_computedoublesample;
 	if (sProcName == "libmcenv_journalvariable_computeintegersample") 
 		*ppProcAddress = (void*) &libmcenv_journalvariable_computeintegersample;
+	if (sProcName == "libmcenv_journalvariable_computebucketstatistics") 
+		*ppProcAddress = (void*) &libmcenv_journalvariable_computebucketstatistics;
+	if (sProcName == "libmcenv_journalvariable_receiverawtimestream") 
+		*ppProcAddress = (void*) &libmcenv_journalvariable_receiverawtimestream;
 	if (sProcName == "libmcenv_alert_getuuid") 
 		*ppProcAddress = (void*) &libmcenv_alert_getuuid;
 	if (sProcName == "libmcenv_alert_isactive") 
@@ -33615,6 +33961,8 @@ LibMCEnvResult LibMCEnv::Impl::LibMCEnv_GetProcAddress (const char * pProcName,
 		*ppProcAddress = (void*) &libmcenv_logentrylist_getentrytime;
 	if (sProcName == "libmcenv_journalhandler_retrievejournalvariable") 
 		*ppProcAddress = (void*) &libmcenv_journalhandler_retrievejournalvariable;
+	if (sProcName == "libmcenv_journalhandler_computebucketstatistics") 
+		*ppProcAddress = (void*) &libmcenv_journalhandler_computebucketstatistics;
 	if (sProcName == "libmcenv_journalhandler_getstarttime") 
 		*ppProcAddress = (void*) &libmcenv_journalhandler_getstarttime;
 	if (sProcName == "libmcenv_journalhandler_getendtime") 
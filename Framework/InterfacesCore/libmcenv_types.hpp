@@ -346,6 +346,12 @@ typedef void * LibMCEnv_pvoid;
 #define LIBMCENV_ERROR_UNDEFINEDINTERNALSIGNALPHASE 10249 /** Undefined internal signal phase. */
 #define LIBMCENV_ERROR_INVALIDREACTIONTIMEOUT 10250 /** Invalid reaction timeout. */
 #define LIBMCENV_ERROR_COULDNOTSETREACTIONTIMEOUT 10251 /** Could not set reaction timeout. */
+#define LIBMCENV_ERROR_INVALIDDATATABLECOLUMNENCODING 10252 /** Invalid datatable column encoding */
+#define LIBMCENV_ERROR_COULDNOTCOMPRESSDATATABLECOLUMN 10253 /** Could not compress datatable column */
+#define LIBMCENV_ERROR_COULDNOTDECOMPRESSDATATABLECOLUMN 10254 /** Could not decompress datatable column */
+#define LIBMCENV_ERROR_EMPTYDISCRETEVALUES 10255 /** Discrete values array is empty */
+#define LIBMCENV_ERROR_DISCRETEVALUEMAPPINGMISMATCH 10256 /** Discrete value mapping has a different size */
+#define LIBMCENV_ERROR_YUY2PIXELWIDTHMUSTBEEVEN 10257 /** YUY2 pixel width must be even for JPEG encoding */
 
 /*************************************************************************************************************************
  Error strings for LibMCEnv
@@ -604,6 +610,12 @@ inline const char * LIBMCENV_GETERRORSTRING (LibMCEnvResult nErrorCode) {
     case LIBMCENV_ERROR_UNDEFINEDINTERNALSIGNALPHASE: return "Undefined internal signal phase.";
     case LIBMCENV_ERROR_INVALIDREACTIONTIMEOUT: return "Invalid reaction timeout.";
     case LIBMCENV_ERROR_COULDNOTSETREACTIONTIMEOUT: return "Could not set reaction timeout.";
+    case LIBMCENV_ERROR_INVALIDDATATABLECOLUMNENCODING: return "Invalid datatable column encoding";
+    case LIBMCENV_ERROR_COULDNOTCOMPRESSDATATABLECOLUMN: return "Could not compress datatable column";
+    case LIBMCENV_ERROR_COULDNOTDECOMPRESSDATATABLECOLUMN: return "Could not decompress datatable column";
+    case LIBMCENV_ERROR_EMPTYDISCRETEVALUES: return "Discrete values array is empty";
+    case LIBMCENV_ERROR_DISCRETEVALUEMAPPINGMISMATCH: return "Discrete value mapping has a different size";
+    case LIBMCENV_ERROR_YUY2PIXELWIDTHMUSTBEEVEN: return "YUY2 pixel width must be even for JPEG encoding";
     default: return "unknown error";
   }
 }
@@ -915,6 +927,15 @@ namespace LibMCEnv {
       LibMCEnv_double m_Value;
   } sTimeStreamEntry;
   
+  typedef struct sJournalBucketStatistics {
+      LibMCEnv_uint64 m_StartTimeInMicroSeconds;
+      LibMCEnv_uint32 m_SampleCount;
+      LibMCEnv_double m_MinValue;
+      LibMCEnv_double m_MaxValue;
+      LibMCEnv_double m_MeanValue;
+      LibMCEnv_double m_LastValue;
+  } sJournalBucketStatistics;
+  
   #pragma pack ()
   
 } // namespace LibMCEnv;
@@ -949,5 +970,6 @@ typedef LibMCEnv::sHatch2DSubInterpolationData sLibMCEnvHatch2DSubInterpolationD
 typedef LibMCEnv::sModelDataTransform sLibMCEnvModelDataTransform;
 typedef LibMCEnv::sColorRGB sLibMCEnvColorRGB;
 typedef LibMCEnv::sTimeStreamEntry sLibMCEnvTimeStreamEntry;
+typedef LibMCEnv::sJournalBucketStatistics sLibMCEnvJournalBucketStatistics;
 
 #endif // __LIBMCENV_TYPES_HEADER_CPP
@@ -37,6 +37,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #endif
 
 #define AMC_API_HTTP_SUCCESS 200
+#define AMC_API_HTTP_NOTMODIFIED 304
 #define AMC_API_HTTP_BADREQUEST 400
 #define AMC_API_HTTP_FORBIDDEN 403
 #define AMC_API_HTTP_NOTFOUND 404
@@ -56,6 +57,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AMC_API_PROTOCOL_EXTERNAL "com.autodesk.machinecontrol.external"
 
 #define AMC_API_CONTENTTYPE "application/json"
+#define AMC_API_CONTENTTYPE_BINARY "application/binary"
 
 #define AMC_API_KEY_PROTOCOL "protocol"
 #define AMC_API_KEY_VERSION "version"
@@ -96,6 +98,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AMC_API_KEY_UPLOAD_BUILDJOBUUID "uuid"
 #define AMC_API_KEY_UPLOAD_BUILDJOBSTORAGESTREAM "storagestream"
 #define AMC_API_KEY_UPLOAD_ITEMBUILDTHUMBNAIL "thumbnail"
+#define AMC_API_KEY_UPLOAD_BUILDJOBMAXCOUNT "maxcount"
+#define AMC_API_KEY_UPLOAD_BUILDJOBCURSORTIMESTAMP "cursortimestamp"
+#define AMC_API_KEY_UPLOAD_BUILDJOBCURSORUUID "cursoruuid"
+#define AMC_API_KEY_UPLOAD_BUILDJOBNEXTCURSORTIMESTAMP "nextcursortimestamp"
+#define AMC_API_KEY_UPLOAD_BUILDJOBNEXTCURSORUUID "nextcursoruuid"
 #define AMC_API_KEY_UPLOAD_PARTARRAY "parts"
 #define AMC_API_KEY_UPLOAD_BUILDPARTUUID "uuid"
 #define AMC_API_KEY_UPLOAD_BUILDPARTNAME "name"
@@ -150,10 +157,20 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AMC_API_KEY_UI_MODULES "modules"
 #define AMC_API_KEY_UI_MODULENAME "name"
 #define AMC_API_KEY_UI_MODULEUUID "uuid"
+#define AMC_API_KEY_UI_MODULEVERSION "version"
+#define AMC_API_KEY_UI_STATEVERSION "stateversion"
+#define AMC_API_KEY_UI_SINCEVERSION "sinceversion"
+#define AMC_API_KEY_UI_ISDELTA "isdelta"
 #define AMC_API_KEY_UI_MODULETYPE "type"
 #define AMC_API_KEY_UI_BUILDUUID "builduuid"
 #define AMC_API_KEY_UI_EXECUTIONUUID "executionuuid"
 #define AMC_API_KEY_UI_SCATTERPLOTUUID "scatterplotuuid"
+#define AMC_API_KEY_UI_POINTCHANNELFORMAT "format"
+#define AMC_API_KEY_UI_POINTCHANNELCOMPRESSION "compression"
+#define AMC_API_KEY_UI_CHARTDOWNSAMPLING "downsampling"
+#define AMC_API_KEY_UI_CHARTSTARTTIME "starttime"
+#define AMC_API_KEY_UI_CHARTENDTIME "endtime"
+#define AMC_API_KEY_UI_CHARTWIDTH "width"
 #define AMC_API_KEY_UI_CURRENTLAYER "currentlayer"
 #define AMC_API_KEY_UI_CURRENTLAYERCOUNTER "currentlayercounter"
 #define AMC_API_KEY_UI_LAYERCOUNT "layercount"
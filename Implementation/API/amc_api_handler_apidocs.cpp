@@ -85,9 +85,35 @@ PAPIResponse CAPIHandler_APIDocs::handleRequest(const std::string& sURI, const e
 	std::string sSubURI = AMCCommon::CUtils::removeLeadingPathDelimiter(sURI.substr(4));
 
 	if (requestType == eAPIRequestType::rtGet) {
-		auto iIterator = m_FilesToServe.find(AMCCommon::CUtils::toLowerString (sSubURI));
+		std::string sNameLowerCase = AMCCommon::CUtils::toLowerString (sSubURI);
+
+		std::lock_guard<std::mutex> lockGuard(m_FilesMutex);
+
+		auto iIterator = m_FilesToServe.find(sNameLowerCase);
 		if (iIterator != m_FilesToServe.end())
 			return iIterator->second;
+
+		auto iNameIterator = m_EntryNames.find(sNameLowerCase);
+		if (iNameIterator != m_EntryNames.end()) {
+			std::string sNameOriginal = iNameIterator->second;
+			auto pEntry = m_pDocsPackage->findEntryByName(sNameOriginal, true);
+
+			auto apiResponse = std::make_shared<CAPIFixedBufferResponse>(pEntry->getContentType());
+
+			if (sNameLowerCase == "amcf_openapi.json") {
+
+				std::string sOpenAPIContent = m_pDocsPackage->readEntryUTF8String(sNameOriginal);
+				patchAPIJSON (sOpenAPIContent, apiResponse->getBuffer());
+
+			}
+			else {
+				m_pDocsPackage->readEntry(sNameOriginal, apiResponse->getBuffer());
+			}
+
+			m_FilesToServe.insert(std::make_pair(sNameLowerCase, apiResponse));
+
+			return apiResponse;
+		}
 	}
 
 	return nullptr;
@@ -98,27 +124,18 @@ void CAPIHandler_APIDocs::LoadAPIDocsPackage(PResourcePackage pResourcePackage)
 	if (pResourcePackage.get() == nullptr)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 
+	std::lock_guard<std::mutex> lockGuard(m_FilesMutex);
+
+	m_pDocsPackage = pResourcePackage;
+	m_EntryNames.clear();
+	m_FilesToServe.clear();
+
 	size_t nCount = pResourcePackage->getEntryCount();
 	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
 		auto pEntry = pResourcePackage->getEntry(nIndex);
 
 		std::string sNameOriginal = pEntry->getName();
-		std::string sNameLowerCase = AMCCommon::CUtils::toLowerString(sNameOriginal);
-
-		auto apiResponse = std::make_shared<CAPIFixedBufferResponse>(pEntry->getContentType());
-
-		if (sNameLowerCase == "amcf_openapi.json") {
-
-			std::string sOpenAPIContent = pResourcePackage->readEntryUTF8String(sNameOriginal);
-			patchAPIJSON (sOpenAPIContent, apiResponse->getBuffer());
-		
-		}
-		else {
-			pResourcePackage->readEntry(sNameOriginal, apiResponse->getBuffer());
-		}
-
-		m_FilesToServe.insert(std::make_pair(sNameLowerCase, apiResponse));
-
+		m_EntryNames.insert(std::make_pair(AMCCommon::CUtils::toLowerString(sNameOriginal), sNameOriginal));
 	}
 
 
@@ -126,7 +143,10 @@ void CAPIHandler_APIDocs::LoadAPIDocsPackage(PResourcePackage pResourcePackage)
 
 void CAPIHandler_APIDocs::setCustomDocumentationJSON(const std::string & sCustomDocumentationJSON)
 {
+	std::lock_guard<std::mutex> lockGuard(m_FilesMutex);
+
 	m_sCustomDocumentationJSON = sCustomDocumentationJSON;
+	m_FilesToServe.erase("amcf_openapi.json");
 }
 
 
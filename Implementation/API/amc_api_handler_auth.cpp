@@ -165,7 +165,10 @@ void CAPIHandler_Auth::handleNewSessionRequest(const uint8_t* pBodyData, const s
 		if (sUserRoleIdentifier.empty())
 			sUserRoleIdentifier = m_pAccessControl->getDefaultRole()->getIdentifier();
 
-		m_pSessionHandler->setUserDetailsForSession(pAuth->getSessionUUID(), sUserName, sHashedPassword, sUserUUID, sUserDescription, sUserRoleIdentifier, sUserLanguageIdentifier);
+		// An unknown role identifier is rejected when the session is authorized.
+		auto pUserRole = m_pAccessControl->findRole(sUserRoleIdentifier, false);
+
+		m_pSessionHandler->setUserDetailsForSession(pAuth->getSessionUUID(), sUserName, sHashedPassword, sUserUUID, sUserDescription, sUserRoleIdentifier, sUserLanguageIdentifier, pUserRole);
 	}
 	else {
 		// If user has not been found, then generate a repeatable salt to not show that the user is not existing.
@@ -242,7 +242,7 @@ void CAPIHandler_Build::handleToolpathRequest(CJSONWriter& writer, const uint8_t
 }
 
 
-void CAPIHandler_Build::handleListJobsRequest(CJSONWriter& writer, PAPIAuth pAuth, const std::string& sStatusToQuery)
+void CAPIHandler_Build::handleListJobsRequest(CJSONWriter& writer, PAPIAuth pAuth, const std::string& sStatusToQuery, const std::string& sMaxCount, const std::string& sCursorTimestamp, const std::string& sCursorUUID)
 {	
 	if (pAuth.get() == nullptr)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
@@ -258,12 +258,34 @@ void CAPIHandler_Build::handleListJobsRequest(CJSONWriter& writer, PAPIAuth pAut
 
 	auto pDataModel = m_pSystemState->getDataModelInstance();
 	auto pBuildJobHandler = pDataModel->CreateBuildJobHandler();
-	auto pBuildJobIterator = pBuildJobHandler->ListJobsByStatus(buildStatus);
+
+	// Without a max count, all jobs are returned in one response.
+	bool bIsPaged = !sMaxCount.empty();
+	uint32_t nMaxCount = 0;
+	LibMCData::PBuildJobIterator pBuildJobIterator;
+	if (bIsPaged) {
+		int64_t nMaxCountValue = AMCCommon::CUtils::stringToInteger(sMaxCount);
+		if ((nMaxCountValue <= 0) || (nMaxCountValue > UINT32_MAX))
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM, "invalid build job max count: " + sMaxCount);
+		nMaxCount = (uint32_t)nMaxCountValue;
+
+		pBuildJobIterator = pBuildJobHandler->ListJobsByStatusPage(buildStatus, sCursorTimestamp, sCursorUUID, nMaxCount);
+	}
+	else {
+		pBuildJobIterator = pBuildJobHandler->ListJobsByStatus(buildStatus);
+	}
 
 	CJSONWriterArray jobJSONArray(writer);
 
+	uint32_t nJobCount = 0;
+	std::string sLastTimestamp;
+	std::string sLastUUID;
+
 	while (pBuildJobIterator->MoveNext()) {
 		auto pBuildJob = pBuildJobIterator->GetCurrentJob();
+		nJobCount++;
+		sLastUUID = pBuildJob->GetUUID();
+		sLastTimestamp = pBuildJob->GetTimeStamp();
 
 		LibMCData::eBuildJobStatus buildStatus = pBuildJob->GetStatus();
 
@@ -287,6 +309,12 @@ void CAPIHandler_Build::handleListJobsRequest(CJSONWriter& writer, PAPIAuth pAut
 	}
 
 	writer.addArray(AMC_API_KEY_UPLOAD_BUILDJOBARRAY, jobJSONArray);
+
+	// A full page might be followed by further jobs
+	if (bIsPaged && (nJobCount == nMaxCount)) {
+		writer.addString(AMC_API_KEY_UPLOAD_BUILDJOBNEXTCURSORTIMESTAMP, sLastTimestamp);
+		writer.addString(AMC_API_KEY_UPLOAD_BUILDJOBNEXTCURSORUUID, sLastUUID);
+	}
 }
 
 void CAPIHandler_Build::handleListBuildDataRequest(CJSONWriter& writer, PAPIAuth pAuth, const std::string& buildUUID)
@@ -497,7 +525,10 @@ PAPIResponse CAPIHandler_Build::handleRequest(const std::string& sURI, const eAP
 	switch (buildType) {
 	case APIHandler_BuildType::btListJobs: {
 		std::string sStatus = pFormFields.getRequestParameter (AMC_API_KEY_UPLOAD_BUILDJOBSTATUS, false);
-		handleListJobsRequest(writer, pAuth, sStatus);
+		std::string sMaxCount = pFormFields.getRequestParameter(AMC_API_KEY_UPLOAD_BUILDJOBMAXCOUNT, false);
+		std::string sCursorTimestamp = pFormFields.getRequestParameter(AMC_API_KEY_UPLOAD_BUILDJOBCURSORTIMESTAMP, false);
+		std::string sCursorUUID = pFormFields.getRequestParameter(AMC_API_KEY_UPLOAD_BUILDJOBCURSORUUID, false);
+		handleListJobsRequest(writer, pAuth, sStatus, sMaxCount, sCursorTimestamp, sCursorUUID);
 		break;
 	}
 	case APIHandler_BuildType::btToolpath:
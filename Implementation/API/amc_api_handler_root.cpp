@@ -73,9 +73,24 @@ PAPIResponse CAPIHandler_Root::handleRequest(const std::string& sURI, const eAPI
 {
 
 	if (requestType == eAPIRequestType::rtGet) {
-		auto iIterator = m_FilesToServe.find(AMCCommon::CUtils::toLowerString (sURI));
+		std::string sLowerCaseURI = AMCCommon::CUtils::toLowerString (sURI);
+
+		std::lock_guard<std::mutex> lockGuard(m_FilesMutex);
+
+		auto iIterator = m_FilesToServe.find(sLowerCaseURI);
 		if (iIterator != m_FilesToServe.end())
 			return iIterator->second;
+
+		auto iNameIterator = m_EntryNames.find(sLowerCaseURI);
+		if (iNameIterator != m_EntryNames.end()) {
+			auto pEntry = m_pClientPackage->findEntryByName(iNameIterator->second, true);
+
+			auto apiResponse = std::make_shared<CAPIFixedBufferResponse>(pEntry->getContentType());
+			m_pClientPackage->readEntry(pEntry->getName(), apiResponse->getBuffer());
+			m_FilesToServe.insert(std::make_pair(sLowerCaseURI, apiResponse));
+
+			return apiResponse;
+		}
 	}
 
 	return nullptr;
@@ -86,13 +101,16 @@ void CAPIHandler_Root::LoadClientPackage(PResourcePackage pResourcePackage)
 	if (pResourcePackage.get() == nullptr)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 
+	std::lock_guard<std::mutex> lockGuard(m_FilesMutex);
+
+	m_pClientPackage = pResourcePackage;
+	m_EntryNames.clear();
+	m_FilesToServe.clear();
+
 	size_t nCount = pResourcePackage->getEntryCount();
 	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
 		auto pEntry = pResourcePackage->getEntry(nIndex);
-
-		auto apiResponse = std::make_shared<CAPIFixedBufferResponse>(pEntry->getContentType());
-		pResourcePackage->readEntry(pEntry->getName (), apiResponse->getBuffer());
-		m_FilesToServe.insert(std::make_pair(AMCCommon::CUtils::toLowerString (pEntry->getName ()), apiResponse));
+		m_EntryNames.insert(std::make_pair(AMCCommon::CUtils::toLowerString (pEntry->getName ()), pEntry->getName ()));
 	}
 
 
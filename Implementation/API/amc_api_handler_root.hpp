@@ -37,12 +37,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <string>
 #include <map>
+#include <mutex>
 
 namespace AMC {
 
 	class CAPIHandler_Root : public CAPIHandler {
 	private:
 
+		// Entries are unzipped on their first request and cached afterwards.
+		std::mutex m_FilesMutex;
+		PResourcePackage m_pClientPackage;
+		std::map<std::string, std::string> m_EntryNames;
 		std::map<std::string, PAPIResponse> m_FilesToServe;
 			
 	public:
@@ -44,7 +44,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "amc_meshentity.hpp"
 #include "amc_meshhandler.hpp"
 #include "amc_dataserieshandler.hpp"
+#include "amc_dataseriesdownsampler.hpp"
+#include "amc_constants.hpp"
 #include "amc_scatterplot.hpp"
+#include "amc_scatterplotchannelencoder.hpp"
 #include "amc_toolpathhandler.hpp"
 
 #include "libmc_interfaceexception.hpp"
@@ -255,8 +258,8 @@ APIHandler_UIType CAPIHandler_UI::parseRequest(const std::string& sURI, const eA
 			}
 		}
 
-		if (sParameterString.length() == 60) {
-			if (sParameterString.substr(0, 18) == "/pointchanneldata/") {
+		if (sParameterString.length() > 55) {
+			if ((sParameterString.substr(0, 18) == "/pointchanneldata/") && (sParameterString.at(54) == '/')) {
 				sParameterUUID = AMCCommon::CUtils::normalizeUUIDString(sParameterString.substr(18, 36));
 				sAdditionalParameter = sParameterString.substr(55);
 				return APIHandler_UIType::utPointChannel;
@@ -337,12 +340,26 @@ void CAPIHandler_UI::handleConfigurationRequest(CJSONWriter& writer, PAPIAuth pA
 	m_pSystemState->uiHandler()->writeLegacyConfigurationToJSON(writer);
 }
 
-void CAPIHandler_UI::handleStateRequest(CJSONWriter& writer, PAPIAuth pAuth)
+bool CAPIHandler_UI::handleStateRequest(CJSONWriter& writer, CAPIFormFields& pFormFields, PAPIAuth pAuth)
 {
 	if (pAuth.get() == nullptr)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 
-	m_pSystemState->uiHandler()->writeLegacyStateToJSON(writer, pAuth->getLegacyParameterHandler (true));
+	CUIStateVersionTracker* pVersionTracker = nullptr;
+	auto pFrontendState = pAuth->getFrontendState();
+	if (pFrontendState.get() != nullptr)
+		pVersionTracker = pFrontendState->getLegacyStateVersionTracker().get();
+
+	uint64_t nSinceVersion = 0;
+	std::string sSinceVersion = pFormFields.getRequestParameter(AMC_API_KEY_UI_SINCEVERSION, false);
+	if (!sSinceVersion.empty()) {
+		int64_t nValue = AMCCommon::CUtils::stringToInteger(sSinceVersion);
+		if (nValue < 0)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM, "Invalid state version: " + sSinceVersion);
+		nSinceVersion = (uint64_t)nValue;
+	}
+
+	return m_pSystemState->uiHandler()->writeLegacyStateToJSON(writer, pAuth->getLegacyParameterHandler (true), pVersionTracker, nSinceVersion);
 }
 
 
@@ -413,7 +430,7 @@ PAPIResponse CAPIHandler_UI::handleDownloadRequest(const std::string& sParameter
 }
 
 
-PAPIResponse CAPIHandler_UI::handleChartRequest(const std::string& sParameterUUID, PAPIAuth pAuth)
+PAPIResponse CAPIHandler_UI::handleChartRequest(const std::string& sParameterUUID, CAPIFormFields& pFormFields, PAPIAuth pAuth)
 {
 	if (pAuth.get() == nullptr)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
@@ -424,6 +441,53 @@ PAPIResponse CAPIHandler_UI::handleChartRequest(const std::string& sParameterUUI
 	if (pDataSeries.get() != nullptr) {
 
 		auto apiResponse = std::make_shared<CAPIFixedFloatBufferResponse>("application/binary");
+
+		std::string sDownsampling = pFormFields.getRequestParameter(AMC_API_KEY_UI_CHARTDOWNSAMPLING, false);
+		auto downsamplingMode = CDataSeriesDownsampler::stringToMode(AMCCommon::CUtils::toLowerString(sDownsampling));
+
+		if (downsamplingMode != eDataSeriesDownsamplingMode::dmNone) {
+
+			// The client asks for a viewport of its pixel width, by default the whole series
+			int64_t nWidth = AMCCommon::CUtils::stringToInteger(pFormFields.getRequestParameter(AMC_API_KEY_UI_CHARTWIDTH, true));
+			if ((nWidth <= 0) || (nWidth > DATASERIES_MAXDOWNSAMPLINGWIDTH))
+				throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDDATASERIESDOWNSAMPLINGWIDTH, std::to_string(nWidth));
+
+			uint64_t nStartTime = 0;
+			uint64_t nEndTime = UINT64_MAX;
+			if (!pDataSeries->isEmpty()) {
+				nStartTime = pDataSeries->getMinimum();
+				nEndTime = pDataSeries->getMaximum();
+			}
+
+			if (pFormFields.hasRequestParameter(AMC_API_KEY_UI_CHARTSTARTTIME)) {
+				int64_t nValue = AMCCommon::CUtils::stringToInteger(pFormFields.getRequestParameter(AMC_API_KEY_UI_CHARTSTARTTIME, true));
+				if (nValue < 0)
+					throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDDATASERIESTIMERANGE, std::to_string(nValue));
+				nStartTime = (uint64_t)nValue;
+			}
+
+			if (pFormFields.hasRequestParameter(AMC_API_KEY_UI_CHARTENDTIME)) {
+				int64_t nValue = AMCCommon::CUtils::stringToInteger(pFormFields.getRequestParameter(AMC_API_KEY_UI_CHARTENDTIME, true));
+				if (nValue < 0)
+					throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDDATASERIESTIMERANGE, std::to_string(nValue));
+				nEndTime = (uint64_t)nValue;
+			}
+
+			if (nEndTime < nStartTime)
+				throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDDATASERIESTIMERANGE);
+
+			auto pEntries = pDataSeries->getDownsampledEntries(downsamplingMode, nStartTime, nEndTime, (uint32_t)nWidth);
+			size_t nEntryCount = pEntries->size();
+			apiResponse->resizeTo(nEntryCount * 2);
+
+			for (auto & entry : *pEntries) {
+				apiResponse->addFloat((float)(entry.m_nTimeStampInMicroSeconds * 0.000001));
+				apiResponse->addFloat((float)entry.m_dValue);
+			}
+
+			return apiResponse;
+		}
+
 		auto & entries = pDataSeries->getEntries();
 
 		size_t nEntryCount = entries.size();
@@ -535,27 +599,41 @@ void CAPIHandler_UI::handlePointChannelDataRequest(CJSONWriter& writer, const st
 	auto pToolpathHandler = m_pSystemState->getToolpathHandlerInstance();
 	auto pScatterplot = pToolpathHandler->restoreScatterplot(sParameterUUID, false);
 
-	auto & channelEntries = pScatterplot->getChannelEntries();
+	uint32_t nChannelID = 0;
+	if (pScatterplot->findChannel(sAdditionalParameter, nChannelID)) {
 
-	auto channelIt = channelEntries.find(sAdditionalParameter);
-	if (channelIt != channelEntries.end()) {
+		std::vector<AMC::sScatterplotChannelColumn> channelColumns;
+		pScatterplot->getChannelColumns(nChannelID, channelColumns);
 
-		auto& columnEntries = channelIt->second;
-		for (const auto& pair : columnEntries) {
+		for (auto& channelColumn : channelColumns) {
 
-			auto sColumnName = pair.first;
-			auto& vecData = pair.second;
+			auto sColumnName = pScatterplot->getInternedName(channelColumn.m_nColumnID);
+			const double* pValues = pScatterplot->getColumnValues(channelColumn);
 
 			CJSONWriterArray dataArray(writer);
 
-			for (auto value : vecData)
-				dataArray.addDouble("", value);
+			for (uint64_t nIndex = 0; nIndex < channelColumn.m_nValueCount; nIndex++)
+				dataArray.addDouble("", pValues[nIndex]);
 
 			writer.addArray(sColumnName, dataArray);
 		}
 	}
 }
 
+PAPIResponse CAPIHandler_UI::handlePointChannelBinaryRequest(const std::string& sParameterUUID, const std::string& sAdditionalParameter, const std::string& sFormat, const std::string& sCompression, PAPIAuth pAuth)
+{
+	auto encoding = CScatterplotChannelEncoder::stringToEncoding(sFormat);
+	bool bCompressChunks = CScatterplotChannelEncoder::stringToCompression(sCompression);
+
+	auto pToolpathHandler = m_pSystemState->getToolpathHandlerInstance();
+	auto pScatterplot = pToolpathHandler->restoreScatterplot(sParameterUUID, false);
+
+	auto pResponse = std::make_shared<CAPIFixedBufferResponse>(AMC_API_CONTENTTYPE_BINARY);
+	CScatterplotChannelEncoder::encodeChannel(pScatterplot.get(), sAdditionalParameter, encoding, bCompressChunks, AMC_SCATTERPLOTCHANNEL_DEFAULTCHUNKPOINTCOUNT, pResponse->getBuffer());
+
+	return pResponse;
+}
+
 PAPIResponse CAPIHandler_UI::handleRequest(const std::string& sURI, const eAPIRequestType requestType, CAPIFormFields & pFormFields, const uint8_t* pBodyData, const size_t nBodyDataSize, PAPIAuth pAuth)
 {
 	std::string sParameterUUID;
@@ -571,7 +649,8 @@ PAPIResponse CAPIHandler_UI::handleRequest(const std::string& sURI, const eAPIRe
 		break;
 
 	case APIHandler_UIType::utState:
-		handleStateRequest(writer, pAuth);
+		if (!handleStateRequest(writer, pFormFields, pAuth))
+			return std::make_shared<CAPIStringResponse>(AMC_API_HTTP_NOTMODIFIED, AMC_API_CONTENTTYPE, "");
 		break;
 
 	case APIHandler_UIType::utContentItem: {
@@ -611,7 +690,7 @@ PAPIResponse CAPIHandler_UI::handleRequest(const std::string& sURI, const eAPIRe
 	}
 
 	case APIHandler_UIType::utChart:
-		return handleChartRequest(sParameterUUID, pAuth);
+		return handleChartRequest(sParameterUUID, pFormFields, pAuth);
 
 	case APIHandler_UIType::utEvent:
 		handleEventRequest (writer, pBodyData, nBodyDataSize, pAuth);
@@ -622,6 +701,13 @@ PAPIResponse CAPIHandler_UI::handleRequest(const std::string& sURI, const eAPIRe
 		break;
 
 	case APIHandler_UIType::utPointChannel: {
+		// Clients that ask for a binary format get float32 or int16 columns instead of JSON arrays
+		std::string sFormat = pFormFields.getRequestParameter(AMC_API_KEY_UI_POINTCHANNELFORMAT, false);
+		if (!sFormat.empty()) {
+			std::string sCompression = pFormFields.getRequestParameter(AMC_API_KEY_UI_POINTCHANNELCOMPRESSION, false);
+			return handlePointChannelBinaryRequest(sParameterUUID, sAdditionalParameter, AMCCommon::CUtils::toLowerString(sFormat), AMCCommon::CUtils::toLowerString(sCompression), pAuth);
+		}
+
 		handlePointChannelDataRequest(writer, sParameterUUID, sAdditionalParameter, pAuth);
 		break;
 	}
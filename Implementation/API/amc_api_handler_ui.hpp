@@ -64,15 +64,17 @@ namespace AMC {
 		APIHandler_UIType parseRequest(const std::string& sURI, const eAPIRequestType requestType, std::string & sParameterUUID, std::string & sAdditionalParameter);
 
 		void handleConfigurationRequest(CJSONWriter& writer, PAPIAuth pAuth);
-		void handleStateRequest(CJSONWriter& writer, PAPIAuth pAuth);
+		// Returns false if the client's state version is still up to date.
+		bool handleStateRequest(CJSONWriter& writer, CAPIFormFields& pFormFields, PAPIAuth pAuth);
 		void handleContentItemRequest(CJSONWriter& writer, const std::string& sParameterUUID, PAPIAuth pAuth, uint32_t nStateID);
 		PAPIResponse handleImageRequest(const std::string & sParameterUUID, PAPIAuth pAuth);
-		PAPIResponse handleChartRequest(const std::string& sParameterUUID, PAPIAuth pAuth);
+		PAPIResponse handleChartRequest(const std::string& sParameterUUID, CAPIFormFields& pFormFields, PAPIAuth pAuth);
 		PAPIResponse handleDownloadRequest(const std::string& sParameterUUID, PAPIAuth pAuth);
 
 		void handleEventRequest(CJSONWriter& writer, const uint8_t* pBodyData, const size_t nBodyDataSize, PAPIAuth pAuth);
 		void handleWidgetRequest(CJSONWriter& writer, const std::string & sWidgetUUID, const std::string& sRequestType, const uint8_t* pBodyData, const size_t nBodyDataSize, PAPIAuth pAuth);
 		void handlePointChannelDataRequest(CJSONWriter& writer, const std::string& sParameterUUID, const std::string& sAdditionalParameter, PAPIAuth pAuth);
+		PAPIResponse handlePointChannelBinaryRequest(const std::string& sParameterUUID, const std::string& sAdditionalParameter, const std::string& sFormat, const std::string& sCompression, PAPIAuth pAuth);
 
 	public:
 
@@ -46,13 +46,11 @@ CAPISession::CAPISession(PUIFrontendDefinition pFrontendDefinition)
 	: m_sUUID(AMCCommon::CUtils::createUUID()),
 	m_sKey(AMCCommon::CUtils::calculateRandomSHA256String(APISESSION_RANDOMKEYITERATIONS)),
 	m_sToken(AMCCommon::CUtils::calculateRandomSHA256String(APISESSION_RANDOMKEYITERATIONS)),
-	m_sUserName(""),
-	m_sUserUUID(AMCCommon::CUtils::createUUID ()),
 	m_bAuthenticated(false)
 {
 
 	m_pFrontendState = std::make_shared<CUIFrontendState>(pFrontendDefinition);
-	
+	m_pUserInformation = std::make_shared<CUserInformation>(AMCCommon::CUtils::createUUID(), "", "", "", "");
 	
 }
 	
@@ -64,64 +62,46 @@ CAPISession::~CAPISession()
 
 std::string CAPISession::getUUID()
 {
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
-
 	return m_sUUID;
 }
 
 std::string CAPISession::getKey()
 {
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
-
 	return m_sKey;
 }
 
 std::string CAPISession::getUserName()
 {
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
-
-	return m_sUserName;
+	return getUserInformation()->getLogin();
 }
 
 std::string CAPISession::getUserUUID()
 {
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
-
-	return m_sUserUUID;
+	return getUserInformation()->getUUID();
 }
 
 std::string CAPISession::getUserDescription()
 {
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
-
-	return m_sUserDescription;
+	return getUserInformation()->getDescription();
 }
 
 std::string CAPISession::getUserLanguageIdentifier()
 {
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
-
-	return m_sUserLanguageIdentifier;
+	return getUserInformation()->getLanguageIdentifier();
 }
 
 std::string CAPISession::getUserRoleIdentifier()
 {
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
-
-	return m_sUserRoleIdentifier;
+	return getUserInformation()->getRoleIdentifier();
 }
 
 bool CAPISession::isAuthenticated()
 {
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
-
 	return m_bAuthenticated;
 }
 
 std::string CAPISession::getToken()
 {
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
-
 	return m_sToken;	
 }
 
@@ -132,7 +112,7 @@ void CAPISession::authorizeSessionByPassword(const std::string& sSaltedPasswordH
 		throw ELibMCInterfaceException(LIBMC_ERROR_USERALREADYAUTHORIZED);
 
 	std::lock_guard<std::mutex> lockGuard(m_Mutex);
-	if (m_sUserName.empty()) 
+	if (m_pUserInformation->getLogin ().empty()) 
 		throw ELibMCInterfaceException (LIBMC_ERROR_INVALIDLOGIN);
 
 	auto sNormalizedClientKey = AMCCommon::CUtils::normalizeSHA256String(sClientKey);
@@ -149,17 +129,14 @@ void CAPISession::authorizeSessionByPassword(const std::string& sSaltedPasswordH
 
 }
 
-void CAPISession::setUserDetails(const std::string& sUserName, const std::string& sHashedPassword, const std::string& sUserUUID, const std::string& sUserDescription, const std::string& sUserRoleIdentifier, const std::string& sUserLanguageIdentifier)
+void CAPISession::setUserDetails(const std::string& sUserName, const std::string& sHashedPassword, const std::string& sUserUUID, const std::string& sUserDescription, const std::string& sUserRoleIdentifier, const std::string& sUserLanguageIdentifier, PAccessRole pUserRole)
 {
 	std::lock_guard<std::mutex> lockGuard(m_Mutex);
 
-	m_sUserName = sUserName;
 	m_sHashedPassword = sHashedPassword;
-	m_sUserUUID = AMCCommon::CUtils::normalizeUUIDString(sUserUUID);
-		
-	m_sUserDescription = sUserDescription;
-	m_sUserRoleIdentifier = sUserRoleIdentifier;
-	m_sUserLanguageIdentifier = sUserLanguageIdentifier;
+
+	auto pUserInformation = std::make_shared<CUserInformation>(sUserUUID, sUserName, sUserDescription, sUserRoleIdentifier, sUserLanguageIdentifier, pUserRole);
+	std::atomic_store(&m_pUserInformation, pUserInformation);
 }
 
 PUIFrontendState CAPISession::getFrontendState()
@@ -167,7 +144,7 @@ PUIFrontendState CAPISession::getFrontendState()
 	return m_pFrontendState;
 }
 
-PUserInformation CAPISession::createUserInformation()
+PUserInformation CAPISession::getUserInformation()
 {
-	return std::make_shared<CUserInformation> (m_sUserUUID, m_sUserName, m_sUserDescription, m_sUserRoleIdentifier, m_sUserLanguageIdentifier);
+	return std::atomic_load(&m_pUserInformation);
 }
\ No newline at end of file
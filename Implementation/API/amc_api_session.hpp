@@ -42,6 +42,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "common_chrono.hpp"
 
 #include <mutex>
+#include <atomic>
 
 namespace AMC {
 
@@ -50,26 +51,27 @@ namespace AMC {
 	amcDeclareDependingClass(CParameterHandler, PParameterHandler);
 	amcDeclareDependingClass(CUIFrontendState, PUIFrontendState);
 	amcDeclareDependingClass(CUIFrontendDefinition, PUIFrontendDefinition);
+	amcDeclareDependingClass(CAccessRole, PAccessRole);
 
 	class CAPISession {
 	private:
 	
 		std::mutex m_Mutex;
 	
-		std::string m_sUUID;
-		std::string m_sKey;
-		std::string m_sUserName;
+		// UUID, key and token never change after construction and are read without locking.
+		const std::string m_sUUID;
+		const std::string m_sKey;
+		const std::string m_sToken;
+
 		std::string m_sHashedPassword;
-		std::string m_sToken;
 
 		PUIFrontendState m_pFrontendState;
 
-		std::string m_sUserUUID;
-		std::string m_sUserDescription;
-		std::string m_sUserLanguageIdentifier;
-		std::string m_sUserRoleIdentifier;
+		// Immutable snapshot of the user details, shared by all requests of the session.
+		// Only replaced on login, through atomic_store.
+		PUserInformation m_pUserInformation;
 
-		bool m_bAuthenticated;		
+		std::atomic<bool> m_bAuthenticated;
 					
 	public:
 
@@ -87,11 +89,11 @@ namespace AMC {
 		bool isAuthenticated ();
 		
 		void authorizeSessionByPassword(const std::string & sSaltedPasswordHash, const std::string & sClientKey);
-		void setUserDetails(const std::string& sUserName, const std::string & sHashedPassword, const std::string& sUserUUID, const std::string& sUserDescription, const std::string& sUserRoleIdentifier, const std::string& sUserLanguageIdentifier);
+		void setUserDetails(const std::string& sUserName, const std::string & sHashedPassword, const std::string& sUserUUID, const std::string& sUserDescription, const std::string& sUserRoleIdentifier, const std::string& sUserLanguageIdentifier, PAccessRole pUserRole);
 
 		PUIFrontendState getFrontendState();
 
-		PUserInformation createUserInformation();
+		PUserInformation getUserInformation();
 								
 	};
 
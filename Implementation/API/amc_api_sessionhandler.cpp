@@ -56,6 +56,27 @@ CAPISessionHandler::~CAPISessionHandler()
 {
 }
 
+sAPISessionShard& CAPISessionHandler::getShard(const std::string& sSessionUUID)
+{
+	size_t nHash = std::hash<std::string>{}(sSessionUUID);
+	return m_Shards[nHash % APISESSIONHANDLER_SHARDCOUNT];
+}
+
+PAPISession CAPISessionHandler::findSession(const std::string& sSessionUUID, bool bMustExist)
+{
+	auto& shard = getShard(sSessionUUID);
+
+	std::lock_guard<std::mutex> lockGuard(shard.m_Mutex);
+	auto iIterator = shard.m_SessionMap.find(sSessionUUID);
+	if (iIterator == shard.m_SessionMap.end()) {
+		if (bMustExist)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDSESSIONUUID);
+		return nullptr;
+	}
+
+	return iIterator->second;
+}
+
 PAPIAuth CAPISessionHandler::createAuthentication(const std::string& sAuthorizationJSON, AMCCommon::PChrono pGlobalChrono)
 {
 	if (!sAuthorizationJSON.empty()) {
@@ -65,17 +86,14 @@ PAPIAuth CAPISessionHandler::createAuthentication(const std::string& sAuthorizat
 		std::string sSessionUUID = request.getUUID(AMC_API_KEY_TOKEN_SESSION, LIBMC_ERROR_INVALIDSESSIONUUID);
 		std::string sToken = request.getSHA256(AMC_API_KEY_TOKEN_TOKEN, LIBMC_ERROR_INVALIDSESSIONTOKEN);
 
-		std::lock_guard<std::mutex> lockGuard(m_Mutex);
-		auto iIterator = m_SessionMap.find (sSessionUUID);
-		if (iIterator == m_SessionMap.end())
+		auto pSession = findSession(sSessionUUID, false);
+		if (pSession.get() == nullptr)
 			return nullptr;
 
-		auto pSession = iIterator->second;
-
 		if (pSession->getToken () != sToken)
 			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDSESSIONTOKEN);
 
-		return std::make_shared<CAPIAuth>(pSession->getUUID(), pSession->getKey(), pSession->createUserInformation(), pSession->isAuthenticated(), pSession->getFrontendState ());
+		return std::make_shared<CAPIAuth>(pSession->getUUID(), pSession->getKey(), pSession->getUserInformation(), pSession->isAuthenticated(), pSession->getFrontendState ());
 	}
 	else {
 		return nullptr;
@@ -88,10 +106,13 @@ PAPIAuth CAPISessionHandler::createNewAuthenticationSession(PUIFrontendDefinitio
 {
 	auto pSession = std::make_shared<CAPISession>(pFrontendDefinition);
 
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
-	m_SessionMap.insert (std::make_pair (pSession->getUUID(), pSession));
+	{
+		auto& shard = getShard(pSession->getUUID());
+		std::lock_guard<std::mutex> lockGuard(shard.m_Mutex);
+		shard.m_SessionMap.insert(std::make_pair(pSession->getUUID(), pSession));
+	}
 
-	return std::make_shared<CAPIAuth>(pSession->getUUID(), pSession->getKey(), pSession->createUserInformation(), pSession->isAuthenticated(), pSession->getFrontendState());
+	return std::make_shared<CAPIAuth>(pSession->getUUID(), pSession->getKey(), pSession->getUserInformation(), pSession->isAuthenticated(), pSession->getFrontendState());
 
 }
 
@@ -108,64 +129,42 @@ PAPIAuth CAPISessionHandler::createEmptyAuthenticationSession()
 
 void CAPISessionHandler::authorizeSession(const std::string& sSessionUUID, const std::string& sSaltedPassword, const std::string& sClientKey)
 {
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
-	auto iIterator = m_SessionMap.find(sSessionUUID);
-	if (iIterator == m_SessionMap.end())
-		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDSESSIONUUID);
-
-	auto pSession = iIterator->second;
+	auto pSession = findSession(sSessionUUID, true);
 	pSession->authorizeSessionByPassword(sSaltedPassword, sClientKey);
 
 }
 
 
-void CAPISessionHandler::setUserDetailsForSession(const std::string& sSessionUUID, const std::string& sUsername, const std::string& sHashedPassword, const std::string& sUserUUID, const std::string& sUserDescription, const std::string& sUserRoleIdentifier, const std::string& sUserLanguageIdentifier)
+void CAPISessionHandler::setUserDetailsForSession(const std::string& sSessionUUID, const std::string& sUsername, const std::string& sHashedPassword, const std::string& sUserUUID, const std::string& sUserDescription, const std::string& sUserRoleIdentifier, const std::string& sUserLanguageIdentifier, PAccessRole pUserRole)
 {
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
-	auto iIterator = m_SessionMap.find(sSessionUUID);
-	if (iIterator == m_SessionMap.end())
-		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDSESSIONUUID);
-
-	auto pSession = iIterator->second;
-	pSession->setUserDetails(sUsername, sHashedPassword, sUserUUID, sUserDescription, sUserRoleIdentifier, sUserLanguageIdentifier);
+	auto pSession = findSession(sSessionUUID, true);
+	pSession->setUserDetails(sUsername, sHashedPassword, sUserUUID, sUserDescription, sUserRoleIdentifier, sUserLanguageIdentifier, pUserRole);
 }
 
 void CAPISessionHandler::getUserDetailsForSession(const std::string& sSessionUUID, std::string& sUsername, std::string& sUserUUID, std::string& sUserDescription, std::string& sUserRoleIdentifier, std::string& sUserLanguageIdentifier)
 {
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
-	auto iIterator = m_SessionMap.find(sSessionUUID);
-	if (iIterator == m_SessionMap.end())
-		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDSESSIONUUID);
-
-	auto pSession = iIterator->second;
-	sUsername = pSession->getUserName();
-	sUserUUID = pSession->getUserUUID();
-	sUserDescription = pSession->getUserDescription();
-	sUserRoleIdentifier = pSession->getUserRoleIdentifier();
-	sUserLanguageIdentifier = pSession->getUserLanguageIdentifier();
+	auto pSession = findSession(sSessionUUID, true);
+
+	// Read all fields from one snapshot, so that a concurrent login cannot mix two users.
+	auto pUserInformation = pSession->getUserInformation();
+	sUsername = pUserInformation->getLogin();
+	sUserUUID = pUserInformation->getUUID();
+	sUserDescription = pUserInformation->getDescription();
+	sUserRoleIdentifier = pUserInformation->getRoleIdentifier();
+	sUserLanguageIdentifier = pUserInformation->getLanguageIdentifier();
 
 }
 
 std::string CAPISessionHandler::getSessionToken(const std::string& sSessionUUID)
 {
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
-	auto iIterator = m_SessionMap.find(sSessionUUID);
-	if (iIterator == m_SessionMap.end())
-		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDSESSIONUUID);
-
-	auto pSession = iIterator->second;
+	auto pSession = findSession(sSessionUUID, true);
 	return pSession->getToken();
 
 }
 
 bool CAPISessionHandler::sessionIsAuthenticated(const std::string& sSessionUUID)
 {
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
-	auto iIterator = m_SessionMap.find(sSessionUUID);
-	if (iIterator == m_SessionMap.end())
-		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDSESSIONUUID);
-
-	auto pSession = iIterator->second;
+	auto pSession = findSession(sSessionUUID, true);
 	return pSession->isAuthenticated();
 
 }
@@ -36,8 +36,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "amc_api_types.hpp"
 
 #include <mutex>
-#include <map>
+#include <unordered_map>
 #include <string>
+#include <array>
 
 #include "common_chrono.hpp"
 
@@ -48,14 +49,25 @@ namespace AMC {
 	amcDeclareDependingClass(CAPISessionHandler, PAPISessionHandler);
 	amcDeclareDependingClass(CParameterHandler, PParameterHandler);
 	amcDeclareDependingClass(CUIFrontendDefinition, PUIFrontendDefinition);
-	
+	amcDeclareDependingClass(CAccessRole, PAccessRole);
+
+#define APISESSIONHANDLER_SHARDCOUNT 32
+
+	// Sessions are distributed over independently locked shards by UUID hash.
+	// A lookup only holds its shard's lock while copying the session pointer.
+	typedef struct {
+		std::mutex m_Mutex;
+		std::unordered_map <std::string, PAPISession> m_SessionMap;
+	} sAPISessionShard;
 
 	class CAPISessionHandler {
 	private:
 	
-		std::mutex m_Mutex;
+		std::array<sAPISessionShard, APISESSIONHANDLER_SHARDCOUNT> m_Shards;
+
+		sAPISessionShard& getShard(const std::string& sSessionUUID);
 
-		std::map <std::string, PAPISession> m_SessionMap;
+		PAPISession findSession(const std::string& sSessionUUID, bool bMustExist);
 			
 	protected:
 			
@@ -72,7 +84,7 @@ namespace AMC {
 
 		void authorizeSession (const std::string & sSessionUUID, const std::string & sSaltedPassword, const std::string & sClientKey);
 
-		void setUserDetailsForSession(const std::string& sSessionUUID, const std::string& sUsername, const std::string& sHashedPassword, const std::string & sUserUUID, const std::string & sUserDescription, const std::string& sUserRoleIdentifier, const std::string & sUserLanguageIdentifier);
+		void setUserDetailsForSession(const std::string& sSessionUUID, const std::string& sUsername, const std::string& sHashedPassword, const std::string & sUserUUID, const std::string & sUserDescription, const std::string& sUserRoleIdentifier, const std::string & sUserLanguageIdentifier, PAccessRole pUserRole);
 		
 		void getUserDetailsForSession(const std::string& sSessionUUID, std::string& sUsername, std::string& sUserUUID, std::string& sUserDescription, std::string& sUserRoleIdentifier, std::string& sUserLanguageIdentifier);
 
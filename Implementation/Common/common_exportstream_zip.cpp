@@ -28,10 +28,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "common_exportstream_zip.hpp"
 #include <stdexcept> 
 #include <vector>
+#include <thread>
+#include <exception>
+#include <algorithm>
+#include <cstring>
 
 namespace AMCCommon {
 
-	CExportStream_ZIP::CExportStream_ZIP(CPortableZIPWriter * pZIPWriter, uint32_t nEntryKey)
+	CExportStream_ZIP::CExportStream_ZIP(CPortableZIPWriter * pZIPWriter, uint32_t nEntryKey, int32_t nCompressionLevel, uint32_t nWorkerCount)
 	{
 		m_bIsInitialized = false;
 
@@ -39,32 +43,19 @@ namespace AMCCommon {
 			throw std::runtime_error("invalid param");
 		if (nEntryKey == 0)
 			throw std::runtime_error("invalid param");
+		if ((nCompressionLevel < 0) || (nCompressionLevel > 9))
+			throw std::runtime_error("invalid zip compression level");
 
 		m_pZIPWriter = pZIPWriter;
 		m_nEntryKey = nEntryKey;
+		m_nCompressionLevel = nCompressionLevel;
+		m_nWorkerCount = std::min(std::max(nWorkerCount, (uint32_t)1), (uint32_t)ZIPEXPORTMAXWORKERCOUNT);
+		m_nTotalBytesWritten = 0;
 
-		m_pStream.next_in = nullptr;
-		m_pStream.avail_in = 0;
-		m_pStream.total_in = 0;
-
-		m_pStream.msg = nullptr;
-		m_pStream.state = nullptr;
-
-		m_pStream.zalloc = nullptr;
-		m_pStream.zfree = nullptr;
-		m_pStream.opaque = nullptr;
-
-		m_pStream.data_type = 0;
-		m_pStream.adler = 0;
-		m_pStream.reserved = 0;
-
-		m_pStream.next_out = &m_nOutBuffer[0];
-		m_pStream.avail_out = ZIPEXPORTBUFFERSIZE;
-		m_pStream.total_out = 0;
-
-		int32_t nResult = deflateInit2(&m_pStream, Z_BEST_SPEED, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
-		if (nResult < 0)
-			throw std::runtime_error("deflate init failed");
+		if (m_nCompressionLevel > 0) {
+			m_Blocks.reserve(m_nWorkerCount);
+			startNewBlock();
+		}
 
 		m_bIsInitialized = true;
 	}
@@ -72,7 +63,12 @@ namespace AMCCommon {
 	CExportStream_ZIP::~CExportStream_ZIP()
 	{
 		if (m_bIsInitialized) {
-			finishDeflate();
+			try {
+				finishDeflate();
+			}
+			catch (...) {
+				// Destructors must not throw
+			}
 		}
 	}
 
@@ -99,92 +95,181 @@ namespace AMCCommon {
 
 	uint64_t CExportStream_ZIP::getPosition()
 	{
-		return m_pZIPWriter->getCurrentSize(m_nEntryKey);
+		return m_nTotalBytesWritten;
 	}
 
 	uint64_t CExportStream_ZIP::writeBuffer(const void * pBuffer, uint64_t cbTotalBytesToWrite)
 	{
 		if (!m_bIsInitialized)
 			throw std::runtime_error("zip stream already finished");
+		if ((pBuffer == nullptr) && (cbTotalBytesToWrite > 0))
+			throw std::runtime_error("invalid param");
 
 		uint64_t cbCount = cbTotalBytesToWrite;
 		const uint8_t * pByte = (const uint8_t*)pBuffer;
 
-		while (cbCount > 0) {
-			uint32_t cbBytesWritten;
-			if (cbCount < ZIPEXPORTWRITECHUNKSIZE)
-				cbBytesWritten = writeChunk(pByte, (uint32_t)cbCount);
-			else
-				cbBytesWritten = writeChunk(pByte, ZIPEXPORTWRITECHUNKSIZE);
+		if (m_nCompressionLevel == 0) {
+			// Stored entries are passed through unchanged
+			while (cbCount > 0) {
+				uint32_t cbChunkSize = (uint32_t) std::min(cbCount, (uint64_t)ZIPEXPORTSTOREDCHUNKSIZE);
+				m_pZIPWriter->calculateChecksum(m_nEntryKey, pByte, cbChunkSize);
+				m_pZIPWriter->writeDeflatedBuffer(m_nEntryKey, pByte, cbChunkSize);
 
-			if (cbBytesWritten == 0)
-				throw std::runtime_error("zip stream could not deflate");
-
-			cbCount -= cbBytesWritten;
-			pByte += cbBytesWritten;
+				cbCount -= cbChunkSize;
+				pByte += cbChunkSize;
+			}
+		}
+		else {
+			while (cbCount > 0) {
+				auto & currentInput = m_Blocks.back().m_Input;
+				if (currentInput.size() >= ZIPEXPORTBLOCKSIZE) {
+					if (m_Blocks.size() >= m_nWorkerCount)
+						deflateBlocks(false);
+					startNewBlock();
+					continue;
+				}
+
+				size_t cbChunkSize = (size_t) std::min(cbCount, (uint64_t)(ZIPEXPORTBLOCKSIZE - currentInput.size()));
+				currentInput.insert(currentInput.end(), pByte, pByte + cbChunkSize);
+
+				cbCount -= cbChunkSize;
+				pByte += cbChunkSize;
+			}
 		}
 
+		m_nTotalBytesWritten += cbTotalBytesToWrite;
+
 		return cbTotalBytesToWrite;
 	}
 
-	uint32_t CExportStream_ZIP::writeChunk(const uint8_t * pData, uint32_t cbCount)
+	void CExportStream_ZIP::startNewBlock()
 	{
-		if ((pData == nullptr) || (cbCount == 0) || (cbCount > ZIPEXPORTWRITECHUNKSIZE))
-			throw std::runtime_error("invalid param");
+		// The dictionary of a block is the tail of its predecessor's input
+		if (!m_Blocks.empty())
+			updateDictionary(m_Blocks.back());
+
+		m_Blocks.push_back(sZIPExportBlock());
+		auto & newBlock = m_Blocks.back();
+		newBlock.m_Input.reserve(ZIPEXPORTBLOCKSIZE);
+		newBlock.m_Dictionary = m_Dictionary;
+		newBlock.m_nCRC32 = 0;
+		newBlock.m_bIsLastBlock = false;
+	}
 
-		m_pStream.next_in = (Bytef *) pData;
-		m_pStream.avail_in = cbCount;
+	void CExportStream_ZIP::deflateBlock(sZIPExportBlock & block, int32_t nCompressionLevel)
+	{
+		block.m_nCRC32 = (uint32_t) crc32(0, block.m_Input.data(), (uInt) block.m_Input.size());
 
-		m_pZIPWriter->calculateChecksum(m_nEntryKey, pData, cbCount);
+		z_stream stream;
+		memset(&stream, 0, sizeof(stream));
 
-		while (m_pStream.avail_in > 0) {
-			int32_t nResult = deflate(&m_pStream, 0);
-			if (nResult < 0)
-				throw std::runtime_error("zip stream could not deflate");
-
-			if (m_pStream.avail_out == 0) {
-				m_pZIPWriter->writeDeflatedBuffer(m_nEntryKey, &m_nOutBuffer[0], ZIPEXPORTBUFFERSIZE);
+		int32_t nResult = deflateInit2(&stream, nCompressionLevel, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+		if (nResult != Z_OK)
+			throw std::runtime_error("deflate init failed");
 
-				m_pStream.next_out = &m_nOutBuffer[0];
-				m_pStream.avail_out = ZIPEXPORTBUFFERSIZE;
+		try {
+			if (!block.m_Dictionary.empty()) {
+				nResult = deflateSetDictionary(&stream, block.m_Dictionary.data(), (uInt)block.m_Dictionary.size());
+				if (nResult != Z_OK)
+					throw std::runtime_error("zip stream could not set deflate dictionary");
 			}
-		}
 
-		return cbCount;
+			// The bound covers the worst case of stored blocks, the margin covers the sync flush marker.
+			block.m_Output.resize(deflateBound(&stream, (uLong)block.m_Input.size()) + 16);
 
-	}
+			stream.next_in = block.m_Input.data();
+			stream.avail_in = (uInt)block.m_Input.size();
+			stream.next_out = block.m_Output.data();
+			stream.avail_out = (uInt)block.m_Output.size();
 
+			int nFlush = block.m_bIsLastBlock ? Z_FINISH : Z_SYNC_FLUSH;
+			nResult = deflate(&stream, nFlush);
+			if ((nResult < 0) || (stream.avail_in != 0) || (block.m_bIsLastBlock && (nResult != Z_STREAM_END)))
+				throw std::runtime_error("zip stream could not deflate");
 
-	void CExportStream_ZIP::finishDeflate()
+			block.m_Output.resize(block.m_Output.size() - stream.avail_out);
+		}
+		catch (...) {
+			deflateEnd(&stream);
+			throw;
+		}
+
+		deflateEnd(&stream);
+	}
+
+	void CExportStream_ZIP::deflateBlocks(bool bFinish)
 	{
-		if (!m_bIsInitialized)
-			throw std::runtime_error("zip stream already finished");
+		if (m_Blocks.empty())
+			return;
 
-		m_pStream.next_in = nullptr;
-		m_pStream.avail_in = 0;
+		if (bFinish)
+			m_Blocks.back().m_bIsLastBlock = true;
 
-		bool bContinue = true;
-		while (bContinue) {
-			int32_t nResult = deflate(&m_pStream, Z_FINISH);
-			if (nResult < 0)
-				throw std::runtime_error("zip stream could not deflate");
+		size_t nBlockCount = m_Blocks.size();
+		if ((nBlockCount == 1) || (m_nWorkerCount == 1)) {
+			for (auto & block : m_Blocks)
+				deflateBlock(block, m_nCompressionLevel);
+		}
+		else {
+			std::vector<std::exception_ptr> workerExceptions(nBlockCount);
+			std::vector<std::thread> workers;
+			workers.reserve(nBlockCount - 1);
+
+			// The calling thread deflates the first block itself
+			for (size_t nBlockIndex = 1; nBlockIndex < nBlockCount; nBlockIndex++) {
+				workers.push_back(std::thread([this, nBlockIndex, &workerExceptions]() {
+					try {
+						deflateBlock(m_Blocks[nBlockIndex], m_nCompressionLevel);
+					}
+					catch (...) {
+						workerExceptions[nBlockIndex] = std::current_exception();
+					}
+				}));
+			}
+
+			try {
+				deflateBlock(m_Blocks[0], m_nCompressionLevel);
+			}
+			catch (...) {
+				workerExceptions[0] = std::current_exception();
+			}
 
-			if ((nResult != Z_STREAM_END) && (m_pStream.avail_out == 0)) {
-				m_pZIPWriter->writeDeflatedBuffer(m_nEntryKey, &m_nOutBuffer[0], ZIPEXPORTBUFFERSIZE);
+			for (auto & worker : workers)
+				worker.join();
 
-				m_pStream.next_out = &m_nOutBuffer[0];
-				m_pStream.avail_out = ZIPEXPORTBUFFERSIZE;
+			for (auto & workerException : workerExceptions) {
+				if (workerException)
+					std::rethrow_exception(workerException);
 			}
-			else
-				bContinue = false;
 		}
 
-		if (m_pStream.avail_out < ZIPEXPORTBUFFERSIZE) {
-			m_pZIPWriter->writeDeflatedBuffer(m_nEntryKey, &m_nOutBuffer[0], ZIPEXPORTBUFFERSIZE - m_pStream.avail_out);
+		// Blocks are written in order, so the entry's deflate stream and CRC stay sequential
+		for (auto & block : m_Blocks) {
+			if (!block.m_Output.empty())
+				m_pZIPWriter->writeDeflatedBuffer(m_nEntryKey, block.m_Output.data(), (uint32_t)block.m_Output.size());
+			m_pZIPWriter->combineChecksum(m_nEntryKey, block.m_nCRC32, block.m_Input.size());
 		}
 
-		deflateEnd(&m_pStream);
+		updateDictionary(m_Blocks.back());
+		m_Blocks.clear();
+	}
+
+	void CExportStream_ZIP::updateDictionary(const sZIPExportBlock & previousBlock)
+	{
+		auto & previousInput = previousBlock.m_Input;
+		size_t nDictionarySize = std::min(previousInput.size(), (size_t)ZIPEXPORTDICTIONARYSIZE);
+		m_Dictionary.assign(previousInput.end() - nDictionarySize, previousInput.end());
+	}
+
+	void CExportStream_ZIP::finishDeflate()
+	{
+		if (!m_bIsInitialized)
+			throw std::runtime_error("zip stream already finished");
+
 		m_bIsInitialized = false;
+
+		if (m_nCompressionLevel > 0)
+			deflateBlocks(true);
 	}
 
 	void CExportStream_ZIP::flushZIPStream()
@@ -197,16 +282,11 @@ namespace AMCCommon {
 
 		if (bytes > 0) {
 			uint32_t bufferSize = 1024 * 1024;
-			std::vector <uint64_t> Buffer;
-			Buffer.resize(bufferSize / sizeof(uint64_t));
-
-			for (auto iter = Buffer.begin(); iter != Buffer.end(); iter++)
-				*iter = 0;
+			std::vector <uint8_t> Buffer;
+			Buffer.resize(bufferSize, 0);
 
 			while (bytes > 0) {
-				auto bytesToWrite = bytes;
-				if (bytes > bufferSize)
-					bytes = bufferSize;
+				uint64_t bytesToWrite = std::min(bytes, (uint64_t)bufferSize);
 
 				writeBuffer(Buffer.data(), bytesToWrite);
 				bytes -= bytesToWrite;
@@ -37,27 +37,51 @@ NMR_PortableZIPWriter.h defines a portable stream to write into ZIP files
 #include "common_portablezipwriter.hpp"
 #include "Libraries/zlib/zlib.h"
 
-#include <array>
+#include <vector>
 
-#define ZIPEXPORTBUFFERSIZE 65536
-#define ZIPEXPORTWRITECHUNKSIZE 1048576
+// Entries are deflated in independent blocks of ZIPEXPORTBLOCKSIZE bytes. Each block is primed with the last
+// ZIPEXPORTDICTIONARYSIZE bytes of its predecessor and ends on a byte boundary with a sync flush, so that the
+// compressed blocks simply concatenate into one deflate stream. The output does not depend on the worker count.
+#define ZIPEXPORTBLOCKSIZE 1048576
+#define ZIPEXPORTDICTIONARYSIZE 32768
+#define ZIPEXPORTMAXWORKERCOUNT 32
+#define ZIPEXPORTSTOREDCHUNKSIZE 1048576
 
 namespace AMCCommon {
 
+	typedef struct _sZIPExportBlock {
+		std::vector<uint8_t> m_Input;
+		std::vector<uint8_t> m_Dictionary;
+		std::vector<uint8_t> m_Output;
+		uint32_t m_nCRC32;
+		bool m_bIsLastBlock;
+	} sZIPExportBlock;
+
 	class CExportStream_ZIP : public CExportStream {
 	private:
 		CPortableZIPWriter * m_pZIPWriter;
 		uint32_t m_nEntryKey;
-		z_stream m_pStream;
-		std::array<uint8_t, ZIPEXPORTBUFFERSIZE> m_nOutBuffer;
+
+		// 0 stores the entry without compression.
+		int32_t m_nCompressionLevel;
+		uint32_t m_nWorkerCount;
+
+		// Blocks that are filled and wait to be deflated. The last one is the block that currently receives data.
+		std::vector<sZIPExportBlock> m_Blocks;
+		std::vector<uint8_t> m_Dictionary;
+		uint64_t m_nTotalBytesWritten;
 
 		bool m_bIsInitialized;
 
-		uint32_t writeChunk(const uint8_t * pData, uint32_t cbCount);
+		void startNewBlock();
+		void updateDictionary(const sZIPExportBlock & previousBlock);
+		void deflateBlocks(bool bFinish);
 		void finishDeflate();
+
+		static void deflateBlock(sZIPExportBlock & block, int32_t nCompressionLevel);
 	public:
 		CExportStream_ZIP() = delete;
-		CExportStream_ZIP(CPortableZIPWriter * pZIPWriter, uint32_t nEntryKey);
+		CExportStream_ZIP(CPortableZIPWriter * pZIPWriter, uint32_t nEntryKey, int32_t nCompressionLevel, uint32_t nWorkerCount);
 		~CExportStream_ZIP();
 
 		virtual bool seekPosition(uint64_t position, bool bHasToSucceed);
@@ -35,9 +35,6 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define STB_IMAGE_IMPLEMENTATION
 #include "Libraries/stb_image/stb_image.h"
 
-#define TJE_IMPLEMENTATION
-#include "Libraries/TinyJPEG/tiny_jpeg.h"
-
 #include <string>
 #include <vector>
 #include <stdexcept>
@@ -332,24 +329,30 @@ namespace AMCCommon {
 
 
 
-	void jpeg_write_callback(void* context, void* data, int bytesToWrite)
+	CJPEGImageEncoder::CJPEGImageEncoder(uint32_t nWidth, uint32_t nHeight, eJPEGChannelCount channelCount, const uint8_t* pImageData, std::vector<uint8_t>& JPEGData, bool bThrowError)
+		: m_nWidth (nWidth), m_nHeight (nHeight), m_ChannelCount (channelCount), m_JPEGData (JPEGData)
 	{
-		if (context != nullptr) {
-			auto pBuffer = (std::vector<uint8_t>*) context;
+		if (pImageData == nullptr)
+			throw std::runtime_error("invalid JPEG Image data parameter");
 
-			if ((data != nullptr) && (bytesToWrite > 0)) {
-				uint8_t* pSource = (uint8_t*) data;
-				for (int nIndex = 0; nIndex < bytesToWrite; nIndex++) {
-					pBuffer->push_back(*pSource);
-					pSource++;
-				}
+		if ((nWidth <= 0) || (nHeight <= 0))
+			throw std::runtime_error("invalid JPEG Image data size");
 
-			}
+		eJPEGEncoderInputFormat inputFormat;
+		switch (channelCount) {
+		case eJPEGChannelCount::ccGray: inputFormat = eJPEGEncoderInputFormat::ifGreyScale8bit; break;
+		case eJPEGChannelCount::ccGrayAlpha: inputFormat = eJPEGEncoderInputFormat::ifGreyScaleAlpha16bit; break;
+		case eJPEGChannelCount::ccRGB: inputFormat = eJPEGEncoderInputFormat::ifRGB24bit; break;
+		case eJPEGChannelCount::ccRGBAlpha: inputFormat = eJPEGEncoderInputFormat::ifRGBA32bit; break;
+		default:
+			throw std::runtime_error("invalid JPEG color channels : " + std::to_string((uint32_t)channelCount));
 		}
+
+		encode(inputFormat, pImageData, CJPEGStreamEncoder::getInputSize(nWidth, nHeight, inputFormat), bThrowError);
 	}
 
-	CJPEGImageEncoder::CJPEGImageEncoder(uint32_t nWidth, uint32_t nHeight, eJPEGChannelCount channelCount, const uint8_t* pImageData, std::vector<uint8_t>& JPEGData, bool bThrowError)
-		: m_nWidth (nWidth), m_nHeight (nHeight), m_ChannelCount (channelCount), m_JPEGData (JPEGData)
+	CJPEGImageEncoder::CJPEGImageEncoder(uint32_t nWidth, uint32_t nHeight, eJPEGEncoderInputFormat inputFormat, const uint8_t* pImageData, uint64_t nImageDataSize, std::vector<uint8_t>& JPEGData, bool bThrowError)
+		: m_nWidth (nWidth), m_nHeight (nHeight), m_ChannelCount (eJPEGChannelCount::ccRGB), m_JPEGData (JPEGData)
 	{
 		if (pImageData == nullptr)
 			throw std::runtime_error("invalid JPEG Image data parameter");
@@ -357,15 +360,36 @@ namespace AMCCommon {
 		if ((nWidth <= 0) || (nHeight <= 0))
 			throw std::runtime_error("invalid JPEG Image data size");
 
-		int quality = 2;
+		if (inputFormat == eJPEGEncoderInputFormat::ifGreyScale8bit)
+			m_ChannelCount = eJPEGChannelCount::ccGray;
+		if (inputFormat == eJPEGEncoderInputFormat::ifGreyScaleAlpha16bit)
+			m_ChannelCount = eJPEGChannelCount::ccGrayAlpha;
+		if (inputFormat == eJPEGEncoderInputFormat::ifRGBA32bit)
+			m_ChannelCount = eJPEGChannelCount::ccRGBAlpha;
 
-		if (!tje_encode_with_func(jpeg_write_callback, (void*) &m_JPEGData, quality, (int)nWidth, (int)nHeight, (int)channelCount, pImageData)) {
-	
-			if (bThrowError) 
+		encode(inputFormat, pImageData, nImageDataSize, bThrowError);
+	}
+
+	void CJPEGImageEncoder::encode(eJPEGEncoderInputFormat inputFormat, const uint8_t* pImageData, uint64_t nImageDataSize, bool bThrowError)
+	{
+		// Pooled encoders keep their tables, headers and scratch buffer from previous frames
+		auto pEncoder = CJPEGStreamEncoder::acquireEncoder(JPEGENCODER_DEFAULTQUALITY);
+
+		try {
+			auto& encodedData = pEncoder->encode(m_nWidth, m_nHeight, inputFormat, pImageData, nImageDataSize);
+			m_JPEGData.assign(encodedData.begin(), encodedData.end());
+		}
+		catch (std::exception&) {
+			CJPEGStreamEncoder::releaseEncoder(std::move(pEncoder));
+
+			if (bThrowError)
 				throw std::runtime_error("could not encode JPEG data");
 
 			m_JPEGData.clear();
+			return;
 		}
+
+		CJPEGStreamEncoder::releaseEncoder(std::move(pEncoder));
 	}
 
 	CJPEGImageEncoder::~CJPEGImageEncoder()
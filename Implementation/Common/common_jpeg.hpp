@@ -35,6 +35,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <memory>
 #include <vector>
 
+#include "common_jpegencoder.hpp"
+
 
 namespace AMCCommon {
 
@@ -77,10 +79,15 @@ namespace AMCCommon {
 		std::vector<uint8_t> & m_JPEGData;
 		eJPEGChannelCount m_ChannelCount;
 
+		void encode(eJPEGEncoderInputFormat inputFormat, const uint8_t* pImageData, uint64_t nImageDataSize, bool bThrowError);
+
 	public:
 
 		CJPEGImageEncoder(uint32_t nWidth, uint32_t nHeight, eJPEGChannelCount channelCount, const uint8_t * pImageData, std::vector<uint8_t> & JPEGData, bool bThrowError);
 
+		// Encodes camera data without converting it to RGB first. Image data must hold the full frame of the given format.
+		CJPEGImageEncoder(uint32_t nWidth, uint32_t nHeight, eJPEGEncoderInputFormat inputFormat, const uint8_t* pImageData, uint64_t nImageDataSize, std::vector<uint8_t>& JPEGData, bool bThrowError);
+
 		virtual ~CJPEGImageEncoder();
 
 		uint32_t getWidth();
@@ -0,0 +1,803 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#include "common_jpegencoder.hpp"
+
+#include <string>
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define JPEGENCODER_USESSE2
+#endif
+
+#define JPEGENCODER_MCURESERVE 4096
+#define JPEGENCODER_MAXACCOEFFICIENT 1023
+
+namespace AMCCommon {
+
+	// Suggested quantization tables of ITU T.81 Annex K.1, in natural order
+	static const uint8_t s_DefaultLumaQuantization[64] = {
+		16, 11, 10, 16, 24, 40, 51, 61,
+		12, 12, 14, 19, 26, 58, 60, 55,
+		14, 13, 16, 24, 40, 57, 69, 56,
+		14, 17, 22, 29, 51, 87, 80, 62,
+		18, 22, 37, 56, 68, 109, 103, 77,
+		24, 35, 55, 64, 81, 104, 113, 92,
+		49, 64, 78, 87, 103, 121, 120, 101,
+		72, 92, 95, 98, 112, 100, 103, 99
+	};
+
+	static const uint8_t s_DefaultChromaQuantization[64] = {
+		17, 18, 24, 47, 99, 99, 99, 99,
+		18, 21, 26, 66, 99, 99, 99, 99,
+		24, 26, 56, 99, 99, 99, 99, 99,
+		47, 66, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99
+	};
+
+	// Zigzag position of each coefficient in natural order
+	static const uint8_t s_ZigZag[64] = {
+		0, 1, 5, 6, 14, 15, 27, 28,
+		2, 4, 7, 13, 16, 26, 29, 42,
+		3, 8, 12, 17, 25, 30, 41, 43,
+		9, 11, 18, 24, 31, 40, 44, 53,
+		10, 19, 23, 32, 39, 45, 52, 54,
+		20, 22, 33, 38, 46, 51, 55, 60,
+		21, 34, 37, 47, 50, 56, 59, 61,
+		35, 36, 48, 49, 57, 58, 62, 63
+	};
+
+	// Typical Huffman tables of ITU T.81 Annex K.3
+	static const uint8_t s_LumaDCBits[16] = { 0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0 };
+	static const uint8_t s_LumaDCValues[12] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+	static const uint8_t s_ChromaDCBits[16] = { 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0 };
+	static const uint8_t s_ChromaDCValues[12] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+	static const uint8_t s_LumaACBits[16] = { 0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d };
+	static const uint8_t s_LumaACValues[162] = {
+		0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07,
+		0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xA1, 0x08, 0x23, 0x42, 0xB1, 0xC1, 0x15, 0x52, 0xD1, 0xF0,
+		0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0A, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x25, 0x26, 0x27, 0x28,
+		0x29, 0x2A, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+		0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+		0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+		0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7,
+		0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4, 0xC5,
+		0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE1, 0xE2,
+		0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8,
+		0xF9, 0xFA
+	};
+
+	static const uint8_t s_ChromaACBits[16] = { 0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77 };
+	static const uint8_t s_ChromaACValues[162] = {
+		0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71,
+		0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23, 0x33, 0x52, 0xF0,
+		0x15, 0x62, 0x72, 0xD1, 0x0A, 0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18, 0x19, 0x1A, 0x26,
+		0x27, 0x28, 0x29, 0x2A, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+		0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+		0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+		0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5,
+		0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3,
+		0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA,
+		0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8,
+		0xF9, 0xFA
+	};
+
+	static const uint8_t* s_HuffmanBits[4] = { s_LumaDCBits, s_LumaACBits, s_ChromaDCBits, s_ChromaACBits };
+	static const uint8_t* s_HuffmanValues[4] = { s_LumaDCValues, s_LumaACValues, s_ChromaDCValues, s_ChromaACValues };
+
+	// Scale factors of the AAN forward DCT, cos(k*PI/16) * sqrt(2) for k > 0
+	static const float s_AANScales[8] = {
+		1.0f, 1.387039845f, 1.306562965f, 1.175875602f,
+		1.0f, 0.785694958f, 0.541196100f, 0.275899379f
+	};
+
+	static void buildQuantizationTable(const uint8_t* pBaseTable, uint32_t nQuality, uint8_t* pZigZagTable, float* pDivisors)
+	{
+		// Same quality scaling as the IJG reference implementation
+		uint32_t nScale = (nQuality < 50) ? (5000 / nQuality) : (200 - nQuality * 2);
+
+		uint32_t nNaturalTable[64];
+		for (uint32_t nIndex = 0; nIndex < 64; nIndex++) {
+			uint32_t nValue = (pBaseTable[nIndex] * nScale + 50) / 100;
+			nNaturalTable[nIndex] = std::min<uint32_t>(std::max<uint32_t>(nValue, 1), 255);
+			pZigZagTable[s_ZigZag[nIndex]] = (uint8_t)nNaturalTable[nIndex];
+		}
+
+		// The DCT leaves coefficient (v, u) at position u * 8 + v
+		for (uint32_t nU = 0; nU < 8; nU++) {
+			for (uint32_t nV = 0; nV < 8; nV++) {
+				uint32_t nNaturalIndex = nV * 8 + nU;
+				pDivisors[nU * 8 + nV] = 1.0f / ((float)nNaturalTable[nNaturalIndex] * s_AANScales[nU] * s_AANScales[nV] * 8.0f);
+			}
+		}
+	}
+
+	static float clampSample(float fValue)
+	{
+		return std::min(std::max(fValue, -128.0f), 127.0f);
+	}
+
+	CJPEGEncoderTables::CJPEGEncoderTables(uint32_t nQuality)
+		: m_nQuality (nQuality)
+	{
+		if ((nQuality < 1) || (nQuality > 100))
+			throw std::runtime_error("invalid JPEG quality: " + std::to_string(nQuality));
+
+		for (uint32_t nU = 0; nU < 8; nU++)
+			for (uint32_t nV = 0; nV < 8; nV++)
+				m_ZigZagIndex[nU * 8 + nV] = s_ZigZag[nV * 8 + nU];
+
+		buildQuantizationTable(s_DefaultLumaQuantization, nQuality, m_LumaQuantization, m_LumaDivisors);
+		buildQuantizationTable(s_DefaultChromaQuantization, nQuality, m_ChromaQuantization, m_ChromaDivisors);
+
+		// Huffman codes as derived in ITU T.81 Annex C
+		for (uint32_t nTableIndex = 0; nTableIndex < 4; nTableIndex++) {
+			auto& table = m_HuffmanTables[nTableIndex];
+			memset(&table, 0, sizeof(table));
+
+			uint32_t nCode = 0;
+			uint32_t nValueIndex = 0;
+			for (uint32_t nLength = 1; nLength <= 16; nLength++) {
+				for (uint32_t nCount = 0; nCount < s_HuffmanBits[nTableIndex][nLength - 1]; nCount++) {
+					uint8_t nSymbol = s_HuffmanValues[nTableIndex][nValueIndex];
+					table.m_nCode[nSymbol] = (uint16_t)nCode;
+					table.m_nLength[nSymbol] = (uint8_t)nLength;
+					nValueIndex++;
+					nCode++;
+				}
+				nCode <<= 1;
+			}
+		}
+
+		for (uint32_t nValue = 0; nValue < 256; nValue++) {
+			float fValue = (float)nValue;
+			m_RGBToY[0][nValue] = 0.299f * fValue - 128.0f;
+			m_RGBToY[1][nValue] = 0.587f * fValue;
+			m_RGBToY[2][nValue] = 0.114f * fValue;
+			m_RGBToCb[0][nValue] = -0.168736f * fValue;
+			m_RGBToCb[1][nValue] = -0.331264f * fValue;
+			m_RGBToCb[2][nValue] = 0.5f * fValue;
+			m_RGBToCr[0][nValue] = 0.5f * fValue;
+			m_RGBToCr[1][nValue] = -0.418688f * fValue;
+			m_RGBToCr[2][nValue] = -0.081312f * fValue;
+
+			m_VideoLuma[nValue] = clampSample((fValue - 16.0f) * (255.0f / 219.0f) - 128.0f);
+			m_VideoChroma[nValue] = clampSample((fValue - 128.0f) * (255.0f / 224.0f));
+		}
+
+		m_BitLength[0] = 0;
+		for (uint32_t nValue = 1; nValue <= JPEGENCODER_MAXCOEFFICIENT; nValue++) {
+			uint32_t nBits = 0;
+			while ((nValue >> nBits) != 0)
+				nBits++;
+			m_BitLength[nValue] = (uint8_t)nBits;
+		}
+	}
+
+	uint32_t CJPEGEncoderTables::getQuality()
+	{
+		return m_nQuality;
+	}
+
+
+#ifdef JPEGENCODER_USESSE2
+
+	// One dimensional AAN forward DCT over the eight vectors, i.e. along the columns of four lanes.
+	static inline void forwardDCT8_SSE2(__m128* pData)
+	{
+		const __m128 c0_707 = _mm_set1_ps(0.707106781f);
+		const __m128 c0_382 = _mm_set1_ps(0.382683433f);
+		const __m128 c0_541 = _mm_set1_ps(0.541196100f);
+		const __m128 c1_306 = _mm_set1_ps(1.306562965f);
+
+		__m128 tmp0 = _mm_add_ps(pData[0], pData[7]);
+		__m128 tmp7 = _mm_sub_ps(pData[0], pData[7]);
+		__m128 tmp1 = _mm_add_ps(pData[1], pData[6]);
+		__m128 tmp6 = _mm_sub_ps(pData[1], pData[6]);
+		__m128 tmp2 = _mm_add_ps(pData[2], pData[5]);
+		__m128 tmp5 = _mm_sub_ps(pData[2], pData[5]);
+		__m128 tmp3 = _mm_add_ps(pData[3], pData[4]);
+		__m128 tmp4 = _mm_sub_ps(pData[3], pData[4]);
+
+		// Even part
+		__m128 tmp10 = _mm_add_ps(tmp0, tmp3);
+		__m128 tmp13 = _mm_sub_ps(tmp0, tmp3);
+		__m128 tmp11 = _mm_add_ps(tmp1, tmp2);
+		__m128 tmp12 = _mm_sub_ps(tmp1, tmp2);
+
+		pData[0] = _mm_add_ps(tmp10, tmp11);
+		pData[4] = _mm_sub_ps(tmp10, tmp11);
+
+		__m128 z1 = _mm_mul_ps(_mm_add_ps(tmp12, tmp13), c0_707);
+		pData[2] = _mm_add_ps(tmp13, z1);
+		pData[6] = _mm_sub_ps(tmp13, z1);
+
+		// Odd part
+		tmp10 = _mm_add_ps(tmp4, tmp5);
+		tmp11 = _mm_add_ps(tmp5, tmp6);
+		tmp12 = _mm_add_ps(tmp6, tmp7);
+
+		__m128 z5 = _mm_mul_ps(_mm_sub_ps(tmp10, tmp12), c0_382);
+		__m128 z2 = _mm_add_ps(_mm_mul_ps(tmp10, c0_541), z5);
+		__m128 z4 = _mm_add_ps(_mm_mul_ps(tmp12, c1_306), z5);
+		__m128 z3 = _mm_mul_ps(tmp11, c0_707);
+
+		__m128 z11 = _mm_add_ps(tmp7, z3);
+		__m128 z13 = _mm_sub_ps(tmp7, z3);
+
+		pData[5] = _mm_add_ps(z13, z2);
+		pData[3] = _mm_sub_ps(z13, z2);
+		pData[1] = _mm_add_ps(z11, z4);
+		pData[7] = _mm_sub_ps(z11, z4);
+	}
+
+	// Two dimensional DCT and quantization of a row major block. Coefficients end up transposed,
+	// which the divisor and zigzag tables account for.
+	static void forwardDCTAndQuantize(float* pBlock, const float* pDivisors, const uint8_t* pZigZagIndex, int32_t* pCoefficients)
+	{
+		__m128 leftHalf[8];
+		__m128 rightHalf[8];
+		for (uint32_t nRow = 0; nRow < 8; nRow++) {
+			leftHalf[nRow] = _mm_load_ps(&pBlock[nRow * 8]);
+			rightHalf[nRow] = _mm_load_ps(&pBlock[nRow * 8 + 4]);
+		}
+
+		forwardDCT8_SSE2(leftHalf);
+		forwardDCT8_SSE2(rightHalf);
+
+		// Transpose the four 4x4 quadrants and swap the off diagonal ones
+		_MM_TRANSPOSE4_PS(leftHalf[0], leftHalf[1], leftHalf[2], leftHalf[3]);
+		_MM_TRANSPOSE4_PS(rightHalf[0], rightHalf[1], rightHalf[2], rightHalf[3]);
+		_MM_TRANSPOSE4_PS(leftHalf[4], leftHalf[5], leftHalf[6], leftHalf[7]);
+		_MM_TRANSPOSE4_PS(rightHalf[4], rightHalf[5], rightHalf[6], rightHalf[7]);
+		for (uint32_t nRow = 0; nRow < 4; nRow++)
+			std::swap(rightHalf[nRow], leftHalf[nRow + 4]);
+
+		forwardDCT8_SSE2(leftHalf);
+		forwardDCT8_SSE2(rightHalf);
+
+		alignas(16) int32_t nQuantized[64];
+		for (uint32_t nRow = 0; nRow < 8; nRow++) {
+			__m128 leftDivisors = _mm_loadu_ps(&pDivisors[nRow * 8]);
+			__m128 rightDivisors = _mm_loadu_ps(&pDivisors[nRow * 8 + 4]);
+			_mm_store_si128((__m128i*) & nQuantized[nRow * 8], _mm_cvtps_epi32(_mm_mul_ps(leftHalf[nRow], leftDivisors)));
+			_mm_store_si128((__m128i*) & nQuantized[nRow * 8 + 4], _mm_cvtps_epi32(_mm_mul_ps(rightHalf[nRow], rightDivisors)));
+		}
+
+		for (uint32_t nIndex = 0; nIndex < 64; nIndex++)
+			pCoefficients[pZigZagIndex[nIndex]] = nQuantized[nIndex];
+	}
+
+#else
+
+	static inline void forwardDCT8(float* pData, uint32_t nStride, float* pOutput, uint32_t nOutputStride)
+	{
+		float tmp0 = pData[0] + pData[7 * nStride];
+		float tmp7 = pData[0] - pData[7 * nStride];
+		float tmp1 = pData[nStride] + pData[6 * nStride];
+		float tmp6 = pData[nStride] - pData[6 * nStride];
+		float tmp2 = pData[2 * nStride] + pData[5 * nStride];
+		float tmp5 = pData[2 * nStride] - pData[5 * nStride];
+		float tmp3 = pData[3 * nStride] + pData[4 * nStride];
+		float tmp4 = pData[3 * nStride] - pData[4 * nStride];
+
+		// Even part
+		float tmp10 = tmp0 + tmp3;
+		float tmp13 = tmp0 - tmp3;
+		float tmp11 = tmp1 + tmp2;
+		float tmp12 = tmp1 - tmp2;
+
+		pOutput[0] = tmp10 + tmp11;
+		pOutput[4 * nOutputStride] = tmp10 - tmp11;
+
+		float z1 = (tmp12 + tmp13) * 0.707106781f;
+		pOutput[2 * nOutputStride] = tmp13 + z1;
+		pOutput[6 * nOutputStride] = tmp13 - z1;
+
+		// Odd part
+		tmp10 = tmp4 + tmp5;
+		tmp11 = tmp5 + tmp6;
+		tmp12 = tmp6 + tmp7;
+
+		float z5 = (tmp10 - tmp12) * 0.382683433f;
+		float z2 = 0.541196100f * tmp10 + z5;
+		float z4 = 1.306562965f * tmp12 + z5;
+		float z3 = tmp11 * 0.707106781f;
+
+		float z11 = tmp7 + z3;
+		float z13 = tmp7 - z3;
+
+		pOutput[5 * nOutputStride] = z13 + z2;
+		pOutput[3 * nOutputStride] = z13 - z2;
+		pOutput[nOutputStride] = z11 + z4;
+		pOutput[7 * nOutputStride] = z11 - z4;
+	}
+
+	// Same transposed coefficient layout as the SSE2 path.
+	static void forwardDCTAndQuantize(float* pBlock, const float* pDivisors, const uint8_t* pZigZagIndex, int32_t* pCoefficients)
+	{
+		for (uint32_t nColumn = 0; nColumn < 8; nColumn++)
+			forwardDCT8(&pBlock[nColumn], 8, &pBlock[nColumn], 8);
+
+		float transposed[64];
+		for (uint32_t nRow = 0; nRow < 8; nRow++)
+			forwardDCT8(&pBlock[nRow * 8], 1, &transposed[nRow], 8);
+
+		for (uint32_t nIndex = 0; nIndex < 64; nIndex++) {
+			float fValue = transposed[nIndex] * pDivisors[nIndex];
+			pCoefficients[pZigZagIndex[nIndex]] = (int32_t)((fValue < 0.0f) ? (fValue - 0.5f) : (fValue + 0.5f));
+		}
+	}
+
+#endif
+
+
+	static std::mutex s_EncoderPoolMutex;
+	static std::map<uint32_t, PJPEGEncoderTables> s_EncoderTableCache;
+	static std::vector<std::unique_ptr<CJPEGStreamEncoder>> s_EncoderPool;
+
+	CJPEGStreamEncoder::CJPEGStreamEncoder(uint32_t nQuality)
+		: m_nOutputPosition (0),
+		m_nBitBuffer (0),
+		m_nBitCount (0),
+		m_nHeaderWidth (0),
+		m_nHeaderHeight (0),
+		m_HeaderInputFormat (eJPEGEncoderInputFormat::ifGreyScale8bit)
+	{
+		m_pTables = getTables(nQuality);
+	}
+
+	CJPEGStreamEncoder::~CJPEGStreamEncoder()
+	{
+
+	}
+
+	uint32_t CJPEGStreamEncoder::getQuality()
+	{
+		return m_pTables->getQuality();
+	}
+
+	PJPEGEncoderTables CJPEGStreamEncoder::getTables(uint32_t nQuality)
+	{
+		std::lock_guard<std::mutex> lockGuard(s_EncoderPoolMutex);
+
+		auto iIter = s_EncoderTableCache.find(nQuality);
+		if (iIter != s_EncoderTableCache.end())
+			return iIter->second;
+
+		auto pTables = std::make_shared<CJPEGEncoderTables>(nQuality);
+		s_EncoderTableCache.insert(std::make_pair(nQuality, pTables));
+		return pTables;
+	}
+
+	std::unique_ptr<CJPEGStreamEncoder> CJPEGStreamEncoder::acquireEncoder(uint32_t nQuality)
+	{
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EncoderPoolMutex);
+			for (auto iIter = s_EncoderPool.begin(); iIter != s_EncoderPool.end(); iIter++) {
+				if ((*iIter)->getQuality() == nQuality) {
+					std::unique_ptr<CJPEGStreamEncoder> pEncoder = std::move(*iIter);
+					s_EncoderPool.erase(iIter);
+					return pEncoder;
+				}
+			}
+		}
+
+		return std::unique_ptr<CJPEGStreamEncoder>(new CJPEGStreamEncoder(nQuality));
+	}
+
+	void CJPEGStreamEncoder::releaseEncoder(std::unique_ptr<CJPEGStreamEncoder> pEncoder)
+	{
+		if (pEncoder.get() == nullptr)
+			return;
+
+		std::lock_guard<std::mutex> lockGuard(s_EncoderPoolMutex);
+		if (s_EncoderPool.size() < JPEGENCODER_MAXPOOLEDENCODERS)
+			s_EncoderPool.push_back(std::move(pEncoder));
+	}
+
+	uint64_t CJPEGStreamEncoder::getInputSize(uint32_t nWidth, uint32_t nHeight, eJPEGEncoderInputFormat inputFormat)
+	{
+		uint64_t nPixelCount = (uint64_t)nWidth * (uint64_t)nHeight;
+		switch (inputFormat) {
+		case eJPEGEncoderInputFormat::ifGreyScale8bit: return nPixelCount;
+		case eJPEGEncoderInputFormat::ifGreyScaleAlpha16bit: return nPixelCount * 2;
+		case eJPEGEncoderInputFormat::ifRGB24bit: return nPixelCount * 3;
+		case eJPEGEncoderInputFormat::ifRGBA32bit: return nPixelCount * 4;
+		case eJPEGEncoderInputFormat::ifYUY2: return nPixelCount * 2;
+		default:
+			throw std::runtime_error("invalid JPEG encoder input format: " + std::to_string((uint32_t)inputFormat));
+		}
+	}
+
+	static void writeHeaderWord(std::vector<uint8_t>& buffer, uint32_t nValue)
+	{
+		buffer.push_back((uint8_t)(nValue >> 8));
+		buffer.push_back((uint8_t)(nValue & 0xff));
+	}
+
+	void CJPEGStreamEncoder::buildHeader(uint32_t nWidth, uint32_t nHeight, eJPEGEncoderInputFormat inputFormat)
+	{
+		if ((m_nHeaderWidth == nWidth) && (m_nHeaderHeight == nHeight) && (m_HeaderInputFormat == inputFormat) && (!m_HeaderCache.empty()))
+			return;
+
+		bool bIsGreyScale = (inputFormat == eJPEGEncoderInputFormat::ifGreyScale8bit) || (inputFormat == eJPEGEncoderInputFormat::ifGreyScaleAlpha16bit);
+		uint32_t nComponentCount = bIsGreyScale ? 1 : 3;
+		uint32_t nTableCount = bIsGreyScale ? 1 : 2;
+
+		std::vector<uint8_t>& header = m_HeaderCache;
+		header.clear();
+
+		// SOI and JFIF APP0 segment
+		writeHeaderWord(header, 0xffd8);
+		writeHeaderWord(header, 0xffe0);
+		writeHeaderWord(header, 16);
+		const uint8_t jfifIdentifier[5] = { 'J', 'F', 'I', 'F', 0 };
+		header.insert(header.end(), jfifIdentifier, jfifIdentifier + 5);
+		writeHeaderWord(header, 0x0101);
+		header.push_back(0); // No density units
+		writeHeaderWord(header, 1);
+		writeHeaderWord(header, 1);
+		header.push_back(0);
+		header.push_back(0);
+
+		// Quantization tables
+		writeHeaderWord(header, 0xffdb);
+		writeHeaderWord(header, 2 + nTableCount * 65);
+		header.push_back(0);
+		header.insert(header.end(), m_pTables->m_LumaQuantization, m_pTables->m_LumaQuantization + 64);
+		if (!bIsGreyScale) {
+			header.push_back(1);
+			header.insert(header.end(), m_pTables->m_ChromaQuantization, m_pTables->m_ChromaQuantization + 64);
+		}
+
+		// Baseline frame
+		writeHeaderWord(header, 0xffc0);
+		writeHeaderWord(header, 8 + 3 * nComponentCount);
+		header.push_back(8);
+		writeHeaderWord(header, nHeight);
+		writeHeaderWord(header, nWidth);
+		header.push_back((uint8_t)nComponentCount);
+		for (uint32_t nComponent = 0; nComponent < nComponentCount; nComponent++) {
+			header.push_back((uint8_t)(nComponent + 1));
+			if ((nComponent == 0) && (inputFormat == eJPEGEncoderInputFormat::ifYUY2))
+				header.push_back(0x21);
+			else
+				header.push_back(0x11);
+			header.push_back((nComponent == 0) ? 0 : 1);
+		}
+
+		// Huffman tables
+		uint32_t nHuffmanSegmentLength = 2;
+		for (uint32_t nTableIndex = 0; nTableIndex < nTableCount * 2; nTableIndex++) {
+			nHuffmanSegmentLength += 17;
+			for (uint32_t nLength = 0; nLength < 16; nLength++)
+				nHuffmanSegmentLength += s_HuffmanBits[nTableIndex][nLength];
+		}
+
+		writeHeaderWord(header, 0xffc4);
+		writeHeaderWord(header, nHuffmanSegmentLength);
+		for (uint32_t nTableIndex = 0; nTableIndex < nTableCount * 2; nTableIndex++) {
+			uint32_t nValueCount = 0;
+			for (uint32_t nLength = 0; nLength < 16; nLength++)
+				nValueCount += s_HuffmanBits[nTableIndex][nLength];
+
+			// Class in the high nibble (0 = DC, 1 = AC), table id in the low nibble
+			header.push_back((uint8_t)(((nTableIndex % 2) << 4) | (nTableIndex / 2)));
+			header.insert(header.end(), s_HuffmanBits[nTableIndex], s_HuffmanBits[nTableIndex] + 16);
+			header.insert(header.end(), s_HuffmanValues[nTableIndex], s_HuffmanValues[nTableIndex] + nValueCount);
+		}
+
+		// Start of scan
+		writeHeaderWord(header, 0xffda);
+		writeHeaderWord(header, 6 + 2 * nComponentCount);
+		header.push_back((uint8_t)nComponentCount);
+		for (uint32_t nComponent = 0; nComponent < nComponentCount; nComponent++) {
+			header.push_back((uint8_t)(nComponent + 1));
+			header.push_back((nComponent == 0) ? 0x00 : 0x11);
+		}
+		header.push_back(0);
+		header.push_back(63);
+		header.push_back(0);
+
+		m_nHeaderWidth = nWidth;
+		m_nHeaderHeight = nHeight;
+		m_HeaderInputFormat = inputFormat;
+	}
+
+	void CJPEGStreamEncoder::reserveOutput(size_t nBytes)
+	{
+		size_t nRequiredSize = m_nOutputPosition + nBytes;
+		if (nRequiredSize > m_OutputBuffer.size())
+			m_OutputBuffer.resize(std::max(nRequiredSize, m_OutputBuffer.size() * 2));
+	}
+
+	inline void CJPEGStreamEncoder::writeBits(uint32_t nBits, uint32_t nBitCount)
+	{
+		m_nBitBuffer = (m_nBitBuffer << nBitCount) | nBits;
+		m_nBitCount += nBitCount;
+
+		if (m_nBitCount >= 32) {
+			m_nBitCount -= 32;
+			uint32_t nWord = (uint32_t)(m_nBitBuffer >> m_nBitCount);
+			uint8_t* pTarget = &m_OutputBuffer[m_nOutputPosition];
+
+			for (uint32_t nShift = 32; nShift > 0; nShift -= 8) {
+				uint8_t nByte = (uint8_t)(nWord >> (nShift - 8));
+				*pTarget = nByte;
+				pTarget++;
+				// Byte stuffing, so that entropy coded data never forms a marker
+				if (nByte == 0xff) {
+					*pTarget = 0;
+					pTarget++;
+				}
+			}
+
+			m_nOutputPosition = pTarget - m_OutputBuffer.data();
+		}
+	}
+
+	void CJPEGStreamEncoder::flushBits()
+	{
+		// Pad the last byte with one bits
+		uint32_t nPadding = (8 - (m_nBitCount % 8)) % 8;
+		if (nPadding > 0)
+			writeBits((1u << nPadding) - 1, nPadding);
+
+		reserveOutput(16);
+		while (m_nBitCount > 0) {
+			m_nBitCount -= 8;
+			uint8_t nByte = (uint8_t)(m_nBitBuffer >> m_nBitCount);
+			m_OutputBuffer[m_nOutputPosition++] = nByte;
+			if (nByte == 0xff)
+				m_OutputBuffer[m_nOutputPosition++] = 0;
+		}
+
+		m_nBitBuffer = 0;
+	}
+
+	void CJPEGStreamEncoder::encodeBlock(float* pBlock, const float* pDivisors, const sJPEGHuffmanCodeTable& dcTable, const sJPEGHuffmanCodeTable& acTable, int32_t& nPrediction)
+	{
+		int32_t nCoefficients[64];
+		forwardDCTAndQuantize(pBlock, pDivisors, m_pTables->m_ZigZagIndex, nCoefficients);
+
+		const uint8_t* pBitLength = m_pTables->m_BitLength;
+
+		int32_t nDifference = std::min(std::max(nCoefficients[0] - nPrediction, -JPEGENCODER_MAXCOEFFICIENT), JPEGENCODER_MAXCOEFFICIENT);
+		nPrediction = nCoefficients[0];
+
+		uint32_t nDCBits = pBitLength[(nDifference < 0) ? -nDifference : nDifference];
+		// Negative values are sent as their one's complement
+		uint32_t nDCValue = (uint32_t)((nDifference < 0) ? (nDifference - 1) : nDifference) & ((1u << nDCBits) - 1);
+		writeBits(((uint32_t)dcTable.m_nCode[nDCBits] << nDCBits) | nDCValue, dcTable.m_nLength[nDCBits] + nDCBits);
+
+		uint32_t nLastNonZero = 0;
+		for (uint32_t nIndex = 63; nIndex > 0; nIndex--) {
+			if (nCoefficients[nIndex] != 0) {
+				nLastNonZero = nIndex;
+				break;
+			}
+		}
+
+		uint32_t nRunLength = 0;
+		for (uint32_t nIndex = 1; nIndex <= nLastNonZero; nIndex++) {
+			int32_t nValue = nCoefficients[nIndex];
+			if (nValue == 0) {
+				nRunLength++;
+				continue;
+			}
+
+			while (nRunLength > 15) {
+				writeBits(acTable.m_nCode[0xf0], acTable.m_nLength[0xf0]);
+				nRunLength -= 16;
+			}
+
+			nValue = std::min(std::max(nValue, -JPEGENCODER_MAXACCOEFFICIENT), JPEGENCODER_MAXACCOEFFICIENT);
+			uint32_t nBits = pBitLength[(nValue < 0) ? -nValue : nValue];
+			uint32_t nSymbol = (nRunLength << 4) | nBits;
+			uint32_t nACValue = (uint32_t)((nValue < 0) ? (nValue - 1) : nValue) & ((1u << nBits) - 1);
+			writeBits(((uint32_t)acTable.m_nCode[nSymbol] << nBits) | nACValue, acTable.m_nLength[nSymbol] + nBits);
+
+			nRunLength = 0;
+		}
+
+		if (nLastNonZero < 63)
+			writeBits(acTable.m_nCode[0x00], acTable.m_nLength[0x00]);
+	}
+
+	void CJPEGStreamEncoder::encodeGreyScale(uint32_t nWidth, uint32_t nHeight, const uint8_t* pData, uint32_t nPixelStride)
+	{
+		alignas(16) float lumaBlock[64];
+		int32_t nLumaPrediction = 0;
+
+		for (uint32_t nBlockY = 0; nBlockY < nHeight; nBlockY += 8) {
+			for (uint32_t nBlockX = 0; nBlockX < nWidth; nBlockX += 8) {
+				reserveOutput(JPEGENCODER_MCURESERVE);
+
+				// Blocks beyond the image border repeat the last row and column
+				for (uint32_t nRow = 0; nRow < 8; nRow++) {
+					const uint8_t* pRow = pData + (size_t)std::min(nBlockY + nRow, nHeight - 1) * nWidth * nPixelStride;
+					for (uint32_t nColumn = 0; nColumn < 8; nColumn++) {
+						uint32_t nX = std::min(nBlockX + nColumn, nWidth - 1);
+						lumaBlock[nRow * 8 + nColumn] = (float)pRow[nX * nPixelStride] - 128.0f;
+					}
+				}
+
+				encodeBlock(lumaBlock, m_pTables->m_LumaDivisors, m_pTables->m_HuffmanTables[0], m_pTables->m_HuffmanTables[1], nLumaPrediction);
+			}
+		}
+	}
+
+	void CJPEGStreamEncoder::encodeRGB(uint32_t nWidth, uint32_t nHeight, const uint8_t* pData, uint32_t nPixelStride)
+	{
+		alignas(16) float lumaBlock[64];
+		alignas(16) float blueBlock[64];
+		alignas(16) float redBlock[64];
+		int32_t nLumaPrediction = 0;
+		int32_t nBluePrediction = 0;
+		int32_t nRedPrediction = 0;
+
+		CJPEGEncoderTables* pTables = m_pTables.get();
+
+		for (uint32_t nBlockY = 0; nBlockY < nHeight; nBlockY += 8) {
+			for (uint32_t nBlockX = 0; nBlockX < nWidth; nBlockX += 8) {
+				reserveOutput(JPEGENCODER_MCURESERVE);
+
+				for (uint32_t nRow = 0; nRow < 8; nRow++) {
+					const uint8_t* pRow = pData + (size_t)std::min(nBlockY + nRow, nHeight - 1) * nWidth * nPixelStride;
+					for (uint32_t nColumn = 0; nColumn < 8; nColumn++) {
+						const uint8_t* pPixel = pRow + std::min(nBlockX + nColumn, nWidth - 1) * nPixelStride;
+						uint32_t nIndex = nRow * 8 + nColumn;
+						lumaBlock[nIndex] = pTables->m_RGBToY[0][pPixel[0]] + pTables->m_RGBToY[1][pPixel[1]] + pTables->m_RGBToY[2][pPixel[2]];
+						blueBlock[nIndex] = pTables->m_RGBToCb[0][pPixel[0]] + pTables->m_RGBToCb[1][pPixel[1]] + pTables->m_RGBToCb[2][pPixel[2]];
+						redBlock[nIndex] = pTables->m_RGBToCr[0][pPixel[0]] + pTables->m_RGBToCr[1][pPixel[1]] + pTables->m_RGBToCr[2][pPixel[2]];
+					}
+				}
+
+				encodeBlock(lumaBlock, pTables->m_LumaDivisors, pTables->m_HuffmanTables[0], pTables->m_HuffmanTables[1], nLumaPrediction);
+				encodeBlock(blueBlock, pTables->m_ChromaDivisors, pTables->m_HuffmanTables[2], pTables->m_HuffmanTables[3], nBluePrediction);
+				encodeBlock(redBlock, pTables->m_ChromaDivisors, pTables->m_HuffmanTables[2], pTables->m_HuffmanTables[3], nRedPrediction);
+			}
+		}
+	}
+
+	void CJPEGStreamEncoder::encodeYUY2(uint32_t nWidth, uint32_t nHeight, const uint8_t* pData)
+	{
+		alignas(16) float leftLumaBlock[64];
+		alignas(16) float rightLumaBlock[64];
+		alignas(16) float blueBlock[64];
+		alignas(16) float redBlock[64];
+		int32_t nLumaPrediction = 0;
+		int32_t nBluePrediction = 0;
+		int32_t nRedPrediction = 0;
+
+		CJPEGEncoderTables* pTables = m_pTables.get();
+		uint32_t nPairCount = nWidth / 2;
+
+		// One MCU covers 16x8 pixels: two luma blocks and one block of each horizontally subsampled chroma channel
+		for (uint32_t nBlockY = 0; nBlockY < nHeight; nBlockY += 8) {
+			for (uint32_t nBlockX = 0; nBlockX < nWidth; nBlockX += 16) {
+				reserveOutput(JPEGENCODER_MCURESERVE);
+
+				for (uint32_t nRow = 0; nRow < 8; nRow++) {
+					const uint8_t* pRow = pData + (size_t)std::min(nBlockY + nRow, nHeight - 1) * nWidth * 2;
+					for (uint32_t nColumn = 0; nColumn < 8; nColumn++) {
+						// Each pair of pixels is stored as Y0 U Y1 V
+						const uint8_t* pPair = pRow + (size_t)std::min(nBlockX / 2 + nColumn, nPairCount - 1) * 4;
+						uint32_t nIndex = nRow * 8 + nColumn;
+						blueBlock[nIndex] = pTables->m_VideoChroma[pPair[1]];
+						redBlock[nIndex] = pTables->m_VideoChroma[pPair[3]];
+					}
+
+					for (uint32_t nColumn = 0; nColumn < 8; nColumn++) {
+						uint32_t nLeftX = std::min(nBlockX + nColumn, nWidth - 1);
+						uint32_t nRightX = std::min(nBlockX + 8 + nColumn, nWidth - 1);
+						leftLumaBlock[nRow * 8 + nColumn] = pTables->m_VideoLuma[pRow[nLeftX * 2]];
+						rightLumaBlock[nRow * 8 + nColumn] = pTables->m_VideoLuma[pRow[nRightX * 2]];
+					}
+				}
+
+				encodeBlock(leftLumaBlock, pTables->m_LumaDivisors, pTables->m_HuffmanTables[0], pTables->m_HuffmanTables[1], nLumaPrediction);
+				encodeBlock(rightLumaBlock, pTables->m_LumaDivisors, pTables->m_HuffmanTables[0], pTables->m_HuffmanTables[1], nLumaPrediction);
+				encodeBlock(blueBlock, pTables->m_ChromaDivisors, pTables->m_HuffmanTables[2], pTables->m_HuffmanTables[3], nBluePrediction);
+				encodeBlock(redBlock, pTables->m_ChromaDivisors, pTables->m_HuffmanTables[2], pTables->m_HuffmanTables[3], nRedPrediction);
+			}
+		}
+	}
+
+	const std::vector<uint8_t>& CJPEGStreamEncoder::encode(uint32_t nWidth, uint32_t nHeight, eJPEGEncoderInputFormat inputFormat, const uint8_t* pData, uint64_t nDataSize)
+	{
+		if (pData == nullptr)
+			throw std::runtime_error("invalid JPEG image data parameter");
+
+		if ((nWidth == 0) || (nHeight == 0) || (nWidth > JPEGENCODER_MAXIMAGESIZE) || (nHeight > JPEGENCODER_MAXIMAGESIZE))
+			throw std::runtime_error("invalid JPEG image size: " + std::to_string(nWidth) + "/" + std::to_string(nHeight));
+
+		if ((inputFormat == eJPEGEncoderInputFormat::ifYUY2) && ((nWidth % 2) != 0))
+			throw std::runtime_error("YUY2 image width must be even: " + std::to_string(nWidth));
+
+		if (nDataSize < getInputSize(nWidth, nHeight, inputFormat))
+			throw std::runtime_error("JPEG image data buffer too small: " + std::to_string(nDataSize));
+
+		buildHeader(nWidth, nHeight, inputFormat);
+
+		// Keep the buffer's size from earlier frames, so that a stream of frames does not reallocate
+		if (m_OutputBuffer.size() < m_HeaderCache.size() + JPEGENCODER_MCURESERVE)
+			m_OutputBuffer.resize(m_HeaderCache.size() + std::max<size_t>(JPEGENCODER_MCURESERVE, (size_t)nWidth * nHeight / 4));
+		else
+			m_OutputBuffer.resize(m_OutputBuffer.capacity());
+
+		memcpy(m_OutputBuffer.data(), m_HeaderCache.data(), m_HeaderCache.size());
+		m_nOutputPosition = m_HeaderCache.size();
+		m_nBitBuffer = 0;
+		m_nBitCount = 0;
+
+		switch (inputFormat) {
+		case eJPEGEncoderInputFormat::ifGreyScale8bit:
+			encodeGreyScale(nWidth, nHeight, pData, 1);
+			break;
+		case eJPEGEncoderInputFormat::ifGreyScaleAlpha16bit:
+			encodeGreyScale(nWidth, nHeight, pData, 2);
+			break;
+		case eJPEGEncoderInputFormat::ifRGB24bit:
+			encodeRGB(nWidth, nHeight, pData, 3);
+			break;
+		case eJPEGEncoderInputFormat::ifRGBA32bit:
+			encodeRGB(nWidth, nHeight, pData, 4);
+			break;
+		case eJPEGEncoderInputFormat::ifYUY2:
+			encodeYUY2(nWidth, nHeight, pData);
+			break;
+		default:
+			throw std::runtime_error("invalid JPEG encoder input format: " + std::to_string((uint32_t)inputFormat));
+		}
+
+		flushBits();
+
+		// EOI
+		m_OutputBuffer[m_nOutputPosition++] = 0xff;
+		m_OutputBuffer[m_nOutputPosition++] = 0xd9;
+
+		m_OutputBuffer.resize(m_nOutputPosition);
+		return m_OutputBuffer;
+	}
+
+}
@@ -0,0 +1,154 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#ifndef __AMC_JPEGENCODER
+#define __AMC_JPEGENCODER
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+#define JPEGENCODER_DEFAULTQUALITY 95
+#define JPEGENCODER_MAXPOOLEDENCODERS 8
+#define JPEGENCODER_MAXIMAGESIZE 65535
+#define JPEGENCODER_MAXCOEFFICIENT 2047
+
+namespace AMCCommon {
+
+	enum class eJPEGEncoderInputFormat : uint32_t
+	{
+		ifGreyScale8bit = 1,
+		ifGreyScaleAlpha16bit = 2,
+		ifRGB24bit = 3,
+		ifRGBA32bit = 4,
+		ifYUY2 = 5 // Video range YCbCr 4:2:2, encoded as 2h1v chroma subsampled JPEG.
+	};
+
+	typedef struct {
+		uint16_t m_nCode[256];
+		uint8_t m_nLength[256];
+	} sJPEGHuffmanCodeTable;
+
+	// Quantization, Huffman and color conversion tables of one quality level.
+	// They are immutable after construction and shared between all encoders of that quality.
+	class CJPEGEncoderTables {
+	public:
+		// Quantization tables in zigzag order, as they are written into the DQT segment
+		uint8_t m_LumaQuantization[64];
+		uint8_t m_ChromaQuantization[64];
+
+		// Reciprocal divisors including the AAN scale factors, in the transposed layout of the DCT output
+		float m_LumaDivisors[64];
+		float m_ChromaDivisors[64];
+
+		// Zigzag position of each coefficient in the transposed layout of the DCT output
+		uint8_t m_ZigZagIndex[64];
+
+		// Huffman tables: luma DC, luma AC, chroma DC, chroma AC
+		sJPEGHuffmanCodeTable m_HuffmanTables[4];
+
+		// RGB to YCbCr contributions of each channel value, with the luma level shift folded into the red table
+		float m_RGBToY[3][256];
+		float m_RGBToCb[3][256];
+		float m_RGBToCr[3][256];
+
+		// Video range to full range expansion, with level shift
+		float m_VideoLuma[256];
+		float m_VideoChroma[256];
+
+		// Number of magnitude bits of a coefficient value
+		uint8_t m_BitLength[JPEGENCODER_MAXCOEFFICIENT + 1];
+
+		CJPEGEncoderTables(uint32_t nQuality);
+
+		uint32_t getQuality();
+
+	private:
+		uint32_t m_nQuality;
+	};
+
+	typedef std::shared_ptr<CJPEGEncoderTables> PJPEGEncoderTables;
+
+
+	// Baseline JPEG encoder that keeps its tables, headers and output buffer across frames.
+	// An instance is not thread safe, but any number of instances may encode in parallel.
+	class CJPEGStreamEncoder {
+	private:
+		PJPEGEncoderTables m_pTables;
+
+		std::vector<uint8_t> m_OutputBuffer;
+		size_t m_nOutputPosition;
+		uint64_t m_nBitBuffer;
+		uint32_t m_nBitCount;
+
+		// Headers only depend on size and input format, so they are built once per stream
+		uint32_t m_nHeaderWidth;
+		uint32_t m_nHeaderHeight;
+		eJPEGEncoderInputFormat m_HeaderInputFormat;
+		std::vector<uint8_t> m_HeaderCache;
+
+		void buildHeader(uint32_t nWidth, uint32_t nHeight, eJPEGEncoderInputFormat inputFormat);
+
+		void reserveOutput(size_t nBytes);
+		void writeBits(uint32_t nBits, uint32_t nBitCount);
+		void flushBits();
+
+		void encodeBlock(float* pBlock, const float* pDivisors, const sJPEGHuffmanCodeTable& dcTable, const sJPEGHuffmanCodeTable& acTable, int32_t& nPrediction);
+
+		void encodeGreyScale(uint32_t nWidth, uint32_t nHeight, const uint8_t* pData, uint32_t nPixelStride);
+		void encodeRGB(uint32_t nWidth, uint32_t nHeight, const uint8_t* pData, uint32_t nPixelStride);
+		void encodeYUY2(uint32_t nWidth, uint32_t nHeight, const uint8_t* pData);
+
+	public:
+
+		CJPEGStreamEncoder(uint32_t nQuality);
+
+		virtual ~CJPEGStreamEncoder();
+
+		uint32_t getQuality();
+
+		// Encodes one frame. The returned buffer is owned by the encoder and overwritten by the next call.
+		const std::vector<uint8_t>& encode(uint32_t nWidth, uint32_t nHeight, eJPEGEncoderInputFormat inputFormat, const uint8_t* pData, uint64_t nDataSize);
+
+		static uint64_t getInputSize(uint32_t nWidth, uint32_t nHeight, eJPEGEncoderInputFormat inputFormat);
+
+		// Tables are computed once per quality level and shared.
+		static PJPEGEncoderTables getTables(uint32_t nQuality);
+
+		// Hands out a pooled encoder, so that short lived callers keep their scratch buffers across frames.
+		static std::unique_ptr<CJPEGStreamEncoder> acquireEncoder(uint32_t nQuality);
+		static void releaseEncoder(std::unique_ptr<CJPEGStreamEncoder> pEncoder);
+	};
+
+}
+
+#endif //__AMC_JPEGENCODER
@@ -0,0 +1,165 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "common_memorymappedfile.hpp"
+#include "common_utils.hpp"
+
+#include <string>
+#include <exception>
+#include <stdexcept>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+namespace AMCCommon {
+
+
+	CMemoryMappedFile::CMemoryMappedFile(const std::string& sUTF8Filename)
+		: m_pData (nullptr), m_nSize (0)
+#ifdef _WIN32
+		, m_hFile (INVALID_HANDLE_VALUE), m_hMapping (nullptr)
+#else
+		, m_nFileDescriptor (-1)
+#endif
+	{
+#ifdef _WIN32
+		std::wstring sUTF16FileName = CUtils::UTF8toUTF16(sUTF8Filename);
+		HANDLE hFile = CreateFileW(sUTF16FileName.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (hFile == INVALID_HANDLE_VALUE)
+			throw std::runtime_error("could not open file: " + sUTF8Filename);
+		m_hFile = hFile;
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(hFile, &fileSize)) {
+			CloseHandle(hFile);
+			throw std::runtime_error("could not retrieve file size: " + sUTF8Filename);
+		}
+		m_nSize = (uint64_t)fileSize.QuadPart;
+
+		if (m_nSize > 0) {
+			HANDLE hMapping = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (hMapping == nullptr) {
+				CloseHandle(hFile);
+				throw std::runtime_error("could not map file: " + sUTF8Filename);
+			}
+			m_hMapping = hMapping;
+
+			m_pData = (const uint8_t*)MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+			if (m_pData == nullptr) {
+				CloseHandle(hMapping);
+				CloseHandle(hFile);
+				throw std::runtime_error("could not map file: " + sUTF8Filename);
+			}
+		}
+#else
+		int nFileDescriptor = open(sUTF8Filename.c_str(), O_RDONLY);
+		if (nFileDescriptor < 0)
+			throw std::runtime_error("could not open file: " + sUTF8Filename);
+		m_nFileDescriptor = nFileDescriptor;
+
+		struct stat fileStat;
+		if (fstat(nFileDescriptor, &fileStat) != 0) {
+			close(nFileDescriptor);
+			throw std::runtime_error("could not retrieve file size: " + sUTF8Filename);
+		}
+		m_nSize = (uint64_t)fileStat.st_size;
+
+		if (m_nSize > 0) {
+			void* pMapping = mmap(nullptr, (size_t)m_nSize, PROT_READ, MAP_SHARED, nFileDescriptor, 0);
+			if (pMapping == MAP_FAILED) {
+				close(nFileDescriptor);
+				throw std::runtime_error("could not map file: " + sUTF8Filename);
+			}
+			m_pData = (const uint8_t*)pMapping;
+		}
+#endif
+	}
+
+	CMemoryMappedFile::~CMemoryMappedFile()
+	{
+#ifdef _WIN32
+		if (m_pData != nullptr)
+			UnmapViewOfFile(m_pData);
+		if (m_hMapping != nullptr)
+			CloseHandle((HANDLE)m_hMapping);
+		if (m_hFile != INVALID_HANDLE_VALUE)
+			CloseHandle((HANDLE)m_hFile);
+#else
+		if (m_pData != nullptr)
+			munmap((void*)m_pData, (size_t)m_nSize);
+		if (m_nFileDescriptor >= 0)
+			close(m_nFileDescriptor);
+#endif
+		m_pData = nullptr;
+		m_nSize = 0;
+	}
+
+	const uint8_t* CMemoryMappedFile::getData()
+	{
+		return m_pData;
+	}
+
+	uint64_t CMemoryMappedFile::getSize()
+	{
+		return m_nSize;
+	}
+
+	const uint8_t* CMemoryMappedFile::getRange(const uint64_t nOffset, const uint64_t nLength)
+	{
+		if ((nOffset > m_nSize) || (nLength > (m_nSize - nOffset)))
+			throw std::runtime_error("memory mapped range exceeds file size");
+
+		if (nLength == 0)
+			return nullptr;
+
+		return m_pData + nOffset;
+	}
+
+	void CMemoryMappedFile::readRange(const uint64_t nOffset, uint8_t* pBuffer, const uint64_t nLength)
+	{
+		if (nLength == 0)
+			return;
+		if (pBuffer == nullptr)
+			throw std::runtime_error("invalid buffer parameter");
+
+		const uint8_t* pSource = getRange(nOffset, nLength);
+		memcpy(pBuffer, pSource, (size_t)nLength);
+	}
+
+}
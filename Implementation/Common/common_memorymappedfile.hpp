@@ -0,0 +1,74 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCCOMMON_MEMORYMAPPEDFILE
+#define __AMCCOMMON_MEMORYMAPPEDFILE
+
+#include <string>
+#include <memory>
+#include <cstdint>
+
+
+namespace AMCCommon {
+
+	// Read-only memory mapping of a complete file. The mapping is immutable, so it may be read from any number of threads without locking.
+	class CMemoryMappedFile {
+	private:
+		const uint8_t* m_pData;
+		uint64_t m_nSize;
+
+#ifdef _WIN32
+		void* m_hFile;
+		void* m_hMapping;
+#else
+		int m_nFileDescriptor;
+#endif
+
+	public:
+
+		CMemoryMappedFile(const std::string & sUTF8Filename);
+		~CMemoryMappedFile();
+
+		const uint8_t* getData();
+		uint64_t getSize();
+
+		// Returns a pointer into the mapping, or throws if the range is not fully contained in the file.
+		const uint8_t* getRange(const uint64_t nOffset, const uint64_t nLength);
+
+		// Copies a range of the mapping into a buffer.
+		void readRange(const uint64_t nOffset, uint8_t* pBuffer, const uint64_t nLength);
+	};
+
+	typedef std::shared_ptr<CMemoryMappedFile> PMemoryMappedFile;
+
+}
+
+#endif // __AMCCOMMON_MEMORYMAPPEDFILE
@@ -0,0 +1,188 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#include "common_nativefilewriter.hpp"
+#include "common_utils.hpp"
+
+#include <string>
+#include <exception>
+#include <stdexcept>
+#include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// Upper bound for a single native write call. Larger buffers are written in several chunks.
+#define NATIVEFILEWRITER_MAXCHUNKSIZE (1024ULL * 1024ULL * 1024ULL)
+
+
+namespace AMCCommon {
+
+
+	CNativeFileWriter::CNativeFileWriter(const std::string& sUTF8Filename)
+		: m_sFileName (sUTF8Filename)
+#ifdef _WIN32
+		, m_hFile (INVALID_HANDLE_VALUE)
+#else
+		, m_nFileDescriptor (-1)
+#endif
+	{
+#ifdef _WIN32
+		std::wstring sUTF16FileName = CUtils::UTF8toUTF16(sUTF8Filename);
+		HANDLE hFile = CreateFileW(sUTF16FileName.c_str(), GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (hFile == INVALID_HANDLE_VALUE)
+			throw std::runtime_error("could not create file: " + sUTF8Filename);
+		m_hFile = hFile;
+#else
+		int nFileDescriptor = open(sUTF8Filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (nFileDescriptor < 0)
+			throw std::runtime_error("could not create file: " + sUTF8Filename);
+		m_nFileDescriptor = nFileDescriptor;
+#endif
+	}
+
+	CNativeFileWriter::~CNativeFileWriter()
+	{
+		try {
+			close();
+		}
+		catch (...) {
+		}
+	}
+
+	void CNativeFileWriter::checkOpen()
+	{
+		if (!isOpen())
+			throw std::runtime_error("file has already been closed: " + m_sFileName);
+	}
+
+	void CNativeFileWriter::writeAt(const uint64_t nOffset, const uint8_t* pData, const uint64_t nSize)
+	{
+		if (nSize == 0)
+			return;
+		if (pData == nullptr)
+			throw std::runtime_error("invalid buffer parameter");
+		checkOpen();
+
+		const uint8_t* pSource = pData;
+		uint64_t nPosition = nOffset;
+		uint64_t nBytesLeft = nSize;
+
+		while (nBytesLeft > 0) {
+			uint64_t nChunkSize = nBytesLeft;
+			if (nChunkSize > NATIVEFILEWRITER_MAXCHUNKSIZE)
+				nChunkSize = NATIVEFILEWRITER_MAXCHUNKSIZE;
+
+			uint64_t nBytesWritten = 0;
+
+#ifdef _WIN32
+			OVERLAPPED overlapped;
+			memset(&overlapped, 0, sizeof(overlapped));
+			overlapped.Offset = (DWORD)(nPosition & 0xffffffffULL);
+			overlapped.OffsetHigh = (DWORD)(nPosition >> 32);
+
+			DWORD nWrittenDWORD = 0;
+			if (!WriteFile((HANDLE)m_hFile, pSource, (DWORD)nChunkSize, &nWrittenDWORD, &overlapped))
+				throw std::runtime_error("could not write to file: " + m_sFileName);
+			nBytesWritten = nWrittenDWORD;
+#else
+			ssize_t nResult = pwrite(m_nFileDescriptor, pSource, (size_t)nChunkSize, (off_t)nPosition);
+			if (nResult < 0) {
+				if (errno == EINTR)
+					continue;
+				throw std::runtime_error("could not write to file: " + m_sFileName);
+			}
+			nBytesWritten = (uint64_t)nResult;
+#endif
+
+			if (nBytesWritten == 0)
+				throw std::runtime_error("could not write to file: " + m_sFileName);
+
+			pSource += nBytesWritten;
+			nPosition += nBytesWritten;
+			nBytesLeft -= nBytesWritten;
+		}
+	}
+
+	void CNativeFileWriter::syncToDisk()
+	{
+		checkOpen();
+
+#ifdef _WIN32
+		if (!FlushFileBuffers((HANDLE)m_hFile))
+			throw std::runtime_error("could not sync file to disk: " + m_sFileName);
+#else
+		if (fsync(m_nFileDescriptor) != 0)
+			throw std::runtime_error("could not sync file to disk: " + m_sFileName);
+#endif
+	}
+
+	void CNativeFileWriter::close()
+	{
+#ifdef _WIN32
+		if (m_hFile != INVALID_HANDLE_VALUE) {
+			HANDLE hFile = (HANDLE)m_hFile;
+			m_hFile = INVALID_HANDLE_VALUE;
+			if (!CloseHandle(hFile))
+				throw std::runtime_error("could not close file: " + m_sFileName);
+		}
+#else
+		if (m_nFileDescriptor >= 0) {
+			int nFileDescriptor = m_nFileDescriptor;
+			m_nFileDescriptor = -1;
+			if (::close(nFileDescriptor) != 0)
+				throw std::runtime_error("could not close file: " + m_sFileName);
+		}
+#endif
+	}
+
+	bool CNativeFileWriter::isOpen()
+	{
+#ifdef _WIN32
+		return (m_hFile != INVALID_HANDLE_VALUE);
+#else
+		return (m_nFileDescriptor >= 0);
+#endif
+	}
+
+	std::string CNativeFileWriter::getFileName()
+	{
+		return m_sFileName;
+	}
+
+}
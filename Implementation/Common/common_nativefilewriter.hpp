@@ -0,0 +1,79 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCCOMMON_NATIVEFILEWRITER
+#define __AMCCOMMON_NATIVEFILEWRITER
+
+#include <string>
+#include <memory>
+#include <cstdint>
+
+
+namespace AMCCommon {
+
+	// Unbuffered file writer on top of the native file handle. Writes are positional, so the writer
+	// does not keep a file pointer and different ranges may be written from different threads.
+	class CNativeFileWriter {
+	private:
+		std::string m_sFileName;
+
+#ifdef _WIN32
+		void* m_hFile;
+#else
+		int m_nFileDescriptor;
+#endif
+
+		void checkOpen();
+
+	public:
+
+		// Creates the file, or truncates it if it already exists.
+		CNativeFileWriter(const std::string & sUTF8Filename);
+		~CNativeFileWriter();
+
+		// Writes the complete buffer at the given file offset.
+		void writeAt(const uint64_t nOffset, const uint8_t* pData, const uint64_t nSize);
+
+		// Blocks until all written data has reached the storage device.
+		void syncToDisk();
+
+		void close();
+
+		bool isOpen();
+
+		std::string getFileName();
+	};
+
+	typedef std::shared_ptr<CNativeFileWriter> PNativeFileWriter;
+
+}
+
+#endif // __AMCCOMMON_NATIVEFILEWRITER
@@ -35,6 +35,11 @@ NMR_PortableZIPWriter.cpp implements a portable and fast writer of ZIP files
 #include "common_portablezipwritertypes.hpp"
 #include "common_exportstream_zip.hpp"
 #include <stdexcept>
+#include <algorithm>
+#include <cctype>
+#include <thread>
+
+#define ZIPDEFAULTCOMPRESSIONLEVEL 1
 
 namespace AMCCommon {
 
@@ -49,6 +54,9 @@ namespace AMCCommon {
 		m_pCurrentEntry = nullptr;
 		m_bIsFinished = false;
 		m_bWriteZIP64 = bWriteZIP64;
+		m_nCompressionLevel = ZIPDEFAULTCOMPRESSIONLEVEL;
+		m_nWorkerCount = 0;
+		m_bStoreCompressedFileTypes = false;
 
 		if (m_bWriteZIP64) {
 			m_nVersionMade = ZIPFILEVERSIONNEEDEDZIP64;
@@ -70,7 +78,7 @@ namespace AMCCommon {
 			writeDirectory();
 	}
 
-	PExportStream CPortableZIPWriter::createEntry(const std::string sName, uint64_t nUnixTimeStamp)
+	PExportStream CPortableZIPWriter::createEntry(const std::string sName, uint64_t nUnixTimeStamp, bool bStoreUncompressed)
 	{
 		if (m_bIsFinished)
 			throw std::runtime_error("zip already finished");
@@ -95,12 +103,16 @@ namespace AMCCommon {
 		uint16_t nLastModTime = nFileDate % 65536;
 		uint16_t nLastModDate = nFileDate / 65536;
 
+		if (m_bStoreCompressedFileTypes && isCompressedFileType(sUTF8Name))
+			bStoreUncompressed = true;
+		uint16_t nCompressionMethod = bStoreUncompressed ? ZIPFILECOMPRESSION_UNCOMPRESSED : ZIPFILECOMPRESSION_DEFLATED;
+
 		// Write local file header
 		ZIPLOCALFILEHEADER LocalHeader;
 		LocalHeader.m_nSignature = ZIPFILEHEADERSIGNATURE;
 		LocalHeader.m_nVersion = m_nVersionNeeded;
 		LocalHeader.m_nGeneralPurposeFlags = 0;
-		LocalHeader.m_nCompressionMethod = ZIPFILECOMPRESSION_DEFLATED;
+		LocalHeader.m_nCompressionMethod = nCompressionMethod;
 		LocalHeader.m_nLastModTime = nLastModTime;
 		LocalHeader.m_nLastModDate = nLastModDate;
 		LocalHeader.m_nCRC32 = 0;
@@ -135,11 +147,15 @@ namespace AMCCommon {
 		uint64_t nDataPosition = m_pExportStream->getPosition();
 
 		// create list entry
-		m_pCurrentEntry = std::make_shared<CPortableZIPWriterEntry>(sUTF8Name, nLastModTime, nLastModDate, nFilePosition, nExtInfoPosition, nDataPosition);
+		m_pCurrentEntry = std::make_shared<CPortableZIPWriterEntry>(sUTF8Name, nLastModTime, nLastModDate, nFilePosition, nExtInfoPosition, nDataPosition, nCompressionMethod);
 		m_Entries.push_back(m_pCurrentEntry);
 
 		// Return new ZIP Entry stream
-		m_pCurrentStream = std::make_shared<CExportStream_ZIP>(this, m_nCurrentEntryKey);
+		uint32_t nWorkerCount = m_nWorkerCount;
+		if (nWorkerCount == 0)
+			nWorkerCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+		m_pCurrentStream = std::make_shared<CExportStream_ZIP>(this, m_nCurrentEntryKey, bStoreUncompressed ? 0 : m_nCompressionLevel, nWorkerCount);
 		return m_pCurrentStream;
 	}
 
@@ -217,6 +233,24 @@ namespace AMCCommon {
 	}
 
 
+	void CPortableZIPWriter::combineChecksum(uint32_t nEntryKey, uint32_t nBlockCRC32, uint64_t nUncompressedBlockSize)
+	{
+		if (m_pCurrentEntry.get() == nullptr)
+			throw std::runtime_error("invalid zip entry");
+
+		if (nEntryKey != m_nCurrentEntryKey)
+			throw std::runtime_error("invalid zip entry key");
+
+		if (nUncompressedBlockSize > 0) {
+			if (nUncompressedBlockSize > ZIPEXPORTBLOCKSIZE)
+				throw std::runtime_error("invalid zip block size");
+
+			m_pCurrentEntry->combineChecksum(nBlockCRC32, nUncompressedBlockSize);
+			m_pCurrentEntry->increaseUncompressedSize((uint32_t) nUncompressedBlockSize);
+		}
+	}
+
+
 	void CPortableZIPWriter::writeDeflatedBuffer(uint32_t nEntryKey, const void * pBuffer, uint32_t cbCompressedBytes)
 	{
 		if (m_pCurrentEntry.get() == nullptr)
@@ -245,6 +279,51 @@ namespace AMCCommon {
 	}
 
 
+	void CPortableZIPWriter::setCompressionLevel(int32_t nCompressionLevel)
+	{
+		if ((nCompressionLevel < 1) || (nCompressionLevel > 9))
+			throw std::runtime_error("invalid zip compression level");
+		m_nCompressionLevel = nCompressionLevel;
+	}
+
+	int32_t CPortableZIPWriter::getCompressionLevel()
+	{
+		return m_nCompressionLevel;
+	}
+
+	void CPortableZIPWriter::setWorkerCount(uint32_t nWorkerCount)
+	{
+		m_nWorkerCount = std::min(nWorkerCount, (uint32_t)ZIPEXPORTMAXWORKERCOUNT);
+	}
+
+	uint32_t CPortableZIPWriter::getWorkerCount()
+	{
+		return m_nWorkerCount;
+	}
+
+	void CPortableZIPWriter::setStoreCompressedFileTypes(bool bStoreCompressedFileTypes)
+	{
+		m_bStoreCompressedFileTypes = bStoreCompressedFileTypes;
+	}
+
+	bool CPortableZIPWriter::getStoreCompressedFileTypes()
+	{
+		return m_bStoreCompressedFileTypes;
+	}
+
+	bool CPortableZIPWriter::isCompressedFileType(const std::string & sName)
+	{
+		auto nDotPosition = sName.find_last_of('.');
+		if (nDotPosition == std::string::npos)
+			return false;
+
+		std::string sExtension = sName.substr(nDotPosition + 1);
+		std::transform(sExtension.begin(), sExtension.end(), sExtension.begin(), [](unsigned char ch) { return (char) std::tolower(ch); });
+
+		return (sExtension == "png") || (sExtension == "jpg") || (sExtension == "jpeg") || (sExtension == "lz4") ||
+			(sExtension == "zip") || (sExtension == "gz") || (sExtension == "7z") || (sExtension == "3mf") || (sExtension == "mp4");
+	}
+
 	void CPortableZIPWriter::writeDirectory()
 	{
 		closeEntry();
@@ -261,7 +340,7 @@ namespace AMCCommon {
 			DirectoryHeader.m_nVersionMade = m_nVersionMade;
 			DirectoryHeader.m_nVersionNeeded = m_nVersionNeeded;
 			DirectoryHeader.m_nGeneralPurposeFlags = 0;
-			DirectoryHeader.m_nCompressionMethod = ZIPFILECOMPRESSION_DEFLATED;
+			DirectoryHeader.m_nCompressionMethod = pEntry->getCompressionMethod();
 			DirectoryHeader.m_nLastModTime = pEntry->getLastModTime();
 			DirectoryHeader.m_nLastModDate = pEntry->getLastModDate();
 			DirectoryHeader.m_nCRC32 = pEntry->getCRC32();
@@ -283,8 +362,8 @@ namespace AMCCommon {
 				DirectoryHeader.m_nRelativeOffsetOfLocalHeader = 0xFFFFFFFF;
 			}
 			else {
-				if ((m_pCurrentEntry->getCompressedSize() > ZIPFILEMAXIMUMSIZENON64) ||
-					(m_pCurrentEntry->getUncompressedSize() > ZIPFILEMAXIMUMSIZENON64))
+				if ((pEntry->getCompressedSize() > ZIPFILEMAXIMUMSIZENON64) ||
+					(pEntry->getUncompressedSize() > ZIPFILEMAXIMUMSIZENON64))
 					throw std::runtime_error("zip entry too large for 64bit");
 				DirectoryHeader.m_nCompressedSize = (uint32_t)pEntry->getCompressedSize();
 				DirectoryHeader.m_nUnCompressedSize = (uint32_t)pEntry->getUncompressedSize();
@@ -51,16 +51,36 @@ namespace AMCCommon {
 
 		std::list<PPortableZIPWriterEntry> m_Entries;
 		PExportStream m_pCurrentStream;
+
+		int32_t m_nCompressionLevel;
+		uint32_t m_nWorkerCount;
+		bool m_bStoreCompressedFileTypes;
+
+		static bool isCompressedFileType(const std::string & sName);
 	public:
 		CPortableZIPWriter() = delete;
 		CPortableZIPWriter(PExportStream pExportStream, bool bWriteZIP64);
 		~CPortableZIPWriter();
 
-		PExportStream createEntry(const std::string sName, uint64_t nUnixTimeStamp);
+		// Entries are deflated if bStoreUncompressed is false, unless storing of compressed file types is enabled and the name has such an extension.
+		PExportStream createEntry(const std::string sName, uint64_t nUnixTimeStamp, bool bStoreUncompressed = false);
 		void closeEntry();
 
+		// Deflate level of subsequently created entries, from 1 (fastest) to 9 (smallest). Default is 1.
+		void setCompressionLevel(int32_t nCompressionLevel);
+		int32_t getCompressionLevel();
+
+		// Number of threads that deflate blocks of an entry in parallel. 0 selects the hardware concurrency.
+		void setWorkerCount(uint32_t nWorkerCount);
+		uint32_t getWorkerCount();
+
+		// If enabled, entries of already compressed formats (PNG, JPEG, LZ4, ZIP, ...) are stored without deflating them again.
+		void setStoreCompressedFileTypes(bool bStoreCompressedFileTypes);
+		bool getStoreCompressedFileTypes();
+
 		void writeDeflatedBuffer(uint32_t nEntryKey, const void * pBuffer, uint32_t cbCompressedBytes);
 		void calculateChecksum(uint32_t nEntryKey, const void * pBuffer, uint32_t cbUncompressedBytes);
+		void combineChecksum(uint32_t nEntryKey, uint32_t nBlockCRC32, uint64_t nUncompressedBlockSize);
 		uint64_t getCurrentSize(uint32_t nEntryKey);
 
 		void writeDirectory();
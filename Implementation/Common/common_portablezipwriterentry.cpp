@@ -32,7 +32,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace AMCCommon {
 
-	CPortableZIPWriterEntry::CPortableZIPWriterEntry(const std::string sUTF8Name, uint16_t nLastModTime, uint16_t nLastModDate, uint64_t nFilePosition, uint64_t nExtInfoPosition, uint64_t nDataPosition)
+	CPortableZIPWriterEntry::CPortableZIPWriterEntry(const std::string sUTF8Name, uint16_t nLastModTime, uint16_t nLastModDate, uint64_t nFilePosition, uint64_t nExtInfoPosition, uint64_t nDataPosition, uint16_t nCompressionMethod)
 	{
 		m_sUTF8Name = sUTF8Name;
 		m_nCRC32 = 0;
@@ -43,6 +43,7 @@ namespace AMCCommon {
 		m_nFilePosition = nFilePosition;
 		m_nExtInfoPosition = nExtInfoPosition;
 		m_nDataPosition = nDataPosition;
+		m_nCompressionMethod = nCompressionMethod;
 	}
 
 	std::string CPortableZIPWriterEntry::getUTF8Name()
@@ -90,6 +91,11 @@ namespace AMCCommon {
 		return m_nDataPosition;
 	}
 
+	uint16_t CPortableZIPWriterEntry::getCompressionMethod()
+	{
+		return m_nCompressionMethod;
+	}
+
 	void CPortableZIPWriterEntry::increaseCompressedSize(uint32_t nCompressedSize)
 	{
 		m_nCompressedSize += nCompressedSize;
@@ -105,4 +111,9 @@ namespace AMCCommon {
 		m_nCRC32 = crc32(m_nCRC32, (Bytef*) pBuffer, cbCount);
 	}
 
+	void CPortableZIPWriterEntry::combineChecksum(uint32_t nBlockCRC32, uint64_t nBlockSize)
+	{
+		m_nCRC32 = crc32_combine(m_nCRC32, nBlockCRC32, (z_off_t) nBlockSize);
+	}
+
 }
@@ -46,8 +46,9 @@ namespace AMCCommon {
 		uint64_t m_nFilePosition;
 		uint64_t m_nExtInfoPosition;
 		uint64_t m_nDataPosition;
+		uint16_t m_nCompressionMethod;
 	public:
-		CPortableZIPWriterEntry(const std::string sUTF8Name, uint16_t nLastModTime, uint16_t nLastModDate, uint64_t nFilePosition, uint64_t nExtInfoPosition, uint64_t nDataPosition);
+		CPortableZIPWriterEntry(const std::string sUTF8Name, uint16_t nLastModTime, uint16_t nLastModDate, uint64_t nFilePosition, uint64_t nExtInfoPosition, uint64_t nDataPosition, uint16_t nCompressionMethod);
 		std::string getUTF8Name();
 		uint32_t getCRC32();
 		uint64_t getCompressedSize();
@@ -57,9 +58,12 @@ namespace AMCCommon {
 		uint64_t getFilePosition();
 		uint64_t getExtInfoPosition();
 		uint64_t getDataPosition();
+		uint16_t getCompressionMethod();
 		void increaseCompressedSize(uint32_t nCompressedSize);
 		void increaseUncompressedSize(uint32_t nUncompressedSize);
 		void calculateChecksum(const void * pBuffer, uint32_t cbCount);
+		// Appends the checksum of a block whose CRC has been computed separately.
+		void combineChecksum(uint32_t nBlockCRC32, uint64_t nBlockSize);
 
 	};
 
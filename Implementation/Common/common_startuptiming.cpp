@@ -0,0 +1,121 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "common_startuptiming.hpp"
+
+#include <stdexcept>
+#include <sstream>
+#include <iomanip>
+
+
+namespace AMCCommon {
+
+	static std::string formatMicrosecondsAsMilliseconds(uint64_t nMicroseconds)
+	{
+		std::stringstream sStream;
+		sStream << std::fixed << std::setprecision(1) << ((double)nMicroseconds / 1000.0) << "ms";
+		return sStream.str();
+	}
+
+	CStartupTiming::CStartupTiming()
+		: m_StartTime (std::chrono::steady_clock::now ()), m_PhaseStartTime (m_StartTime)
+	{
+	}
+
+	CStartupTiming::~CStartupTiming()
+	{
+	}
+
+	void CStartupTiming::beginPhase(const std::string& sPhaseName)
+	{
+		if (sPhaseName.empty())
+			throw std::runtime_error("empty startup phase name");
+
+		finishPhase();
+
+		m_sCurrentPhase = sPhaseName;
+		m_PhaseStartTime = std::chrono::steady_clock::now();
+	}
+
+	void CStartupTiming::finishPhase()
+	{
+		if (m_sCurrentPhase.empty())
+			return;
+
+		auto nDuration = std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now() - m_PhaseStartTime).count();
+
+		sStartupPhase phase;
+		phase.m_sName = m_sCurrentPhase;
+		phase.m_nDurationInMicroseconds = (uint64_t)nDuration;
+		m_Phases.push_back(phase);
+
+		m_sCurrentPhase.clear();
+	}
+
+	uint32_t CStartupTiming::getPhaseCount()
+	{
+		return (uint32_t)m_Phases.size();
+	}
+
+	std::string CStartupTiming::getPhaseName(const uint32_t nIndex)
+	{
+		if (nIndex >= m_Phases.size())
+			throw std::runtime_error("invalid startup phase index: " + std::to_string(nIndex));
+
+		return m_Phases.at(nIndex).m_sName;
+	}
+
+	uint64_t CStartupTiming::getPhaseDurationInMicroseconds(const uint32_t nIndex)
+	{
+		if (nIndex >= m_Phases.size())
+			throw std::runtime_error("invalid startup phase index: " + std::to_string(nIndex));
+
+		return m_Phases.at(nIndex).m_nDurationInMicroseconds;
+	}
+
+	uint64_t CStartupTiming::getTotalDurationInMicroseconds()
+	{
+		auto nDuration = std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now() - m_StartTime).count();
+		return (uint64_t)nDuration;
+	}
+
+	std::vector<std::string> CStartupTiming::getReportLines()
+	{
+		std::vector<std::string> reportLines;
+		for (auto& phase : m_Phases)
+			reportLines.push_back(phase.m_sName + ": " + formatMicrosecondsAsMilliseconds(phase.m_nDurationInMicroseconds));
+
+		reportLines.push_back("total: " + formatMicrosecondsAsMilliseconds(getTotalDurationInMicroseconds()));
+
+		return reportLines;
+	}
+
+}
@@ -0,0 +1,83 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCCOMMON_STARTUPTIMING
+#define __AMCCOMMON_STARTUPTIMING
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <cstdint>
+
+
+namespace AMCCommon {
+
+	// Measures consecutive phases of a startup sequence with a monotonic clock.
+	class CStartupTiming {
+	private:
+
+		typedef struct _sStartupPhase {
+			std::string m_sName;
+			uint64_t m_nDurationInMicroseconds;
+		} sStartupPhase;
+
+		std::chrono::steady_clock::time_point m_StartTime;
+		std::chrono::steady_clock::time_point m_PhaseStartTime;
+		std::string m_sCurrentPhase;
+		std::vector<sStartupPhase> m_Phases;
+
+	public:
+
+		CStartupTiming();
+		~CStartupTiming();
+
+		// Finishes the current phase, if any, and starts a new one.
+		void beginPhase(const std::string& sPhaseName);
+
+		void finishPhase();
+
+		uint32_t getPhaseCount();
+		std::string getPhaseName(const uint32_t nIndex);
+		uint64_t getPhaseDurationInMicroseconds(const uint32_t nIndex);
+
+		// Time since construction, including the time outside of any phase.
+		uint64_t getTotalDurationInMicroseconds();
+
+		// One line per finished phase and a final line with the total, in milliseconds.
+		std::vector<std::string> getReportLines();
+	};
+
+	typedef std::shared_ptr<CStartupTiming> PStartupTiming;
+
+}
+
+#endif // __AMCCOMMON_STARTUPTIMING
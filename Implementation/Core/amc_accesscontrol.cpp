@@ -41,6 +41,7 @@ namespace AMC {
 
 
 	CAccessControl::CAccessControl()
+		: m_nPermissionIndexCounter (0)
 	{
 
 	}
@@ -59,7 +60,8 @@ namespace AMC {
 		{
 			std::lock_guard<std::mutex> lockGuard(m_Mutex);
 
-			auto pResult = std::make_shared<CAccessPermission>(sIdentifier, rDisplayName, rDescription);
+			auto pResult = std::make_shared<CAccessPermission>(sIdentifier, rDisplayName, rDescription, m_nPermissionIndexCounter);
+			m_nPermissionIndexCounter++;
 			m_Permissions.insert(std::make_pair(pResult->getIdentifier(), pResult));
 
 			return pResult;
@@ -110,6 +112,15 @@ namespace AMC {
 
 	}
 
+	uint32_t CAccessControl::findPermissionIndex(const std::string& sIdentifier)
+	{
+		auto iIter = m_Permissions.find(sIdentifier);
+		if (iIter == m_Permissions.end())
+			return ACCESSPERMISSION_NOINDEX;
+
+		return iIter->second->getPermissionIndex();
+	}
+
 	bool CAccessControl::hasPermission(const std::string& sIdentifier)
 	{
 		auto iIter = m_Permissions.find(sIdentifier);
@@ -166,7 +177,21 @@ namespace AMC {
 			throw ELibMCInterfaceException(LIBMC_ERROR_EMPTYPERMISSIONIDENTIFIER);
 
 		PAccessRole pRole = findRole (sRoleIdentifier, true);
-		return pRole->hasPermission(sPermissionIdentifier);
+		return checkPermissionInRole(pRole, sPermissionIdentifier);
+	}
+
+	bool CAccessControl::checkPermissionInRole(PAccessRole pRole, const std::string& sPermissionIdentifier)
+	{
+		if (pRole.get() == nullptr)
+			throw ELibMCCustomException(LIBMC_ERROR_INVALIDPARAM, "CAccessControl::checkPermissionInRole");
+		if (sPermissionIdentifier.empty())
+			throw ELibMCInterfaceException(LIBMC_ERROR_EMPTYPERMISSIONIDENTIFIER);
+
+		uint32_t nPermissionIndex = findPermissionIndex(sPermissionIdentifier);
+		if (nPermissionIndex == ACCESSPERMISSION_NOINDEX)
+			return false;
+
+		return pRole->hasPermissionIndex(nPermissionIndex);
 	}
 
 	void CAccessControl::getPermissionsForRole(const std::string& sRoleIdentifier, std::set<std::string>& permissionStrings)
@@ -53,6 +53,8 @@ namespace AMC {
 		
 		PAccessRole m_pDefaultRole;
 
+		uint32_t m_nPermissionIndexCounter;
+
 	public:
 
 		CAccessControl ();
@@ -67,6 +69,9 @@ namespace AMC {
 		
 		PAccessRole findRole (const std::string & sIdentifier, bool bMustExist);
 
+		// Returns ACCESSPERMISSION_NOINDEX if the permission does not exist.
+		uint32_t findPermissionIndex (const std::string & sIdentifier);
+
 		bool hasPermission (const std::string & sIdentifier);
 		
 		bool hasRole (const std::string & sIdentifier);
@@ -79,6 +84,9 @@ namespace AMC {
 
 		bool checkPermissionInRole (const std::string & sRoleIdentifier, const std::string & sPermissionIdentifier);
 
+		// Bitset test against the role's current permission set.
+		bool checkPermissionInRole (PAccessRole pRole, const std::string & sPermissionIdentifier);
+
 		void getPermissionsForRole(const std::string & sRoleIdentifier, std::set<std::string> & permissionStrings);
 
 	};
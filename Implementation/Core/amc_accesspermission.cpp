@@ -39,7 +39,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace AMC {
 	
 	CAccessPermission::CAccessPermission(const std::string& sIdentifier, const CStringResource& rDisplayName, const CStringResource& rDescription)
-		: m_sIdentifier (sIdentifier), m_DisplayName (rDisplayName), m_Description (rDescription)
+		: CAccessPermission (sIdentifier, rDisplayName, rDescription, ACCESSPERMISSION_NOINDEX)
+	{
+
+	}
+
+	CAccessPermission::CAccessPermission(const std::string& sIdentifier, const CStringResource& rDisplayName, const CStringResource& rDescription, uint32_t nPermissionIndex)
+		: m_sIdentifier (sIdentifier), m_DisplayName (rDisplayName), m_Description (rDescription), m_nPermissionIndex (nPermissionIndex)
 	{
 		if (sIdentifier.empty ())
 			throw ELibMCInterfaceException(LIBMC_ERROR_EMPTYACCESSPERMISSIONIDENTIFIER);
@@ -79,6 +85,11 @@ namespace AMC {
 		return m_DisplayName.get(languageID);
 	}
 
+	uint32_t CAccessPermission::getPermissionIndex()
+	{
+		return m_nPermissionIndex;
+	}
+
 }
 
 
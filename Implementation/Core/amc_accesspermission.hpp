@@ -33,6 +33,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define __AMC_ACCESSPERMISSION
 
 #include "amc_stringresource.hpp"
+#include "amc_accesspermissionset.hpp"
 
 namespace AMC {
 
@@ -46,9 +47,14 @@ namespace AMC {
 		CStringResource m_DisplayName;
 		CStringResource m_Description;
 
+		uint32_t m_nPermissionIndex;
+
 	public:
 
 		CAccessPermission (const std::string & sIdentifier, const CStringResource& rDisplayName, const CStringResource& rDescription);
+
+		// The index is the permission's bit in role permission sets, assigned by the access control.
+		CAccessPermission (const std::string & sIdentifier, const CStringResource& rDisplayName, const CStringResource& rDescription, uint32_t nPermissionIndex);
 		
 		virtual ~CAccessPermission();
 
@@ -62,6 +68,8 @@ namespace AMC {
 
 		std::string getDisplayNameString(StringLanguageID languageID);
 
+		uint32_t getPermissionIndex();
+
 	};
 
 	
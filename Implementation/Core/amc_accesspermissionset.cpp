@@ -0,0 +1,83 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "amc_accesspermissionset.hpp"
+
+
+namespace AMC {
+
+	CAccessPermissionSet::CAccessPermissionSet()
+		: m_nCount (0)
+	{
+
+	}
+
+	CAccessPermissionSet::CAccessPermissionSet(const std::vector<uint32_t>& permissionIndices)
+		: m_nCount (0)
+	{
+		for (uint32_t nPermissionIndex : permissionIndices) {
+			if (nPermissionIndex == ACCESSPERMISSION_NOINDEX)
+				continue;
+
+			size_t nWordIndex = nPermissionIndex / 64;
+			if (nWordIndex >= m_Bits.size())
+				m_Bits.resize(nWordIndex + 1, 0);
+
+			uint64_t nMask = (uint64_t)1 << (nPermissionIndex % 64);
+			if ((m_Bits[nWordIndex] & nMask) == 0) {
+				m_Bits[nWordIndex] |= nMask;
+				m_nCount++;
+			}
+		}
+	}
+
+	CAccessPermissionSet::~CAccessPermissionSet()
+	{
+
+	}
+
+	bool CAccessPermissionSet::contains(uint32_t nPermissionIndex) const
+	{
+		size_t nWordIndex = nPermissionIndex / 64;
+		if (nWordIndex >= m_Bits.size())
+			return false;
+
+		return (m_Bits[nWordIndex] & ((uint64_t)1 << (nPermissionIndex % 64))) != 0;
+	}
+
+	uint32_t CAccessPermissionSet::getCount() const
+	{
+		return m_nCount;
+	}
+
+}
+
+
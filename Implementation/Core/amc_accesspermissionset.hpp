@@ -0,0 +1,74 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMC_ACCESSPERMISSIONSET
+#define __AMC_ACCESSPERMISSIONSET
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+#define ACCESSPERMISSION_NOINDEX 0xffffffff
+
+namespace AMC {
+
+	class CAccessPermissionSet;
+	typedef std::shared_ptr<CAccessPermissionSet> PAccessPermissionSet;
+
+	// Immutable bitset of permission indices. Roles publish a new set whenever their permissions change,
+	// so that readers may keep a set without locking.
+	class CAccessPermissionSet {
+	private:
+
+		std::vector<uint64_t> m_Bits;
+
+		uint32_t m_nCount;
+
+	public:
+
+		CAccessPermissionSet ();
+
+		CAccessPermissionSet (const std::vector<uint32_t> & permissionIndices);
+
+		virtual ~CAccessPermissionSet();
+
+		bool contains (uint32_t nPermissionIndex) const;
+
+		uint32_t getCount () const;
+
+	};
+
+	
+}
+
+
+#endif //__AMC_ACCESSPERMISSIONSET
+
@@ -47,6 +47,9 @@ namespace AMC {
 		if (!AMCCommon::CUtils::stringIsValidAlphanumericNameString(sIdentifier))
 			throw ELibMCCustomException(LIBMC_ERROR_INVALIDACCESSROLEIDENTIFIER, sIdentifier);
 
+		auto pPermissionSet = std::make_shared<CAccessPermissionSet>();
+		m_PermissionSets.push_back(pPermissionSet);
+		m_pCurrentPermissionSet = pPermissionSet.get();
 
 	}
 
@@ -101,6 +104,7 @@ namespace AMC {
 			std::lock_guard<std::mutex> lockGuard(m_Mutex);
 
 			m_Permissions.insert(std::make_pair(sIdentifier, pPermission));
+			updatePermissionSet();
 		}
 	}
 
@@ -109,6 +113,7 @@ namespace AMC {
 		std::lock_guard<std::mutex> lockGuard(m_Mutex);
 
 		m_Permissions.erase(sPermissionIdentifier);
+		updatePermissionSet();
 	}
 
 	std::vector<CAccessPermission*> CAccessRole::getPermissions()
@@ -122,6 +127,29 @@ namespace AMC {
 		return resultVector;
 	}
 
+	void CAccessRole::updatePermissionSet()
+	{
+		std::vector<uint32_t> permissionIndices;
+		permissionIndices.reserve(m_Permissions.size());
+		for (auto iIter : m_Permissions)
+			permissionIndices.push_back(iIter.second->getPermissionIndex());
+
+		auto pPermissionSet = std::make_shared<CAccessPermissionSet>(permissionIndices);
+		m_PermissionSets.push_back(pPermissionSet);
+		m_pCurrentPermissionSet.store(pPermissionSet.get(), std::memory_order_release);
+	}
+
+	PAccessPermissionSet CAccessRole::getPermissionSet()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		return m_PermissionSets.back();
+	}
+
+	bool CAccessRole::hasPermissionIndex(uint32_t nPermissionIndex)
+	{
+		return m_pCurrentPermissionSet.load(std::memory_order_acquire)->contains(nPermissionIndex);
+	}
+
 }
 
 
@@ -37,6 +37,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <mutex>
 #include <map>
 #include <vector>
+#include <atomic>
 
 namespace AMC {
 
@@ -55,6 +56,14 @@ namespace AMC {
 
 		std::map<std::string, PAccessPermission> m_Permissions;
 
+		// Every change publishes a new immutable set. Superseded sets are kept alive
+		// until the role is destroyed, so that readers can use the raw pointer without
+		// reference counting. Roles only change while the access control is configured.
+		std::vector<PAccessPermissionSet> m_PermissionSets;
+		std::atomic<CAccessPermissionSet*> m_pCurrentPermissionSet;
+
+		void updatePermissionSet();
+
 	public:
 
 		CAccessRole(const std::string& sIdentifier, const CStringResource& rDisplayName, const CStringResource& rDescription);
@@ -79,6 +88,13 @@ namespace AMC {
 
 		std::vector<CAccessPermission*> getPermissions();
 
+		// Returns the current permission bitset. Callers may keep it as a snapshot.
+		PAccessPermissionSet getPermissionSet();
+
+		// Lock-free test against the current permission bitset.
+
+		bool hasPermissionIndex (uint32_t nPermissionIndex);
+
 	};
 
 	
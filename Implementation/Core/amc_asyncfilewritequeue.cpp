@@ -0,0 +1,93 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#include "amc_asyncfilewritequeue.hpp"
+#include "libmc_interfaceexception.hpp"
+
+using namespace AMC;
+
+CAsyncFileWriteQueue::CAsyncFileWriteQueue()
+	: m_bStopping(false)
+{
+	m_Thread = std::thread(&CAsyncFileWriteQueue::runThread, this);
+}
+
+CAsyncFileWriteQueue::~CAsyncFileWriteQueue()
+{
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		m_bStopping = true;
+	}
+	m_JobAvailable.notify_all();
+
+	if (m_Thread.joinable())
+		m_Thread.join();
+}
+
+void CAsyncFileWriteQueue::queueJob(std::function<void()> jobFunction)
+{
+	if (!jobFunction)
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		if (m_bStopping)
+			throw ELibMCInterfaceException(LIBMC_ERROR_ASYNCFILEWRITEQUEUESTOPPED);
+
+		m_Jobs.push(std::move(jobFunction));
+	}
+	m_JobAvailable.notify_one();
+}
+
+void CAsyncFileWriteQueue::runThread()
+{
+	while (true) {
+		std::function<void()> jobFunction;
+
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_JobAvailable.wait(lock, [this] { return m_bStopping || !m_Jobs.empty(); });
+
+			if (m_Jobs.empty())
+				return;
+
+			jobFunction = std::move(m_Jobs.front());
+			m_Jobs.pop();
+		}
+
+		try {
+			jobFunction();
+		}
+		catch (...) {
+		}
+	}
+}
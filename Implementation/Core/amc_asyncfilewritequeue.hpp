@@ -0,0 +1,77 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#ifndef __AMC_ASYNCFILEWRITEQUEUE
+#define __AMC_ASYNCFILEWRITEQUEUE
+
+#include <memory>
+#include <functional>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace AMC {
+
+	class CAsyncFileWriteQueue;
+	typedef std::shared_ptr<CAsyncFileWriteQueue> PAsyncFileWriteQueue;
+
+	// Executes file write jobs on a single I/O thread in the order they have been queued.
+	// The thread is shared by all asynchronous writers of a process directory structure.
+	class CAsyncFileWriteQueue {
+	private:
+
+		std::queue<std::function<void()>> m_Jobs;
+		std::mutex m_Mutex;
+		std::condition_variable m_JobAvailable;
+		bool m_bStopping;
+
+		std::thread m_Thread;
+
+		void runThread();
+
+	public:
+
+		CAsyncFileWriteQueue();
+
+		// Executes all queued jobs before the I/O thread is joined.
+		virtual ~CAsyncFileWriteQueue();
+
+		// Jobs are responsible for their own error handling. Exceptions that escape a job are discarded.
+		void queueJob(std::function<void()> jobFunction);
+
+	};
+
+}
+
+
+#endif //__AMC_ASYNCFILEWRITEQUEUE
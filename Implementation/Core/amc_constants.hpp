@@ -50,8 +50,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define DATATABLE_DEFAULTCSVCHUNKSIZE 4096
 #define DATATABLE_MINCSVSEPARATOR 32
 #define DATATABLE_MAXCSVSEPARATOR 127
+#define DATATABLE_CSVWORKERBUFFERSIZE (4 * 1024 * 1024)
+#define DATATABLE_MAXWORKERCOUNT 64
 
 #define DATATABLE_ENCODINGTYPE_RAW 1
+#define DATATABLE_ENCODINGTYPE_LZ4 2
+#define DATATABLE_ENCODINGTYPE_DELTALZ4 3
 
 #define MICROSECONDS_PER_MILLISECOND 1000ULL
 #define MICROSECONDS_PER_SECOND (1000ULL * 1000ULL)
@@ -59,6 +63,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define MICROSECONDS_PER_HOUR (60ULL * 60ULL * 1000ULL * 1000ULL)
 #define MICROSECONDS_PER_DAY (24ULL * 60ULL * 60ULL * 1000ULL * 1000ULL)
 
+#define DATASERIES_MAXDOWNSAMPLINGWIDTH (64 * 1024)
+#define DATASERIES_MAXDOWNSAMPLINGCACHEENTRIES 16
+
 #define MESHENTITY_MAXVERTEXCOUNT (1024ULL * 1024ULL * 1024ULL)
 #define MESHENTITY_MAXTRIANGLECOUNT (1024ULL * 1024ULL * 1024ULL)
 
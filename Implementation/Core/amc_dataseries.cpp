@@ -30,6 +30,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include "amc_dataseries.hpp"
+#include "amc_dataseriesdownsampler.hpp"
+#include "amc_constants.hpp"
 #include "libmc_exceptiontypes.hpp"
 #include "common_utils.hpp"
 
@@ -37,7 +39,7 @@ namespace AMC {
 
 
 	CDataSeries::CDataSeries(const std::string& sUUID, const std::string& sName)
-		: m_sUUID (AMCCommon::CUtils::normalizeUUIDString (sUUID)), m_sName (sName), m_nVersion (1)
+		: m_sUUID (AMCCommon::CUtils::normalizeUUIDString (sUUID)), m_sName (sName), m_nVersion (1), m_nDownsamplingCacheVersion (0)
 	{
 
 	}
@@ -103,6 +105,62 @@ namespace AMC {
 		return m_nVersion;
 	}
 
+	PDataSeriesEntries CDataSeries::getDownsampledEntries(eDataSeriesDownsamplingMode mode, uint64_t nStartTime, uint64_t nEndTime, uint32_t nWidth)
+	{
+		if ((nWidth == 0) || (nWidth > DATASERIES_MAXDOWNSAMPLINGWIDTH))
+			throw ELibMCCustomException(LIBMC_ERROR_INVALIDDATASERIESDOWNSAMPLINGWIDTH, m_sName + ": " + std::to_string(nWidth));
+		if (nEndTime < nStartTime)
+			throw ELibMCCustomException(LIBMC_ERROR_INVALIDDATASERIESTIMERANGE, m_sName);
+
+		sDataSeriesDownsamplingKey key;
+		key.m_Mode = mode;
+		key.m_nWidth = nWidth;
+		key.m_nStartTime = nStartTime;
+		key.m_nEndTime = nEndTime;
+
+		std::lock_guard<std::mutex> lockGuard(m_DownsamplingCacheMutex);
+
+		if (m_nDownsamplingCacheVersion != m_nVersion) {
+			m_DownsamplingCache.clear();
+			m_nDownsamplingCacheVersion = m_nVersion;
+		}
+
+		auto iIter = m_DownsamplingCache.find(key);
+		if (iIter != m_DownsamplingCache.end())
+			return iIter->second;
+
+		size_t nFirstIndex = 0;
+		size_t nEndIndex = 0;
+		CDataSeriesDownsampler::findTimeRange(m_Entries, nStartTime, nEndTime, nFirstIndex, nEndIndex);
+
+		const sDataSeriesEntry* pRangeEntries = m_Entries.data() + nFirstIndex;
+		size_t nRangeCount = nEndIndex - nFirstIndex;
+
+		auto pResult = std::make_shared<std::vector<sDataSeriesEntry>>();
+		switch (mode) {
+			case eDataSeriesDownsamplingMode::dmNone:
+				pResult->assign(pRangeEntries, pRangeEntries + nRangeCount);
+				break;
+
+			case eDataSeriesDownsamplingMode::dmMinMax:
+				CDataSeriesDownsampler::downsampleMinMax(pRangeEntries, nRangeCount, nStartTime, nEndTime, nWidth, *pResult);
+				break;
+
+			case eDataSeriesDownsamplingMode::dmLTTB:
+				CDataSeriesDownsampler::downsampleLTTB(pRangeEntries, nRangeCount, nWidth, *pResult);
+				break;
+
+			default:
+				throw ELibMCCustomException(LIBMC_ERROR_INVALIDDATASERIESDOWNSAMPLINGMODE, m_sName);
+		}
+
+		if (m_DownsamplingCache.size() >= DATASERIES_MAXDOWNSAMPLINGCACHEENTRIES)
+			m_DownsamplingCache.clear();
+		m_DownsamplingCache.insert(std::make_pair(key, pResult));
+
+		return pResult;
+	}
+
 }
 
 
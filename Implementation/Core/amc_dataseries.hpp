@@ -37,6 +37,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <string>
 #include <cstdint>
 #include <vector>
+#include <mutex>
 
 namespace AMC {
 
@@ -46,6 +47,34 @@ namespace AMC {
 	} sDataSeriesEntry;
 
 
+	typedef std::shared_ptr<std::vector<sDataSeriesEntry>> PDataSeriesEntries;
+
+	enum class eDataSeriesDownsamplingMode : int32_t {
+		dmNone = 0,
+		dmMinMax = 1,
+		dmLTTB = 2
+	};
+
+
+	typedef struct _sDataSeriesDownsamplingKey {
+		eDataSeriesDownsamplingMode m_Mode;
+		uint32_t m_nWidth;
+		uint64_t m_nStartTime;
+		uint64_t m_nEndTime;
+
+		bool operator<(const _sDataSeriesDownsamplingKey& other) const
+		{
+			if (m_Mode != other.m_Mode)
+				return m_Mode < other.m_Mode;
+			if (m_nWidth != other.m_nWidth)
+				return m_nWidth < other.m_nWidth;
+			if (m_nStartTime != other.m_nStartTime)
+				return m_nStartTime < other.m_nStartTime;
+			return m_nEndTime < other.m_nEndTime;
+		}
+	} sDataSeriesDownsamplingKey;
+
+
 	class CDataSeries;
 	typedef std::shared_ptr<CDataSeries> PDataSeries;
 
@@ -58,6 +87,11 @@ namespace AMC {
 
 		std::vector<sDataSeriesEntry> m_Entries;
 
+		// Downsampled views are only valid for the version they have been computed for.
+		std::mutex m_DownsamplingCacheMutex;
+		uint32_t m_nDownsamplingCacheVersion;
+		std::map<sDataSeriesDownsamplingKey, PDataSeriesEntries> m_DownsamplingCache;
+
 	public:
 
 		CDataSeries(const std::string & sUUID, const std::string & sName);
@@ -84,6 +118,10 @@ namespace AMC {
 
 		uint32_t getVersion();
 
+		// Returns the entries within [nStartTime, nEndTime], reduced to about nWidth points.
+		// Results are cached until the version of the series changes.
+		PDataSeriesEntries getDownsampledEntries(eDataSeriesDownsamplingMode mode, uint64_t nStartTime, uint64_t nEndTime, uint32_t nWidth);
+
 	};
 
 	
@@ -0,0 +1,189 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "amc_dataseriesdownsampler.hpp"
+#include "libmc_exceptiontypes.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace AMC {
+
+	eDataSeriesDownsamplingMode CDataSeriesDownsampler::stringToMode(const std::string& sMode)
+	{
+		if (sMode.empty() || (sMode == "none"))
+			return eDataSeriesDownsamplingMode::dmNone;
+		if (sMode == "minmax")
+			return eDataSeriesDownsamplingMode::dmMinMax;
+		if (sMode == "lttb")
+			return eDataSeriesDownsamplingMode::dmLTTB;
+
+		throw ELibMCCustomException(LIBMC_ERROR_INVALIDDATASERIESDOWNSAMPLINGMODE, sMode);
+	}
+
+	void CDataSeriesDownsampler::findTimeRange(const std::vector<sDataSeriesEntry>& entries, uint64_t nStartTime, uint64_t nEndTime, size_t& nFirstIndex, size_t& nEndIndex)
+	{
+		auto iFirst = std::lower_bound(entries.begin(), entries.end(), nStartTime, [](const sDataSeriesEntry& entry, uint64_t nTimeStamp) {
+			return entry.m_nTimeStampInMicroSeconds < nTimeStamp;
+		});
+		auto iEnd = std::upper_bound(iFirst, entries.end(), nEndTime, [](uint64_t nTimeStamp, const sDataSeriesEntry& entry) {
+			return nTimeStamp < entry.m_nTimeStampInMicroSeconds;
+		});
+
+		nFirstIndex = (size_t)(iFirst - entries.begin());
+		nEndIndex = (size_t)(iEnd - entries.begin());
+	}
+
+	void CDataSeriesDownsampler::downsampleMinMax(const sDataSeriesEntry* pEntries, size_t nEntryCount, uint64_t nStartTime, uint64_t nEndTime, uint32_t nBucketCount, std::vector<sDataSeriesEntry>& result)
+	{
+		result.clear();
+		if (nEntryCount == 0)
+			return;
+
+		LibMCAssertNotNull(pEntries);
+		if (nBucketCount == 0)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDDATASERIESDOWNSAMPLINGWIDTH);
+		if (nEndTime < nStartTime)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDDATASERIESTIMERANGE);
+
+		if (nEntryCount <= (size_t)nBucketCount * 2) {
+			result.assign(pEntries, pEntries + nEntryCount);
+			return;
+		}
+
+		double dBucketsPerMicroSecond = (double)nBucketCount / ((double)(nEndTime - nStartTime) + 1.0);
+		result.reserve((size_t)nBucketCount * 2);
+
+		size_t nBucketStart = 0;
+		while (nBucketStart < nEntryCount) {
+			uint64_t nBucketIndex = (uint64_t)((double)(pEntries[nBucketStart].m_nTimeStampInMicroSeconds - nStartTime) * dBucketsPerMicroSecond);
+
+			size_t nMinIndex = nBucketStart;
+			size_t nMaxIndex = nBucketStart;
+			size_t nIndex = nBucketStart + 1;
+			while (nIndex < nEntryCount) {
+				if ((uint64_t)((double)(pEntries[nIndex].m_nTimeStampInMicroSeconds - nStartTime) * dBucketsPerMicroSecond) != nBucketIndex)
+					break;
+
+				if (pEntries[nIndex].m_dValue < pEntries[nMinIndex].m_dValue)
+					nMinIndex = nIndex;
+				if (pEntries[nIndex].m_dValue > pEntries[nMaxIndex].m_dValue)
+					nMaxIndex = nIndex;
+				nIndex++;
+			}
+
+			// Emit both extrema in time order
+			if (nMinIndex == nMaxIndex) {
+				result.push_back(pEntries[nMinIndex]);
+			}
+			else {
+				result.push_back(pEntries[std::min(nMinIndex, nMaxIndex)]);
+				result.push_back(pEntries[std::max(nMinIndex, nMaxIndex)]);
+			}
+
+			nBucketStart = nIndex;
+		}
+	}
+
+	void CDataSeriesDownsampler::downsampleLTTB(const sDataSeriesEntry* pEntries, size_t nEntryCount, uint32_t nTargetCount, std::vector<sDataSeriesEntry>& result)
+	{
+		result.clear();
+		if (nEntryCount == 0)
+			return;
+
+		LibMCAssertNotNull(pEntries);
+		if (nTargetCount == 0)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDDATASERIESDOWNSAMPLINGWIDTH);
+
+		if (nEntryCount <= nTargetCount) {
+			result.assign(pEntries, pEntries + nEntryCount);
+			return;
+		}
+
+		if (nTargetCount < 3) {
+			result.push_back(pEntries[0]);
+			if (nTargetCount == 2)
+				result.push_back(pEntries[nEntryCount - 1]);
+			return;
+		}
+
+		result.reserve(nTargetCount);
+
+		// Time stamps are taken relative to the first entry to keep full double precision
+		uint64_t nTimeOrigin = pEntries[0].m_nTimeStampInMicroSeconds;
+		double dBucketSize = (double)(nEntryCount - 2) / (double)(nTargetCount - 2);
+
+		size_t nSelectedIndex = 0;
+		result.push_back(pEntries[0]);
+
+		for (uint32_t nBucket = 0; nBucket < nTargetCount - 2; nBucket++) {
+
+			size_t nBucketStart = (size_t)std::floor(nBucket * dBucketSize) + 1;
+			size_t nBucketEnd = (size_t)std::floor((nBucket + 1) * dBucketSize) + 1;
+
+			size_t nNextBucketStart = nBucketEnd;
+			size_t nNextBucketEnd = std::min((size_t)std::floor((nBucket + 2) * dBucketSize) + 1, nEntryCount);
+
+			double dAverageX = 0.0;
+			double dAverageY = 0.0;
+			for (size_t nIndex = nNextBucketStart; nIndex < nNextBucketEnd; nIndex++) {
+				dAverageX += (double)(pEntries[nIndex].m_nTimeStampInMicroSeconds - nTimeOrigin);
+				dAverageY += pEntries[nIndex].m_dValue;
+			}
+			size_t nNextBucketCount = nNextBucketEnd - nNextBucketStart;
+			if (nNextBucketCount > 0) {
+				dAverageX /= (double)nNextBucketCount;
+				dAverageY /= (double)nNextBucketCount;
+			}
+
+			double dSelectedX = (double)(pEntries[nSelectedIndex].m_nTimeStampInMicroSeconds - nTimeOrigin);
+			double dSelectedY = pEntries[nSelectedIndex].m_dValue;
+
+			size_t nBestIndex = nBucketStart;
+			double dBestArea = -1.0;
+			for (size_t nIndex = nBucketStart; nIndex < nBucketEnd; nIndex++) {
+				double dX = (double)(pEntries[nIndex].m_nTimeStampInMicroSeconds - nTimeOrigin);
+				double dArea = std::fabs((dSelectedX - dAverageX) * (pEntries[nIndex].m_dValue - dSelectedY) - (dSelectedX - dX) * (dAverageY - dSelectedY));
+				if (dArea > dBestArea) {
+					dBestArea = dArea;
+					nBestIndex = nIndex;
+				}
+			}
+
+			result.push_back(pEntries[nBestIndex]);
+			nSelectedIndex = nBestIndex;
+		}
+
+		result.push_back(pEntries[nEntryCount - 1]);
+	}
+
+}
+
@@ -0,0 +1,63 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMC_DATASERIESDOWNSAMPLER
+#define __AMC_DATASERIESDOWNSAMPLER
+
+#include "amc_dataseries.hpp"
+
+#include <string>
+#include <vector>
+
+namespace AMC {
+
+	class CDataSeriesDownsampler {
+	public:
+
+		static eDataSeriesDownsamplingMode stringToMode(const std::string& sMode);
+
+		// Returns the index range [nFirstIndex, nEndIndex) of the entries within the time stamp interval [nStartTime, nEndTime].
+		static void findTimeRange(const std::vector<sDataSeriesEntry>& entries, uint64_t nStartTime, uint64_t nEndTime, size_t& nFirstIndex, size_t& nEndIndex);
+
+		// Splits [nStartTime, nEndTime] into nBucketCount equally long buckets and keeps the minimum and maximum entry of each bucket.
+		// Global and per bucket extrema are always part of the result.
+		static void downsampleMinMax(const sDataSeriesEntry* pEntries, size_t nEntryCount, uint64_t nStartTime, uint64_t nEndTime, uint32_t nBucketCount, std::vector<sDataSeriesEntry>& result);
+
+		// Largest-Triangle-Three-Buckets. Keeps the first and last entry and selects at most nTargetCount entries in total.
+		static void downsampleLTTB(const sDataSeriesEntry* pEntries, size_t nEntryCount, uint32_t nTargetCount, std::vector<sDataSeriesEntry>& result);
+
+	};
+
+}
+
+
+#endif //__AMC_DATASERIESDOWNSAMPLER
+
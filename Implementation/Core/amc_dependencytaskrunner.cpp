@@ -0,0 +1,259 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "amc_dependencytaskrunner.hpp"
+
+#include "libmc_exceptiontypes.hpp"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <deque>
+
+namespace AMC {
+
+	CDependencyTaskRunner::CDependencyTaskRunner()
+		: m_bHasRun (false)
+	{
+	}
+
+	CDependencyTaskRunner::~CDependencyTaskRunner()
+	{
+	}
+
+	void CDependencyTaskRunner::addTask(const std::string& sName, const std::vector<std::string>& Dependencies, std::function<void()> taskFunction)
+	{
+		if (sName.empty())
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+		if (!taskFunction)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+		if (m_bHasRun)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+		auto iIter = m_TaskIndexMap.find(sName);
+		if (iIter != m_TaskIndexMap.end())
+			throw ELibMCCustomException(LIBMC_ERROR_DRIVERALREADYREGISTERED, sName);
+
+		sTaskEntry task;
+		task.m_sName = sName;
+		task.m_Dependencies = Dependencies;
+		task.m_TaskFunction = taskFunction;
+		task.m_nOpenDependencies = 0;
+		task.m_State = eDependencyTaskState::Pending;
+		task.m_nDurationInMicroseconds = 0;
+
+		m_TaskIndexMap.insert(std::make_pair(sName, m_Tasks.size()));
+		m_Tasks.push_back(task);
+	}
+
+	uint32_t CDependencyTaskRunner::getTaskCount()
+	{
+		return (uint32_t)m_Tasks.size();
+	}
+
+	CDependencyTaskRunner::sTaskEntry& CDependencyTaskRunner::findTask(const std::string& sName)
+	{
+		auto iIter = m_TaskIndexMap.find(sName);
+		if (iIter == m_TaskIndexMap.end())
+			throw ELibMCCustomException(LIBMC_ERROR_DRIVERNOTFOUND, sName);
+
+		return m_Tasks.at(iIter->second);
+	}
+
+	void CDependencyTaskRunner::resolveDependencies()
+	{
+		for (size_t nIndex = 0; nIndex < m_Tasks.size(); nIndex++) {
+			auto& task = m_Tasks.at(nIndex);
+			for (auto& sDependency : task.m_Dependencies) {
+				auto iIter = m_TaskIndexMap.find(sDependency);
+				if (iIter == m_TaskIndexMap.end())
+					throw ELibMCCustomException(LIBMC_ERROR_UNKNOWNDRIVERDEPENDENCY, task.m_sName + " depends on " + sDependency);
+				if (iIter->second == nIndex)
+					throw ELibMCCustomException(LIBMC_ERROR_CYCLICDRIVERDEPENDENCY, task.m_sName);
+
+				m_Tasks.at(iIter->second).m_Dependents.push_back(nIndex);
+				task.m_nOpenDependencies++;
+			}
+		}
+
+		// Kahn's algorithm on a copy of the counters; every task that is never released is part of or behind a cycle.
+		std::vector<size_t> openDependencies;
+		std::deque<size_t> readyTasks;
+		for (size_t nIndex = 0; nIndex < m_Tasks.size(); nIndex++) {
+			openDependencies.push_back(m_Tasks.at(nIndex).m_nOpenDependencies);
+			if (openDependencies.back() == 0)
+				readyTasks.push_back(nIndex);
+		}
+
+		size_t nReleasedCount = 0;
+		while (!readyTasks.empty()) {
+			size_t nIndex = readyTasks.front();
+			readyTasks.pop_front();
+			nReleasedCount++;
+
+			for (size_t nDependent : m_Tasks.at(nIndex).m_Dependents) {
+				openDependencies.at(nDependent)--;
+				if (openDependencies.at(nDependent) == 0)
+					readyTasks.push_back(nDependent);
+			}
+		}
+
+		if (nReleasedCount != m_Tasks.size()) {
+			std::string sCycleTasks;
+			for (size_t nIndex = 0; nIndex < m_Tasks.size(); nIndex++) {
+				if (openDependencies.at(nIndex) > 0) {
+					if (!sCycleTasks.empty())
+						sCycleTasks += ", ";
+					sCycleTasks += m_Tasks.at(nIndex).m_sName;
+				}
+			}
+			throw ELibMCCustomException(LIBMC_ERROR_CYCLICDRIVERDEPENDENCY, sCycleTasks);
+		}
+
+	}
+
+	void CDependencyTaskRunner::run(uint32_t nMaxThreadCount)
+	{
+		if ((nMaxThreadCount < AMC_DEPENDENCYTASKRUNNER_MINTHREADCOUNT) || (nMaxThreadCount > AMC_DEPENDENCYTASKRUNNER_MAXTHREADCOUNT))
+			throw ELibMCCustomException(LIBMC_ERROR_INVALIDPARAM, "invalid task runner thread count: " + std::to_string(nMaxThreadCount));
+		if (m_bHasRun)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+		m_bHasRun = true;
+
+		resolveDependencies();
+
+		std::mutex queueMutex;
+		std::condition_variable queueCondition;
+		std::deque<size_t> readyTasks;
+		size_t nFinishedCount = 0;
+
+		for (size_t nIndex = 0; nIndex < m_Tasks.size(); nIndex++) {
+			if (m_Tasks.at(nIndex).m_nOpenDependencies == 0)
+				readyTasks.push_back(nIndex);
+		}
+
+		// Must be called with the queue mutex held. Skips all transitive dependents of a task that did not succeed.
+		std::function<void(size_t)> finishTask = [&](size_t nIndex) {
+			auto& task = m_Tasks.at(nIndex);
+			nFinishedCount++;
+
+			for (size_t nDependent : task.m_Dependents) {
+				auto& dependentTask = m_Tasks.at(nDependent);
+				if (dependentTask.m_State != eDependencyTaskState::Pending)
+					continue;
+
+				if (task.m_State == eDependencyTaskState::Succeeded) {
+					dependentTask.m_nOpenDependencies--;
+					if (dependentTask.m_nOpenDependencies == 0)
+						readyTasks.push_back(nDependent);
+				}
+				else {
+					dependentTask.m_State = eDependencyTaskState::Skipped;
+					dependentTask.m_sErrorMessage = ELibMCCustomException(LIBMC_ERROR_DRIVERDEPENDENCYFAILED, dependentTask.m_sName + " depends on " + task.m_sName).what();
+					finishTask(nDependent);
+				}
+			}
+		};
+
+		auto workerFunction = [&]() {
+			std::unique_lock<std::mutex> lock(queueMutex);
+
+			while (true) {
+				queueCondition.wait(lock, [&]() { return (!readyTasks.empty()) || (nFinishedCount == m_Tasks.size()); });
+				if (readyTasks.empty())
+					return;
+
+				size_t nIndex = readyTasks.front();
+				readyTasks.pop_front();
+				auto& task = m_Tasks.at(nIndex);
+
+				lock.unlock();
+
+				eDependencyTaskState newState = eDependencyTaskState::Succeeded;
+				std::string sErrorMessage;
+				auto startTime = std::chrono::steady_clock::now();
+				try {
+					task.m_TaskFunction();
+				}
+				catch (std::exception& E) {
+					newState = eDependencyTaskState::Failed;
+					sErrorMessage = E.what();
+				}
+				catch (...) {
+					newState = eDependencyTaskState::Failed;
+					sErrorMessage = "unknown exception";
+				}
+				auto nDuration = std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now() - startTime).count();
+
+				lock.lock();
+
+				task.m_State = newState;
+				task.m_sErrorMessage = sErrorMessage;
+				task.m_nDurationInMicroseconds = (uint64_t)nDuration;
+				finishTask(nIndex);
+
+				queueCondition.notify_all();
+			}
+		};
+
+		size_t nThreadCount = nMaxThreadCount;
+		if (nThreadCount > m_Tasks.size())
+			nThreadCount = m_Tasks.size();
+
+		// The calling thread is one of the workers
+		std::vector<std::thread> workerThreads;
+		for (size_t nThreadIndex = 1; nThreadIndex < nThreadCount; nThreadIndex++)
+			workerThreads.push_back(std::thread(workerFunction));
+
+		workerFunction();
+
+		for (auto& workerThread : workerThreads)
+			workerThread.join();
+	}
+
+	eDependencyTaskState CDependencyTaskRunner::getTaskState(const std::string& sName)
+	{
+		return findTask(sName).m_State;
+	}
+
+	std::string CDependencyTaskRunner::getTaskErrorMessage(const std::string& sName)
+	{
+		return findTask(sName).m_sErrorMessage;
+	}
+
+	uint64_t CDependencyTaskRunner::getTaskDurationInMicroseconds(const std::string& sName)
+	{
+		return findTask(sName).m_nDurationInMicroseconds;
+	}
+
+}
+
@@ -0,0 +1,109 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMC_DEPENDENCYTASKRUNNER
+#define __AMC_DEPENDENCYTASKRUNNER
+
+#include <memory>
+#include <vector>
+#include <map>
+#include <string>
+#include <functional>
+#include <cstdint>
+
+#define AMC_DEPENDENCYTASKRUNNER_MINTHREADCOUNT 1
+#define AMC_DEPENDENCYTASKRUNNER_MAXTHREADCOUNT 64
+
+namespace AMC {
+
+	class CDependencyTaskRunner;
+	typedef std::shared_ptr<CDependencyTaskRunner> PDependencyTaskRunner;
+
+	enum class eDependencyTaskState : uint32_t {
+		Pending = 0,
+		Succeeded = 1,
+		Failed = 2,
+		Skipped = 3
+	};
+
+	// Runs named tasks on a number of threads, so that a task starts only after all its dependencies have succeeded.
+	// Tasks whose dependencies have failed or have been skipped are skipped themselves.
+	class CDependencyTaskRunner {
+	private:
+
+		typedef struct _sTaskEntry {
+			std::string m_sName;
+			std::vector<std::string> m_Dependencies;
+			std::function<void()> m_TaskFunction;
+			std::vector<size_t> m_Dependents;
+			size_t m_nOpenDependencies;
+			eDependencyTaskState m_State;
+			std::string m_sErrorMessage;
+			uint64_t m_nDurationInMicroseconds;
+		} sTaskEntry;
+
+		std::vector<sTaskEntry> m_Tasks;
+		std::map<std::string, size_t> m_TaskIndexMap;
+
+		bool m_bHasRun;
+
+		sTaskEntry& findTask(const std::string& sName);
+
+		// Resolves the dependency names into indices and fails on unknown or cyclic dependencies.
+		void resolveDependencies();
+
+	public:
+
+		CDependencyTaskRunner();
+
+		virtual ~CDependencyTaskRunner();
+
+		void addTask(const std::string& sName, const std::vector<std::string>& Dependencies, std::function<void()> taskFunction);
+
+		uint32_t getTaskCount();
+
+		// Executes all tasks and returns when every task has succeeded, failed or has been skipped.
+		// Exceptions of a task are caught and stored as its error message.
+		void run(uint32_t nMaxThreadCount);
+
+		eDependencyTaskState getTaskState(const std::string& sName);
+
+		std::string getTaskErrorMessage(const std::string& sName);
+
+		uint64_t getTaskDurationInMicroseconds(const std::string& sName);
+
+	};
+
+}
+
+
+#endif //__AMC_DEPENDENCYTASKRUNNER
+
@@ -36,6 +36,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <thread>
+#include <functional>
+#include <exception>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define DISCRETEFIELD_USESSE2
+#endif
 
 using namespace AMC;
 
@@ -71,6 +80,297 @@ typedef struct _sDiscreteField2DStreamHeader {
 } sDiscreteField2DStreamHeader;
 #pragma pack(pop)
 
+#define DISCRETEFIELD_MAXWORKERCOUNT 64
+#define DISCRETEFIELD_MINPIXELSPERWORKER (64ULL * 1024ULL)
+#define DISCRETEFIELD_MINPOINTSPERWORKER (256ULL * 1024ULL)
+#define DISCRETEFIELD_MAXPOINTACCUMULATORMEMORY (1024ULL * 1024ULL * 1024ULL)
+
+
+static size_t getFieldWorkerCount(uint64_t nWorkAmount, uint64_t nMinWorkPerWorker)
+{
+	uint64_t nWorkerCount = std::thread::hardware_concurrency();
+	if (nWorkerCount > DISCRETEFIELD_MAXWORKERCOUNT)
+		nWorkerCount = DISCRETEFIELD_MAXWORKERCOUNT;
+
+	uint64_t nNeededWorkerCount = nWorkAmount / nMinWorkPerWorker;
+	if (nWorkerCount > nNeededWorkerCount)
+		nWorkerCount = nNeededWorkerCount;
+	if (nWorkerCount < 1)
+		nWorkerCount = 1;
+
+	return (size_t)nWorkerCount;
+}
+
+static void runFieldWorkers(size_t nWorkerCount, const std::function<void(size_t nWorkerIndex)>& worker)
+{
+	if (nWorkerCount <= 1) {
+		worker(0);
+		return;
+	}
+
+	std::vector<std::exception_ptr> workerExceptions(nWorkerCount);
+	std::vector<std::thread> workerThreads;
+	workerThreads.reserve(nWorkerCount);
+
+	for (size_t nWorkerIndex = 0; nWorkerIndex < nWorkerCount; nWorkerIndex++) {
+		workerThreads.push_back(std::thread([&, nWorkerIndex]() {
+			try {
+				worker(nWorkerIndex);
+			}
+			catch (...) {
+				workerExceptions[nWorkerIndex] = std::current_exception();
+			}
+		}));
+	}
+
+	for (auto& workerThread : workerThreads)
+		workerThread.join();
+
+	for (auto& workerException : workerExceptions) {
+		if (workerException)
+			std::rethrow_exception(workerException);
+	}
+}
+
+// Splits the rows into consecutive blocks, one per worker. Small fields are processed on the calling thread.
+static void processRowBlocks(size_t nRowCount, size_t nPixelsPerRow, const std::function<void(size_t nRowStart, size_t nRowEnd)>& processBlock)
+{
+	size_t nWorkerCount = getFieldWorkerCount((uint64_t)nRowCount * (uint64_t)nPixelsPerRow, DISCRETEFIELD_MINPIXELSPERWORKER);
+	if (nWorkerCount > nRowCount)
+		nWorkerCount = nRowCount;
+
+	runFieldWorkers(nWorkerCount, [&](size_t nWorkerIndex) {
+		size_t nRowStart = (nRowCount * nWorkerIndex) / nWorkerCount;
+		size_t nRowEnd = (nRowCount * (nWorkerIndex + 1)) / nWorkerCount;
+		if (nRowStart < nRowEnd)
+			processBlock(nRowStart, nRowEnd);
+	});
+}
+
+// Same as processRowBlocks, for operations on the flat value array.
+static void processValueBlocks(size_t nValueCount, const std::function<void(size_t nStart, size_t nEnd)>& processBlock)
+{
+	processRowBlocks(nValueCount, 1, processBlock);
+}
+
+
+/* Value kernels. All arithmetic is done in double precision, float values are converted before and after.
+   The SSE2 variants keep the order of operations, so that they produce the same results as the scalar loops. */
+
+template <typename T> static void clampValues_Scalar(T* pValues, size_t nCount, double dMinValue, double dMaxValue)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		double dValue = (double)pValues[nIndex];
+		if (dValue < dMinValue)
+			pValues[nIndex] = (T)dMinValue;
+		if (dValue > dMaxValue)
+			pValues[nIndex] = (T)dMaxValue;
+	}
+}
+
+template <typename T> static void transformValues_Scalar(T* pValues, size_t nCount, double dScale, double dOffset)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++)
+		pValues[nIndex] = (T)(((double)pValues[nIndex] * dScale) + dOffset);
+}
+
+template <typename T, typename TOther> static void addValues_Scalar(T* pValues, const TOther* pOtherValues, size_t nCount, double dScale, double dOffset)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++)
+		pValues[nIndex] = (T)((double)pValues[nIndex] + (((double)pOtherValues[nIndex] * dScale) + dOffset));
+}
+
+#ifdef DISCRETEFIELD_USESSE2
+
+// max and min return their second operand if one of the operands is NaN, so NaN values stay untouched.
+static inline __m128d clampPair(__m128d vValue, __m128d vMin, __m128d vMax)
+{
+	return _mm_min_pd(vMax, _mm_max_pd(vMin, vValue));
+}
+
+static inline void loadFloatQuad(const float* pValues, __m128d& vLow, __m128d& vHigh)
+{
+	__m128 vValues = _mm_loadu_ps(pValues);
+	vLow = _mm_cvtps_pd(vValues);
+	vHigh = _mm_cvtps_pd(_mm_movehl_ps(vValues, vValues));
+}
+
+static inline void storeFloatQuad(float* pValues, __m128d vLow, __m128d vHigh)
+{
+	_mm_storeu_ps(pValues, _mm_movelh_ps(_mm_cvtpd_ps(vLow), _mm_cvtpd_ps(vHigh)));
+}
+
+static void clampValues(double* pValues, size_t nCount, double dMinValue, double dMaxValue)
+{
+	__m128d vMin = _mm_set1_pd(dMinValue);
+	__m128d vMax = _mm_set1_pd(dMaxValue);
+	size_t nIndex = 0;
+	for (; nIndex + 2 <= nCount; nIndex += 2)
+		_mm_storeu_pd(pValues + nIndex, clampPair(_mm_loadu_pd(pValues + nIndex), vMin, vMax));
+	clampValues_Scalar(pValues + nIndex, nCount - nIndex, dMinValue, dMaxValue);
+}
+
+static void clampValues(float* pValues, size_t nCount, double dMinValue, double dMaxValue)
+{
+	__m128 vMin = _mm_set1_ps((float)dMinValue);
+	__m128 vMax = _mm_set1_ps((float)dMaxValue);
+	size_t nIndex = 0;
+	for (; nIndex + 4 <= nCount; nIndex += 4)
+		_mm_storeu_ps(pValues + nIndex, _mm_min_ps(vMax, _mm_max_ps(vMin, _mm_loadu_ps(pValues + nIndex))));
+	clampValues_Scalar(pValues + nIndex, nCount - nIndex, dMinValue, dMaxValue);
+}
+
+static void transformValues(double* pValues, size_t nCount, double dScale, double dOffset)
+{
+	__m128d vScale = _mm_set1_pd(dScale);
+	__m128d vOffset = _mm_set1_pd(dOffset);
+	size_t nIndex = 0;
+	for (; nIndex + 2 <= nCount; nIndex += 2)
+		_mm_storeu_pd(pValues + nIndex, _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(pValues + nIndex), vScale), vOffset));
+	transformValues_Scalar(pValues + nIndex, nCount - nIndex, dScale, dOffset);
+}
+
+static void transformValues(float* pValues, size_t nCount, double dScale, double dOffset)
+{
+	__m128d vScale = _mm_set1_pd(dScale);
+	__m128d vOffset = _mm_set1_pd(dOffset);
+	size_t nIndex = 0;
+	for (; nIndex + 4 <= nCount; nIndex += 4) {
+		__m128d vLow, vHigh;
+		loadFloatQuad(pValues + nIndex, vLow, vHigh);
+		storeFloatQuad(pValues + nIndex, _mm_add_pd(_mm_mul_pd(vLow, vScale), vOffset), _mm_add_pd(_mm_mul_pd(vHigh, vScale), vOffset));
+	}
+	transformValues_Scalar(pValues + nIndex, nCount - nIndex, dScale, dOffset);
+}
+
+static void addValues(double* pValues, const double* pOtherValues, size_t nCount, double dScale, double dOffset)
+{
+	__m128d vScale = _mm_set1_pd(dScale);
+	__m128d vOffset = _mm_set1_pd(dOffset);
+	size_t nIndex = 0;
+	for (; nIndex + 2 <= nCount; nIndex += 2) {
+		__m128d vOther = _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(pOtherValues + nIndex), vScale), vOffset);
+		_mm_storeu_pd(pValues + nIndex, _mm_add_pd(_mm_loadu_pd(pValues + nIndex), vOther));
+	}
+	addValues_Scalar(pValues + nIndex, pOtherValues + nIndex, nCount - nIndex, dScale, dOffset);
+}
+
+static void addValues(float* pValues, const float* pOtherValues, size_t nCount, double dScale, double dOffset)
+{
+	__m128d vScale = _mm_set1_pd(dScale);
+	__m128d vOffset = _mm_set1_pd(dOffset);
+	size_t nIndex = 0;
+	for (; nIndex + 4 <= nCount; nIndex += 4) {
+		__m128d vLow, vHigh, vOtherLow, vOtherHigh;
+		loadFloatQuad(pValues + nIndex, vLow, vHigh);
+		loadFloatQuad(pOtherValues + nIndex, vOtherLow, vOtherHigh);
+		vLow = _mm_add_pd(vLow, _mm_add_pd(_mm_mul_pd(vOtherLow, vScale), vOffset));
+		vHigh = _mm_add_pd(vHigh, _mm_add_pd(_mm_mul_pd(vOtherHigh, vScale), vOffset));
+		storeFloatQuad(pValues + nIndex, vLow, vHigh);
+	}
+	addValues_Scalar(pValues + nIndex, pOtherValues + nIndex, nCount - nIndex, dScale, dOffset);
+}
+
+#else
+
+template <typename T> static void clampValues(T* pValues, size_t nCount, double dMinValue, double dMaxValue)
+{
+	clampValues_Scalar(pValues, nCount, dMinValue, dMaxValue);
+}
+
+template <typename T> static void transformValues(T* pValues, size_t nCount, double dScale, double dOffset)
+{
+	transformValues_Scalar(pValues, nCount, dScale, dOffset);
+}
+
+#endif // DISCRETEFIELD_USESSE2
+
+// Fields of different storage precision are added with the scalar loop.
+template <typename T, typename TOther> static void addValues(T* pValues, const TOther* pOtherValues, size_t nCount, double dScale, double dOffset)
+{
+	addValues_Scalar(pValues, pOtherValues, nCount, dScale, dOffset);
+}
+
+// Repeats every value nFactor times.
+template <typename T> static void widenRow(const T* pSource, size_t nCount, uint32_t nFactor, T* pTarget)
+{
+	if (nFactor == 1) {
+		std::copy(pSource, pSource + nCount, pTarget);
+		return;
+	}
+
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		T value = pSource[nIndex];
+		for (uint32_t nRepetition = 0; nRepetition < nFactor; nRepetition++)
+			pTarget[nRepetition] = value;
+		pTarget += nFactor;
+	}
+}
+
+typedef struct _sRGBColorScale {
+	double m_dMinValue;
+	double m_dMidValue;
+	double m_dMaxValue;
+	double m_MinColor[3];
+	double m_MidColor[3];
+	double m_MaxColor[3];
+} sRGBColorScale;
+
+/* The colour scale is passed by value: the byte stores into the image may alias any memory,
+   so values read through references would be reloaded for every pixel. */
+template <typename T> static void renderRGBValues(const T* pValues, size_t nCount, uint8_t* pTarget, const sRGBColorScale colorScale)
+{
+	double dDeltaMin = colorScale.m_dMidValue - colorScale.m_dMinValue;
+	double dDeltaMax = colorScale.m_dMaxValue - colorScale.m_dMidValue;
+
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		double dValue = (double)pValues[nIndex];
+		double dFactor = 0.0;
+		const double* pLowerColor;
+		const double* pUpperColor;
+
+		if (dValue < colorScale.m_dMidValue) {
+			if (dDeltaMin > DISCRETEFIELD_MINVALUEDISTANCE)
+				dFactor = (dValue - colorScale.m_dMinValue) / dDeltaMin;
+			pLowerColor = colorScale.m_MinColor;
+			pUpperColor = colorScale.m_MidColor;
+		}
+		else {
+			if (dDeltaMax > DISCRETEFIELD_MINVALUEDISTANCE)
+				dFactor = (dValue - colorScale.m_dMidValue) / dDeltaMax;
+			pLowerColor = colorScale.m_MidColor;
+			pUpperColor = colorScale.m_MaxColor;
+		}
+
+		if (dFactor < 0.0)
+			dFactor = 0.0;
+		if (dFactor > 1.0)
+			dFactor = 1.0;
+
+		for (uint32_t nChannel = 0; nChannel < 3; nChannel++) {
+			double dChannel = std::clamp(pLowerColor[nChannel] * (1.0 - dFactor) + pUpperColor[nChannel] * dFactor, 0.0, 1.0) * 255.0;
+
+			// Same as round() for values in [0, 255], without the library call. The difference to the truncated value is exact.
+			uint32_t nChannelValue = (uint32_t)dChannel;
+			if (dChannel - (double)nChannelValue >= 0.5)
+				nChannelValue++;
+			pTarget[nChannel] = (uint8_t)nChannelValue;
+		}
+		pTarget += 3;
+	}
+}
+
+
+template <typename TFunction> void CDiscreteFieldData2DInstance::visitData(TFunction function)
+{
+	if (m_SinglePrecisionData.get() != nullptr)
+		function(*m_SinglePrecisionData);
+	else if (m_Data.get() != nullptr)
+		function(*m_Data);
+	else
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDBUFFER);
+}
+
 
 PDiscreteFieldData2DInstance CDiscreteFieldData2DInstance::createFromBuffer(const std::vector<uint8_t>& Buffer)
 {
@@ -106,45 +406,71 @@ PDiscreteFieldData2DInstance CDiscreteFieldData2DInstance::createFromBuffer(cons
 	if (pDataVector->size () != nPixelCount)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDDISCRETEFIELDINTERNALDATA);
 
-	double * pTargetPtr = pDataVector->data();
-	double * pSourcePtr = (double*)&Buffer.at(header->m_nDataOffset);
-	for (uint64_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
-		*pTargetPtr = *pSourcePtr;
-		pTargetPtr++;
-		pSourcePtr++;
-	}
-
+	// The data offset is not necessarily aligned to 8 bytes
+	memcpy((void*)pDataVector->data(), (const void*)&Buffer.at(header->m_nDataOffset), nPixelCount * sizeof(double));
 
 	return pInstance;
 }
 
-CDiscreteFieldData2DInstance::CDiscreteFieldData2DInstance(size_t nPixelCountX, size_t nPixelCountY, double dDPIX, double dDPIY, double dOriginX, double dOriginY, double dDefaultValue, bool bDoClear)
+CDiscreteFieldData2DInstance::CDiscreteFieldData2DInstance(size_t nPixelCountX, size_t nPixelCountY, double dDPIX, double dDPIY, double dOriginX, double dOriginY, double dDefaultValue, bool bDoClear, bool bSinglePrecision)
 	: m_nPixelCountX (nPixelCountX), m_nPixelCountY (nPixelCountY), m_dDPIX (dDPIX), m_dDPIY (dDPIY), m_dOriginX (dOriginX), m_dOriginY (dOriginY)
 {
-	if (nPixelCountX <= 0)
+	checkLayout();
+
+	if (bSinglePrecision) {
+		m_SinglePrecisionData = std::make_unique<std::vector<float>>();
+		m_SinglePrecisionData->resize((size_t)m_nPixelCountX * (size_t)m_nPixelCountY);
+	}
+	else {
+		m_Data = std::make_unique<std::vector<double>>();
+		m_Data->resize((size_t)m_nPixelCountX * (size_t)m_nPixelCountY);
+	}
+
+	if (bDoClear)
+		Clear(dDefaultValue);
+
+}
+
+CDiscreteFieldData2DInstance::CDiscreteFieldData2DInstance(size_t nPixelCountX, size_t nPixelCountY, double dDPIX, double dDPIY, double dOriginX, double dOriginY, std::vector<double>&& values)
+	: m_nPixelCountX(nPixelCountX), m_nPixelCountY(nPixelCountY), m_dDPIX(dDPIX), m_dDPIY(dDPIY), m_dOriginX(dOriginX), m_dOriginY(dOriginY)
+{
+	checkLayout();
+
+	if (values.size() != (size_t)m_nPixelCountX * (size_t)m_nPixelCountY)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDBUFFER);
+
+	m_Data = std::make_unique<std::vector<double>>(std::move(values));
+}
+
+CDiscreteFieldData2DInstance::CDiscreteFieldData2DInstance(size_t nPixelCountX, size_t nPixelCountY, double dDPIX, double dDPIY, double dOriginX, double dOriginY, std::vector<float>&& values)
+	: m_nPixelCountX(nPixelCountX), m_nPixelCountY(nPixelCountY), m_dDPIX(dDPIX), m_dDPIY(dDPIY), m_dOriginX(dOriginX), m_dOriginY(dOriginY)
+{
+	checkLayout();
+
+	if (values.size() != (size_t)m_nPixelCountX * (size_t)m_nPixelCountY)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDBUFFER);
+
+	m_SinglePrecisionData = std::make_unique<std::vector<float>>(std::move(values));
+}
+
+void CDiscreteFieldData2DInstance::checkLayout()
+{
+	if (m_nPixelCountX <= 0)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELCOUNT);
-	if (nPixelCountY <= 0)
+	if (m_nPixelCountY <= 0)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELCOUNT);
-	if (nPixelCountX > DISCRETEFIELD_MAXPIXELCOUNT)
+	if (m_nPixelCountX > DISCRETEFIELD_MAXPIXELCOUNT)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELCOUNT);
-	if (nPixelCountY > DISCRETEFIELD_MAXPIXELCOUNT)
+	if (m_nPixelCountY > DISCRETEFIELD_MAXPIXELCOUNT)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELCOUNT);
-	if (dDPIX <= 0.0)
+	if (m_dDPIX <= 0.0)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDPIVALUE);
-	if (dDPIY <= 0.0)
+	if (m_dDPIY <= 0.0)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDPIVALUE);
-	if (abs (dOriginX) > DISCRETEFIELD_MAXORIGINCOORDINATE)
+	if (abs(m_dOriginX) > DISCRETEFIELD_MAXORIGINCOORDINATE)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_ORIGINOUTOFRANGE);
-	if (abs(dOriginY) > DISCRETEFIELD_MAXORIGINCOORDINATE)
+	if (abs(m_dOriginY) > DISCRETEFIELD_MAXORIGINCOORDINATE)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_ORIGINOUTOFRANGE);
-
-	m_Data = std::make_unique<std::vector<double>> ();
-
-	m_Data->resize((size_t)m_nPixelCountX * (size_t)m_nPixelCountY);
-
-	if (bDoClear)
-		Clear(dDefaultValue);
-
 }
 		
 CDiscreteFieldData2DInstance::~CDiscreteFieldData2DInstance()
@@ -198,9 +524,6 @@ void CDiscreteFieldData2DInstance::GetSizeInPixels(uint32_t& nPixelCountX, uint3
 
 void CDiscreteFieldData2DInstance::ResizeField(uint32_t& nPixelCountX, uint32_t& nPixelCountY, double dDefaultValue)
 {
-	if (m_Data.get() == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDBUFFER);
-
 	if (nPixelCountX <= 0)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELCOUNT);
 	if (nPixelCountY <= 0)
@@ -214,55 +537,33 @@ void CDiscreteFieldData2DInstance::ResizeField(uint32_t& nPixelCountX, uint32_t&
 		return;
 	}
 
-	auto pNewData = std::make_unique<std::vector<double>>();
+	visitData([&](auto& values) {
+		using TValue = typename std::remove_reference<decltype(values)>::type::value_type;
 
-	pNewData->resize((size_t)nPixelCountX * (size_t)nPixelCountY);
+		std::vector<TValue> newValues;
+		newValues.resize((size_t)nPixelCountX * (size_t)nPixelCountY, (TValue)dDefaultValue);
 
-	for (uint32_t nY = 0; nY < nPixelCountY; nY++) {
-		double* pTarget = &pNewData->at((size_t)nY * (size_t)nPixelCountX);
-
-		if (nY < m_nPixelCountY) {
-			double * pSource = &m_Data->at((size_t)nY * (size_t)m_nPixelCountX);
-
-			for (uint32_t nX = 0; nX < nPixelCountX; nX++) {
-				
-				if (nX < m_nPixelCountX) {
-					*pTarget = *pSource;
-					pSource++;
-				}
-				else {
-					*pTarget = dDefaultValue;
-				}
-				pTarget++;
-			
-			}
+		size_t nCopyCountX = std::min<size_t>(nPixelCountX, m_nPixelCountX);
+		size_t nCopyCountY = std::min<size_t>(nPixelCountY, m_nPixelCountY);
+		for (size_t nY = 0; nY < nCopyCountY; nY++) {
+			const TValue* pSource = values.data() + nY * m_nPixelCountX;
+			std::copy(pSource, pSource + nCopyCountX, newValues.data() + nY * (size_t)nPixelCountX);
 		}
-		else {
-
-			for (uint32_t nX = 0; nX < nPixelCountX; nX++) {
-				*pTarget = dDefaultValue;
-				pTarget++;
-			}
 
-		}
-		
-	}
+		values.swap(newValues);
+	});
 
-	m_Data.reset(pNewData.release ());
 	m_nPixelCountX = nPixelCountX;
 	m_nPixelCountY = nPixelCountY;
 
-
 }
 
 void CDiscreteFieldData2DInstance::Clear(const double dValue)
 {
-	if (m_Data.get() == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDBUFFER);
-
-	for (auto iter = m_Data->begin(); iter != m_Data->end(); iter++) {
-		*iter = dValue;
-	}
+	visitData([&](auto& values) {
+		using TValue = typename std::remove_reference<decltype(values)>::type::value_type;
+		std::fill(values.begin(), values.end(), (TValue)dValue);
+	});
 
 }
 
@@ -271,43 +572,46 @@ void CDiscreteFieldData2DInstance::Clamp(const double dMinValue, const double dM
 	if (dMinValue >= dMaxValue)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCLAMPINTERVAL);
 
-	for (auto iter = m_Data->begin(); iter != m_Data->end(); iter++) {
-		auto dValue = *iter;
-		if (dValue < dMinValue)
-			*iter = dMinValue;
-		if (dValue > dMaxValue)
-			*iter = dMaxValue;
-	}
+	visitData([&](auto& values) {
+		auto pValues = values.data();
+		processValueBlocks(values.size(), [&](size_t nStart, size_t nEnd) {
+			clampValues(pValues + nStart, nEnd - nStart, dMinValue, dMaxValue);
+		});
+	});
 
 }
 
 
 double CDiscreteFieldData2DInstance::GetPixel(const uint32_t nX, const uint32_t nY)
 {
-	if (m_Data.get() == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDBUFFER);
-
 	if (nX >= m_nPixelCountX)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
 	if (nY >= m_nPixelCountY)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
 
 	size_t nAddress = (size_t)nX + (size_t)nY * (size_t)m_nPixelCountX;
-	return m_Data->at(nAddress);
+
+	double dValue = 0.0;
+	visitData([&](auto& values) {
+		dValue = (double)values.at(nAddress);
+	});
+
+	return dValue;
 }
 
 void CDiscreteFieldData2DInstance::SetPixel(const uint32_t nX, const uint32_t nY, const double dValue)
 {
-	if (m_Data.get() == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDBUFFER);
-
 	if (nX >= m_nPixelCountX)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
 	if (nY >= m_nPixelCountY)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
 
 	size_t nAddress = (size_t)nX + (size_t)nY * (size_t)m_nPixelCountX;
-	m_Data->at(nAddress) = dValue;
+
+	visitData([&](auto& values) {
+		using TValue = typename std::remove_reference<decltype(values)>::type::value_type;
+		values.at(nAddress) = (TValue)dValue;
+	});
 
 }
 
@@ -332,45 +636,46 @@ PDiscreteFieldData2DInstance CDiscreteFieldData2DInstance::ScaleFieldDown(const
 	size_t nNewPixelCountX = (m_nPixelCountX + (nFactorX - 1)) / nFactorX;
 	size_t nNewPixelCountY = (m_nPixelCountY + (nFactorY - 1)) / nFactorY;
 
-	PDiscreteFieldData2DInstance pNewField = std::make_shared<CDiscreteFieldData2DInstance>(nNewPixelCountX, nNewPixelCountY, m_dDPIX * (double)nFactorX, m_dDPIY * (double)nFactorX, m_dOriginX, m_dOriginY, 0.0, false);
-
-	for (uint32_t nY = 0; nY < nNewPixelCountY; nY++) {
-
-		double* pTarget = &pNewField->m_Data->at (nY * nNewPixelCountX);
-		for (uint32_t nX = 0; nX < nNewPixelCountX; nX++) {
-			double dValueSum = 0.0;
-			uint32_t nCount = 0;
-
-			for (uint32_t dY = 0; dY < nFactorY; dY++) {
-				size_t nTargetY = ((uint64_t)nY + dY);
+	// The field keeps its size in mm, so the resolution decreases by the scaling factor.
+	PDiscreteFieldData2DInstance pNewField = std::make_shared<CDiscreteFieldData2DInstance>(nNewPixelCountX, nNewPixelCountY, m_dDPIX / (double)nFactorX, m_dDPIY / (double)nFactorY, m_dOriginX, m_dOriginY, 0.0, false, isSinglePrecision());
+
+	visitData([&](auto& values) {
+		using TValue = typename std::remove_reference<decltype(values)>::type::value_type;
+		const TValue* pSourceValues = values.data();
+
+		pNewField->visitData([&](auto& newValues) {
+			using TNewValue = typename std::remove_reference<decltype(newValues)>::type::value_type;
+			TNewValue* pTargetValues = newValues.data();
+
+			// Every target pixel is the average of its factor x factor block of source pixels, cut off at the field border.
+			processRowBlocks(nNewPixelCountY, m_nPixelCountX * nFactorY, [&](size_t nRowStart, size_t nRowEnd) {
+				for (size_t nY = nRowStart; nY < nRowEnd; nY++) {
+					size_t nSourceYStart = nY * nFactorY;
+					size_t nSourceYEnd = std::min<size_t>(nSourceYStart + nFactorY, m_nPixelCountY);
+
+					auto pTarget = pTargetValues + nY * nNewPixelCountX;
+					for (size_t nX = 0; nX < nNewPixelCountX; nX++) {
+						size_t nSourceXStart = nX * nFactorX;
+						size_t nSourceXEnd = std::min<size_t>(nSourceXStart + nFactorX, m_nPixelCountX);
+
+						double dValueSum = 0.0;
+						for (size_t nSourceY = nSourceYStart; nSourceY < nSourceYEnd; nSourceY++) {
+							const TValue* pSource = pSourceValues + nSourceY * m_nPixelCountX;
+							for (size_t nSourceX = nSourceXStart; nSourceX < nSourceXEnd; nSourceX++)
+								dValueSum += (double)pSource[nSourceX];
+						}
 
-				if (nTargetY < m_nPixelCountY) {
+						size_t nCount = (nSourceYEnd - nSourceYStart) * (nSourceXEnd - nSourceXStart);
+						if (nCount == 0)
+							throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INTERNALSCALINGERROR);
 
-					double* pSource = &m_Data->at(nTargetY * (size_t)nFactorY * nNewPixelCountX + nX * (size_t)nFactorX);
-					size_t nTargetX = nX;
-					for (uint32_t dX = 0; dX < nFactorX; dX++) {
-						if (nTargetX < m_nPixelCountX) {
-							dValueSum += *pSource;
-							pSource++;
-							nCount++;
-						}
-						else {
-							break;
-						}
+						*pTarget = (TNewValue)(dValueSum / (double)nCount);
+						pTarget++;
 					}
 				}
-				else {
-					break;
-				}
-			}
-
-			if (nCount == 0)
-				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INTERNALSCALINGERROR);
-
-			*pTarget = dValueSum / (double) nCount;
-			pTarget++;
-		}
-	}
+			});
+		});
+	});
 
 	return pNewField;
 }
@@ -390,25 +695,46 @@ PDiscreteFieldData2DInstance CDiscreteFieldData2DInstance::ScaleFieldUp(const ui
 	if (nNewPixelCountY > DISCRETEFIELD_MAXPIXELCOUNT)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_SCALINGEXCEEDSMAXIMUMPIXELCOUNT);
 
-	PDiscreteFieldData2DInstance pNewField = std::make_shared<CDiscreteFieldData2DInstance>(nNewPixelCountX, nNewPixelCountY, m_dDPIX / (double)nFactorX, m_dDPIY / (double)nFactorX, m_dOriginX, m_dOriginY, 0.0, false);
+	size_t nNewPixelCount = nNewPixelCountX * nNewPixelCountY;
+	PDiscreteFieldData2DInstance pNewField;
 
-	for (uint32_t nY = 0; nY < m_nPixelCountY; nY++) {
+	visitData([&](auto& values) {
+		using TValue = typename std::remove_reference<decltype(values)>::type::value_type;
+		const TValue* pSourceValues = values.data();
 
-		double* pSource = &m_Data->at(nY * m_nPixelCountX);
-		for (uint32_t nX = 0; nX < m_nPixelCountX; nX++) {
-			double dValue = *pSource;
-			pSource++;
+		// The target values are written exactly once, so they are appended instead of being cleared first.
+		std::vector<TValue> newValues;
 
-			for (uint32_t dY = 0; dY < nFactorY; dY++) {
-				double* pTarget = &pNewField->m_Data->at(((size_t)nY * nFactorY + dY) * nNewPixelCountX);
-				for (uint32_t dX = 0; dX < nFactorX; dX++) {
-					*pTarget = dValue;
-					pTarget++;
+		if (getFieldWorkerCount(nNewPixelCount, DISCRETEFIELD_MINPIXELSPERWORKER) > 1) {
+			newValues.resize(nNewPixelCount);
+			TValue* pTargetValues = newValues.data();
+
+			// Every source row is widened once, and then copied into the remaining target rows.
+			processRowBlocks(m_nPixelCountY, nNewPixelCountX * nFactorY, [&](size_t nRowStart, size_t nRowEnd) {
+				for (size_t nY = nRowStart; nY < nRowEnd; nY++) {
+					TValue* pFirstTargetRow = pTargetValues + (nY * nFactorY) * nNewPixelCountX;
+					widenRow(pSourceValues + nY * m_nPixelCountX, m_nPixelCountX, nFactorX, pFirstTargetRow);
+
+					for (uint32_t dY = 1; dY < nFactorY; dY++)
+						std::copy(pFirstTargetRow, pFirstTargetRow + nNewPixelCountX, pFirstTargetRow + dY * nNewPixelCountX);
 				}
-			}
+			});
+		}
+		else {
+			newValues.reserve(nNewPixelCount);
+			std::vector<TValue> widenedRow(nNewPixelCountX);
 
+			for (size_t nY = 0; nY < m_nPixelCountY; nY++) {
+				widenRow(pSourceValues + nY * m_nPixelCountX, m_nPixelCountX, nFactorX, widenedRow.data());
+
+				for (uint32_t dY = 0; dY < nFactorY; dY++)
+					newValues.insert(newValues.end(), widenedRow.begin(), widenedRow.end());
+			}
 		}
-	}
+
+		// The field keeps its size in mm, so the resolution increases by the scaling factor.
+		pNewField = PDiscreteFieldData2DInstance(new CDiscreteFieldData2DInstance(nNewPixelCountX, nNewPixelCountY, m_dDPIX * (double)nFactorX, m_dDPIY * (double)nFactorY, m_dOriginX, m_dOriginY, std::move(newValues)));
+	});
 
 	return pNewField;
 
@@ -416,15 +742,70 @@ PDiscreteFieldData2DInstance CDiscreteFieldData2DInstance::ScaleFieldUp(const ui
 
 void CDiscreteFieldData2DInstance::DiscretizeWithMapping(const uint64_t nDiscreteValuesBufferSize, const double* pDiscreteValuesBuffer, const uint64_t nNewValuesBufferSize, const double* pNewValuesBuffer)
 {
-	throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_NOTIMPLEMENTED);
+	if ((nDiscreteValuesBufferSize == 0) || (pDiscreteValuesBuffer == nullptr))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_EMPTYDISCRETEVALUES);
+	if (nNewValuesBufferSize != nDiscreteValuesBufferSize)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_DISCRETEVALUEMAPPINGMISMATCH);
+	if (pNewValuesBuffer == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+	// Sort the mapping by discrete value, so that the nearest value can be found by binary search.
+	std::vector<std::pair<double, double>> mapping;
+	mapping.reserve(nDiscreteValuesBufferSize);
+	for (uint64_t nIndex = 0; nIndex < nDiscreteValuesBufferSize; nIndex++)
+		mapping.push_back(std::make_pair(pDiscreteValuesBuffer[nIndex], pNewValuesBuffer[nIndex]));
+	std::stable_sort(mapping.begin(), mapping.end(), [](const std::pair<double, double>& a, const std::pair<double, double>& b) { return a.first < b.first; });
+
+	// Duplicate discrete values map to the first given new value.
+	std::vector<double> discreteValues;
+	std::vector<double> newValues;
+	discreteValues.reserve(mapping.size());
+	newValues.reserve(mapping.size());
+	for (auto& entry : mapping) {
+		if (!discreteValues.empty() && (discreteValues.back() == entry.first))
+			newValues.push_back(newValues.back());
+		else
+			newValues.push_back(entry.second);
+		discreteValues.push_back(entry.first);
+	}
+
+	visitData([&](auto& values) {
+		using TValue = typename std::remove_reference<decltype(values)>::type::value_type;
+		TValue* pValues = values.data();
+
+		processValueBlocks(values.size(), [&](size_t nStart, size_t nEnd) {
+			for (size_t nIndex = nStart; nIndex < nEnd; nIndex++) {
+				double dValue = (double)pValues[nIndex];
+				if (std::isnan(dValue))
+					continue;
+
+				// Of two equally near discrete values, the smaller one is chosen.
+				size_t nUpper = std::lower_bound(discreteValues.begin(), discreteValues.end(), dValue) - discreteValues.begin();
+				size_t nNearest;
+				if (nUpper == 0) {
+					nNearest = 0;
+				}
+				else if (nUpper == discreteValues.size()) {
+					nNearest = nUpper - 1;
+				}
+				else {
+					nNearest = ((discreteValues[nUpper] - dValue) < (dValue - discreteValues[nUpper - 1])) ? nUpper : (nUpper - 1);
+				}
+
+				pValues[nIndex] = (TValue)newValues[nNearest];
+			}
+		});
+	});
 }
 
 void CDiscreteFieldData2DInstance::TransformField(const double dScale, const double dOffset)
 {
-	for (auto iter = m_Data->begin(); iter != m_Data->end(); iter++) {
-		double dValue = *iter;
-		*iter = (dValue * dScale) + dOffset;
-	}
+	visitData([&](auto& values) {
+		auto pValues = values.data();
+		processValueBlocks(values.size(), [&](size_t nStart, size_t nEnd) {
+			transformValues(pValues + nStart, nEnd - nStart, dScale, dOffset);
+		});
+	});
 }
 
 void CDiscreteFieldData2DInstance::AddField(CDiscreteFieldData2DInstance* pOtherField, const double dScale, const double dOffset)
@@ -438,29 +819,31 @@ void CDiscreteFieldData2DInstance::AddField(CDiscreteFieldData2DInstance* pOther
 	if (pOtherField->m_nPixelCountY != m_nPixelCountY)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDSIZE);
 
-	if (pOtherField->m_Data->size() != m_Data->size())
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INTERNALFIELDSIZEERROR);
-
-	auto srcIter = pOtherField->m_Data->begin();
-	for (auto dstIter = m_Data->begin(); dstIter != m_Data->end();) {
-		*dstIter += (*srcIter * dScale) + dOffset;
-		srcIter++;
-		dstIter++;
-	}
+	visitData([&](auto& values) {
+		pOtherField->visitData([&](auto& otherValues) {
+			if (otherValues.size() != values.size())
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INTERNALFIELDSIZEERROR);
+
+			auto pValues = values.data();
+			auto pOtherValues = otherValues.data();
+			processValueBlocks(values.size(), [&](size_t nStart, size_t nEnd) {
+				addValues(pValues + nStart, pOtherValues + nStart, nEnd - nStart, dScale, dOffset);
+			});
+		});
+	});
 }
 
 PDiscreteFieldData2DInstance CDiscreteFieldData2DInstance::Duplicate()
 {
-	PDiscreteFieldData2DInstance pNewField = std::make_shared<CDiscreteFieldData2DInstance>(m_nPixelCountX, m_nPixelCountY, m_dDPIX, m_dDPIY, m_dOriginX, m_dOriginY, 0.0, false);
-	if (pNewField->m_Data->size () != m_Data->size ())
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INTERNALFIELDSIZEERROR);
+	PDiscreteFieldData2DInstance pNewField = std::make_shared<CDiscreteFieldData2DInstance>(m_nPixelCountX, m_nPixelCountY, m_dDPIX, m_dDPIY, m_dOriginX, m_dOriginY, 0.0, false, isSinglePrecision());
 
-	auto dstIter = pNewField->m_Data->begin();
-	for (auto srcIter = m_Data->begin(); srcIter != m_Data->end();) {
-		*dstIter = *srcIter;
-		srcIter++;
-		dstIter++;
-	}
+	visitData([&](auto& values) {
+		pNewField->visitData([&](auto& newValues) {
+			if (newValues.size() != values.size())
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INTERNALFIELDSIZEERROR);
+			std::copy(values.begin(), values.end(), newValues.begin());
+		});
+	});
 
 	return pNewField;
 
@@ -481,72 +864,16 @@ void CDiscreteFieldData2DInstance::renderRGBImage(std::vector<uint8_t>* pPixelDa
 	if (dDeltaMax < 0.0)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCOLORRANGE);
 
-	size_t nPixelIndex = 0;
-
-	for (auto iter = m_Data->begin(); iter != m_Data->end(); iter++) {
-		double dValue = *iter;
-		double dFactor;
-
-		double dRed, dGreen, dBlue;
-
-		if (dValue < midValue) {
-
-			if (dDeltaMin > DISCRETEFIELD_MINVALUEDISTANCE) {
-				dFactor = (dValue - minValue) / dDeltaMin;
-			}
-			else {
-				dFactor = 0.0;
-			}
-
-			if (dFactor < 0.0)
-				dFactor = 0.0;
+	sRGBColorScale colorScale = { minValue, midValue, maxValue, { minRed, minGreen, minBlue }, { midRed, midGreen, midBlue }, { maxRed, maxGreen, maxBlue } };
+	uint8_t* pPixels = pPixelData->data();
 
-			if (dFactor > 1.0)
-				dFactor = 1.0;
+	visitData([&](auto& values) {
+		auto pValues = values.data();
 
-			dRed = minRed * (1.0 - dFactor) + midRed * dFactor;
-			dGreen = minGreen * (1.0 - dFactor) + midGreen * dFactor;
-			dBlue = minBlue * (1.0 - dFactor) + midBlue * dFactor;
-
-
-		} else {
-
-			if (dDeltaMax > DISCRETEFIELD_MINVALUEDISTANCE) {
-				dFactor = (dValue - midValue) / dDeltaMax;
-			}
-			else {
-				dFactor = 0.0;
-			}
-
-			if (dFactor < 0.0)
-				dFactor = 0.0;
-
-			if (dFactor > 1.0)
-				dFactor = 1.0;
-
-			dRed = midRed * (1.0 - dFactor) + maxRed * dFactor;
-			dGreen = midGreen * (1.0 - dFactor) + maxGreen * dFactor;
-			dBlue = midBlue * (1.0 - dFactor) + maxBlue * dFactor;
-
-
-		}
-
-		dRed = std::clamp(dRed, 0.0, 1.0);
-		dGreen = std::clamp(dGreen, 0.0, 1.0);
-		dBlue = std::clamp(dBlue, 0.0, 1.0);
-
-		uint8_t nRed = (uint8_t) round(dRed * 255.0);
-		uint8_t nGreen = (uint8_t)round(dGreen * 255.0);
-		uint8_t nBlue = (uint8_t)round(dBlue * 255.0);
-
-		pPixelData->at(nPixelIndex * 3) = nRed;
-		pPixelData->at(nPixelIndex * 3 + 1) = nGreen;
-		pPixelData->at(nPixelIndex * 3 + 2) = nBlue;
-
-		nPixelIndex++;
-	}
-
-	
+		processValueBlocks(values.size(), [&](size_t nStart, size_t nEnd) {
+			renderRGBValues(pValues + nStart, nEnd - nStart, pPixels + nStart * 3, colorScale);
+		});
+	});
 	
 }
 
@@ -563,62 +890,76 @@ void CDiscreteFieldData2DInstance::renderAveragePointValues_FloorSampling(const
 	if (pPointValuesBuffer == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
 
-	std::vector<double> sampleSumBuffer;
-	sampleSumBuffer.resize(m_nPixelCountX * m_nPixelCountY);
+	size_t nPixelCount = m_nPixelCountX * m_nPixelCountY;
 
+	// Every worker bins a consecutive range of points into its own sum and count buffers.
+	// The number of workers is limited, so that the accumulators do not exceed the memory limit.
+	size_t nWorkerCount = getFieldWorkerCount(nPointValuesBufferSize, DISCRETEFIELD_MINPOINTSPERWORKER);
+	uint64_t nAccumulatorSize = (uint64_t)nPixelCount * (sizeof(double) + sizeof(uint32_t));
+	uint64_t nMaxWorkerCount = DISCRETEFIELD_MAXPOINTACCUMULATORMEMORY / nAccumulatorSize;
+	if (nWorkerCount > nMaxWorkerCount)
+		nWorkerCount = (size_t) nMaxWorkerCount;
+	if (nWorkerCount < 1)
+		nWorkerCount = 1;
 
-	std::vector<uint32_t> sampleCountBuffer;
-	sampleCountBuffer.resize(m_nPixelCountX * m_nPixelCountY);
-	for (auto& sampleCount : sampleCountBuffer)
-		sampleCount = 0;
+	std::vector<std::vector<double>> sampleSumBuffers(nWorkerCount);
+	std::vector<std::vector<uint32_t>> sampleCountBuffers(nWorkerCount);
 
 	double dPixelPerMMX = m_dDPIX / 25.4;
 	double dPixelPerMMY = m_dDPIY / 25.4;
 
-	auto pPointValue = pPointValuesBuffer;
-	for (size_t nPointValueIndex = 0; nPointValueIndex < nPointValuesBufferSize; nPointValueIndex++) {
-		double dPixelPositionX = (pPointValue->m_Coordinates[0] - m_dOriginX) * dPixelPerMMX;
-		double dPixelPositionY = (pPointValue->m_Coordinates[1] - m_dOriginY) * dPixelPerMMY;
-		double dValue = pPointValue->m_Value;
+	runFieldWorkers(nWorkerCount, [&](size_t nWorkerIndex) {
+		auto& sampleSumBuffer = sampleSumBuffers.at(nWorkerIndex);
+		auto& sampleCountBuffer = sampleCountBuffers.at(nWorkerIndex);
+		sampleSumBuffer.resize(nPixelCount, 0.0);
+		sampleCountBuffer.resize(nPixelCount, 0);
 
-		int64_t nRoundedPixelPositionX = (int64_t) floor(dPixelPositionX);
-		int64_t nRoundedPixelPositionY = (int64_t) floor(dPixelPositionY);
+		double* pSampleSums = sampleSumBuffer.data();
+		uint32_t* pSampleCounts = sampleCountBuffer.data();
 
-		if ((nRoundedPixelPositionX >= 0) && (nRoundedPixelPositionY >= 0) &&
-			(nRoundedPixelPositionX < (int64_t) m_nPixelCountX) && (nRoundedPixelPositionY < (int64_t) m_nPixelCountY)) {
+		size_t nPointStart = (size_t)((nPointValuesBufferSize * nWorkerIndex) / nWorkerCount);
+		size_t nPointEnd = (size_t)((nPointValuesBufferSize * (nWorkerIndex + 1)) / nWorkerCount);
 
-			size_t nAddress = nRoundedPixelPositionX + nRoundedPixelPositionY * m_nPixelCountX;
-			auto & sampleCount = sampleCountBuffer.at (nAddress);
-			auto & sampleSum = sampleSumBuffer.at(nAddress);
-			if (sampleCount == 0) {
-				sampleSum = dValue;
-				sampleCount = 1;
-			}
-			else {
-				sampleSum += dValue;
-				sampleCount++;
-			}
+		for (size_t nPointValueIndex = nPointStart; nPointValueIndex < nPointEnd; nPointValueIndex++) {
+			auto& pointValue = pPointValuesBuffer[nPointValueIndex];
+			double dPixelPositionX = (pointValue.m_Coordinates[0] - m_dOriginX) * dPixelPerMMX;
+			double dPixelPositionY = (pointValue.m_Coordinates[1] - m_dOriginY) * dPixelPerMMY;
 
-		}
-
-		pPointValue++;
-	}
+			int64_t nRoundedPixelPositionX = (int64_t)floor(dPixelPositionX);
+			int64_t nRoundedPixelPositionY = (int64_t)floor(dPixelPositionY);
 
-	for (uint32_t nY = 0; nY < m_nPixelCountY; nY++) {
-		for (uint32_t nX = 0; nX < m_nPixelCountX; nX++) {
-			size_t nAddress = nX + nY * m_nPixelCountX;
-			auto& sampleCount = sampleCountBuffer.at(nAddress);
-			auto& sampleSum = sampleSumBuffer.at(nAddress);
+			if ((nRoundedPixelPositionX >= 0) && (nRoundedPixelPositionY >= 0) &&
+				(nRoundedPixelPositionX < (int64_t)m_nPixelCountX) && (nRoundedPixelPositionY < (int64_t)m_nPixelCountY)) {
 
-			if (sampleCount == 0) {
-				SetPixel(nX, nY, dDefaultValue);
-			}
-			else {
-				SetPixel(nX, nY, sampleSum / (double)sampleCount);
+				size_t nAddress = nRoundedPixelPositionX + nRoundedPixelPositionY * m_nPixelCountX;
+				pSampleSums[nAddress] += pointValue.m_Value;
+				pSampleCounts[nAddress]++;
 			}
 		}
+	});
+
+	visitData([&](auto& values) {
+		using TValue = typename std::remove_reference<decltype(values)>::type::value_type;
+		TValue* pValues = values.data();
+
+		processValueBlocks(nPixelCount, [&](size_t nStart, size_t nEnd) {
+			for (size_t nAddress = nStart; nAddress < nEnd; nAddress++) {
+				double dSampleSum = 0.0;
+				uint64_t nSampleCount = 0;
+				for (size_t nWorkerIndex = 0; nWorkerIndex < nWorkerCount; nWorkerIndex++) {
+					dSampleSum += sampleSumBuffers[nWorkerIndex][nAddress];
+					nSampleCount += sampleCountBuffers[nWorkerIndex][nAddress];
+				}
 
-	}
+				if (nSampleCount == 0) {
+					pValues[nAddress] = (TValue)dDefaultValue;
+				}
+				else {
+					pValues[nAddress] = (TValue)(dSampleSum / (double)nSampleCount);
+				}
+			}
+		});
+	});
 
 }
 
@@ -642,109 +983,87 @@ void CDiscreteFieldData2DInstance::saveToBuffer(std::vector<uint8_t>& Buffer)
 	header->m_dOriginY = m_dOriginY;
 	header->m_nDataOffset = sizeof(sDiscreteField2DStreamHeader);
 
-	double* pSourcePtr = m_Data.get()->data();
-	double* pTargetPtr = (double*)&Buffer.at(header->m_nDataOffset);
-	for (uint64_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
-		*pTargetPtr = *pSourcePtr;
-		pTargetPtr++;
-		pSourcePtr++;
-	}
+	// Streams always store double values
+	uint8_t* pTarget = &Buffer.at(header->m_nDataOffset);
+	visitData([&](auto& values) {
+		for (uint64_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			double dValue = (double)values[nIndex];
+			memcpy((void*)pTarget, (const void*)&dValue, sizeof(double));
+			pTarget += sizeof(double);
+		}
+	});
 }
 
 void CDiscreteFieldData2DInstance::loadFromRawPixelData(const std::vector<uint8_t>& pixelData, LibMCEnv::eImagePixelFormat pixelFormat, double dBlackValue, double dWhiteValue)
 {
-
+	size_t nBytesPerPixel;
 	switch (pixelFormat) {
-	case LibMCEnv::eImagePixelFormat::GreyScale8bit:
-		if (pixelData.size() != (m_nPixelCountX * m_nPixelCountY))
-			throw eLibMCEnvImagePixelFormat(LIBMCENV_ERROR_RAWPIXELDATASIZEMISMATCH);
-
-		for (uint32_t nY = 0; nY < m_nPixelCountY; nY++) {
-
-			double* pTarget = &m_Data->at(nY * m_nPixelCountX);
-			const uint8_t* pSource = &pixelData.at (nY * m_nPixelCountX);
-			for (uint32_t nX = 0; nX < m_nPixelCountX; nX++) {
-				double dGreyScale = (*pSource) / 255.0;
-				pSource++;
-
-				double dValue = (1.0 - dGreyScale) * dBlackValue + dGreyScale * dWhiteValue;
-				*pTarget = dValue;
-				pTarget++;
-
-			}
-		}
-
-
-
-		break;
-
-	case LibMCEnv::eImagePixelFormat::RGB24bit:
-		if (pixelData.size() != (m_nPixelCountX * m_nPixelCountY * 3))
-			throw eLibMCEnvImagePixelFormat(LIBMCENV_ERROR_RAWPIXELDATASIZEMISMATCH);
-
-		for (uint32_t nY = 0; nY < m_nPixelCountY; nY++) {
+		case LibMCEnv::eImagePixelFormat::GreyScale8bit: nBytesPerPixel = 1; break;
+		case LibMCEnv::eImagePixelFormat::RGB24bit: nBytesPerPixel = 3; break;
+		case LibMCEnv::eImagePixelFormat::RGBA32bit: nBytesPerPixel = 4; break;
+		default:
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
+	}
 
-			double* pTarget = &m_Data->at(nY * m_nPixelCountX);
-			const uint8_t* pSource = &pixelData.at(nY * m_nPixelCountX * 3);
-			for (uint32_t nX = 0; nX < m_nPixelCountX; nX++) {
-				int64_t nRed = *pSource; 
-				pSource++;
+	if (pixelData.size() != (m_nPixelCountX * m_nPixelCountY * nBytesPerPixel))
+		throw eLibMCEnvImagePixelFormat(LIBMCENV_ERROR_RAWPIXELDATASIZEMISMATCH);
 
-				int64_t nGreen = *pSource;
-				pSource++;
+	visitData([&](auto& values) {
+		using TValue = typename std::remove_reference<decltype(values)>::type::value_type;
+		TValue* pValues = values.data();
 
-				int64_t nBlue = *pSource;
-				pSource++;
+		processRowBlocks(m_nPixelCountY, m_nPixelCountX, [&](size_t nRowStart, size_t nRowEnd) {
+			for (size_t nY = nRowStart; nY < nRowEnd; nY++) {
 
-				double dGreyScale = (nRed + nGreen + nBlue) / (255.0 * 3);
+				TValue* pTarget = pValues + nY * m_nPixelCountX;
+				const uint8_t* pSource = pixelData.data() + nY * m_nPixelCountX * nBytesPerPixel;
+				for (size_t nX = 0; nX < m_nPixelCountX; nX++) {
+					double dGreyScale;
+					if (nBytesPerPixel == 1) {
+						dGreyScale = (*pSource) / 255.0;
+					}
+					else {
+						// RGB colors are averaged, alpha is skipped
+						int64_t nRed = pSource[0];
+						int64_t nGreen = pSource[1];
+						int64_t nBlue = pSource[2];
+						dGreyScale = (nRed + nGreen + nBlue) / (255.0 * 3);
+					}
+					pSource += nBytesPerPixel;
 
-				double dValue = (1.0 - dGreyScale) * dBlackValue + dGreyScale * dWhiteValue;
-				*pTarget = dValue;
-				pTarget++;
+					double dValue = (1.0 - dGreyScale) * dBlackValue + dGreyScale * dWhiteValue;
+					*pTarget = (TValue)dValue;
+					pTarget++;
 
+				}
 			}
-		}
-
-
-
-		break;
+		});
+	});
 
-	case LibMCEnv::eImagePixelFormat::RGBA32bit:
-		if (pixelData.size() != (m_nPixelCountX * m_nPixelCountY * 4))
-			throw eLibMCEnvImagePixelFormat(LIBMCENV_ERROR_RAWPIXELDATASIZEMISMATCH);
-
-		for (uint32_t nY = 0; nY < m_nPixelCountY; nY++) {
-
-			double* pTarget = &m_Data->at(nY * m_nPixelCountX);
-			const uint8_t* pSource = &pixelData.at(nY * m_nPixelCountX * 4);
-			for (uint32_t nX = 0; nX < m_nPixelCountX; nX++) {
-				int64_t nRed = *pSource;
-				pSource++;
-
-				int64_t nGreen = *pSource;
-				pSource++;
-
-				int64_t nBlue = *pSource;
-				pSource++;
-
-				// Skip Alpha
-				pSource++;
-
-				double dGreyScale = (nRed + nGreen + nBlue) / (255.0 * 3);
-
-				double dValue = (1.0 - dGreyScale) * dBlackValue + dGreyScale * dWhiteValue;
-				*pTarget = dValue;
-				pTarget++;
-
-			}
-		}
+}
 
+bool CDiscreteFieldData2DInstance::isSinglePrecision()
+{
+	return (m_SinglePrecisionData.get() != nullptr);
+}
 
+void CDiscreteFieldData2DInstance::setSinglePrecision(bool bSinglePrecision)
+{
+	if (bSinglePrecision == isSinglePrecision())
+		return;
 
-		break;
+	if (bSinglePrecision) {
+		if (m_Data.get() == nullptr)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDBUFFER);
 
-	default:
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
+		auto pNewData = std::make_unique<std::vector<float>>(m_Data->size());
+		std::transform(m_Data->begin(), m_Data->end(), pNewData->begin(), [](double dValue) { return (float)dValue; });
+		m_SinglePrecisionData.reset(pNewData.release());
+		m_Data.reset();
+	}
+	else {
+		auto pNewData = std::make_unique<std::vector<double>>(m_SinglePrecisionData->begin(), m_SinglePrecisionData->end());
+		m_Data.reset(pNewData.release());
+		m_SinglePrecisionData.reset();
 	}
-
 }
@@ -57,13 +57,24 @@ namespace AMC {
 		double m_dOriginX;
 		double m_dOriginY;
 		
+		// Exactly one of the two buffers is allocated, depending on the storage precision.
 		std::unique_ptr<std::vector<double>> m_Data;
+		std::unique_ptr<std::vector<float>> m_SinglePrecisionData;
+
+		// Calls function with the allocated value vector (std::vector<double>& or std::vector<float>&).
+		template <typename TFunction> void visitData(TFunction function);
+
+		// Takes over a value vector that has already been filled, without clearing it first.
+		CDiscreteFieldData2DInstance(size_t nPixelCountX, size_t nPixelCountY, double dDPIX, double dDPIY, double dOriginX, double dOriginY, std::vector<double>&& values);
+		CDiscreteFieldData2DInstance(size_t nPixelCountX, size_t nPixelCountY, double dDPIX, double dDPIY, double dOriginX, double dOriginY, std::vector<float>&& values);
+
+		void checkLayout();
 
 	public:
 
 		static PDiscreteFieldData2DInstance createFromBuffer(const std::vector<uint8_t> & Buffer);
 
-		CDiscreteFieldData2DInstance(size_t nPixelCountX, size_t nPixelCountY, double dDPIX, double dDPIY, double dOriginX, double dOriginY, double dDefaultValue, bool bDoClear);
+		CDiscreteFieldData2DInstance(size_t nPixelCountX, size_t nPixelCountY, double dDPIX, double dDPIY, double dOriginX, double dOriginY, double dDefaultValue, bool bDoClear, bool bSinglePrecision = false);
 		
 		virtual ~CDiscreteFieldData2DInstance();
 
@@ -114,6 +125,11 @@ namespace AMC {
 		void saveToBuffer (std::vector<uint8_t> & Buffer);
 
 		void loadFromRawPixelData (const std::vector<uint8_t>& pixelData, LibMCEnv::eImagePixelFormat pixelFormat, double dBlackValue, double dWhiteValue);
+
+		bool isSinglePrecision();
+
+		// Converts the field values into float or double storage.
+		void setSinglePrecision(bool bSinglePrecision);
 		
 	};
 
@@ -38,9 +38,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "libmcenv_driverenvironment.hpp"
 #include "libmc_exceptiontypes.hpp"
 #include "amc_logger.hpp"
+#include "amc_dependencytaskrunner.hpp"
 
 #include <vector>
 #include <memory>
+#include <set>
 
 #include <iostream>
 
@@ -85,21 +87,39 @@ CDriverHandler::~CDriverHandler()
 
 void CDriverHandler::registerDriver(const std::string& sName, const std::string& sType, const std::string& sLibraryName, const std::string& sLibraryPath, const std::string& sResourcePath, const std::string& sDriverConfigurationData, AMC::PResourcePackage pMachineResourcePackage)
 {
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
-
 	if (pMachineResourcePackage.get() == nullptr)
 		throw ELibMCCustomException(LIBMC_ERROR_INVALIDPARAM, "no machine package");
 
-	if (findDriver(sName, false) != nullptr)
-		throw ELibMCCustomException(LIBMC_ERROR_DRIVERALREADYREGISTERED, sName);
+	if (sLibraryPath.empty())
+		throw ELibMCCustomException(LIBMC_ERROR_LIBRARYPATHNOTFOUND, sLibraryName);
+
+	std::shared_ptr<std::mutex> pLibraryMutex;
+	std::string sTempBasePath;
+
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+		if (findDriver(sName, false) != nullptr)
+			throw ELibMCCustomException(LIBMC_ERROR_DRIVERALREADYREGISTERED, sName);
 
-	if (m_sTempBasePath.empty ())
-		throw ELibMCInterfaceException(LIBMC_ERROR_TEMPBASEPATHEMPTY);
+		if (m_sTempBasePath.empty())
+			throw ELibMCInterfaceException(LIBMC_ERROR_TEMPBASEPATHEMPTY);
+		sTempBasePath = m_sTempBasePath;
 
+		auto iMutexIter = m_LibraryMutexMap.find(sLibraryName);
+		if (iMutexIter != m_LibraryMutexMap.end()) {
+			pLibraryMutex = iMutexIter->second;
+		}
+		else {
+			pLibraryMutex = std::make_shared<std::mutex>();
+			m_LibraryMutexMap.insert(std::make_pair(sLibraryName, pLibraryMutex));
+		}
+	}
+
+	// The driver resource package is only read when the driver accesses it
 	PResourcePackage pDriverResourcePackage;
 	if (!sResourcePath.empty()) {
-		auto pStream = std::make_shared <AMCCommon::CImportStream_Native> (sResourcePath);
-		pDriverResourcePackage = CResourcePackage::makeFromStream(pStream, sResourcePath, AMCPACKAGE_SCHEMANAMESPACE);
+		pDriverResourcePackage = CResourcePackage::makeFromFile(sResourcePath, sResourcePath, AMCPACKAGE_SCHEMANAMESPACE);
 	}
 	else {
 		pDriverResourcePackage = CResourcePackage::makeEmpty(sResourcePath);
@@ -108,32 +128,159 @@ void CDriverHandler::registerDriver(const std::string& sName, const std::string&
 	auto pParameterGroup = std::make_shared<CParameterGroup>(m_pGlobalChrono);
 	pParameterGroup->setJournal(m_pStateJournal, sName);
 
-	auto pInternalEnvironment = std::make_shared<LibMCEnv::Impl::CDriverEnvironment>(pParameterGroup, pDriverResourcePackage, pMachineResourcePackage, m_pToolpathHandler, m_pMeshHandler, m_sTempBasePath, m_pLogger, m_pDataModel, m_pGlobalChrono, sName, m_pStateJournal);
+	auto pInternalEnvironment = std::make_shared<LibMCEnv::Impl::CDriverEnvironment>(pParameterGroup, pDriverResourcePackage, pMachineResourcePackage, m_pToolpathHandler, m_pMeshHandler, sTempBasePath, m_pLogger, m_pDataModel, m_pGlobalChrono, sName, m_pStateJournal);
 
 	pInternalEnvironment->setIsInitializing(true);
 
+	std::lock_guard<std::mutex> libraryLockGuard(*pLibraryMutex);
+
 	LibMCDriver::PWrapper pLibraryWrapper;
-	auto iDLLIter = m_DriverWrapperMap.find(sLibraryName);
-	if (iDLLIter != m_DriverWrapperMap.end()) {
-		pLibraryWrapper = iDLLIter->second;
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		auto iDLLIter = m_DriverWrapperMap.find(sLibraryName);
+		if (iDLLIter != m_DriverWrapperMap.end())
+			pLibraryWrapper = iDLLIter->second;
 	}
-	else {
+
+	if (pLibraryWrapper.get() == nullptr) {
 		pLibraryWrapper = LibMCDriver::CWrapper::loadLibrary(sLibraryPath);
 		pLibraryWrapper->InjectComponent("LibMCEnv", m_pEnvironmentWrapper->GetSymbolLookupMethod());
 
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
 		m_DriverWrapperMap.insert(std::make_pair (sLibraryName, pLibraryWrapper));
 	}
-	
 
 	PDriver pDriver = std::make_shared <CDriver>(sName, sType, pLibraryWrapper, pDriverResourcePackage, pParameterGroup, m_pEnvironmentWrapper, pInternalEnvironment);
-	m_DriverList.push_back(pDriver);
-	m_DriverMap.insert(std::make_pair(sName, pDriver));	
+
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		if (findDriver(sName, false) != nullptr)
+			throw ELibMCCustomException(LIBMC_ERROR_DRIVERALREADYREGISTERED, sName);
+
+		m_DriverList.push_back(pDriver);
+		m_DriverMap.insert(std::make_pair(sName, pDriver));
+	}
 
 	pDriver->configureDriver (sDriverConfigurationData);
 
 	pInternalEnvironment->setIsInitializing(false);
 }
 
+void CDriverHandler::registerDrivers(const std::vector<sDriverRegistration>& Registrations, AMC::PResourcePackage pMachineResourcePackage, uint32_t nMaxThreadCount)
+{
+	if (pMachineResourcePackage.get() == nullptr)
+		throw ELibMCCustomException(LIBMC_ERROR_INVALIDPARAM, "no machine package");
+
+	std::set<std::string> registeredNames;
+	std::set<std::string> batchNames;
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		for (auto pDriver : m_DriverList)
+			registeredNames.insert(pDriver->getName());
+	}
+
+	// Duplicate names fail only the later driver, as they did when drivers were registered one by one.
+	std::vector<const sDriverRegistration*> pendingRegistrations;
+	for (auto& registration : Registrations) {
+		if ((registeredNames.find(registration.m_sName) != registeredNames.end()) || (batchNames.find(registration.m_sName) != batchNames.end())) {
+			m_pLogger->logMessage("Driver error: driver already registered: " + registration.m_sName, LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::FatalError);
+			continue;
+		}
+
+		batchNames.insert(registration.m_sName);
+		pendingRegistrations.push_back(&registration);
+	}
+
+	// A driver is scheduled if all its dependencies are either registered already or scheduled themselves.
+	// Drivers with unknown or cyclic dependencies are logged and left out, instead of failing the whole configuration.
+	std::set<std::string> scheduledNames;
+	bool bChanged = true;
+	while (bChanged) {
+		bChanged = false;
+		for (auto pRegistration : pendingRegistrations) {
+			if (scheduledNames.find(pRegistration->m_sName) != scheduledNames.end())
+				continue;
+
+			bool bResolved = true;
+			for (auto& sDependency : pRegistration->m_Dependencies) {
+				if ((registeredNames.find(sDependency) == registeredNames.end()) && (scheduledNames.find(sDependency) == scheduledNames.end()))
+					bResolved = false;
+			}
+
+			if (bResolved) {
+				scheduledNames.insert(pRegistration->m_sName);
+				bChanged = true;
+			}
+		}
+	}
+
+	CDependencyTaskRunner taskRunner;
+	std::vector<const sDriverRegistration*> scheduledRegistrations;
+	for (auto pRegistration : pendingRegistrations) {
+		if (scheduledNames.find(pRegistration->m_sName) == scheduledNames.end()) {
+			std::string sReason = "cyclic driver dependency";
+			for (auto& sDependency : pRegistration->m_Dependencies) {
+				if ((registeredNames.find(sDependency) == registeredNames.end()) && (batchNames.find(sDependency) == batchNames.end()))
+					sReason = "unknown driver dependency " + sDependency;
+			}
+
+			m_pLogger->logMessage("Driver error: " + pRegistration->m_sName + ": " + sReason, LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::FatalError);
+			continue;
+		}
+
+		// Dependencies on drivers of earlier calls are already fulfilled.
+		std::vector<std::string> batchDependencies;
+		for (auto& sDependency : pRegistration->m_Dependencies) {
+			if (batchNames.find(sDependency) != batchNames.end())
+				batchDependencies.push_back(sDependency);
+		}
+
+		const sDriverRegistration registration = *pRegistration;
+		taskRunner.addTask(registration.m_sName, batchDependencies, [this, registration, pMachineResourcePackage]() {
+			registerDriver(registration.m_sName, registration.m_sType, registration.m_sLibraryName, registration.m_sLibraryPath, registration.m_sResourcePath, registration.m_sConfigurationData, pMachineResourcePackage);
+		});
+		scheduledRegistrations.push_back(pRegistration);
+	}
+
+	uint32_t nThreadCount = nMaxThreadCount;
+	if (nThreadCount > taskRunner.getTaskCount())
+		nThreadCount = taskRunner.getTaskCount();
+	if (nThreadCount < AMC_DEPENDENCYTASKRUNNER_MINTHREADCOUNT)
+		nThreadCount = AMC_DEPENDENCYTASKRUNNER_MINTHREADCOUNT;
+
+	taskRunner.run(nThreadCount);
+
+	// The drivers have been added in the order their initialization finished. Restore the configuration order.
+	{
+		std::map<std::string, size_t> registrationIndices;
+		for (size_t nIndex = 0; nIndex < Registrations.size(); nIndex++)
+			registrationIndices.insert(std::make_pair(Registrations.at(nIndex).m_sName, nIndex + 1));
+
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		m_DriverList.sort([&registrationIndices, &registeredNames](PDriver pFirst, PDriver pSecond) {
+			auto getOrderIndex = [&registrationIndices, &registeredNames](PDriver pDriver) -> size_t {
+				std::string sName = pDriver->getName();
+				if (registeredNames.find(sName) != registeredNames.end())
+					return 0;
+				auto iIter = registrationIndices.find(sName);
+				return (iIter != registrationIndices.end()) ? iIter->second : 0;
+			};
+			return getOrderIndex(pFirst) < getOrderIndex(pSecond);
+		});
+	}
+
+	for (auto pRegistration : scheduledRegistrations) {
+		auto& sName = pRegistration->m_sName;
+		auto taskState = taskRunner.getTaskState(sName);
+		uint64_t nDurationInMilliseconds = taskRunner.getTaskDurationInMicroseconds(sName) / 1000;
+
+		if (taskState == eDependencyTaskState::Succeeded)
+			m_pLogger->logMessage("Initialized " + sName + " in " + std::to_string (nDurationInMilliseconds) + "ms", LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::Message);
+		else
+			m_pLogger->logMessage("Driver error: " + taskRunner.getTaskErrorMessage(sName), LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::FatalError);
+	}
+}
+
 CDriver* CDriverHandler::findDriver(const std::string& sName, bool bFailIfNotExisting)
 {
 	auto iIterator = m_DriverMap.find(sName);
@@ -188,5 +335,6 @@ void CDriverHandler::GetDriverInformation(const std::string& sName, std::string&
 
 void CDriverHandler::setTempBasePath(const std::string& sTempBasePath)
 {
+	std::lock_guard<std::mutex> lockGuard(m_Mutex);
 	m_sTempBasePath = sTempBasePath;
 }
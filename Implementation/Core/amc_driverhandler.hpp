@@ -34,6 +34,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <map>
 #include <list>
+#include <vector>
 #include <string>
 #include <thread>
 #include <mutex>
@@ -44,6 +45,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define AMCPACKAGE_SCHEMANAMESPACE "http://schemas.autodesk.com/amc/resourcepackage/2020/07"
 
+#define AMC_DRIVERHANDLER_MAXINITIALIZATIONTHREADS 8
+
 namespace LibMCData {
 	class CDataModel;
 	typedef std::shared_ptr<CDataModel> PDataModel;
@@ -72,6 +75,17 @@ namespace AMC {
 	class CMeshHandler;
 	typedef std::shared_ptr<CMeshHandler> PMeshHandler;
 
+	typedef struct _sDriverRegistration {
+		std::string m_sName;
+		std::string m_sType;
+		std::string m_sLibraryName;
+		std::string m_sLibraryPath;
+		std::string m_sResourcePath;
+		std::string m_sConfigurationData;
+		// Names of drivers that need to be initialized successfully before this driver
+		std::vector<std::string> m_Dependencies;
+	} sDriverRegistration;
+
 	class CDriverHandler {
 	private:
 
@@ -91,6 +105,9 @@ namespace AMC {
 		// Loaded DLL Wrappers for the drivers
 		std::map<std::string, LibMCDriver::PWrapper> m_DriverWrapperMap;
 
+		// Drivers of the same library are never loaded or initialized concurrently
+		std::map<std::string, std::shared_ptr<std::mutex>> m_LibraryMutexMap;
+
 		// Mutex for safe Multi-Thread-Handling
 		std::mutex m_Mutex;
 
@@ -104,6 +121,10 @@ namespace AMC {
 
 		void registerDriver(const std::string& sName, const std::string& sType, const std::string & sLibraryName, const std::string& sLibraryPath, const std::string & sResourcePath, const std::string & sDriverConfigurationData, AMC::PResourcePackage pMachineResourcePackage);
 
+		// Initializes drivers on up to nMaxThreadCount threads, in the order of their dependencies.
+		// Failing drivers, and the drivers depending on them, are logged and do not stop the other drivers.
+		void registerDrivers(const std::vector<sDriverRegistration>& Registrations, AMC::PResourcePackage pMachineResourcePackage, uint32_t nMaxThreadCount);
+
 		void GetDriverInformation (const std::string& sName, std::string& sType, HSymbolLookupHandle & pSymbolLookup);
 
 		HDriverHandle acquireDriver (const std::string& sName, const std::string& sInstanceName);
@@ -107,6 +107,15 @@ void CJSONWriterObject::copyFromObject(const rapidjson::Value& objectValue)
 	m_Value.CopyFrom(objectValue, m_allocator);
 }
 
+std::string CJSONWriterObject::saveToString()
+{
+	rapidjson::StringBuffer buffer;
+	rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+	m_Value.Accept(writer);
+
+	return buffer.GetString();
+}
+
 
 
 CJSONWriterArray::CJSONWriterArray(CJSONWriter& writer)
@@ -72,6 +72,8 @@ namespace AMC {
 
 		bool isEmpty();
 
+		std::string saveToString();
+
 	};
 
 
@@ -38,6 +38,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <memory>
 #include <string>
+#include <atomic>
 
 #include "amc_parameter.hpp"
 #include "amc_statejournal.hpp"
@@ -62,7 +63,7 @@ namespace AMC {
 		// The global original path of the parameter..
 		std::string m_sOriginalPath;
 
-		uint64_t m_nChangeCounter;
+		std::atomic<uint64_t> m_nChangeCounter;
 		
 		// update value including persistency storage
 		void setValueEx(const std::string& sValue, uint64_t nAbsoluteTimeStamp);
@@ -48,16 +48,83 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AMC_MAXPARAMETERCOUNT (1024 * 1024)
 
 namespace AMC {
-	
+
+	static thread_local CParameterReadSet* s_pActiveParameterReadSet = nullptr;
+
+	CParameterReadSet::CParameterReadSet()
+		: m_bHasUntrackedReads (false)
+	{
+
+	}
+
+	CParameterReadSet::~CParameterReadSet()
+	{
+
+	}
+
+	void CParameterReadSet::addParameterRead(PParameter pParameter)
+	{
+		LibMCAssertNotNull(pParameter.get());
+
+		for (auto& readParameter : m_ReadParameters) {
+			if (readParameter.first.get() == pParameter.get())
+				return;
+		}
+
+		m_ReadParameters.push_back(std::make_pair(pParameter, pParameter->getChangeCounter()));
+	}
+
+	void CParameterReadSet::addUntrackedRead()
+	{
+		m_bHasUntrackedReads = true;
+	}
+
+	bool CParameterReadSet::isUnchanged()
+	{
+		if (m_bHasUntrackedReads)
+			return false;
+
+		for (auto& readParameter : m_ReadParameters) {
+			if (readParameter.first->getChangeCounter() != readParameter.second)
+				return false;
+		}
+
+		return true;
+	}
+
+	CParameterReadRecording::CParameterReadRecording(CParameterReadSet* pReadSet)
+		: m_pPreviousReadSet (s_pActiveParameterReadSet)
+	{
+		LibMCAssertNotNull(pReadSet);
+		s_pActiveParameterReadSet = pReadSet;
+	}
+
+	CParameterReadRecording::~CParameterReadRecording()
+	{
+		s_pActiveParameterReadSet = m_pPreviousReadSet;
+	}
+
+	void CParameterReadRecording::recordParameterRead(PParameter pParameter)
+	{
+		if (s_pActiveParameterReadSet != nullptr)
+			s_pActiveParameterReadSet->addParameterRead(pParameter);
+	}
+
+	void CParameterReadRecording::recordUntrackedRead()
+	{
+		if (s_pActiveParameterReadSet != nullptr)
+			s_pActiveParameterReadSet->addUntrackedRead();
+	}
+
 
 	CParameterGroup::CParameterGroup(AMCCommon::PChrono pGlobalChrono)
-		: m_pStateJournal (nullptr), m_pGlobalChrono (pGlobalChrono)
+		: m_pStateJournal (nullptr), m_pGlobalChrono (pGlobalChrono), m_nLayoutVersion (0)
 	{
 
 	}
 
 	CParameterGroup::CParameterGroup(const std::string& sName, const std::string& sDescription, AMCCommon::PChrono pGlobalChrono)
-		: m_sName(sName), m_sDescription(sDescription), m_pStateJournal (nullptr), m_pGlobalChrono(pGlobalChrono)
+		: m_sName(sName), m_sDescription(sDescription), m_pStateJournal (nullptr), m_pGlobalChrono(pGlobalChrono), m_nLayoutVersion (0)
 	{
 	}
 
@@ -101,6 +168,7 @@ namespace AMC {
 
 		m_Parameters.insert(std::make_pair(sName, pParameter));
 		m_ParameterList.push_back(pParameter);
+		m_nLayoutVersion++;
 	}
 
 	uint32_t CParameterGroup::getParameterCount()
@@ -144,6 +212,7 @@ namespace AMC {
 			throw ELibMCCustomException(LIBMC_ERROR_INVALIDINDEX, m_sName);
 
 		auto pParameter = m_ParameterList[nIndex];
+		CParameterReadRecording::recordParameterRead(pParameter);
 		return pParameter->getStringValue();
 	}
 
@@ -155,6 +224,7 @@ namespace AMC {
 		if (iIter == m_Parameters.end())
 			throw ELibMCCustomException(LIBMC_ERROR_PARAMETERNOTFOUND, m_sName + "/" + sName);
 
+		CParameterReadRecording::recordParameterRead(iIter->second);
 		return iIter->second->getStringValue();
 	}
 
@@ -165,6 +235,7 @@ namespace AMC {
 			throw ELibMCCustomException(LIBMC_ERROR_INVALIDINDEX, m_sName);
 
 		auto pParameter = m_ParameterList[nIndex];
+		CParameterReadRecording::recordParameterRead(pParameter);
 		return pParameter->getDoubleValue();
 	}
 
@@ -176,6 +247,7 @@ namespace AMC {
 		if (iIter == m_Parameters.end())
 			throw ELibMCCustomException(LIBMC_ERROR_PARAMETERNOTFOUND, m_sName + "/" + sName);
 
+		CParameterReadRecording::recordParameterRead(iIter->second);
 		return iIter->second->getDoubleValue();
 	}
 
@@ -186,6 +258,7 @@ namespace AMC {
 			throw ELibMCCustomException(LIBMC_ERROR_INVALIDINDEX, m_sName);
 
 		auto pParameter = m_ParameterList[nIndex];
+		CParameterReadRecording::recordParameterRead(pParameter);
 		return pParameter->getIntValue();
 	}
 
@@ -197,6 +270,7 @@ namespace AMC {
 		if (iIter == m_Parameters.end())
 			throw ELibMCCustomException(LIBMC_ERROR_PARAMETERNOTFOUND, m_sName + "/" + sName);
 
+		CParameterReadRecording::recordParameterRead(iIter->second);
 		return iIter->second->getIntValue();
 	}
 
@@ -207,6 +281,7 @@ namespace AMC {
 			throw ELibMCCustomException(LIBMC_ERROR_INVALIDINDEX, m_sName);
 
 		auto pParameter = m_ParameterList[nIndex];
+		CParameterReadRecording::recordParameterRead(pParameter);
 		return pParameter->getBoolValue();
 	}
 
@@ -218,6 +293,7 @@ namespace AMC {
 		if (iIter == m_Parameters.end())
 			throw ELibMCCustomException(LIBMC_ERROR_PARAMETERNOTFOUND, m_sName + "/" + sName);
 
+		CParameterReadRecording::recordParameterRead(iIter->second);
 		return iIter->second->getBoolValue();
 	}
 
@@ -242,6 +318,70 @@ namespace AMC {
 
 
 
+	uint32_t CParameterGroup::getParameterIndexByName(const std::string& sName, uint64_t& nLayoutVersion)
+	{
+		std::lock_guard <std::mutex> lockGuard(m_GroupMutex);
+
+		for (size_t nIndex = 0; nIndex < m_ParameterList.size(); nIndex++) {
+			if (m_ParameterList[nIndex]->getName() == sName) {
+				nLayoutVersion = m_nLayoutVersion;
+				return (uint32_t)nIndex;
+			}
+		}
+
+		throw ELibMCCustomException(LIBMC_ERROR_PARAMETERNOTFOUND, m_sName + "/" + sName);
+	}
+
+	uint64_t CParameterGroup::getLayoutVersion()
+	{
+		std::lock_guard <std::mutex> lockGuard(m_GroupMutex);
+		return m_nLayoutVersion;
+	}
+
+	bool CParameterGroup::getBoundParameterValue(const uint32_t nIndex, const uint64_t nLayoutVersion, std::string& sValue)
+	{
+		std::lock_guard <std::mutex> lockGuard(m_GroupMutex);
+		if ((nLayoutVersion != m_nLayoutVersion) || (nIndex >= m_ParameterList.size()))
+			return false;
+
+		CParameterReadRecording::recordParameterRead(m_ParameterList[nIndex]);
+		sValue = m_ParameterList[nIndex]->getStringValue();
+		return true;
+	}
+
+	bool CParameterGroup::getBoundDoubleParameterValue(const uint32_t nIndex, const uint64_t nLayoutVersion, double& dValue)
+	{
+		std::lock_guard <std::mutex> lockGuard(m_GroupMutex);
+		if ((nLayoutVersion != m_nLayoutVersion) || (nIndex >= m_ParameterList.size()))
+			return false;
+
+		CParameterReadRecording::recordParameterRead(m_ParameterList[nIndex]);
+		dValue = m_ParameterList[nIndex]->getDoubleValue();
+		return true;
+	}
+
+	bool CParameterGroup::getBoundIntParameterValue(const uint32_t nIndex, const uint64_t nLayoutVersion, int64_t& nValue)
+	{
+		std::lock_guard <std::mutex> lockGuard(m_GroupMutex);
+		if ((nLayoutVersion != m_nLayoutVersion) || (nIndex >= m_ParameterList.size()))
+			return false;
+
+		CParameterReadRecording::recordParameterRead(m_ParameterList[nIndex]);
+		nValue = m_ParameterList[nIndex]->getIntValue();
+		return true;
+	}
+
+	bool CParameterGroup::getBoundBoolParameterValue(const uint32_t nIndex, const uint64_t nLayoutVersion, bool& bValue)
+	{
+		std::lock_guard <std::mutex> lockGuard(m_GroupMutex);
+		if ((nLayoutVersion != m_nLayoutVersion) || (nIndex >= m_ParameterList.size()))
+			return false;
+
+		CParameterReadRecording::recordParameterRead(m_ParameterList[nIndex]);
+		bValue = m_ParameterList[nIndex]->getBoolValue();
+		return true;
+	}
+
 	eParameterDataType CParameterGroup::getParameterDataTypeByIndex(const uint32_t nIndex)
 	{
 		std::lock_guard <std::mutex> lockGuard(m_GroupMutex);
@@ -615,6 +755,7 @@ namespace AMC {
 		}
 
 		m_Parameters.erase(sName);		
+		m_nLayoutVersion++;
 
 	}
 
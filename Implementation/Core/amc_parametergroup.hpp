@@ -62,6 +62,51 @@ namespace AMC {
 	class CStateJournal;
 	typedef std::shared_ptr<CStateJournal> PStateJournal;
 
+	// Parameters that have been read during a read recording, together with their change counters at the time of reading.
+	class CParameterReadSet {
+	private:
+
+		std::vector<std::pair<PParameter, uint64_t>> m_ReadParameters;
+
+		// Set if a value has been read that can not be tracked by change counters.
+		bool m_bHasUntrackedReads;
+
+	public:
+
+		CParameterReadSet();
+
+		virtual ~CParameterReadSet();
+
+		void addParameterRead(PParameter pParameter);
+
+		void addUntrackedRead();
+
+		// Returns true, if all reads are tracked and none of the read parameters has changed since.
+		bool isUnchanged();
+
+	};
+
+	typedef std::shared_ptr<CParameterReadSet> PParameterReadSet;
+
+	// Records all parameter values that the current thread reads from parameter groups, as long as it exists.
+	class CParameterReadRecording {
+	private:
+
+		CParameterReadSet* m_pPreviousReadSet;
+
+	public:
+
+		CParameterReadRecording(CParameterReadSet* pReadSet);
+
+		~CParameterReadRecording();
+
+		static void recordParameterRead(PParameter pParameter);
+
+		// Marks the active recording as not reproducible, i.e. when a value is read that is no parameter.
+		static void recordUntrackedRead();
+
+	};
+
 	class CParameterGroup {
 	private:
 		
@@ -77,6 +122,9 @@ namespace AMC {
 
 		std::mutex m_GroupMutex;
 
+		// Increases whenever parameters are added or removed, so that bound indices can be validated.
+		uint64_t m_nLayoutVersion;
+
 		void addParameterInternal(PParameter pParameter);
 
 	public:
@@ -124,6 +172,16 @@ namespace AMC {
 		std::string getUUIDParameterValueByIndex(const uint32_t nIndex);
 		std::string getUUIDParameterValueByName(const std::string& sName);
 
+		// Returns the index of a parameter and the layout version the index is valid for.
+		uint32_t getParameterIndexByName(const std::string& sName, uint64_t& nLayoutVersion);
+		uint64_t getLayoutVersion();
+
+		// Bound accessors for pre-resolved parameter indices. Return false, if the layout has changed in the meantime.
+		bool getBoundParameterValue(const uint32_t nIndex, const uint64_t nLayoutVersion, std::string& sValue);
+		bool getBoundDoubleParameterValue(const uint32_t nIndex, const uint64_t nLayoutVersion, double& dValue);
+		bool getBoundIntParameterValue(const uint32_t nIndex, const uint64_t nLayoutVersion, int64_t& nValue);
+		bool getBoundBoolParameterValue(const uint32_t nIndex, const uint64_t nLayoutVersion, bool& bValue);
+
 		eParameterDataType getParameterDataTypeByIndex(const uint32_t nIndex);
 		eParameterDataType getParameterDataTypeByName(const std::string& sName);
 
@@ -44,7 +44,13 @@ Abstract: This is a stub class definition of CWorkingFileProcess
 using namespace AMC;
 
 CProcessDirectoryWriter::CProcessDirectoryWriter(const std::string& sLocalFileName, const std::string& sAbsoluteFileName, uint32_t nMemoryBufferSizeInKB)
-    : m_sLocalFileName(sLocalFileName), m_sAbsoluteFileName(sAbsoluteFileName), m_nPositionInBuffer(0), m_nBytesWritten(0)
+    : CProcessDirectoryWriter(sLocalFileName, sAbsoluteFileName, nMemoryBufferSizeInKB, nullptr, false)
+{
+}
+
+CProcessDirectoryWriter::CProcessDirectoryWriter(const std::string& sLocalFileName, const std::string& sAbsoluteFileName, uint32_t nMemoryBufferSizeInKB, PAsyncFileWriteQueue pWriteQueue, bool bSyncOnFinish)
+    : m_Mode(eProcessDirectoryWriterMode::Synchronous), m_bSyncOnFinish(bSyncOnFinish), m_nActiveBuffer(0), m_nBytesWritten(0), m_nPositionInBuffer(0), m_nFileOffset(0),
+    m_pWriteQueue(pWriteQueue), m_sLocalFileName(sLocalFileName), m_sAbsoluteFileName(sAbsoluteFileName)
 {
     if ((nMemoryBufferSizeInKB < WORKINGFILEBUFFER_MINIMUMSIZEINKB) ||
         (nMemoryBufferSizeInKB > WORKINGFILEBUFFER_MAXIMUMSIZEINKB)) {
@@ -52,15 +58,30 @@ CProcessDirectoryWriter::CProcessDirectoryWriter(const std::string& sLocalFileNa
         throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDWRITEBUFFERSIZE, std::to_string(nMemoryBufferSizeInKB));
     }
 
-    m_MemoryBuffer.resize(nMemoryBufferSizeInKB * 1024);
+    for (uint32_t nBufferIndex = 0; nBufferIndex < AMC_PROCESSDIRECTORYWRITER_BUFFERCOUNT; nBufferIndex++)
+        m_BufferIsPending[nBufferIndex] = false;
+
+    // The second buffer is only needed if the I/O thread writes while the caller fills the first one.
+    uint64_t nBufferSize = (uint64_t)nMemoryBufferSizeInKB * 1024;
+    m_MemoryBuffers[0].resize(nBufferSize);
+    if (pWriteQueue.get() != nullptr) {
+        m_Mode = eProcessDirectoryWriterMode::Asynchronous;
+        m_MemoryBuffers[1].resize(nBufferSize);
+    }
 
-    m_pExportStream = std::make_shared <AMCCommon::CExportStream_Native>(sAbsoluteFileName);
+    m_pFileWriter = std::make_shared <AMCCommon::CNativeFileWriter>(sAbsoluteFileName);
 
 }
 
 CProcessDirectoryWriter::~CProcessDirectoryWriter()
 {
-    finish();
+    try {
+        finish();
+    }
+    catch (...) {
+        // Pending jobs of the I/O thread reference the buffers of this writer.
+        waitForAllBuffers();
+    }
 }
 
 std::string CProcessDirectoryWriter::getAbsoluteFileName()
@@ -73,16 +94,25 @@ std::string CProcessDirectoryWriter::getLocalFileName()
     return m_sLocalFileName;
 }
 
-void CProcessDirectoryWriter::writeData(const uint8_t* pData, uint64_t nSize)
+eProcessDirectoryWriterMode CProcessDirectoryWriter::getMode()
 {
-    uint64_t nBufferSize = m_MemoryBuffer.size();
+    return m_Mode;
+}
 
+void CProcessDirectoryWriter::writeData(const uint8_t* pData, uint64_t nSize)
+{
     if (nSize == 0)
         return;
 
     if (pData == nullptr)
         throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 
+    if (m_pFileWriter.get() == nullptr)
+        throw ELibMCInterfaceException(LIBMC_ERROR_CANNOTWRITETOFINISHEDFILE);
+
+    checkForAsyncError();
+
+    uint64_t nBufferSize = m_MemoryBuffers[0].size();
     const uint8_t* pSource = pData;
 
     uint64_t nBytesLeft = nSize;
@@ -90,6 +120,16 @@ void CProcessDirectoryWriter::writeData(const uint8_t* pData, uint64_t nSize)
         if (m_nPositionInBuffer >= nBufferSize)
             throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDWRITEBUFFFERPOSITION, std::to_string(m_nPositionInBuffer));
 
+        // In synchronous mode, whole buffers are written directly from the caller's memory.
+        if ((m_Mode == eProcessDirectoryWriterMode::Synchronous) && (m_nPositionInBuffer == 0) && (nBytesLeft >= nBufferSize)) {
+            uint64_t nBytesToWrite = nBytesLeft - (nBytesLeft % nBufferSize);
+            m_pFileWriter->writeAt(m_nFileOffset, pSource, nBytesToWrite);
+            m_nFileOffset += nBytesToWrite;
+            pSource += nBytesToWrite;
+            nBytesLeft -= nBytesToWrite;
+            continue;
+        }
+
         uint64_t nBytesAvailable = nBufferSize - m_nPositionInBuffer;
         uint64_t nBytesToCopy;
 
@@ -98,41 +138,126 @@ void CProcessDirectoryWriter::writeData(const uint8_t* pData, uint64_t nSize)
         else
             nBytesToCopy = nBytesLeft;
 
-        memcpy((void*)&m_MemoryBuffer.at(m_nPositionInBuffer), (void*)pSource, nBytesToCopy);
+        memcpy((void*)&m_MemoryBuffers[m_nActiveBuffer].at(m_nPositionInBuffer), (void*)pSource, nBytesToCopy);
         pSource += nBytesToCopy;
         m_nPositionInBuffer += nBytesToCopy;
 
         if (m_nPositionInBuffer >= nBufferSize)
-            flushBuffer();
+            submitActiveBuffer();
 
         nBytesLeft -= nBytesToCopy;
     }
+
+    m_nBytesWritten += nSize;
+}
+
+void CProcessDirectoryWriter::submitActiveBuffer()
+{
+    if (m_nPositionInBuffer == 0)
+        return;
+
+    if (m_pFileWriter.get() == nullptr)
+        throw ELibMCInterfaceException(LIBMC_ERROR_CANNOTWRITETOFINISHEDFILE);
+
+    uint64_t nOffset = m_nFileOffset;
+    uint64_t nSize = m_nPositionInBuffer;
+
+    if (m_Mode == eProcessDirectoryWriterMode::Synchronous) {
+        m_pFileWriter->writeAt(nOffset, m_MemoryBuffers[0].data(), nSize);
+        m_nFileOffset += nSize;
+        m_nPositionInBuffer = 0;
+        return;
+    }
+
+    uint32_t nBufferIndex = m_nActiveBuffer;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_PendingMutex);
+        m_BufferIsPending[nBufferIndex] = true;
+    }
+
+    AMCCommon::CNativeFileWriter* pFileWriter = m_pFileWriter.get();
+    const uint8_t* pBufferData = m_MemoryBuffers[nBufferIndex].data();
+
+    try {
+        m_pWriteQueue->queueJob([this, pFileWriter, pBufferData, nBufferIndex, nOffset, nSize]() {
+            std::string sErrorMessage;
+            try {
+                pFileWriter->writeAt(nOffset, pBufferData, nSize);
+            }
+            catch (std::exception& E) {
+                sErrorMessage = E.what();
+            }
+
+            std::lock_guard<std::mutex> lockGuard(m_PendingMutex);
+            if (!sErrorMessage.empty() && m_sAsyncErrorMessage.empty())
+                m_sAsyncErrorMessage = sErrorMessage;
+            m_BufferIsPending[nBufferIndex] = false;
+            m_PendingCondition.notify_all();
+        });
+    }
+    catch (...) {
+        std::lock_guard<std::mutex> lockGuard(m_PendingMutex);
+        m_BufferIsPending[nBufferIndex] = false;
+        throw;
+    }
+
+    m_nFileOffset += nSize;
+    m_nPositionInBuffer = 0;
+    m_nActiveBuffer = (nBufferIndex + 1) % AMC_PROCESSDIRECTORYWRITER_BUFFERCOUNT;
+
+    // Blocks only if the I/O thread has not yet written the next buffer.
+    waitForBuffer(m_nActiveBuffer);
+}
+
+void CProcessDirectoryWriter::waitForBuffer(uint32_t nBufferIndex)
+{
+    std::unique_lock<std::mutex> lock(m_PendingMutex);
+    m_PendingCondition.wait(lock, [this, nBufferIndex] { return !m_BufferIsPending[nBufferIndex]; });
+}
+
+void CProcessDirectoryWriter::waitForAllBuffers()
+{
+    for (uint32_t nBufferIndex = 0; nBufferIndex < AMC_PROCESSDIRECTORYWRITER_BUFFERCOUNT; nBufferIndex++)
+        waitForBuffer(nBufferIndex);
+}
+
+void CProcessDirectoryWriter::checkForAsyncError()
+{
+    std::lock_guard<std::mutex> lockGuard(m_PendingMutex);
+    if (!m_sAsyncErrorMessage.empty())
+        throw ELibMCInterfaceException(LIBMC_ERROR_ASYNCFILEWRITEFAILED, m_sAsyncErrorMessage);
 }
 
 void CProcessDirectoryWriter::flushBuffer()
 {
     if (m_nPositionInBuffer > 0) {
-        if (m_pExportStream.get() == nullptr)
+        if (m_pFileWriter.get() == nullptr)
             throw ELibMCInterfaceException(LIBMC_ERROR_CANNOTWRITETOFINISHEDFILE);
 
-        m_pExportStream->writeBuffer(m_MemoryBuffer.data(), m_nPositionInBuffer);
+        submitActiveBuffer();
     }
 
-    m_nPositionInBuffer = 0;
+    waitForAllBuffers();
+    checkForAsyncError();
 }
 
 void CProcessDirectoryWriter::finish()
 {
+    if (m_pFileWriter.get() == nullptr)
+        return;
+
     flushBuffer();
 
-    if (m_pExportStream.get() != nullptr) {
-        m_pExportStream = nullptr;
-    }
+    if (m_bSyncOnFinish)
+        m_pFileWriter->syncToDisk();
+
+    m_pFileWriter->close();
+    m_pFileWriter = nullptr;
 }
 
 bool CProcessDirectoryWriter::isFinished()
 {
-    return (m_pExportStream.get() == nullptr);
+    return (m_pFileWriter.get() == nullptr);
 }
 
 
@@ -241,6 +366,36 @@ PProcessDirectoryWriter CProcessDirectory::addNewFileWriter(const std::string& s
     return pInstance;
 }
 
+PProcessDirectoryWriter CProcessDirectory::addNewAsyncFileWriter(const std::string& sFileName, uint32_t nMemoryBufferSize, bool bSyncOnFinish)
+{
+    if (!m_bIsActive)
+        throw ELibMCInterfaceException(LIBMC_ERROR_WORKINGDIRECTORYHASBEENCLEANED, m_sWorkingDirectory);
+
+    std::string sAbsoluteFileName = getAbsoluteFileName(sFileName);
+
+    auto pInstance = std::make_shared <CProcessDirectoryWriter>(sFileName, sAbsoluteFileName, nMemoryBufferSize, m_pOwner->getWriteQueue(), bSyncOnFinish);
+    m_WriterInstances.insert(std::make_pair(sFileName, pInstance));
+
+    addNewMonitoredFile(sFileName);
+
+    return pInstance;
+}
+
+void CProcessDirectory::writeFileFromMemory(const std::string& sFileName, const uint8_t* pData, uint64_t nSize, bool bSyncToDisk)
+{
+    if ((pData == nullptr) && (nSize > 0))
+        throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+    std::string sAbsoluteFileName = getAbsoluteFileName(sFileName);
+    addNewMonitoredFile(sFileName);
+
+    AMCCommon::CNativeFileWriter fileWriter(sAbsoluteFileName);
+    fileWriter.writeAt(0, pData, nSize);
+    if (bSyncToDisk)
+        fileWriter.syncToDisk();
+    fileWriter.close();
+}
+
 
 bool CProcessDirectory::fileIsMonitored(const std::string& sFileName)
 {
@@ -347,3 +502,12 @@ AMC::PLogger CProcessDirectoryStructure::getLogger()
     return m_pLogger;
 }
 
+PAsyncFileWriteQueue CProcessDirectoryStructure::getWriteQueue()
+{
+    std::lock_guard<std::mutex> lockGuard(m_WriteQueueMutex);
+    if (m_pWriteQueue.get() == nullptr)
+        m_pWriteQueue = std::make_shared<CAsyncFileWriteQueue>();
+
+    return m_pWriteQueue;
+}
+
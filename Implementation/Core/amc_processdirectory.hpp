@@ -37,43 +37,83 @@ Abstract: This is the class declaration of CProcessController
 
 
 #include "Common/common_chrono.hpp"
-#include "Common/common_exportstream_native.hpp"
+#include "Common/common_nativefilewriter.hpp"
 
 #include "amc_logger.hpp"
+#include "amc_asyncfilewritequeue.hpp"
 
 #include <map>
+#include <set>
 #include <vector>
 #include <thread>
 #include <atomic>
 #include <list>
+#include <mutex>
+#include <condition_variable>
+
+#define AMC_PROCESSDIRECTORYWRITER_BUFFERCOUNT 2
 
 
 namespace AMC {
 
+    enum class eProcessDirectoryWriterMode : uint32_t {
+        Synchronous = 0,
+        Asynchronous = 1
+    };
+
+    // Buffered writer for a single file of a process directory.
+    // In synchronous mode, full buffers are written on the calling thread. In asynchronous mode, the writer
+    // owns two buffers: one is filled by the caller while the other one is written by the shared I/O thread.
+    // The caller only blocks if both buffers are full. Errors of the I/O thread are reported by the next call.
     class CProcessDirectoryWriter {
     private:
 
-        std::vector <uint8_t> m_MemoryBuffer;
+        eProcessDirectoryWriterMode m_Mode;
+        bool m_bSyncOnFinish;
+
+        std::vector <uint8_t> m_MemoryBuffers[AMC_PROCESSDIRECTORYWRITER_BUFFERCOUNT];
+        uint32_t m_nActiveBuffer;
 
         uint64_t m_nBytesWritten;
         uint64_t m_nPositionInBuffer;
+        uint64_t m_nFileOffset;
 
-        AMCCommon::PExportStream_Native m_pExportStream;
+        AMCCommon::PNativeFileWriter m_pFileWriter;
+        PAsyncFileWriteQueue m_pWriteQueue;
         std::string m_sLocalFileName;
         std::string m_sAbsoluteFileName;
 
+        std::mutex m_PendingMutex;
+        std::condition_variable m_PendingCondition;
+        bool m_BufferIsPending[AMC_PROCESSDIRECTORYWRITER_BUFFERCOUNT];
+        std::string m_sAsyncErrorMessage;
+
+        // Hands the active buffer to the file and switches to the next buffer.
+        void submitActiveBuffer();
+
+        void waitForBuffer(uint32_t nBufferIndex);
+
+        void waitForAllBuffers();
+
+        void checkForAsyncError();
+
     public:
 
         CProcessDirectoryWriter(const std::string& sLocalFileName, const std::string& sAbsoluteFileName, uint32_t nMemoryBufferSize);
 
+        CProcessDirectoryWriter(const std::string& sLocalFileName, const std::string& sAbsoluteFileName, uint32_t nMemoryBufferSize, PAsyncFileWriteQueue pWriteQueue, bool bSyncOnFinish);
+
         virtual ~CProcessDirectoryWriter();
 
         std::string getAbsoluteFileName();
 
         std::string getLocalFileName();
 
+        eProcessDirectoryWriterMode getMode();
+
         void writeData(const uint8_t* pData, uint64_t nSize);
 
+        // Returns when all data written so far has been handed to the operating system.
         void flushBuffer();
 
         void finish();
@@ -118,6 +158,11 @@ namespace AMC {
 
             PProcessDirectoryWriter addNewFileWriter(const std::string& sFileName, uint32_t nMemoryBufferSize);
 
+            PProcessDirectoryWriter addNewAsyncFileWriter(const std::string& sFileName, uint32_t nMemoryBufferSize, bool bSyncOnFinish);
+
+            // Writes a complete file in one call, directly from the given memory.
+            void writeFileFromMemory(const std::string& sFileName, const uint8_t* pData, uint64_t nSize, bool bSyncToDisk);
+
             bool fileIsMonitored(const std::string& sFileName);
 
             void cleanUpDirectory(AMC::CLogger* pLoggerForUnmanagedFileWarnings);
@@ -144,6 +189,9 @@ namespace AMC {
 
             PProcessDirectory m_pRootDirectory;
 
+            std::mutex m_WriteQueueMutex;
+            PAsyncFileWriteQueue m_pWriteQueue;
+
         public:
 
             CProcessDirectoryStructure(const std::string& sBaseDirectory, AMCCommon::PChrono pGlobalChrono, AMC::PLogger pLogger);
@@ -155,6 +203,9 @@ namespace AMC {
             AMCCommon::PChrono getGlobalChrono ();
 
             AMC::PLogger getLogger ();
+
+            // Returns the I/O thread of all asynchronous writers of the structure. The thread is started on first use.
+            PAsyncFileWriteQueue getWriteQueue ();
     };
 
     typedef std::shared_ptr<CProcessDirectoryStructure> PProcessDirectoryStructure;
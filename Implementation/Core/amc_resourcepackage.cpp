@@ -35,6 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Libraries/libzip/zip.h"
 #include "Libraries/PugiXML/pugixml.hpp"
 #include "libmc_exceptiontypes.hpp"
+#include "common_importstream_native.hpp"
 #include <map>
 
 #define ROOT_ZIP_READCHUNKSIZE 65536
@@ -320,17 +321,56 @@ namespace AMC {
 	}
 
 
+	PResourcePackage CResourcePackage::makeFromFile(const std::string& sFileName, const std::string& sPackageDebugName, const std::string& sSchemaNamespace)
+	{
+		return std::make_shared<CResourcePackage>(sFileName, sPackageDebugName, sSchemaNamespace);
+	}
+
+	CResourcePackage::CResourcePackage(const std::string& sFileName, const std::string& sPackageDebugName, const std::string& sSchemaNamespace)
+		: m_sPackageDebugName (sPackageDebugName), m_sFileName (sFileName), m_sSchemaNamespace (sSchemaNamespace)
+	{
+		if (sFileName.empty ())
+			throw ELibMCCustomException(LIBMC_ERROR_COULDNOTREADZIPFILE, m_sPackageDebugName);
+
+		if (!AMCCommon::CUtils::fileOrPathExistsOnDisk(sFileName))
+			throw ELibMCCustomException(LIBMC_ERROR_COULDNOTREADZIPFILE, sFileName);
+	}
+
 	CResourcePackage::CResourcePackage(AMCCommon::CImportStream* pStream, const std::string& sPackageDebugName, const std::string& sSchemaNamespace)
-		: m_sPackageDebugName (sPackageDebugName)
+		: m_sPackageDebugName (sPackageDebugName), m_sSchemaNamespace (sSchemaNamespace)
+	{
+		LibMCAssertNotNull(pStream);
+
+		std::call_once(m_LoadFlag, [this, pStream]() { loadPackage(pStream); });
+	}
+
+	void CResourcePackage::ensureIsLoaded()
+	{
+		// A failed load throws and leaves the flag unset, so that the next access retries.
+		std::call_once(m_LoadFlag, [this]() {
+			if (!m_sFileName.empty()) {
+				AMCCommon::CImportStream_Native stream(m_sFileName);
+				loadPackage(&stream);
+			}
+		});
+	}
+
+	void CResourcePackage::loadPackage(AMCCommon::CImportStream* pStream)
 	{
 		LibMCAssertNotNull(pStream);
 
+		// Discard the state of a previously failed attempt
+		m_Entries.clear();
+		m_NameMap.clear();
+		m_UUIDMap.clear();
+		m_pResourcePackageZIP = nullptr;
+
 		pStream->readIntoMemory(m_ZIPBuffer);
 
 		if (m_ZIPBuffer.size () == 0)
 			throw ELibMCCustomException(LIBMC_ERROR_COULDNOTPARSERESOURCEINDEX, m_sPackageDebugName);
 
-		m_pResourcePackageZIP = std::make_shared<CResourcePackageZIP>(m_ZIPBuffer.size(), m_ZIPBuffer.data(), sPackageDebugName);
+		m_pResourcePackageZIP = std::make_shared<CResourcePackageZIP>(m_ZIPBuffer.size(), m_ZIPBuffer.data(), m_sPackageDebugName);
 
 		if (!m_pResourcePackageZIP->hasFile(ROOT_PACKAGEFILENAME))
 			throw ELibMCCustomException(LIBMC_ERROR_COULDNOTFINDRESOURCEINDEX, m_sPackageDebugName);
@@ -355,7 +395,7 @@ namespace AMC {
 			throw ELibMCCustomException(LIBMC_ERROR_MISSINGXMLSCHEMA, m_sPackageDebugName);
 
 		std::string xmlns(xmlnsAttrib.as_string());
-		if (xmlns != sSchemaNamespace)
+		if (xmlns != m_sSchemaNamespace)
 			throw ELibMCCustomException(LIBMC_ERROR_INVALIDXMLSCHEMA, m_sPackageDebugName);
 
 		auto entryNodes = rootNode.children("entry");
@@ -403,12 +443,16 @@ namespace AMC {
 
 	uint64_t CResourcePackage::getEntryCount()
 	{
+		ensureIsLoaded();
+
 		return m_Entries.size();
 	}
 
 
 	PResourcePackageEntry CResourcePackage::getEntry(uint64_t nIndex)
 	{
+		ensureIsLoaded();
+
 		if (nIndex >= m_Entries.size())
 			throw ELibMCCustomException(LIBMC_ERROR_INVALIDINDEX, m_sPackageDebugName);
 
@@ -417,6 +461,8 @@ namespace AMC {
 
 	PResourcePackageEntry CResourcePackage::findEntryByUUID(const std::string& sUUID, const bool bHasToExist)
 	{
+		ensureIsLoaded();
+
 		auto iIter = m_UUIDMap.find(AMCCommon::CUtils::normalizeUUIDString (sUUID));
 		if (iIter == m_UUIDMap.end()) {
 			if (bHasToExist)
@@ -431,6 +477,8 @@ namespace AMC {
 
 	PResourcePackageEntry CResourcePackage::findEntryByName(const std::string& sName, const bool bHasToExist)
 	{
+		ensureIsLoaded();
+
 		auto iIter = m_NameMap.find(AMCCommon::CUtils::toLowerString (sName));
 		if (iIter == m_NameMap.end()) {
 			if (bHasToExist)
@@ -448,6 +496,8 @@ namespace AMC {
 
 	void CResourcePackage::readEntry(const std::string& sName, std::vector<uint8_t>& Buffer)
 	{
+		ensureIsLoaded();
+
 		std::lock_guard<std::mutex> lockGuard(m_Mutex);
 
 		auto iIter = m_NameMap.find(AMCCommon::CUtils::toLowerString (sName));
@@ -462,6 +512,8 @@ namespace AMC {
 	std::string CResourcePackage::readEntryUTF8String(const std::string& sName)
 	{
 
+		ensureIsLoaded();
+
 		std::lock_guard<std::mutex> lockGuard(m_Mutex);
 
 		auto iIter = m_NameMap.find(AMCCommon::CUtils::toLowerString (sName));
@@ -485,6 +537,8 @@ namespace AMC {
 
 	void CResourcePackage::readEntryEx(const std::string& sName, uint8_t* pBuffer, const uint64_t nBufferSize)
 	{
+		ensureIsLoaded();
+
 		std::lock_guard<std::mutex> lockGuard(m_Mutex);
 
 		auto iIter = m_NameMap.find(AMCCommon::CUtils::toLowerString (sName));
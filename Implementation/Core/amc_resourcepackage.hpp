@@ -80,6 +80,15 @@ namespace AMC {
 
 		PResourcePackageZIP m_pResourcePackageZIP;
 		std::string m_sPackageDebugName;
+
+		// Packages that are made from a file are read and indexed on first access.
+		std::string m_sFileName;
+		std::string m_sSchemaNamespace;
+		std::once_flag m_LoadFlag;
+
+		void loadPackage(AMCCommon::CImportStream* pStream);
+
+		void ensureIsLoaded();
 		
 	protected:
 
@@ -89,8 +98,13 @@ namespace AMC {
 		static PResourcePackage makeFromStream (AMCCommon::PImportStream pStream, const std::string& sPackageDebugName, const std::string& sSchemaNamespace);
 		static PResourcePackage makeEmpty (const std::string& sPackageDebugName);
 
+		// Only checks that the file exists. Reading and indexing the package is deferred until an entry is accessed.
+		static PResourcePackage makeFromFile (const std::string& sFileName, const std::string& sPackageDebugName, const std::string& sSchemaNamespace);
+
 		CResourcePackage(AMCCommon::CImportStream* pStream, const std::string& sPackageDebugName, const std::string & sSchemaNamespace);
 		CResourcePackage(const std::string& sPackageDebugName);
+
+		CResourcePackage(const std::string& sFileName, const std::string& sPackageDebugName, const std::string& sSchemaNamespace);
 		virtual ~CResourcePackage();
 
 
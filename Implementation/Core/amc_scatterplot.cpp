@@ -33,6 +33,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "libmc_exceptiontypes.hpp"
 #include "common_utils.hpp"
 
+#include <algorithm>
+
 namespace AMC {
 
 	CScatterplot::CScatterplot(const std::string& sUUID)
@@ -54,6 +56,8 @@ namespace AMC {
 	void CScatterplot::clearData()
 	{
 		m_PointEntries.clear();
+		m_ChannelColumns.clear();
+		m_ChannelValues.clear();
 	}
 
 	bool CScatterplot::isEmpty()
@@ -71,9 +75,102 @@ namespace AMC {
 		return m_PointEntries;
 	}
 
-	ChannelEntries& CScatterplot::getChannelEntries()
+	uint32_t CScatterplot::internName(const std::string& sName)
+	{
+		auto iIter = m_InternedNameMap.find(sName);
+		if (iIter != m_InternedNameMap.end())
+			return iIter->second;
+
+		uint32_t nNameID = (uint32_t)m_InternedNames.size();
+		m_InternedNames.push_back(sName);
+		m_InternedNameMap.insert(std::make_pair(sName, nNameID));
+
+		return nNameID;
+	}
+
+	void CScatterplot::reserveChannelValues(uint64_t nTotalValueCount)
+	{
+		m_ChannelValues.reserve((size_t)nTotalValueCount);
+	}
+
+	double* CScatterplot::addChannelColumn(const std::string& sChannel, const std::string& sColumn, uint64_t nValueCount)
+	{
+		uint32_t nChannelID = internName(sChannel);
+		uint32_t nColumnID = internName(sColumn);
+
+		for (auto& channelColumn : m_ChannelColumns) {
+			if ((channelColumn.m_nChannelID == nChannelID) && (channelColumn.m_nColumnID == nColumnID))
+				throw ELibMCCustomException(LIBMC_ERROR_DUPLICATESCATTERPLOTCHANNELCOLUMN, "The channel = " + sChannel + " with the column = " + sColumn + " already exists");
+		}
+
+		sScatterplotChannelColumn channelColumn;
+		channelColumn.m_nChannelID = nChannelID;
+		channelColumn.m_nColumnID = nColumnID;
+		channelColumn.m_nValueOffset = m_ChannelValues.size();
+		channelColumn.m_nValueCount = nValueCount;
+		m_ChannelColumns.push_back(channelColumn);
+
+		m_ChannelValues.resize((size_t)(channelColumn.m_nValueOffset + nValueCount));
+
+		return m_ChannelValues.data() + channelColumn.m_nValueOffset;
+	}
+
+	bool CScatterplot::findChannel(const std::string& sChannel, uint32_t& nChannelID)
+	{
+		nChannelID = 0;
+
+		auto iIter = m_InternedNameMap.find(sChannel);
+		if (iIter == m_InternedNameMap.end())
+			return false;
+
+		for (auto& channelColumn : m_ChannelColumns) {
+			if (channelColumn.m_nChannelID == iIter->second) {
+				nChannelID = iIter->second;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void CScatterplot::getChannelColumns(uint32_t nChannelID, std::vector<sScatterplotChannelColumn>& channelColumns)
+	{
+		channelColumns.clear();
+		for (auto& channelColumn : m_ChannelColumns) {
+			if (channelColumn.m_nChannelID == nChannelID)
+				channelColumns.push_back(channelColumn);
+		}
+
+		std::sort(channelColumns.begin(), channelColumns.end(), [this](const sScatterplotChannelColumn& column1, const sScatterplotChannelColumn& column2) {
+			return m_InternedNames.at(column1.m_nColumnID) < m_InternedNames.at(column2.m_nColumnID);
+		});
+	}
+
+	uint64_t CScatterplot::getChannelPointCount(uint32_t nChannelID)
 	{
-		return m_ChannelEntries;
+		uint64_t nPointCount = 0;
+		for (auto& channelColumn : m_ChannelColumns) {
+			if ((channelColumn.m_nChannelID == nChannelID) && (channelColumn.m_nValueCount > nPointCount))
+				nPointCount = channelColumn.m_nValueCount;
+		}
+
+		return nPointCount;
+	}
+
+	const double* CScatterplot::getColumnValues(const sScatterplotChannelColumn& channelColumn)
+	{
+		if ((channelColumn.m_nValueOffset + channelColumn.m_nValueCount) > m_ChannelValues.size())
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDINDEX);
+
+		return m_ChannelValues.data() + channelColumn.m_nValueOffset;
+	}
+
+	std::string CScatterplot::getInternedName(uint32_t nNameID)
+	{
+		if (nNameID >= m_InternedNames.size())
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDINDEX);
+
+		return m_InternedNames.at(nNameID);
 	}
 
 	void CScatterplot::getBoundaries(double& dMinX, double& dMinY, double& dMaxX, double& dMaxY)
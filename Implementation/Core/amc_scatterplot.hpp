@@ -46,12 +46,18 @@ namespace AMC {
 	} sScatterplotEntry;
 
 
+	// A column of a scatterplot channel. The values are stored in the scatterplot's flat value array.
+	typedef struct _sScatterplotChannelColumn {
+		uint32_t m_nChannelID;
+		uint32_t m_nColumnID;
+		uint64_t m_nValueOffset;
+		uint64_t m_nValueCount;
+	} sScatterplotChannelColumn;
+
+
 	class CScatterplot;
 	typedef std::shared_ptr<CScatterplot> PScatterplot;
 
-	typedef std::map<std::string, std::vector<double>> ColumnEntries;
-	typedef std::map<std::string, ColumnEntries> ChannelEntries;
-
 	class CScatterplot {
 	private:
 
@@ -59,13 +65,20 @@ namespace AMC {
 		
 		std::vector<sScatterplotEntry> m_PointEntries;
 
-		ChannelEntries m_ChannelEntries;
+		// Channel and column names are interned, columns refer to them by index.
+		std::vector<std::string> m_InternedNames;
+		std::map<std::string, uint32_t> m_InternedNameMap;
+
+		std::vector<sScatterplotChannelColumn> m_ChannelColumns;
+		std::vector<double> m_ChannelValues;
 
 		double m_dMinX;
 		double m_dMinY;
 		double m_dMaxX;
 		double m_dMaxY;
 
+		uint32_t internName(const std::string& sName);
+
 	public:
 
 		CScatterplot(const std::string & sUUID);
@@ -82,7 +95,25 @@ namespace AMC {
 
 		std::vector<sScatterplotEntry> & getEntries ();
 
-		ChannelEntries& getChannelEntries ();
+		// Reserves space for the values of all columns that are added afterwards.
+		void reserveChannelValues(uint64_t nTotalValueCount);
+
+		// Adds a channel column with nValueCount values and returns a pointer to its values.
+		// The pointer is only valid until the next column is added, unless the values have been reserved.
+		double* addChannelColumn(const std::string& sChannel, const std::string& sColumn, uint64_t nValueCount);
+
+		// Returns false if the scatterplot does not have a channel with the given name.
+		bool findChannel(const std::string& sChannel, uint32_t& nChannelID);
+
+		// Returns the columns of a channel, sorted by column name.
+		void getChannelColumns(uint32_t nChannelID, std::vector<sScatterplotChannelColumn>& channelColumns);
+
+		// Returns the largest value count of the columns of a channel.
+		uint64_t getChannelPointCount(uint32_t nChannelID);
+
+		const double* getColumnValues(const sScatterplotChannelColumn& channelColumn);
+
+		std::string getInternedName(uint32_t nNameID);
 
 		void getBoundaries(double& dMinX, double& dMinY, double& dMaxX, double& dMaxY);
 
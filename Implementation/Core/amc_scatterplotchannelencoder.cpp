@@ -0,0 +1,229 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "amc_scatterplotchannelencoder.hpp"
+#include "amc_jsonwriter.hpp"
+#include "libmc_exceptiontypes.hpp"
+
+#include "lz4/lz4.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace AMC {
+
+	eScatterplotChannelEncoding CScatterplotChannelEncoder::stringToEncoding(const std::string& sEncoding)
+	{
+		if (sEncoding == AMC_SCATTERPLOTCHANNEL_ENCODING_FLOAT32)
+			return eScatterplotChannelEncoding::ceFloat32;
+		if (sEncoding == AMC_SCATTERPLOTCHANNEL_ENCODING_INT16)
+			return eScatterplotChannelEncoding::ceInt16;
+
+		throw ELibMCCustomException(LIBMC_ERROR_INVALIDPOINTCHANNELENCODING, sEncoding);
+	}
+
+	bool CScatterplotChannelEncoder::stringToCompression(const std::string& sCompression)
+	{
+		if (sCompression.empty() || (sCompression == AMC_SCATTERPLOTCHANNEL_COMPRESSION_NONE))
+			return false;
+		if (sCompression == AMC_SCATTERPLOTCHANNEL_COMPRESSION_LZ4)
+			return true;
+
+		throw ELibMCCustomException(LIBMC_ERROR_INVALIDPOINTCHANNELCOMPRESSION, sCompression);
+	}
+
+	void CScatterplotChannelEncoder::encodeColumnChunk(const double* pValues, size_t nValueCount, eScatterplotChannelEncoding encoding, double dScale, double dOffset, std::vector<uint8_t>& chunkBuffer)
+	{
+		switch (encoding) {
+			case eScatterplotChannelEncoding::ceFloat32: {
+				chunkBuffer.resize(nValueCount * sizeof(float));
+				float* pTarget = (float*)chunkBuffer.data();
+				for (size_t nIndex = 0; nIndex < nValueCount; nIndex++)
+					pTarget[nIndex] = (float)pValues[nIndex];
+				break;
+			}
+
+			case eScatterplotChannelEncoding::ceInt16: {
+				chunkBuffer.resize(nValueCount * sizeof(int16_t));
+				int16_t* pTarget = (int16_t*)chunkBuffer.data();
+				double dInverseScale = 1.0 / dScale;
+				for (size_t nIndex = 0; nIndex < nValueCount; nIndex++) {
+					double dValue = pValues[nIndex];
+					if (std::isfinite(dValue)) {
+						double dQuantized = std::round((dValue - dOffset) * dInverseScale);
+						if (dQuantized > AMC_SCATTERPLOTCHANNEL_INT16MAX)
+							dQuantized = AMC_SCATTERPLOTCHANNEL_INT16MAX;
+						if (dQuantized < -AMC_SCATTERPLOTCHANNEL_INT16MAX)
+							dQuantized = -AMC_SCATTERPLOTCHANNEL_INT16MAX;
+						pTarget[nIndex] = (int16_t)dQuantized;
+					}
+					else {
+						pTarget[nIndex] = AMC_SCATTERPLOTCHANNEL_INT16INVALID;
+					}
+				}
+				break;
+			}
+
+			default:
+				throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPOINTCHANNELENCODING);
+		}
+	}
+
+	void CScatterplotChannelEncoder::encodeChannel(CScatterplot* pScatterplot, const std::string& sChannel, eScatterplotChannelEncoding encoding, bool bCompressChunks, uint32_t nChunkPointCount, std::vector<uint8_t>& buffer)
+	{
+		LibMCAssertNotNull(pScatterplot);
+		if (nChunkPointCount == 0)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+		std::vector<sScatterplotChannelColumn> channelColumns;
+		uint64_t nChannelPointCount = 0;
+		uint32_t nChannelID = 0;
+		if (pScatterplot->findChannel(sChannel, nChannelID)) {
+			pScatterplot->getChannelColumns(nChannelID, channelColumns);
+			nChannelPointCount = pScatterplot->getChannelPointCount(nChannelID);
+		}
+
+		CJSONWriter writer;
+		writer.addString("channel", sChannel);
+		writer.addInteger("pointcount", nChannelPointCount);
+		writer.addString("encoding", (encoding == eScatterplotChannelEncoding::ceInt16) ? AMC_SCATTERPLOTCHANNEL_ENCODING_INT16 : AMC_SCATTERPLOTCHANNEL_ENCODING_FLOAT32);
+		writer.addString("compression", bCompressChunks ? AMC_SCATTERPLOTCHANNEL_COMPRESSION_LZ4 : AMC_SCATTERPLOTCHANNEL_COMPRESSION_NONE);
+		writer.addInteger("chunkpointcount", nChunkPointCount);
+
+		CJSONWriterArray columnArray(writer);
+		CJSONWriterArray chunkArray(writer);
+
+		std::vector<uint8_t> chunkData;
+		std::vector<uint8_t> chunkBuffer;
+		std::vector<uint8_t> compressedBuffer;
+
+		for (size_t nColumnIndex = 0; nColumnIndex < channelColumns.size(); nColumnIndex++) {
+			auto& channelColumn = channelColumns.at(nColumnIndex);
+			const double* pValues = pScatterplot->getColumnValues(channelColumn);
+			size_t nValueCount = (size_t)channelColumn.m_nValueCount;
+
+			double dMin = 0.0;
+			double dMax = 0.0;
+			bool bHasValue = false;
+			for (size_t nIndex = 0; nIndex < nValueCount; nIndex++) {
+				double dValue = pValues[nIndex];
+				if (std::isfinite(dValue)) {
+					if (!bHasValue) {
+						dMin = dValue;
+						dMax = dValue;
+						bHasValue = true;
+					}
+					else {
+						if (dValue < dMin)
+							dMin = dValue;
+						if (dValue > dMax)
+							dMax = dValue;
+					}
+				}
+			}
+
+			double dScale = 1.0;
+			double dOffset = 0.0;
+			if (encoding == eScatterplotChannelEncoding::ceInt16) {
+				dOffset = (dMin + dMax) * 0.5;
+				if (dMax > dMin)
+					dScale = (dMax - dMin) / (2.0 * AMC_SCATTERPLOTCHANNEL_INT16MAX);
+			}
+
+			CJSONWriterObject columnObject(writer);
+			columnObject.addString("name", pScatterplot->getInternedName(channelColumn.m_nColumnID));
+			columnObject.addInteger("valuecount", nValueCount);
+			columnObject.addDouble("min", dMin);
+			columnObject.addDouble("max", dMax);
+			columnObject.addDouble("scale", dScale);
+			columnObject.addDouble("offset", dOffset);
+			columnArray.addObject(columnObject);
+
+			for (size_t nFirstPoint = 0; nFirstPoint < nValueCount; nFirstPoint += nChunkPointCount) {
+				size_t nPointCount = nValueCount - nFirstPoint;
+				if (nPointCount > nChunkPointCount)
+					nPointCount = nChunkPointCount;
+
+				encodeColumnChunk(pValues + nFirstPoint, nPointCount, encoding, dScale, dOffset, chunkBuffer);
+
+				const uint8_t* pStoredData = chunkBuffer.data();
+				size_t nStoredSize = chunkBuffer.size();
+				bool bCompressed = false;
+
+				if (bCompressChunks) {
+					compressedBuffer.resize((size_t)LZ4_compressBound((int)chunkBuffer.size()));
+					int nCompressedSize = LZ4_compress_default((const char*)chunkBuffer.data(), (char*)compressedBuffer.data(), (int)chunkBuffer.size(), (int)compressedBuffer.size());
+					if (nCompressedSize <= 0)
+						throw ELibMCInterfaceException(LIBMC_ERROR_COULDNOTCOMPRESSPOINTCHANNEL);
+
+					// Chunks that do not shrink are stored uncompressed
+					if ((size_t)nCompressedSize < chunkBuffer.size()) {
+						pStoredData = compressedBuffer.data();
+						nStoredSize = (size_t)nCompressedSize;
+						bCompressed = true;
+					}
+				}
+
+				size_t nChunkOffset = chunkData.size();
+				chunkData.resize(nChunkOffset + ((nStoredSize + 3) & ~(size_t)3), 0);
+				memcpy(chunkData.data() + nChunkOffset, pStoredData, nStoredSize);
+
+				CJSONWriterObject chunkObject(writer);
+				chunkObject.addInteger("column", nColumnIndex);
+				chunkObject.addInteger("firstpoint", nFirstPoint);
+				chunkObject.addInteger("pointcount", nPointCount);
+				chunkObject.addInteger("offset", nChunkOffset);
+				chunkObject.addInteger("size", nStoredSize);
+				chunkObject.addBool("compressed", bCompressed);
+				chunkArray.addObject(chunkObject);
+			}
+		}
+
+		writer.addArray("columns", columnArray);
+		writer.addArray("chunks", chunkArray);
+
+		std::string sHeader = writer.saveToString();
+		while (sHeader.length() % 4 != 0)
+			sHeader.push_back(' ');
+
+		uint32_t nPrefix[2];
+		nPrefix[0] = AMC_SCATTERPLOTCHANNEL_SIGNATURE;
+		nPrefix[1] = (uint32_t)sHeader.length();
+
+		buffer.resize(sizeof(nPrefix) + sHeader.length() + chunkData.size());
+		memcpy(buffer.data(), nPrefix, sizeof(nPrefix));
+		memcpy(buffer.data() + sizeof(nPrefix), sHeader.c_str(), sHeader.length());
+		if (chunkData.size() > 0)
+			memcpy(buffer.data() + sizeof(nPrefix) + sHeader.length(), chunkData.data(), chunkData.size());
+	}
+
+}
+
@@ -0,0 +1,81 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMC_SCATTERPLOTCHANNELENCODER
+#define __AMC_SCATTERPLOTCHANNELENCODER
+
+#include "amc_scatterplot.hpp"
+
+#include <string>
+#include <vector>
+
+// Binary point channel layout (little endian):
+//   uint32 signature | uint32 header length | JSON header (space padded to 4 bytes) | chunk data
+// The JSON header lists the channel columns and a chunk directory. Every chunk holds a consecutive
+// range of one column's points, its offset is relative to the start of the chunk data and 4 byte aligned.
+// int16 values decode as offset + scale * value, AMC_SCATTERPLOTCHANNEL_INT16INVALID marks non-finite values.
+#define AMC_SCATTERPLOTCHANNEL_SIGNATURE 0x31434341
+#define AMC_SCATTERPLOTCHANNEL_DEFAULTCHUNKPOINTCOUNT 65536
+#define AMC_SCATTERPLOTCHANNEL_INT16INVALID -32768
+#define AMC_SCATTERPLOTCHANNEL_INT16MAX 32767
+
+#define AMC_SCATTERPLOTCHANNEL_ENCODING_FLOAT32 "float32"
+#define AMC_SCATTERPLOTCHANNEL_ENCODING_INT16 "int16"
+#define AMC_SCATTERPLOTCHANNEL_COMPRESSION_NONE "none"
+#define AMC_SCATTERPLOTCHANNEL_COMPRESSION_LZ4 "lz4"
+
+namespace AMC {
+
+	enum class eScatterplotChannelEncoding : int32_t {
+		ceFloat32 = 1,
+		ceInt16 = 2
+	};
+
+	class CScatterplotChannelEncoder {
+	private:
+
+		static void encodeColumnChunk(const double* pValues, size_t nValueCount, eScatterplotChannelEncoding encoding, double dScale, double dOffset, std::vector<uint8_t>& chunkBuffer);
+
+	public:
+
+		static eScatterplotChannelEncoding stringToEncoding(const std::string& sEncoding);
+
+		static bool stringToCompression(const std::string& sCompression);
+
+		static void encodeChannel(CScatterplot* pScatterplot, const std::string& sChannel, eScatterplotChannelEncoding encoding, bool bCompressChunks, uint32_t nChunkPointCount, std::vector<uint8_t>& buffer);
+
+	};
+
+}
+
+
+#endif //__AMC_SCATTERPLOTCHANNELENCODER
+
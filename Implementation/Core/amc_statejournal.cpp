@@ -82,6 +82,12 @@ namespace AMC {
 			throw ELibMCCustomException(LIBMC_ERROR_JOURNALVARIABLEISNOTNUMERIC, m_sName);
 		}
 
+		// Returns the factor that converts stored integer values into values of the variable.
+		virtual double getNumericUnits()
+		{
+			throw ELibMCCustomException(LIBMC_ERROR_JOURNALVARIABLEISNOTNUMERIC, m_sName);
+		}
+
 	};
 
 
@@ -127,6 +133,11 @@ namespace AMC {
 			return 0.0;
 		}
 
+		double getNumericUnits() override
+		{
+			return 1.0;
+		}
+
 	};
 
 
@@ -173,6 +184,11 @@ namespace AMC {
 			return (double)m_pStream->sampleIntegerData(m_nStorageIndex, nTimeStampInMicroseconds);
 		}
 
+		double getNumericUnits() override
+		{
+			return 1.0;
+		}
+
 
 
 	};
@@ -246,6 +262,11 @@ namespace AMC {
 			return m_pStream->sampleDoubleData (m_nStorageIndex, nTimeStampInMicroseconds, m_dUnits);
 		}
 
+		double getNumericUnits() override
+		{
+			return m_dUnits;
+		}
+
 	};
 
 	class CStateJournalImplStringVariable : public CStateJournalImplVariable {
@@ -331,6 +352,8 @@ namespace AMC {
 
 		double computeSample(const std::string& sName, const uint64_t nTimeStampInMicroseconds);
 
+		void computeBucketStatistics(const std::vector<std::string>& variableNames, uint64_t nStartTimeStamp, uint64_t nIntervalInMicroseconds, uint32_t nBucketCount, std::vector<PStateJournalBucketAggregator>& aggregators);
+
 		void recordingThread();
 		
 		std::string getStartTimeAsUTC();
@@ -371,6 +394,8 @@ namespace AMC {
 
 	PStateJournalImplVariable CStateJournalImpl::createAlias(const std::string& sName, const std::string& sSourceName)
 	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
 		auto iIter = m_VariableStringMap.find (sSourceName);
 		if (iIter == m_VariableStringMap.end()) 
 			throw ELibMCCustomException(LIBMC_ERROR_JOURNALVARIABLENOTFOUND, sSourceName);
@@ -387,6 +412,9 @@ namespace AMC {
 
 	PStateJournalImplVariable CStateJournalImpl::generateVariable(const LibMCData::eParameterDataType eVariableType, const std::string& sName, double dUnits)
 	{
+		// Drivers register their parameters from several initialization threads.
+		// The lock covers the ID assignment and the database entry of the variable.
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
 
 		if (m_JournalMode != eStateJournalMode::sjmInitialising)
 			throw ELibMCCustomException(LIBMC_ERROR_JOURNALISNOTINITIALISING, sName);
@@ -604,6 +632,26 @@ namespace AMC {
 	}
 
 
+	void CStateJournalImpl::computeBucketStatistics(const std::vector<std::string>& variableNames, uint64_t nStartTimeStamp, uint64_t nIntervalInMicroseconds, uint32_t nBucketCount, std::vector<PStateJournalBucketAggregator>& aggregators)
+	{
+		aggregators.clear();
+
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		if (m_JournalMode != eStateJournalMode::sjmRecording)
+			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALISNOTRECORDING);
+
+		std::vector<uint32_t> storageIndices;
+		for (auto& sName : variableNames) {
+			auto pVariable = findVariable(sName);
+			storageIndices.push_back(pVariable->getStorageIndex());
+			aggregators.push_back(std::make_shared<CStateJournalBucketAggregator>(nStartTimeStamp, nIntervalInMicroseconds, nBucketCount, pVariable->getNumericUnits()));
+		}
+
+		// The lock keeps the chunk that is currently recorded from changing while its entries are read.
+		m_pStream->aggregateIntegerData(storageIndices, aggregators);
+	}
+
+
 	/*void CStateJournalImpl::readDoubleTimeStream(const std::string& sName, const sStateJournalInterval& interval, std::vector<sJournalTimeStreamDoubleEntry>& timeStream)
 	{
 		std::lock_guard<std::mutex> lockGuard(m_Mutex);
@@ -778,6 +826,11 @@ namespace AMC {
 		return m_pImpl->computeSample(sName, nTimeStamp);
 	}
 
+	void CStateJournal::computeBucketStatistics(const std::vector<std::string>& variableNames, uint64_t nStartTimeStamp, uint64_t nIntervalInMicroseconds, uint32_t nBucketCount, std::vector<PStateJournalBucketAggregator>& aggregators)
+	{
+		m_pImpl->computeBucketStatistics(variableNames, nStartTimeStamp, nIntervalInMicroseconds, nBucketCount, aggregators);
+	}
+
 
 	void CStateJournal::registerAlias(const std::string& sName, const std::string& sSourceName)
 	{
@@ -34,6 +34,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "amc_statejournalstream.hpp"
 #include "libmcdata_types.hpp"
@@ -94,6 +95,10 @@ namespace AMC {
 		//sStateJournalStatistics computeStatistics (const std::string& sName, const sStateJournalInterval& interval);
 
 		double computeSample(const std::string& sName, const uint64_t nTimeStamp);
+
+		// Computes count, min, max, mean and last value of each variable over nBucketCount buckets of fixed length.
+		// All variables are aggregated in a single pass over the chunks of the range.
+		void computeBucketStatistics(const std::vector<std::string>& variableNames, uint64_t nStartTimeStamp, uint64_t nIntervalInMicroseconds, uint32_t nBucketCount, std::vector<PStateJournalBucketAggregator>& aggregators);
 		
 		void retrieveRecentInterval (uint64_t nLastMicroSeconds, sStateJournalInterval& interval);
 
@@ -0,0 +1,214 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "amc_statejournalaggregator.hpp"
+#include "libmc_exceptiontypes.hpp"
+
+#include <cstring>
+#include <algorithm>
+
+namespace AMC {
+
+	CStateJournalBucketAggregator::CStateJournalBucketAggregator(uint64_t nStartTimeStamp, uint64_t nIntervalInMicroseconds, uint32_t nBucketCount, double dUnits)
+		: m_nStartTimeStamp (nStartTimeStamp), m_nIntervalInMicroseconds (nIntervalInMicroseconds), m_dUnits (dUnits)
+	{
+		if ((nIntervalInMicroseconds == 0) || (nBucketCount == 0))
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDJOURNALCOMPUTEINTERVAL);
+		if (nIntervalInMicroseconds > (UINT64_MAX - nStartTimeStamp) / nBucketCount)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDJOURNALCOMPUTEINTERVAL);
+
+		m_Buckets.resize(nBucketCount);
+		memset((void*)m_Buckets.data(), 0, m_Buckets.size() * sizeof(sStateJournalBucket));
+	}
+
+	CStateJournalBucketAggregator::~CStateJournalBucketAggregator()
+	{
+
+	}
+
+	uint64_t CStateJournalBucketAggregator::getStartTimeStamp()
+	{
+		return m_nStartTimeStamp;
+	}
+
+	uint64_t CStateJournalBucketAggregator::getEndTimeStamp()
+	{
+		return m_nStartTimeStamp + m_nIntervalInMicroseconds * m_Buckets.size();
+	}
+
+	uint64_t CStateJournalBucketAggregator::getIntervalInMicroseconds()
+	{
+		return m_nIntervalInMicroseconds;
+	}
+
+	uint32_t CStateJournalBucketAggregator::getBucketCount()
+	{
+		return (uint32_t)m_Buckets.size();
+	}
+
+	void CStateJournalBucketAggregator::addEntries(uint64_t nChunkStartTimeStamp, const uint32_t* pTimeStamps, const int64_t* pValues, size_t nEntryCount)
+	{
+		if (nEntryCount == 0)
+			return;
+		if ((pTimeStamps == nullptr) || (pValues == nullptr))
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+		uint64_t nEndTimeStamp = getEndTimeStamp();
+
+		// Track the current bucket boundaries, so that sorted entries only need a division when they cross into a new bucket.
+		sStateJournalBucket* pBucket = nullptr;
+		uint64_t nBucketStart = 0;
+		uint64_t nBucketEnd = 0;
+
+		for (size_t nIndex = 0; nIndex < nEntryCount; nIndex++) {
+			uint64_t nTimeStamp = nChunkStartTimeStamp + pTimeStamps[nIndex];
+			if ((nTimeStamp < m_nStartTimeStamp) || (nTimeStamp >= nEndTimeStamp))
+				continue;
+
+			if ((pBucket == nullptr) || (nTimeStamp < nBucketStart) || (nTimeStamp >= nBucketEnd)) {
+				uint64_t nBucketIndex = (nTimeStamp - m_nStartTimeStamp) / m_nIntervalInMicroseconds;
+				pBucket = &m_Buckets[nBucketIndex];
+				nBucketStart = m_nStartTimeStamp + nBucketIndex * m_nIntervalInMicroseconds;
+				nBucketEnd = nBucketStart + m_nIntervalInMicroseconds;
+			}
+
+			int64_t nValue = pValues[nIndex];
+			if (pBucket->m_nSampleCount == 0) {
+				pBucket->m_nMinValue = nValue;
+				pBucket->m_nMaxValue = nValue;
+			}
+			else {
+				if (nValue < pBucket->m_nMinValue)
+					pBucket->m_nMinValue = nValue;
+				if (nValue > pBucket->m_nMaxValue)
+					pBucket->m_nMaxValue = nValue;
+			}
+
+			if ((pBucket->m_nSampleCount == 0) || (nTimeStamp >= pBucket->m_nLastTimeStamp)) {
+				pBucket->m_nLastValue = nValue;
+				pBucket->m_nLastTimeStamp = nTimeStamp;
+			}
+
+			pBucket->m_nSampleCount++;
+			pBucket->m_dValueSum += (double)nValue;
+		}
+	}
+
+	bool CStateJournalBucketAggregator::addSummary(uint64_t nFirstTimeStamp, uint64_t nLastTimeStamp, uint32_t nEntryCount, int64_t nMinValue, int64_t nMaxValue, int64_t nLastValue, double dValueSum)
+	{
+		if (nEntryCount == 0)
+			return true;
+
+		if ((nFirstTimeStamp < m_nStartTimeStamp) || (nLastTimeStamp >= getEndTimeStamp()) || (nLastTimeStamp < nFirstTimeStamp))
+			return false;
+
+		uint64_t nBucketIndex = (nFirstTimeStamp - m_nStartTimeStamp) / m_nIntervalInMicroseconds;
+		if (nBucketIndex != (nLastTimeStamp - m_nStartTimeStamp) / m_nIntervalInMicroseconds)
+			return false;
+
+		sStateJournalBucket summaryBucket;
+		summaryBucket.m_nSampleCount = nEntryCount;
+		summaryBucket.m_nMinValue = nMinValue;
+		summaryBucket.m_nMaxValue = nMaxValue;
+		summaryBucket.m_nLastValue = nLastValue;
+		summaryBucket.m_nLastTimeStamp = nLastTimeStamp;
+		summaryBucket.m_dValueSum = dValueSum;
+
+		mergeIntoBucket(m_Buckets[nBucketIndex], summaryBucket);
+
+		return true;
+	}
+
+	void CStateJournalBucketAggregator::merge(CStateJournalBucketAggregator& otherAggregator)
+	{
+		if ((otherAggregator.m_nStartTimeStamp != m_nStartTimeStamp) || (otherAggregator.m_nIntervalInMicroseconds != m_nIntervalInMicroseconds) || (otherAggregator.m_Buckets.size() != m_Buckets.size()))
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDJOURNALCOMPUTEINTERVAL);
+
+		for (size_t nBucketIndex = 0; nBucketIndex < m_Buckets.size(); nBucketIndex++)
+			mergeIntoBucket(m_Buckets[nBucketIndex], otherAggregator.m_Buckets[nBucketIndex]);
+	}
+
+	void CStateJournalBucketAggregator::mergeIntoBucket(sStateJournalBucket& bucket, const sStateJournalBucket& source)
+	{
+		if (source.m_nSampleCount == 0)
+			return;
+
+		if (bucket.m_nSampleCount == 0) {
+			bucket = source;
+			return;
+		}
+
+		if (source.m_nMinValue < bucket.m_nMinValue)
+			bucket.m_nMinValue = source.m_nMinValue;
+		if (source.m_nMaxValue > bucket.m_nMaxValue)
+			bucket.m_nMaxValue = source.m_nMaxValue;
+		if (source.m_nLastTimeStamp >= bucket.m_nLastTimeStamp) {
+			bucket.m_nLastValue = source.m_nLastValue;
+			bucket.m_nLastTimeStamp = source.m_nLastTimeStamp;
+		}
+
+		bucket.m_nSampleCount += source.m_nSampleCount;
+		bucket.m_dValueSum += source.m_dValueSum;
+	}
+
+	const sStateJournalBucket& CStateJournalBucketAggregator::getBucket(uint32_t nBucketIndex)
+	{
+		if (nBucketIndex >= m_Buckets.size())
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDINDEX);
+
+		return m_Buckets[nBucketIndex];
+	}
+
+	bool CStateJournalBucketAggregator::getBucketStatistics(uint32_t nBucketIndex, uint32_t& nSampleCount, double& dMinValue, double& dMaxValue, double& dMeanValue, double& dLastValue)
+	{
+		auto& bucket = getBucket(nBucketIndex);
+
+		nSampleCount = bucket.m_nSampleCount;
+		if (bucket.m_nSampleCount == 0) {
+			dMinValue = 0.0;
+			dMaxValue = 0.0;
+			dMeanValue = 0.0;
+			dLastValue = 0.0;
+			return false;
+		}
+
+		dMinValue = (double)bucket.m_nMinValue * m_dUnits;
+		dMaxValue = (double)bucket.m_nMaxValue * m_dUnits;
+		if (dMinValue > dMaxValue)
+			std::swap(dMinValue, dMaxValue);
+
+		dMeanValue = bucket.m_dValueSum / (double)bucket.m_nSampleCount * m_dUnits;
+		dLastValue = (double)bucket.m_nLastValue * m_dUnits;
+
+		return true;
+	}
+
+}
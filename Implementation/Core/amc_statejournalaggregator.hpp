@@ -0,0 +1,98 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMC_STATEJOURNALAGGREGATOR
+#define __AMC_STATEJOURNALAGGREGATOR
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+namespace AMC {
+
+	typedef struct _sStateJournalBucket {
+		uint32_t m_nSampleCount;
+		int64_t m_nMinValue;
+		int64_t m_nMaxValue;
+		int64_t m_nLastValue;
+		uint64_t m_nLastTimeStamp;
+		double m_dValueSum;
+	} sStateJournalBucket;
+
+	// Accumulates journal entries into fixed buckets [Start + i * Interval, Start + (i + 1) * Interval).
+	// Entries are counted in the bucket their time stamp falls into. Partial results may be merged in any order.
+	class CStateJournalBucketAggregator {
+	private:
+
+		uint64_t m_nStartTimeStamp;
+		uint64_t m_nIntervalInMicroseconds;
+		double m_dUnits;
+
+		std::vector<sStateJournalBucket> m_Buckets;
+
+		static void mergeIntoBucket(sStateJournalBucket& bucket, const sStateJournalBucket& source);
+
+	public:
+
+		CStateJournalBucketAggregator(uint64_t nStartTimeStamp, uint64_t nIntervalInMicroseconds, uint32_t nBucketCount, double dUnits);
+
+		virtual ~CStateJournalBucketAggregator();
+
+		uint64_t getStartTimeStamp();
+
+		uint64_t getEndTimeStamp();
+
+		uint64_t getIntervalInMicroseconds();
+
+		uint32_t getBucketCount();
+
+		// Adds the raw entries of a chunk. Time stamps are relative to the chunk start and sorted ascending.
+		void addEntries(uint64_t nChunkStartTimeStamp, const uint32_t* pTimeStamps, const int64_t* pValues, size_t nEntryCount);
+
+		// Adds a precomputed summary of consecutive entries. Returns false without changes if the entries
+		// do not fall into a single bucket; they need to be added with addEntries then.
+		bool addSummary(uint64_t nFirstTimeStamp, uint64_t nLastTimeStamp, uint32_t nEntryCount, int64_t nMinValue, int64_t nMaxValue, int64_t nLastValue, double dValueSum);
+
+		void merge(CStateJournalBucketAggregator& otherAggregator);
+
+		const sStateJournalBucket& getBucket(uint32_t nBucketIndex);
+
+		// Returns the statistics of a bucket, scaled by the units of the variable. Returns false if the bucket has no entries.
+		bool getBucketStatistics(uint32_t nBucketIndex, uint32_t& nSampleCount, double& dMinValue, double& dMaxValue, double& dMeanValue, double& dLastValue);
+
+	};
+
+	typedef std::shared_ptr<CStateJournalBucketAggregator> PStateJournalBucketAggregator;
+
+}
+
+
+#endif //__AMC_STATEJOURNALAGGREGATOR
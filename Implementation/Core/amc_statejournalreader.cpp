@@ -37,6 +37,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <iostream>
 #include <mutex>
 #include <cmath>
+#include <cstring>
+#include <thread>
+#include <atomic>
+#include <algorithm>
 
 namespace AMC {
 
@@ -52,7 +56,7 @@ namespace AMC {
 
 	CStateJournalStreamCache_Historic::~CStateJournalStreamCache_Historic()
 	{
-
+		stopPrefetching();
 	}
 
 	PStateJournalStreamChunk_InMemory CStateJournalStreamCache_Historic::loadEntryFromJournal(uint32_t nTimeChunkIndex)
@@ -137,7 +141,7 @@ namespace AMC {
 
 
 	CStateJournalReader::CStateJournalReader(LibMCData::PJournalReader pReader, uint64_t nMemoryQuota, PLogger pDebugLogger)
-		: m_pJournalReader (pReader)
+		: m_pJournalReader (pReader), m_nLastSampledChunkIndex (UINT32_MAX)
 	{
 		if (pReader.get() == nullptr)
 			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
@@ -233,9 +237,7 @@ namespace AMC {
 
 		auto pChunk = findChunkForTimestamp(nTimeStamp);
 		if (pChunk.get() != nullptr) {
-			auto pEntry = m_pStreamCache->retrieveEntry(pChunk->getChunkIndex());
-			if (pEntry.get() == nullptr)
-				pEntry = m_pStreamCache->loadEntryFromJournal(pChunk->getChunkIndex());
+			auto pEntry = acquireChunkForSampling(pChunk);
 
 			int64_t nIntegerData = pEntry->sampleIntegerData(pVariable->getVariableIndex(), nTimeStamp);
 
@@ -264,9 +266,7 @@ namespace AMC {
 
 		auto pChunk = findChunkForTimestamp(nTimeStamp);
 		if (pChunk.get() != nullptr) {
-			auto pEntry = m_pStreamCache->retrieveEntry(pChunk->getChunkIndex());
-			if (pEntry.get() == nullptr)
-				pEntry = m_pStreamCache->loadEntryFromJournal(pChunk->getChunkIndex());
+			auto pEntry = acquireChunkForSampling(pChunk);
 
 			int64_t nIntegerData = pEntry->sampleIntegerData(pVariable->getVariableIndex(), nTimeStamp);
 
@@ -304,11 +304,219 @@ namespace AMC {
 
 	LibMCData::PJournalChunkIntegerData CStateJournalReader::readChunkIntegerData(uint32_t nChunkIndex)
 	{
-		std::lock_guard<std::mutex> lockGuard(m_JournalReaderMutex);
+		// No lock needed here (see aggregateChunkEntries), which lets the stream cache load several chunks in parallel.
 		return m_pJournalReader->ReadChunkIntegerData(nChunkIndex);
 
 	}
 
+	PStateJournalStreamChunk_InMemory CStateJournalReader::acquireChunkForSampling(PStateJournalReaderChunk pChunk)
+	{
+		auto pEntry = m_pStreamCache->acquireEntry(pChunk->getChunkIndex());
+
+		if (m_nLastSampledChunkIndex.exchange(pChunk->getChunkIndex()) != pChunk->getChunkIndex())
+			prefetchChunksAfter(pChunk->getEndTimeStamp());
+
+		return pEntry;
+	}
+
+	void CStateJournalReader::prefetchChunksAfter(uint64_t nTimeStamp)
+	{
+		auto iChunkIter = std::upper_bound(m_Chunks.begin(), m_Chunks.end(), nTimeStamp, [](uint64_t nTimeStamp, const PStateJournalReaderChunk& pChunk) {
+			return nTimeStamp < pChunk->getStartTimeStamp();
+		});
+
+		std::vector<uint32_t> chunkIndices;
+		for (; (iChunkIter != m_Chunks.end()) && (chunkIndices.size() < STATEJOURNALREADER_PREFETCHCHUNKCOUNT); iChunkIter++)
+			chunkIndices.push_back((*iChunkIter)->getChunkIndex());
+
+		if (!chunkIndices.empty())
+			m_pStreamCache->prefetchEntries(chunkIndices);
+	}
+
+	void CStateJournalReader::readDoubleTimeStreams(const std::vector<std::string>& variableNames, uint64_t nStartTimeStamp, uint64_t nEndTimeStamp, std::vector<std::vector<sJournalTimeStreamDoubleEntry>>& timeStreams)
+	{
+		timeStreams.clear();
+
+		std::vector<PStateJournalReaderVariable> variables;
+		for (auto& sName : variableNames)
+			variables.push_back(findVariable(sName));
+
+		timeStreams.resize(variables.size());
+		if (variables.empty() || (nEndTimeStamp <= nStartTimeStamp))
+			return;
+
+		auto iChunkIter = std::lower_bound(m_Chunks.begin(), m_Chunks.end(), nStartTimeStamp, [](const PStateJournalReaderChunk& pChunk, uint64_t nTimeStamp) {
+			return pChunk->getEndTimeStamp() < nTimeStamp;
+		});
+
+		std::vector<uint32_t> chunkIndices;
+		for (; (iChunkIter != m_Chunks.end()) && ((*iChunkIter)->getStartTimeStamp() < nEndTimeStamp); iChunkIter++)
+			chunkIndices.push_back((*iChunkIter)->getChunkIndex());
+
+		// Reading a range is usually followed by reading the next one, so the following chunks are loaded while the caller works.
+		prefetchChunksAfter(nEndTimeStamp);
+
+		std::vector<PStateJournalStreamChunk_InMemory> chunkEntries;
+		m_pStreamCache->acquireEntries(chunkIndices, chunkEntries);
+
+		CStateJournalStreamCache::runInParallel(variables.size(), CStateJournalStreamCache::getWorkerThreadCount(variables.size()), [&](size_t nVariableListIndex, size_t nThreadIndex) {
+			auto pVariable = variables.at(nVariableListIndex);
+
+			double dUnits = 1.0;
+			switch (pVariable->getDataType()) {
+			case LibMCData::eParameterDataType::Integer:
+			case LibMCData::eParameterDataType::Bool:
+				break;
+			case LibMCData::eParameterDataType::Double:
+				dUnits = pVariable->getUnits();
+				break;
+			default:
+				dUnits = 0.0;
+			}
+
+			std::vector<sJournalTimeStreamInt64Entry> integerEntries;
+			for (auto& pChunkEntry : chunkEntries)
+				pChunkEntry->extractIntegerEntries(pVariable->getVariableIndex(), nStartTimeStamp, nEndTimeStamp, integerEntries);
+
+			auto& timeStream = timeStreams.at(nVariableListIndex);
+			timeStream.resize(integerEntries.size());
+			for (size_t nIndex = 0; nIndex < integerEntries.size(); nIndex++) {
+				timeStream.at(nIndex).m_nTimeStampInMicroSeconds = integerEntries.at(nIndex).m_nTimeStampInMicroSeconds;
+				timeStream.at(nIndex).m_dValue = integerEntries.at(nIndex).m_nValue * dUnits;
+			}
+		});
+	}
+
+	std::shared_ptr<std::vector<LibMCData::sJournalChunkVariableSummary>> CStateJournalReader::retrieveChunkSummaries(uint32_t nChunkIndex)
+	{
+		{
+			std::lock_guard<std::mutex> lockGuard(m_ChunkSummaryMutex);
+			auto iIter = m_ChunkSummaryIndex.find(nChunkIndex);
+			if (iIter != m_ChunkSummaryIndex.end())
+				return iIter->second;
+		}
+
+		std::vector<LibMCData::sJournalChunkVariableSummary> chunkSummaries;
+		{
+			std::lock_guard<std::mutex> lockGuard(m_JournalReaderMutex);
+			m_pJournalReader->ReadChunkSummaries(nChunkIndex, chunkSummaries);
+		}
+
+		auto pSummaries = std::make_shared<std::vector<LibMCData::sJournalChunkVariableSummary>>();
+		pSummaries->resize(m_Variables.size());
+		memset((void*)pSummaries->data(), 0, pSummaries->size() * sizeof(LibMCData::sJournalChunkVariableSummary));
+		for (auto& summary : chunkSummaries) {
+			if (summary.m_VariableIndex < pSummaries->size())
+				pSummaries->at(summary.m_VariableIndex) = summary;
+		}
+
+		std::lock_guard<std::mutex> lockGuard(m_ChunkSummaryMutex);
+		m_ChunkSummaryIndex.insert(std::make_pair(nChunkIndex, pSummaries));
+		return pSummaries;
+	}
+
+	void CStateJournalReader::aggregateChunkEntries(PStateJournalReaderChunk pChunk, const std::vector<PStateJournalReaderVariable>& variables, const std::vector<bool>& variableNeedsEntries, std::vector<PStateJournalBucketAggregator>& aggregators)
+	{
+		// The journal reader serves chunks from a read only memory mapping, so chunks are decoded without holding m_JournalReaderMutex.
+		auto pChunkData = m_pJournalReader->ReadChunkIntegerData(pChunk->getChunkIndex());
+
+		std::vector<LibMCData::sJournalChunkVariableInfo> variableInfo;
+		std::vector<LibMCData_uint32> timeStampData;
+		std::vector<LibMCData_int64> valueData;
+		pChunkData->GetVariableInfo(variableInfo);
+		pChunkData->GetTimeStampData(timeStampData);
+		pChunkData->GetValueData(valueData);
+
+		for (size_t nVariableListIndex = 0; nVariableListIndex < variables.size(); nVariableListIndex++) {
+			if (!variableNeedsEntries.at(nVariableListIndex))
+				continue;
+
+			uint32_t nVariableIndex = variables.at(nVariableListIndex)->getVariableIndex();
+			for (auto& info : variableInfo) {
+				if (info.m_VariableIndex == nVariableIndex) {
+					if (((uint64_t)info.m_EntryStartIndex + info.m_EntryCount) > valueData.size())
+						throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDJOURNALCOMPUTEDATA, "Invalid journal chunk entry range in chunk #" + std::to_string(pChunk->getChunkIndex()));
+
+					aggregators.at(nVariableListIndex)->addEntries(pChunk->getStartTimeStamp(), timeStampData.data() + info.m_EntryStartIndex, valueData.data() + info.m_EntryStartIndex, info.m_EntryCount);
+					break;
+				}
+			}
+		}
+	}
+
+	void CStateJournalReader::computeBucketStatistics(const std::vector<std::string>& variableNames, uint64_t nStartTimeStamp, uint64_t nIntervalInMicroseconds, uint32_t nBucketCount, std::vector<PStateJournalBucketAggregator>& aggregators)
+	{
+		aggregators.clear();
+
+		std::vector<PStateJournalReaderVariable> variables;
+		std::vector<double> variableUnits;
+		for (auto& sName : variableNames) {
+			auto pVariable = findVariable(sName);
+			double dUnits = (pVariable->getDataType() == LibMCData::eParameterDataType::Double) ? pVariable->getUnits() : 1.0;
+
+			variables.push_back(pVariable);
+			variableUnits.push_back(dUnits);
+			aggregators.push_back(std::make_shared<CStateJournalBucketAggregator>(nStartTimeStamp, nIntervalInMicroseconds, nBucketCount, dUnits));
+		}
+
+		if (variables.empty())
+			return;
+
+		uint64_t nEndTimeStamp = aggregators.front()->getEndTimeStamp();
+
+		// Chunks are sorted and do not overlap, so the first chunk that ends after the start of the range is found by binary search.
+		auto iChunkIter = std::lower_bound(m_Chunks.begin(), m_Chunks.end(), nStartTimeStamp, [](const PStateJournalReaderChunk& pChunk, uint64_t nTimeStamp) {
+			return pChunk->getEndTimeStamp() < nTimeStamp;
+		});
+
+		std::vector<std::pair<PStateJournalReaderChunk, std::vector<bool>>> chunksToDecode;
+
+		for (; iChunkIter != m_Chunks.end(); iChunkIter++) {
+			auto pChunk = *iChunkIter;
+			if (pChunk->getStartTimeStamp() >= nEndTimeStamp)
+				break;
+
+			auto pSummaries = retrieveChunkSummaries(pChunk->getChunkIndex());
+			uint64_t nChunkStartTimeStamp = pChunk->getStartTimeStamp();
+
+			bool bNeedsDecoding = false;
+			std::vector<bool> variableNeedsEntries(variables.size(), false);
+			for (size_t nVariableListIndex = 0; nVariableListIndex < variables.size(); nVariableListIndex++) {
+				auto& summary = pSummaries->at(variables.at(nVariableListIndex)->getVariableIndex());
+				if (!aggregators.at(nVariableListIndex)->addSummary(nChunkStartTimeStamp + summary.m_FirstTimeStamp, nChunkStartTimeStamp + summary.m_LastTimeStamp, summary.m_EntryCount, summary.m_MinValue, summary.m_MaxValue, summary.m_LastValue, summary.m_ValueSum)) {
+					variableNeedsEntries.at(nVariableListIndex) = true;
+					bNeedsDecoding = true;
+				}
+			}
+
+			if (bNeedsDecoding)
+				chunksToDecode.push_back(std::make_pair(pChunk, variableNeedsEntries));
+		}
+
+		size_t nThreadCount = CStateJournalStreamCache::getWorkerThreadCount(chunksToDecode.size());
+		if (nThreadCount <= 1) {
+			for (auto& chunkToDecode : chunksToDecode)
+				aggregateChunkEntries(chunkToDecode.first, variables, chunkToDecode.second, aggregators);
+			return;
+		}
+
+		std::vector<std::vector<PStateJournalBucketAggregator>> workerAggregators(nThreadCount);
+		for (auto& partialAggregators : workerAggregators) {
+			for (size_t nVariableListIndex = 0; nVariableListIndex < variables.size(); nVariableListIndex++)
+				partialAggregators.push_back(std::make_shared<CStateJournalBucketAggregator>(nStartTimeStamp, nIntervalInMicroseconds, nBucketCount, variableUnits.at(nVariableListIndex)));
+		}
+
+		CStateJournalStreamCache::runInParallel(chunksToDecode.size(), nThreadCount, [&](size_t nChunkIndex, size_t nThreadIndex) {
+			auto& chunkToDecode = chunksToDecode.at(nChunkIndex);
+			aggregateChunkEntries(chunkToDecode.first, variables, chunkToDecode.second, workerAggregators.at(nThreadIndex));
+		});
+
+		for (auto& partialAggregators : workerAggregators) {
+			for (size_t nVariableListIndex = 0; nVariableListIndex < variables.size(); nVariableListIndex++)
+				aggregators.at(nVariableListIndex)->merge(*partialAggregators.at(nVariableListIndex));
+		}
+	}
+
 	PStateJournalReaderChunk CStateJournalReader::findChunkForTimestamp(uint64_t targetTimestamp) 
 	{
 
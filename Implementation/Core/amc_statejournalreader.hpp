@@ -35,10 +35,16 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <memory>
 #include <string>
 #include <mutex>
+#include <atomic>
+#include <unordered_map>
 
 #include "libmcdata_dynamic.hpp"
 #include "common_chrono.hpp"
 #include "amc_statejournalstreamcache.hpp"
+#include "amc_statejournalaggregator.hpp"
+
+// Number of chunks after a sampled or extracted time range that are loaded in the background.
+#define STATEJOURNALREADER_PREFETCHCHUNKCOUNT 2
 
 namespace AMC {
 
@@ -126,11 +132,28 @@ namespace AMC {
 
 		std::vector<PStateJournalReaderChunk> m_Chunks;
 		std::vector<PStateJournalReaderVariable> m_Variables;
-		std::map<std::string, PStateJournalReaderVariable> m_VariableNameMap;
-		std::map<std::string, PStateJournalReaderVariable> m_AliasNameMap;
+		std::unordered_map<std::string, PStateJournalReaderVariable> m_VariableNameMap;
+		std::unordered_map<std::string, PStateJournalReaderVariable> m_AliasNameMap;
+
+		// Chunk index of the last sample. Moving on to another chunk prefetches the chunks that follow it.
+		std::atomic<uint32_t> m_nLastSampledChunkIndex;
+
+		// Chunk summaries indexed by variable index, loaded on first use.
+		std::mutex m_ChunkSummaryMutex;
+		std::map<uint32_t, std::shared_ptr<std::vector<LibMCData::sJournalChunkVariableSummary>>> m_ChunkSummaryIndex;
 
 		PStateJournalReaderChunk findChunkForTimestamp(uint64_t targetTimestamp);
 
+		// Returns the cached or loaded chunk and prefetches its successors when sampling moves on to a new chunk.
+		PStateJournalStreamChunk_InMemory acquireChunkForSampling(PStateJournalReaderChunk pChunk);
+
+		// Queues the chunks that start after the given time stamp for background loading.
+		void prefetchChunksAfter(uint64_t nTimeStamp);
+
+		std::shared_ptr<std::vector<LibMCData::sJournalChunkVariableSummary>> retrieveChunkSummaries(uint32_t nChunkIndex);
+
+		void aggregateChunkEntries(PStateJournalReaderChunk pChunk, const std::vector<PStateJournalReaderVariable>& variables, const std::vector<bool>& variableNeedsEntries, std::vector<PStateJournalBucketAggregator>& aggregators);
+
 		PStateJournalReaderVariable findVariable(const std::string & sVariableOrAliasName);
 
 	public:
@@ -149,6 +172,14 @@ namespace AMC {
 
 		LibMCData::PJournalChunkIntegerData readChunkIntegerData (uint32_t nChunkIndex);
 
+		// Computes count, min, max, mean and last value of each variable over nBucketCount buckets of fixed length.
+		// Chunks that lie within a single bucket are served from their stored summaries, all others are decoded in parallel.
+		void computeBucketStatistics(const std::vector<std::string>& variableNames, uint64_t nStartTimeStamp, uint64_t nIntervalInMicroseconds, uint32_t nBucketCount, std::vector<PStateJournalBucketAggregator>& aggregators);
+
+		// Returns all recorded entries of each variable with nStartTimeStamp <= timestamp < nEndTimeStamp, scaled by the variable units.
+		// Chunks of the range that are not cached are decoded in parallel, and the chunks after the range are prefetched.
+		void readDoubleTimeStreams(const std::vector<std::string>& variableNames, uint64_t nStartTimeStamp, uint64_t nEndTimeStamp, std::vector<std::vector<sJournalTimeStreamDoubleEntry>>& timeStreams);
+
 	};
 
 	
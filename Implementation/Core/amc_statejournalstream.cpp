@@ -333,6 +333,32 @@ namespace AMC {
 
 
 
+	void CStateJournalStream::aggregateIntegerData(const std::vector<uint32_t>& storageIndices, std::vector<PStateJournalBucketAggregator>& aggregators)
+	{
+		if (aggregators.empty())
+			return;
+
+		uint64_t nStartTimeStamp = aggregators.front()->getStartTimeStamp();
+		uint64_t nEndTimeStamp = aggregators.front()->getEndTimeStamp();
+
+		std::vector<PStateJournalStreamChunk> chunks;
+		{
+			std::lock_guard<std::mutex> lockGuard(m_ChunkChangeMutex);
+			for (uint64_t nChunkIndex = nStartTimeStamp / m_nChunkIntervalInMicroseconds; nChunkIndex < m_ChunkTimeline.size(); nChunkIndex++) {
+				auto pChunk = m_ChunkTimeline.at(nChunkIndex);
+				if (pChunk.get() == nullptr)
+					continue;
+				if (pChunk->getStartTimeStampInMicroSeconds() >= nEndTimeStamp)
+					break;
+
+				chunks.push_back(pChunk);
+			}
+		}
+
+		for (auto pChunk : chunks)
+			pChunk->aggregateIntegerEntries(storageIndices, aggregators);
+	}
+
 	void CStateJournalStream::setVariableCount(size_t nVariableCount)
 	{
 		m_CurrentVariableValues.resize (nVariableCount);
@@ -128,6 +128,9 @@ namespace AMC {
 		double sampleDoubleData(const uint32_t nStorageIndex, const uint64_t nAbsoluteTimeStampInMicroseconds, double dUnits);
 		bool sampleBoolData(const uint32_t nStorageIndex, const uint64_t nAbsoluteTimeStampInMicroseconds);
 
+		// Adds the entries of all chunks that overlap the range of the aggregators. Each chunk is read once for all variables.
+		void aggregateIntegerData(const std::vector<uint32_t>& storageIndices, std::vector<PStateJournalBucketAggregator>& aggregators);
+
 		// Threaded function to write chunk buffers to disk!
 		void serializeChunksThreaded();
 		void writeChunksToDiskThreaded();
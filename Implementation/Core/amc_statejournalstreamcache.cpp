@@ -38,6 +38,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <stdexcept>
+#include <algorithm>
+#include <atomic>
 
 #define STATEJOURNALSTREAMMINCAPACITY 65536
 
@@ -125,6 +127,35 @@ namespace AMC {
 	}
 
 
+	// Add the entries of the given variables to their aggregators
+	void CStateJournalStreamChunk_Dynamic::aggregateIntegerEntries(const std::vector<uint32_t>& storageIndices, std::vector<PStateJournalBucketAggregator>& aggregators)
+	{
+		if (storageIndices.size() != aggregators.size())
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+		std::vector<uint32_t> timeStamps;
+		std::vector<int64_t> values;
+
+		for (size_t nListIndex = 0; nListIndex < storageIndices.size(); nListIndex++) {
+			uint32_t nStorageIndex = storageIndices.at(nListIndex);
+			if (nStorageIndex >= m_Data.size())
+				throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALVARIABLENOTFOUND);
+
+			// The map is ordered by relative time stamp, so the copied entries are sorted as the aggregator expects
+			const auto& variableData = m_Data.at(nStorageIndex);
+			timeStamps.clear();
+			values.clear();
+			timeStamps.reserve(variableData.size());
+			values.reserve(variableData.size());
+			for (auto& entry : variableData) {
+				timeStamps.push_back(entry.first);
+				values.push_back(entry.second);
+			}
+
+			aggregators.at(nListIndex)->addEntries(m_nStartTimeStampInMicroSeconds, timeStamps.data(), values.data(), timeStamps.size());
+		}
+	}
+
 	// Write a new value to the journal for a specific variable at a specific timestamp
 	void CStateJournalStreamChunk_Dynamic::writeEntry (uint32_t nStorageIndex, uint64_t nAbsoluteTimeStampInMicroseconds, int64_t nValue)
 	{
@@ -306,6 +337,59 @@ namespace AMC {
 		return m_ValueBuffer.at ((it - m_TimeStampBuffer.begin()) - 1);
 	}
 
+	void CStateJournalStreamChunk_InMemory::aggregateIntegerEntries(const std::vector<uint32_t>& storageIndices, std::vector<PStateJournalBucketAggregator>& aggregators)
+	{
+		if (storageIndices.size() != aggregators.size())
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+		for (size_t nListIndex = 0; nListIndex < storageIndices.size(); nListIndex++) {
+			uint32_t nStorageIndex = storageIndices.at(nListIndex);
+			if (nStorageIndex >= m_VariableBuffer.size())
+				throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALVARIABLENOTFOUND);
+
+			auto& variableInfo = m_VariableBuffer.at(nStorageIndex);
+			if (((uint64_t)variableInfo.m_EntryStartIndex + variableInfo.m_EntryCount) > m_ValueBuffer.size())
+				throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDJOURNALCOMPUTEDATA, "Invalid journal chunk entry range in chunk #" + std::to_string(m_nChunkIndex));
+
+			aggregators.at(nListIndex)->addEntries(m_nStartTimeStampInMicroSeconds, m_TimeStampBuffer.data() + variableInfo.m_EntryStartIndex, m_ValueBuffer.data() + variableInfo.m_EntryStartIndex, variableInfo.m_EntryCount);
+		}
+	}
+
+	void CStateJournalStreamChunk_InMemory::extractIntegerEntries(const uint32_t nStorageIndex, const uint64_t nStartTimeStampInMicroSeconds, const uint64_t nEndTimeStampInMicroSeconds, std::vector<sJournalTimeStreamInt64Entry>& entries)
+	{
+		if (nStorageIndex >= m_VariableBuffer.size())
+			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALVARIABLENOTFOUND);
+
+		if ((nEndTimeStampInMicroSeconds <= m_nStartTimeStampInMicroSeconds) || (nStartTimeStampInMicroSeconds > m_nEndTimeStampInMicroSeconds) || (nEndTimeStampInMicroSeconds <= nStartTimeStampInMicroSeconds))
+			return;
+
+		auto& variableInfo = m_VariableBuffer.at(nStorageIndex);
+		if (((uint64_t)variableInfo.m_EntryStartIndex + variableInfo.m_EntryCount) > m_ValueBuffer.size())
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDJOURNALCOMPUTEDATA, "Invalid journal chunk entry range in chunk #" + std::to_string(m_nChunkIndex));
+
+		auto iBegin = m_TimeStampBuffer.begin() + variableInfo.m_EntryStartIndex;
+		auto iEnd = iBegin + variableInfo.m_EntryCount;
+
+		// Chunk relative time stamps are sorted, so the range boundaries are found by binary search.
+		if (nStartTimeStampInMicroSeconds > m_nStartTimeStampInMicroSeconds)
+			iBegin = std::lower_bound(iBegin, iEnd, (uint32_t)(nStartTimeStampInMicroSeconds - m_nStartTimeStampInMicroSeconds));
+		if (nEndTimeStampInMicroSeconds <= m_nEndTimeStampInMicroSeconds)
+			iEnd = std::lower_bound(iBegin, iEnd, (uint32_t)(nEndTimeStampInMicroSeconds - m_nStartTimeStampInMicroSeconds));
+
+		size_t nFirstIndex = iBegin - m_TimeStampBuffer.begin();
+		size_t nCount = iEnd - iBegin;
+
+		size_t nOldSize = entries.size();
+		entries.resize(nOldSize + nCount);
+		sJournalTimeStreamInt64Entry* pTarget = entries.data() + nOldSize;
+		const uint32_t* pTimeStamps = m_TimeStampBuffer.data() + nFirstIndex;
+		const int64_t* pValues = m_ValueBuffer.data() + nFirstIndex;
+		for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+			pTarget[nIndex].m_nTimeStampInMicroSeconds = m_nStartTimeStampInMicroSeconds + pTimeStamps[nIndex];
+			pTarget[nIndex].m_nValue = pValues[nIndex];
+		}
+	}
+
 	uint64_t CStateJournalStreamChunk_InMemory::getMemoryUsage()
 	{
 		return m_ValueBuffer.size() * sizeof(int64_t) + m_TimeStampBuffer.size() * sizeof(uint32_t) + m_VariableBuffer.size() * sizeof(LibMCData::sJournalChunkVariableInfo);
@@ -353,10 +437,16 @@ namespace AMC {
 
 		debugLog("journal cache miss " + std::to_string(m_nChunkIndex) + " memory usage: " + std::to_string (m_pStreamCache->getCurrentMemoryUsage()));
 
-		pEntry = m_pStreamCache->loadEntryFromJournal((uint32_t)m_nChunkIndex);
+		pEntry = m_pStreamCache->acquireEntry((uint32_t)m_nChunkIndex);
 		return pEntry->sampleIntegerData(nStorageIndex, nAbsoluteTimeStampInMicroseconds);
 	}
 
+	void CStateJournalStreamChunk_OnDisk::aggregateIntegerEntries(const std::vector<uint32_t>& storageIndices, std::vector<PStateJournalBucketAggregator>& aggregators)
+	{
+		auto pEntry = m_pStreamCache->acquireEntry((uint32_t)m_nChunkIndex);
+		pEntry->aggregateIntegerEntries(storageIndices, aggregators);
+	}
+
 
 
 
@@ -382,13 +472,14 @@ namespace AMC {
 	CStateJournalStreamCache::CStateJournalStreamCache(uint64_t nMemoryQuota, PLogger pDebugLogger)
 		: m_nMemoryQuota(nMemoryQuota),
 		m_nMemoryUsage(0),
-		m_pDebugLogger (pDebugLogger)
+		m_pDebugLogger (pDebugLogger),
+		m_bPrefetchingStopped (false)
 	{
 	}
 
 	CStateJournalStreamCache::~CStateJournalStreamCache()
 	{
-
+		stopPrefetching();
 	}
 
 	uint64_t CStateJournalStreamCache::getMemoryQuota()
@@ -418,17 +509,14 @@ namespace AMC {
 		if (nChunkMemoryUsage == 0)
 			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALCHUNKMEMORYISZERO);
 
-		// If the entry already exists, remove it first (we'll update it)
-		auto it = m_CacheMap.find(nTimeChunkIndex);
-		if (it != m_CacheMap.end()) {
-			removeEntry(nTimeChunkIndex);
-		}
-
 		pChunk->debugLog ("adding to cache: " + std::to_string (nTimeChunkIndex) + " (memory use : " + std::to_string (nChunkMemoryUsage + m_nMemoryUsage) + ")");
 
 		{
 			std::lock_guard<std::mutex> lockGuard(m_CacheMutex);
 
+			// If the entry already exists, remove it first (we'll update it)
+			removeEntryInternal(nTimeChunkIndex);
+
 			enforceMemoryQuotaInternal(nChunkMemoryUsage);
 
 			// Add new entry to the front of the list
@@ -493,7 +581,184 @@ namespace AMC {
 		return it->second->second;
 	}
 
+	bool CStateJournalStreamCache::isCachedOrLoadingInternal(uint32_t nTimeChunkIndex)
+	{
+		return (m_CacheMap.find(nTimeChunkIndex) != m_CacheMap.end()) || (m_LoadingChunks.find(nTimeChunkIndex) != m_LoadingChunks.end());
+	}
 
-}
+	PStateJournalStreamChunk_InMemory CStateJournalStreamCache::acquireEntry(uint32_t nTimeChunkIndex)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_CacheMutex);
+			while (true) {
+				auto it = m_CacheMap.find(nTimeChunkIndex);
+				if (it != m_CacheMap.end()) {
+					m_CacheList.splice(m_CacheList.begin(), m_CacheList, it->second);
+					return it->second->second;
+				}
+
+				if (m_LoadingChunks.find(nTimeChunkIndex) == m_LoadingChunks.end()) {
+					m_LoadingChunks.insert(nTimeChunkIndex);
+					break;
+				}
+
+				// Another thread loads this chunk. If the quota evicts it again before we look, we load it ourselves.
+				m_LoadingSignal.wait(lock);
+			}
+		}
 
+		PStateJournalStreamChunk_InMemory pEntry;
+		try {
+			pEntry = loadEntryFromJournal(nTimeChunkIndex);
+		}
+		catch (...) {
+			std::lock_guard<std::mutex> lockGuard(m_CacheMutex);
+			m_LoadingChunks.erase(nTimeChunkIndex);
+			m_LoadingSignal.notify_all();
+			throw;
+		}
+
+		std::lock_guard<std::mutex> lockGuard(m_CacheMutex);
+		m_LoadingChunks.erase(nTimeChunkIndex);
+		m_LoadingSignal.notify_all();
+
+		return pEntry;
+	}
+
+	void CStateJournalStreamCache::acquireEntries(const std::vector<uint32_t>& timeChunkIndices, std::vector<PStateJournalStreamChunk_InMemory>& entries)
+	{
+		entries.clear();
+		entries.resize(timeChunkIndices.size());
 
+		std::vector<size_t> missingEntries;
+		for (size_t nIndex = 0; nIndex < timeChunkIndices.size(); nIndex++) {
+			entries.at(nIndex) = retrieveEntry(timeChunkIndices.at(nIndex));
+			if (entries.at(nIndex).get() == nullptr)
+				missingEntries.push_back(nIndex);
+		}
+
+		runInParallel(missingEntries.size(), getWorkerThreadCount(missingEntries.size()), [&](size_t nTaskIndex, size_t nThreadIndex) {
+			size_t nIndex = missingEntries.at(nTaskIndex);
+			entries.at(nIndex) = acquireEntry(timeChunkIndices.at(nIndex));
+		});
+	}
+
+	void CStateJournalStreamCache::prefetchEntries(const std::vector<uint32_t>& timeChunkIndices)
+	{
+		std::vector<uint32_t> missingChunkIndices;
+		{
+			std::lock_guard<std::mutex> lockGuard(m_CacheMutex);
+			for (auto nTimeChunkIndex : timeChunkIndices) {
+				if (!isCachedOrLoadingInternal(nTimeChunkIndex))
+					missingChunkIndices.push_back(nTimeChunkIndex);
+			}
+		}
+
+		if (missingChunkIndices.empty())
+			return;
+
+		std::lock_guard<std::mutex> lockGuard(m_PrefetchMutex);
+		if (m_bPrefetchingStopped)
+			return;
+
+		for (auto nTimeChunkIndex : missingChunkIndices) {
+			if (std::find(m_PrefetchQueue.begin(), m_PrefetchQueue.end(), nTimeChunkIndex) == m_PrefetchQueue.end())
+				m_PrefetchQueue.push_back(nTimeChunkIndex);
+		}
+		while (m_PrefetchQueue.size() > STATEJOURNAL_MAXPREFETCHQUEUESIZE)
+			m_PrefetchQueue.pop_front();
+
+		if (!m_PrefetchThread.joinable())
+			m_PrefetchThread = std::thread(&CStateJournalStreamCache::prefetchThreadMain, this);
+
+		m_PrefetchSignal.notify_one();
+	}
+
+	void CStateJournalStreamCache::prefetchThreadMain()
+	{
+		while (true) {
+			uint32_t nTimeChunkIndex = 0;
+			{
+				std::unique_lock<std::mutex> lock(m_PrefetchMutex);
+				m_PrefetchSignal.wait(lock, [this] { return m_bPrefetchingStopped || !m_PrefetchQueue.empty(); });
+				if (m_bPrefetchingStopped)
+					return;
+
+				nTimeChunkIndex = m_PrefetchQueue.front();
+				m_PrefetchQueue.pop_front();
+			}
+
+			{
+				std::lock_guard<std::mutex> lockGuard(m_CacheMutex);
+				if (isCachedOrLoadingInternal(nTimeChunkIndex))
+					continue;
+			}
+
+			// Prefetching is only a hint. Errors are reported again when the chunk is actually requested.
+			try {
+				acquireEntry(nTimeChunkIndex);
+			}
+			catch (std::exception& E) {
+				if (m_pDebugLogger.get() != nullptr)
+					m_pDebugLogger->logMessage("could not prefetch journal chunk " + std::to_string(nTimeChunkIndex) + ": " + E.what(), "journal", eLogLevel::Debug);
+			}
+		}
+	}
+
+	void CStateJournalStreamCache::stopPrefetching()
+	{
+		{
+			std::lock_guard<std::mutex> lockGuard(m_PrefetchMutex);
+			m_bPrefetchingStopped = true;
+			m_PrefetchQueue.clear();
+		}
+		m_PrefetchSignal.notify_all();
+
+		if (m_PrefetchThread.joinable())
+			m_PrefetchThread.join();
+	}
+
+	size_t CStateJournalStreamCache::getWorkerThreadCount(size_t nTaskCount)
+	{
+		return std::min<size_t>(std::max<size_t>(std::thread::hardware_concurrency(), 1), nTaskCount);
+	}
+
+	void CStateJournalStreamCache::runInParallel(size_t nTaskCount, size_t nThreadCount, std::function<void(size_t nTaskIndex, size_t nThreadIndex)> Task)
+	{
+		if (nThreadCount <= 1) {
+			for (size_t nTaskIndex = 0; nTaskIndex < nTaskCount; nTaskIndex++)
+				Task(nTaskIndex, 0);
+			return;
+		}
+
+		std::atomic<size_t> nNextTask(0);
+		std::vector<std::exception_ptr> workerExceptions(nThreadCount);
+		std::vector<std::thread> workerThreads;
+
+		for (size_t nThreadIndex = 0; nThreadIndex < nThreadCount; nThreadIndex++) {
+			workerThreads.push_back(std::thread([&, nThreadIndex]() {
+				try {
+					while (true) {
+						size_t nTaskIndex = nNextTask.fetch_add(1);
+						if (nTaskIndex >= nTaskCount)
+							break;
+
+						Task(nTaskIndex, nThreadIndex);
+					}
+				}
+				catch (...) {
+					workerExceptions.at(nThreadIndex) = std::current_exception();
+				}
+			}));
+		}
+
+		for (auto& workerThread : workerThreads)
+			workerThread.join();
+
+		for (auto& pException : workerExceptions) {
+			if (pException)
+				std::rethrow_exception(pException);
+		}
+	}
+
+}
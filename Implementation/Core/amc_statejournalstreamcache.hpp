@@ -40,7 +40,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <map>
 #include <queue>
 #include <unordered_map>
+#include <set>
+#include <deque>
+#include <thread>
+#include <condition_variable>
+#include <functional>
 #include "amc_logger.hpp"
+#include "amc_statejournalaggregator.hpp"
 
 #include "Common/common_exportstream_native.hpp"
 #include "libmcdata_dynamic.hpp"
@@ -69,6 +75,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define STATEJOURNALSTORAGE_MAXENTRIESPERCHUNK (128UL * 1024UL * 1024UL)
 
+// Maximum number of chunks that wait for background loading. Older requests are dropped first.
+#define STATEJOURNAL_MAXPREFETCHQUEUESIZE 64
+
 
 namespace AMC {
 
@@ -112,6 +121,9 @@ namespace AMC {
 		virtual uint64_t getChunkIndex() = 0;
 
 		virtual int64_t sampleIntegerData(const uint32_t nStorageIndex, const uint64_t nAbsoluteTimeStampInMicroseconds) = 0;
+
+		// Adds all entries of each variable to the aggregator with the same list index.
+		virtual void aggregateIntegerEntries(const std::vector<uint32_t>& storageIndices, std::vector<PStateJournalBucketAggregator>& aggregators) = 0;
 		
 		void debugLog(const std::string & sDebugMessage);
 
@@ -156,6 +168,9 @@ namespace AMC {
 		// Retrieve the value for a given variable at a specific absolute timestamp
 		int64_t sampleIntegerData(const uint32_t nStorageIndex, const uint64_t nAbsoluteTimeStampInMicroseconds) override;
 
+		// Add the entries of the given variables to their aggregators
+		void aggregateIntegerEntries(const std::vector<uint32_t>& storageIndices, std::vector<PStateJournalBucketAggregator>& aggregators) override;
+
 		// Write a new value to the journal for a specific variable at a specific timestamp
 		void writeEntry(uint32_t nStorageIndex, uint64_t nAbsoluteTimeStampInMicroseconds, int64_t nValue);
 
@@ -198,6 +213,11 @@ namespace AMC {
 		
 		int64_t sampleIntegerData(const uint32_t nStorageIndex, const uint64_t nAbsoluteTimeStampInMicroseconds) override;
 
+		void aggregateIntegerEntries(const std::vector<uint32_t>& storageIndices, std::vector<PStateJournalBucketAggregator>& aggregators) override;
+
+		// Appends all entries of a variable with nStartTimeStampInMicroSeconds <= timestamp < nEndTimeStampInMicroSeconds.
+		void extractIntegerEntries(const uint32_t nStorageIndex, const uint64_t nStartTimeStampInMicroSeconds, const uint64_t nEndTimeStampInMicroSeconds, std::vector<sJournalTimeStreamInt64Entry>& entries);
+
 		uint64_t getMemoryUsage();
 
 	};
@@ -224,6 +244,8 @@ namespace AMC {
 
 		int64_t sampleIntegerData(const uint32_t nStorageIndex, const uint64_t nAbsoluteTimeStampInMicroseconds);
 
+		void aggregateIntegerEntries(const std::vector<uint32_t>& storageIndices, std::vector<PStateJournalBucketAggregator>& aggregators);
+
 	};
 
 
@@ -249,6 +271,22 @@ namespace AMC {
 		// Hash map to store the mapping from time chunk index to list iterator
 		std::unordered_map<uint32_t, std::list<std::pair<uint32_t, PStateJournalStreamChunk_InMemory>>::iterator> m_CacheMap;
 
+		// Chunks that are currently being loaded. Other threads wait for them instead of decoding them twice (protected by m_CacheMutex)
+		std::set<uint32_t> m_LoadingChunks;
+		std::condition_variable m_LoadingSignal;
+
+		// Background loading of chunks that are likely to be requested next
+		std::mutex m_PrefetchMutex;
+		std::condition_variable m_PrefetchSignal;
+		std::deque<uint32_t> m_PrefetchQueue;
+		std::thread m_PrefetchThread;
+		bool m_bPrefetchingStopped;
+
+		void prefetchThreadMain();
+
+		// Returns if a chunk is cached or being loaded (no mutex protection)
+		bool isCachedOrLoadingInternal(uint32_t nTimeChunkIndex);
+
 		// Enforces the memory quota (no mutex protection)
 		void enforceMemoryQuotaInternal(uint64_t nAdditionalMemory);
 
@@ -274,6 +312,26 @@ namespace AMC {
 
 		virtual PStateJournalStreamChunk_InMemory loadEntryFromJournal(uint32_t nTimeChunkIndex) = 0;
 
+		// Returns the cached entry or loads it. Concurrent requests for the same chunk load it only once.
+		PStateJournalStreamChunk_InMemory acquireEntry(uint32_t nTimeChunkIndex);
+
+		// Acquires the entries of several chunks in the given order, loading missing chunks in parallel.
+		// The returned entries stay valid even if the memory quota evicts them from the cache in the meantime.
+		void acquireEntries(const std::vector<uint32_t>& timeChunkIndices, std::vector<PStateJournalStreamChunk_InMemory>& entries);
+
+		// Queues chunks for loading on a background thread. Chunks that are cached or being loaded are skipped.
+		// loadEntryFromJournal must be safe to call concurrently to use this.
+		void prefetchEntries(const std::vector<uint32_t>& timeChunkIndices);
+
+		// Stops background loading. Subclasses MUST call this in their destructor, as the prefetch thread calls loadEntryFromJournal.
+		void stopPrefetching();
+
+		// Returns the number of worker threads to use for nTaskCount independent tasks.
+		static size_t getWorkerThreadCount(size_t nTaskCount);
+
+		// Runs Task(nTaskIndex, nThreadIndex) for all tasks on nThreadCount threads and rethrows the first exception.
+		static void runInParallel(size_t nTaskCount, size_t nThreadCount, std::function<void(size_t nTaskIndex, size_t nThreadIndex)> Task);
+
 	};
 
 
@@ -30,6 +30,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include "amc_statemachinedata.hpp"
+#include "amc_parametergroup.hpp"
 #include "libmc_exceptiontypes.hpp"
 
 #include "common_utils.hpp"
@@ -98,6 +99,9 @@ namespace AMC {
 
 	std::string CStateMachineData::getInstanceStateName(const std::string& sInstanceName)
 	{
+		// State changes carry no change counter, so anything derived from them must not be cached.
+		CParameterReadRecording::recordUntrackedRead();
+
 		std::lock_guard<std::mutex> lockGuard(m_Mutex);
 		auto iIter = m_StateMachineStates.find(sInstanceName);
 		if (iIter != m_StateMachineStates.end())
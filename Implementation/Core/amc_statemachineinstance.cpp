@@ -31,6 +31,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "amc_statemachineinstance.hpp"
 #include "amc_statemachinedata.hpp"
+#include "amc_statesignalhandler.hpp"
 
 #include "libmc_exceptiontypes.hpp"
 
@@ -46,7 +47,7 @@ namespace AMC {
 
 	CStateMachineInstance::CStateMachineInstance(const std::string& sName, const std::string& sDescription, LibMCEnv::PLibMCEnvWrapper pEnvironmentWrapper, AMC::PSystemState pSystemState, AMC::PStateJournal pStateJournal)
 		: m_sName(sName), m_pEnvironmentWrapper(pEnvironmentWrapper), m_pSystemState(pSystemState), m_pStateJournal (pStateJournal),
-		m_nAbsoluteEndTimeOfPreviousStateInMicroseconds(0)
+		m_nAbsoluteEndTimeOfPreviousStateInMicroseconds(0), m_bSignalWakeRequested(false)
 	{
 		LibMCAssertNotNull(pEnvironmentWrapper.get());
 		LibMCAssertNotNull(pSystemState.get());
@@ -69,6 +70,7 @@ namespace AMC {
 		m_ParameterHandler = nullptr;
 		m_pStateJournal = nullptr;
 		m_pEnvironmentWrapper = nullptr;
+		m_pScheduler = nullptr;
 
 		m_States.clear();
 		m_StateList.clear();
@@ -216,6 +218,15 @@ namespace AMC {
 
 	}
 
+	void CStateMachineInstance::setScheduler(PStateMachineScheduler pScheduler)
+	{
+		// Only accessible if thread is not running
+		if (threadIsRunning())
+			throw ELibMCCustomException(LIBMC_ERROR_THREADISRUNNING, m_sName);
+
+		m_pScheduler = pScheduler;
+	}
+
 	void CStateMachineInstance::executeStep()
 	{
 		if (!hasCurrentStateInternal ())
@@ -267,6 +278,46 @@ namespace AMC {
 	}
 
 
+	uint64_t CStateMachineInstance::executeScheduledStep()
+	{
+		if (threadShallTerminate())
+			return AMC_STATEMACHINESCHEDULER_TASKFINISHED;
+
+		if (!hasCurrentStateInternal()) {
+			m_pSystemState->logger()->logMessage("scheduled step error: instance has no current state", m_sName, eLogLevel::CriticalError);
+			return AMC_STATEMACHINESCHEDULER_TASKFINISHED;
+		}
+
+		try {
+			// Do not block the worker while the repeat delay has not passed, unless a signal has arrived
+			bool bSignalWakeRequested = m_bSignalWakeRequested.exchange(false);
+			uint64_t nRemainingDelayInMicroseconds = m_pCurrentState->getRemainingExecutionDelayInMicroseconds();
+			if ((nRemainingDelayInMicroseconds > 0) && !bSignalWakeRequested)
+				return nRemainingDelayInMicroseconds;
+
+			executeStep();
+
+			if (hasCurrentStateInternal())
+				return m_pCurrentState->getRemainingExecutionDelayInMicroseconds();
+		}
+		catch (std::exception& E) {
+			m_pSystemState->logger()->logMessage("scheduled step error: " + std::string(E.what()), m_sName, eLogLevel::CriticalError);
+			return AMC_STATEMACHINEINSTANCE_SCHEDULERERRORDELAY_US;
+		}
+
+		return 0;
+	}
+
+	void CStateMachineInstance::wakeUpForSignal()
+	{
+		if (m_pScheduler.get() == nullptr)
+			return;
+
+		m_bSignalWakeRequested = true;
+		m_pScheduler->wakeTask(this);
+	}
+
+
 	void CStateMachineInstance::startThread()
 	{
 		m_pSystemState->logger()->logMessage("starting instance thread for " + m_sName + "...", m_sName, eLogLevel::Message);
@@ -284,8 +335,15 @@ namespace AMC {
 		m_TerminateSignal = std::promise<void>();
 		m_TerminateFuture = m_TerminateSignal.get_future();
 		
-		// Start Thread
-		m_Thread = std::thread(&CStateMachineInstance::executeThread, this);
+		if (m_pScheduler.get() != nullptr) {
+			m_bSignalWakeRequested = false;
+			m_pSystemState->stateSignalHandler()->setSignalQueueListener(m_sName, [this]() { wakeUpForSignal(); });
+			m_pScheduler->addTask(this);
+		}
+		else {
+			// Start Thread
+			m_Thread = std::thread(&CStateMachineInstance::executeThread, this);
+		}
 
 	}
 
@@ -329,8 +387,14 @@ namespace AMC {
 		// Set termination flag
 		m_TerminateSignal.set_value();
 
-		// Wait for thread to finish
-		m_Thread.join();
+		// Wait for thread or scheduled step to finish
+		if (m_pScheduler.get() != nullptr) {
+			m_pSystemState->stateSignalHandler()->clearSignalQueueListener(m_sName);
+			m_pScheduler->removeTask(this);
+		}
+		else {
+			m_Thread.join();
+		}
 
 		m_pSystemState->logger()->logMessage("instance thread terminated", m_sName, eLogLevel::Message);
 
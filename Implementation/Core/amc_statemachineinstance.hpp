@@ -38,6 +38,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "amc_logger.hpp"
 #include "amc_parameterhandler.hpp"
 #include "amc_statejournal.hpp"
+#include "amc_statemachinescheduler.hpp"
 
 #include "common_chrono.hpp"
 
@@ -45,6 +46,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <string>
 #include <thread>
 #include <future>
+#include <atomic>
+
+// Delay before a scheduled step is retried after an error outside of the state execution
+#define AMC_STATEMACHINEINSTANCE_SCHEDULERERRORDELAY_US 100000
 
 namespace AMC {
 	
@@ -52,7 +57,7 @@ namespace AMC {
 	typedef std::shared_ptr<CStateMachineInstance> PStateMachineInstance;
 
 
-	class CStateMachineInstance {
+	class CStateMachineInstance : public CStateMachineSchedulerTask {
 	private:
 
 		// Functions in thread context
@@ -75,6 +80,12 @@ namespace AMC {
 		std::promise<void> m_TerminateSignal;
 		std::future<void> m_TerminateFuture;
 
+		// If set, steps are executed by the scheduler instead of a dedicated thread
+		PStateMachineScheduler m_pScheduler;
+
+		// Set by the signal handler if a signal for this instance has been queued
+		std::atomic<bool> m_bSignalWakeRequested;
+
 		uint64_t m_nAbsoluteEndTimeOfPreviousStateInMicroseconds;
 		std::string m_sPreviousState;
 
@@ -107,7 +118,8 @@ namespace AMC {
 		void setFailedState(std::string sStateName);
 		void setSuccessState(std::string sStateName);
 
-		void setStateFactory (LibMCPlugin::PStateFactory pStateFactory);		
+		void setStateFactory (LibMCPlugin::PStateFactory pStateFactory);
+		void setScheduler (PStateMachineScheduler pScheduler);		
 		PStateMachineState addState(std::string sStateName, uint32_t nRepeatDelayInMS);
 		PStateMachineState findState(std::string sStateName, bool bFailIfNotExisting);
 
@@ -125,6 +137,12 @@ namespace AMC {
 		void startThread();
 		void terminateThread();
 
+		// Scheduler callback, only called by the scheduler worker that owns the instance
+		uint64_t executeScheduledStep() override;
+
+		// Executes the next scheduled step without waiting for the repeat delay of the current state.
+		void wakeUpForSignal();
+
 		std::string getCurrentStateName ();
 		bool currentStateIsSuccessState();
 		bool currentStateIsFailureState();
@@ -0,0 +1,277 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "amc_statemachinescheduler.hpp"
+
+#include "libmc_exceptiontypes.hpp"
+
+namespace AMC {
+
+	// Scheduler of the worker that runs on the current thread, if any
+	static thread_local CStateMachineScheduler* s_pCurrentScheduler = nullptr;
+
+	CStateMachineScheduler::CStateMachineScheduler(uint32_t nWorkerCount)
+		: m_nTimerSequence (0), m_bShallTerminate (false), m_nWorkerCount (nWorkerCount), m_nRunningWorkerCount (0), m_nBlockedWorkerCount (0)
+	{
+		if ((nWorkerCount < AMC_STATEMACHINESCHEDULER_MINWORKERCOUNT) || (nWorkerCount > AMC_STATEMACHINESCHEDULER_MAXWORKERCOUNT))
+			throw ELibMCCustomException(LIBMC_ERROR_INVALIDSCHEDULERWORKERCOUNT, std::to_string (nWorkerCount));
+
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+		m_Workers.reserve(nWorkerCount);
+		for (uint32_t nIndex = 0; nIndex < nWorkerCount; nIndex++)
+			m_Workers.push_back(std::thread(&CStateMachineScheduler::executeWorker, this));
+	}
+
+	CStateMachineScheduler::~CStateMachineScheduler()
+	{
+		shutdown();
+	}
+
+	uint32_t CStateMachineScheduler::getWorkerCount()
+	{
+		return m_nWorkerCount;
+	}
+
+	void CStateMachineScheduler::addTask(CStateMachineSchedulerTask* pTask)
+	{
+		LibMCAssertNotNull(pTask);
+
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+		uint64_t nGeneration = 1;
+		auto iter = m_Tasks.find(pTask);
+		if (iter != m_Tasks.end()) {
+			if (!iter->second.m_bIsRemoved)
+				throw ELibMCInterfaceException(LIBMC_ERROR_DUPLICATESCHEDULERTASK);
+			nGeneration = iter->second.m_nGeneration + 1;
+			m_Tasks.erase(iter);
+		}
+
+		sTaskEntry& taskEntry = m_Tasks[pTask];
+		taskEntry.m_nGeneration = nGeneration;
+		taskEntry.m_nTimerSequence = 0;
+		taskEntry.m_bIsExecuting = false;
+		taskEntry.m_bIsRemoved = false;
+		taskEntry.m_bWakeRequested = false;
+
+		scheduleInternal(pTask, taskEntry, std::chrono::steady_clock::now());
+	}
+
+	void CStateMachineScheduler::removeTask(CStateMachineSchedulerTask* pTask)
+	{
+		LibMCAssertNotNull(pTask);
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+
+		auto iter = m_Tasks.find(pTask);
+		if (iter == m_Tasks.end())
+			return;
+
+		iter->second.m_bIsRemoved = true;
+		m_TaskFinishedCondition.wait(lock, [this, pTask] {
+			auto iter = m_Tasks.find(pTask);
+			return (iter == m_Tasks.end()) || (!iter->second.m_bIsExecuting);
+		});
+
+		// Keep the entry while a timer refers to it, so that a stale timer is not mistaken for a re-added task
+		iter = m_Tasks.find(pTask);
+		if (iter != m_Tasks.end())
+			iter->second.m_nGeneration++;
+	}
+
+	void CStateMachineScheduler::wakeTask(CStateMachineSchedulerTask* pTask)
+	{
+		LibMCAssertNotNull(pTask);
+
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+		auto iter = m_Tasks.find(pTask);
+		if ((iter == m_Tasks.end()) || iter->second.m_bIsRemoved)
+			return;
+
+		if (iter->second.m_bIsExecuting)
+			iter->second.m_bWakeRequested = true;
+		else
+			scheduleInternal(pTask, iter->second, std::chrono::steady_clock::now());
+	}
+
+	void CStateMachineScheduler::scheduleInternal(CStateMachineSchedulerTask* pTask, sTaskEntry& taskEntry, std::chrono::steady_clock::time_point dueTime)
+	{
+		sTimerEntry timerEntry;
+		timerEntry.m_DueTime = dueTime;
+		timerEntry.m_nSequence = m_nTimerSequence++;
+		timerEntry.m_nGeneration = taskEntry.m_nGeneration;
+		timerEntry.m_pTask = pTask;
+
+		taskEntry.m_nTimerSequence = timerEntry.m_nSequence;
+
+		bool bIsNewFirstTimer = m_Timers.empty() || (dueTime < m_Timers.top().m_DueTime);
+		m_Timers.push(timerEntry);
+
+		// Only the worker that waits for the earliest timer needs to re-evaluate
+		if (bIsNewFirstTimer)
+			m_TimerCondition.notify_one();
+	}
+
+	void CStateMachineScheduler::executeWorker()
+	{
+		s_pCurrentScheduler = this;
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+
+		while (!m_bShallTerminate) {
+
+			// Workers beyond the worker count only take over while other workers are blocked
+			if (m_Timers.empty() || (m_nRunningWorkerCount >= m_nWorkerCount)) {
+				m_TimerCondition.wait(lock);
+				continue;
+			}
+
+			sTimerEntry timerEntry = m_Timers.top();
+			if (timerEntry.m_DueTime > std::chrono::steady_clock::now()) {
+				m_TimerCondition.wait_until(lock, timerEntry.m_DueTime);
+				continue;
+			}
+
+			m_Timers.pop();
+
+			// Another worker may now wait for the next timer
+			if (!m_Timers.empty())
+				m_TimerCondition.notify_one();
+
+			auto iter = m_Tasks.find(timerEntry.m_pTask);
+			if (iter == m_Tasks.end())
+				continue;
+			if (iter->second.m_bIsRemoved || (iter->second.m_nGeneration != timerEntry.m_nGeneration) || (iter->second.m_nTimerSequence != timerEntry.m_nSequence))
+				continue;
+
+			CStateMachineSchedulerTask* pTask = timerEntry.m_pTask;
+			iter->second.m_bIsExecuting = true;
+			iter->second.m_bWakeRequested = false;
+			m_nRunningWorkerCount++;
+
+			uint64_t nDelayInMicroseconds = 0;
+			lock.unlock();
+			try {
+				nDelayInMicroseconds = pTask->executeScheduledStep();
+			}
+			catch (...) {
+				// Tasks handle their errors themselves. Retrying a failing step would only keep the worker busy.
+				nDelayInMicroseconds = AMC_STATEMACHINESCHEDULER_TASKFINISHED;
+			}
+			auto currentTime = std::chrono::steady_clock::now();
+			lock.lock();
+
+			m_nRunningWorkerCount--;
+			m_TimerCondition.notify_one();
+
+			iter = m_Tasks.find(pTask);
+			if (iter != m_Tasks.end()) {
+				iter->second.m_bIsExecuting = false;
+
+				if (nDelayInMicroseconds == AMC_STATEMACHINESCHEDULER_TASKFINISHED)
+					iter->second.m_bIsRemoved = true;
+
+				if (iter->second.m_bIsRemoved) {
+					m_TaskFinishedCondition.notify_all();
+				}
+				else {
+					auto dueTime = currentTime;
+					if (!iter->second.m_bWakeRequested)
+						dueTime += std::chrono::microseconds(nDelayInMicroseconds);
+					iter->second.m_bWakeRequested = false;
+
+					scheduleInternal(pTask, iter->second, dueTime);
+				}
+			}
+
+		}
+	}
+
+	void CStateMachineScheduler::beginBlockingSection()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+		m_nRunningWorkerCount--;
+		m_nBlockedWorkerCount++;
+
+		// Start another worker if all existing workers are busy
+		size_t nIdleWorkerCount = m_Workers.size() - m_nRunningWorkerCount - m_nBlockedWorkerCount;
+		if ((nIdleWorkerCount == 0) && (!m_bShallTerminate) && (m_Workers.size() < AMC_STATEMACHINESCHEDULER_MAXWORKERCOUNT))
+			m_Workers.push_back(std::thread(&CStateMachineScheduler::executeWorker, this));
+
+		m_TimerCondition.notify_one();
+	}
+
+	void CStateMachineScheduler::endBlockingSection()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+		m_nBlockedWorkerCount--;
+		m_nRunningWorkerCount++;
+	}
+
+	void CStateMachineScheduler::shutdown()
+	{
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			m_bShallTerminate = true;
+		}
+		m_TimerCondition.notify_all();
+
+		// No workers are started after the termination flag has been set
+		for (auto& worker : m_Workers) {
+			if (worker.joinable())
+				worker.join();
+		}
+
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		m_Tasks.clear();
+		m_Timers = decltype(m_Timers)();
+		m_TaskFinishedCondition.notify_all();
+	}
+
+
+	CStateMachineSchedulerBlockingSection::CStateMachineSchedulerBlockingSection()
+		: m_pScheduler (s_pCurrentScheduler)
+	{
+		if (m_pScheduler != nullptr)
+			m_pScheduler->beginBlockingSection();
+	}
+
+	CStateMachineSchedulerBlockingSection::~CStateMachineSchedulerBlockingSection()
+	{
+		if (m_pScheduler != nullptr)
+			m_pScheduler->endBlockingSection();
+	}
+
+}
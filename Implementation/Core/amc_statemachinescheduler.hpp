@@ -0,0 +1,168 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMC_STATEMACHINESCHEDULER
+#define __AMC_STATEMACHINESCHEDULER
+
+#include <memory>
+#include <vector>
+#include <map>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cstdint>
+
+#define AMC_STATEMACHINESCHEDULER_MINWORKERCOUNT 1
+#define AMC_STATEMACHINESCHEDULER_MAXWORKERCOUNT 256
+#define AMC_STATEMACHINESCHEDULER_DEFAULTWORKERCOUNT 4
+
+// Return value of executeScheduledStep that ends the task. The task is not executed again until it is added again.
+#define AMC_STATEMACHINESCHEDULER_TASKFINISHED UINT64_MAX
+
+namespace AMC {
+
+	class CStateMachineSchedulerTask;
+	class CStateMachineScheduler;
+	typedef std::shared_ptr<CStateMachineScheduler> PStateMachineScheduler;
+
+	// A unit of work that is executed step by step by the scheduler.
+	class CStateMachineSchedulerTask {
+	public:
+
+		virtual ~CStateMachineSchedulerTask() {}
+
+		// Executes at most one step. Returns the time in microseconds to wait before the next call,
+		// or AMC_STATEMACHINESCHEDULER_TASKFINISHED. An exception that escapes a step ends the task as well.
+		virtual uint64_t executeScheduledStep() = 0;
+
+	};
+
+	// Executes tasks on a fixed number of worker threads.
+	// A task is either waiting for its due time, queued or executed by exactly one worker,
+	// so that the steps of one task never run concurrently and are always executed in order.
+	// A step that blocks inside a blocking section does not count against the worker count,
+	// another worker takes over the remaining tasks in the meantime.
+	class CStateMachineScheduler {
+	private:
+
+		typedef struct _sTaskEntry {
+			uint64_t m_nGeneration;
+			// Sequence of the only timer that may execute the task, older timers are stale
+			uint64_t m_nTimerSequence;
+			bool m_bIsExecuting;
+			bool m_bIsRemoved;
+			bool m_bWakeRequested;
+		} sTaskEntry;
+
+		typedef struct _sTimerEntry {
+			std::chrono::steady_clock::time_point m_DueTime;
+			uint64_t m_nSequence;
+			uint64_t m_nGeneration;
+			CStateMachineSchedulerTask* m_pTask;
+
+			bool operator>(const _sTimerEntry& other) const
+			{
+				if (m_DueTime != other.m_DueTime)
+					return m_DueTime > other.m_DueTime;
+				return m_nSequence > other.m_nSequence;
+			}
+		} sTimerEntry;
+
+		std::mutex m_Mutex;
+		std::condition_variable m_TimerCondition;
+		std::condition_variable m_TaskFinishedCondition;
+
+		std::map<CStateMachineSchedulerTask*, sTaskEntry> m_Tasks;
+		std::priority_queue<sTimerEntry, std::vector<sTimerEntry>, std::greater<sTimerEntry>> m_Timers;
+		uint64_t m_nTimerSequence;
+
+		std::vector<std::thread> m_Workers;
+		bool m_bShallTerminate;
+
+		uint32_t m_nWorkerCount;
+		// Workers that execute a step outside of a blocking section
+		uint32_t m_nRunningWorkerCount;
+		// Workers that execute a step inside a blocking section
+		uint32_t m_nBlockedWorkerCount;
+
+		void scheduleInternal(CStateMachineSchedulerTask* pTask, sTaskEntry& taskEntry, std::chrono::steady_clock::time_point dueTime);
+
+		void executeWorker();
+
+		void beginBlockingSection();
+
+		void endBlockingSection();
+
+		friend class CStateMachineSchedulerBlockingSection;
+
+	public:
+
+		CStateMachineScheduler(uint32_t nWorkerCount);
+
+		virtual ~CStateMachineScheduler();
+
+		uint32_t getWorkerCount();
+
+		// Adds a task that is executed immediately. The task must stay alive until removeTask returns.
+		void addTask(CStateMachineSchedulerTask* pTask);
+
+		// Removes a task. Waits until a step that is currently executed has finished.
+		void removeTask(CStateMachineSchedulerTask* pTask);
+
+		// Executes the next step of a task immediately instead of at its due time.
+		// If a step of the task is currently executed, the next step follows without delay.
+		void wakeTask(CStateMachineSchedulerTask* pTask);
+
+		// Stops all workers. Tasks are not executed anymore afterwards.
+		void shutdown();
+
+	};
+
+	// Marks a blocking wait in the current step. While the section exists, the step does not occupy one of the
+	// workers of the scheduler. Has no effect on threads that are not scheduler workers.
+	class CStateMachineSchedulerBlockingSection {
+	private:
+		CStateMachineScheduler* m_pScheduler;
+
+	public:
+		CStateMachineSchedulerBlockingSection();
+		~CStateMachineSchedulerBlockingSection();
+
+		CStateMachineSchedulerBlockingSection(const CStateMachineSchedulerBlockingSection&) = delete;
+		CStateMachineSchedulerBlockingSection& operator=(const CStateMachineSchedulerBlockingSection&) = delete;
+	};
+
+}
+
+
+#endif //__AMC_STATEMACHINESCHEDULER
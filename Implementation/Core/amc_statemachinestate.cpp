@@ -89,6 +89,21 @@ namespace AMC {
 	}
 
 
+	uint64_t CStateMachineState::getRemainingExecutionDelayInMicroseconds()
+	{
+		uint64_t nExecutionTimeInMicroSeconds = m_pGlobalChrono->getUTCTimeStampInMicrosecondsSince1970();
+		if (m_LastExecutionTimeStampInMicroseconds > nExecutionTimeInMicroSeconds)
+			throw ELibMCCustomException(LIBMC_ERROR_INVALIDEXECUTIONDELAY, std::to_string(m_LastExecutionTimeStampInMicroseconds));
+
+		uint64_t nDeltaExecutionTimeInMicroSeconds = nExecutionTimeInMicroSeconds - m_LastExecutionTimeStampInMicroseconds;
+		uint64_t nRepeatDelayInMicroSeconds = m_nRepeatDelay * 1000ULL;
+		if (nDeltaExecutionTimeInMicroSeconds >= nRepeatDelayInMicroSeconds)
+			return 0;
+
+		return nRepeatDelayInMicroSeconds - nDeltaExecutionTimeInMicroSeconds;
+	}
+
+
 	void CStateMachineState::addOutState(PStateMachineState pState)
 	{
 		LibMCAssertNotNull(pState.get());
@@ -85,6 +85,9 @@ namespace AMC {
 
 		void setPluginState(LibMCPlugin::PState pPluginState);
 
+		// Returns the time until the repeat delay since the last execution has passed.
+		uint64_t getRemainingExecutionDelayInMicroseconds();
+
 		void execute(std::string& sNextState, PSystemState pSystemState, PParameterHandler pParameterHandler, uint64_t nAbsoluteEndTimeOfPreviousStateInMicroseconds, const std::string& sPreviousStateName);
 
 	};
@@ -41,6 +41,7 @@ namespace AMC {
 	
 	
 	CStateSignalHandler::CStateSignalHandler()
+		: m_nSignalChangeCounter (0)
 	{
 	}
 	
@@ -80,19 +81,68 @@ namespace AMC {
 
 		std::string sNormalizedUUID = AMCCommon::CUtils::normalizeUUIDString(sSignalUUID);
 		
-		std::lock_guard<std::mutex> lockGuard(m_SignalUUIDMapMutex);
+		{
+			std::lock_guard<std::mutex> lockGuard(m_SignalUUIDMapMutex);
 
-		auto iUUIDIter = m_SignalUUIDLookupMap.find(sNormalizedUUID);
-		if (iUUIDIter != m_SignalUUIDLookupMap.end())
-			throw ELibMCCustomException(LIBMC_ERROR_SIGNALALREADYTRIGGERED, sNormalizedUUID);
+			auto iUUIDIter = m_SignalUUIDLookupMap.find(sNormalizedUUID);
+			if (iUUIDIter != m_SignalUUIDLookupMap.end())
+				throw ELibMCCustomException(LIBMC_ERROR_SIGNALALREADYTRIGGERED, sNormalizedUUID);
 
+			if (!pSlot->addNewInQueueSignalInternal(sNormalizedUUID, sParameterData, nResponseTimeOutInMS))
+				return false;
 
-		if (pSlot->addNewInQueueSignalInternal (sNormalizedUUID, sParameterData, nResponseTimeOutInMS)) {
 			m_SignalUUIDLookupMap.insert(std::make_pair(sNormalizedUUID, pSlot));
-			return true;
 		}
 
-		return false;
+		notifySignalChange();
+
+		{
+			std::lock_guard<std::mutex> lockGuard(m_SignalQueueListenerMutex);
+			auto iListenerIter = m_SignalQueueListeners.find(sInstanceName);
+			if (iListenerIter != m_SignalQueueListeners.end())
+				iListenerIter->second();
+		}
+
+		return true;
+	}
+
+	void CStateSignalHandler::setSignalQueueListener(const std::string& sInstanceName, std::function<void()> listenerFunction)
+	{
+		if (!listenerFunction)
+			throw ELibMCCustomException(LIBMC_ERROR_INVALIDPARAM, sInstanceName);
+
+		std::lock_guard<std::mutex> lockGuard(m_SignalQueueListenerMutex);
+		m_SignalQueueListeners[sInstanceName] = listenerFunction;
+	}
+
+	void CStateSignalHandler::clearSignalQueueListener(const std::string& sInstanceName)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_SignalQueueListenerMutex);
+		m_SignalQueueListeners.erase(sInstanceName);
+	}
+
+
+	void CStateSignalHandler::notifySignalChange()
+	{
+		{
+			std::lock_guard<std::mutex> lockGuard(m_SignalChangeMutex);
+			m_nSignalChangeCounter++;
+		}
+		m_SignalChangeCondition.notify_all();
+	}
+
+	uint64_t CStateSignalHandler::getSignalChangeCounter()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_SignalChangeMutex);
+		return m_nSignalChangeCounter;
+	}
+
+	void CStateSignalHandler::waitForSignalChange(uint64_t nSignalChangeCounter, uint32_t nMaxWaitInMS)
+	{
+		std::unique_lock<std::mutex> lock(m_SignalChangeMutex);
+		m_SignalChangeCondition.wait_for(lock, std::chrono::milliseconds(nMaxWaitInMS), [this, nSignalChangeCounter] {
+			return m_nSignalChangeCounter != nSignalChangeCounter;
+		});
 	}
 
 
@@ -213,6 +263,7 @@ namespace AMC {
 			throw ELibMCCustomException(LIBMC_ERROR_SIGNALNOTFOUND, "signal not found while changing phase to handled (" + sNormalizedUUID + ")");
 
 		iter->second->changeSignalPhaseToHandledInternal(sNormalizedUUID, sResultData);
+		notifySignalChange();
 	}
 
 	void CStateSignalHandler::changeSignalPhaseToInProcess(const std::string& sSignalUUID)
@@ -239,6 +290,7 @@ namespace AMC {
 			throw ELibMCCustomException(LIBMC_ERROR_SIGNALNOTFOUND, "signal not found while changing phase to failed (" + sNormalizedUUID + ")");
 
 		iter->second->changeSignalPhaseToInFailedInternal(sNormalizedUUID, sResultData, sErrorMessage);
+		notifySignalChange();
 	}
 
 	AMC::eAMCSignalPhase CStateSignalHandler::getSignalPhase(const std::string& sSignalUUID)
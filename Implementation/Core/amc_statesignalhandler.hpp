@@ -37,6 +37,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <map>
 #include <list>
 #include <mutex>
+#include <condition_variable>
+#include <functional>
 #include <unordered_map>
 
 #include "amc_statesignalparameter.hpp"
@@ -61,6 +63,17 @@ namespace AMC {
 		std::mutex m_SignalMapMutex;
 		std::mutex m_SignalUUIDMapMutex;
 
+		// Counts queued signals and phase changes, so that waiting states do not need to poll
+		std::mutex m_SignalChangeMutex;
+		std::condition_variable m_SignalChangeCondition;
+		uint64_t m_nSignalChangeCounter;
+
+		void notifySignalChange();
+
+		// Called when a signal has been queued for an instance, so that a scheduled instance does not need to wait for its repeat delay
+		std::mutex m_SignalQueueListenerMutex;
+		std::map<std::string, std::function<void()>> m_SignalQueueListeners;
+
 	public:
 
 		CStateSignalHandler();
@@ -102,6 +115,16 @@ namespace AMC {
 
 		std::string getResultDataJSON(const std::string& sSignalUUID);
 
+		uint64_t getSignalChangeCounter();
+
+		void setSignalQueueListener(const std::string& sInstanceName, std::function<void()> listenerFunction);
+
+		// Returns after a listener call that is currently executed has finished.
+		void clearSignalQueueListener(const std::string& sInstanceName);
+
+		// Waits until the change counter differs from nSignalChangeCounter or the wait time has passed.
+		void waitForSignalChange(uint64_t nSignalChangeCounter, uint32_t nMaxWaitInMS);
+
 		void populateParameterGroup(const std::string& sInstanceName, const std::string& sSignalName, CParameterGroup * pParameterGroup);
 
 		void populateResultGroup(const std::string& sInstanceName, const std::string& sSignalName, CParameterGroup* pResultGroup);
@@ -35,7 +35,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <memory>
 #include <string>
 
-#define AMC_SIGNAL_DEFAULT_WAITFOR_SLEEP_MS 1
+// Upper bound for a single wait on signal changes, so that waiting states still check for termination
+#define AMC_SIGNAL_MAXWAITFORCHANGE_MS 10
 
 #define AMC_SIGNAL_MINQUEUESIZE 1
 #define AMC_SIGNAL_MAXQUEUESIZE 1024
@@ -44,11 +44,18 @@ namespace AMC {
 	}
 
 	CUserInformation::CUserInformation(const std::string& sUUID, const std::string& sLogin, const std::string& sDescription, const std::string& sRoleIdentifier, const std::string& sLanguageIdentifier)
+		: CUserInformation (sUUID, sLogin, sDescription, sRoleIdentifier, sLanguageIdentifier, nullptr)
+	{
+
+	}
+
+	CUserInformation::CUserInformation(const std::string& sUUID, const std::string& sLogin, const std::string& sDescription, const std::string& sRoleIdentifier, const std::string& sLanguageIdentifier, PAccessRole pRole)
 		: m_sUUID(AMCCommon::CUtils::normalizeUUIDString(sUUID)),
 		m_sLogin (sLogin),
 		m_sDescription (sDescription),
 		m_sRoleIdentifier (sRoleIdentifier),
-		m_sLanguageIdentifier (sLanguageIdentifier)
+		m_sLanguageIdentifier (sLanguageIdentifier),
+		m_pRole (pRole)
 	{
 
 	}
@@ -83,6 +90,11 @@ namespace AMC {
 		return m_sLanguageIdentifier;
 	}
 
+	PAccessRole CUserInformation::getRole()
+	{
+		return m_pRole;
+	}
+
 }
 
 
@@ -40,6 +40,9 @@ namespace AMC {
 	class CUserInformation;
 	typedef std::shared_ptr<CUserInformation> PUserInformation;
 
+	class CAccessRole;
+	typedef std::shared_ptr<CAccessRole> PAccessRole;
+
 
 	class CUserInformation {
 	private:
@@ -49,12 +52,16 @@ namespace AMC {
 		std::string m_sDescription;
 		std::string m_sRoleIdentifier;
 		std::string m_sLanguageIdentifier;
+
+		PAccessRole m_pRole;
 	
 	public:
 
 		static PUserInformation makeEmpty();
 
 		CUserInformation(const std::string& sUUID, const std::string& sLogin, const std::string& sDescription, const std::string& sRoleIdentifier, const std::string& sLanguageIdentifier);
+
+		CUserInformation(const std::string& sUUID, const std::string& sLogin, const std::string& sDescription, const std::string& sRoleIdentifier, const std::string& sLanguageIdentifier, PAccessRole pRole);
 		
 		virtual ~CUserInformation();
 		
@@ -68,6 +75,9 @@ namespace AMC {
 
 		std::string getLanguageIdentifier ();
 
+		// Resolved role of the user, or null if it has not been resolved at login.
+		PAccessRole getRole ();
+
 	};
 
 	
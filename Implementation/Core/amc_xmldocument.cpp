@@ -58,7 +58,7 @@ void CXMLDocumentInstance::createEmptyDocument(const std::string& sRootNodeName,
 		throw ELibMCCustomException(LIBMC_ERROR_INVALIDXMLROOTNODENAME, sRootNodeName);
 
 	m_pDefaultNameSpace = registerNamespaceEx(sDefaultNamespace, "");
-	m_pRootNodeInstance = std::make_shared<CXMLDocumentNodeInstance>(this, nullptr, m_pDefaultNameSpace, sRootNodeName);
+	m_pRootNodeInstance = allocateNode(nullptr, m_pDefaultNameSpace, internName(sRootNodeName));
 
 }
 
@@ -110,7 +110,7 @@ void CXMLDocumentInstance::extractPugiDocument(std::shared_ptr<pugi::xml_documen
 
 	m_pDefaultNameSpace = FindNamespaceByPrefix(sRootNodeNameSpacePrefix, true);
 
-	m_pRootNodeInstance = std::make_shared<CXMLDocumentNodeInstance>(this, nullptr, m_pDefaultNameSpace, rootNode.name ());
+	m_pRootNodeInstance = allocateNode(nullptr, m_pDefaultNameSpace, internName(rootNode.name ()));
 
 	m_pRootNodeInstance->extractFromPugiNode (pXMLDocument.get(), &rootNode, true);
 }
@@ -316,3 +316,55 @@ void CXMLDocumentInstance::ChangeNamespacePrefix(const std::string& sOldNamespac
 	m_PrefixToNamespaceMap.insert(std::make_pair(sNewNamespacePrefix, pNameSpace));
 
 }
+
+uint32_t CXMLDocumentInstance::internName(const std::string& sName)
+{
+	auto iIter = m_InternedNameMap.find(sName);
+	if (iIter != m_InternedNameMap.end())
+		return iIter->second;
+
+	uint32_t nNameID = (uint32_t)m_InternedNames.size();
+	m_InternedNames.push_back(sName);
+	m_InternedNameMap.insert(std::make_pair(sName, nNameID));
+
+	return nNameID;
+}
+
+bool CXMLDocumentInstance::findNameID(const std::string& sName, uint32_t& nNameID)
+{
+	auto iIter = m_InternedNameMap.find(sName);
+	if (iIter == m_InternedNameMap.end())
+		return false;
+
+	nNameID = iIter->second;
+	return true;
+}
+
+const std::string& CXMLDocumentInstance::getInternedName(uint32_t nNameID)
+{
+	if (nNameID >= m_InternedNames.size())
+		throw ELibMCCustomException(LIBMC_ERROR_INTERNALNODEERROR, std::to_string(nNameID));
+
+	return m_InternedNames[nNameID];
+}
+
+CXMLDocumentNodeInstance* CXMLDocumentInstance::allocateNode(CXMLDocumentNodeInstance* pParentNode, PXMLDocumentNameSpace pNameSpace, uint32_t nNameID)
+{
+	if (nNameID >= m_InternedNames.size())
+		throw ELibMCCustomException(LIBMC_ERROR_INTERNALNODEERROR, std::to_string(nNameID));
+
+	return m_NodeArena.allocate(this, pParentNode, pNameSpace, nNameID);
+}
+
+CXMLDocumentAttributeInstance* CXMLDocumentInstance::allocateAttribute(CXMLDocumentNodeInstance* pNode, PXMLDocumentNameSpace pNameSpace, uint32_t nNameID)
+{
+	if (nNameID >= m_InternedNames.size())
+		throw ELibMCCustomException(LIBMC_ERROR_INTERNALATTRIBUTEERROR, std::to_string(nNameID));
+
+	return m_AttributeArena.allocate(this, pNode, pNameSpace, nNameID);
+}
+
+uint64_t CXMLDocumentInstance::getAllocatedNodeCount()
+{
+	return m_NodeArena.getCount();
+}
@@ -36,8 +36,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <memory>
 #include <map>
 #include <vector>
+#include <unordered_map>
 
 #include "amc_xmldocumentnode.hpp"
+#include "amc_xmldocumentarena.hpp"
 
 namespace AMC {
 
@@ -52,6 +54,14 @@ namespace AMC {
 		std::map<std::string, PXMLDocumentNameSpace> m_NamespaceMap;
 		std::map<std::string, PXMLDocumentNameSpace> m_PrefixToNamespaceMap;
 
+		// Nodes and attributes are owned by the document and live until the document is destroyed.
+		CXMLDocumentArena<CXMLDocumentNodeInstance> m_NodeArena;
+		CXMLDocumentArena<CXMLDocumentAttributeInstance> m_AttributeArena;
+
+		// Node and attribute names are stored once per document and referenced by ID.
+		std::vector<std::string> m_InternedNames;
+		std::unordered_map<std::string, uint32_t> m_InternedNameMap;
+
 		PXMLDocumentNameSpace registerNamespaceEx(const std::string& sNamespace, const std::string & sPrefix);
 
 		void extractPugiDocument(std::shared_ptr<pugi::xml_document> pXMLDocument);
@@ -89,6 +99,19 @@ namespace AMC {
 
 		std::string SaveToString(const bool bAddLineBreaks);
 
+		uint32_t internName(const std::string& sName);
+
+		// Returns false if the name does not occur in the document.
+		bool findNameID(const std::string& sName, uint32_t& nNameID);
+
+		const std::string& getInternedName(uint32_t nNameID);
+
+		CXMLDocumentNodeInstance* allocateNode(CXMLDocumentNodeInstance* pParentNode, PXMLDocumentNameSpace pNameSpace, uint32_t nNameID);
+
+		CXMLDocumentAttributeInstance* allocateAttribute(CXMLDocumentNodeInstance* pNode, PXMLDocumentNameSpace pNameSpace, uint32_t nNameID);
+
+		uint64_t getAllocatedNodeCount();
+
 	};
 
 	typedef std::shared_ptr<CXMLDocumentInstance> PXMLDocumentInstance;
@@ -0,0 +1,168 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMC_XMLDOCUMENTARENA
+#define __AMC_XMLDOCUMENTARENA
+
+#include <vector>
+#include <new>
+#include <utility>
+#include <cstddef>
+
+#define AMC_XMLDOCUMENTARENA_BLOCKSIZE 256
+
+namespace AMC {
+
+	// Non-owning reference to a node or attribute that lives in the arena of its document.
+	// A handle stays valid as long as its document exists.
+	template <class T> class CXMLDocumentHandle {
+	private:
+
+		T* m_pInstance;
+
+	public:
+
+		CXMLDocumentHandle()
+			: m_pInstance(nullptr)
+		{
+		}
+
+		CXMLDocumentHandle(std::nullptr_t)
+			: m_pInstance(nullptr)
+		{
+		}
+
+		CXMLDocumentHandle(T* pInstance)
+			: m_pInstance(pInstance)
+		{
+		}
+
+		T* get() const
+		{
+			return m_pInstance;
+		}
+
+		T* operator->() const
+		{
+			return m_pInstance;
+		}
+
+		T& operator*() const
+		{
+			return *m_pInstance;
+		}
+
+		explicit operator bool() const
+		{
+			return m_pInstance != nullptr;
+		}
+
+		bool operator==(const CXMLDocumentHandle<T>& otherHandle) const
+		{
+			return m_pInstance == otherHandle.m_pInstance;
+		}
+
+		bool operator!=(const CXMLDocumentHandle<T>& otherHandle) const
+		{
+			return m_pInstance != otherHandle.m_pInstance;
+		}
+
+		bool operator==(std::nullptr_t) const
+		{
+			return m_pInstance == nullptr;
+		}
+
+		bool operator!=(std::nullptr_t) const
+		{
+			return m_pInstance != nullptr;
+		}
+
+	};
+
+	// Allocates objects in fixed size blocks. Objects are never freed individually,
+	// all of them are destroyed together with the arena.
+	template <class T> class CXMLDocumentArena {
+	private:
+
+		std::vector<T*> m_Blocks;
+		size_t m_nUsedInLastBlock;
+
+	public:
+
+		CXMLDocumentArena()
+			: m_nUsedInLastBlock(AMC_XMLDOCUMENTARENA_BLOCKSIZE)
+		{
+		}
+
+		CXMLDocumentArena(const CXMLDocumentArena<T>&) = delete;
+		CXMLDocumentArena<T>& operator=(const CXMLDocumentArena<T>&) = delete;
+
+		~CXMLDocumentArena()
+		{
+			for (size_t nBlockIndex = 0; nBlockIndex < m_Blocks.size(); nBlockIndex++) {
+				T* pBlock = m_Blocks[nBlockIndex];
+				size_t nUsedCount = (nBlockIndex + 1 < m_Blocks.size()) ? AMC_XMLDOCUMENTARENA_BLOCKSIZE : m_nUsedInLastBlock;
+				for (size_t nIndex = 0; nIndex < nUsedCount; nIndex++)
+					pBlock[nIndex].~T();
+
+				::operator delete(pBlock);
+			}
+		}
+
+		template <typename... TArguments> T* allocate(TArguments&&... arguments)
+		{
+			if (m_nUsedInLastBlock >= AMC_XMLDOCUMENTARENA_BLOCKSIZE) {
+				m_Blocks.reserve(m_Blocks.size() + 1);
+				m_Blocks.push_back(static_cast<T*> (::operator new(sizeof(T) * AMC_XMLDOCUMENTARENA_BLOCKSIZE)));
+				m_nUsedInLastBlock = 0;
+			}
+
+			// If the constructor throws, the slot is simply reused by the next allocation.
+			T* pInstance = new (m_Blocks.back() + m_nUsedInLastBlock) T(std::forward<TArguments>(arguments)...);
+			m_nUsedInLastBlock++;
+
+			return pInstance;
+		}
+
+		size_t getCount()
+		{
+			if (m_Blocks.empty())
+				return 0;
+
+			return (m_Blocks.size() - 1) * AMC_XMLDOCUMENTARENA_BLOCKSIZE + m_nUsedInLastBlock;
+		}
+
+	};
+
+}
+
+
+#endif //__AMC_XMLDOCUMENTARENA
@@ -38,8 +38,21 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 using namespace AMC;
 
 CXMLDocumentAttributeInstance::CXMLDocumentAttributeInstance(CXMLDocumentInstance* pDocument, CXMLDocumentNodeInstance* pNode, PXMLDocumentNameSpace pNameSpace, const std::string& sAttributeName)
-	: m_pDocument (pDocument), m_pNode (pNode), m_sAttributeName (sAttributeName), m_pNameSpace(pNameSpace)
+	: m_pDocument (pDocument), m_pNode (pNode), m_nNameID (0), m_pNameSpace(pNameSpace)
 {
+	if (pDocument == nullptr)
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+	if (pNameSpace == nullptr)
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+	m_nNameID = pDocument->internName(sAttributeName);
+}
+
+CXMLDocumentAttributeInstance::CXMLDocumentAttributeInstance(CXMLDocumentInstance* pDocument, CXMLDocumentNodeInstance* pNode, PXMLDocumentNameSpace pNameSpace, uint32_t nNameID)
+	: m_pDocument(pDocument), m_pNode(pNode), m_nNameID(nNameID), m_pNameSpace(pNameSpace)
+{
+	if (pDocument == nullptr)
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 	if (pNameSpace == nullptr)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 }
@@ -51,7 +64,17 @@ CXMLDocumentAttributeInstance::~CXMLDocumentAttributeInstance()
 
 std::string CXMLDocumentAttributeInstance::getAttributeName()
 {
-	return m_sAttributeName;
+	return m_pDocument->getInternedName(m_nNameID);
+}
+
+uint32_t CXMLDocumentAttributeInstance::getNameID()
+{
+	return m_nNameID;
+}
+
+CXMLDocumentNameSpace* CXMLDocumentAttributeInstance::getNameSpaceInstance()
+{
+	return m_pNameSpace.get();
 }
 
 PXMLDocumentNameSpace CXMLDocumentAttributeInstance::getNameSpace()
@@ -76,10 +99,10 @@ std::string CXMLDocumentAttributeInstance::getPrefixedName()
 
 	if (sNameSpacePrefix != sNodeNameSpacePrefix) {
 		if (!sNameSpacePrefix.empty())
-			return sNameSpacePrefix + ":" + m_sAttributeName;
+			return sNameSpacePrefix + ":" + getAttributeName();
 	}
 	
-	return m_sAttributeName;
+	return getAttributeName();
 
 }
 
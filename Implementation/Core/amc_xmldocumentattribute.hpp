@@ -35,6 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <string>
 #include <memory>
 #include "amc_xmldocumentnamespace.hpp"
+#include "amc_xmldocumentarena.hpp"
 
 
 namespace AMC {
@@ -47,18 +48,25 @@ namespace AMC {
 
 		CXMLDocumentInstance* m_pDocument;
 		CXMLDocumentNodeInstance* m_pNode;
-		std::string m_sAttributeName;		
+		uint32_t m_nNameID;
 		std::string m_sValue;
 		PXMLDocumentNameSpace m_pNameSpace;
 
 	public:
 
 		CXMLDocumentAttributeInstance(CXMLDocumentInstance* pDocument, CXMLDocumentNodeInstance * pNode, PXMLDocumentNameSpace pNameSpace, const std::string & sAttributeName);
+
+		CXMLDocumentAttributeInstance(CXMLDocumentInstance* pDocument, CXMLDocumentNodeInstance* pNode, PXMLDocumentNameSpace pNameSpace, uint32_t nNameID);
 		
 		virtual ~CXMLDocumentAttributeInstance();
 
 		std::string getAttributeName ();
 
+		// ID of the attribute name in the name table of the document.
+		uint32_t getNameID ();
+
+		CXMLDocumentNameSpace* getNameSpaceInstance ();
+
 		PXMLDocumentNameSpace getNameSpace ();
 
 		std::string getValue ();
@@ -72,7 +80,7 @@ namespace AMC {
 	};
 
 	
-	typedef std::shared_ptr<CXMLDocumentAttributeInstance> PXMLDocumentAttributeInstance;
+	typedef CXMLDocumentHandle<CXMLDocumentAttributeInstance> PXMLDocumentAttributeInstance;
 	
 }
 
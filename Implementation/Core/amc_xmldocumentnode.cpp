@@ -39,7 +39,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 using namespace AMC;
 
 CXMLDocumentNodeInstance::CXMLDocumentNodeInstance(CXMLDocumentInstance* pDocument, CXMLDocumentNodeInstance* pParentNode, PXMLDocumentNameSpace pNameSpace, const std::string& sNodeName)
-	: m_pDocument (pDocument), m_sNodeName(sNodeName), m_pParentNode (pParentNode), m_pNameSpace (pNameSpace)
+	: m_pDocument (pDocument), m_pParentNode (pParentNode), m_nNameID (0), m_pNameSpace (pNameSpace)
 {
 	if (pDocument == nullptr)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
@@ -48,6 +48,16 @@ CXMLDocumentNodeInstance::CXMLDocumentNodeInstance(CXMLDocumentInstance* pDocume
 	if (pNameSpace.get() == nullptr)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 
+	m_nNameID = pDocument->internName(sNodeName);
+}
+
+CXMLDocumentNodeInstance::CXMLDocumentNodeInstance(CXMLDocumentInstance* pDocument, CXMLDocumentNodeInstance* pParentNode, PXMLDocumentNameSpace pNameSpace, uint32_t nNameID)
+	: m_pDocument(pDocument), m_pParentNode(pParentNode), m_nNameID(nNameID), m_pNameSpace(pNameSpace)
+{
+	if (pDocument == nullptr)
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+	if (pNameSpace.get() == nullptr)
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 }
 
 CXMLDocumentNodeInstance::~CXMLDocumentNodeInstance()
@@ -67,23 +77,24 @@ void CXMLDocumentNodeInstance::extractFromPugiNode(pugi::xml_document* pXMLDocum
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 
 	auto attributes = pXMLNode->attributes();
+
+	// PugiXML is built without STL support, so its iterators cannot be passed to std::distance.
+	size_t nAttributeCount = 0;
+	for (pugi::xml_attribute attribute = pXMLNode->first_attribute(); attribute; attribute = attribute.next_attribute())
+		nAttributeCount++;
+	m_Attributes.reserve(m_Attributes.size() + nAttributeCount);
+
+	std::string sAttributeName;
+	std::string sNameSpacePrefix;
 	for (auto attribute : attributes) {
 
-		std::string sAttributeName;
-		std::string sNameSpacePrefix;		
 		splitNameSpaceName (attribute.name(), sAttributeName, sNameSpacePrefix);
 
 		if (sNameSpacePrefix != "xmlns") {
 
-			PXMLDocumentNameSpace pNameSpace;
-			if (sNameSpacePrefix.empty()) {
-				pNameSpace = m_pNameSpace;
-			}
-			else {
-				pNameSpace = m_pDocument->FindNamespaceByPrefix(sNameSpacePrefix, true);
-			}
-
-			std::string sAttributeValue = attribute.as_string();
+			// Prefixed attributes must refer to a registered namespace
+			if (!sNameSpacePrefix.empty())
+				m_pDocument->FindNamespaceByPrefix(sNameSpacePrefix, true);
 
 			bool bIsValidAttribute = true;
 			if (bIsRoot) {
@@ -91,26 +102,31 @@ void CXMLDocumentNodeInstance::extractFromPugiNode(pugi::xml_document* pXMLDocum
 					bIsValidAttribute = false;
 			}
 
-			if (bIsValidAttribute)
-				AddAttribute(m_pNameSpace, sAttributeName, sAttributeValue);
+			if (bIsValidAttribute) {
+				uint32_t nNameID = m_pDocument->internName(sAttributeName);
+				if (lookupAttribute(m_pNameSpace.get(), nNameID) != nullptr)
+					throw ELibMCCustomException(LIBMC_ERROR_DUPLICATEATTRIBUTE, sAttributeName);
+
+				addAttributeInternal(m_pNameSpace, nNameID, attribute.value());
+			}
 		}
 	}
 
-	size_t nChildIndex = 0;
 	auto children = pXMLNode->children();
-	for (auto child : children) {
-		std::string sChildFullName(child.name ());
-		if (sChildFullName.empty ()) { // Content text
-			if (nChildIndex != 0)
-				throw ELibMCInterfaceException(LIBMC_ERROR_XMLNODECONTAINSAMBIGOUSCONTENTDATA);
 
-			std::string sTextContent (child.value());
-			SetTextContent(sTextContent);
+	size_t nChildCount = 0;
+	for (pugi::xml_node child = pXMLNode->first_child(); child; child = child.next_sibling())
+		nChildCount++;
+	m_Children.reserve(m_Children.size() + nChildCount);
+
+	std::string sChildName;
+	for (auto child : children) {
+		const char * pszChildFullName = child.name();
+		if (*pszChildFullName == 0) { // Content text
+			SetTextContent(child.value());
 		}
 		else {
-			std::string sChildName;
-			std::string sNameSpacePrefix;
-			splitNameSpaceName(sChildFullName, sChildName, sNameSpacePrefix);
+			splitNameSpaceName(pszChildFullName, sChildName, sNameSpacePrefix);
 
 			PXMLDocumentNameSpace pNameSpace;
 			if (sNameSpacePrefix.empty()) {
@@ -120,9 +136,7 @@ void CXMLDocumentNodeInstance::extractFromPugiNode(pugi::xml_document* pXMLDocum
 				pNameSpace = m_pDocument->FindNamespaceByPrefix(sNameSpacePrefix, true);
 			}
 
-			auto pChildNode = std::make_shared<CXMLDocumentNodeInstance>(m_pDocument, this, pNameSpace, sChildName);
-
-			addChildEx(pChildNode);
+			auto pChildNode = addChildInternal(pNameSpace, m_pDocument->internName(sChildName));
 
 			pChildNode->extractFromPugiNode(pXMLDocument, &child, false);
 		}
@@ -168,13 +182,36 @@ CXMLDocumentInstance* CXMLDocumentNodeInstance::getDocument()
 
 std::vector<PXMLDocumentNodeInstance> CXMLDocumentNodeInstance::getChildren()
 {
-	return m_Children;
+	return std::vector<PXMLDocumentNodeInstance> (m_Children.begin (), m_Children.end ());
+}
+
+std::vector<PXMLDocumentNodeInstance> CXMLDocumentNodeInstance::getChildrenByName(CXMLDocumentNameSpace* pNameSpace, const std::string& sName)
+{
+	if (pNameSpace == nullptr)
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+	std::vector<PXMLDocumentNodeInstance> children;
+
+	uint32_t nNameID = 0;
+	if (m_pDocument->findNameID(sName, nNameID)) {
+		for (auto pChild : m_Children) {
+			if ((pChild->m_pNameSpace.get() == pNameSpace) && (pChild->m_nNameID == nNameID))
+				children.push_back(pChild);
+		}
+	}
+
+	return children;
 }
 
 
 std::string CXMLDocumentNodeInstance::GetName()
 {
-	return m_sNodeName;
+	return m_pDocument->getInternedName(m_nNameID);
+}
+
+uint32_t CXMLDocumentNodeInstance::getNameID()
+{
+	return m_nNameID;
 }
 
 PXMLDocumentNameSpace CXMLDocumentNodeInstance::GetNameSpace()
@@ -209,13 +246,27 @@ uint64_t CXMLDocumentNodeInstance::GetAttributeCount()
 	return m_Attributes.size ();
 }
 
+CXMLDocumentAttributeInstance* CXMLDocumentNodeInstance::lookupAttribute(CXMLDocumentNameSpace* pNameSpace, uint32_t nNameID)
+{
+	// Nodes only have a few attributes, so a linear search over the name IDs is faster than any map
+	for (auto pAttribute : m_Attributes) {
+		if ((pAttribute->getNameID() == nNameID) && (pAttribute->getNameSpaceInstance() == pNameSpace))
+			return pAttribute;
+	}
+
+	return nullptr;
+}
+
 bool CXMLDocumentNodeInstance::HasAttribute(CXMLDocumentNameSpace* pNameSpace, const std::string& sName)
 {
 	if (pNameSpace == nullptr)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 
-	auto iIter = m_AttributeMap.find(std::make_pair(pNameSpace, sName));
-	return iIter != m_AttributeMap.end();
+	uint32_t nNameID = 0;
+	if (!m_pDocument->findNameID(sName, nNameID))
+		return false;
+
+	return lookupAttribute(pNameSpace, nNameID) != nullptr;
 }
 
 void CXMLDocumentNodeInstance::RemoveAttribute(CXMLDocumentNameSpace* pNameSpace, const std::string& sName)
@@ -223,18 +274,14 @@ void CXMLDocumentNodeInstance::RemoveAttribute(CXMLDocumentNameSpace* pNameSpace
 	if (pNameSpace == nullptr)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 
-	auto iIter = m_AttributeMap.find(std::make_pair(pNameSpace, sName));
-	if (iIter != m_AttributeMap.end()) {
+	uint32_t nNameID = 0;
+	if (m_pDocument->findNameID(sName, nNameID)) {
 
-		auto lastIterator =std::remove_if(m_Attributes.begin(), m_Attributes.end(), [this, pNameSpace, sName](PXMLDocumentAttributeInstance pAttribute) {
-			auto pAttributeCopy = pAttribute;
-			bool bDelete = ((pAttributeCopy->getNameSpace().get() == pNameSpace) && (pAttributeCopy->getAttributeName() == sName));
-			return bDelete;
+		auto lastIterator = std::remove_if(m_Attributes.begin(), m_Attributes.end(), [pNameSpace, nNameID](CXMLDocumentAttributeInstance* pAttribute) {
+			return ((pAttribute->getNameSpaceInstance() == pNameSpace) && (pAttribute->getNameID() == nNameID));
 		});
 
 		m_Attributes.erase(lastIterator, m_Attributes.end());
-
-		m_AttributeMap.erase(std::make_pair(pNameSpace, sName));
 	}
 
 }
@@ -244,9 +291,7 @@ void CXMLDocumentNodeInstance::RemoveAttributeByIndex(uint64_t nIndex)
 	if (nIndex >= m_Attributes.size ())
 		throw ELibMCCustomException(LIBMC_ERROR_INVALIDATTRIBUTEINDEX, std::to_string(nIndex));
 
-	auto pAttribute = m_Attributes.at(nIndex);
 	m_Attributes.erase(m_Attributes.begin () + nIndex);
-	m_AttributeMap.erase(std::make_pair(pAttribute->getNameSpace ().get(), pAttribute->getAttributeName ()));
 
 }
 
@@ -265,17 +310,16 @@ PXMLDocumentAttributeInstance CXMLDocumentNodeInstance::FindAttribute(CXMLDocume
 	if (pNameSpace == nullptr)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 
-	auto iIter = m_AttributeMap.find(std::make_pair(pNameSpace, sName));
-	if (iIter != m_AttributeMap.end()) {
-		return iIter->second;
-	}
-	else {
-		if (bMustExist) 
-			throw ELibMCCustomException(LIBMC_ERROR_COULDNOTFINDATTRIBUTE, sName);
+	CXMLDocumentAttributeInstance* pAttribute = nullptr;
 
-		return nullptr;
+	uint32_t nNameID = 0;
+	if (m_pDocument->findNameID(sName, nNameID))
+		pAttribute = lookupAttribute(pNameSpace, nNameID);
 
-	}
+	if ((pAttribute == nullptr) && bMustExist)
+		throw ELibMCCustomException(LIBMC_ERROR_COULDNOTFINDATTRIBUTE, sName);
+
+	return pAttribute;
 
 }
 
@@ -284,56 +328,70 @@ PXMLDocumentAttributeInstance CXMLDocumentNodeInstance::AddAttribute(PXMLDocumen
 	if (pNameSpace == nullptr)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 
-	auto mapKey = std::make_pair(pNameSpace.get(), sName);
-	auto iIter = m_AttributeMap.find(mapKey);
-	if (iIter != m_AttributeMap.end()) 
+	uint32_t nNameID = m_pDocument->internName(sName);
+	if (lookupAttribute(pNameSpace.get(), nNameID) != nullptr)
 		throw ELibMCCustomException(LIBMC_ERROR_DUPLICATEATTRIBUTE, sName);
 
-	auto pAttribute = std::make_shared<CXMLDocumentAttributeInstance>(m_pDocument, this, pNameSpace, sName);
+	return addAttributeInternal(pNameSpace, nNameID, sValue);
+}
+
+CXMLDocumentAttributeInstance* CXMLDocumentNodeInstance::addAttributeInternal(PXMLDocumentNameSpace pNameSpace, uint32_t nNameID, const std::string& sValue)
+{
+	auto pAttribute = m_pDocument->allocateAttribute(this, pNameSpace, nNameID);
 	pAttribute->setValue(sValue);
 
-	m_AttributeMap.insert(std::make_pair(mapKey, pAttribute));
 	m_Attributes.push_back(pAttribute);
 
 	return pAttribute;
 }
 
+void CXMLDocumentNodeInstance::lookupChildren(CXMLDocumentNameSpace* pNameSpace, const std::string& sName, uint64_t& nCount, CXMLDocumentNodeInstance*& pFirstChild)
+{
+	nCount = 0;
+	pFirstChild = nullptr;
+
+	uint32_t nNameID = 0;
+	if (!m_pDocument->findNameID(sName, nNameID))
+		return;
+
+	if (m_pChildIndex.get() != nullptr) {
+		auto iIter = m_pChildIndex->find(std::make_pair(pNameSpace, nNameID));
+		if (iIter != m_pChildIndex->end()) {
+			nCount = iIter->second.m_nCount;
+			pFirstChild = iIter->second.m_pFirstChild;
+		}
+	}
+	else {
+		for (auto pChild : m_Children) {
+			if ((pChild->m_pNameSpace.get() == pNameSpace) && (pChild->m_nNameID == nNameID)) {
+				if (nCount == 0)
+					pFirstChild = pChild;
+				nCount++;
+			}
+		}
+	}
+}
+
 uint64_t CXMLDocumentNodeInstance::CountChildrenByName(CXMLDocumentNameSpace* pNameSpace, const std::string& sName)
 {
 	if (pNameSpace == nullptr)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 
 	uint64_t nCount = 0;
-	for (auto child : m_Children) {
-		if ((child->GetNameSpace ().get() == pNameSpace) && (child->GetName() == sName))
-			nCount++;
-	}
+	CXMLDocumentNodeInstance* pFirstChild = nullptr;
+	lookupChildren(pNameSpace, sName, nCount, pFirstChild);
 
 	return nCount;
 }
 
 bool CXMLDocumentNodeInstance::HasChild(CXMLDocumentNameSpace* pNameSpace, const std::string& sName)
 {
-	if (pNameSpace == nullptr)
-		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
-
-	auto iIter = m_ChildMapCounter.find(std::make_pair (pNameSpace, sName));
-	return (iIter != m_ChildMapCounter.end());
+	return (CountChildrenByName(pNameSpace, sName) > 0);
 }
 
 bool CXMLDocumentNodeInstance::HasUniqueChild(CXMLDocumentNameSpace* pNameSpace, const std::string& sName)
 {
-	if (pNameSpace == nullptr)
-		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
-
-	auto iIter = m_ChildMapCounter.find(std::make_pair(pNameSpace, sName));
-	if (iIter != m_ChildMapCounter.end()) {
-		return (iIter->second == 1);
-	}
-	else {
-		return false;
-	}
-
+	return (CountChildrenByName(pNameSpace, sName) == 1);
 }
 
 PXMLDocumentNodeInstance CXMLDocumentNodeInstance::FindChild(CXMLDocumentNameSpace* pNameSpace, const std::string& sName, const bool bMustExist)
@@ -341,18 +399,12 @@ PXMLDocumentNodeInstance CXMLDocumentNodeInstance::FindChild(CXMLDocumentNameSpa
 	if (pNameSpace == nullptr)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 
-	auto iIter = m_ChildMapCounter.find(std::make_pair(pNameSpace, sName));
-	if (iIter != m_ChildMapCounter.end()) {
-		if (iIter->second == 1)
-		{
-			auto iChildIter = m_ChildMap.find(std::make_pair(pNameSpace, sName));
-			if (iChildIter == m_ChildMap.end ())
-				throw ELibMCCustomException(LIBMC_ERROR_INTERNALNODEERROR, sName);
-
-			return iChildIter->second;
+	uint64_t nCount = 0;
+	CXMLDocumentNodeInstance* pFirstChild = nullptr;
+	lookupChildren(pNameSpace, sName, nCount, pFirstChild);
 
-		}
-	}
+	if (nCount == 1)
+		return pFirstChild;
 
 	if (bMustExist)
 		throw ELibMCCustomException(LIBMC_ERROR_XMLNODECHILDNOTFOUND, sName);
@@ -368,7 +420,15 @@ PXMLDocumentNodeInstance CXMLDocumentNodeInstance::AddChild(PXMLDocumentNameSpac
 	if (!m_sTextContent.empty ())
 		throw ELibMCInterfaceException(LIBMC_ERROR_XMLNODEHASTEXTCONTENT);
 
-	auto pNode = std::make_shared<CXMLDocumentNodeInstance>(m_pDocument, this, pNameSpace, sName);
+	if (!checkXMLNodeName(sName))
+		throw ELibMCCustomException(LIBMC_ERROR_INVALIDXMLNODENAME, sName);
+
+	return addChildInternal(pNameSpace, m_pDocument->internName(sName));
+}
+
+CXMLDocumentNodeInstance* CXMLDocumentNodeInstance::addChildInternal(PXMLDocumentNameSpace pNameSpace, uint32_t nNameID)
+{
+	auto pNode = m_pDocument->allocateNode(this, pNameSpace, nNameID);
 
 	addChildEx(pNode);
 
@@ -396,48 +456,61 @@ void CXMLDocumentNodeInstance::splitNameSpaceName(const std::string& sPrefixedNa
 }
 
 
-void CXMLDocumentNodeInstance::addChildEx (PXMLDocumentNodeInstance pNode)
+void CXMLDocumentNodeInstance::addChildEx (CXMLDocumentNodeInstance* pNode)
 {
 
-	if (pNode.get () == nullptr)
+	if (pNode == nullptr)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 
-	auto mapKey = std::make_pair(pNode->GetNameSpace().get(), pNode->GetName());
-
 	m_Children.push_back(pNode);
-	m_ChildMap.insert(std::make_pair (mapKey, pNode));
 
-	auto iChildIter = m_ChildMapCounter.find(mapKey);
-	if (iChildIter != m_ChildMapCounter.end()) {
-		iChildIter->second++;
+	if (m_pChildIndex.get() != nullptr) {
+		addToChildIndex(pNode);
 	}
-	else
-	{
-		m_ChildMapCounter.insert(std::make_pair (mapKey, 1));
+	else {
+		if (m_Children.size() > AMC_XMLDOCUMENTNODE_CHILDINDEXTHRESHOLD)
+			rebuildChildIndex();
 	}
 
 }
 
+void CXMLDocumentNodeInstance::addToChildIndex(CXMLDocumentNodeInstance* pNode)
+{
+	auto mapKey = std::make_pair(pNode->m_pNameSpace.get(), pNode->m_nNameID);
+
+	auto iIter = m_pChildIndex->find(mapKey);
+	if (iIter != m_pChildIndex->end()) {
+		iIter->second.m_nCount++;
+	}
+	else {
+		sXMLDocumentChildIndexEntry indexEntry;
+		indexEntry.m_nCount = 1;
+		indexEntry.m_pFirstChild = pNode;
+		m_pChildIndex->insert(std::make_pair(mapKey, indexEntry));
+	}
+}
+
+void CXMLDocumentNodeInstance::rebuildChildIndex()
+{
+	m_pChildIndex.reset();
+
+	if (m_Children.size() > AMC_XMLDOCUMENTNODE_CHILDINDEXTHRESHOLD) {
+		m_pChildIndex = std::make_unique<std::unordered_map<std::pair<CXMLDocumentNameSpace*, uint32_t>, sXMLDocumentChildIndexEntry, CXMLDocumentNameKeyHash>>();
+		for (auto pChild : m_Children)
+			addToChildIndex(pChild);
+	}
+}
+
 
 void CXMLDocumentNodeInstance::RemoveChild(CXMLDocumentNodeInstance* pChildInstance)
 {
 	if (pChildInstance == nullptr)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 
-	m_Children.erase(std::remove_if(m_Children.begin(), m_Children.end(),
-		[pChildInstance](const std::shared_ptr<CXMLDocumentNodeInstance>& ptr) {
-			return ptr.get() == pChildInstance;
-		}),
-		m_Children.end());
-
+	m_Children.erase(std::remove(m_Children.begin(), m_Children.end(), pChildInstance), m_Children.end());
 
-	auto mapKey = std::make_pair(pChildInstance->GetNameSpace().get(), pChildInstance->GetName());
-	m_ChildMap.erase(mapKey);
-
-	auto iChildIter = m_ChildMapCounter.find(mapKey);
-	if (iChildIter != m_ChildMapCounter.end()) {
-		iChildIter->second--;
-	}
+	if (m_pChildIndex.get() != nullptr)
+		rebuildChildIndex();
 }
 
 void CXMLDocumentNodeInstance::RemoveChildrenWithName(CXMLDocumentNameSpace* pNameSpace, const std::string& sName)
@@ -445,17 +518,18 @@ void CXMLDocumentNodeInstance::RemoveChildrenWithName(CXMLDocumentNameSpace* pNa
 	if (pNameSpace == nullptr)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 
+	uint32_t nNameID = 0;
+	if (!m_pDocument->findNameID(sName, nNameID))
+		return;
+
 	m_Children.erase(std::remove_if(m_Children.begin(), m_Children.end(),
-		[pNameSpace, sName](const std::shared_ptr<CXMLDocumentNodeInstance>& ptr) {
-			return (ptr->GetNameSpace().get() == pNameSpace) && (ptr->GetName () == sName);
+		[pNameSpace, nNameID](CXMLDocumentNodeInstance* pChild) {
+			return (pChild->m_pNameSpace.get() == pNameSpace) && (pChild->m_nNameID == nNameID);
 		}),
 		m_Children.end());
 
-
-	auto mapKey = std::make_pair(pNameSpace, sName);
-
-	m_ChildMap.erase(mapKey);
-	m_ChildMapCounter.erase(mapKey);
+	if (m_pChildIndex.get() != nullptr)
+		rebuildChildIndex();
 
 }
 
@@ -463,15 +537,15 @@ std::string CXMLDocumentNodeInstance::getPrefixedName()
 {
 	std::string sNameSpacePrefix = m_pNameSpace->getPrefix();
 	if (!sNameSpacePrefix.empty())
-		return sNameSpacePrefix + ":" + m_sNodeName;
+		return sNameSpacePrefix + ":" + GetName ();
 	else
-		return m_sNodeName;
+		return GetName ();
 }
 
 bool CXMLDocumentNodeInstance::compareName(const std::string& sNameSpace, const std::string& sName)
 {
 	auto pNameSpace = m_pDocument->FindNamespace(sNameSpace, true);
-	return ((pNameSpace.get() == m_pNameSpace.get()) && (m_sNodeName == sName));
+	return ((pNameSpace.get() == m_pNameSpace.get()) && (m_pDocument->getInternedName (m_nNameID) == sName));
 }
 
 void CXMLDocumentNodeInstance::CopyFrom(CXMLDocumentNodeInstance* pFromInstance)
@@ -490,12 +564,10 @@ void CXMLDocumentNodeInstance::CopyFrom(CXMLDocumentNodeInstance* pFromInstance)
 
 	auto children = pFromInstance->getChildren();
 	for (auto child : children) {
-		std::string sChildName = child->GetName();
 		std::string sChildNameSpace = child->GetNameSpace()->getNameSpaceName();
 
 		auto pNewNameSpace = m_pDocument->FindNamespace(sChildNameSpace, true);
-		auto pNewNode = std::make_shared<CXMLDocumentNodeInstance>(m_pDocument, this, pNewNameSpace, sChildName);
-		addChildEx  (pNewNode);
+		auto pNewNode = addChildInternal(pNewNameSpace, m_pDocument->internName(child->GetName()));
 
 		pNewNode->CopyFrom(child.get());
 	}
@@ -505,4 +577,3 @@ void CXMLDocumentNodeInstance::CopyFrom(CXMLDocumentNodeInstance* pFromInstance)
 		SetTextContent (sTextContent);
 
 }
-
@@ -36,9 +36,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <memory>
 #include <vector>
 #include <map>
+#include <unordered_map>
 
 #include "amc_xmldocumentattribute.hpp"
 
+#define AMC_XMLDOCUMENTNODE_CHILDINDEXTHRESHOLD 16
+
 namespace pugi {
 	class xml_document;
 	class xml_node;
@@ -50,29 +53,56 @@ namespace AMC {
 	class CXMLDocumentNodeInstance;
 	class CXMLDocumentNameSpace;
 
-	typedef std::shared_ptr<CXMLDocumentNodeInstance> PXMLDocumentNodeInstance;
+	typedef CXMLDocumentHandle<CXMLDocumentNodeInstance> PXMLDocumentNodeInstance;
+
+	typedef struct _sXMLDocumentChildIndexEntry {
+		uint64_t m_nCount;
+		CXMLDocumentNodeInstance* m_pFirstChild;
+	} sXMLDocumentChildIndexEntry;
+
+	struct CXMLDocumentNameKeyHash {
+		size_t operator()(const std::pair<CXMLDocumentNameSpace*, uint32_t>& key) const
+		{
+			return std::hash<CXMLDocumentNameSpace*>()(key.first) ^ ((size_t)key.second * 0x9E3779B97F4A7C15ULL);
+		}
+	};
 
+	// Nodes are allocated in the arena of their document and are referenced by handles.
+	// Names are interned in the document, so that lookups only compare the namespace and the name ID.
 	class CXMLDocumentNodeInstance {
 	private:
 
 		CXMLDocumentInstance* m_pDocument;
 		CXMLDocumentNodeInstance* m_pParentNode;
-		std::string m_sNodeName;
+		uint32_t m_nNameID;
 		std::string m_sTextContent;
 		PXMLDocumentNameSpace m_pNameSpace;
 
-		std::vector<PXMLDocumentAttributeInstance> m_Attributes;
-		std::map<std::pair <CXMLDocumentNameSpace *, std::string>, PXMLDocumentAttributeInstance> m_AttributeMap;
+		std::vector<CXMLDocumentAttributeInstance*> m_Attributes;
+		std::vector<CXMLDocumentNodeInstance*> m_Children;
+
+		// Hashed child lookup, only built for nodes with many children. Cleared when children are removed.
+		std::unique_ptr<std::unordered_map<std::pair<CXMLDocumentNameSpace*, uint32_t>, sXMLDocumentChildIndexEntry, CXMLDocumentNameKeyHash>> m_pChildIndex;
+
+		void addChildEx(CXMLDocumentNodeInstance* pNode);
+
+		void addToChildIndex(CXMLDocumentNodeInstance* pNode);
 
-		std::vector<PXMLDocumentNodeInstance> m_Children;
-		std::map<std::pair <CXMLDocumentNameSpace*, std::string>, PXMLDocumentNodeInstance> m_ChildMap;
-		std::map<std::pair <CXMLDocumentNameSpace*, std::string>, uint64_t> m_ChildMapCounter;
+		void rebuildChildIndex();
 
-		void addChildEx(PXMLDocumentNodeInstance pNode);
+		void lookupChildren(CXMLDocumentNameSpace* pNameSpace, const std::string& sName, uint64_t& nCount, CXMLDocumentNodeInstance*& pFirstChild);
+
+		CXMLDocumentAttributeInstance* lookupAttribute(CXMLDocumentNameSpace* pNameSpace, uint32_t nNameID);
+
+		CXMLDocumentNodeInstance* addChildInternal(PXMLDocumentNameSpace pNameSpace, uint32_t nNameID);
+
+		CXMLDocumentAttributeInstance* addAttributeInternal(PXMLDocumentNameSpace pNameSpace, uint32_t nNameID, const std::string& sValue);
 
 	public:
 
 		CXMLDocumentNodeInstance(CXMLDocumentInstance* pDocument, CXMLDocumentNodeInstance * pParentNode, PXMLDocumentNameSpace pNameSpace, const std::string& sNodeName);
+
+		CXMLDocumentNodeInstance(CXMLDocumentInstance* pDocument, CXMLDocumentNodeInstance* pParentNode, PXMLDocumentNameSpace pNameSpace, uint32_t nNameID);
 		
 		virtual ~CXMLDocumentNodeInstance();
 
@@ -84,10 +114,15 @@ namespace AMC {
 
 		std::vector<PXMLDocumentNodeInstance> getChildren ();
 
+		std::vector<PXMLDocumentNodeInstance> getChildrenByName (CXMLDocumentNameSpace* pNameSpace, const std::string& sName);
+
 		static bool checkXMLNodeName(const std::string & sNodeName);
 
 		std::string GetName();
 
+		// ID of the node name in the name table of the document.
+		uint32_t getNameID();
+
 		std::string getPrefixedName();
 
 		bool compareName(const std::string& sNameSpace, const std::string& sName);
@@ -151,6 +151,22 @@ namespace AMCData {
 
 		}
 
+		case 18:
+		{
+			std::string sExecutionCountAddQuery = "ALTER TABLE `buildjobs` ADD `executioncount` integer DEFAULT 0";
+			pTransaction->executeStatement(sExecutionCountAddQuery);
+
+			std::string sExecutionCountUpdateQuery = "UPDATE `buildjobs` SET `executioncount`=(SELECT count(`buildjobexecutions`.`uuid`) FROM `buildjobexecutions` WHERE `buildjobexecutions`.`jobuuid`=`buildjobs`.`uuid`)";
+			pTransaction->executeStatement(sExecutionCountUpdateQuery);
+
+			// Indices for the keyset paginated job and execution listings
+			pTransaction->executeStatement("CREATE INDEX `buildjobs_status_timestamp` ON `buildjobs` (`status`, `timestamp`, `uuid`)");
+			pTransaction->executeStatement("CREATE INDEX `buildjobdata_jobuuid` ON `buildjobdata` (`jobuuid`)");
+			pTransaction->executeStatement("CREATE INDEX `buildjobexecutions_jobuuid` ON `buildjobexecutions` (`jobuuid`)");
+			pTransaction->executeStatement("CREATE INDEX `buildjobexecutions_active_starttimestamp` ON `buildjobexecutions` (`active`, `startjournaltimestamp`, `uuid`)");
+			break;
+		}
+
 		}
 
 		
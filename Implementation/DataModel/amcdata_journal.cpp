@@ -35,6 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "common_utils.hpp"
 #include "amcdata_sqlhandler_sqlite.hpp"
 #include "common_exportstream_native.hpp"
+#include "amcdata_journalchunkcodec.hpp"
 
 #include <sstream>
 #include <iomanip>
@@ -235,6 +236,22 @@ namespace AMCData {
 		pAlertAckStatement->execute();
 		pAlertAckStatement = nullptr; 
 
+		// Indexes for the historic alert queries. The current session's alert state is served by m_pAlertIndex.
+		std::vector<std::string> alertIndexQueries = {
+			"CREATE INDEX `alerts_uuid` ON `alerts` (`uuid`)",
+			"CREATE INDEX `alerts_timestamp` ON `alerts` (`timestamp`)",
+			"CREATE INDEX `alerts_identifier_timestamp` ON `alerts` (`identifier`, `timestamp`)",
+			"CREATE INDEX `alertacknowledgements_alertuuid` ON `alertacknowledgements` (`alertuuid`, `timestamp`)"
+		};
+
+		for (auto & sIndexQuery : alertIndexQueries) {
+			auto pIndexStatement = m_pSQLHandler->prepareStatement(sIndexQuery);
+			pIndexStatement->execute();
+			pIndexStatement = nullptr;
+		}
+
+		m_pAlertIndex = std::make_shared<CJournalAlertIndex>();
+
 		m_pCurrentJournalFile = createJournalFile();
 
 	}
@@ -325,24 +342,36 @@ namespace AMCData {
 			if (nTimeStampDataBufferSize != nValueDataBufferSize)
 				throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
 
-			uint64_t nVariableBufferMemSize = nVariableInfoBufferSize * sizeof(LibMCData::sJournalChunkVariableInfo);
-			uint64_t nTimeStampBufferMemSize = nTimeStampDataBufferSize * sizeof(uint32_t);
-			uint64_t nValueBufferMemSize = nValueDataBufferSize * sizeof(int64_t);
-
-			uint64_t nTotalMemSize = sizeof(sJournalChunkHeader) + nVariableBufferMemSize + nTimeStampBufferMemSize + nValueBufferMemSize;
-
-			sJournalChunkHeader chunkHeader;
-			memset((void*)&chunkHeader, 0, sizeof(sJournalChunkHeader));
-			chunkHeader.m_nSignature = JOURNALSIGNATURE_INTEGERDATA_V1;
-			chunkHeader.m_nMemorySize = (uint32_t)(nTotalMemSize);
-			chunkHeader.m_nVariableCount = (uint32_t)nVariableInfoBufferSize;
-			chunkHeader.m_nValueCount = (uint32_t)nValueDataBufferSize;
-
 			uint64_t nPosition = m_pCurrentJournalFile->retrieveWritePosition();
-			m_pCurrentJournalFile->writeBuffer((const void*)&chunkHeader, sizeof (chunkHeader));
-			m_pCurrentJournalFile->writeBuffer((const void*)pVariableInfoBuffer, nVariableBufferMemSize);
-			m_pCurrentJournalFile->writeBuffer((const void*)pTimeStampDataBuffer, nTimeStampBufferMemSize);
-			m_pCurrentJournalFile->writeBuffer((const void*)pValueDataBuffer, nValueBufferMemSize);
+			uint64_t nTotalMemSize = 0;
+
+			if (getChunkFormatVersion() >= JOURNALCHUNKFORMATVERSION_V2) {
+				std::vector<uint8_t> chunkBuffer;
+				CJournalChunkCodec::encodeChunk(pVariableInfoBuffer, nVariableInfoBufferSize, pTimeStampDataBuffer, pValueDataBuffer, nValueDataBufferSize, getChunkCompressionIsEnabled(), getChunkSummariesAreEnabled(), chunkBuffer);
+
+				nTotalMemSize = chunkBuffer.size();
+				m_pCurrentJournalFile->writeBuffer((const void*)chunkBuffer.data(), chunkBuffer.size());
+			}
+			else {
+				uint64_t nVariableBufferMemSize = nVariableInfoBufferSize * sizeof(LibMCData::sJournalChunkVariableInfo);
+				uint64_t nTimeStampBufferMemSize = nTimeStampDataBufferSize * sizeof(uint32_t);
+				uint64_t nValueBufferMemSize = nValueDataBufferSize * sizeof(int64_t);
+
+				nTotalMemSize = sizeof(sJournalChunkHeader) + nVariableBufferMemSize + nTimeStampBufferMemSize + nValueBufferMemSize;
+
+				sJournalChunkHeader chunkHeader;
+				memset((void*)&chunkHeader, 0, sizeof(sJournalChunkHeader));
+				chunkHeader.m_nSignature = JOURNALSIGNATURE_INTEGERDATA_V1;
+				chunkHeader.m_nMemorySize = (uint32_t)(nTotalMemSize);
+				chunkHeader.m_nVariableCount = (uint32_t)nVariableInfoBufferSize;
+				chunkHeader.m_nValueCount = (uint32_t)nValueDataBufferSize;
+
+				m_pCurrentJournalFile->writeBuffer((const void*)&chunkHeader, sizeof(chunkHeader));
+				m_pCurrentJournalFile->writeBuffer((const void*)pVariableInfoBuffer, nVariableBufferMemSize);
+				m_pCurrentJournalFile->writeBuffer((const void*)pTimeStampDataBuffer, nTimeStampBufferMemSize);
+				m_pCurrentJournalFile->writeBuffer((const void*)pValueDataBuffer, nValueBufferMemSize);
+			}
+
 			m_pCurrentJournalFile->flushBuffers();
 
 
@@ -591,6 +620,19 @@ namespace AMCData {
 		pStatement->execute();
 		pStatement = nullptr;
 
+		sJournalAlertIndexEntry alertEntry;
+		alertEntry.m_sIdentifier = sIdentifier;
+		alertEntry.m_Level = eLevel;
+		alertEntry.m_sDescription = sDescription;
+		alertEntry.m_sDescriptionIdentifier = sDescriptionIdentifier;
+		alertEntry.m_sReadableContextInformation = sReadableContextInformation;
+		alertEntry.m_bNeedsAcknowledgement = bNeedsAcknowledgement;
+		alertEntry.m_sTimestampUTC = sTimestampUTC;
+		alertEntry.m_nAlertIndex = m_AlertID;
+		alertEntry.m_bActive = true;
+		alertEntry.m_bAcknowledged = false;
+		m_pAlertIndex->addAlert(sNormalizedUUID, alertEntry);
+
 		m_AlertID++;
 	}
 
@@ -599,37 +641,22 @@ namespace AMCData {
 	{
 		auto sNormalizedUUID = AMCCommon::CUtils::normalizeUUIDString(sUUID);
 
-		std::lock_guard<std::mutex> lockGuard(m_LogMutex);
-
-		std::string sQuery = "SELECT uuid FROM alerts WHERE uuid=?";
-		auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
-		pStatement->setString(1, sNormalizedUUID);
-		return pStatement->nextRow();
-
-
+		return m_pAlertIndex->hasAlert(sNormalizedUUID);
 	}
 
 	void CJournal::getAlertInformation(const std::string& sUUID, std::string& sIdentifier, LibMCData::eAlertLevel& eLevel, std::string& sDescription, std::string& sDescriptionIdentifier, std::string& sReadableContextInformation, bool& bNeedsAcknowledgement, std::string& sTimestampUTC)
 	{
 		auto sNormalizedUUID = AMCCommon::CUtils::normalizeUUIDString(sUUID);
 
-		std::lock_guard<std::mutex> lockGuard(m_LogMutex);
-
-		std::string sQuery = "SELECT identifier, alertlevel, description, descriptionidentifier, contextinformation, needsacknowledgement, timestamp FROM alerts WHERE uuid=?";
-		auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
-		pStatement->setString(1, sNormalizedUUID);
-
-		if (pStatement->nextRow()) {
-			sIdentifier = pStatement->getColumnString(1);
-			std::string sAlertLevel = pStatement->getColumnString(2);
-
-			eLevel = convertStringToAlertLevel(sAlertLevel, false);
-
-			sDescription = pStatement->getColumnString(3);
-			sDescriptionIdentifier = pStatement->getColumnString(4);
-			sReadableContextInformation = pStatement->getColumnString(5);
-			bNeedsAcknowledgement = pStatement->getColumnInt(6) != 0;
-			sTimestampUTC = pStatement->getColumnString(7);
+		sJournalAlertIndexEntry alertEntry;
+		if (m_pAlertIndex->getAlert(sNormalizedUUID, alertEntry)) {
+			sIdentifier = alertEntry.m_sIdentifier;
+			eLevel = alertEntry.m_Level;
+			sDescription = alertEntry.m_sDescription;
+			sDescriptionIdentifier = alertEntry.m_sDescriptionIdentifier;
+			sReadableContextInformation = alertEntry.m_sReadableContextInformation;
+			bNeedsAcknowledgement = alertEntry.m_bNeedsAcknowledgement;
+			sTimestampUTC = alertEntry.m_sTimestampUTC;
 		}
 		else {
 			throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_ALERTNOTFOUND, "alert information not found: " + sNormalizedUUID);
@@ -643,23 +670,20 @@ namespace AMCData {
 		auto sNormalizedUUID = AMCCommon::CUtils::normalizeUUIDString(sUUID);
 		auto sNormalizedUserUUID = AMCCommon::CUtils::normalizeUUIDString(sUserUUID);
 
-		auto pTransaction = m_pSQLHandler->beginTransaction();
+		if (m_pAlertIndex->hasAlert(sNormalizedUUID)) {
 
-		std::string sQuery = "SELECT uuid FROM alerts WHERE uuid=?";
-		auto pStatement = pTransaction->prepareStatement(sQuery);
-		pStatement->setString(1, sNormalizedUUID);
-		if (pStatement->nextRow()) {
+			auto pTransaction = m_pSQLHandler->beginTransaction();
 
 			std::string sNewAckUUID = AMCCommon::CUtils::createUUID();
 
 			std::string sAlertQuery = "UPDATE alerts SET active=0 WHERE uuid=?";
-			auto pAlertStatement = m_pSQLHandler->prepareStatement(sAlertQuery);
+			auto pAlertStatement = pTransaction->prepareStatement(sAlertQuery);
 			pAlertStatement->setString(1, sNormalizedUUID);
 			pAlertStatement->execute();
 			pAlertStatement = nullptr;
 
 			std::string sAckQuery = "INSERT INTO alertacknowledgements (uuid, alertuuid, useruuid, usercomment, timestamp) VALUES (?, ?, ?, ?, ?)";
-			auto pStatement = m_pSQLHandler->prepareStatement(sAckQuery);
+			auto pStatement = pTransaction->prepareStatement(sAckQuery);
 			pStatement->setString(1, sNewAckUUID);
 			pStatement->setString(2, sNormalizedUUID);
 			pStatement->setString(3, sNormalizedUserUUID);
@@ -670,6 +694,8 @@ namespace AMCData {
 
 			pTransaction->commit();
 
+			m_pAlertIndex->acknowledgeAlert(sNormalizedUUID);
+
 		}
 		else {
 			throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_ALERTNOTFOUND, "alert not found for acknowledgment: " + sNormalizedUUID);
@@ -682,29 +708,14 @@ namespace AMCData {
 	{
 		auto sNormalizedUUID = AMCCommon::CUtils::normalizeUUIDString(sUUID);
 
-		std::lock_guard<std::mutex> lockGuard(m_LogMutex);
-
-		std::string sQuery = "SELECT uuid FROM alertacknowledgements WHERE alertuuid=? ORDER BY timestamp LIMIT 1";
-		auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
-		pStatement->setString(1, sNormalizedUUID);
-		return pStatement->nextRow();
+		return m_pAlertIndex->alertHasBeenAcknowledged(sNormalizedUUID);
 	}
 
 	bool CJournal::alertIsActive(const std::string& sUUID)
 	{
 		auto sNormalizedUUID = AMCCommon::CUtils::normalizeUUIDString(sUUID);
 
-		std::lock_guard<std::mutex> lockGuard(m_LogMutex);
-
-		std::string sQuery = "SELECT active FROM alerts WHERE uuid=?";
-		auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
-		pStatement->setString(1, sNormalizedUUID);
-		if (pStatement->nextRow()) {
-			return pStatement->getColumnInt(1) != 0;
-		}
-
-		return false;
-
+		return m_pAlertIndex->alertIsActive(sNormalizedUUID);
 	}
 
 
@@ -741,13 +752,7 @@ namespace AMCData {
 
 	void CJournal::retrieveActiveAlerts(std::vector<std::string>& alertUUIDs)
 	{
-		auto pTransaction = m_pSQLHandler->beginTransaction();
-		auto sQuery = "SELECT uuid FROM alerts WHERE active=? ORDER BY timestamp";
-		auto pStatement = pTransaction->prepareStatement(sQuery);
-		pStatement->setInt(1, 1);
-
-		while (pStatement->nextRow())
-			alertUUIDs.push_back(pStatement->getColumnString(1));
+		m_pAlertIndex->retrieveActiveAlerts(alertUUIDs);
 	}
 
 	void CJournal::retrieveAlertsByType(std::vector<std::string>& alertUUIDs, const std::string& sTypeIdentifier)
@@ -763,14 +768,7 @@ namespace AMCData {
 
 	void CJournal::retrieveActiveAlertsByType(std::vector<std::string>& alertUUIDs, const std::string& sTypeIdentifier)
 	{
-		auto pTransaction = m_pSQLHandler->beginTransaction();
-		auto sQuery = "SELECT uuid FROM alerts WHERE active=? AND identifier=? ORDER BY timestamp";
-		auto pStatement = pTransaction->prepareStatement(sQuery);
-		pStatement->setInt(1, 1);
-		pStatement->setString(2, sTypeIdentifier);
-
-		while (pStatement->nextRow())
-			alertUUIDs.push_back(pStatement->getColumnString(1));
+		m_pAlertIndex->retrieveActiveAlertsByType(alertUUIDs, sTypeIdentifier);
 	}
 
 	void CJournal::acknowledgeAlertForUser(const std::string& sAlertUUID, const std::string& sUserUUID, const std::string& sUserComment, const std::string& sTimeStampUTC)
@@ -795,6 +793,8 @@ namespace AMCData {
 
 		pTransaction->commit();
 
+		m_pAlertIndex->acknowledgeAlert(AMCCommon::CUtils::normalizeUUIDString(sAlertUUID));
+
 	}
 
 	void CJournal::deactivateAlert(const std::string& sAlertUUID)
@@ -807,6 +807,8 @@ namespace AMCData {
 
 		pTransaction->commit();
 
+		m_pAlertIndex->deactivateAlert(AMCCommon::CUtils::normalizeUUIDString(sAlertUUID));
+
 	}
 
 	uint64_t CJournal::getChunkIntervalInMicroseconds()
@@ -824,6 +826,21 @@ namespace AMCData {
 		return (512ULL * 1024ULL * 1024ULL); // create many 512MB files on disk
 	}
 
+	uint32_t CJournal::getChunkFormatVersion()
+	{
+		return JOURNALCHUNKFORMATVERSION_V2; // Version 1 writes raw arrays, version 2 writes delta encoded blocks per variable
+	}
+
+	bool CJournal::getChunkCompressionIsEnabled()
+	{
+		return true; // LZ4 compress version 2 blocks whenever it saves space
+	}
+
+	bool CJournal::getChunkSummariesAreEnabled()
+	{
+		return true; // store per variable min/max/sum/count with each version 2 chunk for aggregate queries
+	}
+
 
 
 }
@@ -43,6 +43,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "common_exportstream_native.hpp"
 #include "libmcdata_types.hpp"
 #include "amcdata_journalchunkdatafile.hpp"
+#include "amcdata_journalalertindex.hpp"
 
 namespace AMCData {
 
@@ -96,6 +97,8 @@ namespace AMCData {
 
 		PActiveJournalFile m_pCurrentJournalFile;
 
+		PJournalAlertIndex m_pAlertIndex;
+
 		PActiveJournalFile createJournalFile();
 
 	public:
@@ -155,6 +158,12 @@ namespace AMCData {
 
 		uint64_t getMaxChunkFileSizeQuotaInBytes ();
 
+		uint32_t getChunkFormatVersion ();
+
+		bool getChunkCompressionIsEnabled ();
+
+		bool getChunkSummariesAreEnabled ();
+
 		static std::string convertDataTypeToString(LibMCData::eParameterDataType dataType);
 
 		static LibMCData::eParameterDataType convertStringToDataType(const std::string & sValue);
@@ -0,0 +1,154 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "amcdata_journalalertindex.hpp"
+
+namespace AMCData {
+
+	CJournalAlertIndex::CJournalAlertIndex()
+	{
+
+	}
+
+	CJournalAlertIndex::~CJournalAlertIndex()
+	{
+
+	}
+
+	void CJournalAlertIndex::addAlert(const std::string& sUUID, const sJournalAlertIndexEntry& entry)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+		auto& newEntry = m_Alerts[sUUID];
+		newEntry = entry;
+		newEntry.m_bActive = true;
+		newEntry.m_bAcknowledged = false;
+
+		m_ActiveAlerts[std::make_pair(entry.m_sTimestampUTC, entry.m_nAlertIndex)] = sUUID;
+	}
+
+	bool CJournalAlertIndex::hasAlert(const std::string& sUUID)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		return m_Alerts.find(sUUID) != m_Alerts.end();
+	}
+
+	bool CJournalAlertIndex::getAlert(const std::string& sUUID, sJournalAlertIndexEntry& entry)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		auto iIter = m_Alerts.find(sUUID);
+		if (iIter == m_Alerts.end())
+			return false;
+
+		entry = iIter->second;
+		return true;
+	}
+
+	bool CJournalAlertIndex::alertIsActive(const std::string& sUUID)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		auto iIter = m_Alerts.find(sUUID);
+		if (iIter == m_Alerts.end())
+			return false;
+
+		return iIter->second.m_bActive;
+	}
+
+	bool CJournalAlertIndex::alertHasBeenAcknowledged(const std::string& sUUID)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		auto iIter = m_Alerts.find(sUUID);
+		if (iIter == m_Alerts.end())
+			return false;
+
+		return iIter->second.m_bAcknowledged;
+	}
+
+	bool CJournalAlertIndex::deactivateAlert(const std::string& sUUID)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		auto iIter = m_Alerts.find(sUUID);
+		if (iIter == m_Alerts.end())
+			return false;
+
+		auto& entry = iIter->second;
+		if (entry.m_bActive) {
+			m_ActiveAlerts.erase(std::make_pair(entry.m_sTimestampUTC, entry.m_nAlertIndex));
+			entry.m_bActive = false;
+		}
+
+		return true;
+	}
+
+	bool CJournalAlertIndex::acknowledgeAlert(const std::string& sUUID)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		auto iIter = m_Alerts.find(sUUID);
+		if (iIter == m_Alerts.end())
+			return false;
+
+		auto& entry = iIter->second;
+		if (entry.m_bActive) {
+			m_ActiveAlerts.erase(std::make_pair(entry.m_sTimestampUTC, entry.m_nAlertIndex));
+			entry.m_bActive = false;
+		}
+		entry.m_bAcknowledged = true;
+
+		return true;
+	}
+
+	void CJournalAlertIndex::retrieveActiveAlerts(std::vector<std::string>& alertUUIDs)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		alertUUIDs.reserve(alertUUIDs.size() + m_ActiveAlerts.size());
+		for (auto& iIter : m_ActiveAlerts)
+			alertUUIDs.push_back(iIter.second);
+	}
+
+	void CJournalAlertIndex::retrieveActiveAlertsByType(std::vector<std::string>& alertUUIDs, const std::string& sTypeIdentifier)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		for (auto& iIter : m_ActiveAlerts) {
+			auto iAlertIter = m_Alerts.find(iIter.second);
+			if ((iAlertIter != m_Alerts.end()) && (iAlertIter->second.m_sIdentifier == sTypeIdentifier))
+				alertUUIDs.push_back(iIter.second);
+		}
+	}
+
+	uint32_t CJournalAlertIndex::getActiveAlertCount()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		return (uint32_t)m_ActiveAlerts.size();
+	}
+
+
+}
+
+
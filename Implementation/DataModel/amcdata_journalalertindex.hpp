@@ -0,0 +1,108 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class declaration of CJournalAlertIndex
+
+*/
+
+
+#ifndef __LIBMCDATA_JOURNALALERTINDEX
+#define __LIBMCDATA_JOURNALALERTINDEX
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+
+#include "libmcdata_types.hpp"
+
+namespace AMCData {
+
+	typedef struct {
+		std::string m_sIdentifier;
+		LibMCData::eAlertLevel m_Level;
+		std::string m_sDescription;
+		std::string m_sDescriptionIdentifier;
+		std::string m_sReadableContextInformation;
+		bool m_bNeedsAcknowledgement;
+		std::string m_sTimestampUTC;
+		uint32_t m_nAlertIndex;
+		bool m_bActive;
+		bool m_bAcknowledged;
+	} sJournalAlertIndexEntry;
+
+	// In-memory state of all alerts raised in the current journal session.
+	// Existence, activity and acknowledgement queries are answered from here,
+	// the alerts table is only written for persistence.
+	class CJournalAlertIndex {
+	private:
+
+		std::mutex m_Mutex;
+
+		std::unordered_map<std::string, sJournalAlertIndexEntry> m_Alerts;
+
+		// Active alerts, in the same order as the alerts table sorted by timestamp.
+		std::map<std::pair<std::string, uint32_t>, std::string> m_ActiveAlerts;
+
+	public:
+
+		CJournalAlertIndex();
+
+		virtual ~CJournalAlertIndex();
+
+		// UUIDs must be normalized. The entry's active and acknowledged flags are ignored.
+		void addAlert(const std::string& sUUID, const sJournalAlertIndexEntry& entry);
+
+		bool hasAlert(const std::string& sUUID);
+
+		// Returns false if the alert does not exist.
+		bool getAlert(const std::string& sUUID, sJournalAlertIndexEntry& entry);
+
+		bool alertIsActive(const std::string& sUUID);
+
+		bool alertHasBeenAcknowledged(const std::string& sUUID);
+
+		bool deactivateAlert(const std::string& sUUID);
+		bool acknowledgeAlert(const std::string& sUUID);
+
+		void retrieveActiveAlerts(std::vector<std::string>& alertUUIDs);
+		void retrieveActiveAlertsByType(std::vector<std::string>& alertUUIDs, const std::string& sTypeIdentifier);
+
+		uint32_t getActiveAlertCount();
+
+	};
+
+	typedef std::shared_ptr<CJournalAlertIndex> PJournalAlertIndex;
+
+} // namespace AMCData
+
+
+#endif // __LIBMCDATA_JOURNALALERTINDEX
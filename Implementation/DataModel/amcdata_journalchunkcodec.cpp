@@ -0,0 +1,341 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "amcdata_journalchunkcodec.hpp"
+#include "amcdata_journalchunkdatafile.hpp"
+#include "libmcdata_interfaceexception.hpp"
+
+#include "lz4/lz4.h"
+
+#include <cstring>
+#include <limits>
+
+namespace AMCData {
+
+
+    static inline uint64_t zigZagEncode(int64_t nValue)
+    {
+        return ((uint64_t)nValue << 1) ^ (uint64_t)(nValue >> 63);
+    }
+
+    static inline int64_t zigZagDecode(uint64_t nValue)
+    {
+        return (int64_t)(nValue >> 1) ^ -(int64_t)(nValue & 1);
+    }
+
+
+    void CJournalChunkCodec::writeVarInt(std::vector<uint8_t>& buffer, uint64_t nValue)
+    {
+        while (nValue >= 0x80) {
+            buffer.push_back((uint8_t)(nValue | 0x80));
+            nValue >>= 7;
+        }
+        buffer.push_back((uint8_t)nValue);
+    }
+
+    uint64_t CJournalChunkCodec::readVarInt(const uint8_t*& pData, const uint8_t* pDataEnd)
+    {
+        uint64_t nValue = 0;
+        uint32_t nShift = 0;
+
+        while (pData < pDataEnd) {
+            uint8_t nByte = *pData;
+            pData++;
+
+            nValue |= (uint64_t)(nByte & 0x7f) << nShift;
+            if ((nByte & 0x80) == 0)
+                return nValue;
+
+            nShift += 7;
+            if (nShift >= 64)
+                break;
+        }
+
+        throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDJOURNALCHUNKENCODING);
+    }
+
+
+    void CJournalChunkCodec::encodeChunk(const LibMCData::sJournalChunkVariableInfo* pVariableInfo, uint64_t nVariableCount, const uint32_t* pTimeStampData, const int64_t* pValueData, uint64_t nValueCount, bool bCompressBlocks, bool bWriteSummaries, std::vector<uint8_t>& chunkBuffer)
+    {
+        if ((pVariableInfo == nullptr) || (pTimeStampData == nullptr) || (pValueData == nullptr))
+            throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
+        if ((nVariableCount == 0) || (nVariableCount > std::numeric_limits<uint32_t>::max ()))
+            throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
+        if ((nValueCount == 0) || (nValueCount > std::numeric_limits<uint32_t>::max()))
+            throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
+
+        uint64_t nVariableInfoSize = nVariableCount * sizeof(LibMCData::sJournalChunkVariableInfo);
+        uint64_t nDirectorySize = nVariableCount * sizeof(sJournalChunkBlockEntry);
+        uint64_t nSummarySize = bWriteSummaries ? (nVariableCount * sizeof(LibMCData::sJournalChunkVariableSummary)) : 0;
+
+        chunkBuffer.clear();
+        chunkBuffer.resize(sizeof(sJournalChunkHeader) + nVariableInfoSize + nDirectorySize + nSummarySize);
+        memcpy(chunkBuffer.data() + sizeof(sJournalChunkHeader), pVariableInfo, nVariableInfoSize);
+
+        std::vector<sJournalChunkBlockEntry> blockDirectory;
+        blockDirectory.resize(nVariableCount);
+
+        std::vector<LibMCData::sJournalChunkVariableSummary> summaries;
+        if (bWriteSummaries)
+            summaries.resize(nVariableCount);
+
+        std::vector<uint8_t> encodedBlock;
+        std::vector<uint8_t> compressedBlock;
+
+        for (uint64_t nVariableListIndex = 0; nVariableListIndex < nVariableCount; nVariableListIndex++) {
+            auto& variableInfo = pVariableInfo[nVariableListIndex];
+            uint64_t nStartIndex = variableInfo.m_EntryStartIndex;
+            uint64_t nEntryCount = variableInfo.m_EntryCount;
+            if ((nStartIndex > nValueCount) || (nEntryCount > (nValueCount - nStartIndex)))
+                throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
+
+            if (bWriteSummaries)
+                computeVariableSummary(variableInfo.m_VariableIndex, pTimeStampData + nStartIndex, pValueData + nStartIndex, (uint32_t)nEntryCount, summaries.at(nVariableListIndex));
+
+            encodedBlock.clear();
+
+            int64_t nPreviousTimeStamp = 0;
+            int64_t nPreviousTimeStampDelta = 0;
+            for (uint64_t nIndex = 0; nIndex < nEntryCount; nIndex++) {
+                int64_t nTimeStamp = pTimeStampData[nStartIndex + nIndex];
+                int64_t nTimeStampDelta = nTimeStamp - nPreviousTimeStamp;
+                writeVarInt(encodedBlock, zigZagEncode(nTimeStampDelta - nPreviousTimeStampDelta));
+                nPreviousTimeStamp = nTimeStamp;
+                nPreviousTimeStampDelta = nTimeStampDelta;
+            }
+
+            uint64_t nPreviousValue = 0;
+            for (uint64_t nIndex = 0; nIndex < nEntryCount; nIndex++) {
+                uint64_t nValue = (uint64_t)pValueData[nStartIndex + nIndex];
+                writeVarInt(encodedBlock, zigZagEncode((int64_t)(nValue - nPreviousValue)));
+                nPreviousValue = nValue;
+            }
+
+            if (encodedBlock.size() > (uint64_t)std::numeric_limits<int32_t>::max())
+                throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_COULDNOTCOMPRESSJOURNALCHUNK);
+
+            auto& blockEntry = blockDirectory.at(nVariableListIndex);
+            blockEntry.m_nBlockOffset = (uint32_t)chunkBuffer.size();
+            blockEntry.m_nEncodedSize = (uint32_t)encodedBlock.size();
+            blockEntry.m_nStoredSize = (uint32_t)encodedBlock.size();
+            blockEntry.m_nFlags = 0;
+
+            bool bStoreCompressed = false;
+            if (bCompressBlocks && (encodedBlock.size() > 0)) {
+                int nBound = LZ4_compressBound((int)encodedBlock.size());
+                if (nBound <= 0)
+                    throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_COULDNOTCOMPRESSJOURNALCHUNK);
+
+                compressedBlock.resize(nBound);
+                int nCompressedSize = LZ4_compress_default((const char*)encodedBlock.data(), (char*)compressedBlock.data(), (int)encodedBlock.size(), nBound);
+                if (nCompressedSize <= 0)
+                    throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_COULDNOTCOMPRESSJOURNALCHUNK);
+
+                // Only keep the compressed block if it actually saves space
+                if ((size_t)nCompressedSize < encodedBlock.size()) {
+                    blockEntry.m_nStoredSize = (uint32_t)nCompressedSize;
+                    blockEntry.m_nFlags |= JOURNALCHUNKBLOCKFLAG_LZ4;
+                    chunkBuffer.insert(chunkBuffer.end(), compressedBlock.begin(), compressedBlock.begin() + nCompressedSize);
+                    bStoreCompressed = true;
+                }
+            }
+
+            if (!bStoreCompressed)
+                chunkBuffer.insert(chunkBuffer.end(), encodedBlock.begin(), encodedBlock.end());
+
+            if (chunkBuffer.size() > std::numeric_limits<uint32_t>::max())
+                throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_JOURNALMEMORYSIZEMISMATCH);
+        }
+
+        memcpy(chunkBuffer.data() + sizeof(sJournalChunkHeader) + nVariableInfoSize, blockDirectory.data(), nDirectorySize);
+        if (bWriteSummaries)
+            memcpy(chunkBuffer.data() + sizeof(sJournalChunkHeader) + nVariableInfoSize + nDirectorySize, summaries.data(), nSummarySize);
+
+        sJournalChunkHeader chunkHeader;
+        memset((void*)&chunkHeader, 0, sizeof(sJournalChunkHeader));
+        chunkHeader.m_nSignature = JOURNALSIGNATURE_INTEGERDATA_V2;
+        chunkHeader.m_nFlags = bWriteSummaries ? JOURNALCHUNKFLAG_SUMMARIES : 0;
+        chunkHeader.m_nMemorySize = (uint32_t)chunkBuffer.size();
+        chunkHeader.m_nVariableCount = (uint32_t)nVariableCount;
+        chunkHeader.m_nValueCount = (uint32_t)nValueCount;
+        memcpy(chunkBuffer.data(), &chunkHeader, sizeof(chunkHeader));
+    }
+
+
+    const LibMCData::sJournalChunkVariableInfo* CJournalChunkCodec::getVariableInfo(const uint8_t* pChunkData, uint64_t nChunkLength, uint32_t& nVariableCount, uint32_t& nValueCount)
+    {
+        if (pChunkData == nullptr)
+            throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
+        if (nChunkLength < sizeof(sJournalChunkHeader))
+            throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_JOURNALMEMORYSIZEMISMATCH);
+
+        sJournalChunkHeader chunkHeader;
+        memcpy(&chunkHeader, pChunkData, sizeof(chunkHeader));
+        if (chunkHeader.m_nSignature != JOURNALSIGNATURE_INTEGERDATA_V2)
+            throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDJOURNALDATASIGNATURE);
+        if (chunkHeader.m_nMemorySize != nChunkLength)
+            throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_JOURNALMEMORYSIZEMISMATCH);
+        if (chunkHeader.m_nVariableCount == 0)
+            throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_JOURNALMEMORYVARIABLECOUNTISZERO);
+        if (chunkHeader.m_nValueCount == 0)
+            throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_JOURNALMEMORYVALUECOUNTISZERO);
+
+        uint64_t nTableSize = (uint64_t)chunkHeader.m_nVariableCount * (sizeof(LibMCData::sJournalChunkVariableInfo) + sizeof(sJournalChunkBlockEntry));
+        if ((chunkHeader.m_nFlags & JOURNALCHUNKFLAG_SUMMARIES) != 0)
+            nTableSize += (uint64_t)chunkHeader.m_nVariableCount * sizeof(LibMCData::sJournalChunkVariableSummary);
+        if ((sizeof(sJournalChunkHeader) + nTableSize) > nChunkLength)
+            throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_JOURNALMEMORYSIZEMISMATCH);
+
+        nVariableCount = chunkHeader.m_nVariableCount;
+        nValueCount = chunkHeader.m_nValueCount;
+
+        return (const LibMCData::sJournalChunkVariableInfo*)(pChunkData + sizeof(sJournalChunkHeader));
+    }
+
+
+    void CJournalChunkCodec::computeVariableSummary(uint32_t nVariableIndex, const uint32_t* pTimeStampData, const int64_t* pValueData, uint32_t nEntryCount, LibMCData::sJournalChunkVariableSummary& summary)
+    {
+        memset((void*)&summary, 0, sizeof(summary));
+        summary.m_VariableIndex = nVariableIndex;
+        summary.m_EntryCount = nEntryCount;
+        if (nEntryCount == 0)
+            return;
+
+        if ((pTimeStampData == nullptr) || (pValueData == nullptr))
+            throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
+
+        int64_t nMinValue = pValueData[0];
+        int64_t nMaxValue = pValueData[0];
+        double dValueSum = 0.0;
+        for (uint32_t nIndex = 0; nIndex < nEntryCount; nIndex++) {
+            int64_t nValue = pValueData[nIndex];
+            if (nValue < nMinValue)
+                nMinValue = nValue;
+            if (nValue > nMaxValue)
+                nMaxValue = nValue;
+            dValueSum += (double)nValue;
+        }
+
+        summary.m_FirstTimeStamp = pTimeStampData[0];
+        summary.m_LastTimeStamp = pTimeStampData[nEntryCount - 1];
+        summary.m_MinValue = nMinValue;
+        summary.m_MaxValue = nMaxValue;
+        summary.m_LastValue = pValueData[nEntryCount - 1];
+        summary.m_ValueSum = dValueSum;
+    }
+
+
+    bool CJournalChunkCodec::getVariableSummaries(const uint8_t* pChunkData, uint64_t nChunkLength, std::vector<LibMCData::sJournalChunkVariableSummary>& summaries)
+    {
+        uint32_t nVariableCount = 0;
+        uint32_t nValueCount = 0;
+        getVariableInfo(pChunkData, nChunkLength, nVariableCount, nValueCount);
+
+        sJournalChunkHeader chunkHeader;
+        memcpy(&chunkHeader, pChunkData, sizeof(chunkHeader));
+        if ((chunkHeader.m_nFlags & JOURNALCHUNKFLAG_SUMMARIES) == 0)
+            return false;
+
+        uint64_t nSummaryOffset = sizeof(sJournalChunkHeader) + (uint64_t)nVariableCount * (sizeof(LibMCData::sJournalChunkVariableInfo) + sizeof(sJournalChunkBlockEntry));
+        summaries.resize(nVariableCount);
+        memcpy(summaries.data(), pChunkData + nSummaryOffset, (size_t)nVariableCount * sizeof(LibMCData::sJournalChunkVariableSummary));
+
+        return true;
+    }
+
+
+    void CJournalChunkCodec::decodeVariableBlock(const uint8_t* pChunkData, uint64_t nChunkLength, uint32_t nVariableListIndex, uint32_t* pTimeStampData, int64_t* pValueData)
+    {
+        uint32_t nVariableCount = 0;
+        uint32_t nValueCount = 0;
+        auto pVariableInfo = getVariableInfo(pChunkData, nChunkLength, nVariableCount, nValueCount);
+        if (nVariableListIndex >= nVariableCount)
+            throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
+
+        LibMCData::sJournalChunkVariableInfo variableInfo;
+        memcpy(&variableInfo, &pVariableInfo[nVariableListIndex], sizeof(variableInfo));
+
+        sJournalChunkBlockEntry blockEntry;
+        const uint8_t* pDirectory = pChunkData + sizeof(sJournalChunkHeader) + (uint64_t)nVariableCount * sizeof(LibMCData::sJournalChunkVariableInfo);
+        memcpy(&blockEntry, pDirectory + (uint64_t)nVariableListIndex * sizeof(sJournalChunkBlockEntry), sizeof(blockEntry));
+
+        if ((blockEntry.m_nBlockOffset > nChunkLength) || (blockEntry.m_nStoredSize > (nChunkLength - blockEntry.m_nBlockOffset)))
+            throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDJOURNALCHUNKENCODING);
+
+        uint32_t nEntryCount = variableInfo.m_EntryCount;
+        if (nEntryCount == 0)
+            return;
+
+        if ((pTimeStampData == nullptr) || (pValueData == nullptr))
+            throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
+
+        const uint8_t* pBlockData = pChunkData + blockEntry.m_nBlockOffset;
+        std::vector<uint8_t> decompressedBlock;
+
+        if ((blockEntry.m_nFlags & JOURNALCHUNKBLOCKFLAG_LZ4) != 0) {
+            if (blockEntry.m_nEncodedSize > (uint32_t)std::numeric_limits<int32_t>::max())
+                throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDJOURNALCHUNKENCODING);
+
+            decompressedBlock.resize(blockEntry.m_nEncodedSize);
+            int nDecompressedSize = LZ4_decompress_safe((const char*)pBlockData, (char*)decompressedBlock.data(), (int)blockEntry.m_nStoredSize, (int)blockEntry.m_nEncodedSize);
+            if (nDecompressedSize != (int)blockEntry.m_nEncodedSize)
+                throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDJOURNALCHUNKENCODING);
+
+            pBlockData = decompressedBlock.data();
+        }
+        else {
+            if (blockEntry.m_nEncodedSize != blockEntry.m_nStoredSize)
+                throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDJOURNALCHUNKENCODING);
+        }
+
+        const uint8_t* pBlockEnd = pBlockData + blockEntry.m_nEncodedSize;
+
+        int64_t nTimeStamp = 0;
+        int64_t nTimeStampDelta = 0;
+        for (uint32_t nIndex = 0; nIndex < nEntryCount; nIndex++) {
+            nTimeStampDelta += zigZagDecode(readVarInt(pBlockData, pBlockEnd));
+            nTimeStamp += nTimeStampDelta;
+            if ((nTimeStamp < 0) || (nTimeStamp > (int64_t)std::numeric_limits<uint32_t>::max()))
+                throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDJOURNALCHUNKENCODING);
+            pTimeStampData[nIndex] = (uint32_t)nTimeStamp;
+        }
+
+        uint64_t nValue = 0;
+        for (uint32_t nIndex = 0; nIndex < nEntryCount; nIndex++) {
+            nValue += (uint64_t)zigZagDecode(readVarInt(pBlockData, pBlockEnd));
+            pValueData[nIndex] = (int64_t)nValue;
+        }
+
+        if (pBlockData != pBlockEnd)
+            throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDJOURNALCHUNKENCODING);
+    }
+
+
+}
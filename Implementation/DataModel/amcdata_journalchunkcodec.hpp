@@ -0,0 +1,96 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class declaration of CJournalChunkCodec
+
+*/
+
+
+#ifndef __LIBMCDATA_JOURNALCHUNKCODEC
+#define __LIBMCDATA_JOURNALCHUNKCODEC
+
+#include "libmcdata_interfaces.hpp"
+#include <vector>
+
+namespace AMCData {
+
+
+// Version 2 chunks store one encoded block per variable:
+//   sJournalChunkHeader | sJournalChunkVariableInfo[VariableCount] | sJournalChunkBlockEntry[VariableCount] | blocks
+// Each block holds the variable's time stamps as zigzag varints of their delta-of-delta,
+// followed by the values as zigzag varints of their delta. Blocks that shrink under LZ4 are stored compressed.
+// If the header carries JOURNALCHUNKFLAG_SUMMARIES, a sJournalChunkVariableSummary[VariableCount] table
+// follows the block directory, so that aggregate queries do not need to decode the blocks.
+#define JOURNALSIGNATURE_INTEGERDATA_V2 0x83AC1002
+
+#define JOURNALCHUNKFORMATVERSION_V2 2
+
+#define JOURNALCHUNKFLAG_SUMMARIES 0x00000001
+
+#define JOURNALCHUNKBLOCKFLAG_LZ4 0x00000001
+
+    typedef struct {
+        uint32_t m_nBlockOffset;
+        uint32_t m_nStoredSize;
+        uint32_t m_nEncodedSize;
+        uint32_t m_nFlags;
+    } sJournalChunkBlockEntry;
+
+
+    class CJournalChunkCodec
+    {
+    private:
+
+        static void writeVarInt(std::vector<uint8_t>& buffer, uint64_t nValue);
+
+        static uint64_t readVarInt(const uint8_t*& pData, const uint8_t* pDataEnd);
+
+    public:
+
+        static void encodeChunk(const LibMCData::sJournalChunkVariableInfo* pVariableInfo, uint64_t nVariableCount, const uint32_t* pTimeStampData, const int64_t* pValueData, uint64_t nValueCount, bool bCompressBlocks, bool bWriteSummaries, std::vector<uint8_t>& chunkBuffer);
+
+        // Computes count, extrema, sum and last entry of a variable's entries.
+        static void computeVariableSummary(uint32_t nVariableIndex, const uint32_t* pTimeStampData, const int64_t* pValueData, uint32_t nEntryCount, LibMCData::sJournalChunkVariableSummary& summary);
+
+        // Validates the header and directory of a version 2 chunk and returns a pointer to its variable info array.
+        static const LibMCData::sJournalChunkVariableInfo* getVariableInfo(const uint8_t* pChunkData, uint64_t nChunkLength, uint32_t & nVariableCount, uint32_t & nValueCount);
+
+        // Copies the stored summary table of a version 2 chunk. Returns false if the chunk has been written without summaries.
+        static bool getVariableSummaries(const uint8_t* pChunkData, uint64_t nChunkLength, std::vector<LibMCData::sJournalChunkVariableSummary>& summaries);
+
+        // Decodes the block of a single variable into the given arrays, which must hold the variable's entry count.
+        static void decodeVariableBlock(const uint8_t* pChunkData, uint64_t nChunkLength, uint32_t nVariableListIndex, uint32_t* pTimeStampData, int64_t* pValueData);
+
+    };
+
+
+} // namespace AMCData
+
+
+#endif // __LIBMCDATA_JOURNALCHUNKCODEC
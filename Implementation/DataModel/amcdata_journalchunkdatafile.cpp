@@ -29,6 +29,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "amcdata_journalchunkdatafile.hpp"
+#include "amcdata_journalchunkcodec.hpp"
 #include "libmcdata_interfaceexception.hpp"
 #include "common_utils.hpp"
 #include "common_exportstream_native.hpp"
@@ -52,14 +53,163 @@ namespace AMCData {
     }
 
 
+    const uint8_t* CJournalChunkDataFile::mapBuffer(uint64_t nDataOffset, uint64_t nDataLength)
+    {
+        return nullptr;
+    }
+
+
+    const uint8_t* CJournalChunkDataFile::acquireChunkData(size_t nDataOffset, size_t nDataLength, std::vector<uint8_t>& scratchBuffer)
+    {
+        const uint8_t* pChunkData = mapBuffer(nDataOffset, nDataLength);
+        if (pChunkData != nullptr)
+            return pChunkData;
+
+        scratchBuffer.resize(nDataLength);
+        readBuffer(nDataOffset, scratchBuffer.data(), nDataLength);
+        return scratchBuffer.data();
+    }
+
+
     void CJournalChunkDataFile::readJournalChunkIntegerData(size_t nDataOffset, size_t nDataLength, std::vector<LibMCData::sJournalChunkVariableInfo>& variableInfo, std::vector<uint32_t>& timeStampData, std::vector<int64_t>& valueData)
     {
         AMCData::sJournalChunkHeader chunkHeader;
 
         readBuffer(nDataOffset, (uint8_t*)&chunkHeader, sizeof(chunkHeader));
-        if (chunkHeader.m_nSignature != JOURNALSIGNATURE_INTEGERDATA_V1)
+        switch (chunkHeader.m_nSignature) {
+        case JOURNALSIGNATURE_INTEGERDATA_V1:
+            readJournalChunkIntegerDataV1(chunkHeader, nDataOffset, nDataLength, variableInfo, timeStampData, valueData);
+            break;
+
+        case JOURNALSIGNATURE_INTEGERDATA_V2: {
+            std::vector<uint8_t> scratchBuffer;
+            const uint8_t* pChunkData = acquireChunkData(nDataOffset, nDataLength, scratchBuffer);
+
+            uint32_t nVariableCount = 0;
+            uint32_t nValueCount = 0;
+            auto pVariableInfo = CJournalChunkCodec::getVariableInfo(pChunkData, nDataLength, nVariableCount, nValueCount);
+
+            variableInfo.resize(nVariableCount);
+            memcpy(variableInfo.data(), pVariableInfo, (size_t)nVariableCount * sizeof(LibMCData::sJournalChunkVariableInfo));
+
+            timeStampData.resize(nValueCount);
+            valueData.resize(nValueCount);
+
+            for (uint32_t nVariableListIndex = 0; nVariableListIndex < nVariableCount; nVariableListIndex++) {
+                auto& info = variableInfo.at(nVariableListIndex);
+                if (((uint64_t)info.m_EntryStartIndex + info.m_EntryCount) > nValueCount)
+                    throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDJOURNALCHUNKENCODING);
+
+                CJournalChunkCodec::decodeVariableBlock(pChunkData, nDataLength, nVariableListIndex, timeStampData.data() + info.m_EntryStartIndex, valueData.data() + info.m_EntryStartIndex);
+            }
+
+            break;
+        }
+
+        default:
             throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDJOURNALDATASIGNATURE);
+        }
+
+    }
+
+
+    bool CJournalChunkDataFile::readJournalChunkVariableData(size_t nDataOffset, size_t nDataLength, uint32_t nVariableIndex, std::vector<uint32_t>& timeStampData, std::vector<int64_t>& valueData)
+    {
+        timeStampData.clear();
+        valueData.clear();
 
+        AMCData::sJournalChunkHeader chunkHeader;
+        readBuffer(nDataOffset, (uint8_t*)&chunkHeader, sizeof(chunkHeader));
+
+        if (chunkHeader.m_nSignature == JOURNALSIGNATURE_INTEGERDATA_V1) {
+            // Version 1 chunks are stored uncompressed, so only the variable info and the slice of the variable need to be read.
+            if (chunkHeader.m_nMemorySize != nDataLength)
+                throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_JOURNALMEMORYSIZEMISMATCH);
+            if (chunkHeader.m_nVariableCount == 0)
+                throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_JOURNALMEMORYVARIABLECOUNTISZERO);
+
+            std::vector<LibMCData::sJournalChunkVariableInfo> variableInfo;
+            variableInfo.resize(chunkHeader.m_nVariableCount);
+            uint64_t nVariableBufferMemSize = (uint64_t)chunkHeader.m_nVariableCount * sizeof(LibMCData::sJournalChunkVariableInfo);
+            uint64_t nTimeStampStart = nDataOffset + sizeof(chunkHeader) + nVariableBufferMemSize;
+            uint64_t nValueStart = nTimeStampStart + (uint64_t)chunkHeader.m_nValueCount * sizeof(uint32_t);
+            readBuffer(nDataOffset + sizeof(chunkHeader), (uint8_t*)variableInfo.data(), nVariableBufferMemSize);
+
+            for (auto& info : variableInfo) {
+                if (info.m_VariableIndex == nVariableIndex) {
+                    if (((uint64_t)info.m_EntryStartIndex + info.m_EntryCount) > chunkHeader.m_nValueCount)
+                        throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_JOURNALMEMORYSIZEMISMATCH);
+
+                    timeStampData.resize(info.m_EntryCount);
+                    valueData.resize(info.m_EntryCount);
+                    readBuffer(nTimeStampStart + (uint64_t)info.m_EntryStartIndex * sizeof(uint32_t), (uint8_t*)timeStampData.data(), (uint64_t)info.m_EntryCount * sizeof(uint32_t));
+                    readBuffer(nValueStart + (uint64_t)info.m_EntryStartIndex * sizeof(int64_t), (uint8_t*)valueData.data(), (uint64_t)info.m_EntryCount * sizeof(int64_t));
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        if (chunkHeader.m_nSignature != JOURNALSIGNATURE_INTEGERDATA_V2)
+            throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDJOURNALDATASIGNATURE);
+
+        std::vector<uint8_t> scratchBuffer;
+        const uint8_t* pChunkData = acquireChunkData(nDataOffset, nDataLength, scratchBuffer);
+
+        uint32_t nVariableCount = 0;
+        uint32_t nValueCount = 0;
+        auto pVariableInfo = CJournalChunkCodec::getVariableInfo(pChunkData, nDataLength, nVariableCount, nValueCount);
+
+        for (uint32_t nVariableListIndex = 0; nVariableListIndex < nVariableCount; nVariableListIndex++) {
+            LibMCData::sJournalChunkVariableInfo info;
+            memcpy(&info, &pVariableInfo[nVariableListIndex], sizeof(info));
+
+            if (info.m_VariableIndex == nVariableIndex) {
+                timeStampData.resize(info.m_EntryCount);
+                valueData.resize(info.m_EntryCount);
+                CJournalChunkCodec::decodeVariableBlock(pChunkData, nDataLength, nVariableListIndex, timeStampData.data(), valueData.data());
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+
+    void CJournalChunkDataFile::readJournalChunkSummaries(size_t nDataOffset, size_t nDataLength, std::vector<LibMCData::sJournalChunkVariableSummary>& summaries)
+    {
+        summaries.clear();
+
+        AMCData::sJournalChunkHeader chunkHeader;
+        readBuffer(nDataOffset, (uint8_t*)&chunkHeader, sizeof(chunkHeader));
+
+        if ((chunkHeader.m_nSignature == JOURNALSIGNATURE_INTEGERDATA_V2) && ((chunkHeader.m_nFlags & JOURNALCHUNKFLAG_SUMMARIES) != 0)) {
+            std::vector<uint8_t> scratchBuffer;
+            const uint8_t* pChunkData = acquireChunkData(nDataOffset, nDataLength, scratchBuffer);
+            if (CJournalChunkCodec::getVariableSummaries(pChunkData, nDataLength, summaries))
+                return;
+        }
+
+        // Chunk has been written without summaries, so the entries need to be decoded.
+        std::vector<LibMCData::sJournalChunkVariableInfo> variableInfo;
+        std::vector<uint32_t> timeStampData;
+        std::vector<int64_t> valueData;
+        readJournalChunkIntegerData(nDataOffset, nDataLength, variableInfo, timeStampData, valueData);
+
+        summaries.resize(variableInfo.size());
+        for (size_t nVariableListIndex = 0; nVariableListIndex < variableInfo.size(); nVariableListIndex++) {
+            auto& info = variableInfo.at(nVariableListIndex);
+            if (((uint64_t)info.m_EntryStartIndex + info.m_EntryCount) > valueData.size())
+                throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_JOURNALMEMORYSIZEMISMATCH);
+
+            CJournalChunkCodec::computeVariableSummary(info.m_VariableIndex, timeStampData.data() + info.m_EntryStartIndex, valueData.data() + info.m_EntryStartIndex, info.m_EntryCount, summaries.at(nVariableListIndex));
+        }
+    }
+
+
+    void CJournalChunkDataFile::readJournalChunkIntegerDataV1(const sJournalChunkHeader& chunkHeader, size_t nDataOffset, size_t nDataLength, std::vector<LibMCData::sJournalChunkVariableInfo>& variableInfo, std::vector<uint32_t>& timeStampData, std::vector<int64_t>& valueData)
+    {
         if (chunkHeader.m_nMemorySize != nDataLength)
             throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_JOURNALMEMORYSIZEMISMATCH);
 
@@ -44,18 +44,27 @@ namespace AMCData {
 
 #define JOURNALSIGNATURE_INTEGERDATA_V1 0x83AC1001
 
+#define JOURNALCHUNKFORMATVERSION_V1 1
+
     typedef struct {
         uint32_t m_nSignature;
         uint32_t m_nMemorySize;
         uint32_t m_nVariableCount;
         uint32_t m_nValueCount;
-        uint32_t m_nReserved[3];
+        uint32_t m_nFlags;
+        uint32_t m_nReserved[2];
     } sJournalChunkHeader;
 
 
     class CJournalChunkDataFile
     {
     private:
+
+        void readJournalChunkIntegerDataV1(const sJournalChunkHeader& chunkHeader, size_t nDataOffset, size_t nDataLength, std::vector<LibMCData::sJournalChunkVariableInfo>& variableInfo, std::vector<uint32_t>& timeStampData, std::vector<int64_t>& valueData);
+
+        // Returns a pointer to the complete chunk, either directly from a mapping or copied into the scratch buffer.
+        const uint8_t* acquireChunkData(size_t nDataOffset, size_t nDataLength, std::vector<uint8_t>& scratchBuffer);
+
     public:
 
         CJournalChunkDataFile();
@@ -64,8 +73,18 @@ namespace AMCData {
 
         virtual void readBuffer(uint64_t nDataOffset, uint8_t* pBuffer, uint64_t nDataLength) = 0;
 
+        // Returns a pointer to the data range if the file is memory mapped, nullptr otherwise.
+        virtual const uint8_t* mapBuffer(uint64_t nDataOffset, uint64_t nDataLength);
+
+        // Reads all variables of a chunk. Supports all chunk format versions.
         void readJournalChunkIntegerData(size_t nDataOffset, size_t nDataLength, std::vector<LibMCData::sJournalChunkVariableInfo>& variableInfo, std::vector<uint32_t>& timeStampData, std::vector<int64_t>& valueData);
 
+        // Reads the entries of a single variable of a chunk. Returns false if the variable is not contained in the chunk.
+        bool readJournalChunkVariableData(size_t nDataOffset, size_t nDataLength, uint32_t nVariableIndex, std::vector<uint32_t>& timeStampData, std::vector<int64_t>& valueData);
+
+        // Reads the per variable summaries of a chunk. Chunks that were written without summaries are decoded and summarized on the fly.
+        void readJournalChunkSummaries(size_t nDataOffset, size_t nDataLength, std::vector<LibMCData::sJournalChunkVariableSummary>& summaries);
+
     };
 
 
@@ -234,6 +234,7 @@ namespace AMCData {
 	{
 		m_pExportStream = std::make_shared<AMCCommon::CExportStream_Native>(sPath);
 		m_pPortableZIPWriter = std::make_shared<AMCCommon::CPortableZIPWriter>(m_pExportStream, true);
+		m_pPortableZIPWriter->setStoreCompressedFileTypes(true);
 	}
 
 	CStorageWriter_ZIPStream::~CStorageWriter_ZIPStream()
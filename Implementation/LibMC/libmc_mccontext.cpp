@@ -52,6 +52,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "amc_api_sessionhandler.hpp"
 
 #include "common_importstream_native.hpp"
+#include "common_startuptiming.hpp"
 #include "libmc_exceptiontypes.hpp"
 
 
@@ -132,6 +133,9 @@ CMCContext::CMCContext(LibMCData::PDataModel pDataModel)
 
 CMCContext::~CMCContext()
 {
+    if (m_pStateMachineScheduler.get() != nullptr)
+        m_pStateMachineScheduler->shutdown();
+
     m_Instances.clear();
     m_InstanceList.clear();
     m_Plugins.clear();
@@ -141,8 +145,12 @@ CMCContext::~CMCContext()
 void CMCContext::ParseConfiguration(const std::string & sXMLString)
 {
 
+    AMCCommon::CStartupTiming startupTiming;
+
     try {
 
+        startupTiming.beginPhase("configuration parsing");
+
         pugi::xml_document doc;
         pugi::xml_parse_result result = doc.load_string(sXMLString.c_str());
         if (!result)
@@ -187,6 +195,7 @@ void CMCContext::ParseConfiguration(const std::string & sXMLString)
         }
 
 
+        startupTiming.beginPhase("access control");
         m_pSystemState->logger()->logMessage("Reading access control information", LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::Message);
         auto accessControlNode = mainNode.child("accesscontrol");
         if (!accessControlNode.empty()) {
@@ -200,6 +209,7 @@ void CMCContext::ParseConfiguration(const std::string & sXMLString)
         }
 
 
+        startupTiming.beginPhase("alerts");
         m_pSystemState->logger()->logMessage("Reading alert information", LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::Message);
         auto alertsNode = mainNode.child("alerts");
         if (!alertsNode.empty()) {
@@ -208,19 +218,23 @@ void CMCContext::ParseConfiguration(const std::string & sXMLString)
 
         }
 
+        startupTiming.beginPhase("core resources");
         auto sCoreResourcePath = m_pSystemState->getLibraryResourcePath("core");
         m_pSystemState->logger()->logMessage("Loading core resources from " + sCoreResourcePath + "...", LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::Message);
-        auto pResourcePackageStream = std::make_shared<AMCCommon::CImportStream_Native>(sCoreResourcePath);
-        m_pCoreResourcePackage = CResourcePackage::makeFromStream(pResourcePackageStream, sCoreResourcePath, AMCPACKAGE_SCHEMANAMESPACE);
+        m_pCoreResourcePackage = CResourcePackage::makeFromFile(sCoreResourcePath, sCoreResourcePath, AMCPACKAGE_SCHEMANAMESPACE);
 
 
+        startupTiming.beginPhase("drivers");
         m_pSystemState->logger()->logMessage("Loading drivers...", LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::Message);
+        std::vector<AMC::sDriverRegistration> driverRegistrations;
         auto driversNodes = mainNode.children("driver");
         for (pugi::xml_node driversNode : driversNodes)
         {
-            addDriver(driversNode);
+            driverRegistrations.push_back(readDriverRegistration(driversNode));
         }
+        m_pSystemState->driverHandler()->registerDrivers(driverRegistrations, m_pCoreResourcePackage, AMC_DRIVERHANDLER_MAXINITIALIZATIONTHREADS);
 
+        startupTiming.beginPhase("api documentation");
         auto apiNode = mainNode.child("api");
         bool bHasDocumentationResource = false;
         if (!apiNode.empty()) {
@@ -244,6 +258,14 @@ void CMCContext::ParseConfiguration(const std::string & sXMLString)
             m_pSystemState->logger()->logMessage("No custom API definition given.", LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::Message);
 
 
+        auto schedulerNode = mainNode.child("scheduler");
+        if (!schedulerNode.empty()) {
+
+            loadSchedulerConfiguration(schedulerNode);
+
+        }
+
+        startupTiming.beginPhase("state machines");
         m_pSystemState->logger()->logMessage("Initializing state machines...", LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::Message);
         auto statemachinesNodes = mainNode.children("statemachine");
         for (pugi::xml_node instanceNode : statemachinesNodes)
@@ -252,17 +274,20 @@ void CMCContext::ParseConfiguration(const std::string & sXMLString)
         }
 
 
+        startupTiming.beginPhase("journal");
         m_pSystemState->logger()->logMessage("Starting Journal recording...", LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::Message);
         // Start journal recording
         m_pStateJournal->startRecording();
 
         // Load persistent parameters
+        startupTiming.beginPhase("persistent parameters");
         auto pDataModel = m_pSystemState->getDataModelInstance();
         auto pPersistencyHandler = pDataModel->CreatePersistencyHandler();
         for (auto pStateMachineInstance : m_InstanceList)
             pStateMachineInstance->getParameterHandler()->loadPersistentParameters(pPersistencyHandler, m_pSystemState->getAbsoluteTimeStamp ());
 
         // Load User Interface
+        startupTiming.beginPhase("user interface");
         auto userInterfaceNode = mainNode.child("userinterface");
         if (userInterfaceNode.empty()) {
 
@@ -286,6 +311,12 @@ void CMCContext::ParseConfiguration(const std::string & sXMLString)
             m_pSystemState->uiHandler()->loadFromXML(userInterfaceNode, sUILibraryPath);
         }
 
+        startupTiming.finishPhase();
+
+        m_pSystemState->logger()->logMessage("Startup timing:", LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::Message);
+        for (auto& sReportLine : startupTiming.getReportLines())
+            m_pSystemState->logger()->logMessage("    " + sReportLine, LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::Message);
+
     }
     catch (std::exception& E) {
         m_pSystemState->logger()->logMessage(std::string ("initialization error: ") + E.what(), LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::CriticalError);
@@ -313,16 +344,14 @@ void CMCContext::SetTempBasePath(const std::string& sTempBasePath)
 
 void CMCContext::LoadClientPackage(const std::string& sResourcePath)
 {
-    auto pStream = std::make_shared<AMCCommon::CImportStream_Native>(sResourcePath);
-    auto pPackage = CResourcePackage::makeFromStream(pStream, sResourcePath, AMCPACKAGE_SCHEMANAMESPACE);
+    auto pPackage = CResourcePackage::makeFromFile(sResourcePath, sResourcePath, AMCPACKAGE_SCHEMANAMESPACE);
 
     m_pClientDistHandler->LoadClientPackage (pPackage);
 }
 
 void CMCContext::LoadAPIDocumentation(const std::string& sResourcePath)
 {
-    auto pStream = std::make_shared<AMCCommon::CImportStream_Native>(sResourcePath);
-    auto pPackage = CResourcePackage::makeFromStream(pStream, sResourcePath, AMCPACKAGE_SCHEMANAMESPACE);
+    auto pPackage = CResourcePackage::makeFromFile(sResourcePath, sResourcePath, AMCPACKAGE_SCHEMANAMESPACE);
 
     m_pAPIDocumentationHandler->LoadAPIDocsPackage(pPackage);
 
@@ -338,7 +367,7 @@ struct xml_sstream_writer : pugi::xml_writer
     }
 };
 
-void CMCContext::addDriver(const pugi::xml_node& xmlNode)
+AMC::sDriverRegistration CMCContext::readDriverRegistration(const pugi::xml_node& xmlNode)
 {
     auto nameAttrib = xmlNode.attribute("name");
     if (nameAttrib.empty())
@@ -358,6 +387,19 @@ void CMCContext::addDriver(const pugi::xml_node& xmlNode)
     
     m_pSystemState->logger()->logMessage("Initializing " + sName + " (" + sType + "@" + sLibraryName + ")", LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::Message);
 
+    // Optional comma separated list of drivers that need to be initialized before this driver.
+    std::vector<std::string> dependencies;
+    std::string sDependsOn = xmlNode.attribute("dependson").as_string();
+    if (!sDependsOn.empty()) {
+        std::vector<std::string> dependencyNames;
+        AMCCommon::CUtils::splitString(sDependsOn, ",", dependencyNames);
+        for (auto& sDependencyName : dependencyNames) {
+            std::string sTrimmedName = AMCCommon::CUtils::trimString(sDependencyName);
+            if (!sTrimmedName.empty())
+                dependencies.push_back(sTrimmedName);
+        }
+    }
+
     std::string sConfigurationData = "";
 
     std::string sConfigSchema = xmlNode.attribute("configurationschema").as_string ();
@@ -386,13 +428,47 @@ void CMCContext::addDriver(const pugi::xml_node& xmlNode)
         sConfigurationData = m_pCoreResourcePackage->readEntryUTF8String(sConfigResource);
     }
 
+    AMC::sDriverRegistration registration;
+    registration.m_sName = sName;
+    registration.m_sType = sType;
+    registration.m_sLibraryName = sLibraryName;
+    registration.m_sConfigurationData = sConfigurationData;
+    registration.m_Dependencies = dependencies;
+
+    // An unmapped library leaves the path empty and only fails this driver, when it is initialized.
     try {
-        m_pSystemState->driverHandler()->registerDriver(sName, sType, sLibraryName, m_pSystemState->getLibraryPath(sLibraryName), m_pSystemState->getLibraryResourcePath(sLibraryName), sConfigurationData, m_pCoreResourcePackage);
-    } 
-    catch (std::exception & E) {
-        m_pSystemState->logger()->logMessage(std::string ("Driver error: ") + E.what(), LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::FatalError);
+        registration.m_sLibraryPath = m_pSystemState->getLibraryPath(sLibraryName);
+        registration.m_sResourcePath = m_pSystemState->getLibraryResourcePath(sLibraryName);
+    }
+    catch (std::exception &) {
+        registration.m_sLibraryPath = "";
+        registration.m_sResourcePath = "";
+    }
+
+    return registration;
+}
+
+void CMCContext::loadSchedulerConfiguration(const pugi::xml_node& xmlNode)
+{
+    std::string sMode = xmlNode.attribute("mode").as_string();
+    if (sMode.empty() || (sMode == "threads")) {
+        m_pSystemState->logger()->logMessage("Using one thread per state machine", LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::Message);
+        return;
+    }
+
+    if (sMode != "workerpool")
+        throw ELibMCCustomException(LIBMC_ERROR_INVALIDSCHEDULERMODE, sMode);
+
+    uint32_t nWorkerCount = AMC_STATEMACHINESCHEDULER_DEFAULTWORKERCOUNT;
+    auto workersAttrib = xmlNode.attribute("workers");
+    if (!workersAttrib.empty()) {
+        nWorkerCount = workersAttrib.as_uint(0);
+        if ((nWorkerCount < AMC_STATEMACHINESCHEDULER_MINWORKERCOUNT) || (nWorkerCount > AMC_STATEMACHINESCHEDULER_MAXWORKERCOUNT))
+            throw ELibMCCustomException(LIBMC_ERROR_INVALIDSCHEDULERWORKERCOUNT, workersAttrib.as_string());
     }
 
+    m_pSystemState->logger()->logMessage("Using a worker pool of " + std::to_string(nWorkerCount) + " threads for all state machines", LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::Message);
+    m_pStateMachineScheduler = std::make_shared<AMC::CStateMachineScheduler>(nWorkerCount);
 }
 
 AMC::PStateMachineInstance CMCContext::addMachineInstance(const pugi::xml_node& xmlNode)
@@ -579,6 +655,7 @@ AMC::PStateMachineInstance CMCContext::addMachineInstance(const pugi::xml_node&
     }
 
     pInstance->setStateFactory(pStateFactory);
+    pInstance->setScheduler(m_pStateMachineScheduler);
         
     if (m_InstanceList.size() >= MAXSTATEMACHINEINSTANCECOUNT)
         throw ELibMCNoContextException(LIBMC_ERROR_TOOMANYMACHINEINSTANCES);
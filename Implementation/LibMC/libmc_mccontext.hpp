@@ -80,6 +80,9 @@ private:
 	std::map <std::string, AMC::PStateMachineInstance> m_Instances;
 	std::vector <AMC::PStateMachineInstance> m_InstanceList;
 
+	// Shared worker pool for all state machines, if configured
+	AMC::PStateMachineScheduler m_pStateMachineScheduler;
+
 	std::map <std::string, LibMCPlugin::PWrapper> m_Plugins;
 
 	LibMCPlugin::PWrapper loadPlugin (std::string sPluginName);
@@ -101,6 +104,7 @@ private:
 	void loadDriverParameterGroup (const pugi::xml_node& xmlNode, AMC::PParameterGroup pGroup);
 	void loadAccessControl(const pugi::xml_node& xmlNode);
 	void loadAlertDefinitions(const pugi::xml_node& xmlNode);
+	void loadSchedulerConfiguration(const pugi::xml_node& xmlNode);
 
 	void readSignalParameters(const std::string& sSignalName, const pugi::xml_node& xmlNode, std::list<AMC::CStateSignalParameter>& Parameters, std::list<AMC::CStateSignalParameter>& Results, uint32_t& nSignalReactionTimeOut, uint32_t& nSignalQueueSize);
 
@@ -145,7 +149,7 @@ public:
 	AMC::PStateMachineInstance addMachineInstance (const pugi::xml_node & xmlNode);
 	AMC::PStateMachineInstance findMachineInstance (std::string sName, bool bFailIfNotExisting);	
 
-	void addDriver(const pugi::xml_node& xmlNode);
+	AMC::sDriverRegistration readDriverRegistration(const pugi::xml_node& xmlNode);
 
 	
 
@@ -90,7 +90,7 @@ CBuildJob* CBuildJob::makeFromDatabase(const std::string& sJobUUID, AMCData::PSQ
 
     auto sParsedJobUUID = AMCCommon::CUtils::normalizeUUIDString(sJobUUID);
 
-    std::string sQuery = "SELECT buildjobs.uuid, buildjobs.name, buildjobs.status, buildjobs.timestamp, buildjobs.storagestreamuuid, buildjobs.layercount, buildjobs.useruuid, users.login, (SELECT count(buildjobexecutions.uuid) FROM buildjobexecutions WHERE buildjobexecutions.jobuuid=buildjobs.uuid), buildjobs.thumbnailuuid, storage_streams.size FROM buildjobs LEFT JOIN users ON users.uuid=buildjobs.useruuid LEFT JOIN storage_streams ON storage_streams.uuid=buildjobs.storagestreamuuid WHERE buildjobs.uuid=?";
+    std::string sQuery = "SELECT buildjobs.uuid, buildjobs.name, buildjobs.status, buildjobs.timestamp, buildjobs.storagestreamuuid, buildjobs.layercount, buildjobs.useruuid, users.login, buildjobs.executioncount, buildjobs.thumbnailuuid, storage_streams.size FROM buildjobs LEFT JOIN users ON users.uuid=buildjobs.useruuid LEFT JOIN storage_streams ON storage_streams.uuid=buildjobs.storagestreamuuid WHERE buildjobs.uuid=?";
     auto pStatement = pSQLHandler->prepareStatement(sQuery);
     pStatement->setString(1, sParsedJobUUID);
     if (!pStatement->nextRow())
@@ -624,21 +624,34 @@ IBuildJobExecution* CBuildJob::CreateBuildJobExecution(const std::string& sDescr
     else
         sNormalizedUserUUID = AMCCommon::CUtils::createEmptyUUID();
 
+    auto pTransaction = m_pSQLHandler->beginTransaction();
+
     std::string sInsertQuery = "INSERT INTO buildjobexecutions (uuid, jobuuid, journaluuid, startjournaltimestamp, endjournaltimestamp, useruuid, status, description, active, timestamp) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?)";
-    auto pInsertStatement = m_pSQLHandler->prepareStatement(sInsertQuery);
+    auto pInsertStatement = pTransaction->prepareStatement(sInsertQuery);
     pInsertStatement->setString(1, sExecutionUUID);
     pInsertStatement->setString(2, m_sUUID);
     pInsertStatement->setString(3, sJournalUUID);
     pInsertStatement->setString(4, AMCCommon::CChrono::convertToISO8601TimeUTC (nAbsoluteStartTimeStampInMicrosecondsSince1970));
     pInsertStatement->setInt64(5, 0);
-    pInsertStatement->setString(6, sUserUUID);
+    pInsertStatement->setString(6, sNormalizedUserUUID);
     pInsertStatement->setString(7, CBuildJobExecution::convertBuildJobExecutionStatusToString (LibMCData::eBuildJobExecutionStatus::InProcess));
     pInsertStatement->setString(8, sDescription);
     pInsertStatement->setInt(9, 1);
     pInsertStatement->setString(10, sAbsoluteCreationTimeStamp);
     pInsertStatement->execute();
+    pInsertStatement = nullptr;
+
+    std::string sUpdateQuery = "UPDATE buildjobs SET executioncount=executioncount+1 WHERE uuid=?";
+    auto pUpdateStatement = pTransaction->prepareStatement(sUpdateQuery);
+    pUpdateStatement->setString(1, m_sUUID);
+    pUpdateStatement->execute();
+    pUpdateStatement = nullptr;
+
+    pTransaction->commit();
+
+    m_nExecutionCount++;
 
-    return new CBuildJobExecution(m_pSQLHandler, sExecutionUUID, m_sUUID, sJournalUUID, sUserUUID, nAbsoluteStartTimeStampInMicrosecondsSince1970, m_sName, m_eJobStatus, m_nLayerCount, m_pStorageState);
+    return new CBuildJobExecution(m_pSQLHandler, sExecutionUUID, m_sUUID, sJournalUUID, sNormalizedUserUUID, nAbsoluteStartTimeStampInMicrosecondsSince1970, m_sName, m_eJobStatus, m_nLayerCount, m_pStorageState);
 
 }
 
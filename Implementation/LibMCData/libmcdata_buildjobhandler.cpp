@@ -45,6 +45,12 @@ Abstract: This is a stub class definition of CBuildJobHandler
 
 using namespace LibMCData::Impl;
 
+// Column order MUST match addJobsFromStatement.
+#define BUILDJOBHANDLER_JOBSELECTQUERY "SELECT buildjobs.uuid, buildjobs.name, buildjobs.status, buildjobs.timestamp, buildjobs.storagestreamuuid, buildjobs.layercount, buildjobs.useruuid, users.login, buildjobs.executioncount, buildjobs.thumbnailuuid, storage_streams.size FROM buildjobs LEFT JOIN users On users.uuid=buildjobs.useruuid LEFT JOIN storage_streams ON storage_streams.uuid=buildjobs.storagestreamuuid"
+
+// Column order MUST match CBuildJobExecution::makeSharedFromStatement.
+#define BUILDJOBHANDLER_EXECUTIONSELECTQUERY "SELECT buildjobexecutions.uuid, buildjobexecutions.jobuuid, buildjobexecutions.journaluuid, buildjobexecutions.useruuid, buildjobexecutions.startjournaltimestamp, buildjobs.name, buildjobs.status, buildjobs.layercount FROM buildjobexecutions LEFT JOIN buildjobs ON buildjobs.uuid=buildjobexecutions.jobuuid"
+
 /*************************************************************************************************************************
  Class definition of CBuildJobHandler 
 **************************************************************************************************************************/
@@ -134,14 +140,13 @@ bool CBuildJobHandler::JobExists(const std::string& sJobUUID)
     return (pStatement->nextRow());
 }
 
-IBuildJobIterator* CBuildJobHandler::ListJobsByStatus(const LibMCData::eBuildJobStatus eStatus)
+void CBuildJobHandler::addJobsFromStatement(CBuildJobIterator* pJobIterator, AMCData::PSQLStatement pStatement)
 {
+    if (pJobIterator == nullptr)
+        throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
+    if (pStatement.get() == nullptr)
+        throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
 
-    std::unique_ptr<CBuildJobIterator> pJobIterator(new CBuildJobIterator());
-
-    std::string sQuery = "SELECT buildjobs.uuid, buildjobs.name, buildjobs.status, buildjobs.timestamp, buildjobs.storagestreamuuid, buildjobs.layercount, buildjobs.useruuid, users.login, (SELECT count(buildjobexecutions.uuid) FROM buildjobexecutions WHERE buildjobexecutions.jobuuid=buildjobs.uuid), buildjobs.thumbnailuuid, storage_streams.size FROM buildjobs LEFT JOIN users On users.uuid=buildjobs.useruuid LEFT JOIN storage_streams ON storage_streams.uuid=buildjobs.storagestreamuuid WHERE buildjobs.status=? ORDER BY buildjobs.timestamp DESC";
-    auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
-    pStatement->setString(1, CBuildJob::convertBuildJobStatusToString(eStatus));
     while (pStatement->nextRow()) {
 
         auto sUUID = pStatement->getColumnString(1);
@@ -157,7 +162,7 @@ IBuildJobIterator* CBuildJobHandler::ListJobsByStatus(const LibMCData::eBuildJob
             sUserName = pStatement->getColumnString(8);
 
         int32_t nExecutionCount = pStatement->getColumnInt(9);
-        // This should never happen, because of the SQL Query
+        // This should never happen, because the execution count is maintained on insertion
         if (nExecutionCount < 0)
             throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_COULDNOTDETERMINEEXECUTIONCOUNT);
 
@@ -167,6 +172,56 @@ IBuildJobIterator* CBuildJobHandler::ListJobsByStatus(const LibMCData::eBuildJob
 
         pJobIterator->AddJob (CBuildJob::makeShared (sUUID, sName, eJobStatus, sTimeStamp, sStorageStreamUUID, nStorageStreamSize, sUserUUID, sUserName, nLayerCount, (uint32_t) nExecutionCount, sThumbnailUUID, m_pSQLHandler, m_pStorageState));
     }
+}
+
+IBuildJobIterator* CBuildJobHandler::ListJobsByStatus(const LibMCData::eBuildJobStatus eStatus)
+{
+
+    std::unique_ptr<CBuildJobIterator> pJobIterator(new CBuildJobIterator());
+
+    std::string sQuery = BUILDJOBHANDLER_JOBSELECTQUERY " WHERE buildjobs.status=? ORDER BY buildjobs.timestamp DESC, buildjobs.uuid DESC";
+    auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+    pStatement->setString(1, CBuildJob::convertBuildJobStatusToString(eStatus));
+
+    addJobsFromStatement(pJobIterator.get(), pStatement);
+
+    return pJobIterator.release();
+}
+
+IBuildJobIterator* CBuildJobHandler::ListJobsByStatusPage(const LibMCData::eBuildJobStatus eStatus, const std::string& sCursorTimestamp, const std::string& sCursorUUID, const LibMCData_uint32 nMaxCount)
+{
+    if ((nMaxCount == 0) || (nMaxCount > BUILDJOBHANDLER_MAXPAGESIZE))
+        throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPAGESIZE, "invalid page size: " + std::to_string (nMaxCount));
+
+    // The cursor is the timestamp and uuid of the last job of the previous page.
+    bool bHasCursor = !sCursorTimestamp.empty();
+    if (bHasCursor == sCursorUUID.empty())
+        throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM, "cursor timestamp and cursor uuid must be given together");
+
+    std::unique_ptr<CBuildJobIterator> pJobIterator(new CBuildJobIterator());
+
+    std::string sQuery = BUILDJOBHANDLER_JOBSELECTQUERY " WHERE buildjobs.status=?";
+    if (bHasCursor)
+        sQuery += " AND (buildjobs.timestamp, buildjobs.uuid) < (?, ?)";
+    sQuery += " ORDER BY buildjobs.timestamp DESC, buildjobs.uuid DESC LIMIT ?";
+
+    uint32_t nColumn = 1;
+
+    auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+    pStatement->setString(nColumn, CBuildJob::convertBuildJobStatusToString(eStatus));
+    nColumn++;
+
+    if (bHasCursor) {
+        uint64_t nCursorTimeStamp = AMCCommon::CChrono::parseISO8601TimeUTC(sCursorTimestamp);
+        pStatement->setString(nColumn, AMCCommon::CChrono::convertToISO8601TimeUTC(nCursorTimeStamp));
+        nColumn++;
+        pStatement->setString(nColumn, AMCCommon::CUtils::normalizeUUIDString(sCursorUUID));
+        nColumn++;
+    }
+
+    pStatement->setInt(nColumn, (int32_t)nMaxCount);
+
+    addJobsFromStatement(pJobIterator.get(), pStatement);
 
     return pJobIterator.release();
 }
@@ -204,16 +259,38 @@ IBuildJobExecution* CBuildJobHandler::RetrieveJobExecution(const std::string& sE
 
 }
 
+void CBuildJobHandler::addJobExecutionsFromStatement(CBuildJobExecutionIterator* pExecutionIterator, AMCData::PSQLStatement pStatement)
+{
+    if (pExecutionIterator == nullptr)
+        throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
+    if (pStatement.get() == nullptr)
+        throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
+
+    while (pStatement->nextRow()) {
+        // ATTENTION: All callers of makeFromStatement MUST BE in Sync in terms of column order!!
+        // Column 1: Execution UUID
+        // Column 2: Job UUID
+        // Column 3: Journal UUID
+        // Column 4: User UUID
+        // Column 5: Start TimeStamp
+        // Column 6: Job Name
+        // Column 7: Job Status
+        // Column 8: Job Layer Count
+
+        pExecutionIterator->AddJobExecution(CBuildJobExecution::makeSharedFromStatement(m_pSQLHandler, pStatement, m_pStorageState));
+    }
+}
+
 IBuildJobExecutionIterator* CBuildJobHandler::ListJobExecutions(const std::string& sMinTimestamp, const std::string& sMaxTimestamp, const std::string& sJournalUUIDFilter)
 {
-    std::string sQuery = "SELECT buildjobexecutions.uuid, buildjobexecutions.jobuuid, buildjobexecutions.journaluuid, buildjobexecutions.useruuid, buildjobexecutions.startjournaltimestamp, buildjobs.name, buildjobs.status, buildjobs.layercount FROM buildjobexecutions LEFT JOIN buildjobs ON buildjobs.uuid=buildjobexecutions.jobuuid WHERE buildjobexecutions.active=?";
+    std::string sQuery = BUILDJOBHANDLER_EXECUTIONSELECTQUERY " WHERE buildjobexecutions.active=?";
     if (!sJournalUUIDFilter.empty())
         sQuery += " AND buildjobexecutions.journaluuid=?";
     if (!sMinTimestamp.empty ())
         sQuery += " AND buildjobexecutions.startjournaltimestamp>?";
     if (!sMaxTimestamp.empty())
         sQuery += " AND buildjobexecutions.startjournaltimestamp<?";
-    sQuery += " ORDER BY buildjobexecutions.startjournaltimestamp DESC";
+    sQuery += " ORDER BY buildjobexecutions.startjournaltimestamp DESC, buildjobexecutions.uuid DESC";
 
     uint32_t nColumn = 1;
 
@@ -242,19 +319,71 @@ IBuildJobExecutionIterator* CBuildJobHandler::ListJobExecutions(const std::strin
 
     std::unique_ptr<CBuildJobExecutionIterator> buildJobIterator(new CBuildJobExecutionIterator());
 
-    while (pStatement->nextRow()) {
-        // ATTENTION: All callers of makeFromStatement MUST BE in Sync in terms of column order!!
-        // Column 1: Execution UUID
-        // Column 2: Job UUID
-        // Column 3: Journal UUID
-        // Column 4: User UUID
-        // Column 5: Start TimeStamp
-        // Column 6: Job Name
-        // Column 7: Job Status
-        // Column 8: Job Layer Count
+    addJobExecutionsFromStatement(buildJobIterator.get(), pStatement);
+
+    return buildJobIterator.release();
+}
+
+IBuildJobExecutionIterator* CBuildJobHandler::ListJobExecutionsPage(const std::string& sMinTimestamp, const std::string& sMaxTimestamp, const std::string& sJournalUUIDFilter, const std::string& sCursorTimestamp, const std::string& sCursorUUID, const LibMCData_uint32 nMaxCount)
+{
+    if ((nMaxCount == 0) || (nMaxCount > BUILDJOBHANDLER_MAXPAGESIZE))
+        throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPAGESIZE, "invalid page size: " + std::to_string(nMaxCount));
+
+    // The cursor is the start timestamp and uuid of the last execution of the previous page.
+    bool bHasCursor = !sCursorTimestamp.empty();
+    if (bHasCursor == sCursorUUID.empty())
+        throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM, "cursor timestamp and cursor uuid must be given together");
+
+    std::string sQuery = BUILDJOBHANDLER_EXECUTIONSELECTQUERY " WHERE buildjobexecutions.active=?";
+    if (!sJournalUUIDFilter.empty())
+        sQuery += " AND buildjobexecutions.journaluuid=?";
+    if (!sMinTimestamp.empty())
+        sQuery += " AND buildjobexecutions.startjournaltimestamp>?";
+    if (!sMaxTimestamp.empty())
+        sQuery += " AND buildjobexecutions.startjournaltimestamp<?";
+    if (bHasCursor)
+        sQuery += " AND (buildjobexecutions.startjournaltimestamp, buildjobexecutions.uuid) < (?, ?)";
+    sQuery += " ORDER BY buildjobexecutions.startjournaltimestamp DESC, buildjobexecutions.uuid DESC LIMIT ?";
 
-        buildJobIterator->AddJobExecution(CBuildJobExecution::makeSharedFromStatement(m_pSQLHandler, pStatement, m_pStorageState));
+    uint32_t nColumn = 1;
+
+    auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+    pStatement->setInt(nColumn, 1);
+    nColumn++;
+
+    if (!sJournalUUIDFilter.empty()) {
+        pStatement->setString(nColumn, AMCCommon::CUtils::normalizeUUIDString(sJournalUUIDFilter));
+        nColumn++;
+    }
+
+    if (!sMinTimestamp.empty())
+    {
+        uint64_t nMinTimeStamp = AMCCommon::CChrono::parseISO8601TimeUTC(sMinTimestamp);
+        pStatement->setString(nColumn, AMCCommon::CChrono::convertToISO8601TimeUTC(nMinTimeStamp));
+        nColumn++;
     }
 
+    if (!sMaxTimestamp.empty())
+    {
+        uint64_t nMaxTimeStamp = AMCCommon::CChrono::parseISO8601TimeUTC(sMaxTimestamp);
+        pStatement->setString(nColumn, AMCCommon::CChrono::convertToISO8601TimeUTC(nMaxTimeStamp));
+        nColumn++;
+    }
+
+    if (bHasCursor)
+    {
+        uint64_t nCursorTimeStamp = AMCCommon::CChrono::parseISO8601TimeUTC(sCursorTimestamp);
+        pStatement->setString(nColumn, AMCCommon::CChrono::convertToISO8601TimeUTC(nCursorTimeStamp));
+        nColumn++;
+        pStatement->setString(nColumn, AMCCommon::CUtils::normalizeUUIDString(sCursorUUID));
+        nColumn++;
+    }
+
+    pStatement->setInt(nColumn, (int32_t)nMaxCount);
+
+    std::unique_ptr<CBuildJobExecutionIterator> buildJobIterator(new CBuildJobExecutionIterator());
+
+    addJobExecutionsFromStatement(buildJobIterator.get(), pStatement);
+
     return buildJobIterator.release();
 }
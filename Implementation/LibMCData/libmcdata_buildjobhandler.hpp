@@ -53,10 +53,15 @@ Abstract: This is the class declaration of CBuildJobHandler
 #include <mutex>
 #include <thread>
 
+#define BUILDJOBHANDLER_MAXPAGESIZE 1000
+
 
 namespace LibMCData {
 namespace Impl {
 
+class CBuildJobIterator;
+class CBuildJobExecutionIterator;
+
 
 /*************************************************************************************************************************
  Class declaration of CBuildJobHandler 
@@ -70,6 +75,11 @@ private:
 
 protected:
 
+    // Statement columns MUST follow BUILDJOBHANDLER_JOBSELECTQUERY.
+    void addJobsFromStatement(CBuildJobIterator* pJobIterator, AMCData::PSQLStatement pStatement);
+
+    void addJobExecutionsFromStatement(CBuildJobExecutionIterator* pExecutionIterator, AMCData::PSQLStatement pStatement);
+
 
 
 
@@ -86,6 +96,8 @@ public:
 
 	IBuildJobIterator * ListJobsByStatus(const LibMCData::eBuildJobStatus eStatus) override;
 
+    IBuildJobIterator* ListJobsByStatusPage(const LibMCData::eBuildJobStatus eStatus, const std::string& sCursorTimestamp, const std::string& sCursorUUID, const LibMCData_uint32 nMaxCount) override;
+
     IBuildJob* FindJobOfData(const std::string& sDataUUID) override;
 
     std::string ConvertBuildStatusToString(const LibMCData::eBuildJobStatus eStatus) override;
@@ -96,6 +108,8 @@ public:
 
     IBuildJobExecutionIterator* ListJobExecutions(const std::string& sMinTimestamp, const std::string& sMaxTimestamp, const std::string& sJournalUUIDFilter) override;
 
+    IBuildJobExecutionIterator* ListJobExecutionsPage(const std::string& sMinTimestamp, const std::string& sMaxTimestamp, const std::string& sJournalUUIDFilter, const std::string& sCursorTimestamp, const std::string& sCursorUUID, const LibMCData_uint32 nMaxCount) override;
+
 };
 
 } // namespace Impl
@@ -36,6 +36,7 @@ Abstract: This is a stub class definition of CJournalReader
 #include "libmcdata_journalchunkintegerdata.hpp"
 
 #include "common_importstream_native.hpp"
+#include "common_memorymappedfile.hpp"
 
 // Include custom headers here.
 #include "common_utils.hpp"
@@ -137,27 +138,63 @@ std::string CJournalReaderFile::getAbsoluteFileName()
 }
 
 
-void CJournalReaderFile::readBuffer(uint64_t nDataOffset, uint8_t* pBuffer, uint64_t nDataLength)
+AMCCommon::PMemoryMappedFile CJournalReaderFile::getMappedFile()
 {
-    if (m_pImportStream.get() == nullptr)
+    // Reads only take a reference to the mapping, so parallel chunk reads of the same file never wait for each other.
+    auto pMappedFile = std::atomic_load(&m_pMappedFile);
+    if (pMappedFile.get() == nullptr)
         throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_JOURNALREADERFILENOTOPEN);
 
-    std::lock_guard<std::mutex> lockGuard(m_ImportStreamMutex);
-    m_pImportStream->seekPosition(nDataOffset, true);
-    m_pImportStream->readBuffer(pBuffer, nDataLength, true);
+    return pMappedFile;
+}
+
+void CJournalReaderFile::readBuffer(uint64_t nDataOffset, uint8_t* pBuffer, uint64_t nDataLength)
+{
+    auto pMappedFile = getMappedFile();
+
+    try {
+        pMappedFile->readRange(nDataOffset, pBuffer, nDataLength);
+    }
+    catch (std::exception& E) {
+        throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_COULDNOTFULLYREADFROMJOURNALSTREAM, E.what ());
+    }
+
+}
+
+const uint8_t* CJournalReaderFile::mapBuffer(uint64_t nDataOffset, uint64_t nDataLength)
+{
+    // Pointers into the mapping remain valid until closeChunkFile is called.
+    auto pMappedFile = getMappedFile();
 
+    try {
+        return pMappedFile->getRange(nDataOffset, nDataLength);
+    }
+    catch (std::exception& E) {
+        throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_COULDNOTFULLYREADFROMJOURNALSTREAM, E.what());
+    }
 }
 
 
 void CJournalReaderFile::ensureChunkFileIsOpen()
 {
-    if (m_pImportStream.get() == nullptr)
-        m_pImportStream = std::make_shared<AMCCommon::CImportStream_Native>(m_sAbsoluteFileName);
+    if (std::atomic_load(&m_pMappedFile).get() != nullptr)
+        return;
+
+    std::lock_guard<std::mutex> lockGuard(m_MappingMutex);
+    if (std::atomic_load(&m_pMappedFile).get() == nullptr) {
+        try {
+            std::atomic_store(&m_pMappedFile, std::make_shared<AMCCommon::CMemoryMappedFile>(m_sAbsoluteFileName));
+        }
+        catch (std::exception& E) {
+            throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_COULDNOTMAPJOURNALFILE, E.what());
+        }
+    }
 }
 
 void CJournalReaderFile::closeChunkFile()
 {
-    m_pImportStream = nullptr;
+    std::lock_guard<std::mutex> lockGuard(m_MappingMutex);
+    std::atomic_store(&m_pMappedFile, AMCCommon::PMemoryMappedFile());
 }
 
 
@@ -217,7 +254,8 @@ CJournalReader::CJournalReader(AMCData::PSQLHandler pSQLHandler, const std::stri
     m_sJournalBasePath (sJournalBasePath), 
     m_nSchemaVersion (0),
     m_nGlobalStartTimeStamp (0),
-    m_nGlobalEndTimeStamp (0)
+    m_nGlobalEndTimeStamp (0),
+    m_nCachedSummaryChunkIndex (-1)
 {
     if (pSQLHandler.get() == nullptr)
         throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
@@ -483,6 +521,43 @@ void CJournalReader::GetChunkInformation(const LibMCData_uint32 nChunkIndex, Lib
     }
 }
 
+void CJournalReader::ReadChunkSummaries(const LibMCData_uint32 nChunkIndex, LibMCData_uint64 nSummariesBufferSize, LibMCData_uint64* pSummariesNeededCount, LibMCData::sJournalChunkVariableSummary* pSummariesBuffer)
+{
+    auto iChunkIter = m_ChunkMap.find(nChunkIndex);
+    if (iChunkIter == m_ChunkMap.end())
+        throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_JOURNALCHUNKNOTFOUND);
+
+    std::lock_guard<std::mutex> lockGuard(m_ChunkSummaryCacheMutex);
+
+    if (m_nCachedSummaryChunkIndex != (int64_t)nChunkIndex) {
+        auto pChunk = iChunkIter->second;
+
+        auto pDataFile = pChunk->getDataFile();
+        pDataFile->ensureChunkFileIsOpen();
+
+        m_nCachedSummaryChunkIndex = -1;
+        m_CachedChunkSummaries.clear();
+        pDataFile->readJournalChunkSummaries(pChunk->getDataOffset(), pChunk->getDataLength(), m_CachedChunkSummaries);
+        m_nCachedSummaryChunkIndex = nChunkIndex;
+    }
+
+    auto& summaries = m_CachedChunkSummaries;
+
+    if (pSummariesNeededCount != nullptr)
+        *pSummariesNeededCount = summaries.size();
+
+    if (pSummariesBuffer != nullptr) {
+        if (nSummariesBufferSize < summaries.size())
+            throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_BUFFERTOOSMALL);
+
+        LibMCData::sJournalChunkVariableSummary* pTarget = pSummariesBuffer;
+        for (auto& summary : summaries) {
+            *pTarget = summary;
+            pTarget++;
+        }
+    }
+}
+
 LibMCData_uint32 CJournalReader::GetAliasCount()
 {
     return (uint32_t)m_Aliases.size();
@@ -48,9 +48,11 @@ Abstract: This is the class declaration of CJournalReader
 
 // Include custom headers here.
 #include "common_importstream_native.hpp"
+#include "common_memorymappedfile.hpp"
 #include "amcdata_sqlhandler.hpp"
 #include <map>
 #include <mutex>
+#include <atomic>
 
 namespace LibMCData {
 namespace Impl {
@@ -123,10 +125,12 @@ private:
     int64_t m_nFileIndex;
     std::string m_sAbsoluteFileName;
 
-    std::mutex m_ImportStreamMutex;
-    AMCCommon::PImportStream m_pImportStream;
+    // Serializes opening and closing the mapping. The mapping itself is accessed with atomic loads and stores.
+    std::mutex m_MappingMutex;
+    AMCCommon::PMemoryMappedFile m_pMappedFile;
+
+    AMCCommon::PMemoryMappedFile getMappedFile();
 
-   
 
 public:
 
@@ -140,6 +144,8 @@ public:
 
     void readBuffer(uint64_t nDataOffset, uint8_t* pBuffer, uint64_t nDataLength) override;
 
+    const uint8_t* mapBuffer(uint64_t nDataOffset, uint64_t nDataLength) override;
+
     void ensureChunkFileIsOpen();
 
     void closeChunkFile();
@@ -212,6 +218,12 @@ private:
     std::map <int64_t, PJournalReaderChunk> m_ChunkMap;
     std::vector<PJournalReaderChunk> m_Chunks;
 
+    // Summaries of the most recently read chunk. ReadChunkSummaries is called twice per chunk, once
+    // for the size and once for the data, so the second call reuses the summaries of the first.
+    std::mutex m_ChunkSummaryCacheMutex;
+    int64_t m_nCachedSummaryChunkIndex;
+    std::vector<LibMCData::sJournalChunkVariableSummary> m_CachedChunkSummaries;
+
 public:
 
     CJournalReader(AMCData::PSQLHandler pSQLHandler, const std::string & sJournalUUID, const std::string & sJournalBasePath);
@@ -234,6 +246,8 @@ public:
 
     void GetChunkInformation(const LibMCData_uint32 nChunkIndex, LibMCData_uint64& nStartTimeStamp, LibMCData_uint64& nEndTimeStamp) override;
 
+    void ReadChunkSummaries(const LibMCData_uint32 nChunkIndex, LibMCData_uint64 nSummariesBufferSize, LibMCData_uint64* pSummariesNeededCount, LibMCData::sJournalChunkVariableSummary* pSummariesBuffer) override;
+
     LibMCData_uint32 GetAliasCount() override;
 
     void GetAliasInformation(const LibMCData_uint32 nAliasIndex, std::string& sAliasName, std::string& sSourceVariableName) override;
@@ -41,11 +41,16 @@ Abstract: This is a stub class definition of CDataTable
 
 // Include custom headers here.
 #include "common_utils.hpp"
+#include "lz4/lz4.h"
 #include <vector>
 #include <algorithm>
 #include <cstring>
 #include <sstream>
 #include <cmath>
+#include <charconv>
+#include <thread>
+#include <exception>
+#include <type_traits>
 
 #include "amc_constants.hpp"
 #include "amc_scatterplot.hpp"
@@ -75,7 +80,8 @@ struct sLibMCDataTableColumnHeader {
 	uint64_t m_nDescriptionStart;
 	uint32_t m_nDescriptionLength;
 	uint64_t m_nEntryCount;
-	uint32_t m_nReserved[8];
+	uint64_t m_nEncodedDataSize;
+	uint32_t m_nReserved[6];
 };
 
 
@@ -101,15 +107,109 @@ void CDataTableColumn::writeUint64ToBufferFixedDigits(uint64_t nValue, uint32_t
 
 void CDataTableColumn::writeUint64ToBuffer(uint64_t nValue, std::vector<char>& buffer, size_t& nBufferPosition)
 {
-	uint64_t nDigitValue = nValue;
-	int32_t nDigits = 1;
-	while (nDigitValue >= 10) {
-		nDigits++;
-		nDigitValue /= 10;
+	auto result = std::to_chars(buffer.data() + nBufferPosition, buffer.data() + buffer.size(), nValue);
+	if (result.ec != std::errc())
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_DATATABLECSVBUFFEROVERFLOW);
+
+	nBufferPosition = result.ptr - buffer.data();
+}
+
+void CDataTableColumn::writeInt64ToBuffer(int64_t nValue, std::vector<char>& buffer, size_t& nBufferPosition)
+{
+	auto result = std::to_chars(buffer.data() + nBufferPosition, buffer.data() + buffer.size(), nValue);
+	if (result.ec != std::errc())
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_DATATABLECSVBUFFEROVERFLOW);
+
+	nBufferPosition = result.ptr - buffer.data();
+}
+
+void CDataTableColumn::writeDoubleToBuffer(double dValue, std::vector<char>& buffer, size_t& nBufferPosition)
+{
+	// Shortest representation that parses back to the identical value
+	auto result = std::to_chars(buffer.data() + nBufferPosition, buffer.data() + buffer.size(), dValue);
+	if (result.ec != std::errc())
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_DATATABLECSVBUFFEROVERFLOW);
+
+	nBufferPosition = result.ptr - buffer.data();
+}
+
+
+// Stores the rows LZ4 compressed. Integer rows may be replaced by the difference to their predecessor before,
+// which turns slowly changing signals into runs of small values that compress well.
+template <typename T> void encodeDataTableColumnRows(const std::vector<T>& rows, uint32_t nEncodingType, std::vector<uint8_t>& encodedData)
+{
+	size_t nDataSize = rows.size() * sizeof(T);
+	if (nDataSize > (size_t)LZ4_MAX_INPUT_SIZE)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COULDNOTCOMPRESSDATATABLECOLUMN, "column is too large");
+
+	const T* pSource = rows.data();
+	std::vector<T> deltas;
+
+	if (nEncodingType == DATATABLE_ENCODINGTYPE_DELTALZ4) {
+		if constexpr (std::is_integral<T>::value) {
+			typedef typename std::make_unsigned<T>::type TUnsigned;
+			deltas.resize(rows.size());
+			TUnsigned nPrevious = 0;
+			for (size_t nIndex = 0; nIndex < rows.size(); nIndex++) {
+				TUnsigned nValue = (TUnsigned)rows[nIndex];
+				deltas[nIndex] = (T)(TUnsigned)(nValue - nPrevious);
+				nPrevious = nValue;
+			}
+			pSource = deltas.data();
+		}
+		else {
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNENCODING);
+		}
+	}
+	else if (nEncodingType != DATATABLE_ENCODINGTYPE_LZ4) {
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNENCODING);
 	}
 
-	writeUint64ToBufferFixedDigits (nValue, nDigits, buffer, nBufferPosition);
+	if (nDataSize == 0) {
+		encodedData.clear();
+		return;
+	}
+
+	encodedData.resize((size_t)LZ4_compressBound((int)nDataSize));
+
+	int nCompressedSize = LZ4_compress_default((const char*)pSource, (char*)encodedData.data(), (int)nDataSize, (int)encodedData.size());
+	if (nCompressedSize <= 0)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COULDNOTCOMPRESSDATATABLECOLUMN);
 
+	encodedData.resize((size_t)nCompressedSize);
+}
+
+template <typename T> void decodeDataTableColumnRows(std::vector<T>& rows, uint32_t nEncodingType, const std::vector<uint8_t>& encodedData, uint64_t nEntryCount)
+{
+	if ((nEncodingType != DATATABLE_ENCODINGTYPE_LZ4) && (nEncodingType != DATATABLE_ENCODINGTYPE_DELTALZ4))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNENCODING);
+
+	uint64_t nDataSize = nEntryCount * sizeof(T);
+	if ((nDataSize > (uint64_t)LZ4_MAX_INPUT_SIZE) || (encodedData.size() > (size_t)INT32_MAX))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COULDNOTDECOMPRESSDATATABLECOLUMN, "column is too large");
+
+	rows.resize((size_t)nEntryCount);
+	if (nEntryCount == 0)
+		return;
+
+	// Decompress straight into the row storage
+	int nDecompressedSize = LZ4_decompress_safe((const char*)encodedData.data(), (char*)rows.data(), (int)encodedData.size(), (int)nDataSize);
+	if (nDecompressedSize != (int)nDataSize)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COULDNOTDECOMPRESSDATATABLECOLUMN);
+
+	if (nEncodingType == DATATABLE_ENCODINGTYPE_DELTALZ4) {
+		if constexpr (std::is_integral<T>::value) {
+			typedef typename std::make_unsigned<T>::type TUnsigned;
+			TUnsigned nValue = 0;
+			for (auto& row : rows) {
+				nValue += (TUnsigned)row;
+				row = (T)nValue;
+			}
+		}
+		else {
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNENCODING);
+		}
+	}
 }
 
 
@@ -184,11 +284,16 @@ public:
 		}
 	}
 
-	void writeCSVValue(size_t nRowIndex, std::vector<char>& buffer, size_t& nBufferPosition) override
+	void writeCSVValue(size_t nRowIndex, bool bRoundTripDoubles, std::vector<char>& buffer, size_t& nBufferPosition) override
 	{
 		if (nRowIndex < m_Rows.size()) {
 
 			double dValue = m_Rows[nRowIndex];
+			if (bRoundTripDoubles) {
+				writeDoubleToBuffer(dValue, buffer, nBufferPosition);
+				return;
+			}
+
 			uint64_t nQuantizedValue;
 
 
@@ -248,6 +353,21 @@ public:
 		}
 	}
 
+	uint32_t getCompressedEncodingType() override
+	{
+		return DATATABLE_ENCODINGTYPE_LZ4;
+	}
+
+	void encodeData(uint32_t nEncodingType, std::vector<uint8_t>& encodedData) override
+	{
+		encodeDataTableColumnRows(m_Rows, nEncodingType, encodedData);
+	}
+
+	void decodeData(uint32_t nEncodingType, const std::vector<uint8_t>& encodedData, uint64_t nEntryCount) override
+	{
+		decodeDataTableColumnRows(m_Rows, nEncodingType, encodedData, nEntryCount);
+	}
+
 	void fillScatterplotXCoordinates(AMC::CScatterplot* pScatterplot, double dScaleFactor, double dOffset) override
 	{
 		if (pScatterplot == nullptr)
@@ -363,7 +483,7 @@ public:
 		}
 	}
 
-	void writeCSVValue(size_t nRowIndex, std::vector<char>& buffer, size_t& nBufferPosition) override
+	void writeCSVValue(size_t nRowIndex, bool bRoundTripDoubles, std::vector<char>& buffer, size_t& nBufferPosition) override
 	{
 		if (nRowIndex < m_Rows.size()) {
 
@@ -417,6 +537,21 @@ public:
 		}
 	}
 
+	uint32_t getCompressedEncodingType() override
+	{
+		return DATATABLE_ENCODINGTYPE_DELTALZ4;
+	}
+
+	void encodeData(uint32_t nEncodingType, std::vector<uint8_t>& encodedData) override
+	{
+		encodeDataTableColumnRows(m_Rows, nEncodingType, encodedData);
+	}
+
+	void decodeData(uint32_t nEncodingType, const std::vector<uint8_t>& encodedData, uint64_t nEntryCount) override
+	{
+		decodeDataTableColumnRows(m_Rows, nEncodingType, encodedData, nEntryCount);
+	}
+
 	void fillScatterplotXCoordinates(AMC::CScatterplot* pScatterplot, double dScaleFactor, double dOffset) override
 	{
 		if (pScatterplot == nullptr)
@@ -465,29 +600,10 @@ public:
 		if (pScatterplot == nullptr)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
 
-		auto & channelEntries = pScatterplot->getChannelEntries();
-		auto channelIter = channelEntries.find(sChannel);
-
-		if (channelIter == channelEntries.end()) {
-			channelEntries[sChannel][sColumn] = std::vector<double>();
-		}
-		else {
-			auto & columnEntries = channelIter->second;
-
-			if (columnEntries.find(sColumn) == columnEntries.end())
-				columnEntries[sColumn] = std::vector<double>();
-			else {
-				std::string sException = "The channel = " + sChannel + " with the column = " + sColumn + " already exists";
-				throw std::runtime_error(sException.c_str());
-			}
-		}
-
-		auto & vecColumn = channelEntries[sChannel][sColumn];
-
-		vecColumn.resize(m_Rows.size());
+		double* pValues = pScatterplot->addChannelColumn(sChannel, sColumn, m_Rows.size());
 
 		for (size_t nIndex = 0; nIndex < m_Rows.size(); nIndex++) {
-			vecColumn[nIndex] = (double)m_Rows.at(nIndex) * dScaleFactor + dOffset;
+			pValues[nIndex] = (double)m_Rows[nIndex] * dScaleFactor + dOffset;
 		}
 	}
 
@@ -557,7 +673,7 @@ public:
 		}
 	}
 
-	void writeCSVValue(size_t nRowIndex, std::vector<char>& buffer, size_t& nBufferPosition) override
+	void writeCSVValue(size_t nRowIndex, bool bRoundTripDoubles, std::vector<char>& buffer, size_t& nBufferPosition) override
 	{
 		if (nRowIndex < m_Rows.size()) {
 			uint64_t nValue = m_Rows[nRowIndex];
@@ -603,6 +719,21 @@ public:
 		}
 	}
 
+	uint32_t getCompressedEncodingType() override
+	{
+		return DATATABLE_ENCODINGTYPE_DELTALZ4;
+	}
+
+	void encodeData(uint32_t nEncodingType, std::vector<uint8_t>& encodedData) override
+	{
+		encodeDataTableColumnRows(m_Rows, nEncodingType, encodedData);
+	}
+
+	void decodeData(uint32_t nEncodingType, const std::vector<uint8_t>& encodedData, uint64_t nEntryCount) override
+	{
+		decodeDataTableColumnRows(m_Rows, nEncodingType, encodedData, nEntryCount);
+	}
+
 	void fillScatterplotXCoordinates(AMC::CScatterplot* pScatterplot, double dScaleFactor, double dOffset) override
 	{
 		if (pScatterplot == nullptr)
@@ -717,19 +848,11 @@ public:
 		}
 	}
 
-	void writeCSVValue(size_t nRowIndex, std::vector<char>& buffer, size_t& nBufferPosition) override
+	void writeCSVValue(size_t nRowIndex, bool bRoundTripDoubles, std::vector<char>& buffer, size_t& nBufferPosition) override
 	{
 		if (nRowIndex < m_Rows.size()) {
 			int32_t nValue = m_Rows[nRowIndex];
-			if (nValue >= 0) {
-				writeUint64ToBuffer((uint64_t) nValue, buffer, nBufferPosition);
-			}
-			else {
-				buffer.at(nBufferPosition) = '-';
-				nBufferPosition++;
-
-				writeUint64ToBuffer((uint64_t)(- nValue), buffer, nBufferPosition);
-			}
+			writeInt64ToBuffer(nValue, buffer, nBufferPosition);
 
 		}
 		else {
@@ -771,6 +894,21 @@ public:
 		}
 	}
 
+	uint32_t getCompressedEncodingType() override
+	{
+		return DATATABLE_ENCODINGTYPE_DELTALZ4;
+	}
+
+	void encodeData(uint32_t nEncodingType, std::vector<uint8_t>& encodedData) override
+	{
+		encodeDataTableColumnRows(m_Rows, nEncodingType, encodedData);
+	}
+
+	void decodeData(uint32_t nEncodingType, const std::vector<uint8_t>& encodedData, uint64_t nEntryCount) override
+	{
+		decodeDataTableColumnRows(m_Rows, nEncodingType, encodedData, nEntryCount);
+	}
+
 	void fillScatterplotXCoordinates(AMC::CScatterplot* pScatterplot, double dScaleFactor, double dOffset) override
 	{
 		if (pScatterplot == nullptr)
@@ -884,19 +1022,11 @@ public:
 		}
 	}
 
-	void writeCSVValue(size_t nRowIndex, std::vector<char>& buffer, size_t& nBufferPosition) override
+	void writeCSVValue(size_t nRowIndex, bool bRoundTripDoubles, std::vector<char>& buffer, size_t& nBufferPosition) override
 	{
 		if (nRowIndex < m_Rows.size()) {
 			int64_t nValue = m_Rows[nRowIndex];
-			if (nValue >= 0) {
-				writeUint64ToBuffer((uint64_t)nValue, buffer, nBufferPosition);
-			}
-			else {
-				buffer.at(nBufferPosition) = '-';
-				nBufferPosition++;
-
-				writeUint64ToBuffer((uint64_t)(-nValue), buffer, nBufferPosition);
-			}
+			writeInt64ToBuffer(nValue, buffer, nBufferPosition);
 
 		}
 		else {
@@ -939,6 +1069,21 @@ public:
 		}
 	}
 
+	uint32_t getCompressedEncodingType() override
+	{
+		return DATATABLE_ENCODINGTYPE_DELTALZ4;
+	}
+
+	void encodeData(uint32_t nEncodingType, std::vector<uint8_t>& encodedData) override
+	{
+		encodeDataTableColumnRows(m_Rows, nEncodingType, encodedData);
+	}
+
+	void decodeData(uint32_t nEncodingType, const std::vector<uint8_t>& encodedData, uint64_t nEntryCount) override
+	{
+		decodeDataTableColumnRows(m_Rows, nEncodingType, encodedData, nEntryCount);
+	}
+
 	void fillScatterplotXCoordinates(AMC::CScatterplot* pScatterplot, double dScaleFactor, double dOffset) override
 	{
 		if (pScatterplot == nullptr)
@@ -1364,8 +1509,11 @@ void CDataTable::WriteCSVToStream(ITempStreamWriter* pWriter, IDataTableCSVWrite
 	size_t nMaxBytesPerEntry = DATATABLE_DEFAULTCSVMAXBYTESPERENTRY;
 	size_t nChunkSize = DATATABLE_DEFAULTCSVCHUNKSIZE;
 
+	bool bRoundTripDoubles = false;
+
 	if (pOptions != nullptr) {
 		sSeparator = pOptions->GetSeparator();
+		bRoundTripDoubles = pOptions->GetRoundTripDoubles();
 	}
 
 	if (sSeparator.length () != 1)
@@ -1389,52 +1537,106 @@ void CDataTable::WriteCSVToStream(ITempStreamWriter* pWriter, IDataTableCSVWrite
 	pWriter->WriteLine(sHeader.str ());
 
 	size_t nRowCount = m_nMaxRowCount;
-	size_t nBufferSize = nChunkSize * nMaxBytesPerEntry * (m_Columns.size() + 1);
-	std::vector<char> buffer (nBufferSize);
-
-	size_t nChunkCount = (nRowCount + nChunkSize - 1) / nChunkSize;
+	size_t nBytesPerRow = nMaxBytesPerEntry * (m_Columns.size() + 1);
+
+	// Every worker formats a consecutive block of rows into its own buffer, the blocks are written in order
+	size_t nRowsPerWorker = DATATABLE_CSVWORKERBUFFERSIZE / nBytesPerRow;
+	if (nRowsPerWorker < nChunkSize)
+		nRowsPerWorker = nChunkSize;
+
+	size_t nWorkerCount = std::thread::hardware_concurrency();
+	if (nWorkerCount > DATATABLE_MAXWORKERCOUNT)
+		nWorkerCount = DATATABLE_MAXWORKERCOUNT;
+	size_t nNeededWorkerCount = (nRowCount + nRowsPerWorker - 1) / nRowsPerWorker;
+	if (nWorkerCount > nNeededWorkerCount)
+		nWorkerCount = nNeededWorkerCount;
+	if (nWorkerCount < 1)
+		nWorkerCount = 1;
+
+	std::vector<std::vector<char>> workerBuffers(nWorkerCount);
+	std::vector<size_t> workerBufferPositions(nWorkerCount);
+	std::vector<std::exception_ptr> workerExceptions(nWorkerCount);
+	for (auto& workerBuffer : workerBuffers)
+		workerBuffer.resize(nRowsPerWorker * nBytesPerRow);
+
+	size_t nBatchRowCount = nRowsPerWorker * nWorkerCount;
+	for (size_t nBatchStart = 0; nBatchStart < nRowCount; nBatchStart += nBatchRowCount) {
+
+		auto formatBlock = [&](size_t nWorkerIndex) {
+			size_t nRowStart = nBatchStart + nWorkerIndex * nRowsPerWorker;
+			size_t nRowEnd = std::min(nRowStart + nRowsPerWorker, nRowCount);
+			workerBufferPositions[nWorkerIndex] = 0;
+			if (nRowStart < nRowEnd)
+				writeCSVRows(nRowStart, nRowEnd, cSeparator, sNewLine, bRoundTripDoubles, workerBuffers[nWorkerIndex], workerBufferPositions[nWorkerIndex]);
+		};
+
+		if (nWorkerCount == 1) {
+			formatBlock(0);
+		}
+		else {
+			std::vector<std::thread> workerThreads;
+			workerThreads.reserve(nWorkerCount);
+
+			for (size_t nWorkerIndex = 0; nWorkerIndex < nWorkerCount; nWorkerIndex++) {
+				workerThreads.push_back(std::thread([&, nWorkerIndex]() {
+					try {
+						formatBlock(nWorkerIndex);
+					}
+					catch (...) {
+						workerExceptions[nWorkerIndex] = std::current_exception();
+					}
+				}));
+			}
 
-	for (size_t nChunkIndex = 0; nChunkIndex < nChunkCount; nChunkIndex++) {
+			for (auto& workerThread : workerThreads)
+				workerThread.join();
 
-		size_t nChunkPosition = 0;
+			for (auto& workerException : workerExceptions) {
+				if (workerException)
+					std::rethrow_exception(workerException);
+			}
+		}
 
-		for (size_t nRowIndexInChunk = 0; nRowIndexInChunk < nChunkSize; nRowIndexInChunk++) {
-			size_t nRowIndex = nChunkIndex * nChunkSize + nRowIndexInChunk;
-			if (nRowIndex >= m_nMaxRowCount)
-				break;
-   
-			auto iIter = m_Columns.begin();
-			while (iIter != m_Columns.end()) {
+		for (size_t nWorkerIndex = 0; nWorkerIndex < nWorkerCount; nWorkerIndex++) {
+			if (workerBufferPositions[nWorkerIndex] > 0)
+				pWriter->WriteData(workerBufferPositions[nWorkerIndex], (uint8_t*)workerBuffers[nWorkerIndex].data());
+		}
+	}
 
-				(*iIter)->writeCSVValue(nRowIndex, buffer, nChunkPosition);
+}
 
-				if (nChunkPosition + 1 >= nBufferSize)
-					throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_DATATABLECSVBUFFEROVERFLOW);
+void CDataTable::writeCSVRows(size_t nRowStart, size_t nRowEnd, char cSeparator, const std::string& sNewLine, bool bRoundTripDoubles, std::vector<char>& buffer, size_t& nBufferPosition)
+{
+	size_t nBufferSize = buffer.size();
 
-				iIter++;
+	for (size_t nRowIndex = nRowStart; nRowIndex < nRowEnd; nRowIndex++) {
 
-				if (iIter != m_Columns.end()) {
-					buffer.at(nChunkPosition) = cSeparator;
-					nChunkPosition++;
-				}
+		auto iIter = m_Columns.begin();
+		while (iIter != m_Columns.end()) {
 
-			}
+			(*iIter)->writeCSVValue(nRowIndex, bRoundTripDoubles, buffer, nBufferPosition);
 
-			if (nChunkPosition + 1 >= nBufferSize)
+			if (nBufferPosition + 1 >= nBufferSize)
 				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_DATATABLECSVBUFFEROVERFLOW);
 
-			for (auto ch : sNewLine) {
-				buffer.at(nChunkPosition) = ch;
-				nChunkPosition++;
+			iIter++;
+
+			if (iIter != m_Columns.end()) {
+				buffer[nBufferPosition] = cSeparator;
+				nBufferPosition++;
 			}
 
 		}
 
-		pWriter->WriteData(nChunkPosition, (uint8_t*)buffer.data());
-	}
-
+		if (nBufferPosition + sNewLine.length() >= nBufferSize)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_DATATABLECSVBUFFEROVERFLOW);
 
+		for (auto ch : sNewLine) {
+			buffer[nBufferPosition] = ch;
+			nBufferPosition++;
+		}
 
+	}
 }
 
 void CDataTable::WriteDataToStream(ITempStreamWriter* pWriter, IDataTableWriteOptions* pOptions)
@@ -1442,18 +1644,80 @@ void CDataTable::WriteDataToStream(ITempStreamWriter* pWriter, IDataTableWriteOp
 	if (pWriter == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
 
+	bool bCompressColumns = false;
+	if (pOptions != nullptr)
+		bCompressColumns = pOptions->GetCompressColumns();
+
+	// Compressed columns need to be encoded before the column table can be written.
+	size_t nColumnCount = m_Columns.size();
+	std::vector<uint32_t> encodingTypes(nColumnCount, DATATABLE_ENCODINGTYPE_RAW);
+	std::vector<std::vector<uint8_t>> encodedColumns(nColumnCount);
+
+	if (bCompressColumns) {
+		for (size_t nColumnIndex = 0; nColumnIndex < nColumnCount; nColumnIndex++) {
+			auto pColumn = m_Columns.at(nColumnIndex);
+			// Columns that exceed the LZ4 input limit are stored uncompressed
+			if (pColumn->getRowCount() * pColumn->getEntrySizeInBytes() <= (uint64_t)LZ4_MAX_INPUT_SIZE)
+				encodingTypes.at(nColumnIndex) = pColumn->getCompressedEncodingType();
+		}
+
+		std::vector<std::exception_ptr> columnExceptions(nColumnCount);
+		auto encodeColumn = [&](size_t nColumnIndex) {
+			try {
+				if (encodingTypes.at(nColumnIndex) != DATATABLE_ENCODINGTYPE_RAW)
+					m_Columns.at(nColumnIndex)->encodeData(encodingTypes.at(nColumnIndex), encodedColumns.at(nColumnIndex));
+			}
+			catch (...) {
+				columnExceptions.at(nColumnIndex) = std::current_exception();
+			}
+		};
+
+		// Every worker encodes every n-th column, so wide tables do not start a thread per column
+		size_t nWorkerCount = std::thread::hardware_concurrency();
+		if (nWorkerCount > DATATABLE_MAXWORKERCOUNT)
+			nWorkerCount = DATATABLE_MAXWORKERCOUNT;
+		if (nWorkerCount > nColumnCount)
+			nWorkerCount = nColumnCount;
+		if (nWorkerCount < 1)
+			nWorkerCount = 1;
+
+		auto encodeColumns = [&](size_t nWorkerIndex) {
+			for (size_t nColumnIndex = nWorkerIndex; nColumnIndex < nColumnCount; nColumnIndex += nWorkerCount)
+				encodeColumn(nColumnIndex);
+		};
+
+		if (nWorkerCount == 1) {
+			encodeColumns(0);
+		}
+		else {
+			std::vector<std::thread> encodingThreads;
+			encodingThreads.reserve(nWorkerCount);
+			for (size_t nWorkerIndex = 0; nWorkerIndex < nWorkerCount; nWorkerIndex++)
+				encodingThreads.push_back(std::thread(encodeColumns, nWorkerIndex));
+
+			for (auto& encodingThread : encodingThreads)
+				encodingThread.join();
+		}
+
+		for (auto& columnException : columnExceptions) {
+			if (columnException)
+				std::rethrow_exception(columnException);
+		}
+	}
+
 	sLibMCDataTableStreamHeader header;
 	memset((void*)&header, 0, sizeof(header));
 
 	uint64_t currentDataStart = sizeof (header);
 	header.m_nSignature = DATATABLE_HEADERSIGNATURE;
 	header.m_nColumnTableStart = currentDataStart;
-	header.m_nColumnCount = (uint32_t)m_Columns.size();
+	header.m_nColumnCount = (uint32_t)nColumnCount;
 	pWriter->WriteData(sizeof (header), (uint8_t*)&header);
 
-	currentDataStart += m_Columns.size() * sizeof(sLibMCDataTableColumnHeader);
+	currentDataStart += nColumnCount * sizeof(sLibMCDataTableColumnHeader);
 
-	for (auto pColumn : m_Columns) {
+	for (size_t nColumnIndex = 0; nColumnIndex < nColumnCount; nColumnIndex++) {
+		auto pColumn = m_Columns.at(nColumnIndex);
 		std::string sIdentifier = pColumn->getIdentifier();
 		std::string sDescription = pColumn->getDescription();
 
@@ -1470,15 +1734,23 @@ void CDataTable::WriteDataToStream(ITempStreamWriter* pWriter, IDataTableWriteOp
 
 		columnHeader.m_nEntryCount = pColumn->getRowCount();
 		columnHeader.m_nColumnDataType = (uint32_t)pColumn->getColumnType();
-		columnHeader.m_nEncodingType = (uint32_t)DATATABLE_ENCODINGTYPE_RAW;
+		columnHeader.m_nEncodingType = encodingTypes.at(nColumnIndex);
 		columnHeader.m_nColumnDataStart = currentDataStart;
-		
-		currentDataStart += columnHeader.m_nEntryCount * pColumn->getEntrySizeInBytes();
+
+		if (columnHeader.m_nEncodingType == DATATABLE_ENCODINGTYPE_RAW) {
+			columnHeader.m_nEncodedDataSize = columnHeader.m_nEntryCount * pColumn->getEntrySizeInBytes();
+		}
+		else {
+			columnHeader.m_nEncodedDataSize = encodedColumns.at(nColumnIndex).size();
+		}
+
+		currentDataStart += columnHeader.m_nEncodedDataSize;
 
 		pWriter->WriteData(sizeof(columnHeader), (uint8_t*)&columnHeader);
 	}
 
-	for (auto pColumn : m_Columns) {
+	for (size_t nColumnIndex = 0; nColumnIndex < nColumnCount; nColumnIndex++) {
+		auto pColumn = m_Columns.at(nColumnIndex);
 		std::string sIdentifier = pColumn->getIdentifier();
 		std::string sDescription = pColumn->getDescription();		
 		if (sIdentifier.size() > 0)
@@ -1486,7 +1758,14 @@ void CDataTable::WriteDataToStream(ITempStreamWriter* pWriter, IDataTableWriteOp
 		if (sDescription.size() > 0)
 			pWriter->WriteData(sDescription.length(), (const uint8_t*)sDescription.c_str());
 
-		pColumn->WriteDataToStream(pWriter);
+		if (encodingTypes.at(nColumnIndex) == DATATABLE_ENCODINGTYPE_RAW) {
+			pColumn->WriteDataToStream(pWriter);
+		}
+		else {
+			auto& encodedData = encodedColumns.at(nColumnIndex);
+			if (encodedData.size() > 0)
+				pWriter->WriteData(encodedData.size(), encodedData.data());
+		}
 	}
 
 }
@@ -1512,6 +1791,8 @@ void CDataTable::LoadFromStream(IStreamReader* pStream)
 
 	if (header.m_nColumnCount > 0) {
 
+		uint64_t nStreamSize = pStream->GetSize();
+
 		std::vector<sLibMCDataTableColumnHeader> columnHeaders;
 		columnHeaders.resize(header.m_nColumnCount);
 
@@ -1545,7 +1826,35 @@ void CDataTable::LoadFromStream(IStreamReader* pStream)
 
 			auto pColumn = addColumnEx(sIdentifier, sDescription, (LibMCEnv::eDataTableColumnType)columnHeader.m_nColumnDataType);
 			pStream->Seek(columnHeader.m_nColumnDataStart);
-			pColumn->ReadDataFromStream(pStream, columnHeader.m_nEntryCount);
+
+			switch (columnHeader.m_nEncodingType) {
+				case DATATABLE_ENCODINGTYPE_RAW:
+					pColumn->ReadDataFromStream(pStream, columnHeader.m_nEntryCount);
+					break;
+
+				case DATATABLE_ENCODINGTYPE_LZ4:
+				case DATATABLE_ENCODINGTYPE_DELTALZ4: {
+					// The encoded size comes from the stream, so it is checked before anything is allocated
+					uint64_t nEntrySize = pColumn->getEntrySizeInBytes();
+					if ((nEntrySize == 0) || (columnHeader.m_nEntryCount > (uint64_t)LZ4_MAX_INPUT_SIZE / nEntrySize))
+						throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COULDNOTDECOMPRESSDATATABLECOLUMN, "column is too large");
+					if (columnHeader.m_nEncodedDataSize > (uint64_t)LZ4_COMPRESSBOUND(columnHeader.m_nEntryCount * nEntrySize))
+						throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COULDNOTDECOMPRESSDATATABLECOLUMN, "invalid encoded column size: " + std::to_string(columnHeader.m_nEncodedDataSize));
+					if ((columnHeader.m_nColumnDataStart > nStreamSize) || (columnHeader.m_nEncodedDataSize > nStreamSize - columnHeader.m_nColumnDataStart))
+						throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COULDNOTDECOMPRESSDATATABLECOLUMN, "encoded column exceeds the stream size");
+
+					std::vector<uint8_t> encodedData;
+					encodedData.resize((size_t)columnHeader.m_nEncodedDataSize);
+					if (encodedData.size() > 0)
+						pStream->ReadData(encodedData.size(), encodedData.size(), nullptr, encodedData.data());
+
+					pColumn->decodeData(columnHeader.m_nEncodingType, encodedData, columnHeader.m_nEntryCount);
+					break;
+				}
+
+				default:
+					throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNENCODING, "invalid data table column encoding: " + std::to_string(columnHeader.m_nEncodingType));
+			}
 			
 		}
 
@@ -1600,6 +1909,18 @@ IScatterPlot* CDataTable::CalculateScatterPlot(IDataTableScatterPlotOptions* pSc
 
 	pScatterPlotInstance->computeBoundaries();
 
+	// Collect the channel columns first, so that the scatterplot values are allocated only once
+	struct sChannelColumn {
+		std::string m_sChannelIdentifier;
+		std::string m_sColumnIdentifier;
+		CDataTableColumn* m_pColumn;
+		double m_dScaleFactor;
+		double m_dOffset;
+	};
+
+	std::vector<sChannelColumn> channelColumns;
+	uint64_t nChannelValueCount = 0;
+
 	auto pDataChannelsIterator = pScatterPlotInput->ListDataChannels();
 	while (pDataChannelsIterator->MoveNext()) {
 		auto pDataChannel = dynamic_cast<IScatterPlotDataChannel*>(pDataChannelsIterator->GetCurrent());
@@ -1611,11 +1932,18 @@ IScatterPlot* CDataTable::CalculateScatterPlot(IDataTableScatterPlotOptions* pSc
 			auto sColumnIdentifier = pDataColumn->GetColumnIdentifier();
 
 			auto pColumn = findColumn(sColumnIdentifier, false);
-			if (pColumn)
-				pColumn->fillScatterplotChannel(pScatterPlotInstance.get(), sChannelIdentifier, sColumnIdentifier, pDataColumn->GetScaleFactor(), pDataColumn->GetOffsetFactor());
+			if (pColumn) {
+				channelColumns.push_back({ sChannelIdentifier, sColumnIdentifier, pColumn, pDataColumn->GetScaleFactor(), pDataColumn->GetOffsetFactor() });
+				nChannelValueCount += pColumn->getRowCount();
+			}
 		}
 	}
 
+	pScatterPlotInstance->reserveChannelValues(nChannelValueCount);
+
+	for (auto& channelColumn : channelColumns)
+		channelColumn.m_pColumn->fillScatterplotChannel(pScatterPlotInstance.get(), channelColumn.m_sChannelIdentifier, channelColumn.m_sColumnIdentifier, channelColumn.m_dScaleFactor, channelColumn.m_dOffset);
+
 	m_pToolpathHandler->storeScatterplot(pScatterPlotInstance);
 
 	return new CScatterPlot (pScatterPlotInstance);
@@ -68,6 +68,8 @@ protected:
 
 	void writeUint64ToBufferFixedDigits(uint64_t nValue, uint32_t nFixedDigits, std::vector<char>& buffer, size_t& nBufferPosition);
 	void writeUint64ToBuffer(uint64_t nValue, std::vector<char>& buffer, size_t& nBufferPosition);
+	void writeInt64ToBuffer(int64_t nValue, std::vector<char>& buffer, size_t& nBufferPosition);
+	void writeDoubleToBuffer(double dValue, std::vector<char>& buffer, size_t& nBufferPosition);
 
 public:
 
@@ -85,12 +87,19 @@ public:
 
 	void setDescription(const std::string& sDescription);
 
-	virtual void writeCSVValue(size_t nRowIndex, std::vector<char>& buffer, size_t& nBufferPosition) = 0;
+	virtual void writeCSVValue(size_t nRowIndex, bool bRoundTripDoubles, std::vector<char>& buffer, size_t& nBufferPosition) = 0;
 
 	virtual void WriteDataToStream(ITempStreamWriter* pWriter) = 0;
 
 	virtual void ReadDataFromStream(IStreamReader* pReader, uint64_t nEntryCount) = 0;
 
+	// Encoding that is used when the column is written compressed.
+	virtual uint32_t getCompressedEncodingType() = 0;
+
+	virtual void encodeData(uint32_t nEncodingType, std::vector<uint8_t>& encodedData) = 0;
+
+	virtual void decodeData(uint32_t nEncodingType, const std::vector<uint8_t>& encodedData, uint64_t nEntryCount) = 0;
+
 	virtual size_t getEntrySizeInBytes() = 0;
 
 	virtual void fillScatterplotXCoordinates (AMC::CScatterplot* pScatterplot, double dScaleFactor, double dOffset) = 0;
@@ -120,6 +129,9 @@ private:
 
 	PDataTableColumn addColumnEx(const std::string& sIdentifier, const std::string& sDescription, const LibMCEnv::eDataTableColumnType eColumnType);
 
+	// Formats the rows [nRowStart, nRowEnd) into the buffer. May be called from several threads at once.
+	void writeCSVRows(size_t nRowStart, size_t nRowEnd, char cSeparator, const std::string& sNewLine, bool bRoundTripDoubles, std::vector<char>& buffer, size_t& nBufferPosition);
+
 public:
 
 	static CDataTable* makeFromStream (IStreamReader * pStreamReader, AMC::PToolpathHandler pToolpathHandler);
@@ -44,7 +44,7 @@ using namespace LibMCEnv::Impl;
 **************************************************************************************************************************/
 
 CDataTableCSVWriteOptions::CDataTableCSVWriteOptions()
-    : m_sSeparator(DATATABLE_DEFAULTCSVSEPARATOR)
+    : m_sSeparator(DATATABLE_DEFAULTCSVSEPARATOR), m_bRoundTripDoubles (false)
 {
 }
 
@@ -73,3 +73,12 @@ void CDataTableCSVWriteOptions::SetSeparator(const std::string & sSeparator)
     m_sSeparator = ch;
 }
 
+bool CDataTableCSVWriteOptions::GetRoundTripDoubles()
+{
+    return m_bRoundTripDoubles;
+}
+
+void CDataTableCSVWriteOptions::SetRoundTripDoubles(const bool bRoundTripDoubles)
+{
+    m_bRoundTripDoubles = bRoundTripDoubles;
+}
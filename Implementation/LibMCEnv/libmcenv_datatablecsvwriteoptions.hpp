@@ -59,6 +59,7 @@ class CDataTableCSVWriteOptions : public virtual IDataTableCSVWriteOptions, publ
 private:	
 
     std::string m_sSeparator;
+    bool m_bRoundTripDoubles;
 
 public:
 
@@ -70,6 +71,10 @@ public:
 
 	void SetSeparator(const std::string & sSeparator) override;
 
+	bool GetRoundTripDoubles() override;
+
+	void SetRoundTripDoubles(const bool bRoundTripDoubles) override;
+
 };
 
 } // namespace Impl
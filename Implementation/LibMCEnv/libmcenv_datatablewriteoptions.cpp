@@ -44,6 +44,7 @@ using namespace LibMCEnv::Impl;
 **************************************************************************************************************************/
 
 CDataTableWriteOptions::CDataTableWriteOptions()
+    : m_bCompressColumns (false)
 {
 
 }
@@ -53,3 +54,12 @@ CDataTableWriteOptions::~CDataTableWriteOptions()
 
 }
 
+bool CDataTableWriteOptions::GetCompressColumns()
+{
+    return m_bCompressColumns;
+}
+
+void CDataTableWriteOptions::SetCompressColumns(const bool bCompressColumns)
+{
+    m_bCompressColumns = bCompressColumns;
+}
@@ -58,7 +58,7 @@ namespace Impl {
 class CDataTableWriteOptions : public virtual IDataTableWriteOptions, public virtual CBase {
 private:
 
-
+    bool m_bCompressColumns;
 
 public:
 
@@ -66,6 +66,10 @@ public:
 
     virtual ~CDataTableWriteOptions();
 
+	bool GetCompressColumns() override;
+
+	void SetCompressColumns(const bool bCompressColumns) override;
+
 };
 
 } // namespace Impl
@@ -205,3 +205,13 @@ IDiscreteFieldData2D * CDiscreteFieldData2D::Duplicate()
 	return new CDiscreteFieldData2D(pNewField);
 }
 
+bool CDiscreteFieldData2D::GetSinglePrecisionStorage()
+{
+	return m_pDiscreteFieldDataInstance->isSinglePrecision();
+}
+
+void CDiscreteFieldData2D::SetSinglePrecisionStorage(const bool bSinglePrecision)
+{
+	m_pDiscreteFieldDataInstance->setSinglePrecision(bSinglePrecision);
+}
+
@@ -112,6 +112,10 @@ public:
 
 	IDiscreteFieldData2D * Duplicate() override;
 
+	bool GetSinglePrecisionStorage() override;
+
+	void SetSinglePrecisionStorage(const bool bSinglePrecision) override;
+
 };
 
 } // namespace Impl
@@ -44,6 +44,233 @@ Abstract: This is a stub class definition of CImageData
 #include "common_jpeg.hpp"
 
 #include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define IMAGEDATA_USESSE2
+#endif
+
+// Row converters used by WriteToRawMemory. Each converts nCount pixels of a row, 16-bit colors are stored as RGB565
+// with blue in the upper five bits, matching the framebuffer layout.
+typedef void (*ImageDataRowConverter) (const uint8_t* pSource, uint8_t* pTarget, uint32_t nCount);
+
+static inline uint16_t packRGB565(uint32_t nRed, uint32_t nGreen, uint32_t nBlue)
+{
+	return (uint16_t)(((nBlue & 0xF8) << 8) | ((nGreen & 0xFC) << 3) | (nRed >> 3));
+}
+
+static void convertImageRows(const uint8_t* pSource, size_t nSourceLineLength, uint8_t* pTarget, size_t nTargetLineLength, uint32_t nCountX, uint32_t nCountY, ImageDataRowConverter pConverter)
+{
+	for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
+		pConverter(pSource, pTarget, nCountX);
+		pSource += nSourceLineLength;
+		pTarget += nTargetLineLength;
+	}
+}
+
+// Returns true, if nCountY rows of nCountX pixels starting at nSourceOffset lie within a buffer of nBufferSize bytes.
+// Empty regions are rejected, as the last row offset is undefined for them.
+static bool imageRowsAreInBuffer(size_t nSourceOffset, size_t nSourceLineLength, uint32_t nCountX, uint32_t nCountY, size_t nBytesPerPixel, size_t nBufferSize)
+{
+	if ((nCountX == 0) || (nCountY == 0))
+		return false;
+
+	return (nSourceOffset + (size_t)(nCountY - 1) * nSourceLineLength + (size_t)nCountX * nBytesPerPixel) <= nBufferSize;
+}
+
+static void convertRow_GreyScale8bitToRGB16bit(const uint8_t* pSource, uint8_t* pTarget, uint32_t nCount)
+{
+	uint16_t* pPixelPtr = (uint16_t*)pTarget;
+	uint32_t nIndex = 0;
+
+#ifdef IMAGEDATA_USESSE2
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i maskRB = _mm_set1_epi16(0x00F8);
+	const __m128i maskG = _mm_set1_epi16(0x00FC);
+	for (; nIndex + 16 <= nCount; nIndex += 16) {
+		__m128i grey = _mm_loadu_si128((const __m128i*) (pSource + nIndex));
+		for (uint32_t nHalf = 0; nHalf < 2; nHalf++) {
+			__m128i values = (nHalf == 0) ? _mm_unpacklo_epi8(grey, zero) : _mm_unpackhi_epi8(grey, zero);
+			__m128i blue = _mm_slli_epi16(_mm_and_si128(values, maskRB), 8);
+			__m128i green = _mm_slli_epi16(_mm_and_si128(values, maskG), 3);
+			__m128i red = _mm_srli_epi16(values, 3);
+			_mm_storeu_si128((__m128i*) (pPixelPtr + nIndex + nHalf * 8), _mm_or_si128(_mm_or_si128(blue, green), red));
+		}
+	}
+#endif
+
+	for (; nIndex < nCount; nIndex++) {
+		uint32_t nGrayValue = pSource[nIndex];
+		pPixelPtr[nIndex] = packRGB565(nGrayValue, nGrayValue, nGrayValue);
+	}
+}
+
+static void convertRow_RGB16bitToRGB16bit(const uint8_t* pSource, uint8_t* pTarget, uint32_t nCount)
+{
+	memcpy(pTarget, pSource, (size_t)nCount * 2);
+}
+
+static void convertRow_RGB24bitToRGB16bit(const uint8_t* pSource, uint8_t* pTarget, uint32_t nCount)
+{
+	uint16_t* pPixelPtr = (uint16_t*)pTarget;
+	for (uint32_t nIndex = 0; nIndex < nCount; nIndex++) {
+		pPixelPtr[nIndex] = packRGB565(pSource[0], pSource[1], pSource[2]);
+		pSource += 3;
+	}
+}
+
+static void convertRow_RGBA32bitToRGB16bit(const uint8_t* pSource, uint8_t* pTarget, uint32_t nCount)
+{
+	uint16_t* pPixelPtr = (uint16_t*)pTarget;
+	uint32_t nIndex = 0;
+
+#ifdef IMAGEDATA_USESSE2
+	// Pixels are handled as 32-bit lanes. The packed 16-bit results are biased into the signed range,
+	// as SSE2 only offers a signed saturating pack.
+	const __m128i maskRed = _mm_set1_epi32(0x000000F8);
+	const __m128i maskGreen = _mm_set1_epi32(0x0000FC00);
+	const __m128i maskBlue = _mm_set1_epi32(0x00F80000);
+	const __m128i bias32 = _mm_set1_epi32(0x8000);
+	const __m128i bias16 = _mm_set1_epi16((short)0x8000);
+
+	for (; nIndex + 8 <= nCount; nIndex += 8) {
+		__m128i packed[2];
+		for (uint32_t nHalf = 0; nHalf < 2; nHalf++) {
+			__m128i pixels = _mm_loadu_si128((const __m128i*) (pSource + ((size_t)nIndex + nHalf * 4) * 4));
+			__m128i red = _mm_srli_epi32(_mm_and_si128(pixels, maskRed), 3);
+			__m128i green = _mm_srli_epi32(_mm_and_si128(pixels, maskGreen), 5);
+			__m128i blue = _mm_srli_epi32(_mm_and_si128(pixels, maskBlue), 8);
+			packed[nHalf] = _mm_sub_epi32(_mm_or_si128(_mm_or_si128(red, green), blue), bias32);
+		}
+		__m128i colors = _mm_add_epi16(_mm_packs_epi32(packed[0], packed[1]), bias16);
+		_mm_storeu_si128((__m128i*) (pPixelPtr + nIndex), colors);
+	}
+#endif
+
+	for (; nIndex < nCount; nIndex++) {
+		const uint8_t* pPixel = pSource + (size_t)nIndex * 4;
+		pPixelPtr[nIndex] = packRGB565(pPixel[0], pPixel[1], pPixel[2]);
+	}
+}
+
+static void convertRow_GreyScale8bitToRGB24bit(const uint8_t* pSource, uint8_t* pTarget, uint32_t nCount)
+{
+	for (uint32_t nIndex = 0; nIndex < nCount; nIndex++) {
+		uint8_t nGrayValue = pSource[nIndex];
+		pTarget[0] = nGrayValue;
+		pTarget[1] = nGrayValue;
+		pTarget[2] = nGrayValue;
+		pTarget += 3;
+	}
+}
+
+static void convertRow_RGB16bitToRGB24bit(const uint8_t* pSource, uint8_t* pTarget, uint32_t nCount)
+{
+	for (uint32_t nIndex = 0; nIndex < nCount; nIndex++) {
+		uint32_t nColor = (uint32_t)pSource[0] | ((uint32_t)pSource[1] << 8);
+		pTarget[0] = (uint8_t)((nColor & 0x1f) << 3);
+		pTarget[1] = (uint8_t)(((nColor >> 5) & 0x3f) << 2);
+		pTarget[2] = (uint8_t)(((nColor >> 11) & 0x1f) << 3);
+		pSource += 2;
+		pTarget += 3;
+	}
+}
+
+static void convertRow_RGB24bitToRGB24bit(const uint8_t* pSource, uint8_t* pTarget, uint32_t nCount)
+{
+	memcpy(pTarget, pSource, (size_t)nCount * 3);
+}
+
+static void convertRow_RGBA32bitToRGB24bit(const uint8_t* pSource, uint8_t* pTarget, uint32_t nCount)
+{
+	for (uint32_t nIndex = 0; nIndex < nCount; nIndex++) {
+		pTarget[0] = pSource[0];
+		pTarget[1] = pSource[1];
+		pTarget[2] = pSource[2];
+		pSource += 4;
+		pTarget += 3;
+	}
+}
+
+static void convertRow_GreyScale8bitToRGBA32bit(const uint8_t* pSource, uint8_t* pTarget, uint32_t nCount)
+{
+	uint32_t nIndex = 0;
+
+#ifdef IMAGEDATA_USESSE2
+	const __m128i opaque = _mm_set1_epi8((char)0xFF);
+	for (; nIndex + 16 <= nCount; nIndex += 16) {
+		__m128i grey = _mm_loadu_si128((const __m128i*) (pSource + nIndex));
+		__m128i greyGreyLow = _mm_unpacklo_epi8(grey, grey);
+		__m128i greyGreyHigh = _mm_unpackhi_epi8(grey, grey);
+		__m128i greyAlphaLow = _mm_unpacklo_epi8(grey, opaque);
+		__m128i greyAlphaHigh = _mm_unpackhi_epi8(grey, opaque);
+
+		__m128i* pBlock = (__m128i*) (pTarget + (size_t)nIndex * 4);
+		_mm_storeu_si128(pBlock, _mm_unpacklo_epi16(greyGreyLow, greyAlphaLow));
+		_mm_storeu_si128(pBlock + 1, _mm_unpackhi_epi16(greyGreyLow, greyAlphaLow));
+		_mm_storeu_si128(pBlock + 2, _mm_unpacklo_epi16(greyGreyHigh, greyAlphaHigh));
+		_mm_storeu_si128(pBlock + 3, _mm_unpackhi_epi16(greyGreyHigh, greyAlphaHigh));
+	}
+#endif
+
+	for (; nIndex < nCount; nIndex++) {
+		uint8_t nGrayValue = pSource[nIndex];
+		uint8_t* pPixel = pTarget + (size_t)nIndex * 4;
+		pPixel[0] = nGrayValue;
+		pPixel[1] = nGrayValue;
+		pPixel[2] = nGrayValue;
+		pPixel[3] = 255;
+	}
+}
+
+static void convertRow_RGB16bitToRGBA32bit(const uint8_t* pSource, uint8_t* pTarget, uint32_t nCount)
+{
+	for (uint32_t nIndex = 0; nIndex < nCount; nIndex++) {
+		uint32_t nColor = (uint32_t)pSource[0] | ((uint32_t)pSource[1] << 8);
+		pTarget[0] = (uint8_t)((nColor & 0x1f) << 3);
+		pTarget[1] = (uint8_t)(((nColor >> 5) & 0x3f) << 2);
+		pTarget[2] = (uint8_t)(((nColor >> 11) & 0x1f) << 3);
+		pTarget[3] = 255;
+		pSource += 2;
+		pTarget += 4;
+	}
+}
+
+static void convertRow_RGB24bitToRGBA32bit(const uint8_t* pSource, uint8_t* pTarget, uint32_t nCount)
+{
+	for (uint32_t nIndex = 0; nIndex < nCount; nIndex++) {
+		pTarget[0] = pSource[0];
+		pTarget[1] = pSource[1];
+		pTarget[2] = pSource[2];
+		pTarget[3] = 255;
+		pSource += 3;
+		pTarget += 4;
+	}
+}
+
+static void convertRow_RGBA32bitToRGBA32bit(const uint8_t* pSource, uint8_t* pTarget, uint32_t nCount)
+{
+	// Copies the color channels and forces the alpha channel to be opaque.
+	uint32_t nIndex = 0;
+
+#ifdef IMAGEDATA_USESSE2
+	const __m128i opaque = _mm_set1_epi32((int)0xFF000000);
+	for (; nIndex + 4 <= nCount; nIndex += 4) {
+		__m128i pixels = _mm_loadu_si128((const __m128i*) (pSource + (size_t)nIndex * 4));
+		_mm_storeu_si128((__m128i*) (pTarget + (size_t)nIndex * 4), _mm_or_si128(pixels, opaque));
+	}
+#endif
+
+	for (; nIndex < nCount; nIndex++) {
+		const uint8_t* pPixel = pSource + (size_t)nIndex * 4;
+		uint8_t* pTargetPixel = pTarget + (size_t)nIndex * 4;
+		pTargetPixel[0] = pPixel[0];
+		pTargetPixel[1] = pPixel[1];
+		pTargetPixel[2] = pPixel[2];
+		pTargetPixel[3] = 255;
+	}
+}
 
 
 using namespace LibMCEnv::Impl;
@@ -1924,119 +2151,24 @@ void CImageData::writeToRawMemoryEx_RGB16bit(uint32_t nStartX, uint32_t nStartY,
 	if (((uint64_t)nStartY + nCountY) > m_nPixelCountY)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
 
-	uint8_t* pLinePtr = pTarget;
+	ImageDataRowConverter pConverter = nullptr;
+	size_t nSourceBytesPerPixel = 0;
 
 	switch (m_PixelFormat) {
-	case eImagePixelFormat::GreyScale8bit: {
-		size_t nLineAddress = (size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint16_t* pPixelPtr = (uint16_t*)pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				uint32_t nGrayValue = m_PixelData->at(nPixelAddress);
-				nPixelAddress++;
-
-				*pPixelPtr = ((nGrayValue & 0xF8) << 8) | ((nGrayValue & 0xFC) << 3) | (nGrayValue >> 3);
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += m_nPixelCountX;
-		}
-
-
-		break;
-	}
-
-
-	case eImagePixelFormat::RGB16bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 2;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint16_t* pPixelPtr = (uint16_t*)pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nLow = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nHigh = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint16_t nColor = nLow | (nHigh << 8);
-
-				*pPixelPtr = nColor;
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 2;
-		}
-
-		break;
-	}
-
-	case eImagePixelFormat::RGB24bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 3;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint16_t* pPixelPtr = (uint16_t*)pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-
-				*pPixelPtr = ((nBlue & 0xF8) << 8) | ((nGreen & 0xFC) << 3) | (nRed >> 3);
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
-		}
-
-		break;
-	}
-
-	case eImagePixelFormat::RGBA32bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 4;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint16_t* pPixelPtr = (uint16_t*)pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				nPixelAddress++; // alpha
-
-				*pPixelPtr = ((nBlue & 0xF8) << 8) | ((nGreen & 0xFC) << 3) | (nRed >> 3);
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
-		}
-
-		break;
-	}
-
+	case eImagePixelFormat::GreyScale8bit: pConverter = &convertRow_GreyScale8bitToRGB16bit; nSourceBytesPerPixel = 1; break;
+	case eImagePixelFormat::RGB16bit: pConverter = &convertRow_RGB16bitToRGB16bit; nSourceBytesPerPixel = 2; break;
+	case eImagePixelFormat::RGB24bit: pConverter = &convertRow_RGB24bitToRGB16bit; nSourceBytesPerPixel = 3; break;
+	case eImagePixelFormat::RGBA32bit: pConverter = &convertRow_RGBA32bitToRGB16bit; nSourceBytesPerPixel = 4; break;
 	default:
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
-
 	}
 
+	size_t nSourceLineLength = (size_t)m_nPixelCountX * nSourceBytesPerPixel;
+	size_t nSourceOffset = (size_t)nStartY * nSourceLineLength + (size_t)nStartX * nSourceBytesPerPixel;
+	if (!imageRowsAreInBuffer(nSourceOffset, nSourceLineLength, nCountX, nCountY, nSourceBytesPerPixel, m_PixelData->size()))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
+
+	convertImageRows(m_PixelData->data() + nSourceOffset, nSourceLineLength, pTarget, nYLineOffset, nCountX, nCountY, pConverter);
 
 }
 
@@ -2059,119 +2191,24 @@ void CImageData::writeToRawMemoryEx_RGB24bit(uint32_t nStartX, uint32_t nStartY,
 	if (((uint64_t)nStartY + nCountY) > m_nPixelCountY)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
 
-	uint8_t* pLinePtr = pTarget;
+	ImageDataRowConverter pConverter = nullptr;
+	size_t nSourceBytesPerPixel = 0;
 
 	switch (m_PixelFormat) {
-	case eImagePixelFormat::GreyScale8bit: {
-		size_t nLineAddress = (size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				uint8_t nGrayValue = m_PixelData->at(nPixelAddress);
-				nPixelAddress++;
-				*pPixelPtr = nGrayValue;  pPixelPtr++;
-				*pPixelPtr = nGrayValue;  pPixelPtr++;
-				*pPixelPtr = nGrayValue;  pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += m_nPixelCountX;
-		}
-
-
-		break;
-	}
-
-
-	case eImagePixelFormat::RGB16bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 2;
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nLow = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nHigh = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint16_t nColor = nLow | (nHigh << 8);
-
-				uint32_t nRed = (nColor & 0x1f) << 3;
-				uint32_t nGreen = ((nColor >> 5) & 0x3f) << 2;
-				uint32_t nBlue = ((nColor >> 11) & 0x1f) << 3;
-
-				*pPixelPtr = nRed; pPixelPtr++;
-				*pPixelPtr = nGreen; pPixelPtr++;
-				*pPixelPtr = nBlue; pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 2;
-		}
-
-		break;
-	}
-
-	case eImagePixelFormat::RGB24bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 3;
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-
-				*pPixelPtr = nRed; pPixelPtr++;
-				*pPixelPtr = nGreen; pPixelPtr++;
-				*pPixelPtr = nBlue; pPixelPtr++;				
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
-		}
-
-		break;
-	}
-
-	case eImagePixelFormat::RGBA32bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 4;
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				nPixelAddress++; // alpha
-
-				*pPixelPtr = nRed; pPixelPtr++;
-				*pPixelPtr = nGreen; pPixelPtr++;
-				*pPixelPtr = nBlue; pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
-		}
-
-		break;
-	}
-
+	case eImagePixelFormat::GreyScale8bit: pConverter = &convertRow_GreyScale8bitToRGB24bit; nSourceBytesPerPixel = 1; break;
+	case eImagePixelFormat::RGB16bit: pConverter = &convertRow_RGB16bitToRGB24bit; nSourceBytesPerPixel = 2; break;
+	case eImagePixelFormat::RGB24bit: pConverter = &convertRow_RGB24bitToRGB24bit; nSourceBytesPerPixel = 3; break;
+	case eImagePixelFormat::RGBA32bit: pConverter = &convertRow_RGBA32bitToRGB24bit; nSourceBytesPerPixel = 4; break;
 	default:
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
-
 	}
 
+	size_t nSourceLineLength = (size_t)m_nPixelCountX * nSourceBytesPerPixel;
+	size_t nSourceOffset = (size_t)nStartY * nSourceLineLength + (size_t)nStartX * nSourceBytesPerPixel;
+	if (!imageRowsAreInBuffer(nSourceOffset, nSourceLineLength, nCountX, nCountY, nSourceBytesPerPixel, m_PixelData->size()))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
+
+	convertImageRows(m_PixelData->data() + nSourceOffset, nSourceLineLength, pTarget, nYLineOffset, nCountX, nCountY, pConverter);
 
 }
 
@@ -2194,131 +2231,24 @@ void CImageData::writeToRawMemoryEx_RGBA32bit(uint32_t nStartX, uint32_t nStartY
 	if (((uint64_t)nStartY + nCountY) > m_nPixelCountY)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
 
-	uint8_t* pLinePtr = pTarget;
+	ImageDataRowConverter pConverter = nullptr;
+	size_t nSourceBytesPerPixel = 0;
 
 	switch (m_PixelFormat) {
-	case eImagePixelFormat::GreyScale8bit: {
-		size_t nLineAddress = (size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				uint8_t nGrayValue = m_PixelData->at(nPixelAddress);
-				nPixelAddress++;
-				*pPixelPtr = nGrayValue;  pPixelPtr++;
-				*pPixelPtr = nGrayValue;  pPixelPtr++;
-				*pPixelPtr = nGrayValue;  pPixelPtr++;
-				*pPixelPtr = 255;  pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += m_nPixelCountX;
-		}
-
-
-		break;
-	}
-
-
-	case eImagePixelFormat::RGB16bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 2;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nLow = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nHigh = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint16_t nColor = nLow | (nHigh << 8);
-
-				uint32_t nRed = (nColor & 0x1f) << 3;
-				uint32_t nGreen = ((nColor >> 5) & 0x3f) << 2;
-				uint32_t nBlue = ((nColor >> 11) & 0x1f) << 3;
-
-				*pPixelPtr = nRed; pPixelPtr++;
-				*pPixelPtr = nGreen; pPixelPtr++;
-				*pPixelPtr = nBlue; pPixelPtr++;
-				*pPixelPtr = 255;  pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 2;
-		}
-
-		break;
-	}
-
-	case eImagePixelFormat::RGB24bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 3;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-
-				*pPixelPtr = nRed; pPixelPtr++;
-				*pPixelPtr = nGreen; pPixelPtr++;
-				*pPixelPtr = nBlue; pPixelPtr++;
-				*pPixelPtr = 255;  pPixelPtr++;
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
-		}
-
-		break;
-	}
-
-	case eImagePixelFormat::RGBA32bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 4;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				nPixelAddress++; // alpha
-
-				*pPixelPtr = nRed; pPixelPtr++;
-				*pPixelPtr = nGreen; pPixelPtr++;
-				*pPixelPtr = nBlue; pPixelPtr++;
-				*pPixelPtr = 255;  pPixelPtr++;
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 4;
-		}
-
-		break;
-	}
-
-
+	case eImagePixelFormat::GreyScale8bit: pConverter = &convertRow_GreyScale8bitToRGBA32bit; nSourceBytesPerPixel = 1; break;
+	case eImagePixelFormat::RGB16bit: pConverter = &convertRow_RGB16bitToRGBA32bit; nSourceBytesPerPixel = 2; break;
+	case eImagePixelFormat::RGB24bit: pConverter = &convertRow_RGB24bitToRGBA32bit; nSourceBytesPerPixel = 3; break;
+	case eImagePixelFormat::RGBA32bit: pConverter = &convertRow_RGBA32bitToRGBA32bit; nSourceBytesPerPixel = 4; break;
 	default:
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
-
 	}
 
+	size_t nSourceLineLength = (size_t)m_nPixelCountX * nSourceBytesPerPixel;
+	size_t nSourceOffset = (size_t)nStartY * nSourceLineLength + (size_t)nStartX * nSourceBytesPerPixel;
+	if (!imageRowsAreInBuffer(nSourceOffset, nSourceLineLength, nCountX, nCountY, nSourceBytesPerPixel, m_PixelData->size()))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
+
+	convertImageRows(m_PixelData->data() + nSourceOffset, nSourceLineLength, pTarget, nYLineOffset, nCountX, nCountY, pConverter);
 
 }
 
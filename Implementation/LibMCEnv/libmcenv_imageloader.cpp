@@ -34,6 +34,9 @@ Abstract: This is a stub class definition of CImageLoader
 #include "libmcenv_imageloader.hpp"
 #include "libmcenv_interfaceexception.hpp"
 #include "libmcenv_imagedata.hpp"
+#include "libmcenv_jpegimagedata.hpp"
+
+#include "common_jpeg.hpp"
 
 using namespace LibMCEnv::Impl;
 
@@ -77,3 +80,28 @@ IImageData * CImageLoader::CreateImageFromRawYUY2Data(const LibMCEnv_uint64 nYUY
     return CImageData::createFromYUY2(pYUY2DataBuffer, nYUY2DataBufferSize, nPixelSizeX, nPixelSizeY, dDPIValueX, dDPIValueY, ePixelFormat);
 }
 
+IJPEGImageData * CImageLoader::CreateJPEGImageFromRawYUY2Data(const LibMCEnv_uint64 nYUY2DataBufferSize, const LibMCEnv_uint8 * pYUY2DataBuffer, const LibMCEnv_uint32 nPixelSizeX, const LibMCEnv_uint32 nPixelSizeY)
+{
+    if (pYUY2DataBuffer == nullptr)
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+    if ((nPixelSizeX == 0) || (nPixelSizeY == 0))
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELCOUNT);
+
+    if ((nPixelSizeX % 2) != 0)
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_YUY2PIXELWIDTHMUSTBEEVEN);
+
+    if (nYUY2DataBufferSize != ((uint64_t)nPixelSizeX * (uint64_t)nPixelSizeY * 2))
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYUY2BUFFERSIZE);
+
+    std::unique_ptr<CJPEGImageData> pResult(new CJPEGImageData(nPixelSizeX, nPixelSizeY));
+    auto& jpegStream = pResult->getJPEGStreamBuffer();
+
+    AMCCommon::CJPEGImageEncoder encoder(nPixelSizeX, nPixelSizeY, AMCCommon::eJPEGEncoderInputFormat::ifYUY2, pYUY2DataBuffer, nYUY2DataBufferSize, jpegStream, false);
+
+    if (jpegStream.empty())
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COULDNOTSTOREJPEGIMAGE);
+
+    return pResult.release();
+}
+
@@ -37,6 +37,7 @@ Abstract: This is a stub class definition of CJournalHandler_Current
 
 // Include custom headers here.
 #include "libmcenv_datetime.hpp"
+#include "common_utils.hpp"
 
 
 using namespace LibMCEnv::Impl;
@@ -63,6 +64,45 @@ IJournalVariable* CJournalHandler_Current::RetrieveJournalVariable(const std::st
 	return new CJournalVariable_Current(m_pStateJournal, sVariableName);
 }
 
+void CJournalHandler_Current::ComputeBucketStatistics(const std::string& sVariableNames, const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nIntervalInMicroSeconds, const LibMCEnv_uint32 nBucketCount, LibMCEnv_uint64 nBucketsBufferSize, LibMCEnv_uint64* pBucketsNeededCount, LibMCEnv::sJournalBucketStatistics* pBucketsBuffer)
+{
+	if ((nIntervalInMicroSeconds == 0) || (nBucketCount == 0))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+	std::vector<std::string> variableNames;
+	AMCCommon::CUtils::splitString(sVariableNames, ";", variableNames);
+	if (variableNames.empty())
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_EMPTYJOURNALVARIABLENAME);
+
+	for (auto& sVariableName : variableNames) {
+		sVariableName = AMCCommon::CUtils::trimString(sVariableName);
+		if (sVariableName.empty())
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_EMPTYJOURNALVARIABLENAME);
+	}
+
+	uint64_t nTotalBucketCount = (uint64_t)variableNames.size() * nBucketCount;
+	if (pBucketsNeededCount != nullptr)
+		*pBucketsNeededCount = nTotalBucketCount;
+
+	// As for a single variable, the journal is only queried once the buffer is provided.
+	if (pBucketsBuffer != nullptr) {
+		if (nBucketsBufferSize < nTotalBucketCount)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
+
+		std::vector<AMC::PStateJournalBucketAggregator> aggregators;
+		m_pStateJournal->computeBucketStatistics(variableNames, nStartTimeInMicroSeconds, nIntervalInMicroSeconds, nBucketCount, aggregators);
+
+		LibMCEnv::sJournalBucketStatistics* pBucket = pBucketsBuffer;
+		for (auto pAggregator : aggregators) {
+			for (uint32_t nBucketIndex = 0; nBucketIndex < nBucketCount; nBucketIndex++) {
+				pBucket->m_StartTimeInMicroSeconds = nStartTimeInMicroSeconds + nBucketIndex * nIntervalInMicroSeconds;
+				pAggregator->getBucketStatistics(nBucketIndex, pBucket->m_SampleCount, pBucket->m_MinValue, pBucket->m_MaxValue, pBucket->m_MeanValue, pBucket->m_LastValue);
+				pBucket++;
+			}
+		}
+	}
+}
+
 
 IDateTime* CJournalHandler_Current::GetStartTime()
 {
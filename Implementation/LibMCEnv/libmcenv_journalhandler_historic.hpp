@@ -70,6 +70,8 @@ public:
 
     IJournalVariable* RetrieveJournalVariable(const std::string& sVariableName) override;
 
+    void ComputeBucketStatistics(const std::string& sVariableNames, const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nIntervalInMicroSeconds, const LibMCEnv_uint32 nBucketCount, LibMCEnv_uint64 nBucketsBufferSize, LibMCEnv_uint64* pBucketsNeededCount, LibMCEnv::sJournalBucketStatistics* pBucketsBuffer) override;
+
     IDateTime* GetStartTime() override;
 
     IDateTime* GetEndTime() override;
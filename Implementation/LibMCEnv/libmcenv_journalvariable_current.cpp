@@ -76,5 +76,32 @@ LibMCEnv_int64 CJournalVariable_Current::ComputeIntegerSample(const LibMCEnv_uin
     return (int64_t) round (m_pStateJournal->computeSample(m_sVariableName, nTimeInMicroSeconds));
 }
 
+void CJournalVariable_Current::ComputeBucketStatistics(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nIntervalInMicroSeconds, const LibMCEnv_uint32 nBucketCount, LibMCEnv_uint64 nBucketsBufferSize, LibMCEnv_uint64* pBucketsNeededCount, LibMCEnv::sJournalBucketStatistics* pBucketsBuffer)
+{
+    if ((nIntervalInMicroSeconds == 0) || (nBucketCount == 0))
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+    if (pBucketsNeededCount != nullptr)
+        *pBucketsNeededCount = nBucketCount;
+
+    // The bucket count is known upfront, so the journal only needs to be queried once the buffer is provided.
+    if (pBucketsBuffer != nullptr) {
+        if (nBucketsBufferSize < nBucketCount)
+            throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
 
+        std::vector<AMC::PStateJournalBucketAggregator> aggregators;
+        m_pStateJournal->computeBucketStatistics({ m_sVariableName }, nStartTimeInMicroSeconds, nIntervalInMicroSeconds, nBucketCount, aggregators);
+        auto pAggregator = aggregators.at(0);
 
+        for (uint32_t nBucketIndex = 0; nBucketIndex < nBucketCount; nBucketIndex++) {
+            auto& bucket = pBucketsBuffer[nBucketIndex];
+            bucket.m_StartTimeInMicroSeconds = nStartTimeInMicroSeconds + nBucketIndex * nIntervalInMicroSeconds;
+            pAggregator->getBucketStatistics(nBucketIndex, bucket.m_SampleCount, bucket.m_MinValue, bucket.m_MaxValue, bucket.m_MeanValue, bucket.m_LastValue);
+        }
+    }
+}
+
+void CJournalVariable_Current::ReceiveRawTimeStream(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, LibMCEnv_uint64 nTimeStreamEntriesBufferSize, LibMCEnv_uint64* pTimeStreamEntriesNeededCount, LibMCEnv::sTimeStreamEntry* pTimeStreamEntriesBuffer)
+{
+    throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_NOTIMPLEMENTED);
+}
@@ -44,7 +44,7 @@ using namespace LibMCEnv::Impl;
  Class definition of CJournalVariable 
 **************************************************************************************************************************/
 CJournalVariable_Historic::CJournalVariable_Historic(AMC::PStateJournalReader pJournalReader, const std::string& sVariableName)
-    : m_pJournalReader (pJournalReader), m_sVariableName (sVariableName)
+    : m_pJournalReader (pJournalReader), m_sVariableName (sVariableName), m_nRawTimeStreamStartTime (0), m_nRawTimeStreamEndTime (0)
 {
     if (pJournalReader.get() == nullptr)
         throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
@@ -74,5 +74,61 @@ LibMCEnv_int64 CJournalVariable_Historic::ComputeIntegerSample(const LibMCEnv_ui
     return m_pJournalReader->computeIntegerSample(m_sVariableName, nTimeInMicroSeconds);
 }
 
+void CJournalVariable_Historic::ComputeBucketStatistics(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nIntervalInMicroSeconds, const LibMCEnv_uint32 nBucketCount, LibMCEnv_uint64 nBucketsBufferSize, LibMCEnv_uint64* pBucketsNeededCount, LibMCEnv::sJournalBucketStatistics* pBucketsBuffer)
+{
+    if ((nIntervalInMicroSeconds == 0) || (nBucketCount == 0))
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+    if (pBucketsNeededCount != nullptr)
+        *pBucketsNeededCount = nBucketCount;
+
+    // The bucket count is known upfront, so the journal only needs to be queried once the buffer is provided.
+    if (pBucketsBuffer != nullptr) {
+        if (nBucketsBufferSize < nBucketCount)
+            throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
+
+        std::vector<AMC::PStateJournalBucketAggregator> aggregators;
+        m_pJournalReader->computeBucketStatistics({ m_sVariableName }, nStartTimeInMicroSeconds, nIntervalInMicroSeconds, nBucketCount, aggregators);
+        auto pAggregator = aggregators.at(0);
 
+        for (uint32_t nBucketIndex = 0; nBucketIndex < nBucketCount; nBucketIndex++) {
+            auto& bucket = pBucketsBuffer[nBucketIndex];
+            bucket.m_StartTimeInMicroSeconds = nStartTimeInMicroSeconds + nBucketIndex * nIntervalInMicroSeconds;
+            pAggregator->getBucketStatistics(nBucketIndex, bucket.m_SampleCount, bucket.m_MinValue, bucket.m_MaxValue, bucket.m_MeanValue, bucket.m_LastValue);
+        }
+    }
+}
 
+void CJournalVariable_Historic::ReceiveRawTimeStream(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, LibMCEnv_uint64 nTimeStreamEntriesBufferSize, LibMCEnv_uint64* pTimeStreamEntriesNeededCount, LibMCEnv::sTimeStreamEntry* pTimeStreamEntriesBuffer)
+{
+    if (nEndTimeInMicroSeconds < nStartTimeInMicroSeconds)
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+    bool bIsCached = (!m_RawTimeStream.empty()) && (m_nRawTimeStreamStartTime == nStartTimeInMicroSeconds) && (m_nRawTimeStreamEndTime == nEndTimeInMicroSeconds);
+    if (!bIsCached) {
+        std::vector<std::vector<AMC::sJournalTimeStreamDoubleEntry>> timeStreams;
+        m_pJournalReader->readDoubleTimeStreams({ m_sVariableName }, nStartTimeInMicroSeconds, nEndTimeInMicroSeconds, timeStreams);
+
+        m_RawTimeStream.swap(timeStreams.at(0));
+        m_nRawTimeStreamStartTime = nStartTimeInMicroSeconds;
+        m_nRawTimeStreamEndTime = nEndTimeInMicroSeconds;
+    }
+
+    if (pTimeStreamEntriesNeededCount != nullptr)
+        *pTimeStreamEntriesNeededCount = m_RawTimeStream.size();
+
+    if (pTimeStreamEntriesBuffer != nullptr) {
+        if (nTimeStreamEntriesBufferSize < m_RawTimeStream.size())
+            throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
+
+        LibMCEnv::sTimeStreamEntry* pTarget = pTimeStreamEntriesBuffer;
+        for (auto& entry : m_RawTimeStream) {
+            pTarget->m_TimestampInMicroSeconds = entry.m_nTimeStampInMicroSeconds;
+            pTarget->m_Value = entry.m_dValue;
+            pTarget++;
+        }
+
+        m_RawTimeStream.clear();
+        m_RawTimeStream.shrink_to_fit();
+    }
+}
@@ -62,6 +62,11 @@ private:
     std::string m_sVariableName;
     AMC::PStateJournalReader m_pJournalReader;
 
+    // Result of the last raw time stream query, so that the buffer size query and the data query only read the journal once.
+    uint64_t m_nRawTimeStreamStartTime;
+    uint64_t m_nRawTimeStreamEndTime;
+    std::vector<AMC::sJournalTimeStreamDoubleEntry> m_RawTimeStream;
+
 public:
     CJournalVariable_Historic(AMC::PStateJournalReader pJournalReader, const std::string& sVariableName);
 
@@ -73,6 +78,10 @@ public:
 
     LibMCEnv_int64 ComputeIntegerSample(const LibMCEnv_uint64 nTimeInMicroSeconds) override;
 
+    void ComputeBucketStatistics(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nIntervalInMicroSeconds, const LibMCEnv_uint32 nBucketCount, LibMCEnv_uint64 nBucketsBufferSize, LibMCEnv_uint64* pBucketsNeededCount, LibMCEnv::sJournalBucketStatistics* pBucketsBuffer) override;
+
+    void ReceiveRawTimeStream(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, LibMCEnv_uint64 nTimeStreamEntriesBufferSize, LibMCEnv_uint64* pTimeStreamEntriesNeededCount, LibMCEnv::sTimeStreamEntry* pTimeStreamEntriesBuffer) override;
+
 };
 
 } // namespace Impl
@@ -31,6 +31,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "libmcenv_signaltrigger.hpp"
 #include "libmcenv_interfaceexception.hpp"
+#include "amc_statemachinescheduler.hpp"
 #include "amc_statesignalhandler.hpp"
 
 // Include custom headers here.
@@ -188,9 +189,15 @@ bool CSignalTrigger::WaitForHandling(const LibMCEnv_uint32 nTimeOutInMillisecond
 	if (m_bIsPreparing)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_SIGNALHASNOTBEENTRIGGERED);
 
+	// In worker pool mode, other instances continue on another worker while this state waits
+	AMC::CStateMachineSchedulerBlockingSection blockingSection;
+
 	bool bIsTimeOut = false;
 	while (!bIsTimeOut) {	
 
+		// Read the counter before the phase, so that a change in between is not missed
+		uint64_t nSignalChangeCounter = m_pSignalHandler->getSignalChangeCounter();
+
 		auto signalPhase = m_pSignalHandler->getSignalPhase(m_sSignalUUID);
 		bool bHasBeenHandled = (signalPhase == AMC::eAMCSignalPhase::Handled) || (signalPhase == AMC::eAMCSignalPhase::Failed) || (signalPhase == AMC::eAMCSignalPhase::Cleared) || (signalPhase == AMC::eAMCSignalPhase::Retracted) || (signalPhase == AMC::eAMCSignalPhase::TimedOut);
 		
@@ -203,10 +210,15 @@ bool CSignalTrigger::WaitForHandling(const LibMCEnv_uint32 nTimeOutInMillisecond
 			return true;
 		} 
 
-		bIsTimeOut = chrono.getUTCTimeStampInMicrosecondsSince1970() > nTimeOutTimeStamp;
+		uint64_t nCurrentTimeStamp = chrono.getUTCTimeStampInMicrosecondsSince1970();
+		bIsTimeOut = nCurrentTimeStamp > nTimeOutTimeStamp;
+
+		if (!bIsTimeOut) {
+			uint64_t nRemainingMS = (nTimeOutTimeStamp - nCurrentTimeStamp) / 1000 + 1;
+			if (nRemainingMS > AMC_SIGNAL_MAXWAITFORCHANGE_MS)
+				nRemainingMS = AMC_SIGNAL_MAXWAITFORCHANGE_MS;
 
-		if (!bIsTimeOut) {			
-			chrono.sleepMilliseconds(AMC_SIGNAL_DEFAULT_WAITFOR_SLEEP_MS);
+			m_pSignalHandler->waitForSignalChange(nSignalChangeCounter, (uint32_t) nRemainingMS);
 		}
 	} 
 
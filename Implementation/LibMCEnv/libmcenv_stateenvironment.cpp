@@ -60,6 +60,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "libmcenv_imageloader.hpp"
 #include "libmcenv_jsonobject.hpp"
 
+#include "amc_statemachinescheduler.hpp"
 #include "amc_logger.hpp"
 #include "amc_driverhandler.hpp"
 #include "amc_parameterhandler.hpp"
@@ -120,13 +121,21 @@ ISignalTrigger* CStateEnvironment::PrepareSignal(const std::string& sMachineInst
 
 bool CStateEnvironment::WaitForSignal(const std::string& sSignalName, const LibMCEnv_uint32 nTimeOut, ISignalHandler*& pHandlerInstance)
 {
+	auto pSignalHandler = m_pSystemState->stateSignalHandler();
+
+	// In worker pool mode, other instances continue on another worker while this state waits
+	AMC::CStateMachineSchedulerBlockingSection blockingSection;
+
 	auto startTime = std::chrono::high_resolution_clock::now();
 	auto endTime = startTime + std::chrono::milliseconds(nTimeOut);
 
 	bool bIsTimeOut = false;
 	while (!bIsTimeOut) {
 
-		std::string sUnhandledSignalUUID = m_pSystemState->stateSignalHandler()->peekSignalMessageFromQueue(m_sInstanceName, sSignalName);
+		// Read the counter before peeking, so that a signal queued in between is not missed
+		uint64_t nSignalChangeCounter = pSignalHandler->getSignalChangeCounter();
+
+		std::string sUnhandledSignalUUID = pSignalHandler->peekSignalMessageFromQueue(m_sInstanceName, sSignalName);
 
 		if (!sUnhandledSignalUUID.empty ()) {
 			pHandlerInstance = new CSignalHandler(m_pSystemState->getStateSignalHandlerInstance(), sUnhandledSignalUUID, m_pSystemState->getGlobalChronoInstance());
@@ -134,14 +143,17 @@ bool CStateEnvironment::WaitForSignal(const std::string& sSignalName, const LibM
 			return true;
 		}
 
-		bIsTimeOut = std::chrono::high_resolution_clock::now() >= endTime;
+		auto currentTime = std::chrono::high_resolution_clock::now();
+		bIsTimeOut = currentTime >= endTime;
 
 		if (!bIsTimeOut) {
 			if (CheckForTermination())
 				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_TERMINATED);
 
-			AMCCommon::CChrono chrono;
-			chrono.sleepMilliseconds(AMC_SIGNAL_DEFAULT_WAITFOR_SLEEP_MS);
+			// Queued signals wake the wait, so it only needs to end at the timeout
+			uint64_t nRemainingMS = (uint64_t) std::chrono::duration_cast<std::chrono::milliseconds>(endTime - currentTime).count() + 1;
+
+			pSignalHandler->waitForSignalChange(nSignalChangeCounter, (uint32_t) nRemainingMS);
 		}
 	}
 
@@ -287,6 +299,8 @@ void CStateEnvironment::LogInfo(const std::string& sLogString)
 
 void CStateEnvironment::Sleep(const LibMCEnv_uint32 nDelay)
 {
+	AMC::CStateMachineSchedulerBlockingSection blockingSection;
+
 	AMCCommon::CChrono chrono;
 	chrono.sleepMilliseconds(nDelay);
 }
@@ -207,7 +207,12 @@ bool CTCPIPSocketConnection::waitForData(uint32_t timeOutInMS)
     FD_ZERO(&fds);
     FD_SET(m_Socket, &fds);
 
+#ifdef _WIN32
     int selectionResult = select (0, &fds, 0, 0, &timeout);
+#else
+    // POSIX select only checks descriptors below nfds.
+    int selectionResult = select ((int)m_Socket + 1, &fds, 0, 0, &timeout);
+#endif
 
     return selectionResult > 0;
 
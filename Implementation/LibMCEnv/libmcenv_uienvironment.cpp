@@ -635,7 +635,13 @@ IDiscreteFieldData2D* CUIEnvironment::CreateDiscreteField2DFromImage(IImageData*
 bool CUIEnvironment::CheckPermission(const std::string& sPermissionIdentifier)
 {
     auto pUserInformation = m_pAPIAuth->getUserInformation();
-    return m_pUISystemState->getAccessControl()->checkPermissionInRole(pUserInformation->getRoleIdentifier(), sPermissionIdentifier);
+    auto pAccessControl = m_pUISystemState->getAccessControl();
+
+    auto pRole = pUserInformation->getRole();
+    if (pRole.get() != nullptr)
+        return pAccessControl->checkPermissionInRole(pRole, sPermissionIdentifier);
+
+    return pAccessControl->checkPermissionInRole(pUserInformation->getRoleIdentifier(), sPermissionIdentifier);
 }
 
 std::string CUIEnvironment::GetCurrentUserLogin()
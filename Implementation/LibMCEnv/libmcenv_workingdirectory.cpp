@@ -39,7 +39,6 @@ Abstract: This is a stub class definition of CWorkingDirectory
 
 // Include custom headers here.
 #include "common_utils.hpp"
-#include "common_exportstream_native.hpp"
 
 using namespace LibMCEnv::Impl;
 
@@ -131,13 +130,7 @@ IWorkingFile * CWorkingDirectory::StoreCustomData(const std::string & sFileName,
     if (pProcessDirectoryInstance.get() == nullptr)
         throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_WORKINGDIRECTORYCEASEDTOEXIST);
 
-    std::string sAbsoluteFileName = pProcessDirectoryInstance->getAbsoluteFileName (sFileName);
-    pProcessDirectoryInstance->addNewMonitoredFile(sFileName);
-
-    auto pStream = std::make_unique<AMCCommon::CExportStream_Native>(sAbsoluteFileName);
-    if (nDataBufferBufferSize > 0)
-        pStream->writeBuffer(pDataBufferBuffer, nDataBufferBufferSize);
-    pStream.reset();
+    pProcessDirectoryInstance->writeFileFromMemory(sFileName, pDataBufferBuffer, nDataBufferBufferSize, false);
 
     return new CWorkingFile (sFileName, m_pProcessDirectory);
 }
@@ -149,13 +142,7 @@ IWorkingFile* CWorkingDirectory::StoreCustomString(const std::string& sFileName,
     if (pProcessDirectoryInstance.get() == nullptr)
         throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_WORKINGDIRECTORYCEASEDTOEXIST);
 
-    std::string sAbsoluteFileName = pProcessDirectoryInstance->getAbsoluteFileName(sFileName);
-    pProcessDirectoryInstance->addNewMonitoredFile(sFileName);
-
-    auto pStream = std::make_unique<AMCCommon::CExportStream_Native>(sAbsoluteFileName);
-    if (sDataString.length () > 0)
-        pStream->writeBuffer(sDataString.c_str (), sDataString.length ());
-    pStream.reset();
+    pProcessDirectoryInstance->writeFileFromMemory(sFileName, (const uint8_t*)sDataString.c_str(), sDataString.length(), false);
 
     return new CWorkingFile(sFileName, m_pProcessDirectory);
 }
@@ -167,16 +154,10 @@ IWorkingFile * CWorkingDirectory::StoreDriverData(const std::string & sFileName,
     if (pProcessDirectoryInstance.get() == nullptr)
         throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_WORKINGDIRECTORYCEASEDTOEXIST);
 
-    std::string sAbsoluteFileName = pProcessDirectoryInstance->getAbsoluteFileName(sFileName);
-    pProcessDirectoryInstance->addNewMonitoredFile(sFileName);
-
     std::vector<uint8_t> Buffer;
     m_pDriverResourcePackage->readEntry(sIdentifier, Buffer);
 
-    auto pStream = std::make_unique<AMCCommon::CExportStream_Native>(sAbsoluteFileName);
-    if (Buffer.size () > 0)
-        pStream->writeBuffer(Buffer.data(), Buffer.size ());
-    pStream.reset();
+    pProcessDirectoryInstance->writeFileFromMemory(sFileName, Buffer.data(), Buffer.size(), false);
 
     return new CWorkingFile(sFileName, m_pProcessDirectory);
 
@@ -189,16 +170,10 @@ IWorkingFile* CWorkingDirectory::StoreMachineResourceData(const std::string& sFi
     if (pProcessDirectoryInstance.get() == nullptr)
         throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_WORKINGDIRECTORYCEASEDTOEXIST);
 
-    std::string sAbsoluteFileName = pProcessDirectoryInstance->getAbsoluteFileName(sFileName);
-    pProcessDirectoryInstance->addNewMonitoredFile(sFileName);
-
     std::vector<uint8_t> Buffer;
     m_pMachineResourcePackage->readEntry(sIdentifier, Buffer);
 
-    auto pStream = std::make_unique<AMCCommon::CExportStream_Native>(sAbsoluteFileName);
-    if (Buffer.size() > 0)
-        pStream->writeBuffer(Buffer.data(), Buffer.size());
-    pStream.reset();
+    pProcessDirectoryInstance->writeFileFromMemory(sFileName, Buffer.data(), Buffer.size(), false);
 
     return new CWorkingFile(sFileName, m_pProcessDirectory);
 }
@@ -375,4 +350,20 @@ IWorkingFileWriter* CWorkingDirectory::AddBufferedWriterTempFile(const std::stri
     return AddBufferedWriter(sFileName, nBufferSizeInkB);
 }
 
+IWorkingFileWriter* CWorkingDirectory::AddAsyncBufferedWriter(const std::string& sFileName, const LibMCEnv_uint32 nBufferSizeInkB, const bool bSyncOnFinish)
+{
+    auto pProcessDirectoryInstance = m_pProcessDirectory.lock();
+    if (pProcessDirectoryInstance.get() == nullptr)
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_WORKINGDIRECTORYCEASEDTOEXIST);
+
+    auto pInstance = pProcessDirectoryInstance->addNewAsyncFileWriter(sFileName, nBufferSizeInkB, bSyncOnFinish);
+    return new CWorkingFileWriter(pInstance, m_pProcessDirectory);
+}
+
+IWorkingFileWriter* CWorkingDirectory::AddAsyncBufferedWriterTempFile(const std::string& sExtension, const LibMCEnv_uint32 nBufferSizeInkB, const bool bSyncOnFinish)
+{
+    std::string sFileName = generateFileNameForExtension(sExtension);
+    return AddAsyncBufferedWriter(sFileName, nBufferSizeInkB, bSyncOnFinish);
+}
+
 
@@ -123,6 +123,10 @@ public:
 
     IWorkingFileWriter* AddBufferedWriterTempFile(const std::string& sExtension, const LibMCEnv_uint32 nBufferSizeInkB) override;
 
+    IWorkingFileWriter* AddAsyncBufferedWriter(const std::string& sFileName, const LibMCEnv_uint32 nBufferSizeInkB, const bool bSyncOnFinish) override;
+
+    IWorkingFileWriter* AddAsyncBufferedWriterTempFile(const std::string& sExtension, const LibMCEnv_uint32 nBufferSizeInkB, const bool bSyncOnFinish) override;
+
 
 };
 
@@ -46,9 +46,11 @@ using namespace LibMCEnv::Impl;
  Class definition of CXMLDocumentAttribute 
 **************************************************************************************************************************/
 
-CXMLDocumentAttribute::CXMLDocumentAttribute(AMC::PXMLDocumentAttributeInstance pAttributeInstance)
-	: m_pAttributeInstance (pAttributeInstance)
+CXMLDocumentAttribute::CXMLDocumentAttribute(AMC::PXMLDocumentInstance pXMLDocument, AMC::PXMLDocumentAttributeInstance pAttributeInstance)
+	: m_pXMLDocument (pXMLDocument), m_pAttributeInstance (pAttributeInstance)
 {
+	if (pXMLDocument.get() == nullptr)
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 	if (pAttributeInstance.get() == nullptr)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 }
@@ -46,6 +46,7 @@ Abstract: This is the class declaration of CXMLDocumentAttribute
 
 // Include custom headers here.
 #include "amc_xmldocumentattribute.hpp"
+#include "amc_xmldocument.hpp"
 
 namespace LibMCEnv {
 namespace Impl {
@@ -58,11 +59,12 @@ namespace Impl {
 class CXMLDocumentAttribute : public virtual IXMLDocumentAttribute, public virtual CBase {
 private:
 
+	AMC::PXMLDocumentInstance m_pXMLDocument;
 	AMC::PXMLDocumentAttributeInstance m_pAttributeInstance;
 
 public:
 
-	CXMLDocumentAttribute(AMC::PXMLDocumentAttributeInstance pAttributeInstance);
+	CXMLDocumentAttribute(AMC::PXMLDocumentInstance pXMLDocument, AMC::PXMLDocumentAttributeInstance pAttributeInstance);
 
 	virtual ~CXMLDocumentAttribute();
 
@@ -90,7 +90,7 @@ LibMCEnv_uint64 CXMLDocumentNode::GetAttributeCount()
 
 IXMLDocumentAttribute * CXMLDocumentNode::GetAttribute(const LibMCEnv_uint64 nIndex)
 {
-    return new CXMLDocumentAttribute(m_pXMLDocumentNode->GetAttribute (nIndex));
+    return new CXMLDocumentAttribute(m_pXMLDocument, m_pXMLDocumentNode->GetAttribute (nIndex));
 }
 
 
@@ -105,7 +105,7 @@ IXMLDocumentAttribute* CXMLDocumentNode::FindAttribute(const std::string& sNameS
     auto pNameSpace = m_pXMLDocument->FindNamespace(sNameSpace, true);
     auto pAttribute = m_pXMLDocumentNode->FindAttribute(pNameSpace.get(), sName, bMustExist);
     if (pAttribute.get() != nullptr)
-        return new CXMLDocumentAttribute (pAttribute);
+        return new CXMLDocumentAttribute (m_pXMLDocument, pAttribute);
 
     return nullptr;
 }
@@ -262,28 +262,19 @@ IXMLDocumentNodes* CXMLDocumentNode::GetChildren()
 
 LibMCEnv_uint64 CXMLDocumentNode::CountChildrenByName(const std::string& sNameSpace, const std::string& sName)
 {
-    uint64_t nCount = 0;
-    auto children = m_pXMLDocumentNode->getChildren();
-
-    for (auto child : children) {
-        if (child->compareName(sNameSpace, sName))
-            nCount++;
-    }
-
-    return nCount;
-
+    auto pNameSpace = m_pXMLDocument->FindNamespace(sNameSpace, true);
+    return m_pXMLDocumentNode->CountChildrenByName(pNameSpace.get(), sName);
 }
 
 IXMLDocumentNodes* CXMLDocumentNode::GetChildrenByName(const std::string& sNameSpace, const std::string& sName)
 {
     auto resultNodes = std::make_unique<CXMLDocumentNodes>(m_pXMLDocument);
 
-    auto children = m_pXMLDocumentNode->getChildren();
+    auto pNameSpace = m_pXMLDocument->FindNamespace(sNameSpace, true);
+    auto children = m_pXMLDocumentNode->getChildrenByName(pNameSpace.get(), sName);
 
-    for (auto child : children) {
-        if (child->compareName(sNameSpace, sName))
-            resultNodes->addNode(child);
-    }
+    for (auto child : children)
+        resultNodes->addNode(child);
 
     return resultNodes.release();
 }
@@ -36,6 +36,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "amc_server.hpp"
 #include "common_utils.hpp"
+#include "common_startuptiming.hpp"
 #include <iostream>
 
 using namespace AMC;
@@ -223,14 +224,18 @@ void CServer::executeBlocking(const std::string& sConfigurationFileName)
 		uint32_t nMinorFrameworkVersion = 0;
 		uint32_t nMicroFrameworkVersion = 0;
 
+		AMCCommon::CStartupTiming startupTiming;
+
 		log("Framework version: " + m_sVersionString);
 		log("Git hash: " + m_sGitHash);
 		log("Loading server configuration...");
+		startupTiming.beginPhase("server configuration");
 
 		std::string sConfigurationXML = m_pServerIO->readConfigurationString(sConfigurationFileName);
 		m_pServerConfiguration = std::make_shared<CServerConfiguration>(sConfigurationXML, m_pServerIO);
 
 		log("Loading data model...");
+		startupTiming.beginPhase("data model");
 
 		m_pDataWrapper = LibMCData::CWrapper::loadLibrary(m_pServerConfiguration->getLibraryPath("datamodel"));
 		m_pDataWrapper->GetVersion(nMajorDataVersion, nMinorDataVersion, nMicroDataVersion);
@@ -241,9 +246,11 @@ void CServer::executeBlocking(const std::string& sConfigurationFileName)
 		m_pDataModel->SetBaseTempDirectory(m_pServerConfiguration->getBaseTempDirectory ());
 
 		log("Initialising Database...");
+		startupTiming.beginPhase("database");
 		m_pDataModel->InitialiseDatabase(m_pServerConfiguration->getDataDirectory(), m_pServerConfiguration->getDataBaseType(), m_pServerConfiguration->getConnectionString());
 
 		log("Loading framework...");
+		startupTiming.beginPhase("framework");
 		m_pWrapper = LibMC::CWrapper::loadLibrary(m_pServerConfiguration->getLibraryPath("core"));
 		m_pWrapper->GetVersion(nMajorFrameworkVersion, nMinorFrameworkVersion, nMicroFrameworkVersion);
 		log("Found framework interface " + std::to_string(nMajorFrameworkVersion) + "." + std::to_string(nMinorFrameworkVersion) + "." + std::to_string(nMicroFrameworkVersion));
@@ -265,19 +272,27 @@ void CServer::executeBlocking(const std::string& sConfigurationFileName)
 		std::string sPackageConfigurationXML = m_pServerIO->readConfigurationString(m_pServerConfiguration->getPackageConfig());
 
 		m_pContext->Log("Parsing package configuration", LibMC::eLogSubSystem::System, LibMC::eLogLevel::Message);
+		startupTiming.beginPhase("package configuration");
 		m_pContext->ParseConfiguration(sPackageConfigurationXML);
 
 		m_pContext->Log("Loading HTTP Client from " + m_pServerConfiguration->getPackageCoreClient() + "...", LibMC::eLogSubSystem::System, LibMC::eLogLevel::Message);
+		startupTiming.beginPhase("client package");
 		m_pContext->LoadClientPackage(m_pServerConfiguration->getPackageCoreClient());
 
 		std::string sAPIDocsPackage = m_pServerConfiguration->getPackageAPIDocs();
 		if (!sAPIDocsPackage.empty()) {
 			m_pContext->Log("Loading API Documentation from " + sAPIDocsPackage + "...", LibMC::eLogSubSystem::System, LibMC::eLogLevel::Message);
+			startupTiming.beginPhase("api documentation");
 			m_pContext->LoadAPIDocumentation(sAPIDocsPackage);
 		} else {
 			m_pContext->Log("No API Documentation package defined.", LibMC::eLogSubSystem::System, LibMC::eLogLevel::Message);
 		}
 
+		startupTiming.finishPhase();
+		m_pContext->Log("Server startup timing:", LibMC::eLogSubSystem::System, LibMC::eLogLevel::Message);
+		for (auto& sReportLine : startupTiming.getReportLines())
+			m_pContext->Log("    " + sReportLine, LibMC::eLogSubSystem::System, LibMC::eLogLevel::Message);
+
 
 		std::string sHostName = m_pServerConfiguration->getHostName();
 		uint32_t nPort = m_pServerConfiguration->getPort();
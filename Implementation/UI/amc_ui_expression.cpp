@@ -30,13 +30,22 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "amc_ui_expression.hpp"
 #include "amc_statemachinedata.hpp"
+#include "amc_parameterhandler.hpp"
+#include "amc_parametergroup.hpp"
 #include "common_utils.hpp"
 #include "libmc_exceptiontypes.hpp"
 #include <sstream>
 #include <iomanip>
+#include <atomic>
 
 using namespace AMC;
 
+CUIExpressionBinding::CUIExpressionBinding()
+	: m_pStateMachineData(nullptr), m_nParameterIndex(0), m_nLayoutVersion(0), m_bInvert(false), m_bIsStrictPath(false), m_bIsBound(true)
+{
+
+}
+
 CUIExpression::CUIExpression()
 {
 
@@ -61,6 +70,74 @@ void CUIExpression::setFixedValue(const std::string& sValue)
 {
 	m_sFixedValue = sValue;
 	m_sExpressionValue = "";
+	invalidateBinding();
+}
+
+PUIExpressionBinding CUIExpression::getBinding(CStateMachineData* pStateMachineData)
+{
+	auto pBinding = std::atomic_load(&m_pBinding);
+	if ((pBinding.get() != nullptr) && (pBinding->m_pStateMachineData == pStateMachineData)) {
+		if (!pBinding->m_bIsBound)
+			return nullptr;
+		return pBinding;
+	}
+
+	pBinding = compileBinding(pStateMachineData);
+	if (pBinding.get() != nullptr) {
+		std::atomic_store(&m_pBinding, pBinding);
+		return pBinding;
+	}
+
+	auto pUnbound = std::make_shared<CUIExpressionBinding>();
+	pUnbound->m_pStateMachineData = pStateMachineData;
+	pUnbound->m_bIsBound = false;
+	std::atomic_store(&m_pBinding, pUnbound);
+
+	return nullptr;
+}
+
+PUIExpressionBinding CUIExpression::compileBinding(CStateMachineData* pStateMachineData)
+{
+	std::string sTrimmedExpression = AMCCommon::CUtils::trimString(m_sExpressionValue);
+	if (sTrimmedExpression.empty())
+		return nullptr;
+
+	auto pBinding = std::make_shared<CUIExpressionBinding>();
+	pBinding->m_pStateMachineData = pStateMachineData;
+	if (sTrimmedExpression.at(0) == '!') {
+		sTrimmedExpression = sTrimmedExpression.substr(1);
+		pBinding->m_bInvert = true;
+	}
+
+	std::string sParameterGroupName, sParameterName;
+	try {
+		CStateMachineData::extractParameterDetailsFromDotString(sTrimmedExpression, pBinding->m_sInstanceName, sParameterGroupName, sParameterName, true, true);
+
+		if (sParameterName.empty()) {
+			if (sParameterGroupName != "$state")
+				return nullptr;
+
+			return pBinding;
+		}
+
+		auto pParameterHandler = pStateMachineData->getParameterHandler(pBinding->m_sInstanceName);
+		pBinding->m_pParameterGroup = pParameterHandler->findGroup(sParameterGroupName, true);
+		pBinding->m_nParameterIndex = pBinding->m_pParameterGroup->getParameterIndexByName(sParameterName, pBinding->m_nLayoutVersion);
+	}
+	catch (...) {
+		return nullptr;
+	}
+
+	pBinding->m_bIsStrictPath = AMCCommon::CUtils::stringIsValidAlphanumericNameString(pBinding->m_sInstanceName) &&
+		AMCCommon::CUtils::stringIsValidAlphanumericNameString(sParameterGroupName) &&
+		AMCCommon::CUtils::stringIsValidAlphanumericNameString(sParameterName);
+
+	return pBinding;
+}
+
+void CUIExpression::invalidateBinding()
+{
+	std::atomic_store(&m_pBinding, PUIExpressionBinding());
 }
 
 
@@ -99,6 +176,18 @@ std::string CUIExpression::evaluateValueEx(CStateMachineData* pStateMachineData)
 	if (!m_sExpressionValue.empty()) {
 		LibMCAssertNotNull(pStateMachineData);
 
+		auto pBinding = getBinding(pStateMachineData);
+		if ((pBinding.get() != nullptr) && (!pBinding->m_bInvert)) {
+			if (pBinding->m_pParameterGroup.get() == nullptr)
+				return pStateMachineData->getInstanceStateName(pBinding->m_sInstanceName);
+
+			std::string sValue;
+			if (pBinding->m_pParameterGroup->getBoundParameterValue(pBinding->m_nParameterIndex, pBinding->m_nLayoutVersion, sValue))
+				return sValue;
+
+			invalidateBinding();
+		}
+
 		std::string sParameterInstanceName, sParameterGroupName, sParameterName;
 		CStateMachineData::extractParameterDetailsFromDotString(m_sExpressionValue, sParameterInstanceName, sParameterGroupName, sParameterName, true, true);
 
@@ -216,6 +305,15 @@ double CUIExpression::evaluateNumberValue(CStateMachineData* pStateMachineData)
 	if (!m_sExpressionValue.empty()) {
 		LibMCAssertNotNull(pStateMachineData);
 
+		auto pBinding = getBinding(pStateMachineData);
+		if ((pBinding.get() != nullptr) && (pBinding->m_pParameterGroup.get() != nullptr) && pBinding->m_bIsStrictPath && (!pBinding->m_bInvert)) {
+			double dValue = 0.0;
+			if (pBinding->m_pParameterGroup->getBoundDoubleParameterValue(pBinding->m_nParameterIndex, pBinding->m_nLayoutVersion, dValue))
+				return dValue;
+
+			invalidateBinding();
+		}
+
 		std::string sParameterInstanceName, sParameterGroupName, sParameterName;
 		CStateMachineData::extractParameterDetailsFromDotString(m_sExpressionValue, sParameterInstanceName, sParameterGroupName, sParameterName, false, false);
 
@@ -251,6 +349,15 @@ int64_t CUIExpression::evaluateIntegerValue(CStateMachineData* pStateMachineData
 	if (!m_sExpressionValue.empty()) {
 		LibMCAssertNotNull(pStateMachineData);
 
+		auto pBinding = getBinding(pStateMachineData);
+		if ((pBinding.get() != nullptr) && (pBinding->m_pParameterGroup.get() != nullptr) && pBinding->m_bIsStrictPath && (!pBinding->m_bInvert)) {
+			int64_t nValue = 0;
+			if (pBinding->m_pParameterGroup->getBoundIntParameterValue(pBinding->m_nParameterIndex, pBinding->m_nLayoutVersion, nValue))
+				return nValue;
+
+			invalidateBinding();
+		}
+
 		std::string sParameterInstanceName, sParameterGroupName, sParameterName;
 		CStateMachineData::extractParameterDetailsFromDotString(m_sExpressionValue, sParameterInstanceName, sParameterGroupName, sParameterName, false, false);
 
@@ -286,6 +393,15 @@ bool CUIExpression::evaluateBoolValue(CStateMachineData* pStateMachineData)
 	if (!m_sExpressionValue.empty()) {
 		LibMCAssertNotNull(pStateMachineData);
 
+		auto pBinding = getBinding(pStateMachineData);
+		if ((pBinding.get() != nullptr) && (pBinding->m_pParameterGroup.get() != nullptr) && pBinding->m_bIsStrictPath) {
+			bool bValue = false;
+			if (pBinding->m_pParameterGroup->getBoundBoolParameterValue(pBinding->m_nParameterIndex, pBinding->m_nLayoutVersion, bValue))
+				return pBinding->m_bInvert ? (!bValue) : bValue;
+
+			invalidateBinding();
+		}
+
 		std::string sTrimmedExpression = AMCCommon::CUtils::trimString(m_sExpressionValue);
 
 		if (sTrimmedExpression.empty())
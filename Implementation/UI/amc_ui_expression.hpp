@@ -42,6 +42,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace AMC {
 
 	amcDeclareDependingClass(CStateMachineData, PStateMachineData);
+	amcDeclareDependingClass(CParameterGroup, PParameterGroup);
 
 	enum class eUIExpressionFormatType 
 	{
@@ -50,6 +51,32 @@ namespace AMC {
 		eftInteger = 3
 	};
 
+	// Pre-resolved target of a sync expression. Bindings are never modified after creation,
+	// so that they can be shared between concurrent evaluations.
+	class CUIExpressionBinding {
+	public:
+		CStateMachineData* m_pStateMachineData;
+		std::string m_sInstanceName;
+
+		// Null, if the expression refers to the state of an instance.
+		PParameterGroup m_pParameterGroup;
+		uint32_t m_nParameterIndex;
+		uint64_t m_nLayoutVersion;
+
+		// Expression starts with "!"; only valid for boolean evaluation.
+		bool m_bInvert;
+
+		// All names are alphanumeric, as required by the typed accessors.
+		bool m_bIsStrictPath;
+
+		// False, if the expression could not be bound to this state machine data.
+		bool m_bIsBound;
+
+		CUIExpressionBinding();
+	};
+
+	typedef std::shared_ptr<CUIExpressionBinding> PUIExpressionBinding;
+
 	class CUIExpression {
 	private:
 		std::string m_sFixedValue;
@@ -57,9 +84,17 @@ namespace AMC {
 
 		std::string m_sFormatString;
 
+		PUIExpressionBinding m_pBinding;
+
 		void readFromXML(const pugi::xml_node& xmlNode, const std::string& attributeName, const std::string& defaultValue, bool bValueMustExist);
 
 		std::string evaluateValueEx(CStateMachineData* pStateMachineData);
+
+		// Returns the cached binding or compiles a new one. Returns null, if the expression cannot be bound;
+		// callers then take the unbound path, which reports the error. Failed bindings are cached as well.
+		PUIExpressionBinding getBinding(CStateMachineData* pStateMachineData);
+		PUIExpressionBinding compileBinding(CStateMachineData* pStateMachineData);
+		void invalidateBinding();
 	public:
 
 		CUIExpression();
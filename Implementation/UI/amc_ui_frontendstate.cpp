@@ -42,6 +42,7 @@ CUIFrontendState::CUIFrontendState(PUIFrontendDefinition pFrontendDefinition)
 		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 
 	m_pLegacyParameterHandler = std::make_shared<CParameterHandler>("", pFrontendDefinition->getGlobalChrono ());
+	m_pLegacyStateVersionTracker = std::make_shared<CUIStateVersionTracker>();
 
 }
 
@@ -55,4 +56,8 @@ PParameterHandler CUIFrontendState::getLegacyParameterHandler()
 	return m_pLegacyParameterHandler;
 }
 
+PUIStateVersionTracker CUIFrontendState::getLegacyStateVersionTracker()
+{
+	return m_pLegacyStateVersionTracker;
+}
 
@@ -34,6 +34,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "amc_parameterhandler.hpp"
 #include "amc_ui_frontenddefinition.hpp"
+#include "amc_ui_stateversiontracker.hpp"
 
 #include "common_chrono.hpp"
 
@@ -43,6 +44,7 @@ namespace AMC {
 	private:
 
 		PParameterHandler m_pLegacyParameterHandler;
+		PUIStateVersionTracker m_pLegacyStateVersionTracker;
 		
 
 		PUIFrontendDefinition m_pFrontendDefinition;
@@ -54,6 +56,8 @@ namespace AMC {
 
 		PParameterHandler getLegacyParameterHandler ();
 
+		PUIStateVersionTracker getLegacyStateVersionTracker ();
+
 	};
 
 }
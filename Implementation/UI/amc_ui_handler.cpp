@@ -861,8 +861,23 @@ void CUIHandler::writeLegacyConfigurationToJSON(CJSONWriter& writer)
 
 }
 
-void CUIHandler::writeLegacyStateToJSON(CJSONWriter& writer, CParameterHandler* pLegacyClientVariableHandler)
+bool CUIHandler::writeLegacyStateToJSON(CJSONWriter& writer, CParameterHandler* pLegacyClientVariableHandler, CUIStateVersionTracker* pVersionTracker, uint64_t nSinceVersion)
 {
+    // Versions are only meaningful within the tracker that has given them out.
+    bool bIsDelta = (pVersionTracker != nullptr) && (nSinceVersion > 0) && (nSinceVersion <= pVersionTracker->getStateVersion());
+    if (!bIsDelta)
+        nSinceVersion = 0;
+
+    bool bHasChanges = writeLegacyPagesToJSON(writer, pLegacyClientVariableHandler, pVersionTracker, nSinceVersion);
+
+    if (pVersionTracker != nullptr) {
+        writer.addInteger(AMC_API_KEY_UI_STATEVERSION, (int64_t)pVersionTracker->getStateVersion());
+        writer.addBoolean(AMC_API_KEY_UI_ISDELTA, bIsDelta);
+    }
+
+    if (bIsDelta)
+        return bHasChanges;
+
     CJSONWriterArray menuItems(writer);
 
     for (auto iter : m_MenuItems) {
@@ -893,6 +908,12 @@ void CUIHandler::writeLegacyStateToJSON(CJSONWriter& writer, CParameterHandler*
     }
     writer.addArray(AMC_API_KEY_UI_TOOLBARITEMS, toolbarItems);
 
+    return true;
+}
+
+bool CUIHandler::writeLegacyPagesToJSON(CJSONWriter& writer, CParameterHandler* pLegacyClientVariableHandler, CUIStateVersionTracker* pVersionTracker, uint64_t nSinceVersion)
+{
+    bool bHasChanges = false;
 
     CJSONWriterArray pages(writer);
     for (auto iter : m_Pages) {
@@ -900,7 +921,11 @@ void CUIHandler::writeLegacyStateToJSON(CJSONWriter& writer, CParameterHandler*
         page.addString(AMC_API_KEY_UI_PAGENAME, iter.second->getName());
 
         CJSONWriterArray modules(writer);
-        iter.second->writeLegacyModulesToJSON(writer, modules, pLegacyClientVariableHandler);
+        iter.second->writeLegacyModulesToJSON(writer, modules, pLegacyClientVariableHandler, pVersionTracker, nSinceVersion);
+
+        if ((nSinceVersion > 0) && modules.isEmpty())
+            continue;
+        bHasChanges = true;
 
         page.addArray(AMC_API_KEY_UI_MODULES, modules);
 
@@ -915,7 +940,11 @@ void CUIHandler::writeLegacyStateToJSON(CJSONWriter& writer, CParameterHandler*
         custompage.addString(AMC_API_KEY_UI_COMPONENTNAME, iter.second->getComponentName());
 
         CJSONWriterArray modules(writer);
-        iter.second->writeLegacyModulesToJSON(writer, modules, pLegacyClientVariableHandler);
+        iter.second->writeLegacyModulesToJSON(writer, modules, pLegacyClientVariableHandler, pVersionTracker, nSinceVersion);
+
+        if ((nSinceVersion > 0) && modules.isEmpty())
+            continue;
+        bHasChanges = true;
 
         custompage.addArray(AMC_API_KEY_UI_MODULES, modules);
 
@@ -931,7 +960,11 @@ void CUIHandler::writeLegacyStateToJSON(CJSONWriter& writer, CParameterHandler*
         dialog.addString(AMC_API_KEY_UI_DIALOGTITLE, iter.second->getTitle());
 
         CJSONWriterArray modules(writer);
-        iter.second->writeLegacyModulesToJSON(writer, modules, pLegacyClientVariableHandler);
+        iter.second->writeLegacyModulesToJSON(writer, modules, pLegacyClientVariableHandler, pVersionTracker, nSinceVersion);
+
+        if ((nSinceVersion > 0) && modules.isEmpty())
+            continue;
+        bHasChanges = true;
 
         dialog.addArray(AMC_API_KEY_UI_MODULES, modules);
 
@@ -939,6 +972,7 @@ void CUIHandler::writeLegacyStateToJSON(CJSONWriter& writer, CParameterHandler*
     }
     writer.addArray(AMC_API_KEY_UI_DIALOGS, dialogs);
 
+    return bHasChanges;
 }
 
 
@@ -141,6 +141,9 @@ namespace AMC {
 
 		PUIDialog addDialog_Unsafe(const std::string& sName, const std::string& sTitle);
 
+		// Returns true if any module has been written.
+		bool writeLegacyPagesToJSON(CJSONWriter& writer, CParameterHandler* pLegacyClientVariableHandler, CUIStateVersionTracker* pVersionTracker, uint64_t nSinceVersion);
+
 	public:
 
 		CUIHandler(LibMCEnv::PWrapper pEnvironmentWrapper, PUISystemState pUISystemState);
@@ -174,7 +177,9 @@ namespace AMC {
 		// Legacy UI System
 		/////////////////////////////////////////////////////////////////////////////////////
 		void writeLegacyConfigurationToJSON (CJSONWriter& writer);
-		void writeLegacyStateToJSON(CJSONWriter& writer, CParameterHandler* pLegacyClientVariableHandler);
+		// Writes the complete state, or only the modules that changed after nSinceVersion if a version tracker is given and nSinceVersion is not 0.
+		// Returns false if a delta has been requested and nothing has changed.
+		bool writeLegacyStateToJSON(CJSONWriter& writer, CParameterHandler* pLegacyClientVariableHandler, CUIStateVersionTracker* pVersionTracker, uint64_t nSinceVersion);
 		PUIModuleItem findModuleItem(const std::string& sUUID);
 		PUIPage findPageOfModuleItem(const std::string& sUUID);
 		virtual void populateClientVariables(CParameterHandler* pClientVariableHandler);
@@ -155,6 +155,11 @@ bool CUIModule::isVersion2FrontendModule()
 	return false;
 }
 
+bool CUIModule::legacyDefinitionDependsOnParametersOnly()
+{
+	return false;
+}
+
 void CUIModule::frontendWriteModuleStatusToJSON(CJSONWriter& writer, CJSONWriterObject& moduleObject, CUIFrontendState* pFrontendState)
 {
 }
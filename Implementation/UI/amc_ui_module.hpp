@@ -130,6 +130,9 @@ namespace AMC {
 
 		virtual void writeLegacyDefinitionToJSON(CJSONWriter& writer, CJSONWriterObject& moduleObject, CParameterHandler* pLegacyClientVariableHandler) = 0;
 
+		// Returns true, if the legacy definition only depends on parameter values, so that it can be cached as long as they stay unchanged.
+		virtual bool legacyDefinitionDependsOnParametersOnly();
+
 		virtual PUIModuleItem findItem(const std::string& sUUID) = 0;
 
 		/////////////////////////////////////////////////////////////////////////////////////
@@ -185,6 +185,16 @@ void CUIModule_Content::writeLegacyDefinitionToJSON(CJSONWriter& writer, CJSONWr
 
 }
 
+bool CUIModule_Content::legacyDefinitionDependsOnParametersOnly()
+{
+	for (auto item : m_Items) {
+		if (!item->legacyContentDependsOnParametersOnly())
+			return false;
+	}
+
+	return true;
+}
+
 PUIModuleItem CUIModule_Content::findItem(const std::string& sUUID)
 {
 	auto iIter = m_ItemMap.find(sUUID);
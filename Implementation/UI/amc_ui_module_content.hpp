@@ -95,6 +95,8 @@ namespace AMC {
 
 		virtual void writeLegacyDefinitionToJSON(CJSONWriter& writer, CJSONWriterObject& moduleObject, CParameterHandler* pClientVariableHandler) override;
 
+		virtual bool legacyDefinitionDependsOnParametersOnly() override;
+
 		virtual void populateItemMap(std::map<std::string, PUIModuleItem>& itemMap) override;
 
 
@@ -256,6 +256,11 @@ void CUIModule_ContentButtonGroup::addLegacyContentToJSON(CJSONWriter& writer, C
 
 }
 
+bool CUIModule_ContentButtonGroup::legacyContentDependsOnParametersOnly()
+{
+	return true;
+}
+
 
 PUIModule_ContentButton CUIModule_ContentButtonGroup::addButton(const CUIExpression& Caption, const CUIExpression& TargetPage, const CUIExpression& Event, const std::string& sButtonName, const CUIExpression& IconName, const CUIExpression& DisabledExpression, const std::string& sEventFormValueSetting)
 {
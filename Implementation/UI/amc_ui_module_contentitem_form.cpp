@@ -468,6 +468,11 @@ void CUIModule_ContentForm::addLegacyContentToJSON(CJSONWriter& writer, CJSONWri
 	object.addArray(AMC_API_KEY_UI_FORMENTITIES, entityArray);
 }
 
+bool CUIModule_ContentForm::legacyContentDependsOnParametersOnly()
+{
+	return true;
+}
+
 void CUIModule_ContentForm::populateClientVariables(CParameterHandler* pClientVariableHandler)
 {
 	LibMCAssertNotNull(pClientVariableHandler);
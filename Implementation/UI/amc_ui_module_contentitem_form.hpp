@@ -220,6 +220,8 @@ namespace AMC {
 
 		virtual void addLegacyContentToJSON(CJSONWriter& writer, CJSONWriterObject& object, CParameterHandler* pClientVariableHandler, uint32_t nStateID) override;
 
+		virtual bool legacyContentDependsOnParametersOnly() override;
+
 		void addEntity(PUIModule_ContentFormEntity pEntity);
 		
 		std::string getName();
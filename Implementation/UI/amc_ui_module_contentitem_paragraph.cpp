@@ -74,4 +74,9 @@ void CUIModule_ContentParagraph::addLegacyContentToJSON(CJSONWriter& writer, CJS
 	object.addString(AMC_API_KEY_UI_ITEMTEXT, m_sText);
 }
 
+bool CUIModule_ContentParagraph::legacyContentDependsOnParametersOnly()
+{
+	return true;
+}
+
 
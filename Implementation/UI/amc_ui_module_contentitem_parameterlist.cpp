@@ -246,6 +246,17 @@ void CUIModule_ContentParameterList::addLegacyContentToJSON(CJSONWriter& writer,
 
 }
 
+bool CUIModule_ContentParameterList::legacyContentDependsOnParametersOnly()
+{
+	// Full groups and instances also depend on which parameters exist.
+	for (auto entry : m_List) {
+		if (entry->isFullInstance() || entry->isFullGroup())
+			return false;
+	}
+
+	return true;
+}
+
 
 void CUIModule_ContentParameterList::addEntry(const std::string& sInstance, const std::string& sParameterGroup, const std::string& sParameter)
 {
@@ -99,6 +99,8 @@ namespace AMC {
 
 		void addLegacyContentToJSON(CJSONWriter& writer, CJSONWriterObject& object, CParameterHandler* pClientVariableHandler, uint32_t nStateID) override;
 
+		bool legacyContentDependsOnParametersOnly() override;
+
 		void addEntry(const std::string& sInstance, const std::string& sParameterGroup, const std::string& sParameter);
 
 		uint32_t getEntryCount();
@@ -87,6 +87,11 @@ void CUIModule_ContentUpload::addLegacyContentToJSON(CJSONWriter& writer, CJSONW
 	object.addString(AMC_API_KEY_UI_ITEMUPLOADFAILUREEVENT, m_sFailureEvent);
 }
 
+bool CUIModule_ContentUpload::legacyContentDependsOnParametersOnly()
+{
+	return true;
+}
+
 
 void CUIModule_ContentUpload::configurePostLoading()
 {
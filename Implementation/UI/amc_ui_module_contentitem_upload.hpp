@@ -72,6 +72,8 @@ namespace AMC {
 
 		void addLegacyContentToJSON(CJSONWriter& writer, CJSONWriterObject& object, CParameterHandler* pClientVariableHandler, uint32_t nStateID) override;
 
+		bool legacyContentDependsOnParametersOnly() override;
+
 		virtual void configurePostLoading() override;
 
 		virtual void populateClientVariables(CParameterHandler* pClientVariableHandler) override;
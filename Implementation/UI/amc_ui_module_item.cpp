@@ -61,6 +61,11 @@ std::string CUIModuleItem::findElementPathByUUID(const std::string& sUUID)
 }
 
 
+bool CUIModuleItem::legacyContentDependsOnParametersOnly()
+{
+	return false;
+}
+
 void CUIModuleItem::setEventPayloadValue(const std::string& sEventName, const std::string& sPayloadUUID, const std::string& sPayloadValue, CParameterHandler* pClientVariableHandler)
 {
 
@@ -65,6 +65,9 @@ namespace AMC {
 
 		virtual void addLegacyContentToJSON(CJSONWriter& writer, CJSONWriterObject& object, CParameterHandler * pLegacyClientVariableHandler, uint32_t nStateID) = 0;
 
+		// Returns true, if the legacy content only depends on parameter values and client variables.
+		virtual bool legacyContentDependsOnParametersOnly();
+
 		virtual void setEventPayloadValue (const std::string & sEventName, const std::string& sPayloadUUID, const std::string& sPayloadValue, CParameterHandler* pClientVariableHandler);
 
 		virtual void handleCustomRequest (PAPIAuth pAuth, const std::string & requestType,  const CAPIJSONRequest & requestData, CJSONWriter & response, CUIModule_UIEventHandler* pEventHandler);
@@ -112,11 +112,47 @@ void CUIPage::ensureUIEventExists(const std::string& sEventName)
 // Legacy UI System
 /////////////////////////////////////////////////////////////////////////////////////
 
-void CUIPage::writeLegacyModulesToJSON(CJSONWriter& writer, CJSONWriterArray& moduleArray, CParameterHandler* pLegacyClientVariableHandler)
+void CUIPage::writeLegacyModulesToJSON(CJSONWriter& writer, CJSONWriterArray& moduleArray, CParameterHandler* pLegacyClientVariableHandler, CUIStateVersionTracker* pVersionTracker, uint64_t nSinceVersion)
 {
 	for (auto module : m_Modules) {
 		CJSONWriterObject moduleObject(writer);		
-		module->writeLegacyDefinitionToJSON(writer, moduleObject, pLegacyClientVariableHandler);
+
+		if (pVersionTracker != nullptr) {
+			std::string sModuleUUID = module->getUUID();
+			bool bIsCacheable = module->legacyDefinitionDependsOnParametersOnly();
+
+			uint64_t nModuleVersion = 0;
+			PUIStateFragmentDocument pCachedDocument;
+			if (bIsCacheable && pVersionTracker->retrieveUnchangedFragment(sModuleUUID, pCachedDocument, nModuleVersion)) {
+				// None of the module's inputs has changed, so the last serialization is still valid.
+				if (nModuleVersion <= nSinceVersion)
+					continue;
+
+				moduleObject.copyFromObject(*pCachedDocument);
+			}
+			else {
+				if (bIsCacheable) {
+					auto pReadSet = std::make_shared<CParameterReadSet>();
+					{
+						CParameterReadRecording readRecording(pReadSet.get());
+						module->writeLegacyDefinitionToJSON(writer, moduleObject, pLegacyClientVariableHandler);
+					}
+					nModuleVersion = pVersionTracker->updateFragment(sModuleUUID, moduleObject.saveToString(), pReadSet);
+				}
+				else {
+					module->writeLegacyDefinitionToJSON(writer, moduleObject, pLegacyClientVariableHandler);
+					nModuleVersion = pVersionTracker->updateFragment(sModuleUUID, moduleObject.saveToString());
+				}
+
+				if (nModuleVersion <= nSinceVersion)
+					continue;
+			}
+
+			moduleObject.addInteger(AMC_API_KEY_UI_MODULEVERSION, (int64_t)nModuleVersion);
+		}
+		else {
+			module->writeLegacyDefinitionToJSON(writer, moduleObject, pLegacyClientVariableHandler);
+		}
 
 		moduleArray.addObject(moduleObject);
 	}
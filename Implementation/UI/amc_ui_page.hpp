@@ -99,7 +99,8 @@ namespace AMC {
 		/////////////////////////////////////////////////////////////////////////////////////
 		// Legacy UI System
 		/////////////////////////////////////////////////////////////////////////////////////
-		virtual void writeLegacyModulesToJSON(CJSONWriter & writer, CJSONWriterArray & moduleArray, CParameterHandler* pLegacyClientVariableHandler);
+		// If a version tracker is given, every module carries its version and only modules newer than nSinceVersion are written.
+		virtual void writeLegacyModulesToJSON(CJSONWriter & writer, CJSONWriterArray & moduleArray, CParameterHandler* pLegacyClientVariableHandler, CUIStateVersionTracker* pVersionTracker, uint64_t nSinceVersion);
 		virtual PUIModuleItem findModuleItemByUUID(const std::string& sUUID) override;
 		virtual void registerFormName(const std::string& sFormUUID, const std::string& sFormName) override;
 		virtual std::string findFormUUIDByName(const std::string& sFormName) override;
@@ -0,0 +1,135 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "amc_ui_stateversiontracker.hpp"
+#include "libmc_exceptiontypes.hpp"
+
+using namespace AMC;
+
+CUIStateVersionTracker::CUIStateVersionTracker()
+	: m_nStateVersion(0)
+{
+
+}
+
+CUIStateVersionTracker::~CUIStateVersionTracker()
+{
+
+}
+
+uint64_t CUIStateVersionTracker::updateFragment(const std::string& sFragmentKey, const std::string& sSerializedJSON)
+{
+	return updateFragment(sFragmentKey, sSerializedJSON, nullptr);
+}
+
+uint64_t CUIStateVersionTracker::updateFragment(const std::string& sFragmentKey, const std::string& sSerializedJSON, PParameterReadSet pReadSet)
+{
+	if (sFragmentKey.empty())
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+	PUIStateFragmentDocument pDocument;
+	if (pReadSet.get() != nullptr) {
+		pDocument = std::make_shared<rapidjson::Document>();
+		pDocument->Parse(sSerializedJSON.c_str());
+		if (pDocument->HasParseError() || (!pDocument->IsObject()))
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+	}
+
+	std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+	auto iIter = m_Fragments.find(sFragmentKey);
+	if (iIter == m_Fragments.end()) {
+		sUIStateFragment newFragment;
+		newFragment.m_nVersion = 0;
+		iIter = m_Fragments.insert(std::make_pair(sFragmentKey, newFragment)).first;
+	}
+
+	auto& fragment = iIter->second;
+	if ((fragment.m_nVersion == 0) || (fragment.m_sSerializedJSON != sSerializedJSON)) {
+		m_nStateVersion++;
+		fragment.m_sSerializedJSON = sSerializedJSON;
+		fragment.m_nVersion = m_nStateVersion;
+	}
+
+	fragment.m_pDocument = pDocument;
+	fragment.m_pReadSet = pReadSet;
+
+	return fragment.m_nVersion;
+}
+
+bool CUIStateVersionTracker::retrieveUnchangedFragment(const std::string& sFragmentKey, PUIStateFragmentDocument& pDocument, uint64_t& nVersion)
+{
+	PParameterReadSet pReadSet;
+
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+		auto iIter = m_Fragments.find(sFragmentKey);
+		if (iIter == m_Fragments.end())
+			return false;
+
+		pReadSet = iIter->second.m_pReadSet;
+		pDocument = iIter->second.m_pDocument;
+		nVersion = iIter->second.m_nVersion;
+	}
+
+	// Checking the read set locks parameter groups, which must not happen while holding the tracker mutex.
+	if ((pReadSet.get() == nullptr) || (pDocument.get() == nullptr))
+		return false;
+
+	return pReadSet->isUnchanged();
+}
+
+uint64_t CUIStateVersionTracker::getFragmentVersion(const std::string& sFragmentKey)
+{
+	std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+	auto iIter = m_Fragments.find(sFragmentKey);
+	if (iIter != m_Fragments.end())
+		return iIter->second.m_nVersion;
+
+	return 0;
+}
+
+uint64_t CUIStateVersionTracker::getStateVersion()
+{
+	std::lock_guard<std::mutex> lockGuard(m_Mutex);
+	return m_nStateVersion;
+}
+
+void CUIStateVersionTracker::clear()
+{
+	std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+	// Versions stay monotonic, so that clients never see a version twice.
+	m_Fragments.clear();
+}
+
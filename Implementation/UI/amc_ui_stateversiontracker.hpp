@@ -0,0 +1,97 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMC_UI_STATEVERSIONTRACKER
+#define __AMC_UI_STATEVERSIONTRACKER
+
+#include <string>
+#include <map>
+#include <mutex>
+#include <memory>
+
+#include "amc_parametergroup.hpp"
+
+#include "RapidJSON/document.h"
+
+namespace AMC {
+
+	typedef std::shared_ptr<rapidjson::Document> PUIStateFragmentDocument;
+
+	// Remembers the last serialized JSON fragment of each legacy UI module of a client session.
+	// Whenever a fragment differs from its predecessor, it is stamped with a new, monotonically increasing version.
+	class CUIStateVersionTracker {
+	private:
+
+		typedef struct _sUIStateFragment {
+			std::string m_sSerializedJSON;
+			uint64_t m_nVersion;
+
+			// Only set for fragments that may be reused as long as the parameters they were generated from are unchanged.
+			PUIStateFragmentDocument m_pDocument;
+			PParameterReadSet m_pReadSet;
+		} sUIStateFragment;
+
+		std::mutex m_Mutex;
+
+		uint64_t m_nStateVersion;
+
+		std::map<std::string, sUIStateFragment> m_Fragments;
+
+	public:
+
+		CUIStateVersionTracker();
+
+		virtual ~CUIStateVersionTracker();
+
+		// Compares the fragment with the cached one and returns its (possibly new) version.
+		uint64_t updateFragment(const std::string& sFragmentKey, const std::string& sSerializedJSON);
+
+		// Same as updateFragment, but keeps the fragment for reuse as long as the read parameters stay unchanged.
+		uint64_t updateFragment(const std::string& sFragmentKey, const std::string& sSerializedJSON, PParameterReadSet pReadSet);
+
+		// Returns true, if the fragment has been stored with a read set and none of its parameters has changed since.
+		bool retrieveUnchangedFragment(const std::string& sFragmentKey, PUIStateFragmentDocument& pDocument, uint64_t& nVersion);
+
+		// Returns 0, if the fragment is unknown.
+		uint64_t getFragmentVersion(const std::string& sFragmentKey);
+
+		// Returns the highest version that has been given out so far.
+		uint64_t getStateVersion();
+
+		void clear();
+
+	};
+
+	typedef std::shared_ptr<CUIStateVersionTracker> PUIStateVersionTracker;
+
+}
+
+#endif //__AMC_UI_STATEVERSIONTRACKER
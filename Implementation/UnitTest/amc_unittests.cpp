@@ -42,6 +42,26 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "amc_unittests_signalslot.hpp"
 
+#include "amc_unittests_statejournalaggregator.hpp"
+#include "amc_unittests_statemachinescheduler.hpp"
+#include "amc_unittests_dependencytaskrunner.hpp"
+#include "amc_unittests_processdirectorywriter.hpp"
+
+#include "amc_unittests_uistateversiontracker.hpp"
+#include "amc_unittests_uiexpression.hpp"
+
+#include "amc_unittests_scatterplotchannelencoder.hpp"
+#include "amc_unittests_dataseriesdownsampler.hpp"
+#include "amc_unittests_statejournalstreamcache.hpp"
+#include "amc_unittests_discretefielddata2d.hpp"
+#include "amc_unittests_portablezipwriter.hpp"
+#include "amc_unittests_jpegencoder.hpp"
+
+#include "amc_unittests_journalchunkcodec.hpp"
+#include "amc_unittests_journalalertindex.hpp"
+#include "amc_unittests_buildjobhandler.hpp"
+#include "amc_unittests_datatable.hpp"
+
 
 using namespace AMCUnitTest;
 
@@ -60,4 +80,24 @@ CUnitTests::CUnitTests (PUnitTestIO pIO)
 	registerTestGroup(std::make_shared <CUnitTestGroup_AccessPermission>());
 
 	registerTestGroup(std::make_shared <CUnitTestGroup_SignalSlot>());
+
+	registerTestGroup(std::make_shared <CUnitTestGroup_StateJournalAggregator>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_StateMachineScheduler>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_DependencyTaskRunner>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_ProcessDirectoryWriter>());
+
+	registerTestGroup(std::make_shared <CUnitTestGroup_UIStateVersionTracker>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_UIExpression>());
+
+	registerTestGroup(std::make_shared <CUnitTestGroup_ScatterplotChannelEncoder>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_DataSeriesDownsampler>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_StateJournalStreamCache>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_DiscreteFieldData2D>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_PortableZIPWriter>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_JPEGEncoder>());
+
+	registerTestGroup(std::make_shared <CUnitTestGroup_JournalChunkCodec>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_JournalAlertIndex>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_BuildJobHandler>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_DataTable>());
 }
\ No newline at end of file
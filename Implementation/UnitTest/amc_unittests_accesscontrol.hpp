@@ -36,6 +36,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "amc_accesscontrol.hpp"
 #include "amc_accessrole.hpp"
 
+#include <set>
+
 namespace AMCUnitTest {
 
     class CUnitTestGroup_AccessControl : public CUnitTestGroup {
@@ -56,6 +58,8 @@ namespace AMCUnitTest {
             registerTest("PermissionNotFoundThrows", "Querying missing permission with bMustExist=true should throw", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_AccessControl::testPermissionNotFoundThrows, this));
             registerTest("DefaultRoleNotSetThrows", "Accessing unset default role should throw", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_AccessControl::testDefaultRoleNotSetThrows, this));
             registerTest("EmptyIdentifierThrows", "Empty permission or role identifiers must throw", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_AccessControl::testEmptyIdentifierThrows, this));
+            registerTest("PermissionIndicesAreUnique", "Added permissions get distinct bit indices", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_AccessControl::testPermissionIndicesAreUnique, this));
+            registerTest("CheckPermissionInRoleInstance", "Bitset check against a resolved role follows role changes", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_AccessControl::testCheckPermissionInRoleInstance, this));
         }
 
         void initializeTests() override {
@@ -175,6 +179,38 @@ namespace AMCUnitTest {
             }
             assertTrue(thrown, "Empty permission identifier not rejected");
         }
+
+        void testPermissionIndicesAreUnique() {
+            AMC::CAccessControl control;
+            std::set<uint32_t> indices;
+            for (uint32_t nIndex = 0; nIndex < 100; nIndex++) {
+                auto perm = control.addPermission("perm" + std::to_string(nIndex), makeString("P"), makeString(""));
+                assertTrue(perm->getPermissionIndex() != ACCESSPERMISSION_NOINDEX, "Permission has no index");
+                indices.insert(perm->getPermissionIndex());
+            }
+            assertTrue(indices.size() == 100, "Permission indices are not unique");
+        }
+
+        void testCheckPermissionInRoleInstance() {
+            AMC::CAccessControl control;
+            std::vector<AMC::PAccessPermission> permissions;
+            for (uint32_t nIndex = 0; nIndex < 70; nIndex++)
+                permissions.push_back(control.addPermission("perm" + std::to_string(nIndex), makeString("P"), makeString("")));
+            auto role = control.addRole("operator", makeString("Operator"), makeString(""));
+
+            role->addPermission(permissions.at(3));
+            role->addPermission(permissions.at(65));
+
+            assertTrue(control.checkPermissionInRole(role, "perm3"));
+            assertTrue(control.checkPermissionInRole(role, "perm65"));
+            assertFalse(control.checkPermissionInRole(role, "perm4"));
+            assertFalse(control.checkPermissionInRole(role, "perm64"));
+            assertFalse(control.checkPermissionInRole(role, "unknown"));
+
+            role->removePermission("perm65");
+            assertFalse(control.checkPermissionInRole(role, "perm65"), "Removed permission still granted");
+            assertTrue(control.checkPermissionInRole("operator", "perm3"));
+        }
     };
 
 }
@@ -52,6 +52,7 @@ namespace AMCUnitTest {
 			registerTest("RemovePermission", "Removes a permission from the role", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_AccessRole::testRemovePermission, this));
 			registerTest("GetPermissionsList", "Returns all assigned permissions", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_AccessRole::testGetPermissionsList, this));
 			registerTest("AddNullPermissionThrows", "Adding a null permission throws", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_AccessRole::testAddNullPermissionThrows, this));
+			registerTest("PermissionSetSnapshot", "Permission sets are immutable snapshots", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_AccessRole::testPermissionSetSnapshot, this));
 		}
 
 		void initializeTests() override {
@@ -149,6 +150,30 @@ namespace AMCUnitTest {
 			assertTrue(thrown, "Adding null permission should throw");
 		}
 
+		void testPermissionSetSnapshot() {
+			AMC::CAccessRole role("user", AMC::CStringResource("User"), AMC::CStringResource("Standard user"));
+			auto pEmptySet = role.getPermissionSet();
+			assertTrue(pEmptySet->getCount() == 0);
+
+			role.addPermission(std::make_shared<AMC::CAccessPermission>("read", AMC::CStringResource("Read"), AMC::CStringResource(""), 7));
+			role.addPermission(std::make_shared<AMC::CAccessPermission>("write", AMC::CStringResource("Write"), AMC::CStringResource(""), 130));
+
+			auto pSet = role.getPermissionSet();
+			assertTrue(pSet->getCount() == 2);
+			assertTrue(pSet->contains(7) && pSet->contains(130));
+			assertFalse(pSet->contains(6) || pSet->contains(129) || pSet->contains(ACCESSPERMISSION_NOINDEX));
+			assertTrue(role.hasPermissionIndex(130));
+
+			// Unindexed permissions are granted by name only.
+			role.addPermission(makePermission("legacy"));
+			assertTrue(role.getPermissionSet()->getCount() == 2);
+
+			role.removePermission("write");
+			assertFalse(role.hasPermissionIndex(130));
+			assertTrue(pSet->contains(130), "Earlier snapshot has been modified");
+			assertTrue(pEmptySet->getCount() == 0, "Earlier snapshot has been modified");
+		}
+
 	};
 
 }
@@ -0,0 +1,431 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCTEST_UNITTEST_BUILDJOBHANDLER
+#define __AMCTEST_UNITTEST_BUILDJOBHANDLER
+
+#include "amc_unittests.hpp"
+#include "amcdata_databasemigrator.hpp"
+#include "amcdata_databasemigrator_storage.hpp"
+#include "amcdata_databasemigrator_buildjobs.hpp"
+#include "amcdata_databasemigrator_users.hpp"
+#include "amcdata_databasemigrator_persistentparameters.hpp"
+#include "amcdata_databasemigrator_journals.hpp"
+#include "amcdata_databasemigrator_machineconfiguration.hpp"
+#include "amcdata_sqlhandler_sqlite.hpp"
+#include "amcdata_storagestate.hpp"
+#include "libmcdata_buildjobhandler.hpp"
+#include "libmcdata_interfaceexception.hpp"
+#include "common_utils.hpp"
+#include "common_chrono.hpp"
+
+#include <algorithm>
+#include <set>
+
+
+namespace AMCUnitTest {
+
+
+class CUnitTestGroup_BuildJobHandler : public CUnitTestGroup {
+private:
+
+    // 2025-01-01T00:00:00Z
+    static const uint64_t m_nBaseTimeStamp = 1735689600000000ULL;
+
+    typedef struct {
+        std::string m_sUUID;
+        std::string m_sTimeStamp;
+    } sPagedRow;
+
+    std::vector<std::string> m_DatabaseFileNames;
+
+    // Takes ownership of an interface pointer returned by the handler.
+    template <class T> static std::shared_ptr<T> acquire(T* pInstance)
+    {
+        return std::shared_ptr<T>(pInstance, LibMCData::Impl::IBase::ReleaseBaseClassInterface);
+    }
+
+    static std::vector<AMCData::PDatabaseMigrationClass> createMigrationClasses()
+    {
+        return {
+            std::make_shared<AMCData::CDatabaseMigrationClass_Storage>(),
+            std::make_shared<AMCData::CDatabaseMigrationClass_BuildJobs>(),
+            std::make_shared<AMCData::CDatabaseMigrationClass_Users>(),
+            std::make_shared<AMCData::CDatabaseMigrationClass_PersistentParameters>(),
+            std::make_shared<AMCData::CDatabaseMigrationClass_Journals>(),
+            std::make_shared<AMCData::CDatabaseMigrationClass_MachineConfiguration>()
+        };
+    }
+
+    static void migrateToCurrentVersion(AMCData::PSQLHandler pSQLHandler, std::string& sInstallationUUID)
+    {
+        AMCData::CDatabaseMigrator migrator;
+        for (auto pMigrationClass : createMigrationClasses())
+            migrator.addMigrationClass(pMigrationClass);
+
+        std::string sInstallationSecret;
+        migrator.migrateDatabaseSchemas(pSQLHandler, sInstallationUUID, sInstallationSecret);
+    }
+
+    // Writes the schema of an older release, as the migrator would have left it.
+    static void createSchemaOfVersion(AMCData::PSQLHandler pSQLHandler, uint32_t nSchemaVersion, const std::string& sInstallationUUID)
+    {
+        auto migrationClasses = createMigrationClasses();
+
+        auto pTransaction = pSQLHandler->beginTransaction();
+        pTransaction->executeStatement("CREATE TABLE dbschema (schemaversion INTEGER DEFAULT 0, installationuuid VARCHAR(128) NOT NULL, installationsecret VARCHAR(128) NOT NULL)");
+        for (uint32_t nVersionIndex = 0; nVersionIndex < nSchemaVersion; nVersionIndex++) {
+            for (auto pMigrationClass : migrationClasses)
+                pMigrationClass->increaseSchemaVersion(pTransaction, nVersionIndex);
+        }
+
+        auto pStatement = pTransaction->prepareStatement("INSERT INTO dbschema (schemaversion, installationuuid, installationsecret) VALUES (?, ?, ?)");
+        pStatement->setInt(1, nSchemaVersion);
+        pStatement->setString(2, sInstallationUUID);
+        pStatement->setString(3, "secret");
+        pStatement->execute();
+        pStatement = nullptr;
+
+        pTransaction->commit();
+    }
+
+    AMCData::PSQLHandler createDatabase()
+    {
+        std::string sFileName = AMCCommon::CUtils::findTemporaryFileName(AMCCommon::CUtils::getTempFolder(), "amcunittest_", ".db", 1024);
+        m_DatabaseFileNames.push_back(sFileName);
+        return std::make_shared<AMCData::CSQLHandler_SQLite>(sFileName);
+    }
+
+    void deleteDatabases()
+    {
+        for (auto& sFileName : m_DatabaseFileNames)
+            AMCCommon::CUtils::deleteFileFromDisk(sFileName, false);
+        m_DatabaseFileNames.clear();
+    }
+
+    static std::shared_ptr<LibMCData::Impl::CBuildJobHandler> createHandler(AMCData::PSQLHandler pSQLHandler)
+    {
+        auto pStorageState = std::make_shared<AMCData::CStorageState>(AMCCommon::CUtils::getTempFolder(), AMCCommon::CUtils::createUUID());
+        return std::make_shared<LibMCData::Impl::CBuildJobHandler>(pSQLHandler, pStorageState);
+    }
+
+    static std::string createTimeStamp(uint64_t nSeconds)
+    {
+        return AMCCommon::CChrono::convertToISO8601TimeUTC(m_nBaseTimeStamp + nSeconds * 1000000ULL);
+    }
+
+    static void insertJob(AMCData::PSQLHandler pSQLHandler, const std::string& sUUID, const std::string& sStatus, const std::string& sTimeStamp)
+    {
+        auto pStatement = pSQLHandler->prepareStatement("INSERT INTO buildjobs (uuid, name, status, storagestreamuuid, layercount, userid, useruuid, thumbnailuuid, timestamp) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?)");
+        pStatement->setString(1, sUUID);
+        pStatement->setString(2, "job " + sUUID);
+        pStatement->setString(3, sStatus);
+        pStatement->setString(4, AMCCommon::CUtils::createEmptyUUID());
+        pStatement->setInt(5, 10);
+        pStatement->setString(6, "");
+        pStatement->setString(7, AMCCommon::CUtils::createEmptyUUID());
+        pStatement->setString(8, AMCCommon::CUtils::createEmptyUUID());
+        pStatement->setString(9, sTimeStamp);
+        pStatement->execute();
+    }
+
+    static void insertExecution(AMCData::PSQLHandler pSQLHandler, const std::string& sJobUUID, const std::string& sTimeStamp)
+    {
+        auto pStatement = pSQLHandler->prepareStatement("INSERT INTO buildjobexecutions (uuid, jobuuid, journaluuid, startjournaltimestamp, endjournaltimestamp, useruuid, status, description, active, timestamp) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
+        pStatement->setString(1, AMCCommon::CUtils::createUUID());
+        pStatement->setString(2, sJobUUID);
+        pStatement->setString(3, AMCCommon::CUtils::createUUID());
+        pStatement->setString(4, sTimeStamp);
+        pStatement->setInt64(5, 0);
+        pStatement->setString(6, AMCCommon::CUtils::createEmptyUUID());
+        pStatement->setString(7, "finished");
+        pStatement->setString(8, "");
+        pStatement->setInt(9, 1);
+        pStatement->setString(10, sTimeStamp);
+        pStatement->execute();
+    }
+
+    static int32_t queryInteger(AMCData::PSQLHandler pSQLHandler, const std::string& sQuery, const std::string& sParameter)
+    {
+        auto pStatement = pSQLHandler->prepareStatement(sQuery);
+        if (!sParameter.empty())
+            pStatement->setString(1, sParameter);
+        if (!pStatement->nextRow())
+            throw std::runtime_error("query returned no row: " + sQuery);
+        return pStatement->getColumnInt(1);
+    }
+
+    static std::vector<sPagedRow> readJobs(LibMCData::Impl::IBuildJobIterator* pIterator)
+    {
+        auto pOwnedIterator = acquire(pIterator);
+        std::vector<sPagedRow> rows;
+        while (pOwnedIterator->MoveNext()) {
+            auto pJob = acquire(pOwnedIterator->GetCurrentJob());
+            rows.push_back({ pJob->GetUUID(), pJob->GetTimeStamp() });
+        }
+        return rows;
+    }
+
+    static std::vector<sPagedRow> readExecutions(LibMCData::Impl::IBuildJobExecutionIterator* pIterator)
+    {
+        auto pOwnedIterator = acquire(pIterator);
+        std::vector<sPagedRow> rows;
+        while (pOwnedIterator->MoveNext()) {
+            auto pExecution = acquire(pOwnedIterator->GetCurrentJobExecution());
+            rows.push_back({ pExecution->GetExecutionUUID(), AMCCommon::CChrono::convertToISO8601TimeUTC(pExecution->GetStartTimeStampInMicroseconds()) });
+        }
+        return rows;
+    }
+
+    // Concatenates all pages and checks that no row is skipped or repeated.
+    void assertPagesMatchFullList(const std::vector<sPagedRow>& fullList, uint32_t nPageSize, std::function<std::vector<sPagedRow>(const std::string&, const std::string&)> retrievePage)
+    {
+        std::vector<std::string> pagedUUIDs;
+        std::string sCursorTimeStamp;
+        std::string sCursorUUID;
+        uint32_t nPageCount = 0;
+
+        while (true) {
+            auto page = retrievePage(sCursorTimeStamp, sCursorUUID);
+            assertTrue(page.size() <= nPageSize, "page size");
+            for (auto& row : page)
+                pagedUUIDs.push_back(row.m_sUUID);
+
+            nPageCount++;
+            assertTrue(nPageCount <= fullList.size() + 1, "paging terminates");
+
+            if (page.size() < nPageSize)
+                break;
+
+            sCursorTimeStamp = page.back().m_sTimeStamp;
+            sCursorUUID = page.back().m_sUUID;
+        }
+
+        assertIntegerRange((int64_t)pagedUUIDs.size(), (int64_t)fullList.size(), (int64_t)fullList.size(), "paged row count");
+        std::set<std::string> uniqueUUIDs(pagedUUIDs.begin(), pagedUUIDs.end());
+        assertIntegerRange((int64_t)uniqueUUIDs.size(), (int64_t)pagedUUIDs.size(), (int64_t)pagedUUIDs.size(), "no row is repeated");
+        for (size_t nIndex = 0; nIndex < fullList.size(); nIndex++)
+            assertTrue(pagedUUIDs.at(nIndex) == fullList.at(nIndex).m_sUUID, "pages follow the full list order");
+    }
+
+    void assertOrderedByTimeStampAndUUID(const std::vector<sPagedRow>& rows)
+    {
+        for (size_t nIndex = 1; nIndex < rows.size(); nIndex++) {
+            auto& previous = rows.at(nIndex - 1);
+            auto& current = rows.at(nIndex);
+            assertTrue(std::make_pair(previous.m_sTimeStamp, previous.m_sUUID) > std::make_pair(current.m_sTimeStamp, current.m_sUUID), "descending by timestamp and uuid");
+        }
+    }
+
+public:
+    CUnitTestGroup_BuildJobHandler() = default;
+    virtual ~CUnitTestGroup_BuildJobHandler() = default;
+
+    std::string getTestGroupName() override {
+        return "BuildJobHandler";
+    }
+
+    void initializeTests() override {
+        // Nothing to initialize
+    }
+
+    void registerTests() override {
+        registerTest("MigrationFromVersion18", "Schema version 19 backfills the execution count and adds the listing indices", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_BuildJobHandler::test_MigrationFromVersion18, this));
+        registerTest("JobPages", "Job pages neither skip nor repeat jobs with equal timestamps", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_BuildJobHandler::test_JobPages, this));
+        registerTest("ExecutionPages", "Execution pages neither skip nor repeat executions with equal timestamps", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_BuildJobHandler::test_ExecutionPages, this));
+        registerTest("InvalidPageArguments", "Rejects invalid page sizes and incomplete cursors", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_BuildJobHandler::test_InvalidPageArguments, this));
+    }
+
+private:
+
+    void test_MigrationFromVersion18() {
+        auto pSQLHandler = createDatabase();
+        std::string sInstallationUUID = AMCCommon::CUtils::createUUID();
+        createSchemaOfVersion(pSQLHandler, 18, sInstallationUUID);
+
+        assertIntegerRange(queryInteger(pSQLHandler, "SELECT COUNT(*) FROM pragma_table_info('buildjobs') WHERE name=?", "executioncount"), 0, 0, "version 18 has no execution count");
+
+        std::string sJobWithExecutions = AMCCommon::CUtils::createUUID();
+        std::string sJobWithoutExecutions = AMCCommon::CUtils::createUUID();
+        std::string sJobWithOneExecution = AMCCommon::CUtils::createUUID();
+        insertJob(pSQLHandler, sJobWithExecutions, "validated", createTimeStamp(1));
+        insertJob(pSQLHandler, sJobWithoutExecutions, "validated", createTimeStamp(2));
+        insertJob(pSQLHandler, sJobWithOneExecution, "archived", createTimeStamp(3));
+        for (uint32_t nIndex = 0; nIndex < 3; nIndex++)
+            insertExecution(pSQLHandler, sJobWithExecutions, createTimeStamp(10 + nIndex));
+        insertExecution(pSQLHandler, sJobWithOneExecution, createTimeStamp(20));
+
+        std::string sMigratedInstallationUUID;
+        migrateToCurrentVersion(pSQLHandler, sMigratedInstallationUUID);
+        assertTrue(sMigratedInstallationUUID == sInstallationUUID, "installation uuid is kept");
+        assertIntegerRange(queryInteger(pSQLHandler, "SELECT MAX(schemaversion) FROM dbschema", ""), 19, 19, "schema version");
+        assertIntegerRange(AMCData::CDatabaseMigrator::getCurrentSchemaVersion(), 19, 19, "current schema version");
+
+        assertIntegerRange(queryInteger(pSQLHandler, "SELECT executioncount FROM buildjobs WHERE uuid=?", sJobWithExecutions), 3, 3, "backfilled execution count");
+        assertIntegerRange(queryInteger(pSQLHandler, "SELECT executioncount FROM buildjobs WHERE uuid=?", sJobWithoutExecutions), 0, 0, "job without executions");
+        assertIntegerRange(queryInteger(pSQLHandler, "SELECT executioncount FROM buildjobs WHERE uuid=?", sJobWithOneExecution), 1, 1, "job with one execution");
+
+        for (auto sIndexName : { "buildjobs_status_timestamp", "buildjobdata_jobuuid", "buildjobexecutions_jobuuid", "buildjobexecutions_active_starttimestamp" })
+            assertIntegerRange(queryInteger(pSQLHandler, "SELECT COUNT(*) FROM sqlite_master WHERE type='index' AND name=?", sIndexName), 1, 1, "index exists");
+
+        // The handler reads the backfilled column and keeps it up to date
+        auto pHandler = createHandler(pSQLHandler);
+        auto pJob = acquire(pHandler->RetrieveJob(sJobWithExecutions));
+        assertIntegerRange(pJob->GetExecutionCount(), 3, 3, "retrieved execution count");
+
+        auto pEmptyJob = acquire(pHandler->RetrieveJob(sJobWithoutExecutions));
+        acquire(pEmptyJob->CreateBuildJobExecution("", "", m_nBaseTimeStamp));
+        auto pUpdatedJob = acquire(pHandler->RetrieveJob(sJobWithoutExecutions));
+        assertIntegerRange(pUpdatedJob->GetExecutionCount(), 1, 1, "execution count after creating an execution");
+
+        // Migrating again is a no-op
+        migrateToCurrentVersion(pSQLHandler, sMigratedInstallationUUID);
+        assertIntegerRange(queryInteger(pSQLHandler, "SELECT executioncount FROM buildjobs WHERE uuid=?", sJobWithExecutions), 3, 3, "execution count after second migration");
+
+        pSQLHandler = nullptr;
+        deleteDatabases();
+    }
+
+    void test_JobPages() {
+        auto pSQLHandler = createDatabase();
+        std::string sInstallationUUID;
+        migrateToCurrentVersion(pSQLHandler, sInstallationUUID);
+
+        // 29 validated jobs on only four distinct timestamps, interleaved with archived ones
+        for (uint32_t nIndex = 0; nIndex < 29; nIndex++)
+            insertJob(pSQLHandler, AMCCommon::CUtils::createUUID(), "validated", createTimeStamp(nIndex % 4));
+        for (uint32_t nIndex = 0; nIndex < 5; nIndex++)
+            insertJob(pSQLHandler, AMCCommon::CUtils::createUUID(), "archived", createTimeStamp(nIndex % 4));
+
+        auto pHandler = createHandler(pSQLHandler);
+        auto fullList = readJobs(pHandler->ListJobsByStatus(LibMCData::eBuildJobStatus::Validated));
+        assertIntegerRange((int64_t)fullList.size(), 29, 29, "full list");
+        assertOrderedByTimeStampAndUUID(fullList);
+
+        for (uint32_t nPageSize : { 1, 2, 7, 8, 29, 1000 }) {
+            assertPagesMatchFullList(fullList, nPageSize, [&](const std::string& sCursorTimeStamp, const std::string& sCursorUUID) {
+                return readJobs(pHandler->ListJobsByStatusPage(LibMCData::eBuildJobStatus::Validated, sCursorTimeStamp, sCursorUUID, nPageSize));
+            });
+        }
+
+        pHandler = nullptr;
+        pSQLHandler = nullptr;
+        deleteDatabases();
+    }
+
+    void test_ExecutionPages() {
+        auto pSQLHandler = createDatabase();
+        std::string sInstallationUUID;
+        migrateToCurrentVersion(pSQLHandler, sInstallationUUID);
+
+        std::string sJobUUID = AMCCommon::CUtils::createUUID();
+        insertJob(pSQLHandler, sJobUUID, "validated", createTimeStamp(0));
+
+        auto pHandler = createHandler(pSQLHandler);
+        auto pJob = acquire(pHandler->RetrieveJob(sJobUUID));
+
+        // 23 executions on only three distinct start timestamps
+        std::vector<std::string> executionUUIDs;
+        for (uint32_t nIndex = 0; nIndex < 23; nIndex++) {
+            auto pExecution = acquire(pJob->CreateBuildJobExecution("", "", m_nBaseTimeStamp + (nIndex % 3) * 1000000ULL));
+            executionUUIDs.push_back(pExecution->GetExecutionUUID());
+        }
+
+        // Inactive executions must neither be listed nor paged
+        auto pDeactivateStatement = pSQLHandler->prepareStatement("UPDATE buildjobexecutions SET active=0 WHERE uuid=?");
+        pDeactivateStatement->setString(1, executionUUIDs.at(4));
+        pDeactivateStatement->execute();
+        pDeactivateStatement = nullptr;
+
+        auto fullList = readExecutions(pHandler->ListJobExecutions("", "", ""));
+        assertIntegerRange((int64_t)fullList.size(), 22, 22, "full list");
+        assertOrderedByTimeStampAndUUID(fullList);
+
+        for (uint32_t nPageSize : { 1, 3, 11, 22, 1000 }) {
+            assertPagesMatchFullList(fullList, nPageSize, [&](const std::string& sCursorTimeStamp, const std::string& sCursorUUID) {
+                return readExecutions(pHandler->ListJobExecutionsPage("", "", "", sCursorTimeStamp, sCursorUUID, nPageSize));
+            });
+        }
+
+        // Time range filters and cursors combine, the bounds are exclusive
+        std::string sMinTimeStamp = createTimeStamp(0);
+        auto filteredList = readExecutions(pHandler->ListJobExecutions(sMinTimeStamp, "", ""));
+        assertIntegerRange((int64_t)filteredList.size(), 14, 14, "filtered list");
+        assertPagesMatchFullList(filteredList, 4, [&](const std::string& sCursorTimeStamp, const std::string& sCursorUUID) {
+            return readExecutions(pHandler->ListJobExecutionsPage(sMinTimeStamp, "", "", sCursorTimeStamp, sCursorUUID, 4));
+        });
+
+        pJob = nullptr;
+        pHandler = nullptr;
+        pSQLHandler = nullptr;
+        deleteDatabases();
+    }
+
+    void test_InvalidPageArguments() {
+        auto pSQLHandler = createDatabase();
+        std::string sInstallationUUID;
+        migrateToCurrentVersion(pSQLHandler, sInstallationUUID);
+        auto pHandler = createHandler(pSQLHandler);
+
+        auto getErrorCode = [](std::function<void()> call) -> LibMCDataResult {
+            try {
+                call();
+            }
+            catch (ELibMCDataInterfaceException& E) {
+                return E.getErrorCode();
+            }
+            return LIBMCDATA_SUCCESS;
+        };
+
+        std::string sCursorTimeStamp = createTimeStamp(1);
+        std::string sCursorUUID = AMCCommon::CUtils::createUUID();
+
+        assertTrue(getErrorCode([&]() { acquire(pHandler->ListJobsByStatusPage(LibMCData::eBuildJobStatus::Validated, "", "", 0)); }) == LIBMCDATA_ERROR_INVALIDPAGESIZE, "empty job page");
+        assertTrue(getErrorCode([&]() { acquire(pHandler->ListJobsByStatusPage(LibMCData::eBuildJobStatus::Validated, "", "", BUILDJOBHANDLER_MAXPAGESIZE + 1)); }) == LIBMCDATA_ERROR_INVALIDPAGESIZE, "oversized job page");
+        assertTrue(getErrorCode([&]() { acquire(pHandler->ListJobExecutionsPage("", "", "", "", "", 0)); }) == LIBMCDATA_ERROR_INVALIDPAGESIZE, "empty execution page");
+        assertTrue(getErrorCode([&]() { acquire(pHandler->ListJobExecutionsPage("", "", "", "", "", BUILDJOBHANDLER_MAXPAGESIZE + 1)); }) == LIBMCDATA_ERROR_INVALIDPAGESIZE, "oversized execution page");
+
+        assertTrue(getErrorCode([&]() { acquire(pHandler->ListJobsByStatusPage(LibMCData::eBuildJobStatus::Validated, sCursorTimeStamp, "", 10)); }) == LIBMCDATA_ERROR_INVALIDPARAM, "job cursor without uuid");
+        assertTrue(getErrorCode([&]() { acquire(pHandler->ListJobsByStatusPage(LibMCData::eBuildJobStatus::Validated, "", sCursorUUID, 10)); }) == LIBMCDATA_ERROR_INVALIDPARAM, "job cursor without timestamp");
+        assertTrue(getErrorCode([&]() { acquire(pHandler->ListJobExecutionsPage("", "", "", sCursorTimeStamp, "", 10)); }) == LIBMCDATA_ERROR_INVALIDPARAM, "execution cursor without uuid");
+
+        assertTrue(getErrorCode([&]() { acquire(pHandler->ListJobsByStatusPage(LibMCData::eBuildJobStatus::Validated, "", "", BUILDJOBHANDLER_MAXPAGESIZE)); }) == LIBMCDATA_SUCCESS, "maximum page size");
+
+        pHandler = nullptr;
+        pSQLHandler = nullptr;
+        deleteDatabases();
+    }
+
+};
+
+}
+
+#endif // __AMCTEST_UNITTEST_BUILDJOBHANDLER
@@ -0,0 +1,207 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCTEST_UNITTEST_DATASERIESDOWNSAMPLER
+#define __AMCTEST_UNITTEST_DATASERIESDOWNSAMPLER
+
+#include "amc_unittests.hpp"
+#include "amc_dataseriesdownsampler.hpp"
+
+#include <cmath>
+
+
+namespace AMCUnitTest {
+
+
+class CUnitTestGroup_DataSeriesDownsampler : public CUnitTestGroup {
+private:
+
+    // Noisy sine with a few isolated spikes, one entry every 100 microseconds.
+    static AMC::PDataSeries createDataSeries(size_t nEntryCount)
+    {
+        auto pDataSeries = std::make_shared<AMC::CDataSeries>("9c1f3e2a-7b4d-4c5e-8f6a-1b2c3d4e5f60", "test");
+        auto& entries = pDataSeries->getEntries();
+        entries.resize(nEntryCount);
+
+        uint32_t nNoise = 12345;
+        for (size_t nIndex = 0; nIndex < nEntryCount; nIndex++) {
+            nNoise = nNoise * 1103515245 + 12345;
+            entries[nIndex].m_nTimeStampInMicroSeconds = 1000000 + nIndex * 100;
+            entries[nIndex].m_dValue = std::sin((double)nIndex * 0.001) + (double)((nNoise >> 16) % 1000) * 0.0001;
+        }
+
+        entries[nEntryCount / 3].m_dValue = 25.0;
+        entries[nEntryCount / 2].m_dValue = -30.0;
+
+        return pDataSeries;
+    }
+
+public:
+    CUnitTestGroup_DataSeriesDownsampler() = default;
+    virtual ~CUnitTestGroup_DataSeriesDownsampler() = default;
+
+    std::string getTestGroupName() override {
+        return "DataSeriesDownsampler";
+    }
+
+    void initializeTests() override {
+        // Nothing to initialize
+    }
+
+    void registerTests() override {
+        registerTest("MinMaxExtrema", "Min/max downsampling keeps the extrema of every bucket", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_DataSeriesDownsampler::test_MinMaxExtrema, this));
+        registerTest("LTTB", "LTTB keeps end points and spikes within the target count", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_DataSeriesDownsampler::test_LTTB, this));
+        registerTest("TimeRange", "Downsamples only the requested time range", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_DataSeriesDownsampler::test_TimeRange, this));
+        registerTest("Cache", "Caches downsampled entries per series version", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_DataSeriesDownsampler::test_Cache, this));
+    }
+
+private:
+
+    void test_MinMaxExtrema() {
+        auto pDataSeries = createDataSeries(200000);
+        auto& entries = pDataSeries->getEntries();
+        uint64_t nStartTime = pDataSeries->getMinimum();
+        uint64_t nEndTime = pDataSeries->getMaximum();
+        uint32_t nBucketCount = 500;
+
+        std::vector<AMC::sDataSeriesEntry> result;
+        AMC::CDataSeriesDownsampler::downsampleMinMax(entries.data(), entries.size(), nStartTime, nEndTime, nBucketCount, result);
+        assertTrue(result.size() <= nBucketCount * 2, "result size");
+        assertTrue(result.size() >= nBucketCount, "every bucket is represented");
+
+        for (size_t nIndex = 1; nIndex < result.size(); nIndex++)
+            assertTrue(result[nIndex - 1].m_nTimeStampInMicroSeconds < result[nIndex].m_nTimeStampInMicroSeconds, "result is ordered");
+
+        // Recompute the extrema of every bucket and compare
+        double dBucketsPerMicroSecond = (double)nBucketCount / ((double)(nEndTime - nStartTime) + 1.0);
+        std::vector<double> minValues(nBucketCount, 1.0E10);
+        std::vector<double> maxValues(nBucketCount, -1.0E10);
+        for (auto& entry : entries) {
+            size_t nBucket = (size_t)((double)(entry.m_nTimeStampInMicroSeconds - nStartTime) * dBucketsPerMicroSecond);
+            minValues[nBucket] = std::min(minValues[nBucket], entry.m_dValue);
+            maxValues[nBucket] = std::max(maxValues[nBucket], entry.m_dValue);
+        }
+
+        std::vector<double> resultMinValues(nBucketCount, 1.0E10);
+        std::vector<double> resultMaxValues(nBucketCount, -1.0E10);
+        for (auto& entry : result) {
+            size_t nBucket = (size_t)((double)(entry.m_nTimeStampInMicroSeconds - nStartTime) * dBucketsPerMicroSecond);
+            resultMinValues[nBucket] = std::min(resultMinValues[nBucket], entry.m_dValue);
+            resultMaxValues[nBucket] = std::max(resultMaxValues[nBucket], entry.m_dValue);
+        }
+
+        for (uint32_t nBucket = 0; nBucket < nBucketCount; nBucket++) {
+            assertTrue(minValues[nBucket] == resultMinValues[nBucket], "bucket minimum");
+            assertTrue(maxValues[nBucket] == resultMaxValues[nBucket], "bucket maximum");
+        }
+    }
+
+    void test_LTTB() {
+        auto pDataSeries = createDataSeries(200000);
+        auto& entries = pDataSeries->getEntries();
+
+        std::vector<AMC::sDataSeriesEntry> result;
+        AMC::CDataSeriesDownsampler::downsampleLTTB(entries.data(), entries.size(), 1000, result);
+        assertIntegerRange((int64_t)result.size(), 1000, 1000, "target count");
+        assertTrue(result.front().m_nTimeStampInMicroSeconds == entries.front().m_nTimeStampInMicroSeconds, "first entry");
+        assertTrue(result.back().m_nTimeStampInMicroSeconds == entries.back().m_nTimeStampInMicroSeconds, "last entry");
+
+        double dMin = 0.0;
+        double dMax = 0.0;
+        for (size_t nIndex = 0; nIndex < result.size(); nIndex++) {
+            dMin = std::min(dMin, result[nIndex].m_dValue);
+            dMax = std::max(dMax, result[nIndex].m_dValue);
+            if (nIndex > 0)
+                assertTrue(result[nIndex - 1].m_nTimeStampInMicroSeconds < result[nIndex].m_nTimeStampInMicroSeconds, "result is ordered");
+        }
+        assertDoubleRange(dMax, 25.0, 25.0, "positive spike");
+        assertDoubleRange(dMin, -30.0, -30.0, "negative spike");
+
+        AMC::CDataSeriesDownsampler::downsampleLTTB(entries.data(), 10, 1000, result);
+        assertIntegerRange((int64_t)result.size(), 10, 10, "short series are not reduced");
+    }
+
+    void test_TimeRange() {
+        auto pDataSeries = createDataSeries(100000);
+        auto& entries = pDataSeries->getEntries();
+
+        size_t nFirstIndex = 0;
+        size_t nEndIndex = 0;
+        AMC::CDataSeriesDownsampler::findTimeRange(entries, 1000050, 1000300, nFirstIndex, nEndIndex);
+        assertIntegerRange((int64_t)nFirstIndex, 1, 1, "first index");
+        assertIntegerRange((int64_t)nEndIndex, 4, 4, "end index");
+
+        AMC::CDataSeriesDownsampler::findTimeRange(entries, 0, 10, nFirstIndex, nEndIndex);
+        assertIntegerRange((int64_t)(nEndIndex - nFirstIndex), 0, 0, "empty range");
+
+        auto pEntries = pDataSeries->getDownsampledEntries(AMC::eDataSeriesDownsamplingMode::dmMinMax, 2000000, 3000000, 100);
+        assertTrue(pEntries->size() <= 200, "result size");
+        for (auto& entry : *pEntries)
+            assertIntegerRange((int64_t)entry.m_nTimeStampInMicroSeconds, 2000000, 3000000, "entry within range");
+    }
+
+    void test_Cache() {
+        auto pDataSeries = createDataSeries(100000);
+        uint64_t nStartTime = pDataSeries->getMinimum();
+        uint64_t nEndTime = pDataSeries->getMaximum();
+
+        auto pFirst = pDataSeries->getDownsampledEntries(AMC::eDataSeriesDownsamplingMode::dmLTTB, nStartTime, nEndTime, 500);
+        auto pSecond = pDataSeries->getDownsampledEntries(AMC::eDataSeriesDownsamplingMode::dmLTTB, nStartTime, nEndTime, 500);
+        assertTrue(pFirst.get() == pSecond.get(), "cached result");
+
+        pDataSeries->getEntries().at(100).m_dValue = 100.0;
+        pDataSeries->increaseVersion();
+
+        auto pThird = pDataSeries->getDownsampledEntries(AMC::eDataSeriesDownsamplingMode::dmLTTB, nStartTime, nEndTime, 500);
+        assertTrue(pFirst.get() != pThird.get(), "recomputed after version change");
+
+        double dMax = 0.0;
+        for (auto& entry : *pThird)
+            dMax = std::max(dMax, entry.m_dValue);
+        assertDoubleRange(dMax, 100.0, 100.0, "new spike");
+
+        bool bThrown = false;
+        try {
+            pDataSeries->getDownsampledEntries(AMC::eDataSeriesDownsamplingMode::dmLTTB, nStartTime, nEndTime, 0);
+        }
+        catch (...) {
+            bThrown = true;
+        }
+        assertTrue(bThrown, "zero width is rejected");
+    }
+
+};
+
+
+}
+
+
+#endif // __AMCTEST_UNITTEST_DATASERIESDOWNSAMPLER
@@ -0,0 +1,476 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCTEST_UNITTEST_DATATABLE
+#define __AMCTEST_UNITTEST_DATATABLE
+
+#include "amc_unittests.hpp"
+#include "libmcenv_datatable.hpp"
+#include "libmcenv_datatablewriteoptions.hpp"
+#include "libmcenv_datatablecsvwriteoptions.hpp"
+#include "libmcenv_interfaceexception.hpp"
+#include "libmcdata_interfaces.hpp"
+#include "amc_toolpathhandler.hpp"
+
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+
+namespace AMCUnitTest {
+
+
+// Collects the written data in memory.
+class CUnitTestDataTableMemoryWriter : public virtual LibMCEnv::Impl::ITempStreamWriter, public virtual LibMCEnv::Impl::CBase {
+private:
+    std::vector<uint8_t> m_Buffer;
+    uint64_t m_nWritePosition;
+
+public:
+    CUnitTestDataTableMemoryWriter()
+        : m_nWritePosition(0)
+    {
+    }
+
+    std::string GetUUID() override { return "00000000-0000-0000-0000-000000000000"; }
+    std::string GetName() override { return "datatable"; }
+    std::string GetMIMEType() override { return "application/octet-stream"; }
+    LibMCEnv_uint64 GetSize() override { return m_Buffer.size(); }
+    void Finish() override { }
+    bool IsFinished() override { return false; }
+
+    LibMCEnv::Impl::IStreamReader* GetStreamReader() override
+    {
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_NOTIMPLEMENTED);
+    }
+
+    LibMCEnv_uint64 GetWritePosition() override { return m_nWritePosition; }
+
+    void Seek(const LibMCEnv_uint64 nWritePosition) override
+    {
+        if (nWritePosition > m_Buffer.size())
+            throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDSTREAMSEEKPOSITION);
+        m_nWritePosition = nWritePosition;
+    }
+
+    void WriteData(const LibMCEnv_uint64 nDataBufferSize, const LibMCEnv_uint8* pDataBuffer) override
+    {
+        if (m_nWritePosition + nDataBufferSize > m_Buffer.size())
+            m_Buffer.resize((size_t)(m_nWritePosition + nDataBufferSize));
+        memcpy(m_Buffer.data() + m_nWritePosition, pDataBuffer, (size_t)nDataBufferSize);
+        m_nWritePosition += nDataBufferSize;
+    }
+
+    void WriteString(const std::string& sData) override
+    {
+        if (!sData.empty())
+            WriteData(sData.length(), (const uint8_t*)sData.c_str());
+    }
+
+    void WriteLine(const std::string& sLine) override
+    {
+        WriteString(sLine + "\n");
+    }
+
+    void CopyFrom(LibMCEnv::Impl::IStreamReader* pStreamReader) override
+    {
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_NOTIMPLEMENTED);
+    }
+
+    std::vector<uint8_t>& getBuffer()
+    {
+        return m_Buffer;
+    }
+
+    std::string getString()
+    {
+        return std::string(m_Buffer.begin(), m_Buffer.end());
+    }
+};
+
+
+// Reads from memory with the same bounds checks as the storage stream reader.
+class CUnitTestDataTableMemoryReader : public virtual LibMCEnv::Impl::IStreamReader, public virtual LibMCEnv::Impl::CBase {
+private:
+    std::vector<uint8_t> m_Buffer;
+    uint64_t m_nReadPosition;
+
+public:
+    CUnitTestDataTableMemoryReader(const std::vector<uint8_t>& buffer)
+        : m_Buffer(buffer), m_nReadPosition(0)
+    {
+    }
+
+    std::string GetUUID() override { return "00000000-0000-0000-0000-000000000000"; }
+    std::string GetName() override { return "datatable"; }
+    std::string GetMIMEType() override { return "application/octet-stream"; }
+    LibMCEnv_uint64 GetSize() override { return m_Buffer.size(); }
+    LibMCEnv_uint64 GetReadPosition() override { return m_nReadPosition; }
+
+    void Seek(const LibMCEnv_uint64 nReadPosition) override
+    {
+        if (nReadPosition > m_Buffer.size())
+            throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDSTREAMSEEKPOSITION);
+        m_nReadPosition = nReadPosition;
+    }
+
+    void ReadData(const LibMCEnv_uint64 nSizeToRead, LibMCEnv_uint64 nDataBufferSize, LibMCEnv_uint64* pDataNeededCount, LibMCEnv_uint8* pDataBuffer) override
+    {
+        if ((nSizeToRead == 0) || (nSizeToRead > m_Buffer.size() - m_nReadPosition))
+            throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_STREAMREADEXCEEDSSTREAMSIZE);
+        if (pDataNeededCount != nullptr)
+            *pDataNeededCount = nSizeToRead;
+        if (pDataBuffer != nullptr) {
+            if (nSizeToRead > nDataBufferSize)
+                throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
+            memcpy(pDataBuffer, m_Buffer.data() + m_nReadPosition, (size_t)nSizeToRead);
+            m_nReadPosition += nSizeToRead;
+        }
+    }
+
+    void ReadAllData(LibMCEnv_uint64 nDataBufferSize, LibMCEnv_uint64* pDataNeededCount, LibMCEnv_uint8* pDataBuffer) override
+    {
+        m_nReadPosition = 0;
+        ReadData(m_Buffer.size(), nDataBufferSize, pDataNeededCount, pDataBuffer);
+    }
+};
+
+
+class CUnitTestGroup_DataTable : public CUnitTestGroup {
+private:
+
+    // Data tables only need the toolpath handler for scatter plots, which are not tested here
+    LibMCData::PWrapper m_pDataWrapper;
+    AMC::PToolpathHandler m_pToolpathHandler;
+
+    // Offsets in the packed stream layout of libmcenv_datatable.cpp
+    static const size_t m_nStreamHeaderSize = 52;
+    static const size_t m_nColumnHeaderSize = 80;
+    static const size_t m_nEncodedDataSizeOffset = 48;
+
+    static std::vector<std::string> splitLines(const std::string& sText)
+    {
+        std::vector<std::string> lines;
+        std::stringstream textStream(sText);
+        std::string sLine;
+        while (std::getline(textStream, sLine))
+            lines.push_back(sLine);
+        return lines;
+    }
+
+    static std::string writeCSV(LibMCEnv::Impl::CDataTable& dataTable, const std::string& sSeparator, bool bRoundTripDoubles)
+    {
+        LibMCEnv::Impl::CDataTableCSVWriteOptions options;
+        options.SetSeparator(sSeparator);
+        options.SetRoundTripDoubles(bRoundTripDoubles);
+
+        CUnitTestDataTableMemoryWriter writer;
+        dataTable.WriteCSVToStream(&writer, &options);
+        return writer.getString();
+    }
+
+    static std::vector<uint8_t> writeData(LibMCEnv::Impl::CDataTable& dataTable, bool bCompressColumns)
+    {
+        LibMCEnv::Impl::CDataTableWriteOptions options;
+        options.SetCompressColumns(bCompressColumns);
+
+        CUnitTestDataTableMemoryWriter writer;
+        dataTable.WriteDataToStream(&writer, &options);
+        return writer.getBuffer();
+    }
+
+    bool loadDataThrows(const std::vector<uint8_t>& buffer)
+    {
+        LibMCEnv::Impl::CDataTable dataTable(m_pToolpathHandler);
+        CUnitTestDataTableMemoryReader reader(buffer);
+        try {
+            dataTable.LoadFromStream(&reader);
+        }
+        catch (ELibMCEnvInterfaceException&) {
+            return true;
+        }
+        return false;
+    }
+
+    template <typename T> static std::vector<T> createRows(size_t nRowCount, int64_t nStart, int64_t nStep)
+    {
+        std::vector<T> rows(nRowCount);
+        for (size_t nIndex = 0; nIndex < nRowCount; nIndex++)
+            rows[nIndex] = (T)(nStart + (int64_t)nIndex * nStep + (int64_t)(nIndex % 3));
+        return rows;
+    }
+
+    // Fills one column of every type. Slowly changing integers are the case the delta encoding is made for.
+    static void fillAllColumnTypes(LibMCEnv::Impl::CDataTable& dataTable, size_t nRowCount)
+    {
+        dataTable.AddColumn("double", "Double", LibMCEnv::eDataTableColumnType::DoubleColumn);
+        dataTable.AddColumn("int32", "Int32", LibMCEnv::eDataTableColumnType::Int32Column);
+        dataTable.AddColumn("uint32", "Uint32", LibMCEnv::eDataTableColumnType::Uint32Column);
+        dataTable.AddColumn("int64", "Int64", LibMCEnv::eDataTableColumnType::Int64Column);
+        dataTable.AddColumn("uint64", "Uint64", LibMCEnv::eDataTableColumnType::Uint64Column);
+
+        std::vector<double> doubleRows(nRowCount);
+        for (size_t nIndex = 0; nIndex < nRowCount; nIndex++)
+            doubleRows[nIndex] = sin((double)nIndex * 0.01) * 1000.0;
+
+        auto int32Rows = createRows<int32_t>(nRowCount, -1000, 7);
+        auto uint32Rows = createRows<uint32_t>(nRowCount, 0xFFFF0000, 1);
+        auto int64Rows = createRows<int64_t>(nRowCount, std::numeric_limits<int64_t>::min() + 1000, 1LL << 32);
+        auto uint64Rows = createRows<uint64_t>(nRowCount, 1700000000000000LL, 1000);
+
+        dataTable.SetDoubleColumnValues("double", doubleRows.size(), doubleRows.data());
+        dataTable.SetInt32ColumnValues("int32", int32Rows.size(), int32Rows.data());
+        dataTable.SetUint32ColumnValues("uint32", uint32Rows.size(), uint32Rows.data());
+        dataTable.SetInt64ColumnValues("int64", int64Rows.size(), int64Rows.data());
+        dataTable.SetUint64ColumnValues("uint64", uint64Rows.size(), uint64Rows.data());
+    }
+
+    void assertTablesEqual(LibMCEnv::Impl::CDataTable& expectedTable, LibMCEnv::Impl::CDataTable& dataTable)
+    {
+        assertIntegerRange(dataTable.GetColumnCount(), expectedTable.GetColumnCount(), expectedTable.GetColumnCount(), "column count");
+        assertIntegerRange(dataTable.GetRowCount(), expectedTable.GetRowCount(), expectedTable.GetRowCount(), "row count");
+
+        for (uint32_t nColumnIndex = 0; nColumnIndex < expectedTable.GetColumnCount(); nColumnIndex++) {
+            std::string sIdentifier = expectedTable.GetColumnIdentifier(nColumnIndex);
+            assertTrue(dataTable.GetColumnIdentifier(nColumnIndex) == sIdentifier, "column identifier");
+            assertTrue(dataTable.GetColumnDescription(nColumnIndex) == expectedTable.GetColumnDescription(nColumnIndex), "column description");
+            assertTrue(dataTable.GetColumnType(nColumnIndex) == expectedTable.GetColumnType(nColumnIndex), "column type");
+
+            // All column types are 8 bytes or less, so the values are compared as raw bytes
+            std::vector<uint64_t> expectedValues(expectedTable.GetRowCount());
+            std::vector<uint64_t> values(dataTable.GetRowCount());
+            switch (expectedTable.GetColumnType(nColumnIndex)) {
+            case LibMCEnv::eDataTableColumnType::DoubleColumn:
+                expectedTable.GetDoubleColumnValues(sIdentifier, expectedValues.size(), nullptr, (double*)expectedValues.data());
+                dataTable.GetDoubleColumnValues(sIdentifier, values.size(), nullptr, (double*)values.data());
+                break;
+            case LibMCEnv::eDataTableColumnType::Int32Column:
+                expectedTable.GetInt32ColumnValues(sIdentifier, expectedValues.size(), nullptr, (int32_t*)expectedValues.data());
+                dataTable.GetInt32ColumnValues(sIdentifier, values.size(), nullptr, (int32_t*)values.data());
+                break;
+            case LibMCEnv::eDataTableColumnType::Uint32Column:
+                expectedTable.GetUint32ColumnValues(sIdentifier, expectedValues.size(), nullptr, (uint32_t*)expectedValues.data());
+                dataTable.GetUint32ColumnValues(sIdentifier, values.size(), nullptr, (uint32_t*)values.data());
+                break;
+            case LibMCEnv::eDataTableColumnType::Int64Column:
+                expectedTable.GetInt64ColumnValues(sIdentifier, expectedValues.size(), nullptr, (int64_t*)expectedValues.data());
+                dataTable.GetInt64ColumnValues(sIdentifier, values.size(), nullptr, (int64_t*)values.data());
+                break;
+            case LibMCEnv::eDataTableColumnType::Uint64Column:
+                expectedTable.GetUint64ColumnValues(sIdentifier, expectedValues.size(), nullptr, (uint64_t*)expectedValues.data());
+                dataTable.GetUint64ColumnValues(sIdentifier, values.size(), nullptr, (uint64_t*)values.data());
+                break;
+            default:
+                assertTrue(false, "unknown column type");
+            }
+
+            assertTrue(values == expectedValues, "values of column " + sIdentifier);
+        }
+    }
+
+public:
+    CUnitTestGroup_DataTable() = default;
+    virtual ~CUnitTestGroup_DataTable() = default;
+
+    std::string getTestGroupName() override {
+        return "DataTable";
+    }
+
+    void initializeTests() override {
+        m_pDataWrapper = LibMCData::CWrapper::loadLibraryFromSymbolLookupMethod((void*)&LibMCData::Impl::LibMCData_GetProcAddress);
+        m_pToolpathHandler = std::make_shared<AMC::CToolpathHandler>(m_pDataWrapper->CreateDataModelInstance());
+    }
+
+    void registerTests() override {
+        registerTest("CSVOutput", "Writes header, quantized doubles, integers and missing rows as CSV", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_DataTable::test_CSVOutput, this));
+        registerTest("CSVRoundTripDoubles", "Doubles written for round trip parse back to the identical value", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_DataTable::test_CSVRoundTripDoubles, this));
+        registerTest("CSVManyRows", "Rows that are split across several worker blocks stay in order", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_DataTable::test_CSVManyRows, this));
+        registerTest("ColumnRoundTrip", "Round trips all column types raw, LZ4 and delta LZ4 encoded", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_DataTable::test_ColumnRoundTrip, this));
+        registerTest("CorruptStream", "Rejects truncated streams and invalid encoded column sizes", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_DataTable::test_CorruptStream, this));
+    }
+
+private:
+
+    void test_CSVOutput() {
+        LibMCEnv::Impl::CDataTable dataTable(m_pToolpathHandler);
+        dataTable.AddColumn("x", "X", LibMCEnv::eDataTableColumnType::DoubleColumn);
+        dataTable.AddColumn("n", "N", LibMCEnv::eDataTableColumnType::Uint32Column);
+
+        std::vector<double> xValues = { 1.5, -0.0004, 2.0005, 123.25 };
+        std::vector<uint32_t> nValues = { 7, 0, 4294967295 };
+        dataTable.SetDoubleColumnValues("x", xValues.size(), xValues.data());
+        dataTable.SetUint32ColumnValues("n", nValues.size(), nValues.data());
+
+        // Doubles are rounded to three digits, rows beyond the end of a column are written as 0
+        std::string sCSV = writeCSV(dataTable, ";", false);
+        assertTrue(sCSV == "X;N\n1.500;7\n-0.000;0\n2.001;4294967295\n123.250;0\n", "default CSV output");
+
+        std::string sCommaCSV = writeCSV(dataTable, ",", false);
+        assertTrue(sCommaCSV == "X,N\n1.500,7\n-0.000,0\n2.001,4294967295\n123.250,0\n", "custom separator");
+
+        auto writeCSVThrows = [&dataTable](const std::string& sSeparator) {
+            try {
+                writeCSV(dataTable, sSeparator, false);
+            }
+            catch (ELibMCEnvInterfaceException&) {
+                return true;
+            }
+            return false;
+        };
+        assertTrue(writeCSVThrows(""), "empty separator");
+        assertTrue(writeCSVThrows(";;"), "separator with more than one character");
+        assertTrue(writeCSVThrows("\t"), "control character separator");
+
+        LibMCEnv::Impl::CDataTable emptyTable(m_pToolpathHandler);
+        emptyTable.AddColumn("a", "A", LibMCEnv::eDataTableColumnType::Int64Column);
+        assertTrue(writeCSV(emptyTable, ";", false) == "A\n", "table without rows");
+    }
+
+    void test_CSVRoundTripDoubles() {
+        std::vector<double> values = { 0.1, 1.0 / 3.0, -2.0 / 7.0, 1.0E-300, -1.0E300, 123456789.123456789, 0.0, 4.9E-324, std::numeric_limits<double>::max() };
+
+        LibMCEnv::Impl::CDataTable dataTable(m_pToolpathHandler);
+        dataTable.AddColumn("x", "X", LibMCEnv::eDataTableColumnType::DoubleColumn);
+        dataTable.SetDoubleColumnValues("x", values.size(), values.data());
+
+        auto lines = splitLines(writeCSV(dataTable, ";", true));
+        assertIntegerRange((int64_t)lines.size(), (int64_t)values.size() + 1, (int64_t)values.size() + 1, "line count");
+        assertTrue(lines.at(0) == "X", "header");
+
+        for (size_t nIndex = 0; nIndex < values.size(); nIndex++) {
+            double dParsedValue = strtod(lines.at(nIndex + 1).c_str(), nullptr);
+            assertTrue(memcmp(&dParsedValue, &values.at(nIndex), sizeof(double)) == 0, "round trip of " + lines.at(nIndex + 1));
+        }
+
+        // Without round trip, the same values are quantized
+        auto quantizedLines = splitLines(writeCSV(dataTable, ";", false));
+        assertTrue(quantizedLines.at(1) == "0.100", "quantized value");
+        assertTrue(quantizedLines.at(2) == "0.333", "quantized value");
+    }
+
+    void test_CSVManyRows() {
+        // More rows than fit into a single worker buffer
+        size_t nRowCount = 200000;
+        std::vector<uint64_t> indexValues(nRowCount);
+        std::vector<int32_t> signedValues(nRowCount);
+        for (size_t nIndex = 0; nIndex < nRowCount; nIndex++) {
+            indexValues[nIndex] = nIndex;
+            signedValues[nIndex] = (int32_t)nIndex - 100000;
+        }
+
+        LibMCEnv::Impl::CDataTable dataTable(m_pToolpathHandler);
+        dataTable.AddColumn("index", "Index", LibMCEnv::eDataTableColumnType::Uint64Column);
+        dataTable.AddColumn("signed", "Signed", LibMCEnv::eDataTableColumnType::Int32Column);
+        dataTable.SetUint64ColumnValues("index", indexValues.size(), indexValues.data());
+        dataTable.SetInt32ColumnValues("signed", signedValues.size(), signedValues.data());
+
+        auto lines = splitLines(writeCSV(dataTable, ";", false));
+        assertIntegerRange((int64_t)lines.size(), (int64_t)nRowCount + 1, (int64_t)nRowCount + 1, "line count");
+
+        bool bRowsAreInOrder = true;
+        for (size_t nIndex = 0; nIndex < nRowCount; nIndex++) {
+            std::string sExpectedLine = std::to_string(nIndex) + ";" + std::to_string((int32_t)nIndex - 100000);
+            if (lines.at(nIndex + 1) != sExpectedLine) {
+                bRowsAreInOrder = false;
+                break;
+            }
+        }
+        assertTrue(bRowsAreInOrder, "rows are in order");
+    }
+
+    void test_ColumnRoundTrip() {
+        for (size_t nRowCount : { (size_t)0, (size_t)1, (size_t)5000 }) {
+            LibMCEnv::Impl::CDataTable dataTable(m_pToolpathHandler);
+            fillAllColumnTypes(dataTable, nRowCount);
+
+            // More columns than workers, with different row counts
+            for (uint32_t nColumnIndex = 0; nColumnIndex < 70; nColumnIndex++) {
+                std::string sIdentifier = "extra" + std::to_string(nColumnIndex);
+                auto extraRows = createRows<int64_t>(nRowCount + nColumnIndex, nColumnIndex, nColumnIndex);
+                dataTable.AddColumn(sIdentifier, "Extra " + std::to_string(nColumnIndex), LibMCEnv::eDataTableColumnType::Int64Column);
+                dataTable.SetInt64ColumnValues(sIdentifier, extraRows.size(), extraRows.data());
+            }
+
+            auto rawBuffer = writeData(dataTable, false);
+            auto compressedBuffer = writeData(dataTable, true);
+            if (nRowCount > 1)
+                assertTrue(compressedBuffer.size() < rawBuffer.size() / 2, "compressed stream is smaller");
+
+            for (auto* pBuffer : { &rawBuffer, &compressedBuffer }) {
+                LibMCEnv::Impl::CDataTable loadedTable(m_pToolpathHandler);
+                CUnitTestDataTableMemoryReader reader(*pBuffer);
+                loadedTable.LoadFromStream(&reader);
+                assertTablesEqual(dataTable, loadedTable);
+            }
+        }
+    }
+
+    void test_CorruptStream() {
+        LibMCEnv::Impl::CDataTable dataTable(m_pToolpathHandler);
+        fillAllColumnTypes(dataTable, 1000);
+        auto compressedBuffer = writeData(dataTable, true);
+        auto rawBuffer = writeData(dataTable, false);
+
+        assertFalse(loadDataThrows(compressedBuffer), "valid stream");
+
+        std::vector<uint8_t> truncatedBuffer(compressedBuffer.begin(), compressedBuffer.end() - 1);
+        assertTrue(loadDataThrows(truncatedBuffer), "truncated compressed stream");
+        std::vector<uint8_t> truncatedRawBuffer(rawBuffer.begin(), rawBuffer.end() - 1);
+        assertTrue(loadDataThrows(truncatedRawBuffer), "truncated raw stream");
+
+        std::vector<uint8_t> wrongSignatureBuffer = compressedBuffer;
+        wrongSignatureBuffer[0] ^= 0xFF;
+        assertTrue(loadDataThrows(wrongSignatureBuffer), "unknown signature");
+
+        // An encoded size beyond the LZ4 bound or the stream size is rejected before anything is allocated
+        for (uint64_t nEncodedDataSize : std::vector<uint64_t>({ 0xFFFFFFFFFFFFFFFFULL, 1ULL << 40, (uint64_t)compressedBuffer.size() })) {
+            std::vector<uint8_t> invalidSizeBuffer = compressedBuffer;
+            memcpy(invalidSizeBuffer.data() + m_nStreamHeaderSize + m_nEncodedDataSizeOffset, &nEncodedDataSize, sizeof(nEncodedDataSize));
+            assertTrue(loadDataThrows(invalidSizeBuffer), "invalid encoded size " + std::to_string(nEncodedDataSize));
+        }
+
+        // The encoded data of the last column must not reach past the stream
+        uint64_t nLastEncodedDataSize = 0;
+        size_t nLastHeaderStart = m_nStreamHeaderSize + (dataTable.GetColumnCount() - 1) * m_nColumnHeaderSize;
+        memcpy(&nLastEncodedDataSize, compressedBuffer.data() + nLastHeaderStart + m_nEncodedDataSizeOffset, sizeof(nLastEncodedDataSize));
+        nLastEncodedDataSize++;
+        std::vector<uint8_t> overlongBuffer = compressedBuffer;
+        memcpy(overlongBuffer.data() + nLastHeaderStart + m_nEncodedDataSizeOffset, &nLastEncodedDataSize, sizeof(nLastEncodedDataSize));
+        assertTrue(loadDataThrows(overlongBuffer), "encoded column exceeds stream");
+    }
+
+};
+
+}
+
+#endif // __AMCTEST_UNITTEST_DATATABLE
@@ -0,0 +1,177 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCTEST_UNITTEST_DEPENDENCYTASKRUNNER
+#define __AMCTEST_UNITTEST_DEPENDENCYTASKRUNNER
+
+#include "amc_unittests.hpp"
+#include "amc_dependencytaskrunner.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <stdexcept>
+
+
+namespace AMCUnitTest {
+
+
+class CUnitTestGroup_DependencyTaskRunner : public CUnitTestGroup {
+public:
+    CUnitTestGroup_DependencyTaskRunner() = default;
+    virtual ~CUnitTestGroup_DependencyTaskRunner() = default;
+
+    std::string getTestGroupName() override {
+        return "DependencyTaskRunner";
+    }
+
+    void initializeTests() override {
+        // Nothing to initialize
+    }
+
+    void registerTests() override {
+        registerTest("DependencyOrder", "Starts tasks only after their dependencies", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_DependencyTaskRunner::test_DependencyOrder, this));
+        registerTest("FailedDependency", "Skips dependents of failed tasks", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_DependencyTaskRunner::test_FailedDependency, this));
+        registerTest("UnknownDependency", "Rejects dependencies on unknown tasks", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_DependencyTaskRunner::test_UnknownDependency, this));
+        registerTest("CyclicDependency", "Rejects cyclic dependencies", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_DependencyTaskRunner::test_CyclicDependency, this));
+        registerTest("IndependentTasksOverlap", "Executes independent tasks in parallel", eUnitTestCategory::utOptionalPass, std::bind(&CUnitTestGroup_DependencyTaskRunner::test_IndependentTasksOverlap, this));
+    }
+
+private:
+
+    void test_DependencyOrder() {
+        AMC::CDependencyTaskRunner runner;
+
+        std::mutex orderMutex;
+        std::vector<std::string> order;
+        auto recordTask = [&orderMutex, &order](const std::string& sName) {
+            return [&orderMutex, &order, sName]() {
+                std::lock_guard<std::mutex> lockGuard(orderMutex);
+                order.push_back(sName);
+            };
+        };
+
+        // Added in reverse order on purpose
+        runner.addTask("d", { "b", "c" }, recordTask("d"));
+        runner.addTask("c", { "a" }, recordTask("c"));
+        runner.addTask("b", { "a" }, recordTask("b"));
+        runner.addTask("a", {}, recordTask("a"));
+        assertIntegerRange(runner.getTaskCount(), 4, 4, "task count");
+
+        runner.run(4);
+
+        assertIntegerRange((int64_t)order.size(), 4, 4, "executed tasks");
+        assertTrue(order.front() == "a", "first task");
+        assertTrue(order.back() == "d", "last task");
+        for (auto sName : { "a", "b", "c", "d" })
+            assertTrue(runner.getTaskState(sName) == AMC::eDependencyTaskState::Succeeded, "task state");
+    }
+
+    void test_FailedDependency() {
+        AMC::CDependencyTaskRunner runner;
+
+        std::atomic<uint32_t> nExecutionCount(0);
+        runner.addTask("failing", {}, []() { throw std::runtime_error("library not found"); });
+        runner.addTask("dependent", { "failing" }, [&nExecutionCount]() { nExecutionCount++; });
+        runner.addTask("indirect", { "dependent" }, [&nExecutionCount]() { nExecutionCount++; });
+        runner.addTask("independent", {}, [&nExecutionCount]() { nExecutionCount++; });
+
+        runner.run(2);
+
+        assertIntegerRange(nExecutionCount, 1, 1, "executed tasks");
+        assertTrue(runner.getTaskState("failing") == AMC::eDependencyTaskState::Failed, "failing state");
+        assertTrue(runner.getTaskErrorMessage("failing") == "library not found", "failing message");
+        assertTrue(runner.getTaskState("dependent") == AMC::eDependencyTaskState::Skipped, "dependent state");
+        assertTrue(runner.getTaskState("indirect") == AMC::eDependencyTaskState::Skipped, "indirect state");
+        assertFalse(runner.getTaskErrorMessage("indirect").empty(), "indirect message");
+        assertTrue(runner.getTaskState("independent") == AMC::eDependencyTaskState::Succeeded, "independent state");
+    }
+
+    void test_UnknownDependency() {
+        AMC::CDependencyTaskRunner runner;
+        runner.addTask("a", { "missing" }, []() {});
+
+        bool bThrown = false;
+        try {
+            runner.run(1);
+        }
+        catch (...) {
+            bThrown = true;
+        }
+        assertTrue(bThrown, "unknown dependency");
+        assertTrue(runner.getTaskState("a") == AMC::eDependencyTaskState::Pending, "task has not been executed");
+    }
+
+    void test_CyclicDependency() {
+        AMC::CDependencyTaskRunner runner;
+        runner.addTask("root", {}, []() {});
+        runner.addTask("a", { "root", "c" }, []() {});
+        runner.addTask("b", { "a" }, []() {});
+        runner.addTask("c", { "b" }, []() {});
+
+        bool bThrown = false;
+        try {
+            runner.run(1);
+        }
+        catch (...) {
+            bThrown = true;
+        }
+        assertTrue(bThrown, "cyclic dependency");
+        assertTrue(runner.getTaskState("root") == AMC::eDependencyTaskState::Pending, "task has not been executed");
+    }
+
+    void test_IndependentTasksOverlap() {
+        AMC::CDependencyTaskRunner runner;
+
+        std::atomic<uint32_t> nActiveTasks(0);
+        std::atomic<uint32_t> nMaxActiveTasks(0);
+        for (uint32_t nIndex = 0; nIndex < 8; nIndex++) {
+            runner.addTask("task" + std::to_string(nIndex), {}, [&nActiveTasks, &nMaxActiveTasks]() {
+                uint32_t nActive = ++nActiveTasks;
+                uint32_t nMaxActive = nMaxActiveTasks;
+                while ((nActive > nMaxActive) && !nMaxActiveTasks.compare_exchange_weak(nMaxActive, nActive)) {
+                }
+
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                nActiveTasks--;
+            });
+        }
+
+        runner.run(4);
+
+        assertIntegerRange(nMaxActiveTasks, 2, 4, "parallel tasks");
+    }
+
+};
+
+}
+
+#endif // __AMCTEST_UNITTEST_DEPENDENCYTASKRUNNER
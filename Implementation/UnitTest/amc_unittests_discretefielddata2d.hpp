@@ -0,0 +1,362 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCTEST_UNITTEST_DISCRETEFIELDDATA2D
+#define __AMCTEST_UNITTEST_DISCRETEFIELDDATA2D
+
+#include "amc_unittests.hpp"
+#include "amc_discretefielddata2d.hpp"
+
+#include <vector>
+#include <cmath>
+#include <random>
+
+
+namespace AMCUnitTest {
+
+
+class CUnitTestGroup_DiscreteFieldData2D : public CUnitTestGroup {
+private:
+
+    static const uint32_t m_nSizeX = 517;
+    static const uint32_t m_nSizeY = 383;
+
+    // Field with smooth values and a few outliers. The size is not a multiple of any vector width.
+    static AMC::PDiscreteFieldData2DInstance createField(bool bSinglePrecision, uint32_t nSeed)
+    {
+        auto pField = std::make_shared<AMC::CDiscreteFieldData2DInstance>(m_nSizeX, m_nSizeY, 254.0, 254.0, 10.0, 20.0, 0.0, true);
+
+        std::mt19937 generator(nSeed);
+        std::uniform_real_distribution<double> noiseDistribution(-1.0, 1.0);
+        for (uint32_t nY = 0; nY < m_nSizeY; nY++)
+            for (uint32_t nX = 0; nX < m_nSizeX; nX++)
+                pField->SetPixel(nX, nY, 100.0 * std::sin(nX * 0.01) * std::cos(nY * 0.02) + noiseDistribution(generator));
+
+        pField->SetPixel(3, 4, 1.0E6);
+        pField->SetPixel(100, 200, -1.0E6);
+        pField->setSinglePrecision(bSinglePrecision);
+        return pField;
+    }
+
+    static std::vector<double> getValues(AMC::PDiscreteFieldData2DInstance pField)
+    {
+        uint32_t nSizeX, nSizeY;
+        pField->GetSizeInPixels(nSizeX, nSizeY);
+
+        std::vector<double> values;
+        values.reserve((size_t)nSizeX * nSizeY);
+        for (uint32_t nY = 0; nY < nSizeY; nY++)
+            for (uint32_t nX = 0; nX < nSizeX; nX++)
+                values.push_back(pField->GetPixel(nX, nY));
+        return values;
+    }
+
+    // Double fields must match exactly, single precision fields within float rounding.
+    void assertValuesMatch(const std::vector<double>& values, const std::vector<double>& expectedValues, bool bSinglePrecision, const std::string& sContext)
+    {
+        assertIntegerRange(values.size(), expectedValues.size(), expectedValues.size(), sContext + ": value count");
+        for (size_t nIndex = 0; nIndex < values.size(); nIndex++) {
+            double dExpected = expectedValues[nIndex];
+            double dTolerance = bSinglePrecision ? (std::abs(dExpected) * 1.0E-6 + 1.0E-5) : 0.0;
+            if (std::abs(values[nIndex] - dExpected) > dTolerance)
+                assertDoubleRange(values[nIndex], dExpected - dTolerance, dExpected + dTolerance, sContext + ": value #" + std::to_string(nIndex));
+        }
+    }
+
+public:
+    CUnitTestGroup_DiscreteFieldData2D() = default;
+    virtual ~CUnitTestGroup_DiscreteFieldData2D() = default;
+
+    std::string getTestGroupName() override {
+        return "DiscreteFieldData2D";
+    }
+
+    void initializeTests() override {
+        // Nothing to initialize
+    }
+
+    void registerTests() override {
+        registerTest("ValueOperations", "Clamp, TransformField and AddField match a scalar reference", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_DiscreteFieldData2D::test_ValueOperations, this));
+        registerTest("ScaleField", "ScaleFieldDown averages blocks and ScaleFieldUp replicates pixels", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_DiscreteFieldData2D::test_ScaleField, this));
+        registerTest("DiscretizeWithMapping", "Maps every value to the nearest discrete value", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_DiscreteFieldData2D::test_DiscretizeWithMapping, this));
+        registerTest("RenderRGBImage", "Renders the color scale of a scalar reference", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_DiscreteFieldData2D::test_RenderRGBImage, this));
+        registerTest("RenderAveragePointValues", "Averages point values per pixel like a sequential reference", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_DiscreteFieldData2D::test_RenderAveragePointValues, this));
+        registerTest("SinglePrecisionStorage", "Converts and serializes single precision fields", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_DiscreteFieldData2D::test_SinglePrecisionStorage, this));
+    }
+
+private:
+
+    void test_ValueOperations() {
+        for (bool bSinglePrecision : { false, true }) {
+            std::string sPrecision = bSinglePrecision ? "float" : "double";
+            auto pField = createField(bSinglePrecision, 1);
+            auto values = getValues(pField);
+
+            pField->Clamp(-50.0, 75.5);
+            for (auto& dValue : values)
+                dValue = std::min(std::max(dValue, -50.0), 75.5);
+            assertValuesMatch(getValues(pField), values, bSinglePrecision, sPrecision + " clamp");
+
+            pField->TransformField(1.7, -3.25);
+            for (auto& dValue : values)
+                dValue = (dValue * 1.7) + -3.25;
+            assertValuesMatch(getValues(pField), values, bSinglePrecision, sPrecision + " transform");
+
+            for (bool bOtherSinglePrecision : { false, true }) {
+                auto pOtherField = createField(bOtherSinglePrecision, 2);
+                auto otherValues = getValues(pOtherField);
+                pField->AddField(pOtherField.get(), 0.5, 2.0);
+                for (size_t nIndex = 0; nIndex < values.size(); nIndex++)
+                    values[nIndex] += (otherValues[nIndex] * 0.5) + 2.0;
+                assertValuesMatch(getValues(pField), values, bSinglePrecision, sPrecision + " add");
+            }
+        }
+    }
+
+    void test_ScaleField() {
+        for (bool bSinglePrecision : { false, true }) {
+            std::string sPrecision = bSinglePrecision ? "float" : "double";
+            auto pField = createField(bSinglePrecision, 3);
+            auto values = getValues(pField);
+
+            auto pSmallField = pField->ScaleFieldDown(4, 3);
+            uint32_t nSmallSizeX, nSmallSizeY;
+            pSmallField->GetSizeInPixels(nSmallSizeX, nSmallSizeY);
+            assertIntegerRange(nSmallSizeX, (m_nSizeX + 3) / 4, (m_nSizeX + 3) / 4, "scaled down size X");
+            assertIntegerRange(nSmallSizeY, (m_nSizeY + 2) / 3, (m_nSizeY + 2) / 3, "scaled down size Y");
+            assertTrue(pSmallField->isSinglePrecision() == bSinglePrecision, "scaled down precision");
+
+            std::vector<double> expectedValues;
+            for (uint32_t nY = 0; nY < nSmallSizeY; nY++) {
+                for (uint32_t nX = 0; nX < nSmallSizeX; nX++) {
+                    double dSum = 0.0;
+                    uint32_t nCount = 0;
+                    for (uint32_t nSourceY = nY * 3; nSourceY < std::min(nY * 3 + 3, m_nSizeY); nSourceY++) {
+                        for (uint32_t nSourceX = nX * 4; nSourceX < std::min(nX * 4 + 4, m_nSizeX); nSourceX++) {
+                            dSum += values[(size_t)nSourceY * m_nSizeX + nSourceX];
+                            nCount++;
+                        }
+                    }
+                    expectedValues.push_back(dSum / nCount);
+                }
+            }
+            assertValuesMatch(getValues(pSmallField), expectedValues, bSinglePrecision, sPrecision + " scale down");
+
+            double dSizeX, dSizeY, dSmallSizeX, dSmallSizeY;
+            pField->GetSizeInMM(dSizeX, dSizeY);
+            pSmallField->GetSizeInMM(dSmallSizeX, dSmallSizeY);
+            assertDoubleRange(dSmallSizeX, dSizeX, dSizeX + 25.4 / 254.0 * 4, "scaled down width in mm");
+            assertDoubleRange(dSmallSizeY, dSizeY, dSizeY + 25.4 / 254.0 * 3, "scaled down height in mm");
+
+            auto pLargeField = pSmallField->ScaleFieldUp(2, 5);
+            uint32_t nLargeSizeX, nLargeSizeY;
+            pLargeField->GetSizeInPixels(nLargeSizeX, nLargeSizeY);
+            assertIntegerRange(nLargeSizeX, nSmallSizeX * 2, nSmallSizeX * 2, "scaled up size X");
+            assertIntegerRange(nLargeSizeY, nSmallSizeY * 5, nSmallSizeY * 5, "scaled up size Y");
+
+            auto smallValues = getValues(pSmallField);
+            expectedValues.clear();
+            for (uint32_t nY = 0; nY < nLargeSizeY; nY++)
+                for (uint32_t nX = 0; nX < nLargeSizeX; nX++)
+                    expectedValues.push_back(smallValues[(size_t)(nY / 5) * nSmallSizeX + (nX / 2)]);
+            assertValuesMatch(getValues(pLargeField), expectedValues, false, sPrecision + " scale up");
+        }
+    }
+
+    void test_DiscretizeWithMapping() {
+        std::vector<double> discreteValues = { 50.0, -50.0, 0.0, 10.0, 10.0 };
+        std::vector<double> newValues = { 5.0, -5.0, 0.0, 1.0, 2.0 };
+
+        for (bool bSinglePrecision : { false, true }) {
+            auto pField = createField(bSinglePrecision, 4);
+            auto values = getValues(pField);
+
+            pField->DiscretizeWithMapping(discreteValues.size(), discreteValues.data(), newValues.size(), newValues.data());
+
+            for (auto& dValue : values) {
+                // Brute force search, the first of equally near values wins
+                size_t nNearest = 0;
+                for (size_t nIndex = 1; nIndex < discreteValues.size(); nIndex++) {
+                    double dDistance = std::abs(discreteValues[nIndex] - dValue);
+                    double dNearestDistance = std::abs(discreteValues[nNearest] - dValue);
+                    if ((dDistance < dNearestDistance) || ((dDistance == dNearestDistance) && (discreteValues[nIndex] < discreteValues[nNearest])))
+                        nNearest = nIndex;
+                }
+                dValue = newValues[nNearest];
+            }
+            assertValuesMatch(getValues(pField), values, false, "discretize");
+        }
+
+        auto pField = createField(false, 4);
+        bool bFailed = false;
+        try {
+            pField->DiscretizeWithMapping(discreteValues.size(), discreteValues.data(), 2, newValues.data());
+        }
+        catch (std::exception&) {
+            bFailed = true;
+        }
+        assertTrue(bFailed, "mapping size mismatch is rejected");
+    }
+
+    void test_RenderRGBImage() {
+        for (bool bSinglePrecision : { false, true }) {
+            auto pField = createField(bSinglePrecision, 5);
+            auto values = getValues(pField);
+
+            std::vector<uint8_t> pixelData;
+            pField->renderRGBImage(&pixelData, -80.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 0.0, 80.0, 1.0, 0.0, 0.0);
+            assertIntegerRange(pixelData.size(), values.size() * 3, values.size() * 3, "pixel data size");
+
+            for (size_t nIndex = 0; nIndex < values.size(); nIndex++) {
+                double dFactor;
+                double dRed, dGreen, dBlue;
+                if (values[nIndex] < 0.0) {
+                    dFactor = std::min(std::max((values[nIndex] + 80.0) / 80.0, 0.0), 1.0);
+                    dRed = 0.0;
+                    dGreen = dFactor;
+                    dBlue = 1.0 - dFactor;
+                }
+                else {
+                    dFactor = std::min(std::max(values[nIndex] / 80.0, 0.0), 1.0);
+                    dRed = dFactor;
+                    dGreen = 1.0 - dFactor;
+                    dBlue = 0.0;
+                }
+
+                // Single precision values may round to the neighbouring color value
+                int64_t nTolerance = bSinglePrecision ? 1 : 0;
+                int64_t nRed = (int64_t)std::round(dRed * 255.0);
+                int64_t nGreen = (int64_t)std::round(dGreen * 255.0);
+                int64_t nBlue = (int64_t)std::round(dBlue * 255.0);
+                assertIntegerRange(pixelData[nIndex * 3], nRed - nTolerance, nRed + nTolerance, "red");
+                assertIntegerRange(pixelData[nIndex * 3 + 1], nGreen - nTolerance, nGreen + nTolerance, "green");
+                assertIntegerRange(pixelData[nIndex * 3 + 2], nBlue - nTolerance, nBlue + nTolerance, "blue");
+            }
+        }
+
+        // Color values on and next to the half steps round like std::round
+        auto pRampField = std::make_shared<AMC::CDiscreteFieldData2DInstance>(511, 3, 254.0, 254.0, 0.0, 0.0, 0.0, true);
+        for (uint32_t nX = 0; nX < 511; nX++) {
+            pRampField->SetPixel(nX, 0, nX * 0.5);
+            pRampField->SetPixel(nX, 1, std::nextafter(nX * 0.5, 0.0));
+            pRampField->SetPixel(nX, 2, std::nextafter(nX * 0.5, 1000.0));
+        }
+
+        std::vector<uint8_t> rampPixelData;
+        pRampField->renderRGBImage(&rampPixelData, 0.0, 0.0, 0.0, 0.0, 255.0, 1.0, 1.0, 1.0, 510.0, 1.0, 1.0, 1.0);
+        for (uint32_t nY = 0; nY < 3; nY++) {
+            for (uint32_t nX = 0; nX < 511; nX++) {
+                int64_t nExpected = (int64_t)std::round(std::min(pRampField->GetPixel(nX, nY) / 255.0, 1.0) * 255.0);
+                assertIntegerRange(rampPixelData[((size_t)nY * 511 + nX) * 3], nExpected, nExpected, "half step");
+            }
+        }
+    }
+
+    void test_RenderAveragePointValues() {
+        std::mt19937 generator(6);
+        // Points cover the field and a margin around it, which must be ignored
+        std::uniform_real_distribution<double> coordinateXDistribution(9.0, 10.0 + m_nSizeX * 0.1 + 1.0);
+        std::uniform_real_distribution<double> coordinateYDistribution(19.0, 20.0 + m_nSizeY * 0.1 + 1.0);
+        std::uniform_real_distribution<double> valueDistribution(0.0, 1000.0);
+
+        std::vector<LibMCEnv::sFieldData2DPoint> points(1000000);
+        for (auto& point : points) {
+            point.m_Coordinates[0] = coordinateXDistribution(generator);
+            point.m_Coordinates[1] = coordinateYDistribution(generator);
+            point.m_Value = valueDistribution(generator);
+        }
+
+        std::vector<double> sums((size_t)m_nSizeX * m_nSizeY, 0.0);
+        std::vector<uint32_t> counts((size_t)m_nSizeX * m_nSizeY, 0);
+        for (auto& point : points) {
+            int64_t nX = (int64_t)std::floor((point.m_Coordinates[0] - 10.0) * 10.0);
+            int64_t nY = (int64_t)std::floor((point.m_Coordinates[1] - 20.0) * 10.0);
+            if ((nX >= 0) && (nY >= 0) && (nX < m_nSizeX) && (nY < m_nSizeY)) {
+                sums[(size_t)nY * m_nSizeX + nX] += point.m_Value;
+                counts[(size_t)nY * m_nSizeX + nX]++;
+            }
+        }
+
+        std::vector<double> expectedValues(sums.size());
+        for (size_t nIndex = 0; nIndex < sums.size(); nIndex++)
+            expectedValues[nIndex] = (counts[nIndex] > 0) ? (sums[nIndex] / counts[nIndex]) : -1.0;
+
+        for (bool bSinglePrecision : { false, true }) {
+            auto pField = std::make_shared<AMC::CDiscreteFieldData2DInstance>(m_nSizeX, m_nSizeY, 254.0, 254.0, 10.0, 20.0, 0.0, true);
+            pField->setSinglePrecision(bSinglePrecision);
+            pField->renderAveragePointValues_FloorSampling(-1.0, points.size(), points.data());
+
+            // Summation order depends on the number of worker threads
+            auto values = getValues(pField);
+            for (size_t nIndex = 0; nIndex < values.size(); nIndex++) {
+                double dTolerance = std::abs(expectedValues[nIndex]) * (bSinglePrecision ? 1.0E-6 : 1.0E-12);
+                if (std::abs(values[nIndex] - expectedValues[nIndex]) > dTolerance)
+                    assertDoubleRange(values[nIndex], expectedValues[nIndex] - dTolerance, expectedValues[nIndex] + dTolerance, "pixel average #" + std::to_string(nIndex));
+            }
+        }
+    }
+
+    void test_SinglePrecisionStorage() {
+        auto pField = createField(false, 7);
+        auto values = getValues(pField);
+
+        pField->setSinglePrecision(true);
+        assertTrue(pField->isSinglePrecision(), "single precision");
+        assertValuesMatch(getValues(pField), values, true, "converted to float");
+
+        auto pDuplicate = pField->Duplicate();
+        assertTrue(pDuplicate->isSinglePrecision(), "duplicate keeps precision");
+        assertValuesMatch(getValues(pDuplicate), getValues(pField), false, "duplicate");
+
+        uint32_t nNewSizeX = m_nSizeX + 10;
+        uint32_t nNewSizeY = m_nSizeY - 10;
+        pDuplicate->ResizeField(nNewSizeX, nNewSizeY, 42.0);
+        assertDoubleRange(pDuplicate->GetPixel(m_nSizeX + 5, 0), 42.0, 42.0, "resized default value");
+        assertDoubleRange(pDuplicate->GetPixel(7, 9), pField->GetPixel(7, 9), pField->GetPixel(7, 9), "resized value");
+
+        std::vector<uint8_t> buffer;
+        pField->saveToBuffer(buffer);
+        auto pLoadedField = AMC::CDiscreteFieldData2DInstance::createFromBuffer(buffer);
+        assertFalse(pLoadedField->isSinglePrecision(), "streams are loaded in double precision");
+        assertValuesMatch(getValues(pLoadedField), getValues(pField), false, "stream round trip");
+
+        pField->setSinglePrecision(false);
+        assertFalse(pField->isSinglePrecision(), "double precision");
+        assertValuesMatch(getValues(pField), values, true, "converted back to double");
+    }
+
+};
+
+
+}
+
+
+#endif // __AMCTEST_UNITTEST_DISCRETEFIELDDATA2D
@@ -0,0 +1,367 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCTEST_UNITTEST_JOURNALALERTINDEX
+#define __AMCTEST_UNITTEST_JOURNALALERTINDEX
+
+#include "amc_unittests.hpp"
+#include "amcdata_journalalertindex.hpp"
+#include "amcdata_journal.hpp"
+#include "common_utils.hpp"
+#include "libmcdata_interfaceexception.hpp"
+
+
+namespace AMCUnitTest {
+
+
+class CUnitTestGroup_JournalAlertIndex : public CUnitTestGroup {
+private:
+
+    static AMCData::sJournalAlertIndexEntry createEntry(const std::string& sIdentifier, const std::string& sTimestampUTC, uint32_t nAlertIndex)
+    {
+        AMCData::sJournalAlertIndexEntry entry;
+        entry.m_sIdentifier = sIdentifier;
+        entry.m_Level = LibMCData::eAlertLevel::Warning;
+        entry.m_sDescription = "description of " + sIdentifier;
+        entry.m_sDescriptionIdentifier = "";
+        entry.m_sReadableContextInformation = "context";
+        entry.m_bNeedsAcknowledgement = true;
+        entry.m_sTimestampUTC = sTimestampUTC;
+        entry.m_nAlertIndex = nAlertIndex;
+        entry.m_bActive = false;
+        entry.m_bAcknowledged = true;
+        return entry;
+    }
+
+    static std::string createTimestamp(uint32_t nSecond)
+    {
+        std::string sSecond = std::to_string(nSecond % 60);
+        std::string sMinute = std::to_string(nSecond / 60);
+        if (sSecond.length() < 2)
+            sSecond = "0" + sSecond;
+        if (sMinute.length() < 2)
+            sMinute = "0" + sMinute;
+        return "2025-03-01T10:" + sMinute + ":" + sSecond + ".000Z";
+    }
+
+    static std::vector<std::string> queryUUIDs(AMCData::PSQLHandler pSQLHandler, const std::string& sQuery, const std::string& sParameter)
+    {
+        std::vector<std::string> uuids;
+        auto pStatement = pSQLHandler->prepareStatement(sQuery);
+        if (!sParameter.empty())
+            pStatement->setString(1, sParameter);
+        while (pStatement->nextRow())
+            uuids.push_back(pStatement->getColumnString(1));
+        return uuids;
+    }
+
+    // Creates an index from the committed alerts and acknowledgements, as a restarted session would see them.
+    static AMCData::PJournalAlertIndex rebuildIndexFromDatabase(AMCData::PSQLHandler pSQLHandler)
+    {
+        auto pIndex = std::make_shared<AMCData::CJournalAlertIndex>();
+
+        auto pStatement = pSQLHandler->prepareStatement("SELECT uuid, identifier, alertindex, alertlevel, description, descriptionidentifier, contextinformation, active, needsacknowledgement, timestamp FROM alerts ORDER BY alertindex");
+        while (pStatement->nextRow()) {
+            std::string sUUID = pStatement->getColumnString(1);
+
+            AMCData::sJournalAlertIndexEntry entry;
+            entry.m_sIdentifier = pStatement->getColumnString(2);
+            entry.m_nAlertIndex = (uint32_t)pStatement->getColumnInt(3);
+            entry.m_Level = AMCData::CJournal::convertStringToAlertLevel(pStatement->getColumnString(4), true);
+            entry.m_sDescription = pStatement->getColumnString(5);
+            entry.m_sDescriptionIdentifier = pStatement->getColumnString(6);
+            entry.m_sReadableContextInformation = pStatement->getColumnString(7);
+            entry.m_bNeedsAcknowledgement = pStatement->getColumnInt(9) != 0;
+            entry.m_sTimestampUTC = pStatement->getColumnString(10);
+            pIndex->addAlert(sUUID, entry);
+
+            if (pStatement->getColumnInt(8) == 0)
+                pIndex->deactivateAlert(sUUID);
+        }
+        pStatement = nullptr;
+
+        auto pAckStatement = pSQLHandler->prepareStatement("SELECT DISTINCT alertuuid FROM alertacknowledgements");
+        while (pAckStatement->nextRow())
+            pIndex->acknowledgeAlert(pAckStatement->getColumnString(1));
+
+        return pIndex;
+    }
+
+    // Compares the journal's index answers with the committed alert tables.
+    void assertJournalMatchesDatabase(AMCData::CJournal& journal, const std::vector<std::string>& alertUUIDs, const std::vector<std::string>& typeIdentifiers)
+    {
+        auto pSQLHandler = journal.getSQLHandler();
+
+        std::vector<std::string> activeAlerts;
+        journal.retrieveActiveAlerts(activeAlerts);
+        assertTrue(activeAlerts == queryUUIDs(pSQLHandler, "SELECT uuid FROM alerts WHERE active=1 ORDER BY timestamp, alertindex", ""), "active alerts match the alerts table");
+
+        for (auto& sTypeIdentifier : typeIdentifiers) {
+            std::vector<std::string> activeAlertsOfType;
+            journal.retrieveActiveAlertsByType(activeAlertsOfType, sTypeIdentifier);
+            assertTrue(activeAlertsOfType == queryUUIDs(pSQLHandler, "SELECT uuid FROM alerts WHERE active=1 AND identifier=? ORDER BY timestamp, alertindex", sTypeIdentifier), "active alerts by type match the alerts table");
+        }
+
+        for (auto& sUUID : alertUUIDs) {
+            auto pStatement = pSQLHandler->prepareStatement("SELECT identifier, alertlevel, description, contextinformation, active, needsacknowledgement, timestamp FROM alerts WHERE uuid=?");
+            pStatement->setString(1, sUUID);
+            assertTrue(pStatement->nextRow(), "alert is stored");
+            assertTrue(journal.hasAlert(sUUID), "alert exists");
+            assertTrue(journal.alertIsActive(sUUID) == (pStatement->getColumnInt(5) != 0), "active flag matches the alerts table");
+
+            std::string sIdentifier, sDescription, sDescriptionIdentifier, sContextInformation, sTimestampUTC;
+            LibMCData::eAlertLevel eLevel = LibMCData::eAlertLevel::Unknown;
+            bool bNeedsAcknowledgement = false;
+            journal.getAlertInformation(sUUID, sIdentifier, eLevel, sDescription, sDescriptionIdentifier, sContextInformation, bNeedsAcknowledgement, sTimestampUTC);
+            assertTrue(sIdentifier == pStatement->getColumnString(1), "identifier");
+            assertTrue(AMCData::CJournal::convertAlertLevelToString(eLevel) == pStatement->getColumnString(2), "alert level");
+            assertTrue(sDescription == pStatement->getColumnString(3), "description");
+            assertTrue(sContextInformation == pStatement->getColumnString(4), "context information");
+            assertTrue(bNeedsAcknowledgement == (pStatement->getColumnInt(6) != 0), "needs acknowledgement");
+            assertTrue(sTimestampUTC == pStatement->getColumnString(7), "timestamp");
+            pStatement = nullptr;
+
+            auto acknowledgements = queryUUIDs(pSQLHandler, "SELECT uuid FROM alertacknowledgements WHERE alertuuid=?", sUUID);
+            assertTrue(journal.alertHasBeenAcknowledged(sUUID) == !acknowledgements.empty(), "acknowledged flag matches the acknowledgements table");
+        }
+    }
+
+    void assertIndicesAreEqual(AMCData::CJournalAlertIndex& index, AMCData::CJournal& journal, const std::vector<std::string>& alertUUIDs, const std::vector<std::string>& typeIdentifiers)
+    {
+        std::vector<std::string> indexActiveAlerts;
+        std::vector<std::string> journalActiveAlerts;
+        index.retrieveActiveAlerts(indexActiveAlerts);
+        journal.retrieveActiveAlerts(journalActiveAlerts);
+        assertTrue(indexActiveAlerts == journalActiveAlerts, "rebuilt active alerts");
+        assertIntegerRange(index.getActiveAlertCount(), journalActiveAlerts.size(), journalActiveAlerts.size(), "rebuilt active alert count");
+
+        for (auto& sTypeIdentifier : typeIdentifiers) {
+            std::vector<std::string> indexAlertsOfType;
+            std::vector<std::string> journalAlertsOfType;
+            index.retrieveActiveAlertsByType(indexAlertsOfType, sTypeIdentifier);
+            journal.retrieveActiveAlertsByType(journalAlertsOfType, sTypeIdentifier);
+            assertTrue(indexAlertsOfType == journalAlertsOfType, "rebuilt active alerts by type");
+        }
+
+        for (auto& sUUID : alertUUIDs) {
+            assertTrue(index.hasAlert(sUUID), "rebuilt alert exists");
+            assertTrue(index.alertIsActive(sUUID) == journal.alertIsActive(sUUID), "rebuilt active flag");
+            assertTrue(index.alertHasBeenAcknowledged(sUUID) == journal.alertHasBeenAcknowledged(sUUID), "rebuilt acknowledged flag");
+        }
+    }
+
+public:
+    CUnitTestGroup_JournalAlertIndex() = default;
+    virtual ~CUnitTestGroup_JournalAlertIndex() = default;
+
+    std::string getTestGroupName() override {
+        return "JournalAlertIndex";
+    }
+
+    void initializeTests() override {
+        // Nothing to initialize
+    }
+
+    void registerTests() override {
+        registerTest("RaiseAlerts", "Raised alerts are active, unacknowledged and keep their information", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_JournalAlertIndex::test_RaiseAlerts, this));
+        registerTest("AcknowledgeAndDeactivate", "Acknowledging and deactivating update the alert state", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_JournalAlertIndex::test_AcknowledgeAndDeactivate, this));
+        registerTest("ActiveListing", "Active alerts are listed in timestamp order and filtered by type", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_JournalAlertIndex::test_ActiveListing, this));
+        registerTest("JournalMatchesDatabase", "Journal alert queries match the SQL queries on the committed tables", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_JournalAlertIndex::test_JournalMatchesDatabase, this));
+    }
+
+private:
+
+    void test_RaiseAlerts() {
+        AMCData::CJournalAlertIndex index;
+        assertFalse(index.hasAlert("a0000000-0000-0000-0000-000000000001"), "empty index");
+        assertIntegerRange(index.getActiveAlertCount(), 0, 0, "empty index count");
+
+        index.addAlert("a0000000-0000-0000-0000-000000000001", createEntry("overheat", createTimestamp(5), 1));
+        index.addAlert("a0000000-0000-0000-0000-000000000002", createEntry("dooropen", createTimestamp(6), 2));
+
+        assertTrue(index.hasAlert("a0000000-0000-0000-0000-000000000001"), "alert exists");
+        assertTrue(index.alertIsActive("a0000000-0000-0000-0000-000000000001"), "raised alert is active, regardless of the entry flag");
+        assertFalse(index.alertHasBeenAcknowledged("a0000000-0000-0000-0000-000000000001"), "raised alert is not acknowledged, regardless of the entry flag");
+        assertIntegerRange(index.getActiveAlertCount(), 2, 2, "active count");
+
+        AMCData::sJournalAlertIndexEntry entry;
+        assertTrue(index.getAlert("a0000000-0000-0000-0000-000000000002", entry), "get alert");
+        assertTrue(entry.m_sIdentifier == "dooropen", "identifier");
+        assertTrue(entry.m_sDescription == "description of dooropen", "description");
+        assertTrue(entry.m_sTimestampUTC == createTimestamp(6), "timestamp");
+        assertIntegerRange(entry.m_nAlertIndex, 2, 2, "alert index");
+        assertTrue(entry.m_bActive && !entry.m_bAcknowledged, "entry flags");
+
+        assertFalse(index.getAlert("a0000000-0000-0000-0000-000000000003", entry), "unknown alert");
+        assertFalse(index.alertIsActive("a0000000-0000-0000-0000-000000000003"), "unknown alert is not active");
+        assertFalse(index.alertHasBeenAcknowledged("a0000000-0000-0000-0000-000000000003"), "unknown alert is not acknowledged");
+    }
+
+    void test_AcknowledgeAndDeactivate() {
+        AMCData::CJournalAlertIndex index;
+        index.addAlert("a0000000-0000-0000-0000-000000000001", createEntry("overheat", createTimestamp(1), 1));
+        index.addAlert("a0000000-0000-0000-0000-000000000002", createEntry("overheat", createTimestamp(2), 2));
+        index.addAlert("a0000000-0000-0000-0000-000000000003", createEntry("overheat", createTimestamp(3), 3));
+
+        assertTrue(index.deactivateAlert("a0000000-0000-0000-0000-000000000001"), "deactivate");
+        assertFalse(index.alertIsActive("a0000000-0000-0000-0000-000000000001"), "deactivated alert is inactive");
+        assertFalse(index.alertHasBeenAcknowledged("a0000000-0000-0000-0000-000000000001"), "deactivating does not acknowledge");
+        assertTrue(index.hasAlert("a0000000-0000-0000-0000-000000000001"), "deactivated alert still exists");
+        assertIntegerRange(index.getActiveAlertCount(), 2, 2, "active count after deactivation");
+
+        assertTrue(index.acknowledgeAlert("a0000000-0000-0000-0000-000000000002"), "acknowledge");
+        assertFalse(index.alertIsActive("a0000000-0000-0000-0000-000000000002"), "acknowledging deactivates");
+        assertTrue(index.alertHasBeenAcknowledged("a0000000-0000-0000-0000-000000000002"), "acknowledged");
+        assertIntegerRange(index.getActiveAlertCount(), 1, 1, "active count after acknowledgement");
+
+        // Acknowledging an inactive alert and repeating operations keep the state consistent
+        assertTrue(index.acknowledgeAlert("a0000000-0000-0000-0000-000000000001"), "acknowledge inactive alert");
+        assertTrue(index.alertHasBeenAcknowledged("a0000000-0000-0000-0000-000000000001"), "inactive alert acknowledged");
+        assertTrue(index.deactivateAlert("a0000000-0000-0000-0000-000000000002"), "deactivate acknowledged alert");
+        assertTrue(index.alertHasBeenAcknowledged("a0000000-0000-0000-0000-000000000002"), "deactivating keeps the acknowledgement");
+        assertIntegerRange(index.getActiveAlertCount(), 1, 1, "active count after repeated operations");
+
+        assertFalse(index.deactivateAlert("a0000000-0000-0000-0000-000000000009"), "deactivate unknown alert");
+        assertFalse(index.acknowledgeAlert("a0000000-0000-0000-0000-000000000009"), "acknowledge unknown alert");
+        assertFalse(index.hasAlert("a0000000-0000-0000-0000-000000000009"), "unknown alert is not created");
+
+        std::vector<std::string> activeAlerts;
+        index.retrieveActiveAlerts(activeAlerts);
+        assertTrue(activeAlerts == std::vector<std::string>({ "a0000000-0000-0000-0000-000000000003" }), "remaining active alert");
+    }
+
+    void test_ActiveListing() {
+        AMCData::CJournalAlertIndex index;
+
+        // Raised out of timestamp order, two alerts share a timestamp
+        index.addAlert("a0000000-0000-0000-0000-000000000001", createEntry("overheat", createTimestamp(30), 1));
+        index.addAlert("a0000000-0000-0000-0000-000000000002", createEntry("dooropen", createTimestamp(10), 2));
+        index.addAlert("a0000000-0000-0000-0000-000000000003", createEntry("overheat", createTimestamp(20), 3));
+        index.addAlert("a0000000-0000-0000-0000-000000000004", createEntry("dooropen", createTimestamp(20), 4));
+        index.addAlert("a0000000-0000-0000-0000-000000000005", createEntry("overheat", createTimestamp(40), 5));
+
+        std::vector<std::string> activeAlerts;
+        index.retrieveActiveAlerts(activeAlerts);
+        assertTrue(activeAlerts == std::vector<std::string>({ "a0000000-0000-0000-0000-000000000002", "a0000000-0000-0000-0000-000000000003", "a0000000-0000-0000-0000-000000000004", "a0000000-0000-0000-0000-000000000001", "a0000000-0000-0000-0000-000000000005" }), "ordered by timestamp and alert index");
+
+        // Results are appended to the given list
+        index.retrieveActiveAlerts(activeAlerts);
+        assertIntegerRange((int64_t)activeAlerts.size(), 10, 10, "results are appended");
+
+        std::vector<std::string> overheatAlerts;
+        index.retrieveActiveAlertsByType(overheatAlerts, "overheat");
+        assertTrue(overheatAlerts == std::vector<std::string>({ "a0000000-0000-0000-0000-000000000003", "a0000000-0000-0000-0000-000000000001", "a0000000-0000-0000-0000-000000000005" }), "filtered by type");
+
+        index.deactivateAlert("a0000000-0000-0000-0000-000000000003");
+        index.acknowledgeAlert("a0000000-0000-0000-0000-000000000002");
+
+        activeAlerts.clear();
+        index.retrieveActiveAlerts(activeAlerts);
+        assertTrue(activeAlerts == std::vector<std::string>({ "a0000000-0000-0000-0000-000000000004", "a0000000-0000-0000-0000-000000000001", "a0000000-0000-0000-0000-000000000005" }), "inactive alerts are not listed");
+
+        overheatAlerts.clear();
+        index.retrieveActiveAlertsByType(overheatAlerts, "overheat");
+        assertTrue(overheatAlerts == std::vector<std::string>({ "a0000000-0000-0000-0000-000000000001", "a0000000-0000-0000-0000-000000000005" }), "inactive alerts are not listed by type");
+
+        std::vector<std::string> unknownAlerts;
+        index.retrieveActiveAlertsByType(unknownAlerts, "unknowntype");
+        assertTrue(unknownAlerts.empty(), "unknown type");
+    }
+
+    void test_JournalMatchesDatabase() {
+        std::string sTempFolder = AMCCommon::CUtils::getTempFolder();
+        std::string sJournalPrefix = "amcunittest_journal_" + AMCCommon::CUtils::createUUID();
+        std::string sJournalName = sJournalPrefix + ".db";
+        std::string sChunkBaseName = sJournalPrefix + "_";
+
+        std::vector<std::string> dataFileNames;
+        {
+            AMCData::CJournal journal(sTempFolder, sJournalName, sChunkBaseName, AMCCommon::CUtils::createUUID());
+
+            std::vector<std::string> typeIdentifiers = { "overheat", "dooropen", "lowpressure" };
+            std::vector<std::string> alertUUIDs;
+            for (uint32_t nIndex = 0; nIndex < 40; nIndex++) {
+                std::string sUUID = AMCCommon::CUtils::createUUID();
+                alertUUIDs.push_back(sUUID);
+
+                // Timestamps repeat, so that the order depends on the alert index as well
+                journal.addAlert(sUUID, typeIdentifiers.at(nIndex % 3), (nIndex % 2) ? LibMCData::eAlertLevel::CriticalError : LibMCData::eAlertLevel::Warning,
+                    "alert " + std::to_string(nIndex), "", "context " + std::to_string(nIndex), (nIndex % 4) != 0, createTimestamp((nIndex * 7) % 25));
+            }
+
+            assertJournalMatchesDatabase(journal, alertUUIDs, typeIdentifiers);
+
+            std::string sUserUUID = AMCCommon::CUtils::createUUID();
+            for (uint32_t nIndex = 0; nIndex < alertUUIDs.size(); nIndex += 3) {
+                switch (nIndex % 4) {
+                case 0:
+                    journal.acknowledgeAlert(alertUUIDs.at(nIndex), sUserUUID, "checked", createTimestamp(50));
+                    break;
+                case 1:
+                    journal.acknowledgeAlertForUser(alertUUIDs.at(nIndex), sUserUUID, "checked", createTimestamp(51));
+                    break;
+                default:
+                    journal.deactivateAlert(alertUUIDs.at(nIndex));
+                    break;
+                }
+
+                assertJournalMatchesDatabase(journal, alertUUIDs, typeIdentifiers);
+            }
+
+            // Deactivating an acknowledged alert again must not change anything
+            journal.deactivateAlert(alertUUIDs.at(0));
+            assertJournalMatchesDatabase(journal, alertUUIDs, typeIdentifiers);
+
+            auto pRebuiltIndex = rebuildIndexFromDatabase(journal.getSQLHandler());
+            assertIndicesAreEqual(*pRebuiltIndex, journal, alertUUIDs, typeIdentifiers);
+
+            bool bThrown = false;
+            try {
+                journal.acknowledgeAlert(AMCCommon::CUtils::createUUID(), sUserUUID, "checked", createTimestamp(52));
+            }
+            catch (ELibMCDataInterfaceException&) {
+                bThrown = true;
+            }
+            assertTrue(bThrown, "acknowledging an unknown alert fails");
+
+            dataFileNames = queryUUIDs(journal.getSQLHandler(), "SELECT filename FROM journal_datafiles", "");
+        }
+
+        AMCCommon::CUtils::deleteFileFromDisk(sTempFolder + sJournalName, true);
+        for (auto& sDataFileName : dataFileNames)
+            AMCCommon::CUtils::deleteFileFromDisk(sTempFolder + sDataFileName, false);
+    }
+
+};
+
+}
+
+#endif // __AMCTEST_UNITTEST_JOURNALALERTINDEX
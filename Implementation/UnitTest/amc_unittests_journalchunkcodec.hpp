@@ -0,0 +1,351 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCTEST_UNITTEST_JOURNALCHUNKCODEC
+#define __AMCTEST_UNITTEST_JOURNALCHUNKCODEC
+
+#include "amc_unittests.hpp"
+#include "amcdata_journalchunkcodec.hpp"
+#include "amcdata_journalchunkdatafile.hpp"
+#include "libmcdata_interfaceexception.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+
+namespace AMCUnitTest {
+
+
+// Serves chunks from memory, optionally as a mapped buffer.
+class CUnitTestJournalChunkMemoryFile : public AMCData::CJournalChunkDataFile {
+private:
+    std::vector<uint8_t> m_Buffer;
+    bool m_bMapped;
+
+public:
+    CUnitTestJournalChunkMemoryFile(const std::vector<uint8_t>& buffer, bool bMapped)
+        : m_Buffer(buffer), m_bMapped(bMapped)
+    {
+    }
+
+    void readBuffer(uint64_t nDataOffset, uint8_t* pBuffer, uint64_t nDataLength) override
+    {
+        if ((nDataOffset > m_Buffer.size()) || (nDataLength > (m_Buffer.size() - nDataOffset)))
+            throw std::runtime_error("read out of bounds");
+        memcpy(pBuffer, m_Buffer.data() + nDataOffset, (size_t)nDataLength);
+    }
+
+    const uint8_t* mapBuffer(uint64_t nDataOffset, uint64_t nDataLength) override
+    {
+        if (!m_bMapped)
+            return nullptr;
+        return m_Buffer.data() + nDataOffset;
+    }
+
+    size_t getSize()
+    {
+        return m_Buffer.size();
+    }
+};
+
+
+class CUnitTestGroup_JournalChunkCodec : public CUnitTestGroup {
+private:
+
+    typedef struct {
+        std::vector<LibMCData::sJournalChunkVariableInfo> m_VariableInfo;
+        std::vector<uint32_t> m_TimeStamps;
+        std::vector<int64_t> m_Values;
+    } sChunkContent;
+
+    // Appends a variable with nEntryCount entries. Time stamps advance with a jitter, values alternate in sign and magnitude.
+    static void addVariable(sChunkContent& content, uint32_t nVariableIndex, uint32_t nStorageType, uint32_t nEntryCount, uint32_t nStartTimeStamp, int64_t nValueScale)
+    {
+        LibMCData::sJournalChunkVariableInfo info;
+        info.m_VariableIndex = nVariableIndex;
+        info.m_StorageType = nStorageType;
+        info.m_EntryStartIndex = (uint32_t)content.m_TimeStamps.size();
+        info.m_EntryCount = nEntryCount;
+        content.m_VariableInfo.push_back(info);
+
+        uint32_t nTimeStamp = nStartTimeStamp;
+        for (uint32_t nIndex = 0; nIndex < nEntryCount; nIndex++) {
+            nTimeStamp += 1000 + (nIndex % 7) * 13;
+            content.m_TimeStamps.push_back(nTimeStamp);
+
+            int64_t nValue = ((int64_t)(nIndex % 5) - 2) * nValueScale + (int64_t)nIndex;
+            content.m_Values.push_back(nValue);
+        }
+    }
+
+    static void encodeChunk(const sChunkContent& content, bool bCompress, bool bSummaries, std::vector<uint8_t>& chunkBuffer)
+    {
+        AMCData::CJournalChunkCodec::encodeChunk(content.m_VariableInfo.data(), content.m_VariableInfo.size(), content.m_TimeStamps.data(), content.m_Values.data(), content.m_Values.size(), bCompress, bSummaries, chunkBuffer);
+    }
+
+    // Writes the raw version 1 layout, as it has been stored before the codec existed.
+    static void encodeChunkV1(const sChunkContent& content, std::vector<uint8_t>& chunkBuffer)
+    {
+        size_t nVariableInfoSize = content.m_VariableInfo.size() * sizeof(LibMCData::sJournalChunkVariableInfo);
+        size_t nTimeStampSize = content.m_TimeStamps.size() * sizeof(uint32_t);
+        size_t nValueSize = content.m_Values.size() * sizeof(int64_t);
+
+        AMCData::sJournalChunkHeader chunkHeader;
+        memset((void*)&chunkHeader, 0, sizeof(chunkHeader));
+        chunkHeader.m_nSignature = JOURNALSIGNATURE_INTEGERDATA_V1;
+        chunkHeader.m_nMemorySize = (uint32_t)(sizeof(chunkHeader) + nVariableInfoSize + nTimeStampSize + nValueSize);
+        chunkHeader.m_nVariableCount = (uint32_t)content.m_VariableInfo.size();
+        chunkHeader.m_nValueCount = (uint32_t)content.m_Values.size();
+
+        chunkBuffer.resize(chunkHeader.m_nMemorySize);
+        uint8_t* pTarget = chunkBuffer.data();
+        memcpy(pTarget, &chunkHeader, sizeof(chunkHeader));
+        pTarget += sizeof(chunkHeader);
+        memcpy(pTarget, content.m_VariableInfo.data(), nVariableInfoSize);
+        pTarget += nVariableInfoSize;
+        memcpy(pTarget, content.m_TimeStamps.data(), nTimeStampSize);
+        pTarget += nTimeStampSize;
+        memcpy(pTarget, content.m_Values.data(), nValueSize);
+    }
+
+    void assertContentEquals(const sChunkContent& content, const std::vector<LibMCData::sJournalChunkVariableInfo>& variableInfo, const std::vector<uint32_t>& timeStamps, const std::vector<int64_t>& values)
+    {
+        assertIntegerRange((int64_t)variableInfo.size(), (int64_t)content.m_VariableInfo.size(), (int64_t)content.m_VariableInfo.size(), "variable count");
+        assertTrue(memcmp(variableInfo.data(), content.m_VariableInfo.data(), variableInfo.size() * sizeof(LibMCData::sJournalChunkVariableInfo)) == 0, "variable info");
+        assertTrue(timeStamps == content.m_TimeStamps, "time stamps");
+        assertTrue(values == content.m_Values, "values");
+    }
+
+    // Reads the chunk back through all read paths and compares it to its source content.
+    void assertRoundTrip(const sChunkContent& content, const std::vector<uint8_t>& chunkBuffer, bool bMapped)
+    {
+        CUnitTestJournalChunkMemoryFile chunkFile(chunkBuffer, bMapped);
+
+        std::vector<LibMCData::sJournalChunkVariableInfo> variableInfo;
+        std::vector<uint32_t> timeStamps;
+        std::vector<int64_t> values;
+        chunkFile.readJournalChunkIntegerData(0, chunkFile.getSize(), variableInfo, timeStamps, values);
+        assertContentEquals(content, variableInfo, timeStamps, values);
+
+        for (auto& info : content.m_VariableInfo) {
+            std::vector<uint32_t> variableTimeStamps;
+            std::vector<int64_t> variableValues;
+            assertTrue(chunkFile.readJournalChunkVariableData(0, chunkFile.getSize(), info.m_VariableIndex, variableTimeStamps, variableValues), "variable is contained in chunk");
+            assertTrue(std::equal(variableTimeStamps.begin(), variableTimeStamps.end(), content.m_TimeStamps.begin() + info.m_EntryStartIndex) && (variableTimeStamps.size() == info.m_EntryCount), "variable time stamps");
+            assertTrue(std::equal(variableValues.begin(), variableValues.end(), content.m_Values.begin() + info.m_EntryStartIndex) && (variableValues.size() == info.m_EntryCount), "variable values");
+        }
+
+        std::vector<uint32_t> missingTimeStamps;
+        std::vector<int64_t> missingValues;
+        assertFalse(chunkFile.readJournalChunkVariableData(0, chunkFile.getSize(), 0xFFFFFFFF, missingTimeStamps, missingValues), "unknown variable");
+
+        std::vector<LibMCData::sJournalChunkVariableSummary> summaries;
+        chunkFile.readJournalChunkSummaries(0, chunkFile.getSize(), summaries);
+        assertIntegerRange((int64_t)summaries.size(), (int64_t)content.m_VariableInfo.size(), (int64_t)content.m_VariableInfo.size(), "summary count");
+        for (size_t nVariableListIndex = 0; nVariableListIndex < summaries.size(); nVariableListIndex++) {
+            auto& info = content.m_VariableInfo.at(nVariableListIndex);
+            LibMCData::sJournalChunkVariableSummary expectedSummary;
+            AMCData::CJournalChunkCodec::computeVariableSummary(info.m_VariableIndex, content.m_TimeStamps.data() + info.m_EntryStartIndex, content.m_Values.data() + info.m_EntryStartIndex, info.m_EntryCount, expectedSummary);
+            assertTrue(memcmp(&summaries.at(nVariableListIndex), &expectedSummary, sizeof(expectedSummary)) == 0, "summary");
+        }
+    }
+
+    void assertRoundTripAllModes(const sChunkContent& content)
+    {
+        for (int nMode = 0; nMode < 4; nMode++) {
+            bool bCompress = (nMode & 1) != 0;
+            bool bSummaries = (nMode & 2) != 0;
+
+            std::vector<uint8_t> chunkBuffer;
+            encodeChunk(content, bCompress, bSummaries, chunkBuffer);
+
+            AMCData::sJournalChunkHeader chunkHeader;
+            memcpy(&chunkHeader, chunkBuffer.data(), sizeof(chunkHeader));
+            assertTrue(chunkHeader.m_nSignature == JOURNALSIGNATURE_INTEGERDATA_V2, "version 2 signature");
+            assertTrue(chunkHeader.m_nMemorySize == chunkBuffer.size(), "memory size");
+
+            std::vector<LibMCData::sJournalChunkVariableSummary> storedSummaries;
+            assertTrue(AMCData::CJournalChunkCodec::getVariableSummaries(chunkBuffer.data(), chunkBuffer.size(), storedSummaries) == bSummaries, "summaries are stored on request");
+
+            assertRoundTrip(content, chunkBuffer, false);
+            assertRoundTrip(content, chunkBuffer, true);
+        }
+    }
+
+public:
+    CUnitTestGroup_JournalChunkCodec() = default;
+    virtual ~CUnitTestGroup_JournalChunkCodec() = default;
+
+    std::string getTestGroupName() override {
+        return "JournalChunkCodec";
+    }
+
+    void initializeTests() override {
+        // Nothing to initialize
+    }
+
+    void registerTests() override {
+        registerTest("EmptyChunk", "Chunks without entries are rejected, variables without entries round trip", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_JournalChunkCodec::test_EmptyChunk, this));
+        registerTest("SingleEntry", "Round trips a chunk with a single entry", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_JournalChunkCodec::test_SingleEntry, this));
+        registerTest("MultiVariable", "Round trips a chunk with several variables and extreme values", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_JournalChunkCodec::test_MultiVariable, this));
+        registerTest("Version1Chunks", "Reads chunks in the raw version 1 layout", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_JournalChunkCodec::test_Version1Chunks, this));
+        registerTest("CorruptChunks", "Rejects truncated and corrupted chunks", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_JournalChunkCodec::test_CorruptChunks, this));
+    }
+
+private:
+
+    void test_EmptyChunk() {
+        sChunkContent emptyContent;
+        addVariable(emptyContent, 1, 0, 0, 0, 1);
+
+        bool bThrown = false;
+        try {
+            std::vector<uint8_t> chunkBuffer;
+            encodeChunk(emptyContent, true, true, chunkBuffer);
+        }
+        catch (ELibMCDataInterfaceException&) {
+            bThrown = true;
+        }
+        assertTrue(bThrown, "chunk without values is rejected");
+
+        // A variable that did not change within the chunk is stored with an empty block
+        sChunkContent content;
+        addVariable(content, 3, 0, 0, 0, 1);
+        addVariable(content, 4, 1, 1, 500, 1);
+        addVariable(content, 5, 0, 0, 0, 1);
+        assertRoundTripAllModes(content);
+    }
+
+    void test_SingleEntry() {
+        sChunkContent content;
+        addVariable(content, 42, 0, 1, 123456, 1000);
+        assertRoundTripAllModes(content);
+    }
+
+    void test_MultiVariable() {
+        sChunkContent content;
+        addVariable(content, 0, 0, 1000, 0, 1);
+        addVariable(content, 7, 1, 50, 10000, 1000000);
+        addVariable(content, 8, 2, 3000, 5000, 0);
+        addVariable(content, 9, 0, 257, 0xFFF00000, 1LL << 40);
+
+        // Extreme values and time stamps must survive the zigzag delta encoding
+        LibMCData::sJournalChunkVariableInfo info;
+        info.m_VariableIndex = 10;
+        info.m_StorageType = 0;
+        info.m_EntryStartIndex = (uint32_t)content.m_TimeStamps.size();
+        info.m_EntryCount = 4;
+        content.m_VariableInfo.push_back(info);
+        content.m_TimeStamps.insert(content.m_TimeStamps.end(), { 0, 0xFFFFFFFF, 0xFFFFFFFF, 1 });
+        content.m_Values.insert(content.m_Values.end(), { std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max(), 0, std::numeric_limits<int64_t>::min() });
+
+        assertRoundTripAllModes(content);
+
+        std::vector<uint8_t> compressedBuffer;
+        std::vector<uint8_t> uncompressedBuffer;
+        encodeChunk(content, true, false, compressedBuffer);
+        encodeChunk(content, false, false, uncompressedBuffer);
+        assertTrue(compressedBuffer.size() < uncompressedBuffer.size(), "compressed chunk is smaller");
+        assertTrue(uncompressedBuffer.size() < sizeof(AMCData::sJournalChunkHeader) + content.m_Values.size() * (sizeof(uint32_t) + sizeof(int64_t)), "delta encoded chunk is smaller than the raw layout");
+    }
+
+    void test_Version1Chunks() {
+        sChunkContent content;
+        addVariable(content, 2, 0, 100, 1000, 10);
+        addVariable(content, 6, 1, 1, 2000, 10);
+        addVariable(content, 11, 0, 33, 3000, 100000);
+
+        std::vector<uint8_t> chunkBuffer;
+        encodeChunkV1(content, chunkBuffer);
+
+        assertRoundTrip(content, chunkBuffer, false);
+        assertRoundTrip(content, chunkBuffer, true);
+
+        // Version 1 and version 2 chunks may be stored one after another in the same file
+        std::vector<uint8_t> chunkBufferV2;
+        encodeChunk(content, true, true, chunkBufferV2);
+
+        std::vector<uint8_t> fileBuffer = chunkBuffer;
+        fileBuffer.insert(fileBuffer.end(), chunkBufferV2.begin(), chunkBufferV2.end());
+        CUnitTestJournalChunkMemoryFile chunkFile(fileBuffer, false);
+
+        std::vector<LibMCData::sJournalChunkVariableInfo> variableInfo;
+        std::vector<uint32_t> timeStamps;
+        std::vector<int64_t> values;
+        chunkFile.readJournalChunkIntegerData(0, chunkBuffer.size(), variableInfo, timeStamps, values);
+        assertContentEquals(content, variableInfo, timeStamps, values);
+        chunkFile.readJournalChunkIntegerData(chunkBuffer.size(), chunkBufferV2.size(), variableInfo, timeStamps, values);
+        assertContentEquals(content, variableInfo, timeStamps, values);
+    }
+
+    void test_CorruptChunks() {
+        sChunkContent content;
+        addVariable(content, 1, 0, 200, 0, 1000);
+
+        std::vector<uint8_t> chunkBuffer;
+        encodeChunk(content, false, true, chunkBuffer);
+
+        auto readChunkThrows = [](const std::vector<uint8_t>& buffer) {
+            CUnitTestJournalChunkMemoryFile chunkFile(buffer, true);
+            std::vector<LibMCData::sJournalChunkVariableInfo> variableInfo;
+            std::vector<uint32_t> timeStamps;
+            std::vector<int64_t> values;
+            try {
+                chunkFile.readJournalChunkIntegerData(0, chunkFile.getSize(), variableInfo, timeStamps, values);
+            }
+            catch (ELibMCDataInterfaceException&) {
+                return true;
+            }
+            return false;
+        };
+
+        std::vector<uint8_t> truncatedBuffer(chunkBuffer.begin(), chunkBuffer.end() - 1);
+        assertTrue(readChunkThrows(truncatedBuffer), "truncated chunk");
+
+        std::vector<uint8_t> wrongSignatureBuffer = chunkBuffer;
+        wrongSignatureBuffer[0] ^= 0xFF;
+        assertTrue(readChunkThrows(wrongSignatureBuffer), "unknown signature");
+
+        // Cutting the block short while keeping the header consistent must not read past the block
+        AMCData::sJournalChunkHeader chunkHeader;
+        memcpy(&chunkHeader, chunkBuffer.data(), sizeof(chunkHeader));
+        std::vector<uint8_t> shortBlockBuffer(chunkBuffer.begin(), chunkBuffer.end() - 16);
+        chunkHeader.m_nMemorySize = (uint32_t)shortBlockBuffer.size();
+        memcpy(shortBlockBuffer.data(), &chunkHeader, sizeof(chunkHeader));
+        assertTrue(readChunkThrows(shortBlockBuffer), "short block");
+    }
+
+};
+
+}
+
+#endif // __AMCTEST_UNITTEST_JOURNALCHUNKCODEC
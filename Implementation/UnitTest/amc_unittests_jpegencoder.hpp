@@ -0,0 +1,226 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCTEST_UNITTEST_JPEGENCODER
+#define __AMCTEST_UNITTEST_JPEGENCODER
+
+#include "amc_unittests.hpp"
+#include "common_jpeg.hpp"
+#include "common_jpegencoder.hpp"
+
+#include <cmath>
+
+
+namespace AMCUnitTest {
+
+class CUnitTestGroup_JPEGEncoder : public CUnitTestGroup {
+private:
+
+    // Smooth gradients with a few hard edges, similar to a camera view of a build plate.
+    static void createTestImage(uint32_t nWidth, uint32_t nHeight, uint32_t nChannels, std::vector<uint8_t>& imageData)
+    {
+        imageData.resize((size_t)nWidth * nHeight * nChannels);
+        for (uint32_t nY = 0; nY < nHeight; nY++) {
+            for (uint32_t nX = 0; nX < nWidth; nX++) {
+                uint8_t* pPixel = &imageData[((size_t)nY * nWidth + nX) * nChannels];
+                bool bInsideSquare = (nX > nWidth / 4) && (nX < nWidth / 2) && (nY > nHeight / 4) && (nY < nHeight / 2);
+                for (uint32_t nChannel = 0; nChannel < nChannels; nChannel++) {
+                    uint32_t nValue = (nX * 255 / nWidth + nY * 128 / nHeight + nChannel * 40) % 256;
+                    pPixel[nChannel] = bInsideSquare ? 230 : (uint8_t)nValue;
+                }
+            }
+        }
+    }
+
+    double meanAbsoluteError(const std::vector<uint8_t>& expected, const std::vector<uint8_t>& actual, uint32_t nExpectedStride, uint32_t nActualStride, uint32_t nChannels)
+    {
+        assertTrue((expected.size() / nExpectedStride) == (actual.size() / nActualStride), "pixel count");
+        size_t nPixelCount = expected.size() / nExpectedStride;
+
+        double dSum = 0.0;
+        for (size_t nPixel = 0; nPixel < nPixelCount; nPixel++)
+            for (uint32_t nChannel = 0; nChannel < nChannels; nChannel++)
+                dSum += std::abs((int)expected[nPixel * nExpectedStride + nChannel] - (int)actual[nPixel * nActualStride + nChannel]);
+
+        return dSum / (double)(nPixelCount * nChannels);
+    }
+
+public:
+    CUnitTestGroup_JPEGEncoder() = default;
+    virtual ~CUnitTestGroup_JPEGEncoder() = default;
+
+    std::string getTestGroupName() override {
+        return "JPEGEncoder";
+    }
+
+    void initializeTests() override {
+        // Nothing to initialize
+    }
+
+    void registerTests() override {
+        registerTest("GreyScaleRoundTrip", "Greyscale images are encoded as single component JPEGs", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_JPEGEncoder::test_GreyScaleRoundTrip, this));
+        registerTest("RGBRoundTrip", "RGB and RGBA images decode close to their source", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_JPEGEncoder::test_RGBRoundTrip, this));
+        registerTest("YUY2RoundTrip", "YUY2 frames are encoded without RGB conversion", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_JPEGEncoder::test_YUY2RoundTrip, this));
+        registerTest("EncoderReuse", "Reused encoders produce identical streams across frames and sizes", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_JPEGEncoder::test_EncoderReuse, this));
+        registerTest("InvalidInput", "Invalid sizes and buffers are rejected", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_JPEGEncoder::test_InvalidInput, this));
+    }
+
+private:
+
+    void test_GreyScaleRoundTrip() {
+        // Odd sizes exercise the replicated border blocks
+        std::vector<uint8_t> imageData;
+        createTestImage(37, 21, 1, imageData);
+
+        std::vector<uint8_t> jpegData;
+        AMCCommon::CJPEGImageEncoder encoder(37, 21, AMCCommon::eJPEGChannelCount::ccGray, imageData.data(), jpegData, true);
+        assertTrue(jpegData.size() > 0, "encoded data");
+
+        AMCCommon::CJPEGImageDecoder decoder(jpegData.data(), jpegData.size());
+        assertTrue(decoder.getWidth() == 37, "decoded width");
+        assertTrue(decoder.getHeight() == 21, "decoded height");
+        assertTrue(decoder.getChannelCount() == AMCCommon::eJPEGChannelCount::ccGray, "decoded channel count");
+
+        std::vector<uint8_t> decodedData;
+        decoder.writeToBufferGreyScale8bit(decodedData);
+        assertDoubleRange(meanAbsoluteError(imageData, decodedData, 1, 1, 1), 0.0, 3.0);
+    }
+
+    void test_RGBRoundTrip() {
+        for (uint32_t nChannels = 3; nChannels <= 4; nChannels++) {
+            std::vector<uint8_t> imageData;
+            createTestImage(64, 48, nChannels, imageData);
+
+            std::vector<uint8_t> jpegData;
+            AMCCommon::CJPEGImageEncoder encoder(64, 48, (AMCCommon::eJPEGChannelCount)nChannels, imageData.data(), jpegData, true);
+
+            AMCCommon::CJPEGImageDecoder decoder(jpegData.data(), jpegData.size());
+            assertTrue(decoder.getChannelCount() == AMCCommon::eJPEGChannelCount::ccRGB, "decoded channel count");
+
+            std::vector<uint8_t> decodedData;
+            decoder.writeToBufferRGB24bit(decodedData);
+            assertDoubleRange(meanAbsoluteError(imageData, decodedData, nChannels, 3, 3), 0.0, 4.0);
+        }
+    }
+
+    void test_YUY2RoundTrip() {
+        uint32_t nWidth = 50;
+        uint32_t nHeight = 30;
+
+        std::vector<uint8_t> yuy2Data((size_t)nWidth * nHeight * 2);
+        std::vector<uint8_t> expectedRGB((size_t)nWidth * nHeight * 3);
+        for (uint32_t nY = 0; nY < nHeight; nY++) {
+            for (uint32_t nPair = 0; nPair < nWidth / 2; nPair++) {
+                uint8_t* pPair = &yuy2Data[((size_t)nY * nWidth + nPair * 2) * 2];
+                pPair[0] = (uint8_t)(16 + (nPair * 2) * 200 / nWidth);
+                pPair[1] = (uint8_t)(100 + nY);
+                pPair[2] = (uint8_t)(16 + (nPair * 2 + 1) * 200 / nWidth);
+                pPair[3] = (uint8_t)(150 - nY);
+
+                // Video range BT.601, as in CImageData::convertFromYUY2_RGB24bit
+                for (uint32_t nSubPixel = 0; nSubPixel < 2; nSubPixel++) {
+                    int nC = pPair[nSubPixel * 2] - 16;
+                    int nD = pPair[1] - 128;
+                    int nE = pPair[3] - 128;
+                    uint8_t* pRGB = &expectedRGB[((size_t)nY * nWidth + nPair * 2 + nSubPixel) * 3];
+                    pRGB[0] = (uint8_t)std::min(255, std::max(0, (298 * nC + 409 * nE + 128) >> 8));
+                    pRGB[1] = (uint8_t)std::min(255, std::max(0, (298 * nC - 100 * nD - 208 * nE + 128) >> 8));
+                    pRGB[2] = (uint8_t)std::min(255, std::max(0, (298 * nC + 516 * nD + 128) >> 8));
+                }
+            }
+        }
+
+        std::vector<uint8_t> jpegData;
+        AMCCommon::CJPEGImageEncoder encoder(nWidth, nHeight, AMCCommon::eJPEGEncoderInputFormat::ifYUY2, yuy2Data.data(), yuy2Data.size(), jpegData, true);
+
+        AMCCommon::CJPEGImageDecoder decoder(jpegData.data(), jpegData.size());
+        assertTrue(decoder.getWidth() == nWidth, "decoded width");
+        assertTrue(decoder.getHeight() == nHeight, "decoded height");
+
+        std::vector<uint8_t> decodedData;
+        decoder.writeToBufferRGB24bit(decodedData);
+        assertDoubleRange(meanAbsoluteError(expectedRGB, decodedData, 3, 3, 3), 0.0, 4.0);
+    }
+
+    void test_EncoderReuse() {
+        std::vector<uint8_t> largeImage;
+        std::vector<uint8_t> smallImage;
+        createTestImage(160, 120, 3, largeImage);
+        createTestImage(24, 16, 3, smallImage);
+
+        AMCCommon::CJPEGStreamEncoder encoder(JPEGENCODER_DEFAULTQUALITY);
+        std::vector<uint8_t> firstFrame = encoder.encode(160, 120, AMCCommon::eJPEGEncoderInputFormat::ifRGB24bit, largeImage.data(), largeImage.size());
+        std::vector<uint8_t> smallFrame = encoder.encode(24, 16, AMCCommon::eJPEGEncoderInputFormat::ifRGB24bit, smallImage.data(), smallImage.size());
+        std::vector<uint8_t> secondFrame = encoder.encode(160, 120, AMCCommon::eJPEGEncoderInputFormat::ifRGB24bit, largeImage.data(), largeImage.size());
+
+        assertTrue(firstFrame == secondFrame, "identical frames");
+        assertTrue(smallFrame.size() < firstFrame.size(), "small frame");
+
+        AMCCommon::CJPEGStreamEncoder otherEncoder(JPEGENCODER_DEFAULTQUALITY);
+        assertTrue(otherEncoder.encode(24, 16, AMCCommon::eJPEGEncoderInputFormat::ifRGB24bit, smallImage.data(), smallImage.size()) == smallFrame, "independent encoders agree");
+
+        // Lower quality must shrink the stream
+        AMCCommon::CJPEGStreamEncoder lowQualityEncoder(50);
+        assertTrue(lowQualityEncoder.encode(160, 120, AMCCommon::eJPEGEncoderInputFormat::ifRGB24bit, largeImage.data(), largeImage.size()).size() < firstFrame.size(), "lower quality");
+    }
+
+    void test_InvalidInput() {
+        std::vector<uint8_t> imageData(64 * 2, 0);
+        AMCCommon::CJPEGStreamEncoder encoder(JPEGENCODER_DEFAULTQUALITY);
+
+        bool bOddWidthRejected = false;
+        try {
+            encoder.encode(7, 8, AMCCommon::eJPEGEncoderInputFormat::ifYUY2, imageData.data(), imageData.size());
+        }
+        catch (std::exception&) {
+            bOddWidthRejected = true;
+        }
+        assertTrue(bOddWidthRejected, "odd YUY2 width");
+
+        bool bShortBufferRejected = false;
+        try {
+            encoder.encode(8, 8, AMCCommon::eJPEGEncoderInputFormat::ifRGB24bit, imageData.data(), imageData.size());
+        }
+        catch (std::exception&) {
+            bShortBufferRejected = true;
+        }
+        assertTrue(bShortBufferRejected, "short buffer");
+
+        std::vector<uint8_t> jpegData;
+        AMCCommon::CJPEGImageEncoder failingEncoder(8, 8, AMCCommon::eJPEGEncoderInputFormat::ifRGB24bit, imageData.data(), imageData.size(), jpegData, false);
+        assertTrue(jpegData.empty(), "failed encoding leaves no data");
+    }
+
+};
+
+}
+
+#endif // __AMCTEST_UNITTEST_JPEGENCODER
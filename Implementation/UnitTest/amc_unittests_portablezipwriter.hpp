@@ -0,0 +1,306 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCTEST_UNITTEST_PORTABLEZIPWRITER
+#define __AMCTEST_UNITTEST_PORTABLEZIPWRITER
+
+#include "amc_unittests.hpp"
+#include "common_portablezipwriter.hpp"
+#include "common_portablezipwritertypes.hpp"
+#include "common_exportstream_zip.hpp"
+
+#include <cstring>
+
+
+namespace AMCUnitTest {
+
+
+// Export stream into memory, so that written archives can be parsed back.
+class CUnitTestMemoryExportStream : public AMCCommon::CExportStream {
+private:
+    std::vector<uint8_t> m_Data;
+    uint64_t m_nPosition;
+
+public:
+    CUnitTestMemoryExportStream() : m_nPosition(0) {}
+
+    bool seekPosition(uint64_t position, bool bHasToSucceed) override {
+        if (position > m_Data.size()) {
+            if (bHasToSucceed)
+                throw std::runtime_error("invalid seek position");
+            return false;
+        }
+        m_nPosition = position;
+        return true;
+    }
+
+    bool seekForward(uint64_t bytes, bool bHasToSucceed) override {
+        return seekPosition(m_nPosition + bytes, bHasToSucceed);
+    }
+
+    bool seekFromEnd(uint64_t bytes, bool bHasToSucceed) override {
+        if (bytes > m_Data.size()) {
+            if (bHasToSucceed)
+                throw std::runtime_error("invalid seek position");
+            return false;
+        }
+        return seekPosition(m_Data.size() - bytes, bHasToSucceed);
+    }
+
+    uint64_t getPosition() override {
+        return m_nPosition;
+    }
+
+    uint64_t writeBuffer(const void* pBuffer, uint64_t cbTotalBytesToWrite) override {
+        if (m_nPosition + cbTotalBytesToWrite > m_Data.size())
+            m_Data.resize((size_t)(m_nPosition + cbTotalBytesToWrite));
+        memcpy(m_Data.data() + m_nPosition, pBuffer, (size_t)cbTotalBytesToWrite);
+        m_nPosition += cbTotalBytesToWrite;
+        return cbTotalBytesToWrite;
+    }
+
+    void writeZeros(uint64_t bytes) override {
+        std::vector<uint8_t> zeros((size_t)bytes, 0);
+        writeBuffer(zeros.data(), bytes);
+    }
+
+    std::vector<uint8_t>& getData() {
+        return m_Data;
+    }
+};
+
+typedef struct {
+    std::string m_sName;
+    uint16_t m_nCompressionMethod;
+    uint32_t m_nCRC32;
+    std::vector<uint8_t> m_CompressedData;
+} sUnitTestZIPEntry;
+
+
+class CUnitTestGroup_PortableZIPWriter : public CUnitTestGroup {
+private:
+
+    // Half text-like repetitions, half noise, so that blocks neither vanish nor stay incompressible.
+    static std::vector<uint8_t> createTestData(size_t nSize, uint32_t nSeed)
+    {
+        std::vector<uint8_t> data(nSize);
+        uint32_t nNoise = nSeed;
+        for (size_t nIndex = 0; nIndex < nSize; nIndex++) {
+            nNoise = nNoise * 1103515245 + 12345;
+            if ((nIndex / 4096) % 2 == 0)
+                data[nIndex] = (uint8_t)("layer;x=12.5;y=7.25;power=200\n"[nIndex % 30]);
+            else
+                data[nIndex] = (uint8_t)(nNoise >> 16);
+        }
+        return data;
+    }
+
+    // Walks the local file headers of a ZIP64 archive written by CPortableZIPWriter.
+    std::vector<sUnitTestZIPEntry> readEntries(const std::vector<uint8_t>& archive, size_t nEntryCount)
+    {
+        std::vector<sUnitTestZIPEntry> entries;
+        size_t nPosition = 0;
+        for (size_t nEntryIndex = 0; nEntryIndex < nEntryCount; nEntryIndex++) {
+            AMCCommon::ZIPLOCALFILEHEADER localHeader;
+            assertTrue(nPosition + sizeof(localHeader) <= archive.size(), "local header in archive");
+            memcpy(&localHeader, &archive[nPosition], sizeof(localHeader));
+            assertTrue(localHeader.m_nSignature == ZIPFILEHEADERSIGNATURE, "local header signature");
+            nPosition += sizeof(localHeader);
+
+            sUnitTestZIPEntry entry;
+            entry.m_sName = std::string((const char*)&archive[nPosition], localHeader.m_nFileNameLength);
+            entry.m_nCompressionMethod = localHeader.m_nCompressionMethod;
+            entry.m_nCRC32 = localHeader.m_nCRC32;
+            nPosition += localHeader.m_nFileNameLength;
+
+            AMCCommon::ZIP64EXTRAINFORMATIONFIELD extraField;
+            assertTrue(localHeader.m_nExtraFieldLength == sizeof(extraField), "zip64 extra field");
+            memcpy(&extraField, &archive[nPosition], sizeof(extraField));
+            nPosition += sizeof(extraField);
+
+            assertTrue(nPosition + extraField.m_nCompressedSize <= archive.size(), "entry data in archive");
+            entry.m_CompressedData.assign(archive.begin() + nPosition, archive.begin() + (size_t)(nPosition + extraField.m_nCompressedSize));
+            nPosition += (size_t)extraField.m_nCompressedSize;
+
+            entries.push_back(entry);
+        }
+        return entries;
+    }
+
+    std::vector<uint8_t> inflateEntry(const sUnitTestZIPEntry& entry, size_t nExpectedSize)
+    {
+        if (entry.m_nCompressionMethod == ZIPFILECOMPRESSION_UNCOMPRESSED)
+            return entry.m_CompressedData;
+
+        assertTrue(entry.m_nCompressionMethod == ZIPFILECOMPRESSION_DEFLATED, "compression method");
+
+        std::vector<uint8_t> result(nExpectedSize + 1);
+        z_stream stream;
+        memset(&stream, 0, sizeof(stream));
+        assertTrue(inflateInit2(&stream, -15) == Z_OK, "inflate init");
+
+        stream.next_in = (Bytef*)entry.m_CompressedData.data();
+        stream.avail_in = (uInt)entry.m_CompressedData.size();
+        stream.next_out = result.data();
+        stream.avail_out = (uInt)result.size();
+        int nResult = inflate(&stream, Z_FINISH);
+        size_t nInflatedSize = result.size() - stream.avail_out;
+        inflateEnd(&stream);
+
+        assertTrue(nResult == Z_STREAM_END, "deflate stream is complete");
+        result.resize(nInflatedSize);
+        return result;
+    }
+
+    std::vector<uint8_t> writeArchive(const std::vector<std::pair<std::string, std::vector<uint8_t>>>& contents, uint32_t nWorkerCount, int32_t nCompressionLevel, bool bStoreCompressedFileTypes)
+    {
+        auto pStream = std::make_shared<CUnitTestMemoryExportStream>();
+        {
+            AMCCommon::CPortableZIPWriter zipWriter(pStream, true);
+            zipWriter.setWorkerCount(nWorkerCount);
+            zipWriter.setCompressionLevel(nCompressionLevel);
+            zipWriter.setStoreCompressedFileTypes(bStoreCompressedFileTypes);
+
+            for (auto& content : contents) {
+                auto pEntryStream = zipWriter.createEntry(content.first, 0);
+
+                // Write in uneven pieces to cross block boundaries at arbitrary offsets
+                size_t nOffset = 0;
+                size_t nPieceSize = 777;
+                while (nOffset < content.second.size()) {
+                    size_t nCount = std::min(nPieceSize, content.second.size() - nOffset);
+                    pEntryStream->writeBuffer(content.second.data() + nOffset, nCount);
+                    nOffset += nCount;
+                    nPieceSize = nPieceSize * 3 + 1;
+                }
+                assertTrue(pEntryStream->getPosition() == content.second.size(), "entry stream position");
+            }
+
+            zipWriter.writeDirectory();
+        }
+        return pStream->getData();
+    }
+
+    std::vector<std::pair<std::string, std::vector<uint8_t>>> createContents()
+    {
+        std::vector<std::pair<std::string, std::vector<uint8_t>>> contents;
+        contents.push_back(std::make_pair("empty.txt", std::vector<uint8_t>()));
+        contents.push_back(std::make_pair("small.txt", createTestData(100, 1)));
+        contents.push_back(std::make_pair("blocksize.bin", createTestData(ZIPEXPORTBLOCKSIZE * 2, 2)));
+        contents.push_back(std::make_pair("layers/large.bin", createTestData(ZIPEXPORTBLOCKSIZE * 5 + 12345, 3)));
+        contents.push_back(std::make_pair("image.png", createTestData(200000, 4)));
+        return contents;
+    }
+
+public:
+    CUnitTestGroup_PortableZIPWriter() = default;
+    virtual ~CUnitTestGroup_PortableZIPWriter() = default;
+
+    std::string getTestGroupName() override {
+        return "PortableZIPWriter";
+    }
+
+    void initializeTests() override {
+        // Nothing to initialize
+    }
+
+    void registerTests() override {
+        registerTest("ParallelDeflateRoundTrip", "Block parallel deflated entries inflate to their content and checksum", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_PortableZIPWriter::test_ParallelDeflateRoundTrip, this));
+        registerTest("WorkerCountIndependence", "The archive does not depend on the number of workers", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_PortableZIPWriter::test_WorkerCountIndependence, this));
+        registerTest("StoreCompressedFileTypes", "Already compressed file types are stored", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_PortableZIPWriter::test_StoreCompressedFileTypes, this));
+        registerTest("CompressionLevels", "Higher compression levels round trip and do not grow the archive", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_PortableZIPWriter::test_CompressionLevels, this));
+    }
+
+private:
+
+    void checkArchive(const std::vector<uint8_t>& archive, const std::vector<std::pair<std::string, std::vector<uint8_t>>>& contents)
+    {
+        auto entries = readEntries(archive, contents.size());
+        for (size_t nIndex = 0; nIndex < contents.size(); nIndex++) {
+            auto& expectedData = contents[nIndex].second;
+            assertTrue(entries[nIndex].m_sName == contents[nIndex].first, "entry name");
+
+            auto inflatedData = inflateEntry(entries[nIndex], expectedData.size());
+            assertTrue(inflatedData == expectedData, "entry content of " + contents[nIndex].first);
+
+            uint32_t nCRC32 = (uint32_t)crc32(0, expectedData.data(), (uInt)expectedData.size());
+            assertTrue(entries[nIndex].m_nCRC32 == nCRC32, "entry checksum of " + contents[nIndex].first);
+        }
+    }
+
+    void test_ParallelDeflateRoundTrip() {
+        auto contents = createContents();
+        auto archive = writeArchive(contents, 4, 1, false);
+        checkArchive(archive, contents);
+    }
+
+    void test_WorkerCountIndependence() {
+        auto contents = createContents();
+        auto singleWorkerArchive = writeArchive(contents, 1, 1, false);
+        auto multiWorkerArchive = writeArchive(contents, 3, 1, false);
+        assertTrue(singleWorkerArchive == multiWorkerArchive, "identical archives");
+    }
+
+    void test_StoreCompressedFileTypes() {
+        auto contents = createContents();
+        auto archive = writeArchive(contents, 2, 1, true);
+        checkArchive(archive, contents);
+
+        auto entries = readEntries(archive, contents.size());
+        for (auto& entry : entries) {
+            uint16_t nExpectedMethod = (entry.m_sName == "image.png") ? ZIPFILECOMPRESSION_UNCOMPRESSED : ZIPFILECOMPRESSION_DEFLATED;
+            assertTrue(entry.m_nCompressionMethod == nExpectedMethod, "compression method of " + entry.m_sName);
+        }
+    }
+
+    void test_CompressionLevels() {
+        auto contents = createContents();
+        auto fastArchive = writeArchive(contents, 2, 1, false);
+        auto smallArchive = writeArchive(contents, 2, 9, false);
+        checkArchive(smallArchive, contents);
+        assertTrue(smallArchive.size() <= fastArchive.size(), "level 9 archive is not larger");
+
+        bool bInvalidLevelRejected = false;
+        try {
+            AMCCommon::CPortableZIPWriter zipWriter(std::make_shared<CUnitTestMemoryExportStream>(), true);
+            zipWriter.setCompressionLevel(10);
+        }
+        catch (std::exception&) {
+            bInvalidLevelRejected = true;
+        }
+        assertTrue(bInvalidLevelRejected, "invalid compression level is rejected");
+    }
+
+};
+
+}
+
+#endif // __AMCTEST_UNITTEST_PORTABLEZIPWRITER
@@ -0,0 +1,196 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCTEST_UNITTEST_PROCESSDIRECTORYWRITER
+#define __AMCTEST_UNITTEST_PROCESSDIRECTORYWRITER
+
+#include "amc_unittests.hpp"
+#include "amc_processdirectory.hpp"
+#include "common_utils.hpp"
+
+#include <fstream>
+#include <iterator>
+
+
+namespace AMCUnitTest {
+
+
+class CUnitTestGroup_ProcessDirectoryWriter : public CUnitTestGroup {
+public:
+    CUnitTestGroup_ProcessDirectoryWriter() = default;
+    virtual ~CUnitTestGroup_ProcessDirectoryWriter() = default;
+
+    std::string getTestGroupName() override {
+        return "ProcessDirectoryWriter";
+    }
+
+    void initializeTests() override {
+        // Nothing to initialize
+    }
+
+    void registerTests() override {
+        registerTest("SynchronousWriter", "Writes small and large chunks in synchronous mode", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ProcessDirectoryWriter::test_SynchronousWriter, this));
+        registerTest("AsynchronousWriter", "Writes small and large chunks in asynchronous mode", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ProcessDirectoryWriter::test_AsynchronousWriter, this));
+        registerTest("SharedWriteQueue", "Interleaves several asynchronous writers on one I/O thread", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ProcessDirectoryWriter::test_SharedWriteQueue, this));
+        registerTest("WriteAfterFinish", "Rejects writes to finished files", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ProcessDirectoryWriter::test_WriteAfterFinish, this));
+    }
+
+private:
+
+    static std::vector<uint8_t> createTestData(uint64_t nSize, uint32_t nSeed) {
+        std::vector<uint8_t> data(nSize);
+        uint32_t nState = nSeed;
+        for (auto& nValue : data) {
+            nState = nState * 1664525 + 1013904223;
+            nValue = (uint8_t)(nState >> 24);
+        }
+        return data;
+    }
+
+    static std::string createTempFileName() {
+        return AMCCommon::CUtils::findTemporaryFileName(AMCCommon::CUtils::getTempFolder(), "amcunittest_", ".bin", 1024);
+    }
+
+    static std::vector<uint8_t> readFile(const std::string& sFileName) {
+        std::ifstream stream(sFileName, std::ios::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+
+    // Writes chunks that are smaller than, equal to and larger than the 1kB buffer.
+    void writeChunks(AMC::CProcessDirectoryWriter& writer, const std::vector<uint8_t>& data) {
+        const uint64_t chunkSizes[] = { 1, 100, 1024, 3000, 17, 5000, 1023 };
+        uint64_t nPosition = 0;
+        uint32_t nChunkIndex = 0;
+        while (nPosition < data.size()) {
+            uint64_t nChunkSize = std::min<uint64_t>(chunkSizes[nChunkIndex % 7], data.size() - nPosition);
+            writer.writeData(data.data() + nPosition, nChunkSize);
+            nPosition += nChunkSize;
+            nChunkIndex++;
+        }
+    }
+
+    void test_SynchronousWriter() {
+        std::string sFileName = createTempFileName();
+        auto data = createTestData(100000, 1);
+
+        {
+            AMC::CProcessDirectoryWriter writer(sFileName, sFileName, 1);
+            assertTrue(writer.getMode() == AMC::eProcessDirectoryWriterMode::Synchronous, "writer mode");
+            writeChunks(writer, data);
+            assertIntegerRange(writer.getWrittenBytes(), data.size(), data.size(), "written bytes");
+            writer.finish();
+            assertTrue(writer.isFinished(), "writer finished");
+        }
+
+        assertTrue(readFile(sFileName) == data, "file content");
+        AMCCommon::CUtils::deleteFileFromDisk(sFileName, true);
+    }
+
+    void test_AsynchronousWriter() {
+        std::string sFileName = createTempFileName();
+        auto data = createTestData(100000, 2);
+        auto pWriteQueue = std::make_shared<AMC::CAsyncFileWriteQueue>();
+
+        {
+            AMC::CProcessDirectoryWriter writer(sFileName, sFileName, 1, pWriteQueue, true);
+            assertTrue(writer.getMode() == AMC::eProcessDirectoryWriterMode::Asynchronous, "writer mode");
+            writeChunks(writer, data);
+            assertIntegerRange(writer.getWrittenBytes(), data.size(), data.size(), "written bytes");
+
+            writer.flushBuffer();
+            assertTrue(readFile(sFileName) == data, "flushed file content");
+            writer.finish();
+        }
+
+        assertTrue(readFile(sFileName) == data, "file content");
+        AMCCommon::CUtils::deleteFileFromDisk(sFileName, true);
+    }
+
+    void test_SharedWriteQueue() {
+        auto pWriteQueue = std::make_shared<AMC::CAsyncFileWriteQueue>();
+
+        std::vector<std::string> fileNames;
+        std::vector<std::vector<uint8_t>> fileData;
+        std::vector<AMC::PProcessDirectoryWriter> writers;
+        for (uint32_t nIndex = 0; nIndex < 4; nIndex++) {
+            std::string sFileName = createTempFileName();
+            fileNames.push_back(sFileName);
+            fileData.push_back(createTestData(50000 + nIndex * 777, 10 + nIndex));
+            writers.push_back(std::make_shared<AMC::CProcessDirectoryWriter>(sFileName, sFileName, 2, pWriteQueue, false));
+        }
+
+        for (uint64_t nPosition = 0; nPosition < 60000; nPosition += 333) {
+            for (uint32_t nIndex = 0; nIndex < 4; nIndex++) {
+                auto& data = fileData.at(nIndex);
+                if (nPosition < data.size())
+                    writers.at(nIndex)->writeData(data.data() + nPosition, std::min<uint64_t>(333, data.size() - nPosition));
+            }
+        }
+
+        // Destroying the writers finishes the files.
+        writers.clear();
+        pWriteQueue = nullptr;
+
+        for (uint32_t nIndex = 0; nIndex < 4; nIndex++) {
+            assertTrue(readFile(fileNames.at(nIndex)) == fileData.at(nIndex), "file content");
+            AMCCommon::CUtils::deleteFileFromDisk(fileNames.at(nIndex), true);
+        }
+    }
+
+    void test_WriteAfterFinish() {
+        std::string sFileName = createTempFileName();
+        auto pWriteQueue = std::make_shared<AMC::CAsyncFileWriteQueue>();
+
+        AMC::CProcessDirectoryWriter writer(sFileName, sFileName, 1, pWriteQueue, false);
+        uint8_t nValue = 42;
+        writer.writeData(&nValue, 1);
+        writer.finish();
+
+        bool bFailed = false;
+        try {
+            writer.writeData(&nValue, 1);
+        }
+        catch (std::exception&) {
+            bFailed = true;
+        }
+        assertTrue(bFailed, "write after finish");
+
+        // Finishing twice is allowed.
+        writer.finish();
+        assertIntegerRange((int64_t)readFile(sFileName).size(), 1, 1, "file size");
+        AMCCommon::CUtils::deleteFileFromDisk(sFileName, true);
+    }
+
+};
+
+}
+
+#endif // __AMCTEST_UNITTEST_PROCESSDIRECTORYWRITER
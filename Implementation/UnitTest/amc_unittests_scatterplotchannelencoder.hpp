@@ -0,0 +1,281 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCTEST_UNITTEST_SCATTERPLOTCHANNELENCODER
+#define __AMCTEST_UNITTEST_SCATTERPLOTCHANNELENCODER
+
+#include "amc_unittests.hpp"
+#include "amc_scatterplotchannelencoder.hpp"
+
+#include "RapidJSON/document.h"
+#include "lz4/lz4.h"
+
+#include <cmath>
+#include <cstring>
+
+
+namespace AMCUnitTest {
+
+
+class CUnitTestGroup_ScatterplotChannelEncoder : public CUnitTestGroup {
+private:
+
+    static AMC::PScatterplot createScatterplot(size_t nPointCount)
+    {
+        auto pScatterplot = std::make_shared<AMC::CScatterplot>("e4a7f1c2-3b5d-4e6f-8a9b-0c1d2e3f4a5b");
+        pScatterplot->getEntries().resize(nPointCount);
+
+        // Value pointers are only valid until the next column is added
+        double* pPower = pScatterplot->addChannelColumn("laser", "power", nPointCount);
+        for (size_t nIndex = 0; nIndex < nPointCount; nIndex++)
+            pPower[nIndex] = 100.0 + 50.0 * std::sin((double)nIndex * 0.01);
+
+        double* pLaserOn = pScatterplot->addChannelColumn("laser", "laseron", nPointCount);
+        for (size_t nIndex = 0; nIndex < nPointCount; nIndex++)
+            pLaserOn[nIndex] = (double)((nIndex / 100) % 2);
+
+        return pScatterplot;
+    }
+
+    // Parses the header of an encoded channel and returns the start of the chunk data.
+    size_t parseHeader(const std::vector<uint8_t>& buffer, rapidjson::Document& header)
+    {
+        assertTrue(buffer.size() >= 8, "buffer holds prefix");
+        uint32_t nPrefix[2];
+        memcpy(nPrefix, buffer.data(), sizeof(nPrefix));
+        assertTrue(nPrefix[0] == AMC_SCATTERPLOTCHANNEL_SIGNATURE, "signature");
+        assertIntegerRange(nPrefix[1] % 4, 0, 0, "header is padded");
+
+        std::string sHeader((const char*)buffer.data() + 8, nPrefix[1]);
+        header.Parse(sHeader.c_str());
+        assertFalse(header.HasParseError(), "header is valid JSON");
+
+        return 8 + (size_t)nPrefix[1];
+    }
+
+    // Decodes all chunks of a column back into doubles.
+    std::vector<double> decodeColumn(const std::vector<uint8_t>& buffer, const rapidjson::Document& header, size_t nDataStart, uint32_t nColumnIndex)
+    {
+        auto& column = header["columns"][nColumnIndex];
+        double dScale = column["scale"].GetDouble();
+        double dOffset = column["offset"].GetDouble();
+        bool bInt16 = (std::string(header["encoding"].GetString()) == AMC_SCATTERPLOTCHANNEL_ENCODING_INT16);
+        size_t nEntrySize = bInt16 ? sizeof(int16_t) : sizeof(float);
+
+        std::vector<double> values(column["valuecount"].GetUint64());
+        std::vector<uint8_t> rawChunk;
+
+        for (auto& chunk : header["chunks"].GetArray()) {
+            if (chunk["column"].GetUint() != nColumnIndex)
+                continue;
+
+            size_t nFirstPoint = chunk["firstpoint"].GetUint64();
+            size_t nPointCount = chunk["pointcount"].GetUint64();
+            size_t nOffset = nDataStart + chunk["offset"].GetUint64();
+            size_t nSize = chunk["size"].GetUint64();
+            assertTrue(nOffset + nSize <= buffer.size(), "chunk within buffer");
+            assertIntegerRange(nOffset % 4, 0, 0, "chunk is aligned");
+
+            rawChunk.resize(nPointCount * nEntrySize);
+            if (chunk["compressed"].GetBool()) {
+                int nDecompressed = LZ4_decompress_safe((const char*)buffer.data() + nOffset, (char*)rawChunk.data(), (int)nSize, (int)rawChunk.size());
+                assertIntegerRange(nDecompressed, (int64_t)rawChunk.size(), (int64_t)rawChunk.size(), "decompressed size");
+            }
+            else {
+                assertIntegerRange((int64_t)nSize, (int64_t)rawChunk.size(), (int64_t)rawChunk.size(), "raw chunk size");
+                memcpy(rawChunk.data(), buffer.data() + nOffset, nSize);
+            }
+
+            for (size_t nIndex = 0; nIndex < nPointCount; nIndex++) {
+                if (bInt16) {
+                    int16_t nValue;
+                    memcpy(&nValue, rawChunk.data() + nIndex * nEntrySize, sizeof(nValue));
+                    values.at(nFirstPoint + nIndex) = dOffset + dScale * nValue;
+                }
+                else {
+                    float fValue;
+                    memcpy(&fValue, rawChunk.data() + nIndex * nEntrySize, sizeof(fValue));
+                    values.at(nFirstPoint + nIndex) = fValue;
+                }
+            }
+        }
+
+        return values;
+    }
+
+public:
+    CUnitTestGroup_ScatterplotChannelEncoder() = default;
+    virtual ~CUnitTestGroup_ScatterplotChannelEncoder() = default;
+
+    std::string getTestGroupName() override {
+        return "ScatterplotChannelEncoder";
+    }
+
+    void initializeTests() override {
+        // Nothing to initialize
+    }
+
+    void registerTests() override {
+        registerTest("ChannelColumns", "Stores channel columns in flat arrays and rejects duplicates", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ScatterplotChannelEncoder::test_ChannelColumns, this));
+        registerTest("Float32", "Encodes channels as chunked float32 columns", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ScatterplotChannelEncoder::test_Float32, this));
+        registerTest("Int16LZ4", "Encodes channels as quantized and compressed int16 columns", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ScatterplotChannelEncoder::test_Int16LZ4, this));
+        registerTest("ChannelPointCount", "Writes the point count of the channel instead of the scatterplot", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ScatterplotChannelEncoder::test_ChannelPointCount, this));
+        registerTest("UnknownChannel", "Encodes unknown channels without columns", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ScatterplotChannelEncoder::test_UnknownChannel, this));
+    }
+
+private:
+
+    void test_ChannelColumns() {
+        auto pScatterplot = createScatterplot(1000);
+
+        uint32_t nChannelID = 0;
+        assertTrue(pScatterplot->findChannel("laser", nChannelID), "channel exists");
+        assertFalse(pScatterplot->findChannel("power", nChannelID), "column names are not channels");
+
+        pScatterplot->findChannel("laser", nChannelID);
+        std::vector<AMC::sScatterplotChannelColumn> channelColumns;
+        pScatterplot->getChannelColumns(nChannelID, channelColumns);
+        assertIntegerRange((int64_t)channelColumns.size(), 2, 2, "column count");
+        assertTrue(pScatterplot->getInternedName(channelColumns.at(0).m_nColumnID) == "laseron", "columns are sorted by name");
+        assertTrue(pScatterplot->getInternedName(channelColumns.at(1).m_nColumnID) == "power", "columns are sorted by name");
+        assertIntegerRange((int64_t)channelColumns.at(0).m_nValueOffset, 1000, 1000, "columns are contiguous");
+        assertIntegerRange((int64_t)channelColumns.at(1).m_nValueOffset, 0, 0, "columns are contiguous");
+
+        bool bThrown = false;
+        try {
+            pScatterplot->addChannelColumn("laser", "power", 10);
+        }
+        catch (...) {
+            bThrown = true;
+        }
+        assertTrue(bThrown, "duplicate column is rejected");
+
+        pScatterplot->addChannelColumn("melt", "power", 10);
+        assertTrue(pScatterplot->findChannel("melt", nChannelID), "column name can be reused in another channel");
+        assertIntegerRange((int64_t)pScatterplot->getChannelPointCount(nChannelID), 10, 10, "channel point count");
+
+        // Reserved values keep the column pointers valid
+        auto pReservedScatterplot = std::make_shared<AMC::CScatterplot>("e4a7f1c2-3b5d-4e6f-8a9b-0c1d2e3f4a5b");
+        pReservedScatterplot->reserveChannelValues(3 * 500);
+        double* pFirstValues = pReservedScatterplot->addChannelColumn("melt", "a", 500);
+        double* pSecondValues = pReservedScatterplot->addChannelColumn("melt", "b", 500);
+        double* pThirdValues = pReservedScatterplot->addChannelColumn("spatter", "a", 500);
+        assertTrue(pSecondValues == pFirstValues + 500, "second column follows the first");
+        assertTrue(pThirdValues == pFirstValues + 1000, "third column follows the second");
+    }
+
+    void test_Float32() {
+        auto pScatterplot = createScatterplot(150000);
+
+        std::vector<uint8_t> buffer;
+        AMC::CScatterplotChannelEncoder::encodeChannel(pScatterplot.get(), "laser", AMC::eScatterplotChannelEncoding::ceFloat32, false, 65536, buffer);
+
+        rapidjson::Document header;
+        size_t nDataStart = parseHeader(buffer, header);
+        assertIntegerRange(header["pointcount"].GetUint64(), 150000, 150000, "point count");
+        assertIntegerRange(header["columns"].Size(), 2, 2, "column count");
+        assertTrue(std::string(header["columns"][0]["name"].GetString()) == "laseron", "columns are sorted by name");
+        assertTrue(std::string(header["columns"][1]["name"].GetString()) == "power", "columns are sorted by name");
+        assertIntegerRange(header["chunks"].Size(), 6, 6, "three chunks per column");
+        assertIntegerRange((int64_t)buffer.size(), (int64_t)(nDataStart + 2 * 150000 * sizeof(float)), (int64_t)(nDataStart + 2 * 150000 * sizeof(float)), "buffer size");
+
+        uint32_t nChannelID = 0;
+        std::vector<AMC::sScatterplotChannelColumn> channelColumns;
+        pScatterplot->findChannel("laser", nChannelID);
+        pScatterplot->getChannelColumns(nChannelID, channelColumns);
+
+        for (uint32_t nColumnIndex = 0; nColumnIndex < 2; nColumnIndex++) {
+            auto values = decodeColumn(buffer, header, nDataStart, nColumnIndex);
+            const double* pExpected = pScatterplot->getColumnValues(channelColumns.at(nColumnIndex));
+            for (size_t nIndex = 0; nIndex < values.size(); nIndex++)
+                assertTrue(values.at(nIndex) == (double)(float)pExpected[nIndex], "float32 value");
+        }
+    }
+
+    void test_Int16LZ4() {
+        auto pScatterplot = createScatterplot(150000);
+
+        std::vector<uint8_t> buffer;
+        AMC::CScatterplotChannelEncoder::encodeChannel(pScatterplot.get(), "laser", AMC::eScatterplotChannelEncoding::ceInt16, true, 65536, buffer);
+
+        rapidjson::Document header;
+        size_t nDataStart = parseHeader(buffer, header);
+        assertTrue(buffer.size() < nDataStart + 2 * 150000 * sizeof(int16_t), "compressed chunks are smaller");
+
+        uint32_t nChannelID = 0;
+        std::vector<AMC::sScatterplotChannelColumn> channelColumns;
+        pScatterplot->findChannel("laser", nChannelID);
+        pScatterplot->getChannelColumns(nChannelID, channelColumns);
+
+        for (uint32_t nColumnIndex = 0; nColumnIndex < 2; nColumnIndex++) {
+            double dScale = header["columns"][nColumnIndex]["scale"].GetDouble();
+            auto values = decodeColumn(buffer, header, nDataStart, nColumnIndex);
+            const double* pExpected = pScatterplot->getColumnValues(channelColumns.at(nColumnIndex));
+            for (size_t nIndex = 0; nIndex < values.size(); nIndex++)
+                assertDoubleRange(values.at(nIndex), pExpected[nIndex] - dScale, pExpected[nIndex] + dScale, "quantized value");
+        }
+    }
+
+    void test_ChannelPointCount() {
+        auto pScatterplot = createScatterplot(1000);
+        double* pValues = pScatterplot->addChannelColumn("melt", "intensity", 250);
+        for (size_t nIndex = 0; nIndex < 250; nIndex++)
+            pValues[nIndex] = (double)nIndex;
+
+        std::vector<uint8_t> buffer;
+        AMC::CScatterplotChannelEncoder::encodeChannel(pScatterplot.get(), "melt", AMC::eScatterplotChannelEncoding::ceFloat32, false, 65536, buffer);
+
+        rapidjson::Document header;
+        parseHeader(buffer, header);
+        assertIntegerRange(header["pointcount"].GetUint64(), 250, 250, "point count of the channel");
+        assertIntegerRange(header["columns"][0]["valuecount"].GetUint64(), 250, 250, "value count");
+    }
+
+    void test_UnknownChannel() {
+        auto pScatterplot = createScatterplot(100);
+
+        std::vector<uint8_t> buffer;
+        AMC::CScatterplotChannelEncoder::encodeChannel(pScatterplot.get(), "unknown", AMC::eScatterplotChannelEncoding::ceFloat32, true, 65536, buffer);
+
+        rapidjson::Document header;
+        size_t nDataStart = parseHeader(buffer, header);
+        assertIntegerRange(header["columns"].Size(), 0, 0, "no columns");
+        assertIntegerRange(header["pointcount"].GetUint64(), 0, 0, "no points");
+        assertIntegerRange((int64_t)buffer.size(), (int64_t)nDataStart, (int64_t)nDataStart, "no chunk data");
+    }
+
+};
+
+
+}
+
+
+#endif // __AMCTEST_UNITTEST_SCATTERPLOTCHANNELENCODER
@@ -0,0 +1,298 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCTEST_UNITTEST_STATEJOURNALAGGREGATOR
+#define __AMCTEST_UNITTEST_STATEJOURNALAGGREGATOR
+
+#include "amc_unittests.hpp"
+#include "amc_statejournalaggregator.hpp"
+
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cmath>
+
+
+namespace AMCUnitTest {
+
+
+class CUnitTestGroup_StateJournalAggregator : public CUnitTestGroup {
+private:
+
+    struct sTestChunk {
+        uint64_t m_nStartTimeStamp;
+        std::vector<uint32_t> m_TimeStamps;
+        std::vector<int64_t> m_Values;
+    };
+
+    // Creates consecutive chunks of random length with sorted, chunk relative time stamps.
+    static std::vector<sTestChunk> createRandomChunks(uint32_t nSeed, uint32_t nChunkCount, uint64_t nChunkInterval, uint32_t nMaxEntriesPerChunk)
+    {
+        std::mt19937 generator(nSeed);
+        std::uniform_int_distribution<uint32_t> countDistribution(0, nMaxEntriesPerChunk);
+        std::uniform_int_distribution<uint32_t> timeDistribution(0, (uint32_t)(nChunkInterval - 1));
+        std::uniform_int_distribution<int64_t> valueDistribution(-1000000, 1000000);
+
+        std::vector<sTestChunk> chunks(nChunkCount);
+        for (uint32_t nChunkIndex = 0; nChunkIndex < nChunkCount; nChunkIndex++) {
+            auto& chunk = chunks.at(nChunkIndex);
+            chunk.m_nStartTimeStamp = nChunkIndex * nChunkInterval;
+
+            uint32_t nEntryCount = countDistribution(generator);
+            for (uint32_t nIndex = 0; nIndex < nEntryCount; nIndex++)
+                chunk.m_TimeStamps.push_back(timeDistribution(generator));
+            std::sort(chunk.m_TimeStamps.begin(), chunk.m_TimeStamps.end());
+            chunk.m_TimeStamps.erase(std::unique(chunk.m_TimeStamps.begin(), chunk.m_TimeStamps.end()), chunk.m_TimeStamps.end());
+
+            for (size_t nIndex = 0; nIndex < chunk.m_TimeStamps.size(); nIndex++)
+                chunk.m_Values.push_back(valueDistribution(generator));
+        }
+
+        return chunks;
+    }
+
+    // Brute force reference: scans all entries for every bucket.
+    void assertMatchesReference(AMC::CStateJournalBucketAggregator& aggregator, const std::vector<sTestChunk>& chunks)
+    {
+        uint64_t nStartTimeStamp = aggregator.getStartTimeStamp();
+        uint64_t nInterval = aggregator.getIntervalInMicroseconds();
+
+        for (uint32_t nBucketIndex = 0; nBucketIndex < aggregator.getBucketCount(); nBucketIndex++) {
+            uint64_t nBucketStart = nStartTimeStamp + nBucketIndex * nInterval;
+            uint64_t nBucketEnd = nBucketStart + nInterval;
+
+            uint32_t nCount = 0;
+            int64_t nMin = 0;
+            int64_t nMax = 0;
+            int64_t nLast = 0;
+            double dSum = 0.0;
+            for (auto& chunk : chunks) {
+                for (size_t nIndex = 0; nIndex < chunk.m_TimeStamps.size(); nIndex++) {
+                    uint64_t nTimeStamp = chunk.m_nStartTimeStamp + chunk.m_TimeStamps.at(nIndex);
+                    if ((nTimeStamp >= nBucketStart) && (nTimeStamp < nBucketEnd)) {
+                        int64_t nValue = chunk.m_Values.at(nIndex);
+                        nMin = (nCount == 0) ? nValue : std::min(nMin, nValue);
+                        nMax = (nCount == 0) ? nValue : std::max(nMax, nValue);
+                        nLast = nValue;
+                        dSum += (double)nValue;
+                        nCount++;
+                    }
+                }
+            }
+
+            auto& bucket = aggregator.getBucket(nBucketIndex);
+            assertIntegerRange(bucket.m_nSampleCount, nCount, nCount, "sample count of bucket " + std::to_string(nBucketIndex));
+            if (nCount > 0) {
+                assertIntegerRange(bucket.m_nMinValue, nMin, nMin, "min of bucket " + std::to_string(nBucketIndex));
+                assertIntegerRange(bucket.m_nMaxValue, nMax, nMax, "max of bucket " + std::to_string(nBucketIndex));
+                assertIntegerRange(bucket.m_nLastValue, nLast, nLast, "last of bucket " + std::to_string(nBucketIndex));
+                assertDoubleRange(bucket.m_dValueSum, dSum - 1.0E-6, dSum + 1.0E-6, "sum of bucket " + std::to_string(nBucketIndex));
+            }
+        }
+    }
+
+    static void addChunkSummary(AMC::CStateJournalBucketAggregator& aggregator, const sTestChunk& chunk, bool & bAccepted)
+    {
+        bAccepted = true;
+        if (chunk.m_TimeStamps.empty())
+            return;
+
+        int64_t nMin = *std::min_element(chunk.m_Values.begin(), chunk.m_Values.end());
+        int64_t nMax = *std::max_element(chunk.m_Values.begin(), chunk.m_Values.end());
+        double dSum = 0.0;
+        for (auto nValue : chunk.m_Values)
+            dSum += (double)nValue;
+
+        bAccepted = aggregator.addSummary(chunk.m_nStartTimeStamp + chunk.m_TimeStamps.front(), chunk.m_nStartTimeStamp + chunk.m_TimeStamps.back(), (uint32_t)chunk.m_TimeStamps.size(), nMin, nMax, chunk.m_Values.back(), dSum);
+    }
+
+public:
+    CUnitTestGroup_StateJournalAggregator() = default;
+    virtual ~CUnitTestGroup_StateJournalAggregator() = default;
+
+    std::string getTestGroupName() override {
+        return "StateJournalAggregator";
+    }
+
+    void initializeTests() override {
+        // Nothing to initialize
+    }
+
+    void registerTests() override {
+        registerTest("EntriesMatchReference", "Aggregates raw entries at several bucket sizes and compares with a brute force scan", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournalAggregator::test_EntriesMatchReference, this));
+        registerTest("SummariesMatchReference", "Uses chunk summaries where possible and compares with a brute force scan", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournalAggregator::test_SummariesMatchReference, this));
+        registerTest("MergeInAnyOrder", "Merges partial results in shuffled order and compares with a brute force scan", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournalAggregator::test_MergeInAnyOrder, this));
+        registerTest("SummaryAcrossBuckets", "Rejects summaries that span more than one bucket or leave the range", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournalAggregator::test_SummaryAcrossBuckets, this));
+        registerTest("BucketStatisticsUnits", "Scales statistics by the variable units", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournalAggregator::test_BucketStatisticsUnits, this));
+        registerTest("InvalidBucketParameters", "Rejects zero intervals and bucket counts", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournalAggregator::test_InvalidBucketParameters, this));
+    }
+
+private:
+
+    void test_EntriesMatchReference() {
+        const uint64_t nChunkInterval = 12000000;
+        auto chunks = createRandomChunks(4711, 40, nChunkInterval, 300);
+
+        // Bucket sizes below, equal to and above the chunk interval, with a range that does not start at a chunk border
+        for (uint64_t nInterval : { 1000000ULL, 7000000ULL, 12000000ULL, 60000000ULL }) {
+            uint64_t nStartTimeStamp = 5000000;
+            uint32_t nBucketCount = (uint32_t)((chunks.size() * nChunkInterval - nStartTimeStamp) / nInterval);
+
+            AMC::CStateJournalBucketAggregator aggregator(nStartTimeStamp, nInterval, nBucketCount, 1.0);
+            for (auto& chunk : chunks)
+                aggregator.addEntries(chunk.m_nStartTimeStamp, chunk.m_TimeStamps.data(), chunk.m_Values.data(), chunk.m_TimeStamps.size());
+
+            assertMatchesReference(aggregator, chunks);
+        }
+    }
+
+    void test_SummariesMatchReference() {
+        const uint64_t nChunkInterval = 12000000;
+        auto chunks = createRandomChunks(815, 60, nChunkInterval, 200);
+
+        uint32_t nAcceptedSummaries = 0;
+        for (uint64_t nInterval : { 5000000ULL, 24000000ULL, 120000000ULL }) {
+            uint32_t nBucketCount = (uint32_t)(chunks.size() * nChunkInterval / nInterval);
+
+            AMC::CStateJournalBucketAggregator aggregator(0, nInterval, nBucketCount, 1.0);
+            for (auto& chunk : chunks) {
+                bool bAccepted = false;
+                addChunkSummary(aggregator, chunk, bAccepted);
+                if (bAccepted)
+                    nAcceptedSummaries++;
+                else
+                    aggregator.addEntries(chunk.m_nStartTimeStamp, chunk.m_TimeStamps.data(), chunk.m_Values.data(), chunk.m_TimeStamps.size());
+            }
+
+            assertMatchesReference(aggregator, chunks);
+        }
+
+        assertTrue(nAcceptedSummaries > 0, "no summary has been used");
+    }
+
+    void test_MergeInAnyOrder() {
+        const uint64_t nChunkInterval = 12000000;
+        const uint64_t nInterval = 30000000;
+        auto chunks = createRandomChunks(1234, 50, nChunkInterval, 250);
+        uint32_t nBucketCount = (uint32_t)(chunks.size() * nChunkInterval / nInterval);
+
+        std::vector<size_t> chunkOrder(chunks.size());
+        for (size_t nIndex = 0; nIndex < chunkOrder.size(); nIndex++)
+            chunkOrder.at(nIndex) = nIndex;
+        std::mt19937 generator(99);
+        std::shuffle(chunkOrder.begin(), chunkOrder.end(), generator);
+
+        std::vector<AMC::PStateJournalBucketAggregator> partialAggregators;
+        for (size_t nPartIndex = 0; nPartIndex < 4; nPartIndex++)
+            partialAggregators.push_back(std::make_shared<AMC::CStateJournalBucketAggregator>(0, nInterval, nBucketCount, 1.0));
+
+        for (size_t nIndex = 0; nIndex < chunkOrder.size(); nIndex++) {
+            auto& chunk = chunks.at(chunkOrder.at(nIndex));
+            auto pPartialAggregator = partialAggregators.at(nIndex % partialAggregators.size());
+            bool bAccepted = false;
+            if (nIndex % 2 == 0)
+                addChunkSummary(*pPartialAggregator, chunk, bAccepted);
+            if (!bAccepted)
+                pPartialAggregator->addEntries(chunk.m_nStartTimeStamp, chunk.m_TimeStamps.data(), chunk.m_Values.data(), chunk.m_TimeStamps.size());
+        }
+
+        AMC::CStateJournalBucketAggregator aggregator(0, nInterval, nBucketCount, 1.0);
+        std::shuffle(partialAggregators.begin(), partialAggregators.end(), generator);
+        for (auto pPartialAggregator : partialAggregators)
+            aggregator.merge(*pPartialAggregator);
+
+        assertMatchesReference(aggregator, chunks);
+    }
+
+    void test_SummaryAcrossBuckets() {
+        AMC::CStateJournalBucketAggregator aggregator(1000, 100, 10, 1.0);
+
+        assertFalse(aggregator.addSummary(1050, 1150, 2, 1, 2, 2, 3.0), "summary spans two buckets");
+        assertFalse(aggregator.addSummary(900, 1050, 2, 1, 2, 2, 3.0), "summary starts before range");
+        assertFalse(aggregator.addSummary(1950, 2000, 2, 1, 2, 2, 3.0), "summary ends after range");
+        for (uint32_t nBucketIndex = 0; nBucketIndex < aggregator.getBucketCount(); nBucketIndex++)
+            assertIntegerRange(aggregator.getBucket(nBucketIndex).m_nSampleCount, 0, 0);
+
+        assertTrue(aggregator.addSummary(1100, 1199, 3, -5, 7, 4, 6.0), "summary within one bucket");
+        auto& bucket = aggregator.getBucket(1);
+        assertIntegerRange(bucket.m_nSampleCount, 3, 3);
+        assertIntegerRange(bucket.m_nMinValue, -5, -5);
+        assertIntegerRange(bucket.m_nMaxValue, 7, 7);
+        assertIntegerRange(bucket.m_nLastValue, 4, 4);
+    }
+
+    void test_BucketStatisticsUnits() {
+        std::vector<uint32_t> timeStamps = { 0, 10, 20, 30 };
+        std::vector<int64_t> values = { 4, -2, 10, 8 };
+
+        AMC::CStateJournalBucketAggregator aggregator(0, 100, 2, -0.5);
+        aggregator.addEntries(0, timeStamps.data(), values.data(), timeStamps.size());
+
+        uint32_t nSampleCount = 0;
+        double dMin = 0.0, dMax = 0.0, dMean = 0.0, dLast = 0.0;
+        assertTrue(aggregator.getBucketStatistics(0, nSampleCount, dMin, dMax, dMean, dLast));
+        assertIntegerRange(nSampleCount, 4, 4);
+        assertDoubleRange(dMin, -5.0, -5.0);
+        assertDoubleRange(dMax, 1.0, 1.0);
+        assertDoubleRange(dMean, -2.5, -2.5);
+        assertDoubleRange(dLast, -4.0, -4.0);
+
+        assertFalse(aggregator.getBucketStatistics(1, nSampleCount, dMin, dMax, dMean, dLast));
+        assertIntegerRange(nSampleCount, 0, 0);
+    }
+
+    void test_InvalidBucketParameters() {
+        bool bIntervalRejected = false;
+        try {
+            AMC::CStateJournalBucketAggregator aggregator(0, 0, 10, 1.0);
+        }
+        catch (...) {
+            bIntervalRejected = true;
+        }
+
+        bool bCountRejected = false;
+        try {
+            AMC::CStateJournalBucketAggregator aggregator(0, 100, 0, 1.0);
+        }
+        catch (...) {
+            bCountRejected = true;
+        }
+
+        assertTrue(bIntervalRejected, "zero interval");
+        assertTrue(bCountRejected, "zero bucket count");
+    }
+};
+
+
+}
+
+
+#endif // __AMCTEST_UNITTEST_STATEJOURNALAGGREGATOR
@@ -0,0 +1,369 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCTEST_UNITTEST_STATEJOURNALSTREAMCACHE
+#define __AMCTEST_UNITTEST_STATEJOURNALSTREAMCACHE
+
+#include "amc_unittests.hpp"
+#include "amc_statejournalstreamcache.hpp"
+
+#include <vector>
+#include <random>
+#include <atomic>
+#include <thread>
+#include <chrono>
+
+
+namespace AMCUnitTest {
+
+
+// Stream cache that synthesizes chunks instead of reading them from a journal.
+// Variable v has an entry every m_nEntryInterval microseconds, shifted by v, with a value derived from its time stamp.
+class CUnitTestStreamCache : public AMC::CStateJournalStreamCache {
+private:
+    uint32_t m_nVariableCount;
+    uint64_t m_nChunkInterval;
+    uint64_t m_nEntryInterval;
+    uint32_t m_nLoadDelayInMS;
+
+public:
+    std::atomic<uint32_t> m_nLoadCount;
+    std::atomic<uint32_t> m_nFailingChunkIndex;
+
+    CUnitTestStreamCache(uint64_t nMemoryQuota, uint32_t nVariableCount, uint64_t nChunkInterval, uint64_t nEntryInterval, uint32_t nLoadDelayInMS)
+        : AMC::CStateJournalStreamCache(nMemoryQuota, nullptr), m_nVariableCount(nVariableCount), m_nChunkInterval(nChunkInterval), m_nEntryInterval(nEntryInterval),
+        m_nLoadDelayInMS(nLoadDelayInMS), m_nLoadCount(0), m_nFailingChunkIndex(UINT32_MAX)
+    {
+    }
+
+    virtual ~CUnitTestStreamCache()
+    {
+        stopPrefetching();
+    }
+
+    static int64_t expectedValue(uint32_t nVariableIndex, uint64_t nTimeStamp)
+    {
+        return (int64_t)nVariableIndex * 1000000000LL + (int64_t)nTimeStamp;
+    }
+
+    uint64_t getEntryTimeStamp(uint32_t nVariableIndex, uint64_t nEntryIndex)
+    {
+        return nEntryIndex * m_nEntryInterval + nVariableIndex;
+    }
+
+    AMC::PStateJournalStreamChunk_InMemory loadEntryFromJournal(uint32_t nTimeChunkIndex) override
+    {
+        m_nLoadCount++;
+        if (m_nLoadDelayInMS > 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(m_nLoadDelayInMS));
+
+        if (nTimeChunkIndex == m_nFailingChunkIndex)
+            throw std::runtime_error("chunk can not be read");
+
+        uint64_t nStartTimeStamp = nTimeChunkIndex * m_nChunkInterval;
+        uint64_t nEndTimeStamp = nStartTimeStamp + m_nChunkInterval - 1;
+        AMC::CStateJournalStreamChunk_Dynamic dynamicChunk(nTimeChunkIndex, nStartTimeStamp, nEndTimeStamp, m_nVariableCount, nullptr);
+
+        for (uint64_t nEntryIndex = nStartTimeStamp / m_nEntryInterval; getEntryTimeStamp(0, nEntryIndex) <= nEndTimeStamp; nEntryIndex++) {
+            for (uint32_t nVariableIndex = 0; nVariableIndex < m_nVariableCount; nVariableIndex++) {
+                uint64_t nTimeStamp = getEntryTimeStamp(nVariableIndex, nEntryIndex);
+                if ((nTimeStamp >= nStartTimeStamp) && (nTimeStamp <= nEndTimeStamp))
+                    dynamicChunk.writeEntry(nVariableIndex, nTimeStamp, expectedValue(nVariableIndex, nTimeStamp));
+            }
+        }
+
+        auto pChunk = std::make_shared<AMC::CStateJournalStreamChunk_InMemory>(&dynamicChunk, nullptr);
+        addEntry(pChunk);
+        return pChunk;
+    }
+};
+
+
+class CUnitTestGroup_StateJournalStreamCache : public CUnitTestGroup {
+private:
+
+    static std::vector<uint32_t> makeChunkIndices(uint32_t nFirstChunkIndex, uint32_t nChunkCount)
+    {
+        std::vector<uint32_t> chunkIndices;
+        for (uint32_t nIndex = 0; nIndex < nChunkCount; nIndex++)
+            chunkIndices.push_back(nFirstChunkIndex + nIndex);
+        return chunkIndices;
+    }
+
+    bool waitForEntry(CUnitTestStreamCache& cache, uint32_t nTimeChunkIndex)
+    {
+        for (uint32_t nRetry = 0; nRetry < 500; nRetry++) {
+            if (cache.retrieveEntry(nTimeChunkIndex).get() != nullptr)
+                return true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return false;
+    }
+
+public:
+    CUnitTestGroup_StateJournalStreamCache() = default;
+    virtual ~CUnitTestGroup_StateJournalStreamCache() = default;
+
+    std::string getTestGroupName() override {
+        return "StateJournalStreamCache";
+    }
+
+    void initializeTests() override {
+        // Nothing to initialize
+    }
+
+    void registerTests() override {
+        registerTest("AcquireEntriesInOrder", "Acquires a chunk range and only loads chunks that are not cached", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournalStreamCache::test_AcquireEntriesInOrder, this));
+        registerTest("ConcurrentAcquireLoadsOnce", "Loads a chunk once if several threads request it at the same time", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournalStreamCache::test_ConcurrentAcquireLoadsOnce, this));
+        registerTest("AcquireBeyondQuota", "Returns valid entries for a range that does not fit into the memory quota", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournalStreamCache::test_AcquireBeyondQuota, this));
+        registerTest("FailedLoadIsRetried", "Reports load errors and loads the chunk again on the next request", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournalStreamCache::test_FailedLoadIsRetried, this));
+        registerTest("PrefetchLoadsInBackground", "Loads prefetched chunks on the background thread", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournalStreamCache::test_PrefetchLoadsInBackground, this));
+        registerTest("ExtractEntriesMatchReference", "Extracts entries of random time ranges across chunk borders", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournalStreamCache::test_ExtractEntriesMatchReference, this));
+        registerTest("AggregateEntriesMatchReference", "Aggregates several variables over dynamic, in memory and on disk chunks", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournalStreamCache::test_AggregateEntriesMatchReference, this));
+    }
+
+private:
+
+    void test_AcquireEntriesInOrder() {
+        CUnitTestStreamCache cache(1024 * 1024 * 1024, 4, 100000, 100, 0);
+
+        cache.acquireEntry(3);
+        cache.acquireEntry(7);
+        assertIntegerRange(cache.m_nLoadCount, 2, 2, "initial loads");
+
+        auto chunkIndices = makeChunkIndices(0, 20);
+        std::vector<AMC::PStateJournalStreamChunk_InMemory> entries;
+        cache.acquireEntries(chunkIndices, entries);
+
+        assertIntegerRange(entries.size(), 20, 20, "entry count");
+        for (size_t nIndex = 0; nIndex < entries.size(); nIndex++)
+            assertIntegerRange(entries.at(nIndex)->getChunkIndex(), chunkIndices.at(nIndex), chunkIndices.at(nIndex), "chunk order");
+        assertIntegerRange(cache.m_nLoadCount, 20, 20, "cached chunks are not loaded again");
+
+        cache.acquireEntries(chunkIndices, entries);
+        assertIntegerRange(cache.m_nLoadCount, 20, 20, "second acquisition is served from the cache");
+    }
+
+    void test_ConcurrentAcquireLoadsOnce() {
+        CUnitTestStreamCache cache(1024 * 1024 * 1024, 4, 100000, 100, 50);
+
+        std::vector<AMC::PStateJournalStreamChunk_InMemory> entries(8);
+        std::vector<std::thread> threads;
+        for (size_t nThreadIndex = 0; nThreadIndex < entries.size(); nThreadIndex++)
+            threads.push_back(std::thread([&cache, &entries, nThreadIndex]() { entries.at(nThreadIndex) = cache.acquireEntry(5); }));
+        for (auto& thread : threads)
+            thread.join();
+
+        assertIntegerRange(cache.m_nLoadCount, 1, 1, "chunk is loaded once");
+        for (auto& pEntry : entries)
+            assertTrue(pEntry.get() == entries.at(0).get(), "all threads receive the same entry");
+    }
+
+    void test_AcquireBeyondQuota() {
+        CUnitTestStreamCache probeCache(1024 * 1024 * 1024, 4, 100000, 100, 0);
+        uint64_t nChunkMemory = probeCache.acquireEntry(0)->getMemoryUsage();
+
+        CUnitTestStreamCache cache(nChunkMemory * 3, 4, 100000, 100, 0);
+        std::vector<AMC::PStateJournalStreamChunk_InMemory> entries;
+        cache.acquireEntries(makeChunkIndices(0, 10), entries);
+
+        assertTrue(cache.getCurrentMemoryUsage() <= cache.getMemoryQuota(), "memory quota is kept");
+        for (uint32_t nIndex = 0; nIndex < 10; nIndex++) {
+            uint64_t nTimeStamp = nIndex * 100000ULL + 500;
+            assertIntegerRange(entries.at(nIndex)->sampleIntegerData(1, nTimeStamp), CUnitTestStreamCache::expectedValue(1, nTimeStamp - 99), CUnitTestStreamCache::expectedValue(1, nTimeStamp - 99), "evicted entry stays valid");
+        }
+    }
+
+    void test_FailedLoadIsRetried() {
+        CUnitTestStreamCache cache(1024 * 1024 * 1024, 4, 100000, 100, 0);
+        cache.m_nFailingChunkIndex = 4;
+
+        std::vector<AMC::PStateJournalStreamChunk_InMemory> entries;
+        bool bFailed = false;
+        try {
+            cache.acquireEntries(makeChunkIndices(0, 8), entries);
+        }
+        catch (std::exception&) {
+            bFailed = true;
+        }
+        assertTrue(bFailed, "load error is reported");
+
+        cache.m_nFailingChunkIndex = UINT32_MAX;
+        assertAssigned(cache.acquireEntry(4).get(), "failed chunk is loaded on the next request");
+    }
+
+    void test_PrefetchLoadsInBackground() {
+        CUnitTestStreamCache cache(1024 * 1024 * 1024, 4, 100000, 100, 20);
+
+        cache.acquireEntry(2);
+        cache.prefetchEntries({ 2, 3, 4 });
+
+        assertTrue(waitForEntry(cache, 3), "chunk 3 is prefetched");
+        assertTrue(waitForEntry(cache, 4), "chunk 4 is prefetched");
+        assertIntegerRange(cache.m_nLoadCount, 3, 3, "cached chunk is not prefetched again");
+
+        cache.acquireEntry(4);
+        assertIntegerRange(cache.m_nLoadCount, 3, 3, "prefetched chunk is served from the cache");
+
+        // Failing prefetches are silent, the error is reported when the chunk is requested.
+        cache.m_nFailingChunkIndex = 6;
+        cache.prefetchEntries({ 6 });
+        cache.stopPrefetching();
+        cache.prefetchEntries({ 7 });
+        assertNull(cache.retrieveEntry(7).get(), "no prefetching after stop");
+    }
+
+    void test_ExtractEntriesMatchReference() {
+        const uint32_t nVariableCount = 5;
+        const uint64_t nChunkInterval = 100000;
+        const uint64_t nEntryInterval = 700;
+        const uint32_t nChunkCount = 12;
+        CUnitTestStreamCache cache(1024 * 1024 * 1024, nVariableCount, nChunkInterval, nEntryInterval, 0);
+
+        std::vector<AMC::PStateJournalStreamChunk_InMemory> entries;
+        cache.acquireEntries(makeChunkIndices(0, nChunkCount), entries);
+
+        std::mt19937 generator(2024);
+        std::uniform_int_distribution<uint64_t> timeDistribution(0, nChunkCount * nChunkInterval + 5000);
+
+        for (uint32_t nRun = 0; nRun < 50; nRun++) {
+            uint64_t nStartTimeStamp = timeDistribution(generator);
+            uint64_t nEndTimeStamp = timeDistribution(generator);
+            if (nEndTimeStamp < nStartTimeStamp)
+                std::swap(nStartTimeStamp, nEndTimeStamp);
+
+            for (uint32_t nVariableIndex = 0; nVariableIndex < nVariableCount; nVariableIndex++) {
+                std::vector<AMC::sJournalTimeStreamInt64Entry> timeStream;
+                for (auto& pEntry : entries)
+                    pEntry->extractIntegerEntries(nVariableIndex, nStartTimeStamp, nEndTimeStamp, timeStream);
+
+                std::vector<uint64_t> expectedTimeStamps;
+                for (uint64_t nEntryIndex = 0; cache.getEntryTimeStamp(nVariableIndex, nEntryIndex) < nChunkCount * nChunkInterval; nEntryIndex++) {
+                    uint64_t nTimeStamp = cache.getEntryTimeStamp(nVariableIndex, nEntryIndex);
+                    if ((nTimeStamp >= nStartTimeStamp) && (nTimeStamp < nEndTimeStamp))
+                        expectedTimeStamps.push_back(nTimeStamp);
+                }
+
+                assertIntegerRange(timeStream.size(), expectedTimeStamps.size(), expectedTimeStamps.size(), "entry count in [" + std::to_string(nStartTimeStamp) + ", " + std::to_string(nEndTimeStamp) + ")");
+                for (size_t nIndex = 0; nIndex < timeStream.size(); nIndex++) {
+                    auto& entry = timeStream.at(nIndex);
+                    assertIntegerRange(entry.m_nTimeStampInMicroSeconds, expectedTimeStamps.at(nIndex), expectedTimeStamps.at(nIndex), "time stamp");
+                    assertIntegerRange(entry.m_nValue, CUnitTestStreamCache::expectedValue(nVariableIndex, entry.m_nTimeStampInMicroSeconds), CUnitTestStreamCache::expectedValue(nVariableIndex, entry.m_nTimeStampInMicroSeconds), "value");
+                }
+            }
+        }
+    }
+
+    void test_AggregateEntriesMatchReference() {
+        const uint32_t nVariableCount = 4;
+        const uint64_t nChunkInterval = 100000;
+        const uint64_t nEntryInterval = 900;
+        const uint32_t nChunkCount = 6;
+        auto pCache = std::make_shared<CUnitTestStreamCache>(1024 * 1024 * 1024, nVariableCount, nChunkInterval, nEntryInterval, 0);
+
+        // Chunks alternate between the three kinds a live journal holds: on disk, in memory and still recording
+        std::vector<AMC::PStateJournalStreamChunk> chunks;
+        for (uint32_t nChunkIndex = 0; nChunkIndex < nChunkCount; nChunkIndex++) {
+            uint64_t nStartTimeStamp = nChunkIndex * nChunkInterval;
+            uint64_t nEndTimeStamp = nStartTimeStamp + nChunkInterval - 1;
+            switch (nChunkIndex % 3) {
+            case 0:
+                chunks.push_back(std::make_shared<AMC::CStateJournalStreamChunk_OnDisk>(nStartTimeStamp, nEndTimeStamp, nChunkIndex, pCache, nullptr));
+                break;
+            case 1:
+                chunks.push_back(pCache->acquireEntry(nChunkIndex));
+                break;
+            default: {
+                auto pDynamicChunk = std::make_shared<AMC::CStateJournalStreamChunk_Dynamic>(nChunkIndex, nStartTimeStamp, nEndTimeStamp, nVariableCount, nullptr);
+                for (uint64_t nEntryIndex = nStartTimeStamp / nEntryInterval; pCache->getEntryTimeStamp(0, nEntryIndex) <= nEndTimeStamp; nEntryIndex++) {
+                    for (uint32_t nVariableIndex = 0; nVariableIndex < nVariableCount; nVariableIndex++) {
+                        uint64_t nTimeStamp = pCache->getEntryTimeStamp(nVariableIndex, nEntryIndex);
+                        if ((nTimeStamp >= nStartTimeStamp) && (nTimeStamp <= nEndTimeStamp))
+                            pDynamicChunk->writeEntry(nVariableIndex, nTimeStamp, CUnitTestStreamCache::expectedValue(nVariableIndex, nTimeStamp));
+                    }
+                }
+                chunks.push_back(pDynamicChunk);
+                break;
+            }
+            }
+        }
+
+        const uint64_t nBucketStart = 12345;
+        const uint64_t nBucketInterval = 33333;
+        const uint32_t nBucketCount = 15;
+        std::vector<uint32_t> storageIndices = { 3, 0, 2 };
+
+        std::vector<AMC::PStateJournalBucketAggregator> aggregators;
+        for (size_t nListIndex = 0; nListIndex < storageIndices.size(); nListIndex++)
+            aggregators.push_back(std::make_shared<AMC::CStateJournalBucketAggregator>(nBucketStart, nBucketInterval, nBucketCount, 1.0));
+
+        for (auto pChunk : chunks)
+            pChunk->aggregateIntegerEntries(storageIndices, aggregators);
+
+        for (size_t nListIndex = 0; nListIndex < storageIndices.size(); nListIndex++) {
+            uint32_t nVariableIndex = storageIndices.at(nListIndex);
+            for (uint32_t nBucketIndex = 0; nBucketIndex < nBucketCount; nBucketIndex++) {
+                uint64_t nStartTimeStamp = nBucketStart + nBucketIndex * nBucketInterval;
+                uint64_t nEndTimeStamp = nStartTimeStamp + nBucketInterval;
+
+                uint32_t nExpectedCount = 0;
+                int64_t nExpectedMin = 0;
+                int64_t nExpectedMax = 0;
+                for (uint64_t nEntryIndex = 0; pCache->getEntryTimeStamp(nVariableIndex, nEntryIndex) < nChunkCount * nChunkInterval; nEntryIndex++) {
+                    uint64_t nTimeStamp = pCache->getEntryTimeStamp(nVariableIndex, nEntryIndex);
+                    if ((nTimeStamp >= nStartTimeStamp) && (nTimeStamp < nEndTimeStamp)) {
+                        int64_t nValue = CUnitTestStreamCache::expectedValue(nVariableIndex, nTimeStamp);
+                        if ((nExpectedCount == 0) || (nValue < nExpectedMin))
+                            nExpectedMin = nValue;
+                        if ((nExpectedCount == 0) || (nValue > nExpectedMax))
+                            nExpectedMax = nValue;
+                        nExpectedCount++;
+                    }
+                }
+
+                auto& bucket = aggregators.at(nListIndex)->getBucket(nBucketIndex);
+                std::string sContext = "variable " + std::to_string(nVariableIndex) + " bucket " + std::to_string(nBucketIndex);
+                assertIntegerRange(bucket.m_nSampleCount, nExpectedCount, nExpectedCount, "sample count of " + sContext);
+                if (nExpectedCount > 0) {
+                    assertIntegerRange(bucket.m_nMinValue, nExpectedMin, nExpectedMin, "min value of " + sContext);
+                    assertIntegerRange(bucket.m_nMaxValue, nExpectedMax, nExpectedMax, "max value of " + sContext);
+                    assertIntegerRange(bucket.m_nLastValue, nExpectedMax, nExpectedMax, "last value of " + sContext);
+                }
+            }
+        }
+    }
+};
+
+
+}
+
+
+#endif // __AMCTEST_UNITTEST_STATEJOURNALSTREAMCACHE
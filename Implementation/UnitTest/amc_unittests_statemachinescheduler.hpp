@@ -0,0 +1,268 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCTEST_UNITTEST_STATEMACHINESCHEDULER
+#define __AMCTEST_UNITTEST_STATEMACHINESCHEDULER
+
+#include "amc_unittests.hpp"
+#include "amc_statemachinescheduler.hpp"
+
+#include <atomic>
+#include <functional>
+
+
+namespace AMCUnitTest {
+
+
+class CUnitTestGroup_StateMachineScheduler : public CUnitTestGroup {
+private:
+
+    // Counts its steps and records if two steps have ever overlapped.
+    class CCountingTask : public AMC::CStateMachineSchedulerTask {
+    private:
+        uint64_t m_nDelayInMicroseconds;
+        std::atomic<uint32_t> m_nActiveSteps;
+        std::atomic<uint32_t> m_nStepCount;
+        std::atomic<bool> m_bHasOverlapped;
+
+    public:
+        CCountingTask(uint64_t nDelayInMicroseconds)
+            : m_nDelayInMicroseconds(nDelayInMicroseconds), m_nActiveSteps(0), m_nStepCount(0), m_bHasOverlapped(false)
+        {
+        }
+
+        uint64_t executeScheduledStep() override
+        {
+            if (m_nActiveSteps.fetch_add(1) != 0)
+                m_bHasOverlapped = true;
+
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            m_nStepCount++;
+
+            m_nActiveSteps--;
+            return m_nDelayInMicroseconds;
+        }
+
+        uint32_t getStepCount() { return m_nStepCount; }
+        bool hasOverlapped() { return m_bHasOverlapped; }
+        bool isActive() { return m_nActiveSteps != 0; }
+    };
+
+    // Executes a function per step and counts the steps.
+    class CFunctionTask : public AMC::CStateMachineSchedulerTask {
+    private:
+        std::function<uint64_t(uint32_t)> m_StepFunction;
+        std::atomic<uint32_t> m_nStepCount;
+
+    public:
+        CFunctionTask(std::function<uint64_t(uint32_t)> stepFunction)
+            : m_StepFunction(stepFunction), m_nStepCount(0)
+        {
+        }
+
+        uint64_t executeScheduledStep() override
+        {
+            uint32_t nStepIndex = m_nStepCount++;
+            return m_StepFunction(nStepIndex);
+        }
+
+        uint32_t getStepCount() { return m_nStepCount; }
+    };
+
+public:
+    CUnitTestGroup_StateMachineScheduler() = default;
+    virtual ~CUnitTestGroup_StateMachineScheduler() = default;
+
+    std::string getTestGroupName() override {
+        return "StateMachineScheduler";
+    }
+
+    void initializeTests() override {
+        // Nothing to initialize
+    }
+
+    void registerTests() override {
+        registerTest("InvalidWorkerCount", "Rejects pools without workers", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateMachineScheduler::test_InvalidWorkerCount, this));
+        registerTest("StepsDoNotOverlap", "Never executes two steps of one task at the same time", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateMachineScheduler::test_StepsDoNotOverlap, this));
+        registerTest("RespectsDelay", "Waits for the returned delay before the next step", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateMachineScheduler::test_RespectsDelay, this));
+        registerTest("RemoveTask", "Does not execute removed tasks anymore", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateMachineScheduler::test_RemoveTask, this));
+        registerTest("FinishedTask", "Does not execute finished tasks anymore", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateMachineScheduler::test_FinishedTask, this));
+        registerTest("ThrowingTask", "Ends tasks whose step throws instead of retrying them", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateMachineScheduler::test_ThrowingTask, this));
+        registerTest("WakeTask", "Executes a delayed task early when it is woken", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateMachineScheduler::test_WakeTask, this));
+        registerTest("BlockingSection", "Executes other tasks while a step blocks", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateMachineScheduler::test_BlockingSection, this));
+    }
+
+private:
+
+    void test_InvalidWorkerCount() {
+        bool bThrown = false;
+        try {
+            AMC::CStateMachineScheduler scheduler(0);
+        }
+        catch (...) {
+            bThrown = true;
+        }
+        assertTrue(bThrown, "zero workers");
+    }
+
+    void test_StepsDoNotOverlap() {
+        AMC::CStateMachineScheduler scheduler(4);
+
+        std::vector<std::shared_ptr<CCountingTask>> tasks;
+        for (uint32_t nIndex = 0; nIndex < 8; nIndex++) {
+            tasks.push_back(std::make_shared<CCountingTask>(0));
+            scheduler.addTask(tasks.back().get());
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        for (auto pTask : tasks)
+            scheduler.removeTask(pTask.get());
+
+        for (auto pTask : tasks) {
+            assertTrue(pTask->getStepCount() > 0, "task has been executed");
+            assertFalse(pTask->hasOverlapped(), "steps have overlapped");
+        }
+    }
+
+    void test_RespectsDelay() {
+        AMC::CStateMachineScheduler scheduler(2);
+
+        CCountingTask task(20000);
+        scheduler.addTask(&task);
+        std::this_thread::sleep_for(std::chrono::milliseconds(110));
+        scheduler.removeTask(&task);
+
+        // One immediate step plus one per 20ms
+        assertIntegerRange((int64_t)task.getStepCount(), 2, 6, "step count");
+    }
+
+    void test_RemoveTask() {
+        AMC::CStateMachineScheduler scheduler(2);
+
+        CCountingTask task(0);
+        scheduler.addTask(&task);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        scheduler.removeTask(&task);
+
+        assertFalse(task.isActive(), "step is still executed");
+        uint32_t nStepCount = task.getStepCount();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        assertIntegerRange((int64_t)task.getStepCount(), nStepCount, nStepCount, "steps after removal");
+
+        // Removed tasks may be added again
+        scheduler.addTask(&task);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        scheduler.removeTask(&task);
+        assertTrue(task.getStepCount() > nStepCount, "task has been executed again");
+    }
+
+    void test_FinishedTask() {
+        AMC::CStateMachineScheduler scheduler(2);
+
+        CFunctionTask task([](uint32_t nStepIndex) -> uint64_t {
+            return (nStepIndex < 2) ? 0 : AMC_STATEMACHINESCHEDULER_TASKFINISHED;
+        });
+        scheduler.addTask(&task);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        assertIntegerRange((int64_t)task.getStepCount(), 3, 3, "step count");
+
+        // Finished tasks may still be removed
+        scheduler.removeTask(&task);
+    }
+
+    void test_ThrowingTask() {
+        AMC::CStateMachineScheduler scheduler(1);
+
+        CFunctionTask throwingTask([](uint32_t nStepIndex) -> uint64_t {
+            throw std::runtime_error("step failed");
+        });
+        CCountingTask countingTask(1000);
+        scheduler.addTask(&throwingTask);
+        scheduler.addTask(&countingTask);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        scheduler.removeTask(&throwingTask);
+        scheduler.removeTask(&countingTask);
+
+        assertIntegerRange((int64_t)throwingTask.getStepCount(), 1, 1, "steps of throwing task");
+        assertTrue(countingTask.getStepCount() > 1, "other task has been executed");
+    }
+
+    void test_WakeTask() {
+        AMC::CStateMachineScheduler scheduler(1);
+
+        CFunctionTask task([](uint32_t nStepIndex) -> uint64_t {
+            return 10000000;
+        });
+        scheduler.addTask(&task);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        assertIntegerRange((int64_t)task.getStepCount(), 1, 1, "steps before wake up");
+
+        scheduler.wakeTask(&task);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        assertIntegerRange((int64_t)task.getStepCount(), 2, 2, "steps after wake up");
+
+        scheduler.removeTask(&task);
+    }
+
+    void test_BlockingSection() {
+        AMC::CStateMachineScheduler scheduler(1);
+
+        std::atomic<bool> bReleaseBlockingTask(false);
+        CFunctionTask blockingTask([&bReleaseBlockingTask](uint32_t nStepIndex) -> uint64_t {
+            AMC::CStateMachineSchedulerBlockingSection blockingSection;
+            while (!bReleaseBlockingTask)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            return AMC_STATEMACHINESCHEDULER_TASKFINISHED;
+        });
+        CCountingTask countingTask(1000);
+
+        scheduler.addTask(&blockingTask);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        scheduler.addTask(&countingTask);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        // The only worker is blocked, so another worker has to execute the second task
+        assertTrue(countingTask.getStepCount() > 1, "other task has been executed");
+
+        bReleaseBlockingTask = true;
+        scheduler.removeTask(&blockingTask);
+        scheduler.removeTask(&countingTask);
+        assertFalse(countingTask.hasOverlapped(), "steps have overlapped");
+    }
+
+};
+
+}
+
+#endif // __AMCTEST_UNITTEST_STATEMACHINESCHEDULER
@@ -0,0 +1,174 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCTEST_UNITTEST_UIEXPRESSION
+#define __AMCTEST_UNITTEST_UIEXPRESSION
+
+#include "amc_unittests.hpp"
+#include "amc_ui_expression.hpp"
+#include "amc_statemachinedata.hpp"
+#include "amc_parameterhandler.hpp"
+#include "amc_parametergroup.hpp"
+
+
+namespace AMCUnitTest {
+
+
+class CUnitTestGroup_UIExpression : public CUnitTestGroup {
+private:
+
+    AMC::PStateMachineData m_pStateMachineData;
+    AMC::PParameterGroup m_pStatusGroup;
+
+    AMC::CUIExpression createExpression(const std::string& sSyncValue)
+    {
+        pugi::xml_document document;
+        auto node = document.append_child("item");
+        node.append_attribute("sync:value").set_value(sSyncValue.c_str());
+        return AMC::CUIExpression(node, "value");
+    }
+
+public:
+    CUnitTestGroup_UIExpression() = default;
+    virtual ~CUnitTestGroup_UIExpression() = default;
+
+    std::string getTestGroupName() override {
+        return "UIExpression";
+    }
+
+    void initializeTests() override {
+        auto pChrono = std::make_shared<AMCCommon::CChrono>();
+        auto pParameterHandler = std::make_shared<AMC::CParameterHandler>("main", pChrono);
+        m_pStatusGroup = pParameterHandler->addGroup("status", "status parameters");
+        m_pStatusGroup->addNewStringParameter("caption", "caption", "idle");
+        m_pStatusGroup->addNewIntParameter("counter", "counter", 7);
+        m_pStatusGroup->addNewDoubleParameter("temperature", "temperature", 21.5, 0.001);
+        m_pStatusGroup->addNewBoolParameter("ready", "ready", true);
+
+        m_pStateMachineData = std::make_shared<AMC::CStateMachineData>();
+        m_pStateMachineData->registerParameterHandler("main", pParameterHandler, pChrono);
+        m_pStateMachineData->setInstanceStateName("main", "init");
+    }
+
+    void registerTests() override {
+        registerTest("BoundValues", "Evaluates bound expressions of every type and follows value changes", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_UIExpression::test_BoundValues, this));
+        registerTest("InvertedBoolean", "Evaluates negated boolean expressions", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_UIExpression::test_InvertedBoolean, this));
+        registerTest("InstanceState", "Evaluates state name expressions", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_UIExpression::test_InstanceState, this));
+        registerTest("LayoutChange", "Rebinds expressions after parameters have been removed", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_UIExpression::test_LayoutChange, this));
+        registerTest("UnknownParameter", "Fails for expressions that cannot be bound", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_UIExpression::test_UnknownParameter, this));
+    }
+
+private:
+
+    void test_BoundValues() {
+        auto captionExpression = createExpression("main.status.caption");
+        auto counterExpression = createExpression("main.status.counter");
+        auto temperatureExpression = createExpression("main.status.temperature");
+        auto readyExpression = createExpression("main.status.ready");
+
+        assertTrue(captionExpression.evaluateStringValue(m_pStateMachineData) == "idle", "string value");
+        assertIntegerRange(counterExpression.evaluateIntegerValue(m_pStateMachineData), 7, 7, "integer value");
+        assertDoubleRange(temperatureExpression.evaluateNumberValue(m_pStateMachineData), 21.5, 21.5, "double value");
+        assertTrue(readyExpression.evaluateBoolValue(m_pStateMachineData), "bool value");
+
+        m_pStatusGroup->setParameterValueByName("caption", "running");
+        m_pStatusGroup->setIntParameterValueByName("counter", 8);
+        m_pStatusGroup->setDoubleParameterValueByName("temperature", 80.25);
+        m_pStatusGroup->setBoolParameterValueByName("ready", false);
+
+        assertTrue(captionExpression.evaluateStringValue(m_pStateMachineData) == "running", "changed string value");
+        assertIntegerRange(counterExpression.evaluateIntegerValue(m_pStateMachineData), 8, 8, "changed integer value");
+        assertDoubleRange(temperatureExpression.evaluateNumberValue(m_pStateMachineData), 80.25, 80.25, "changed double value");
+        assertFalse(readyExpression.evaluateBoolValue(m_pStateMachineData), "changed bool value");
+    }
+
+    void test_InvertedBoolean() {
+        m_pStatusGroup->setBoolParameterValueByName("ready", true);
+        auto notReadyExpression = createExpression("!main.status.ready");
+        assertFalse(notReadyExpression.evaluateBoolValue(m_pStateMachineData), "inverted true");
+
+        m_pStatusGroup->setBoolParameterValueByName("ready", false);
+        assertTrue(notReadyExpression.evaluateBoolValue(m_pStateMachineData), "inverted false");
+    }
+
+    void test_InstanceState() {
+        auto stateExpression = createExpression("main.$state");
+        assertTrue(stateExpression.evaluateStringValue(m_pStateMachineData) == "init", "initial state");
+
+        m_pStateMachineData->setInstanceStateName("main", "idle");
+        assertTrue(stateExpression.evaluateStringValue(m_pStateMachineData) == "idle", "changed state");
+    }
+
+    void test_LayoutChange() {
+        auto pGroup = m_pStateMachineData->getParameterHandler("main")->addGroup("layout", "layout test");
+        pGroup->addNewIntParameter("first", "first", 1);
+        pGroup->addNewIntParameter("second", "second", 2);
+
+        auto secondExpression = createExpression("main.layout.second");
+        assertIntegerRange(secondExpression.evaluateIntegerValue(m_pStateMachineData), 2, 2, "before removal");
+
+        // Shifts the bound index of "second"
+        pGroup->removeValue("first");
+        assertIntegerRange(secondExpression.evaluateIntegerValue(m_pStateMachineData), 2, 2, "after removal");
+
+        pGroup->setIntParameterValueByName("second", 3);
+        assertIntegerRange(secondExpression.evaluateIntegerValue(m_pStateMachineData), 3, 3, "after rebinding");
+    }
+
+    void test_UnknownParameter() {
+        auto unknownExpression = createExpression("main.status.unknown");
+
+        bool bFailed = false;
+        try {
+            unknownExpression.evaluateStringValue(m_pStateMachineData);
+        }
+        catch (...) {
+            bFailed = true;
+        }
+        assertTrue(bFailed, "unknown parameter");
+
+        bFailed = false;
+        try {
+            unknownExpression.evaluateIntegerValue(m_pStateMachineData);
+        }
+        catch (...) {
+            bFailed = true;
+        }
+        assertTrue(bFailed, "unknown integer parameter");
+    }
+
+};
+
+
+}
+
+
+#endif // __AMCTEST_UNITTEST_UIEXPRESSION
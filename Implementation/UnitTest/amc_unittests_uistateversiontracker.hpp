@@ -0,0 +1,199 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCTEST_UNITTEST_UISTATEVERSIONTRACKER
+#define __AMCTEST_UNITTEST_UISTATEVERSIONTRACKER
+
+#include "amc_unittests.hpp"
+#include "amc_ui_stateversiontracker.hpp"
+#include "amc_parametergroup.hpp"
+#include "amc_jsonwriter.hpp"
+#include "common_chrono.hpp"
+
+
+namespace AMCUnitTest {
+
+
+class CUnitTestGroup_UIStateVersionTracker : public CUnitTestGroup {
+private:
+
+    static std::string serializeModule(const std::string& sCaption, int64_t nValue)
+    {
+        AMC::CJSONWriter writer;
+        AMC::CJSONWriterObject moduleObject(writer);
+        moduleObject.addString("caption", sCaption);
+        moduleObject.addInteger("value", nValue);
+        return moduleObject.saveToString();
+    }
+
+    // Serializes a module from a parameter, recording the read into pReadSet.
+    static std::string serializeModuleFromParameter(AMC::CParameterGroup* pGroup, AMC::PParameterReadSet pReadSet)
+    {
+        AMC::CParameterReadRecording readRecording(pReadSet.get());
+        return serializeModule(pGroup->getParameterValueByName("caption"), pGroup->getIntParameterValueByName("value"));
+    }
+
+public:
+    CUnitTestGroup_UIStateVersionTracker() = default;
+    virtual ~CUnitTestGroup_UIStateVersionTracker() = default;
+
+    std::string getTestGroupName() override {
+        return "UIStateVersionTracker";
+    }
+
+    void initializeTests() override {
+        // Nothing to initialize
+    }
+
+    void registerTests() override {
+        registerTest("NewFragments", "Stamps every new fragment with a new version", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_UIStateVersionTracker::test_NewFragments, this));
+        registerTest("UnchangedFragments", "Keeps the version of fragments that serialize identically", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_UIStateVersionTracker::test_UnchangedFragments, this));
+        registerTest("ChangedFragments", "Stamps changed fragments with a version above all others", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_UIStateVersionTracker::test_ChangedFragments, this));
+        registerTest("MonotonicAfterClear", "Never reuses versions after the cache has been cleared", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_UIStateVersionTracker::test_MonotonicAfterClear, this));
+        registerTest("ReuseUnchangedFragments", "Reuses fragments as long as the parameters they were read from are unchanged", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_UIStateVersionTracker::test_ReuseUnchangedFragments, this));
+        registerTest("UntrackedReads", "Never reuses fragments that have read untracked values", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_UIStateVersionTracker::test_UntrackedReads, this));
+    }
+
+private:
+
+    void test_NewFragments() {
+        AMC::CUIStateVersionTracker tracker;
+        assertIntegerRange((int64_t)tracker.getStateVersion(), 0, 0, "initial state version");
+        assertIntegerRange((int64_t)tracker.getFragmentVersion("module1"), 0, 0, "unknown fragment");
+
+        uint64_t nVersion1 = tracker.updateFragment("module1", serializeModule("Status", 1));
+        uint64_t nVersion2 = tracker.updateFragment("module2", serializeModule("Status", 1));
+
+        assertIntegerRange((int64_t)nVersion1, 1, 1, "first fragment");
+        assertIntegerRange((int64_t)nVersion2, 2, 2, "second fragment");
+        assertIntegerRange((int64_t)tracker.getStateVersion(), 2, 2, "state version");
+    }
+
+    void test_UnchangedFragments() {
+        AMC::CUIStateVersionTracker tracker;
+        uint64_t nVersion = tracker.updateFragment("module1", serializeModule("Status", 42));
+
+        for (uint32_t nPoll = 0; nPoll < 10; nPoll++)
+            assertIntegerRange((int64_t)tracker.updateFragment("module1", serializeModule("Status", 42)), (int64_t)nVersion, (int64_t)nVersion, "unchanged fragment");
+
+        assertIntegerRange((int64_t)tracker.getStateVersion(), (int64_t)nVersion, (int64_t)nVersion, "state version");
+    }
+
+    void test_ChangedFragments() {
+        AMC::CUIStateVersionTracker tracker;
+        uint64_t nVersion1 = tracker.updateFragment("module1", serializeModule("Status", 1));
+        uint64_t nVersion2 = tracker.updateFragment("module2", serializeModule("Status", 1));
+
+        uint64_t nChangedVersion = tracker.updateFragment("module1", serializeModule("Status", 2));
+        assertTrue(nChangedVersion > nVersion2, "changed fragment is newer than all others");
+        assertTrue(nChangedVersion > nVersion1, "changed fragment is newer than before");
+        assertIntegerRange((int64_t)tracker.getFragmentVersion("module2"), (int64_t)nVersion2, (int64_t)nVersion2, "untouched fragment");
+
+        // A client that has seen nVersion2 only needs module1
+        assertTrue(tracker.getFragmentVersion("module1") > nVersion2, "module1 is part of the delta");
+        assertFalse(tracker.getFragmentVersion("module2") > nVersion2, "module2 is not part of the delta");
+    }
+
+    void test_MonotonicAfterClear() {
+        AMC::CUIStateVersionTracker tracker;
+        tracker.updateFragment("module1", serializeModule("Status", 1));
+        uint64_t nVersion = tracker.updateFragment("module2", serializeModule("Status", 1));
+
+        tracker.clear();
+        assertIntegerRange((int64_t)tracker.getFragmentVersion("module1"), 0, 0, "cleared fragment");
+
+        uint64_t nNewVersion = tracker.updateFragment("module1", serializeModule("Status", 1));
+        assertTrue(nNewVersion > nVersion, "version after clear");
+    }
+
+    void test_ReuseUnchangedFragments() {
+        auto pChrono = std::make_shared<AMCCommon::CChrono>();
+        AMC::CParameterGroup group("module", "module parameters", pChrono);
+        group.addNewStringParameter("caption", "caption", "Status");
+        group.addNewIntParameter("value", "value", 1);
+
+        AMC::CUIStateVersionTracker tracker;
+        AMC::PUIStateFragmentDocument pDocument;
+        uint64_t nCachedVersion = 0;
+        assertFalse(tracker.retrieveUnchangedFragment("module1", pDocument, nCachedVersion), "unknown fragment");
+
+        // Fragments without read set are never reused
+        tracker.updateFragment("module2", serializeModule("Status", 1));
+        assertFalse(tracker.retrieveUnchangedFragment("module2", pDocument, nCachedVersion), "fragment without read set");
+
+        auto pReadSet = std::make_shared<AMC::CParameterReadSet>();
+        uint64_t nVersion = tracker.updateFragment("module1", serializeModuleFromParameter(&group, pReadSet), pReadSet);
+
+        assertTrue(tracker.retrieveUnchangedFragment("module1", pDocument, nCachedVersion), "unchanged fragment");
+        assertIntegerRange((int64_t)nCachedVersion, (int64_t)nVersion, (int64_t)nVersion, "cached version");
+        assertTrue((*pDocument)["caption"].GetString() == std::string("Status"), "cached caption");
+        assertIntegerRange((*pDocument)["value"].GetInt64(), 1, 1, "cached value");
+
+        // Setting the same value again does not invalidate the fragment
+        group.setIntParameterValueByName("value", 1);
+        assertTrue(tracker.retrieveUnchangedFragment("module1", pDocument, nCachedVersion), "identical value");
+
+        group.setIntParameterValueByName("value", 2);
+        assertFalse(tracker.retrieveUnchangedFragment("module1", pDocument, nCachedVersion), "changed value");
+
+        pReadSet = std::make_shared<AMC::CParameterReadSet>();
+        uint64_t nNewVersion = tracker.updateFragment("module1", serializeModuleFromParameter(&group, pReadSet), pReadSet);
+        assertTrue(nNewVersion > nVersion, "version of changed fragment");
+        assertTrue(tracker.retrieveUnchangedFragment("module1", pDocument, nCachedVersion), "re-serialized fragment");
+        assertIntegerRange((*pDocument)["value"].GetInt64(), 2, 2, "re-serialized value");
+    }
+
+    void test_UntrackedReads() {
+        AMC::CUIStateVersionTracker tracker;
+        AMC::PUIStateFragmentDocument pDocument;
+        uint64_t nCachedVersion = 0;
+
+        auto pReadSet = std::make_shared<AMC::CParameterReadSet>();
+        {
+            AMC::CParameterReadRecording readRecording(pReadSet.get());
+            AMC::CParameterReadRecording::recordUntrackedRead();
+        }
+        tracker.updateFragment("module1", serializeModule("Status", 1), pReadSet);
+        assertFalse(tracker.retrieveUnchangedFragment("module1", pDocument, nCachedVersion), "untracked read");
+
+        // Reads outside of a recording are not attributed to any read set
+        auto pIdleReadSet = std::make_shared<AMC::CParameterReadSet>();
+        AMC::CParameterReadRecording::recordUntrackedRead();
+        assertTrue(pIdleReadSet->isUnchanged(), "read outside of recording");
+    }
+
+};
+
+
+}
+
+
+#endif // __AMCTEST_UNITTEST_UISTATEVERSIONTRACKER
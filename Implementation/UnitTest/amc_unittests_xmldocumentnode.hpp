@@ -79,6 +79,8 @@ namespace AMCUnitTest
             registerTest("RemoveAttributeAfterCopy", "Removing copied attribute should clean up maps", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_XMLDocumentNode::testRemoveAttributeAfterCopy, this));
             registerTest("CompareNameLogic", "compareName should match namespace and name properly", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_XMLDocumentNode::testCompareNameLogic, this));
             registerTest("ChildMapIntegrityAfterRemovals", "Child counters should update correctly after removals", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_XMLDocumentNode::testChildMapIntegrityAfterRemovals, this));
+            registerTest("IndexedChildLookup", "Lookups on nodes with many children stay consistent after removals", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_XMLDocumentNode::testIndexedChildLookup, this));
+            registerTest("ParsedNodesShareNames", "Parsed nodes with equal names share one name entry", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_XMLDocumentNode::testParsedNodesShareNames, this));
 
         }
 
@@ -515,6 +517,48 @@ namespace AMCUnitTest
             assertFalse(root->HasChild(ns.get(), "node"));
         }
 
+        void testIndexedChildLookup() {
+            auto doc = createBaseDocument();
+            auto root = doc->GetRootNode();
+            auto ns = doc->GetDefaultNamespace();
+
+            std::vector<AMC::PXMLDocumentNodeInstance> items;
+            for (uint32_t nIndex = 0; nIndex < 3 * AMC_XMLDOCUMENTNODE_CHILDINDEXTHRESHOLD; nIndex++) {
+                items.push_back(root->AddChild(ns, "item"));
+                root->AddChild(ns, "unique" + std::to_string(nIndex));
+            }
+
+            assertTrue(root->CountChildrenByName(ns.get(), "item") == items.size(), "All items must be counted.");
+            assertTrue(root->FindChild(ns.get(), "unique7", true)->GetName() == "unique7", "Unique child must be found.");
+            assertTrue(root->FindChild(ns.get(), "item", false) == nullptr, "Ambiguous child must not be found.");
+            assertFalse(root->HasChild(ns.get(), "missing"), "Unknown names must not be found.");
+
+            for (size_t nIndex = 1; nIndex < items.size(); nIndex++)
+                root->RemoveChild(items[nIndex].get());
+
+            assertTrue(root->HasUniqueChild(ns.get(), "item"), "One item must remain.");
+            assertTrue(root->FindChild(ns.get(), "item", true) == items.front(), "The remaining item must be found.");
+
+            root->RemoveChildrenWithName(ns.get(), "item");
+            assertFalse(root->HasChild(ns.get(), "item"), "Items must be gone after removal.");
+            assertTrue(root->HasUniqueChild(ns.get(), "unique0"), "Other children must stay.");
+        }
+
+        void testParsedNodesShareNames() {
+            AMC::CXMLDocumentInstance doc;
+            doc.parseXMLString("<root xmlns=\"http://example.com\"><entry name=\"a\"/><entry name=\"b\"/><other/></root>");
+
+            auto root = doc.GetRootNode();
+            auto ns = doc.GetDefaultNamespace();
+            auto entries = root->getChildrenByName(ns.get(), "entry");
+
+            assertIntegerRange(entries.size(), 2, 2, "entry count");
+            assertTrue(entries.at(0)->getNameID() == entries.at(1)->getNameID(), "Equal names must share their ID.");
+            assertFalse(entries.at(0)->getNameID() == root->FindChild(ns.get(), "other", true)->getNameID(), "Different names must have different IDs.");
+            assertTrue(entries.at(1)->FindAttribute(ns.get(), "name", true)->getValue() == "b", "Attribute must be parsed.");
+            assertIntegerRange(doc.getAllocatedNodeCount(), 4, 4, "allocated nodes");
+        }
+
 
 
     };
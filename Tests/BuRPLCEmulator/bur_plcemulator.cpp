@@ -0,0 +1,665 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract: Emulator of a B&R PLC speaking the legacy and the version 3 AMCF protocol.
+
+Usage:
+	bur_plcemulator serve [--port 12000] [--protocol legacy|v3] [--signature 171] [--cycletime 0] [--listduration 100]
+	bur_plcemulator benchmark [--host 127.0.0.1] [--port 12000] [--protocol legacy|v3] [--signature 171] [--count 10000] [--windows 1,4,16,64]
+
+The server answers every request like the PLC runtime does. With a cycle time given in microseconds, requests
+are collected and answered at the end of each task cycle, which is what makes pipelining on the client side pay off.
+The benchmark mode sends a stream of commands with a fixed number of requests in flight and reports throughput and
+round trip latencies.
+
+*/
+
+#include "crcpp/CRC.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <deque>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+typedef SOCKET emulatorSocket;
+#define EMULATOR_INVALIDSOCKET INVALID_SOCKET
+#define closeEmulatorSocket closesocket
+#else
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+typedef int emulatorSocket;
+#define EMULATOR_INVALIDSOCKET -1
+#define closeEmulatorSocket close
+#endif
+
+// Command IDs, see libmcdriver_bur_connector.hpp
+#define EMULATOR_COMMAND_BEGINLIST 101
+#define EMULATOR_COMMAND_EXECUTELIST 103
+#define EMULATOR_COMMAND_LISTSTATUS 105
+#define EMULATOR_COMMAND_MACHINESTATUSLEGACY 108
+#define EMULATOR_COMMAND_CURRENTJOURNALSTATUS 120
+#define EMULATOR_COMMAND_CURRENTJOURNALSCHEMA 121
+#define EMULATOR_COMMAND_BENCHMARK 1024
+
+#define EMULATOR_LISTSTATUS_RUNNING 2
+#define EMULATOR_LISTSTATUS_FINISHED 6
+
+#define EMULATOR_MACHINESTATUSSIZE 1024
+
+// Journal value type flags, see libmcdriver_bur_journal.cpp
+#define EMULATOR_JOURNALTYPE_INT32 0x60000000
+#define EMULATOR_JOURNALTYPE_DOUBLE 0x90000000
+#define EMULATOR_JOURNALTYPE_BOOL_TRUE 0xA0000000
+#define EMULATOR_JOURNALTYPE_BOOL_FALSE 0xB0000000
+
+
+// Wire structures, these must match the ones in libmcdriver_bur_connector.cpp
+#pragma pack(push)
+#pragma pack(1)
+
+struct sEmulatorPayload {
+	uint8_t m_nData[24];
+};
+
+struct sEmulatorRequestLegacy {
+	uint32_t m_nSignature;
+	uint8_t m_nMajorVersion;
+	uint8_t m_nMinorVersion;
+	uint8_t m_nPatchVersion;
+	uint8_t m_nBuildVersion;
+	uint32_t m_nClientID;
+	uint32_t m_nSequenceID;
+	uint32_t m_nCommandID;
+	sEmulatorPayload m_Payload;
+	uint32_t m_nChecksum;
+};
+
+struct sEmulatorReplyLegacy {
+	uint32_t m_nSignature;
+	uint8_t m_nMajorVersion;
+	uint8_t m_nMinorVersion;
+	uint8_t m_nPatchVersion;
+	uint8_t m_nBuildVersion;
+	uint32_t m_nClientID;
+	uint32_t m_nSequenceID;
+	uint32_t m_nErrorCode;
+	uint32_t m_nCommandID;
+	uint32_t m_nMessageLen;
+	uint32_t m_nHeaderChecksum;
+	uint32_t m_nDataChecksum;
+};
+
+struct sEmulatorRequestVersion3 {
+	uint32_t m_nSignature;
+	uint32_t m_nClientID;
+	uint32_t m_nSequenceID;
+	uint32_t m_nCommandID;
+	sEmulatorPayload m_Payload;
+	uint32_t m_nChecksum;
+};
+
+struct sEmulatorReplyVersion3 {
+	uint32_t m_nSignature;
+	uint32_t m_nClientID;
+	uint32_t m_nSequenceID;
+	uint32_t m_nErrorCode;
+	uint32_t m_nPayloadLength;
+	uint32_t m_nHeaderChecksum;
+	uint32_t m_nDataChecksum;
+};
+
+#pragma pack(pop)
+
+
+struct sEmulatorOptions {
+	std::string m_sHost = "127.0.0.1";
+	uint32_t m_nPort = 12000;
+	bool m_bLegacy = false;
+	uint32_t m_nSignature = 171;
+	uint32_t m_nCycleTimeInUS = 0;
+	uint32_t m_nListDurationInMS = 100;
+	uint32_t m_nBenchmarkCount = 10000;
+	std::vector<uint32_t> m_BenchmarkWindows = { 1, 4, 16, 64 };
+};
+
+
+static uint32_t calculateChecksum(const void* pData, size_t nSize)
+{
+	if (nSize == 0)
+		return 0;
+	return CRC::Calculate(pData, nSize, CRC::CRC_32());
+}
+
+static void sendAll(emulatorSocket socketHandle, const std::vector<uint8_t>& buffer)
+{
+	size_t nSent = 0;
+	while (nSent < buffer.size()) {
+		int nResult = send(socketHandle, (const char*)&buffer[nSent], (int)(buffer.size() - nSent), 0);
+		if (nResult <= 0)
+			throw std::runtime_error("could not send data");
+		nSent += (size_t)nResult;
+	}
+}
+
+static bool receiveSome(emulatorSocket socketHandle, std::vector<uint8_t>& buffer)
+{
+	uint8_t chunk[65536];
+	int nResult = recv(socketHandle, (char*)chunk, sizeof(chunk), 0);
+	if (nResult <= 0)
+		return false;
+	buffer.insert(buffer.end(), chunk, chunk + nResult);
+	return true;
+}
+
+static bool waitForSocket(emulatorSocket socketHandle, int64_t nTimeoutInUS)
+{
+	fd_set fds;
+	FD_ZERO(&fds);
+	FD_SET(socketHandle, &fds);
+
+	if (nTimeoutInUS < 0)
+		return select((int)socketHandle + 1, &fds, nullptr, nullptr, nullptr) > 0;
+
+	timeval timeout;
+	timeout.tv_sec = (long)(nTimeoutInUS / 1000000);
+	timeout.tv_usec = (long)(nTimeoutInUS % 1000000);
+	return select((int)socketHandle + 1, &fds, nullptr, nullptr, &timeout) > 0;
+}
+
+static void disableNagle(emulatorSocket socketHandle)
+{
+	int nFlag = 1;
+	setsockopt(socketHandle, IPPROTO_TCP, TCP_NODELAY, (const char*)&nFlag, sizeof(nFlag));
+}
+
+
+/*************************************************************************************************************************
+ Class definition of CPLCEmulator
+**************************************************************************************************************************/
+class CPLCEmulator {
+private:
+
+	sEmulatorOptions m_Options;
+
+	uint32_t m_nNextListID;
+	std::map<uint32_t, std::chrono::steady_clock::time_point> m_ListExecutionTimes;
+	uint64_t m_nCycleCounter;
+	uint64_t m_nRequestCounter;
+
+	std::string buildJournalSchema()
+	{
+		return "{\"schema\": \"amc-bur-journal-1.0\", \"groups\": [ {\"groupname\": \"status\", \"groupid\": 1, \"values\": ["
+			"{\"type\": \"DINT\", \"name\": \"cyclecounter\", \"id\": 1, \"size\": 4}, "
+			"{\"type\": \"LREAL\", \"name\": \"temperature\", \"id\": 2, \"size\": 8}, "
+			"{\"type\": \"BOOL\", \"name\": \"ready\", \"id\": 3, \"size\": 1} ] } ] }";
+	}
+
+	void appendUint32(std::vector<uint8_t>& buffer, uint32_t nValue)
+	{
+		buffer.insert(buffer.end(), (uint8_t*)&nValue, (uint8_t*)&nValue + sizeof(nValue));
+	}
+
+	void appendDouble(std::vector<uint8_t>& buffer, double dValue)
+	{
+		buffer.insert(buffer.end(), (uint8_t*)&dValue, (uint8_t*)&dValue + sizeof(dValue));
+	}
+
+	std::vector<uint8_t> buildJournalStatus()
+	{
+		std::vector<uint8_t> buffer;
+		appendUint32(buffer, 1);
+		appendUint32(buffer, 1);
+		appendUint32(buffer, 3);
+		appendUint32(buffer, EMULATOR_JOURNALTYPE_INT32 | 1);
+		appendUint32(buffer, (uint32_t)m_nCycleCounter);
+		appendUint32(buffer, EMULATOR_JOURNALTYPE_DOUBLE | 2);
+		appendDouble(buffer, 20.0 + (double)(m_nCycleCounter % 100) * 0.1);
+		appendUint32(buffer, EMULATOR_JOURNALTYPE_BOOL_TRUE | 3);
+		return buffer;
+	}
+
+	std::vector<uint8_t> executeCommand(uint32_t nCommandID, const sEmulatorPayload& payload)
+	{
+		std::vector<uint8_t> replyData;
+		uint32_t nParameter0;
+		memcpy(&nParameter0, &payload.m_nData[0], sizeof(nParameter0));
+
+		switch (nCommandID) {
+		case EMULATOR_COMMAND_BEGINLIST:
+			appendUint32(replyData, m_nNextListID);
+			m_nNextListID++;
+			break;
+
+		case EMULATOR_COMMAND_EXECUTELIST:
+			m_ListExecutionTimes[nParameter0] = std::chrono::steady_clock::now();
+			break;
+
+		case EMULATOR_COMMAND_LISTSTATUS: {
+			uint8_t nStatus = EMULATOR_LISTSTATUS_RUNNING;
+			auto iIter = m_ListExecutionTimes.find(nParameter0);
+			if (iIter != m_ListExecutionTimes.end()) {
+				if (std::chrono::steady_clock::now() >= iIter->second + std::chrono::milliseconds(m_Options.m_nListDurationInMS))
+					nStatus = EMULATOR_LISTSTATUS_FINISHED;
+			}
+			replyData.push_back(nStatus);
+			break;
+		}
+
+		case EMULATOR_COMMAND_MACHINESTATUSLEGACY:
+			replyData.resize(EMULATOR_MACHINESTATUSSIZE, 0);
+			memcpy(replyData.data(), &m_nCycleCounter, sizeof(uint32_t));
+			break;
+
+		case EMULATOR_COMMAND_CURRENTJOURNALSTATUS:
+			replyData = buildJournalStatus();
+			break;
+
+		case EMULATOR_COMMAND_CURRENTJOURNALSCHEMA: {
+			std::string sSchema = buildJournalSchema();
+			replyData.assign(sSchema.begin(), sSchema.end());
+			break;
+		}
+
+		default:
+			break;
+		}
+
+		m_nRequestCounter++;
+		return replyData;
+	}
+
+	// Answers all complete requests of the receive buffer. Returns false if the stream is corrupt.
+	bool processRequests(std::vector<uint8_t>& receiveBuffer, std::vector<uint8_t>& sendBuffer)
+	{
+		size_t nRequestSize = m_Options.m_bLegacy ? sizeof(sEmulatorRequestLegacy) : sizeof(sEmulatorRequestVersion3);
+		size_t nPosition = 0;
+
+		while (nPosition + nRequestSize <= receiveBuffer.size()) {
+			const uint8_t* pRequestData = &receiveBuffer[nPosition];
+			std::vector<uint8_t> replyHeader;
+
+			if (m_Options.m_bLegacy) {
+				sEmulatorRequestLegacy request;
+				memcpy(&request, pRequestData, sizeof(request));
+				if ((request.m_nSignature != m_Options.m_nSignature) || (request.m_nChecksum != calculateChecksum(&request, offsetof(sEmulatorRequestLegacy, m_nChecksum))))
+					return false;
+
+				auto replyData = executeCommand(request.m_nCommandID, request.m_Payload);
+
+				sEmulatorReplyLegacy reply;
+				reply.m_nSignature = m_Options.m_nSignature;
+				reply.m_nMajorVersion = request.m_nMajorVersion;
+				reply.m_nMinorVersion = request.m_nMinorVersion;
+				reply.m_nPatchVersion = request.m_nPatchVersion;
+				reply.m_nBuildVersion = request.m_nBuildVersion;
+				reply.m_nClientID = request.m_nClientID;
+				reply.m_nSequenceID = request.m_nSequenceID;
+				reply.m_nErrorCode = 0;
+				reply.m_nCommandID = request.m_nCommandID;
+				reply.m_nMessageLen = (uint32_t)(sizeof(reply) + replyData.size());
+				reply.m_nHeaderChecksum = calculateChecksum(&reply, offsetof(sEmulatorReplyLegacy, m_nHeaderChecksum));
+				reply.m_nDataChecksum = calculateChecksum(replyData.data(), replyData.size());
+
+				sendBuffer.insert(sendBuffer.end(), (uint8_t*)&reply, (uint8_t*)&reply + sizeof(reply));
+				sendBuffer.insert(sendBuffer.end(), replyData.begin(), replyData.end());
+			}
+			else {
+				sEmulatorRequestVersion3 request;
+				memcpy(&request, pRequestData, sizeof(request));
+				if ((request.m_nSignature != m_Options.m_nSignature) || (request.m_nChecksum != calculateChecksum(&request, offsetof(sEmulatorRequestVersion3, m_nChecksum))))
+					return false;
+
+				auto replyData = executeCommand(request.m_nCommandID, request.m_Payload);
+
+				sEmulatorReplyVersion3 reply;
+				reply.m_nSignature = m_Options.m_nSignature;
+				reply.m_nClientID = request.m_nClientID;
+				reply.m_nSequenceID = request.m_nSequenceID;
+				reply.m_nErrorCode = 0;
+				reply.m_nPayloadLength = (uint32_t)replyData.size();
+				reply.m_nHeaderChecksum = calculateChecksum(&reply, offsetof(sEmulatorReplyVersion3, m_nHeaderChecksum));
+				reply.m_nDataChecksum = calculateChecksum(replyData.data(), replyData.size());
+
+				sendBuffer.insert(sendBuffer.end(), (uint8_t*)&reply, (uint8_t*)&reply + sizeof(reply));
+				sendBuffer.insert(sendBuffer.end(), replyData.begin(), replyData.end());
+			}
+
+			nPosition += nRequestSize;
+		}
+
+		receiveBuffer.erase(receiveBuffer.begin(), receiveBuffer.begin() + nPosition);
+		return true;
+	}
+
+	void serveConnection(emulatorSocket clientSocket)
+	{
+		std::vector<uint8_t> receiveBuffer;
+		std::vector<uint8_t> sendBuffer;
+
+		auto cycleTime = std::chrono::microseconds(m_Options.m_nCycleTimeInUS);
+		auto nextCycle = std::chrono::steady_clock::now() + cycleTime;
+
+		while (true) {
+			int64_t nTimeoutInUS = -1;
+			if (m_Options.m_nCycleTimeInUS > 0)
+				nTimeoutInUS = std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::microseconds>(nextCycle - std::chrono::steady_clock::now()).count());
+
+			if (waitForSocket(clientSocket, nTimeoutInUS)) {
+				if (!receiveSome(clientSocket, receiveBuffer))
+					return;
+			}
+
+			auto currentTime = std::chrono::steady_clock::now();
+			if ((m_Options.m_nCycleTimeInUS > 0) && (currentTime < nextCycle))
+				continue;
+
+			if (!processRequests(receiveBuffer, sendBuffer)) {
+				std::cout << "received invalid request, closing connection" << std::endl;
+				return;
+			}
+
+			if (!sendBuffer.empty()) {
+				sendAll(clientSocket, sendBuffer);
+				sendBuffer.clear();
+			}
+
+			if (m_Options.m_nCycleTimeInUS > 0) {
+				m_nCycleCounter++;
+				nextCycle += cycleTime;
+				if (nextCycle < currentTime)
+					nextCycle = currentTime + cycleTime;
+			}
+		}
+	}
+
+public:
+
+	CPLCEmulator(const sEmulatorOptions& options)
+		: m_Options(options), m_nNextListID(1), m_nCycleCounter(0), m_nRequestCounter(0)
+	{
+	}
+
+	void serve()
+	{
+		emulatorSocket listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+		if (listenSocket == EMULATOR_INVALIDSOCKET)
+			throw std::runtime_error("could not create socket");
+
+		int nReuse = 1;
+		setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, (const char*)&nReuse, sizeof(nReuse));
+
+		sockaddr_in address;
+		memset(&address, 0, sizeof(address));
+		address.sin_family = AF_INET;
+		address.sin_addr.s_addr = htonl(INADDR_ANY);
+		address.sin_port = htons((uint16_t)m_Options.m_nPort);
+
+		if (bind(listenSocket, (sockaddr*)&address, sizeof(address)) != 0)
+			throw std::runtime_error("could not bind to port " + std::to_string(m_Options.m_nPort));
+		if (listen(listenSocket, 1) != 0)
+			throw std::runtime_error("could not listen on port " + std::to_string(m_Options.m_nPort));
+
+		std::cout << "B&R PLC emulator listening on port " << m_Options.m_nPort << " (" << (m_Options.m_bLegacy ? "legacy" : "version 3") << " protocol, cycle time " << m_Options.m_nCycleTimeInUS << "us)" << std::endl;
+
+		while (true) {
+			emulatorSocket clientSocket = accept(listenSocket, nullptr, nullptr);
+			if (clientSocket == EMULATOR_INVALIDSOCKET)
+				continue;
+
+			disableNagle(clientSocket);
+			std::cout << "client connected" << std::endl;
+
+			try {
+				serveConnection(clientSocket);
+			}
+			catch (std::exception& E) {
+				std::cout << "connection error: " << E.what() << std::endl;
+			}
+
+			closeEmulatorSocket(clientSocket);
+			std::cout << "client disconnected after " << m_nRequestCounter << " requests" << std::endl;
+		}
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Benchmark client
+**************************************************************************************************************************/
+static std::vector<uint8_t> makeBenchmarkRequest(const sEmulatorOptions& options, uint32_t nSequenceID)
+{
+	std::vector<uint8_t> buffer;
+	if (options.m_bLegacy) {
+		sEmulatorRequestLegacy request;
+		memset(&request, 0, sizeof(request));
+		request.m_nSignature = options.m_nSignature;
+		request.m_nClientID = nSequenceID ^ 0x5A5A5A5A;
+		request.m_nSequenceID = nSequenceID;
+		request.m_nCommandID = EMULATOR_COMMAND_BENCHMARK;
+		request.m_nChecksum = calculateChecksum(&request, offsetof(sEmulatorRequestLegacy, m_nChecksum));
+		buffer.assign((uint8_t*)&request, (uint8_t*)&request + sizeof(request));
+	}
+	else {
+		sEmulatorRequestVersion3 request;
+		memset(&request, 0, sizeof(request));
+		request.m_nSignature = options.m_nSignature;
+		request.m_nClientID = nSequenceID ^ 0x5A5A5A5A;
+		request.m_nSequenceID = nSequenceID;
+		request.m_nCommandID = EMULATOR_COMMAND_BENCHMARK;
+		request.m_nChecksum = calculateChecksum(&request, offsetof(sEmulatorRequestVersion3, m_nChecksum));
+		buffer.assign((uint8_t*)&request, (uint8_t*)&request + sizeof(request));
+	}
+	return buffer;
+}
+
+// Extracts the sequence IDs of all complete replies in the buffer.
+static void parseBenchmarkReplies(const sEmulatorOptions& options, std::vector<uint8_t>& buffer, std::vector<uint32_t>& sequenceIDs)
+{
+	size_t nPosition = 0;
+	while (true) {
+		if (options.m_bLegacy) {
+			if (nPosition + sizeof(sEmulatorReplyLegacy) > buffer.size())
+				break;
+			sEmulatorReplyLegacy reply;
+			memcpy(&reply, &buffer[nPosition], sizeof(reply));
+			if (nPosition + reply.m_nMessageLen > buffer.size())
+				break;
+			sequenceIDs.push_back(reply.m_nSequenceID);
+			nPosition += reply.m_nMessageLen;
+		}
+		else {
+			if (nPosition + sizeof(sEmulatorReplyVersion3) > buffer.size())
+				break;
+			sEmulatorReplyVersion3 reply;
+			memcpy(&reply, &buffer[nPosition], sizeof(reply));
+			if (nPosition + sizeof(reply) + reply.m_nPayloadLength > buffer.size())
+				break;
+			sequenceIDs.push_back(reply.m_nSequenceID);
+			nPosition += sizeof(reply) + reply.m_nPayloadLength;
+		}
+	}
+	buffer.erase(buffer.begin(), buffer.begin() + nPosition);
+}
+
+static void runBenchmark(const sEmulatorOptions& options, uint32_t nWindowSize)
+{
+	emulatorSocket clientSocket = socket(AF_INET, SOCK_STREAM, 0);
+	if (clientSocket == EMULATOR_INVALIDSOCKET)
+		throw std::runtime_error("could not create socket");
+
+	sockaddr_in address;
+	memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_port = htons((uint16_t)options.m_nPort);
+	if (inet_pton(AF_INET, options.m_sHost.c_str(), &address.sin_addr) != 1)
+		throw std::runtime_error("invalid host address: " + options.m_sHost);
+	if (connect(clientSocket, (sockaddr*)&address, sizeof(address)) != 0)
+		throw std::runtime_error("could not connect to " + options.m_sHost + ":" + std::to_string(options.m_nPort));
+	disableNagle(clientSocket);
+
+	std::map<uint32_t, std::chrono::steady_clock::time_point> sendTimes;
+	std::vector<double> latencies;
+	latencies.reserve(options.m_nBenchmarkCount);
+
+	std::vector<uint8_t> receiveBuffer;
+	std::vector<uint32_t> sequenceIDs;
+	uint32_t nNextSequenceID = 1;
+	uint32_t nReceived = 0;
+
+	auto startTime = std::chrono::steady_clock::now();
+
+	while (nReceived < options.m_nBenchmarkCount) {
+		std::vector<uint8_t> sendBuffer;
+		while ((sendTimes.size() < nWindowSize) && (nNextSequenceID <= options.m_nBenchmarkCount)) {
+			auto request = makeBenchmarkRequest(options, nNextSequenceID);
+			sendBuffer.insert(sendBuffer.end(), request.begin(), request.end());
+			sendTimes[nNextSequenceID] = std::chrono::steady_clock::now();
+			nNextSequenceID++;
+		}
+		if (!sendBuffer.empty())
+			sendAll(clientSocket, sendBuffer);
+
+		if (!receiveSome(clientSocket, receiveBuffer))
+			throw std::runtime_error("connection closed by emulator");
+
+		sequenceIDs.clear();
+		parseBenchmarkReplies(options, receiveBuffer, sequenceIDs);
+		auto receiveTime = std::chrono::steady_clock::now();
+		for (auto nSequenceID : sequenceIDs) {
+			auto iIter = sendTimes.find(nSequenceID);
+			if (iIter == sendTimes.end())
+				throw std::runtime_error("received unexpected sequence ID " + std::to_string(nSequenceID));
+			latencies.push_back(std::chrono::duration<double, std::micro>(receiveTime - iIter->second).count());
+			sendTimes.erase(iIter);
+			nReceived++;
+		}
+	}
+
+	double dTotalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+	closeEmulatorSocket(clientSocket);
+
+	std::sort(latencies.begin(), latencies.end());
+	double dMedian = latencies.at(latencies.size() / 2);
+	double dP99 = latencies.at(std::min(latencies.size() - 1, (latencies.size() * 99) / 100));
+
+	std::cout << "window " << nWindowSize << ": " << (uint64_t)(options.m_nBenchmarkCount / dTotalSeconds) << " commands/s, "
+		<< "latency median " << dMedian << "us, p99 " << dP99 << "us" << std::endl;
+}
+
+
+static sEmulatorOptions parseOptions(int argc, char** argv, int nFirstArgument)
+{
+	sEmulatorOptions options;
+	for (int nIndex = nFirstArgument; nIndex + 1 < argc; nIndex += 2) {
+		std::string sKey = argv[nIndex];
+		std::string sValue = argv[nIndex + 1];
+
+		if (sKey == "--host")
+			options.m_sHost = sValue;
+		else if (sKey == "--port")
+			options.m_nPort = (uint32_t)std::stoul(sValue);
+		else if (sKey == "--protocol")
+			options.m_bLegacy = (sValue == "legacy");
+		else if (sKey == "--signature")
+			options.m_nSignature = (uint32_t)std::stoul(sValue);
+		else if (sKey == "--cycletime")
+			options.m_nCycleTimeInUS = (uint32_t)std::stoul(sValue);
+		else if (sKey == "--listduration")
+			options.m_nListDurationInMS = (uint32_t)std::stoul(sValue);
+		else if (sKey == "--count")
+			options.m_nBenchmarkCount = std::max<uint32_t>(1, (uint32_t)std::stoul(sValue));
+		else if (sKey == "--windows") {
+			options.m_BenchmarkWindows.clear();
+			size_t nStart = 0;
+			while (nStart < sValue.size()) {
+				size_t nEnd = sValue.find(',', nStart);
+				if (nEnd == std::string::npos)
+					nEnd = sValue.size();
+				options.m_BenchmarkWindows.push_back(std::max<uint32_t>(1, (uint32_t)std::stoul(sValue.substr(nStart, nEnd - nStart))));
+				nStart = nEnd + 1;
+			}
+		}
+		else
+			throw std::runtime_error("unknown option: " + sKey);
+	}
+	return options;
+}
+
+
+int main(int argc, char** argv)
+{
+	try {
+#ifdef _WIN32
+		WSADATA wsaData;
+		if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0)
+			throw std::runtime_error("could not initialize networking");
+#endif
+
+		std::string sMode = "serve";
+		int nFirstArgument = 1;
+		if ((argc > 1) && (std::string(argv[1]).substr(0, 2) != "--")) {
+			sMode = argv[1];
+			nFirstArgument = 2;
+		}
+
+		auto options = parseOptions(argc, argv, nFirstArgument);
+
+		if (sMode == "serve") {
+			CPLCEmulator emulator(options);
+			emulator.serve();
+		}
+		else if (sMode == "benchmark") {
+			for (auto nWindowSize : options.m_BenchmarkWindows)
+				runBenchmark(options, nWindowSize);
+		}
+		else
+			throw std::runtime_error("unknown mode: " + sMode);
+	}
+	catch (std::exception& E) {
+		std::cout << "error: " << E.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,334 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract: Test and benchmark of the FrameBuffer driver's drawing and dirty rectangle tracking.
+
+Usage:
+	framebuffer_test [--width 1920] [--height 1080] [--frames 200]
+
+The test draws random rectangles and pixels into memory framebuffers of all bit depths and compares
+the flipped front page against a reference drawing. Afterwards it measures rectangle fills and flips
+of small damaged regions against full screen copies.
+
+*/
+
+#include "libmcdriver_framebuffer_framebuffermemory.hpp"
+#include "libmcdriver_framebuffer_dirtyregion.hpp"
+#include "libmcdriver_framebuffer_interfaceexception.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+
+using namespace LibMCDriver_FrameBuffer::Impl;
+
+typedef std::chrono::steady_clock testClock;
+
+static uint32_t s_nFailureCount = 0;
+
+static void checkCondition(bool bCondition, const std::string& sDescription)
+{
+	if (!bCondition) {
+		std::cout << "FAILED: " << sDescription << std::endl;
+		s_nFailureCount++;
+	}
+}
+
+static double secondsSince(testClock::time_point startTime)
+{
+	return std::chrono::duration<double>(testClock::now() - startTime).count();
+}
+
+static LibMCDriver_FrameBuffer::sColor makeColor(uint8_t nRed, uint8_t nGreen, uint8_t nBlue)
+{
+	LibMCDriver_FrameBuffer::sColor color;
+	color.m_Red = nRed;
+	color.m_Green = nGreen;
+	color.m_Blue = nBlue;
+	return color;
+}
+
+static std::string bitDepthName(LibMCDriver_FrameBuffer::eFrameBufferBitDepth bitDepth)
+{
+	switch (bitDepth) {
+	case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB565: return "RGB565";
+	case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB888: return "RGB888";
+	case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGBA8888: return "RGBA8888";
+	default: return "unknown";
+	}
+}
+
+// Straightforward per pixel drawing, which the driver's output is compared against.
+class CReferenceScreen {
+private:
+	uint32_t m_nWidth;
+	uint32_t m_nHeight;
+	uint32_t m_nBytesPerPixel;
+	LibMCDriver_FrameBuffer::eFrameBufferBitDepth m_BitDepth;
+	std::vector<uint8_t> m_Pixels;
+
+public:
+	CReferenceScreen(uint32_t nWidth, uint32_t nHeight, LibMCDriver_FrameBuffer::eFrameBufferBitDepth bitDepth)
+		: m_nWidth(nWidth), m_nHeight(nHeight), m_BitDepth(bitDepth)
+	{
+		m_nBytesPerPixel = (bitDepth == LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB565) ? 2 : ((bitDepth == LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB888) ? 3 : 4);
+		m_Pixels.resize((size_t)nWidth * nHeight * m_nBytesPerPixel, 0);
+		for (size_t nIndex = 3; (m_nBytesPerPixel == 4) && (nIndex < m_Pixels.size()); nIndex += 4)
+			m_Pixels[nIndex] = 255;
+	}
+
+	void setPixel(int32_t nX, int32_t nY, LibMCDriver_FrameBuffer::sColor color)
+	{
+		if ((nX < 0) || (nY < 0) || (nX >= (int32_t)m_nWidth) || (nY >= (int32_t)m_nHeight))
+			return;
+
+		uint8_t* pPixel = &m_Pixels[((size_t)nY * m_nWidth + nX) * m_nBytesPerPixel];
+		if (m_nBytesPerPixel == 2) {
+			uint16_t nRawColor = ((color.m_Blue & 0xF8) << 8) | ((color.m_Green & 0xFC) << 3) | (color.m_Red >> 3);
+			memcpy(pPixel, &nRawColor, 2);
+		}
+		else {
+			pPixel[0] = color.m_Red;
+			pPixel[1] = color.m_Green;
+			pPixel[2] = color.m_Blue;
+			if (m_nBytesPerPixel == 4)
+				pPixel[3] = 255;
+		}
+	}
+
+	void fillRectangle(int32_t nX1, int32_t nY1, int32_t nX2, int32_t nY2, LibMCDriver_FrameBuffer::sColor color)
+	{
+		for (int32_t nY = std::min(nY1, nY2); nY <= std::max(nY1, nY2); nY++)
+			for (int32_t nX = std::min(nX1, nX2); nX <= std::max(nX1, nX2); nX++)
+				setPixel(nX, nY, color);
+	}
+
+	bool matches(const uint8_t* pScreen, uint32_t nLineLength)
+	{
+		size_t nRowSize = (size_t)m_nWidth * m_nBytesPerPixel;
+		for (uint32_t nY = 0; nY < m_nHeight; nY++) {
+			if (memcmp(pScreen + (size_t)nY * nLineLength, &m_Pixels[nY * nRowSize], nRowSize) != 0)
+				return false;
+		}
+		return true;
+	}
+};
+
+static void testDirtyRegion()
+{
+	CFrameBufferDirtyRegion region(1000, 1000);
+	checkCondition(region.isEmpty(), "new region is empty");
+
+	region.addRectangle(10, 10, 10, 10);
+	region.addRectangle(12, 12, 4, 4);
+	checkCondition(region.getRectangles().size() == 1, "contained rectangle is absorbed");
+
+	region.addRectangle(20, 10, 10, 10);
+	checkCondition((region.getRectangles().size() == 1) && (region.getPixelCount() == 200), "adjacent rectangle is merged without waste");
+
+	region.addRectangle(500, 500, 10, 10);
+	checkCondition(region.getRectangles().size() == 2, "distant rectangle is kept separately");
+
+	region.addRectangle(505, 505, 10, 10);
+	checkCondition(region.getRectangles().size() == 2, "overlapping rectangle is merged");
+
+	region.addRectangle(990, 990, 100, 100);
+	checkCondition(region.getRectangles().back().m_nCountX == 10, "rectangle is clipped to the screen");
+
+	region.addRectangle(1000, 0, 10, 10);
+	checkCondition(region.getRectangles().size() == 3, "rectangle outside of the screen is ignored");
+
+	for (uint32_t nIndex = 0; nIndex < FRAMEBUFFER_MAXDIRTYRECTANGLES * 2; nIndex++)
+		region.addRectangle(nIndex * 15, 900 - nIndex * 10, 2, 2);
+	checkCondition(region.getRectangles().size() <= FRAMEBUFFER_MAXDIRTYRECTANGLES, "rectangle count is bounded");
+
+	region.clear();
+	region.addRectangle(0, 0, 1000, 800);
+	checkCondition(region.isFullScreen(), "large region becomes full screen");
+}
+
+static void testDrawing(LibMCDriver_FrameBuffer::eFrameBufferBitDepth bitDepth, bool bDoubleBuffering)
+{
+	const uint32_t nWidth = 301;
+	const uint32_t nHeight = 203;
+
+	CFrameBufferMemoryInstance frameBuffer("test", nWidth, nHeight, bitDepth, bDoubleBuffering);
+	CReferenceScreen reference(nWidth, nHeight, bitDepth);
+
+	std::string sCase = bitDepthName(bitDepth) + (bDoubleBuffering ? " double buffered" : " single buffered");
+	checkCondition(reference.matches(frameBuffer.getFrontBuffer(), frameBuffer.getScanLineLength()), sCase + ": initial screen is black");
+
+	std::mt19937 randomGenerator(1234);
+	std::uniform_int_distribution<int32_t> coordinateDistribution(-50, 350);
+	std::uniform_int_distribution<uint32_t> colorDistribution(0, 255);
+
+	for (uint32_t nFrame = 0; nFrame < 50; nFrame++) {
+		uint32_t nOperationCount = 1 + nFrame % 7;
+		for (uint32_t nOperation = 0; nOperation < nOperationCount; nOperation++) {
+			auto color = makeColor(colorDistribution(randomGenerator), colorDistribution(randomGenerator), colorDistribution(randomGenerator));
+			int32_t nX1 = coordinateDistribution(randomGenerator) / (int32_t)((nOperation % 2) + 1);
+			int32_t nY1 = coordinateDistribution(randomGenerator) / (int32_t)((nOperation % 2) + 1);
+
+			if (nOperation % 3 == 2) {
+				frameBuffer.setPixel(nX1, nY1, color);
+				reference.setPixel(nX1, nY1, color);
+			}
+			else {
+				int32_t nX2 = nX1 + coordinateDistribution(randomGenerator) / 8;
+				int32_t nY2 = nY1 + coordinateDistribution(randomGenerator) / 8;
+				frameBuffer.fillRectangle(nX1, nY1, nX2, nY2, color);
+				reference.fillRectangle(nX1, nY1, nX2, nY2, color);
+			}
+		}
+
+		if (nFrame == 25) {
+			auto color = makeColor(17, 99, 200);
+			frameBuffer.clearScreen(color);
+			reference.fillRectangle(0, 0, nWidth - 1, nHeight - 1, color);
+		}
+
+		frameBuffer.flip();
+		checkCondition(frameBuffer.getDirtyRegion().isEmpty(), sCase + ": flip clears the dirty region");
+
+		if (!reference.matches(frameBuffer.getFrontBuffer(), frameBuffer.getScanLineLength())) {
+			checkCondition(false, sCase + ": front page matches reference after frame " + std::to_string(nFrame));
+			break;
+		}
+	}
+
+	if (bDoubleBuffering) {
+		frameBuffer.setPixel(5, 5, makeColor(255, 255, 255));
+		uint64_t nCopiedPixelCount = frameBuffer.getCopiedPixelCount();
+		frameBuffer.flip();
+		checkCondition(frameBuffer.getCopiedPixelCount() == nCopiedPixelCount + 1, sCase + ": flip copies only the damaged pixel");
+	}
+}
+
+static void runBenchmark(uint32_t nWidth, uint32_t nHeight, uint32_t nFrameCount)
+{
+	std::cout << "Benchmark " << nWidth << "x" << nHeight << ", " << nFrameCount << " frames" << std::endl;
+
+	std::vector<LibMCDriver_FrameBuffer::eFrameBufferBitDepth> bitDepths = {
+		LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB565,
+		LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB888,
+		LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGBA8888 };
+
+	for (auto bitDepth : bitDepths) {
+		CFrameBufferMemoryInstance frameBuffer("benchmark", nWidth, nHeight, bitDepth, true);
+		auto color = makeColor(10, 200, 30);
+
+		auto startTime = testClock::now();
+		for (uint32_t nFrame = 0; nFrame < nFrameCount; nFrame++)
+			frameBuffer.clearScreen(color);
+		double dClearTime = secondsSince(startTime) / nFrameCount;
+
+		frameBuffer.flip();
+
+		// A typical HMI update: a status field and a small indicator change per frame.
+		startTime = testClock::now();
+		for (uint32_t nFrame = 0; nFrame < nFrameCount; nFrame++) {
+			frameBuffer.fillRectangle(100, 100, 400, 140, makeColor(nFrame & 0xff, 0, 0));
+			frameBuffer.fillRectangle(nWidth - 64, 16, nWidth - 16, 64, makeColor(0, nFrame & 0xff, 0));
+			frameBuffer.flip();
+		}
+		double dDirtyFrameTime = secondsSince(startTime) / nFrameCount;
+
+		startTime = testClock::now();
+		for (uint32_t nFrame = 0; nFrame < nFrameCount; nFrame++) {
+			frameBuffer.fillRectangle(100, 100, 400, 140, makeColor(nFrame & 0xff, 0, 0));
+			frameBuffer.fillRectangle(nWidth - 64, 16, nWidth - 16, 64, makeColor(0, nFrame & 0xff, 0));
+			frameBuffer.fillRectangle(0, 0, 0, 0, color);
+			frameBuffer.fillRectangle(nWidth - 1, nHeight - 1, nWidth - 1, nHeight - 1, color);
+			frameBuffer.flip();
+		}
+		double dSpreadFrameTime = secondsSince(startTime) / nFrameCount;
+
+		startTime = testClock::now();
+		for (uint32_t nFrame = 0; nFrame < nFrameCount; nFrame++) {
+			frameBuffer.fillRectangle(100, 100, 400, 140, makeColor(nFrame & 0xff, 0, 0));
+			frameBuffer.clearScreen(color);
+			frameBuffer.flip();
+		}
+		double dFullFrameTime = secondsSince(startTime) / nFrameCount;
+
+		std::cout << std::fixed << std::setprecision(3)
+			<< "  " << std::setw(8) << bitDepthName(bitDepth)
+			<< ": clear " << dClearTime * 1000.0 << " ms"
+			<< ", two rectangles + flip " << dDirtyFrameTime * 1000.0 << " ms"
+			<< ", with corner pixels " << dSpreadFrameTime * 1000.0 << " ms"
+			<< ", full redraw + flip " << dFullFrameTime * 1000.0 << " ms" << std::endl;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	try {
+		uint32_t nWidth = 1920;
+		uint32_t nHeight = 1080;
+		uint32_t nFrameCount = 200;
+
+		for (int nIndex = 1; nIndex + 1 < argc; nIndex += 2) {
+			std::string sOption = argv[nIndex];
+			uint32_t nValue = (uint32_t)std::stoul(argv[nIndex + 1]);
+			if (sOption == "--width")
+				nWidth = nValue;
+			else if (sOption == "--height")
+				nHeight = nValue;
+			else if (sOption == "--frames")
+				nFrameCount = std::max(nValue, (uint32_t)1);
+			else
+				throw std::runtime_error("unknown option: " + sOption);
+		}
+
+		testDirtyRegion();
+		for (auto bitDepth : { LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB565, LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB888, LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGBA8888 }) {
+			testDrawing(bitDepth, true);
+			testDrawing(bitDepth, false);
+		}
+
+		if (s_nFailureCount > 0) {
+			std::cout << s_nFailureCount << " checks failed." << std::endl;
+			return 1;
+		}
+		std::cout << "All checks passed." << std::endl << std::endl;
+
+		runBenchmark(nWidth, nHeight, nFrameCount);
+	}
+	catch (std::exception& E) {
+		std::cout << "error: " << E.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,630 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: Test and benchmark of batched node access and subscriptions of the OPC UA client.
+
+Usage:
+	opcua_subscriptiontest [--nodes 100] [--cycles 200] [--updates 200] [--requiresubscriptions 1]
+
+The test first checks the conversion between interface values and typed OPC UA variants. Then it
+starts an in-process open62541 server with integer, double and string variables and checks batched
+reads, queued writes and monitored items with deadband filtering against it. Afterwards it compares
+polling every node with a single read per node against one batched read per cycle, and measures the
+latency between a server side value change and its data change notification.
+
+The shipped open62541 binary is built without server side subscriptions, so the subscription checks
+are reported as skipped against it. Build against an open62541 with subscriptions (see CMakeLists.txt)
+and pass --requiresubscriptions 1 to make a missing subscription support fail the test.
+
+*/
+
+#include "libopen62541_opcclient.hpp"
+#include "libopen62541_valueconversion.hpp"
+#include "libopen62541_interfaceexception.hpp"
+
+#include <open62541/server.h>
+#include <open62541/server_config_default.h>
+#include <open62541/plugin/accesscontrol_default.h>
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+#include <cstring>
+
+using namespace LibOpen62541::Impl;
+
+#define TESTNAMESPACE 1
+#define TESTPORT 48410
+#define TESTUSERNAME "amc"
+#define TESTPASSWORD "amc"
+#define TESTAPPLICATIONURL "urn:amc:opcuasubscriptiontest"
+#define TESTTIMEOUTINMS 5000
+
+typedef std::chrono::steady_clock testClock;
+
+static uint32_t s_nFailureCount = 0;
+
+static void checkCondition(bool bCondition, const std::string& sDescription)
+{
+	if (!bCondition) {
+		std::cout << "FAILED: " << sDescription << std::endl;
+		s_nFailureCount++;
+	}
+}
+
+static double secondsSince(testClock::time_point startTime)
+{
+	return std::chrono::duration<double>(testClock::now() - startTime).count();
+}
+
+static std::string integerNodeName(uint32_t nIndex)
+{
+	return "Integer" + std::to_string(nIndex);
+}
+
+static std::string doubleNodeName(uint32_t nIndex)
+{
+	return "Double" + std::to_string(nIndex);
+}
+
+static LibOpen62541Result getErrorCode(std::function<void()> Function)
+{
+	try {
+		Function();
+	}
+	catch (ELibOpen62541InterfaceException& E) {
+		return E.getErrorCode();
+	}
+	return LIBOPEN62541_SUCCESS;
+}
+
+
+static bool variantHasInteger(const UA_Variant& variant, const UA_DataType* pDataType, int64_t nExpectedValue)
+{
+	if (!UA_Variant_hasScalarType(&variant, pDataType))
+		return false;
+
+	if (pDataType == &UA_TYPES[UA_TYPES_SBYTE])
+		return *(UA_SByte*)variant.data == nExpectedValue;
+	if (pDataType == &UA_TYPES[UA_TYPES_UINT32])
+		return *(UA_UInt32*)variant.data == nExpectedValue;
+
+	return false;
+}
+
+// Writes the value and reads it back with the same node type.
+static int64_t roundTripInteger(LibOpen62541::eUAIntegerType eNodeType, int64_t nValue)
+{
+	UA_Variant variant;
+	UA_Variant_init(&variant);
+	COPCValueConversion::integerToVariant(&variant, eNodeType, nValue);
+	int64_t nResult = COPCValueConversion::variantToInteger(&variant, eNodeType, "RoundTrip");
+	UA_Variant_clear(&variant);
+	return nResult;
+}
+
+static void testValueConversion()
+{
+	std::cout << "Testing value conversion..." << std::endl;
+
+	UA_Variant variant;
+
+	// Int8 nodes have to be written as SByte, not as Byte.
+	UA_Variant_init(&variant);
+	COPCValueConversion::integerToVariant(&variant, LibOpen62541::eUAIntegerType::UAInt8, -5);
+	checkCondition(variantHasInteger(variant, &UA_TYPES[UA_TYPES_SBYTE], -5), "Int8 is encoded as SByte");
+	UA_Variant_clear(&variant);
+	checkCondition(roundTripInteger(LibOpen62541::eUAIntegerType::UAInt8, INT8_MIN) == INT8_MIN, "Int8 minimum");
+	checkCondition(roundTripInteger(LibOpen62541::eUAIntegerType::UAInt8, INT8_MAX) == INT8_MAX, "Int8 maximum");
+	checkCondition(getErrorCode([&]() { roundTripInteger(LibOpen62541::eUAIntegerType::UAInt8, INT8_MAX + 1); }) == LIBOPEN62541_ERROR_OPCUAWRITEINTEGEROUTOFBOUNDS, "Int8 above maximum");
+	checkCondition(getErrorCode([&]() { roundTripInteger(LibOpen62541::eUAIntegerType::UAInt8, INT8_MIN - 1); }) == LIBOPEN62541_ERROR_OPCUAWRITEINTEGEROUTOFBOUNDS, "Int8 below minimum");
+
+	// UInt32 nodes accept the full unsigned range and nothing beyond.
+	UA_Variant_init(&variant);
+	COPCValueConversion::integerToVariant(&variant, LibOpen62541::eUAIntegerType::UAUInt32, UINT32_MAX);
+	checkCondition(variantHasInteger(variant, &UA_TYPES[UA_TYPES_UINT32], UINT32_MAX), "UInt32 maximum is encoded");
+	UA_Variant_clear(&variant);
+	checkCondition(roundTripInteger(LibOpen62541::eUAIntegerType::UAUInt32, UINT32_MAX) == UINT32_MAX, "UInt32 maximum");
+	checkCondition(getErrorCode([&]() { roundTripInteger(LibOpen62541::eUAIntegerType::UAUInt32, (int64_t)UINT32_MAX + 1); }) == LIBOPEN62541_ERROR_OPCUAWRITEINTEGEROUTOFBOUNDS, "UInt32 above maximum");
+	checkCondition(getErrorCode([&]() { roundTripInteger(LibOpen62541::eUAIntegerType::UAUInt32, -1); }) == LIBOPEN62541_ERROR_OPCUAWRITEINTEGEROUTOFBOUNDS, "UInt32 below zero");
+
+	checkCondition(roundTripInteger(LibOpen62541::eUAIntegerType::UAUInt8, UINT8_MAX) == UINT8_MAX, "UInt8 maximum");
+	checkCondition(roundTripInteger(LibOpen62541::eUAIntegerType::UAUInt16, UINT16_MAX) == UINT16_MAX, "UInt16 maximum");
+	checkCondition(roundTripInteger(LibOpen62541::eUAIntegerType::UAUInt64, INT64_MAX) == INT64_MAX, "UInt64 maximum");
+	checkCondition(roundTripInteger(LibOpen62541::eUAIntegerType::UAInt16, INT16_MIN) == INT16_MIN, "Int16 minimum");
+	checkCondition(roundTripInteger(LibOpen62541::eUAIntegerType::UAInt32, INT32_MIN) == INT32_MIN, "Int32 minimum");
+	checkCondition(roundTripInteger(LibOpen62541::eUAIntegerType::UAInt64, INT64_MIN) == INT64_MIN, "Int64 minimum");
+	checkCondition(getErrorCode([&]() { roundTripInteger(LibOpen62541::eUAIntegerType::UAUInt16, UINT16_MAX + 1); }) == LIBOPEN62541_ERROR_OPCUAWRITEINTEGEROUTOFBOUNDS, "UInt16 above maximum");
+
+	// Double64 nodes are read as Double; a Float value is of the wrong type.
+	UA_Double doubleValue = 0.1;
+	UA_Variant_init(&variant);
+	UA_Variant_setScalar(&variant, &doubleValue, &UA_TYPES[UA_TYPES_DOUBLE]);
+	checkCondition(COPCValueConversion::variantToDouble(&variant, LibOpen62541::eUADoubleType::UADouble64, "Double") == 0.1, "Double64 is read as Double");
+	checkCondition(getErrorCode([&]() { COPCValueConversion::variantToDouble(&variant, LibOpen62541::eUADoubleType::UAFloat32, "Double"); }) == LIBOPEN62541_ERROR_READVALUEISOFINCORRECTTYPE, "Double is not read as Float");
+
+	UA_Float floatValue = 0.5f;
+	UA_Variant_init(&variant);
+	UA_Variant_setScalar(&variant, &floatValue, &UA_TYPES[UA_TYPES_FLOAT]);
+	checkCondition(COPCValueConversion::variantToDouble(&variant, LibOpen62541::eUADoubleType::UAFloat32, "Float") == 0.5, "Float32 is read as Float");
+	checkCondition(getErrorCode([&]() { COPCValueConversion::variantToDouble(&variant, LibOpen62541::eUADoubleType::UADouble64, "Float"); }) == LIBOPEN62541_ERROR_READVALUEISOFINCORRECTTYPE, "Float is not read as Double");
+
+	UA_Variant_init(&variant);
+	COPCValueConversion::doubleToVariant(&variant, LibOpen62541::eUADoubleType::UADouble64, 0.1);
+	checkCondition(UA_Variant_hasScalarType(&variant, &UA_TYPES[UA_TYPES_DOUBLE]) && (*(UA_Double*)variant.data == 0.1), "Double64 is written without loss");
+	UA_Variant_clear(&variant);
+
+	UA_Variant_init(&variant);
+	COPCValueConversion::stringToVariant(&variant, "value");
+	checkCondition(COPCValueConversion::variantToString(&variant, "String") == "value", "string round trip");
+	checkCondition(getErrorCode([&]() { COPCValueConversion::variantToInteger(&variant, LibOpen62541::eUAIntegerType::UAInt32, "String"); }) == LIBOPEN62541_ERROR_READVALUEISOFINCORRECTTYPE, "string is not read as integer");
+	UA_Variant_clear(&variant);
+}
+
+
+// open62541 server with string node IDs, iterated on its own thread.
+class CTestServer {
+private:
+	UA_Server* m_pServer;
+	std::thread m_Thread;
+	std::atomic<bool> m_bRunning;
+
+	void addVariable(const std::string& sNodeName, const UA_Variant& value)
+	{
+		UA_VariableAttributes attributes = UA_VariableAttributes_default;
+		UA_Variant_copy(&value, &attributes.value);
+		attributes.displayName = UA_LOCALIZEDTEXT_ALLOC("en-US", sNodeName.c_str());
+		attributes.accessLevel = UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE;
+
+		UA_NodeId nodeId = UA_NODEID_STRING_ALLOC(TESTNAMESPACE, sNodeName.c_str());
+		UA_QualifiedName browseName = UA_QUALIFIEDNAME_ALLOC(TESTNAMESPACE, sNodeName.c_str());
+		UA_StatusCode statusCode = UA_Server_addVariableNode(m_pServer, nodeId, UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+			UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES), browseName, UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE), attributes, nullptr, nullptr);
+
+		UA_NodeId_clear(&nodeId);
+		UA_QualifiedName_clear(&browseName);
+		UA_VariableAttributes_clear(&attributes);
+
+		if (statusCode != UA_STATUSCODE_GOOD)
+			throw std::runtime_error("could not add variable " + sNodeName + ": " + UA_StatusCode_name(statusCode));
+	}
+
+	void writeVariant(const std::string& sNodeName, const UA_Variant& value)
+	{
+		UA_NodeId nodeId = UA_NODEID_STRING_ALLOC(TESTNAMESPACE, sNodeName.c_str());
+		UA_StatusCode statusCode = UA_Server_writeValue(m_pServer, nodeId, value);
+		UA_NodeId_clear(&nodeId);
+
+		if (statusCode != UA_STATUSCODE_GOOD)
+			throw std::runtime_error("could not write variable " + sNodeName + ": " + UA_StatusCode_name(statusCode));
+	}
+
+public:
+
+	CTestServer(uint32_t nNodeCount)
+		: m_pServer(nullptr), m_bRunning(false)
+	{
+		UA_ServerConfig config;
+		memset(&config, 0, sizeof(config));
+		if (UA_ServerConfig_setMinimal(&config, TESTPORT, nullptr) != UA_STATUSCODE_GOOD)
+			throw std::runtime_error("could not configure server");
+
+		UA_UsernamePasswordLogin login;
+		login.username = UA_STRING((char*)TESTUSERNAME);
+		login.password = UA_STRING((char*)TESTPASSWORD);
+		config.allowNonePolicyPassword = true;
+		if (UA_AccessControl_default(&config, true, nullptr, 1, &login) != UA_STATUSCODE_GOOD)
+			throw std::runtime_error("could not configure access control");
+
+		m_pServer = UA_Server_newWithConfig(&config);
+		if (m_pServer == nullptr)
+			throw std::runtime_error("could not create server");
+
+		for (uint32_t nIndex = 0; nIndex < nNodeCount; nIndex++) {
+			UA_Int32 nValue = (UA_Int32)nIndex;
+			UA_Double dValue = nIndex * 0.5;
+			UA_Variant value;
+			UA_Variant_setScalar(&value, &nValue, &UA_TYPES[UA_TYPES_INT32]);
+			addVariable(integerNodeName(nIndex), value);
+			UA_Variant_setScalar(&value, &dValue, &UA_TYPES[UA_TYPES_DOUBLE]);
+			addVariable(doubleNodeName(nIndex), value);
+		}
+
+		UA_String sValue = UA_STRING((char*)"initial");
+		UA_Variant value;
+		UA_Variant_setScalar(&value, &sValue, &UA_TYPES[UA_TYPES_STRING]);
+		addVariable("String", value);
+
+		UA_Int64 nLatencyValue = 0;
+		UA_Variant_setScalar(&value, &nLatencyValue, &UA_TYPES[UA_TYPES_INT64]);
+		addVariable("Latency", value);
+
+		if (UA_Server_run_startup(m_pServer) != UA_STATUSCODE_GOOD)
+			throw std::runtime_error("could not start server");
+
+		m_bRunning = true;
+		m_Thread = std::thread([this]() {
+			while (m_bRunning)
+				UA_Server_run_iterate(m_pServer, true);
+		});
+	}
+
+	~CTestServer()
+	{
+		m_bRunning = false;
+		if (m_Thread.joinable())
+			m_Thread.join();
+
+		UA_Server_run_shutdown(m_pServer);
+		UA_Server_delete(m_pServer);
+	}
+
+	std::string getEndPointURL()
+	{
+		return "opc.tcp://localhost:" + std::to_string(TESTPORT);
+	}
+
+	void writeInt32(const std::string& sNodeName, UA_Int32 nValue)
+	{
+		UA_Variant value;
+		UA_Variant_setScalar(&value, &nValue, &UA_TYPES[UA_TYPES_INT32]);
+		writeVariant(sNodeName, value);
+	}
+
+	void writeInt64(const std::string& sNodeName, UA_Int64 nValue)
+	{
+		UA_Variant value;
+		UA_Variant_setScalar(&value, &nValue, &UA_TYPES[UA_TYPES_INT64]);
+		writeVariant(sNodeName, value);
+	}
+
+	void writeDouble(const std::string& sNodeName, UA_Double dValue)
+	{
+		UA_Variant value;
+		UA_Variant_setScalar(&value, &dValue, &UA_TYPES[UA_TYPES_DOUBLE]);
+		writeVariant(sNodeName, value);
+	}
+};
+
+
+static void connectClient(COPCClient& client, CTestServer& server)
+{
+	client.ConnectUserName(server.getEndPointURL(), TESTUSERNAME, TESTPASSWORD, TESTAPPLICATIONURL);
+}
+
+// Processes subscriptions until the given monitored item changes. Returns false on timeout.
+static bool waitForChange(COPCClient& client, uint32_t nMonitoredItemID, uint32_t nTimeOutInMS)
+{
+	auto startTime = testClock::now();
+	while (secondsSince(startTime) * 1000.0 < nTimeOutInMS) {
+		client.ProcessSubscriptions(1);
+
+		uint32_t nChangedItemID = 0;
+		while (client.PopChangedMonitoredItem(nChangedItemID)) {
+			if (nChangedItemID == nMonitoredItemID)
+				return true;
+		}
+	}
+
+	return false;
+}
+
+
+static void testReadBatch(CTestServer& server, uint32_t nNodeCount)
+{
+	std::cout << "Testing batched reads..." << std::endl;
+
+	COPCClient client;
+	connectClient(client, server);
+
+	std::vector<uint32_t> integerEntries;
+	std::vector<uint32_t> doubleEntries;
+	for (uint32_t nIndex = 0; nIndex < nNodeCount; nIndex++) {
+		integerEntries.push_back(client.AddIntegerToReadBatch(TESTNAMESPACE, integerNodeName(nIndex), LibOpen62541::eUAIntegerType::UAInt32));
+		doubleEntries.push_back(client.AddDoubleToReadBatch(TESTNAMESPACE, doubleNodeName(nIndex), LibOpen62541::eUADoubleType::UADouble64));
+	}
+	uint32_t nStringEntry = client.AddStringToReadBatch(TESTNAMESPACE, "String");
+
+	checkCondition(getErrorCode([&]() { client.GetBatchInteger(integerEntries[0]); }) == LIBOPEN62541_ERROR_READBATCHNOTEXECUTED, "batch values are not available before execution");
+
+	client.ExecuteReadBatch();
+	for (uint32_t nIndex = 0; nIndex < nNodeCount; nIndex++) {
+		checkCondition(client.GetBatchInteger(integerEntries[nIndex]) == nIndex, "batched integer value of " + integerNodeName(nIndex));
+		checkCondition(client.GetBatchDouble(doubleEntries[nIndex]) == nIndex * 0.5, "batched double value of " + doubleNodeName(nIndex));
+	}
+	checkCondition(client.GetBatchString(nStringEntry) == "initial", "batched string value");
+
+	checkCondition(getErrorCode([&]() { client.GetBatchInteger(nStringEntry + 1); }) == LIBOPEN62541_ERROR_INVALIDBATCHINDEX, "invalid batch index is rejected");
+	checkCondition(getErrorCode([&]() { client.GetBatchDouble(integerEntries[0]); }) != LIBOPEN62541_SUCCESS, "integer entry can not be read as double");
+
+	server.writeInt32(integerNodeName(0), 4711);
+	client.ExecuteReadBatch();
+	checkCondition(client.GetBatchInteger(integerEntries[0]) == 4711, "batch reflects server side change after re-execution");
+	server.writeInt32(integerNodeName(0), 0);
+
+	// Nodes that do not exist fail the whole batch, as a single read would.
+	client.AddIntegerToReadBatch(TESTNAMESPACE, "DoesNotExist", LibOpen62541::eUAIntegerType::UAInt32);
+	checkCondition(getErrorCode([&]() { client.ExecuteReadBatch(); }) != LIBOPEN62541_SUCCESS, "batch with unknown node fails");
+
+	client.ClearReadBatch();
+	uint32_t nEntry = client.AddIntegerToReadBatch(TESTNAMESPACE, integerNodeName(1), LibOpen62541::eUAIntegerType::UAInt32);
+	checkCondition(nEntry == 0, "cleared batch starts at index 0");
+	client.ExecuteReadBatch();
+	checkCondition(client.GetBatchInteger(nEntry) == 1, "batch can be reused after clearing");
+
+	client.Disconnect();
+}
+
+
+static void testWriteQueue(CTestServer& server, uint32_t nNodeCount)
+{
+	std::cout << "Testing queued writes..." << std::endl;
+
+	COPCClient client;
+	connectClient(client, server);
+
+	for (uint32_t nIndex = 0; nIndex < nNodeCount; nIndex++) {
+		client.QueueIntegerWrite(TESTNAMESPACE, integerNodeName(nIndex), LibOpen62541::eUAIntegerType::UAInt32, 1000 + nIndex);
+		client.QueueDoubleWrite(TESTNAMESPACE, doubleNodeName(nIndex), LibOpen62541::eUADoubleType::UADouble64, -1.0 * nIndex);
+	}
+	client.QueueStringWrite(TESTNAMESPACE, "String", "queued");
+
+	checkCondition(client.ReadInteger(TESTNAMESPACE, integerNodeName(0), LibOpen62541::eUAIntegerType::UAInt32) == 0, "queued writes are not sent before flushing");
+
+	client.FlushWriteQueue();
+	for (uint32_t nIndex = 0; nIndex < nNodeCount; nIndex++) {
+		checkCondition(client.ReadInteger(TESTNAMESPACE, integerNodeName(nIndex), LibOpen62541::eUAIntegerType::UAInt32) == 1000 + nIndex, "flushed integer value of " + integerNodeName(nIndex));
+		checkCondition(client.ReadDouble(TESTNAMESPACE, doubleNodeName(nIndex), LibOpen62541::eUADoubleType::UADouble64) == -1.0 * nIndex, "flushed double value of " + doubleNodeName(nIndex));
+	}
+	checkCondition(client.ReadString(TESTNAMESPACE, "String") == "queued", "flushed string value");
+
+	// An empty queue is a no-op, and a failed flush does not leave stale writes behind.
+	client.FlushWriteQueue();
+	client.QueueIntegerWrite(TESTNAMESPACE, "DoesNotExist", LibOpen62541::eUAIntegerType::UAInt32, 1);
+	checkCondition(getErrorCode([&]() { client.FlushWriteQueue(); }) != LIBOPEN62541_SUCCESS, "flush with unknown node fails");
+	client.FlushWriteQueue();
+
+	checkCondition(getErrorCode([&]() { client.QueueIntegerWrite(TESTNAMESPACE, integerNodeName(0), LibOpen62541::eUAIntegerType::UAUInt8, 256); }) != LIBOPEN62541_SUCCESS, "out of range value is rejected when queued");
+
+	for (uint32_t nIndex = 0; nIndex < nNodeCount; nIndex++) {
+		client.QueueIntegerWrite(TESTNAMESPACE, integerNodeName(nIndex), LibOpen62541::eUAIntegerType::UAInt32, nIndex);
+		client.QueueDoubleWrite(TESTNAMESPACE, doubleNodeName(nIndex), LibOpen62541::eUADoubleType::UADouble64, nIndex * 0.5);
+	}
+	client.QueueStringWrite(TESTNAMESPACE, "String", "initial");
+	client.FlushWriteQueue();
+
+	client.Disconnect();
+}
+
+
+// Returns false if the server has been built without subscription support.
+static bool testSubscriptions(CTestServer& server)
+{
+	std::cout << "Testing subscriptions..." << std::endl;
+
+	COPCClient client;
+	connectClient(client, server);
+
+	uint32_t nSubscriptionID = 0;
+	try {
+		nSubscriptionID = client.CreateSubscription(10.0);
+	}
+	catch (ELibOpen62541InterfaceException& E) {
+		if (E.getErrorCode() != LIBOPEN62541_ERROR_COULDNOTCREATESUBSCRIPTION)
+			throw;
+		std::cout << "  skipped: server does not support subscriptions." << std::endl;
+		return false;
+	}
+
+	uint32_t nIntegerItem = client.AddIntegerMonitoredItem(nSubscriptionID, TESTNAMESPACE, integerNodeName(0), LibOpen62541::eUAIntegerType::UAInt32, 0.0, 0.0);
+	uint32_t nDoubleItem = client.AddDoubleMonitoredItem(nSubscriptionID, TESTNAMESPACE, doubleNodeName(0), LibOpen62541::eUADoubleType::UADouble64, 0.0, 1.0);
+	uint32_t nStringItem = client.AddStringMonitoredItem(nSubscriptionID, TESTNAMESPACE, "String", 0.0);
+
+	checkCondition(getErrorCode([&]() { client.GetMonitoredItemInteger(nIntegerItem); }) == LIBOPEN62541_ERROR_MONITOREDITEMHASNOVALUE, "monitored item has no value before the first notification");
+	checkCondition(getErrorCode([&]() { client.GetMonitoredItemInteger(nIntegerItem + 100); }) == LIBOPEN62541_ERROR_MONITOREDITEMNOTFOUND, "unknown monitored item is rejected");
+
+	// The initial values are reported once after creation.
+	checkCondition(waitForChange(client, nStringItem, TESTTIMEOUTINMS), "initial notification of the string item");
+	checkCondition(client.GetMonitoredItemInteger(nIntegerItem) == 0, "initial integer value");
+	checkCondition(client.GetMonitoredItemDouble(nDoubleItem) == 0.0, "initial double value");
+	checkCondition(client.GetMonitoredItemString(nStringItem) == "initial", "initial string value");
+	checkCondition(getErrorCode([&]() { client.GetMonitoredItemDouble(nIntegerItem); }) != LIBOPEN62541_SUCCESS, "integer item can not be read as double");
+
+	server.writeInt32(integerNodeName(0), 42);
+	checkCondition(waitForChange(client, nIntegerItem, TESTTIMEOUTINMS), "notification of integer change");
+	checkCondition(client.GetMonitoredItemInteger(nIntegerItem) == 42, "changed integer value");
+
+	// Changes within the deadband are filtered by the server.
+	server.writeDouble(doubleNodeName(0), 0.5);
+	checkCondition(!waitForChange(client, nDoubleItem, 200), "change within deadband is not reported");
+	server.writeDouble(doubleNodeName(0), 2.0);
+	checkCondition(waitForChange(client, nDoubleItem, TESTTIMEOUTINMS), "change beyond deadband is reported");
+	checkCondition(client.GetMonitoredItemDouble(nDoubleItem) == 2.0, "changed double value");
+
+	client.DeleteSubscription(nSubscriptionID);
+	checkCondition(getErrorCode([&]() { client.GetMonitoredItemInteger(nIntegerItem); }) == LIBOPEN62541_ERROR_MONITOREDITEMNOTFOUND, "monitored items are removed with their subscription");
+	checkCondition(getErrorCode([&]() { client.DeleteSubscription(nSubscriptionID); }) == LIBOPEN62541_ERROR_SUBSCRIPTIONNOTFOUND, "deleted subscription is unknown");
+
+	server.writeInt32(integerNodeName(0), 0);
+	server.writeDouble(doubleNodeName(0), 0.0);
+
+	client.Disconnect();
+	return true;
+}
+
+
+static void printRate(const std::string& sName, uint32_t nCycles, uint64_t nValues, uint64_t nServiceCalls, double dSeconds)
+{
+	std::cout << "  " << std::left << std::setw(24) << sName << std::right << std::fixed << std::setprecision(1)
+		<< std::setw(10) << (nCycles / dSeconds) << " cycles/s"
+		<< std::setw(12) << (nValues / dSeconds) << " values/s"
+		<< std::setw(10) << (nServiceCalls / dSeconds) << " calls/s" << std::endl;
+}
+
+static void runBenchmark(CTestServer& server, uint32_t nNodeCount, uint32_t nCycles, uint32_t nUpdates, bool bHasSubscriptions)
+{
+	std::cout << "Benchmark with " << nNodeCount << " integer and " << nNodeCount << " double nodes:" << std::endl;
+
+	COPCClient client;
+	connectClient(client, server);
+
+	uint32_t nValuesPerCycle = 2 * nNodeCount;
+
+	auto startTime = testClock::now();
+	for (uint32_t nCycle = 0; nCycle < nCycles; nCycle++) {
+		for (uint32_t nIndex = 0; nIndex < nNodeCount; nIndex++) {
+			client.ReadInteger(TESTNAMESPACE, integerNodeName(nIndex), LibOpen62541::eUAIntegerType::UAInt32);
+			client.ReadDouble(TESTNAMESPACE, doubleNodeName(nIndex), LibOpen62541::eUADoubleType::UADouble64);
+		}
+	}
+	printRate("single reads", nCycles, (uint64_t)nCycles * nValuesPerCycle, (uint64_t)nCycles * nValuesPerCycle, secondsSince(startTime));
+
+	for (uint32_t nIndex = 0; nIndex < nNodeCount; nIndex++) {
+		client.AddIntegerToReadBatch(TESTNAMESPACE, integerNodeName(nIndex), LibOpen62541::eUAIntegerType::UAInt32);
+		client.AddDoubleToReadBatch(TESTNAMESPACE, doubleNodeName(nIndex), LibOpen62541::eUADoubleType::UADouble64);
+	}
+	startTime = testClock::now();
+	for (uint32_t nCycle = 0; nCycle < nCycles; nCycle++) {
+		client.ExecuteReadBatch();
+		for (uint32_t nIndex = 0; nIndex < nNodeCount; nIndex++) {
+			client.GetBatchInteger(2 * nIndex);
+			client.GetBatchDouble(2 * nIndex + 1);
+		}
+	}
+	printRate("batched reads", nCycles, (uint64_t)nCycles * nValuesPerCycle, nCycles, secondsSince(startTime));
+
+	startTime = testClock::now();
+	for (uint32_t nCycle = 0; nCycle < nCycles; nCycle++) {
+		for (uint32_t nIndex = 0; nIndex < nNodeCount; nIndex++) {
+			client.WriteInteger(TESTNAMESPACE, integerNodeName(nIndex), LibOpen62541::eUAIntegerType::UAInt32, nIndex);
+			client.WriteDouble(TESTNAMESPACE, doubleNodeName(nIndex), LibOpen62541::eUADoubleType::UADouble64, nIndex * 0.5);
+		}
+	}
+	printRate("single writes", nCycles, (uint64_t)nCycles * nValuesPerCycle, (uint64_t)nCycles * nValuesPerCycle, secondsSince(startTime));
+
+	startTime = testClock::now();
+	for (uint32_t nCycle = 0; nCycle < nCycles; nCycle++) {
+		for (uint32_t nIndex = 0; nIndex < nNodeCount; nIndex++) {
+			client.QueueIntegerWrite(TESTNAMESPACE, integerNodeName(nIndex), LibOpen62541::eUAIntegerType::UAInt32, nIndex);
+			client.QueueDoubleWrite(TESTNAMESPACE, doubleNodeName(nIndex), LibOpen62541::eUADoubleType::UADouble64, nIndex * 0.5);
+		}
+		client.FlushWriteQueue();
+	}
+	printRate("queued writes", nCycles, (uint64_t)nCycles * nValuesPerCycle, nCycles, secondsSince(startTime));
+
+	if (!bHasSubscriptions) {
+		std::cout << "  subscription latency skipped." << std::endl;
+		client.Disconnect();
+		return;
+	}
+
+	uint32_t nSubscriptionID = client.CreateSubscription(1.0);
+	uint32_t nLatencyItem = client.AddIntegerMonitoredItem(nSubscriptionID, TESTNAMESPACE, "Latency", LibOpen62541::eUAIntegerType::UAInt64, 0.0, 0.0);
+	waitForChange(client, nLatencyItem, TESTTIMEOUTINMS);
+
+	std::vector<double> latencies;
+	for (uint32_t nUpdate = 1; nUpdate <= nUpdates; nUpdate++) {
+		auto writeTime = testClock::now();
+		server.writeInt64("Latency", nUpdate);
+		if (!waitForChange(client, nLatencyItem, TESTTIMEOUTINMS))
+			throw std::runtime_error("subscription update timed out");
+		latencies.push_back(secondsSince(writeTime) * 1000.0);
+		checkCondition(client.GetMonitoredItemInteger(nLatencyItem) == nUpdate, "latency item value");
+	}
+
+	std::sort(latencies.begin(), latencies.end());
+	std::cout << "  subscription latency    " << std::fixed << std::setprecision(3)
+		<< "median " << latencies[latencies.size() / 2] << " ms, "
+		<< "p99 " << latencies[std::min(latencies.size() - 1, (size_t)(latencies.size() * 0.99))] << " ms, "
+		<< "max " << latencies.back() << " ms" << std::endl;
+
+	client.DeleteSubscription(nSubscriptionID);
+	client.Disconnect();
+}
+
+
+int main(int argc, char** argv)
+{
+	try {
+		uint32_t nNodeCount = 100;
+		uint32_t nCycles = 200;
+		uint32_t nUpdates = 200;
+		bool bRequireSubscriptions = false;
+
+		for (int nIndex = 1; nIndex + 1 < argc; nIndex += 2) {
+			std::string sOption = argv[nIndex];
+			uint32_t nValue = (uint32_t)std::stoul(argv[nIndex + 1]);
+			if (sOption == "--nodes")
+				nNodeCount = std::max(nValue, (uint32_t)1);
+			else if (sOption == "--cycles")
+				nCycles = std::max(nValue, (uint32_t)1);
+			else if (sOption == "--updates")
+				nUpdates = std::max(nValue, (uint32_t)1);
+			else if (sOption == "--requiresubscriptions")
+				bRequireSubscriptions = (nValue != 0);
+			else
+				throw std::runtime_error("unknown option: " + sOption);
+		}
+
+		testValueConversion();
+
+		CTestServer server(nNodeCount);
+
+		testReadBatch(server, nNodeCount);
+		testWriteQueue(server, nNodeCount);
+		bool bHasSubscriptions = testSubscriptions(server);
+		if (bRequireSubscriptions)
+			checkCondition(bHasSubscriptions, "server supports subscriptions");
+
+		if (s_nFailureCount > 0) {
+			std::cout << s_nFailureCount << " checks failed." << std::endl;
+			return 1;
+		}
+
+		if (bHasSubscriptions)
+			std::cout << "All checks passed." << std::endl << std::endl;
+		else
+			std::cout << "All checks passed, subscription checks were skipped." << std::endl << std::endl;
+
+		runBenchmark(server, nNodeCount, nCycles, nUpdates, bHasSubscriptions);
+	}
+	catch (std::exception& E) {
+		std::cout << "error: " << E.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,609 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: Loopback test and benchmark of the TCP/IP driver's I/O engine.
+
+Usage:
+	tcpip_ioenginetest [--connections 64] [--roundtrips 10000] [--streamsize 64]
+
+The test starts an echo server on the engine and checks the length prefix and delimiter framing with
+randomly sized and randomly split messages. Afterwards it compares round trip latency, stream throughput
+and many parallel connections between the engine and the blocking socket connection of the driver.
+Stream size is given in megabytes.
+
+*/
+
+#include "libmcdriver_tcpip_ioengine.hpp"
+#include "libmcdriver_tcpip_sockets.hpp"
+#include "libmcdriver_tcpip_interfaceexception.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <map>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+
+using namespace LibMCDriver_TCPIP::Impl;
+
+#define TESTLOOPBACKADDRESS "127.0.0.1"
+#define TESTTIMEOUTINMS 10000
+
+typedef std::chrono::steady_clock testClock;
+
+static uint32_t s_nFailureCount = 0;
+
+static void checkCondition(bool bCondition, const std::string& sDescription)
+{
+	if (!bCondition) {
+		std::cout << "FAILED: " << sDescription << std::endl;
+		s_nFailureCount++;
+	}
+}
+
+static double secondsSince(testClock::time_point startTime)
+{
+	return std::chrono::duration<double>(testClock::now() - startTime).count();
+}
+
+static PDriver_TCPIPSendBuffer makeSendBuffer(const uint8_t* pData, size_t nSize)
+{
+	return std::make_shared<std::vector<uint8_t>>(pData, pData + nSize);
+}
+
+static PDriver_TCPIPSendBuffer makeLengthHeader(uint32_t nLength)
+{
+	std::vector<uint8_t> header = { (uint8_t)(nLength >> 24), (uint8_t)(nLength >> 16), (uint8_t)(nLength >> 8), (uint8_t)nLength };
+	return std::make_shared<std::vector<uint8_t>>(header);
+}
+
+
+// Collects the packets of one or more client connections.
+class CTestReceiver {
+private:
+	std::mutex m_Mutex;
+	std::condition_variable m_Signal;
+	std::vector<std::vector<uint8_t>> m_Packets;
+	size_t m_nReceivedBytes;
+	uint32_t m_nCloseErrorCode;
+	bool m_bIsClosed;
+
+public:
+
+	CTestReceiver()
+		: m_nReceivedBytes(0), m_nCloseErrorCode(0), m_bIsClosed(false)
+	{
+	}
+
+	TCPIPPacketCallback packetCallback(bool bKeepPackets)
+	{
+		return [this, bKeepPackets](uint64_t nConnectionID, std::vector<CDriver_TCPIPPacketView>& Packets) {
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			for (auto& packet : Packets) {
+				m_nReceivedBytes += packet.getSize();
+				if (bKeepPackets)
+					m_Packets.push_back(std::vector<uint8_t>(packet.getData(), packet.getData() + packet.getSize()));
+			}
+			m_Signal.notify_all();
+		};
+	}
+
+	TCPIPCloseCallback closeCallback()
+	{
+		return [this](uint64_t nConnectionID, uint32_t nErrorCode, const std::string& sErrorMessage) {
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			m_bIsClosed = true;
+			m_nCloseErrorCode = nErrorCode;
+			m_Signal.notify_all();
+		};
+	}
+
+	bool waitForPackets(size_t nCount)
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		return m_Signal.wait_for(lock, std::chrono::milliseconds(TESTTIMEOUTINMS), [this, nCount] { return m_Packets.size() >= nCount; });
+	}
+
+	bool waitForBytes(size_t nCount)
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		return m_Signal.wait_for(lock, std::chrono::milliseconds(TESTTIMEOUTINMS), [this, nCount] { return m_nReceivedBytes >= nCount; });
+	}
+
+	bool waitForClose()
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		return m_Signal.wait_for(lock, std::chrono::milliseconds(TESTTIMEOUTINMS), [this] { return m_bIsClosed; });
+	}
+
+	std::vector<std::vector<uint8_t>> takePackets()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		std::vector<std::vector<uint8_t>> packets;
+		packets.swap(m_Packets);
+		return packets;
+	}
+
+	uint32_t getCloseErrorCode()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		return m_nCloseErrorCode;
+	}
+};
+
+
+// Echo server on its own engine. Framed servers send every frame back with a fresh header or delimiter.
+class CTestEchoServer {
+private:
+	PDriver_TCPIPIOEngine m_pEngine;
+	uint64_t m_nListenerID;
+	uint32_t m_nPort;
+
+public:
+
+	CTestEchoServer(TCPIPFramerFactory FramerFactory, std::function<std::vector<PDriver_TCPIPSendBuffer>(const CDriver_TCPIPPacketView&)> Encoder)
+		: m_nListenerID(0), m_nPort(0)
+	{
+		m_pEngine = std::make_shared<CDriver_TCPIPIOEngine>(65536, 64);
+		CDriver_TCPIPIOEngine* pEngine = m_pEngine.get();
+
+		auto packetCallback = [pEngine, Encoder](uint64_t nConnectionID, std::vector<CDriver_TCPIPPacketView>& Packets) {
+			std::vector<PDriver_TCPIPSendBuffer> buffers;
+			for (auto& packet : Packets) {
+				auto packetBuffers = Encoder(packet);
+				buffers.insert(buffers.end(), packetBuffers.begin(), packetBuffers.end());
+			}
+			pEngine->send(nConnectionID, buffers);
+		};
+
+		m_nListenerID = m_pEngine->listen(TESTLOOPBACKADDRESS, 0, m_nPort, FramerFactory, packetCallback, nullptr, nullptr);
+	}
+
+	uint32_t getPort()
+	{
+		return m_nPort;
+	}
+};
+
+
+static void testFraming()
+{
+	std::mt19937 randomGenerator(4711);
+	auto pPool = std::make_shared<CDriver_TCPIPBufferPool>(4096, 4);
+
+	// Length prefix frames in all header variants, fed in random pieces.
+	for (uint32_t nHeaderSize : { 1, 2, 4 }) {
+		for (bool bBigEndian : { false, true }) {
+			for (bool bIncludesHeader : { false, true }) {
+				uint32_t nMaxPayload = (nHeaderSize == 1) ? (255 - (bIncludesHeader ? nHeaderSize : 0)) : 20000;
+
+				std::vector<uint8_t> stream;
+				std::vector<std::vector<uint8_t>> payloads;
+				for (uint32_t nIndex = 0; nIndex < 200; nIndex++) {
+					std::vector<uint8_t> payload(randomGenerator() % (nMaxPayload + 1));
+					for (auto& nValue : payload)
+						nValue = (uint8_t)randomGenerator();
+
+					uint64_t nLength = payload.size() + (bIncludesHeader ? nHeaderSize : 0);
+					for (uint32_t nByte = 0; nByte < nHeaderSize; nByte++) {
+						uint32_t nShift = bBigEndian ? (8 * (nHeaderSize - 1 - nByte)) : (8 * nByte);
+						stream.push_back((uint8_t)(nLength >> nShift));
+					}
+					stream.insert(stream.end(), payload.begin(), payload.end());
+					payloads.push_back(payload);
+				}
+
+				CDriver_TCPIPFrameReader reader(pPool, std::make_shared<CDriver_TCPIPLengthPrefixFramer>(nHeaderSize, bBigEndian, bIncludesHeader, nMaxPayload));
+				std::vector<CDriver_TCPIPPacketView> frames;
+				size_t nPosition = 0;
+				while (nPosition < stream.size()) {
+					size_t nFreeSize = 0;
+					uint8_t* pTarget = reader.prepareReceive(nFreeSize);
+					size_t nCount = std::min({ nFreeSize, stream.size() - nPosition, (size_t)(1 + randomGenerator() % 3000) });
+					memcpy(pTarget, stream.data() + nPosition, nCount);
+					reader.commitReceive(nCount);
+					reader.extractFrames(frames);
+					nPosition += nCount;
+				}
+
+				bool bAllMatch = (frames.size() == payloads.size());
+				for (size_t nIndex = 0; bAllMatch && (nIndex < frames.size()); nIndex++)
+					bAllMatch = (frames[nIndex].getSize() == payloads[nIndex].size()) && std::equal(payloads[nIndex].begin(), payloads[nIndex].end(), frames[nIndex].getData());
+
+				checkCondition(bAllMatch, "length prefix framing, header size " + std::to_string(nHeaderSize) + (bBigEndian ? " big endian" : " little endian") + (bIncludesHeader ? " including header" : ""));
+			}
+		}
+	}
+
+	// Delimiter frames, with the delimiter split across receive calls.
+	{
+		std::string sStream;
+		std::vector<std::string> lines;
+		for (uint32_t nIndex = 0; nIndex < 500; nIndex++) {
+			std::string sLine(randomGenerator() % 9000, 'a');
+			for (auto& cValue : sLine)
+				cValue = (char)('a' + randomGenerator() % 26);
+			lines.push_back(sLine);
+			sStream += sLine + "\r\n";
+		}
+
+		CDriver_TCPIPFrameReader reader(pPool, std::make_shared<CDriver_TCPIPDelimiterFramer>("\r\n", 10000));
+		std::vector<CDriver_TCPIPPacketView> frames;
+		size_t nPosition = 0;
+		while (nPosition < sStream.size()) {
+			size_t nFreeSize = 0;
+			uint8_t* pTarget = reader.prepareReceive(nFreeSize);
+			size_t nCount = std::min({ nFreeSize, sStream.size() - nPosition, (size_t)(1 + randomGenerator() % 700) });
+			memcpy(pTarget, sStream.data() + nPosition, nCount);
+			reader.commitReceive(nCount);
+			reader.extractFrames(frames);
+			nPosition += nCount;
+		}
+
+		bool bAllMatch = (frames.size() == lines.size());
+		for (size_t nIndex = 0; bAllMatch && (nIndex < frames.size()); nIndex++)
+			bAllMatch = (std::string((const char*)frames[nIndex].getData(), frames[nIndex].getSize()) == lines[nIndex]);
+
+		checkCondition(bAllMatch, "delimiter framing");
+	}
+
+	// Oversized frames are rejected as soon as their header or enough data has arrived.
+	{
+		CDriver_TCPIPFrameReader reader(pPool, std::make_shared<CDriver_TCPIPLengthPrefixFramer>(4, true, false, 1000));
+		size_t nFreeSize = 0;
+		uint8_t* pTarget = reader.prepareReceive(nFreeSize);
+		uint8_t header[4] = { 0, 0, 0x10, 0 };
+		memcpy(pTarget, header, 4);
+		reader.commitReceive(4);
+
+		uint32_t nErrorCode = 0;
+		std::vector<CDriver_TCPIPPacketView> frames;
+		try {
+			reader.extractFrames(frames);
+		}
+		catch (ELibMCDriver_TCPIPInterfaceException& E) {
+			nErrorCode = E.getErrorCode();
+		}
+		checkCondition(nErrorCode == LIBMCDRIVER_TCPIP_ERROR_FRAMETOOLARGE, "oversized length prefix frame");
+	}
+
+	// Views keep their block alive after the reader is gone, and the block returns to the pool afterwards.
+	{
+		CDriver_TCPIPPacketView view;
+		{
+			CDriver_TCPIPFrameReader reader(pPool, std::make_shared<CDriver_TCPIPDelimiterFramer>("\n", 100));
+			size_t nFreeSize = 0;
+			uint8_t* pTarget = reader.prepareReceive(nFreeSize);
+			memcpy(pTarget, "hello\n", 6);
+			reader.commitReceive(6);
+
+			std::vector<CDriver_TCPIPPacketView> frames;
+			reader.extractFrames(frames);
+			checkCondition(frames.size() == 1, "single delimiter frame");
+			if (frames.size() == 1)
+				view = frames[0];
+		}
+		checkCondition(std::string((const char*)view.getData(), view.getSize()) == "hello", "packet view outlives frame reader");
+	}
+}
+
+
+static void testEchoServer(uint32_t nConnectionCount)
+{
+	// Length prefix echo. The server answers every frame with a gathered write of header and payload.
+	CTestEchoServer server([]() -> PDriver_TCPIPFramer { return std::make_shared<CDriver_TCPIPLengthPrefixFramer>(4, true, false, 1024 * 1024); },
+		[](const CDriver_TCPIPPacketView& packet) -> std::vector<PDriver_TCPIPSendBuffer> {
+			return { makeLengthHeader((uint32_t)packet.getSize()), makeSendBuffer(packet.getData(), packet.getSize()) };
+		});
+
+	// Receivers are declared first, so that they outlive the client engine's thread.
+	std::vector<std::unique_ptr<CTestReceiver>> receivers;
+	CTestReceiver limitedReceiver;
+	CTestReceiver lineReceiver;
+
+	CDriver_TCPIPIOEngine clientEngine(65536, 64);
+	std::mt19937 randomGenerator(815);
+
+	std::vector<uint64_t> connectionIDs;
+	std::vector<std::vector<std::vector<uint8_t>>> sentPayloads(nConnectionCount);
+
+	for (uint32_t nIndex = 0; nIndex < nConnectionCount; nIndex++) {
+		receivers.push_back(std::unique_ptr<CTestReceiver>(new CTestReceiver()));
+		auto pReceiver = receivers.back().get();
+		connectionIDs.push_back(clientEngine.connect(TESTLOOPBACKADDRESS, server.getPort(), TESTTIMEOUTINMS,
+			[]() -> PDriver_TCPIPFramer { return std::make_shared<CDriver_TCPIPLengthPrefixFramer>(4, true, false, 1024 * 1024); },
+			pReceiver->packetCallback(true), pReceiver->closeCallback()));
+	}
+
+	const uint32_t nMessagesPerConnection = 50;
+	for (uint32_t nMessage = 0; nMessage < nMessagesPerConnection; nMessage++) {
+		for (uint32_t nIndex = 0; nIndex < nConnectionCount; nIndex++) {
+			// Mostly small messages, with the occasional one that spans several receive blocks.
+			size_t nSize = ((randomGenerator() % 10) == 0) ? (randomGenerator() % 300000) : (randomGenerator() % 200);
+			std::vector<uint8_t> payload(nSize);
+			for (auto& nValue : payload)
+				nValue = (uint8_t)randomGenerator();
+
+			clientEngine.send(connectionIDs[nIndex], { makeLengthHeader((uint32_t)nSize), makeSendBuffer(payload.data(), payload.size()) });
+			sentPayloads[nIndex].push_back(payload);
+		}
+	}
+
+	bool bAllMatch = true;
+	for (uint32_t nIndex = 0; nIndex < nConnectionCount; nIndex++) {
+		bool bComplete = receivers[nIndex]->waitForPackets(nMessagesPerConnection);
+		auto receivedPayloads = receivers[nIndex]->takePackets();
+		bAllMatch = bAllMatch && bComplete && (receivedPayloads == sentPayloads[nIndex]);
+	}
+	checkCondition(bAllMatch, "length prefix echo over " + std::to_string(nConnectionCount) + " connections");
+
+	// Closing a connection reports it to its owner and makes further sends fail.
+	clientEngine.closeConnection(connectionIDs[0]);
+	checkCondition(receivers[0]->waitForClose(), "close callback after closeConnection");
+	checkCondition(!clientEngine.isConnected(connectionIDs[0]), "connection is closed");
+
+	uint32_t nErrorCode = 0;
+	try {
+		clientEngine.send(connectionIDs[0], { makeLengthHeader(0) });
+	}
+	catch (ELibMCDriver_TCPIPInterfaceException& E) {
+		nErrorCode = E.getErrorCode();
+	}
+	checkCondition(nErrorCode == LIBMCDRIVER_TCPIP_ERROR_DRIVERNOTCONNECTED, "send on closed connection");
+
+	// A frame that exceeds the maximum size closes the connection with FRAMETOOLARGE.
+	uint64_t nLimitedID = clientEngine.connect(TESTLOOPBACKADDRESS, server.getPort(), TESTTIMEOUTINMS,
+		[]() -> PDriver_TCPIPFramer { return std::make_shared<CDriver_TCPIPLengthPrefixFramer>(4, true, false, 100); },
+		limitedReceiver.packetCallback(true), limitedReceiver.closeCallback());
+	std::vector<uint8_t> largePayload(1000, 42);
+	clientEngine.send(nLimitedID, { makeLengthHeader((uint32_t)largePayload.size()), makeSendBuffer(largePayload.data(), largePayload.size()) });
+	checkCondition(limitedReceiver.waitForClose() && (limitedReceiver.getCloseErrorCode() == LIBMCDRIVER_TCPIP_ERROR_FRAMETOOLARGE), "oversized echo closes the connection");
+
+	// Delimiter echo through a second server.
+	CTestEchoServer lineServer([]() -> PDriver_TCPIPFramer { return std::make_shared<CDriver_TCPIPDelimiterFramer>("\n", 65536); },
+		[](const CDriver_TCPIPPacketView& packet) -> std::vector<PDriver_TCPIPSendBuffer> {
+			static const uint8_t nLineFeed = '\n';
+			return { makeSendBuffer(packet.getData(), packet.getSize()), makeSendBuffer(&nLineFeed, 1) };
+		});
+
+	uint64_t nLineID = clientEngine.connect(TESTLOOPBACKADDRESS, lineServer.getPort(), TESTTIMEOUTINMS,
+		[]() -> PDriver_TCPIPFramer { return std::make_shared<CDriver_TCPIPDelimiterFramer>("\n", 65536); },
+		lineReceiver.packetCallback(true), lineReceiver.closeCallback());
+
+	std::string sLines = "first\nsecond\n\nfourth line\n";
+	clientEngine.send(nLineID, { makeSendBuffer((const uint8_t*)sLines.data(), 9), makeSendBuffer((const uint8_t*)sLines.data() + 9, sLines.size() - 9) });
+
+	bool bLinesMatch = lineReceiver.waitForPackets(4);
+	auto lines = lineReceiver.takePackets();
+	bLinesMatch = bLinesMatch && (lines.size() == 4) && (std::string(lines[0].begin(), lines[0].end()) == "first") && (lines[2].empty()) && (std::string(lines[3].begin(), lines[3].end()) == "fourth line");
+	checkCondition(bLinesMatch, "delimiter echo");
+}
+
+
+static void printResult(const std::string& sName, double dValue, const std::string& sUnit)
+{
+	std::cout << "  " << std::left << std::setw(44) << sName << std::right << std::setw(12) << std::fixed << std::setprecision(1) << dValue << " " << sUnit << std::endl;
+}
+
+static void runBenchmark(uint32_t nConnectionCount, uint32_t nRoundTrips, uint32_t nStreamSizeInMB)
+{
+	CTestEchoServer server(nullptr, [](const CDriver_TCPIPPacketView& packet) -> std::vector<PDriver_TCPIPSendBuffer> {
+		return { makeSendBuffer(packet.getData(), packet.getSize()) };
+	});
+
+	const size_t nMessageSize = 64;
+	std::vector<uint8_t> message(nMessageSize, 7);
+
+	std::cout << "Round trip latency (" << nRoundTrips << " x " << nMessageSize << " bytes)" << std::endl;
+	{
+		CDriver_TCPIPSocketConnection connection(TESTLOOPBACKADDRESS, server.getPort());
+		std::vector<uint8_t> answer;
+		auto startTime = testClock::now();
+		for (uint32_t nIndex = 0; nIndex < nRoundTrips; nIndex++) {
+			answer.clear();
+			connection.sendBuffer(message.data(), message.size());
+			connection.receiveBuffer(answer, nMessageSize, true);
+		}
+		printResult("blocking socket connection", 1.0e6 * secondsSince(startTime) / nRoundTrips, "us");
+	}
+	{
+		CTestReceiver receiver;
+		CDriver_TCPIPIOEngine clientEngine(65536, 64);
+		uint64_t nConnectionID = clientEngine.connect(TESTLOOPBACKADDRESS, server.getPort(), TESTTIMEOUTINMS, nullptr, receiver.packetCallback(false), receiver.closeCallback());
+		auto pMessage = makeSendBuffer(message.data(), message.size());
+
+		auto startTime = testClock::now();
+		for (uint32_t nIndex = 0; nIndex < nRoundTrips; nIndex++) {
+			clientEngine.send(nConnectionID, { pMessage });
+			if (!receiver.waitForBytes((nIndex + 1) * nMessageSize))
+				throw std::runtime_error("engine round trip timed out");
+		}
+		printResult("I/O engine", 1.0e6 * secondsSince(startTime) / nRoundTrips, "us");
+	}
+
+	size_t nStreamSize = (size_t)nStreamSizeInMB * 1024 * 1024;
+	const size_t nChunkSize = 64 * 1024;
+	std::vector<uint8_t> chunk(nChunkSize, 3);
+
+	std::cout << "Echo stream throughput (" << nStreamSizeInMB << " MB in " << nChunkSize / 1024 << " KB writes)" << std::endl;
+	{
+		CDriver_TCPIPSocketConnection connection(TESTLOOPBACKADDRESS, server.getPort());
+		auto startTime = testClock::now();
+		std::thread senderThread([&connection, &chunk, nStreamSize, nChunkSize] {
+			for (size_t nSent = 0; nSent < nStreamSize; nSent += nChunkSize)
+				connection.sendBuffer(chunk.data(), nChunkSize);
+		});
+
+		std::vector<uint8_t> answer;
+		size_t nReceived = 0;
+		while (nReceived < nStreamSize) {
+			answer.clear();
+			connection.receiveBuffer(answer, nChunkSize, false);
+			nReceived += answer.size();
+		}
+		senderThread.join();
+		printResult("blocking socket connection", nStreamSizeInMB / secondsSince(startTime), "MB/s");
+	}
+	{
+		CTestReceiver receiver;
+		CDriver_TCPIPIOEngine clientEngine(65536, 64);
+		uint64_t nConnectionID = clientEngine.connect(TESTLOOPBACKADDRESS, server.getPort(), TESTTIMEOUTINMS, nullptr, receiver.packetCallback(false), receiver.closeCallback());
+		auto pChunk = makeSendBuffer(chunk.data(), chunk.size());
+
+		auto startTime = testClock::now();
+		for (size_t nSent = 0; nSent < nStreamSize; nSent += nChunkSize)
+			clientEngine.send(nConnectionID, { pChunk });
+		if (!receiver.waitForBytes(nStreamSize))
+			throw std::runtime_error("engine stream timed out");
+		printResult("I/O engine", nStreamSizeInMB / secondsSince(startTime), "MB/s");
+	}
+
+	uint32_t nParallelRoundTrips = std::max(nRoundTrips / nConnectionCount, (uint32_t)1);
+	std::cout << "Parallel round trips (" << nConnectionCount << " connections x " << nParallelRoundTrips << ")" << std::endl;
+	{
+		auto startTime = testClock::now();
+		std::vector<std::thread> clientThreads;
+		for (uint32_t nIndex = 0; nIndex < nConnectionCount; nIndex++) {
+			clientThreads.push_back(std::thread([&server, &message, nParallelRoundTrips, nMessageSize] {
+				CDriver_TCPIPSocketConnection connection(TESTLOOPBACKADDRESS, server.getPort());
+				std::vector<uint8_t> answer;
+				for (uint32_t nRoundTrip = 0; nRoundTrip < nParallelRoundTrips; nRoundTrip++) {
+					answer.clear();
+					connection.sendBuffer(message.data(), message.size());
+					connection.receiveBuffer(answer, nMessageSize, true);
+				}
+			}));
+		}
+		for (auto& clientThread : clientThreads)
+			clientThread.join();
+
+		double dSeconds = secondsSince(startTime);
+		printResult("blocking, one thread per connection", (double)nConnectionCount * nParallelRoundTrips / dSeconds, "round trips/s");
+	}
+	{
+		// Every connection sends its next message from the engine thread as soon as the answer is complete.
+		auto pMessage = makeSendBuffer(message.data(), message.size());
+
+		std::mutex doneMutex;
+		std::condition_variable doneSignal;
+		uint32_t nFinishedConnections = 0;
+		// Received bytes and completed round trips per connection. Only touched by the engine thread once running.
+		std::map<uint64_t, std::pair<size_t, uint32_t>> progress;
+		std::vector<uint64_t> connectionIDs;
+
+		CDriver_TCPIPIOEngine clientEngine(65536, 64);
+		CDriver_TCPIPIOEngine* pClientEngine = &clientEngine;
+
+		auto packetCallback = [&, pClientEngine](uint64_t nConnectionID, std::vector<CDriver_TCPIPPacketView>& Packets) {
+			auto& state = progress.at(nConnectionID);
+			for (auto& packet : Packets)
+				state.first += packet.getSize();
+
+			while (state.first >= nMessageSize) {
+				state.first -= nMessageSize;
+				state.second++;
+				if (state.second < nParallelRoundTrips) {
+					pClientEngine->send(nConnectionID, { pMessage });
+				}
+				else {
+					std::lock_guard<std::mutex> lockGuard(doneMutex);
+					nFinishedConnections++;
+					doneSignal.notify_all();
+				}
+			}
+		};
+
+		for (uint32_t nIndex = 0; nIndex < nConnectionCount; nIndex++) {
+			uint64_t nConnectionID = clientEngine.connect(TESTLOOPBACKADDRESS, server.getPort(), TESTTIMEOUTINMS, nullptr, packetCallback, nullptr);
+			progress[nConnectionID] = std::make_pair((size_t)0, (uint32_t)0);
+			connectionIDs.push_back(nConnectionID);
+		}
+
+		auto startTime = testClock::now();
+		for (auto nConnectionID : connectionIDs)
+			clientEngine.send(nConnectionID, { pMessage });
+
+		std::unique_lock<std::mutex> doneLock(doneMutex);
+		if (!doneSignal.wait_for(doneLock, std::chrono::milliseconds(TESTTIMEOUTINMS * 6), [&] { return nFinishedConnections >= nConnectionCount; }))
+			throw std::runtime_error("parallel engine round trips timed out");
+
+		double dSeconds = secondsSince(startTime);
+		printResult("I/O engine, one thread for all connections", (double)nConnectionCount * nParallelRoundTrips / dSeconds, "round trips/s");
+	}
+}
+
+
+int main(int argc, char** argv)
+{
+	try {
+		uint32_t nConnectionCount = 64;
+		uint32_t nRoundTrips = 10000;
+		uint32_t nStreamSizeInMB = 64;
+
+		for (int nIndex = 1; nIndex + 1 < argc; nIndex += 2) {
+			std::string sOption = argv[nIndex];
+			uint32_t nValue = (uint32_t)std::stoul(argv[nIndex + 1]);
+			if (sOption == "--connections")
+				nConnectionCount = std::max(nValue, (uint32_t)1);
+			else if (sOption == "--roundtrips")
+				nRoundTrips = std::max(nValue, (uint32_t)1);
+			else if (sOption == "--streamsize")
+				nStreamSizeInMB = std::max(nValue, (uint32_t)1);
+			else
+				throw std::runtime_error("unknown option: " + sOption);
+		}
+
+		CDriver_TCPIPSocketConnection::initializeNetworking();
+
+		testFraming();
+		testEchoServer(nConnectionCount);
+
+		if (s_nFailureCount > 0) {
+			std::cout << s_nFailureCount << " checks failed." << std::endl;
+			return 1;
+		}
+		std::cout << "All checks passed." << std::endl << std::endl;
+
+		runBenchmark(nConnectionCount, nRoundTrips, nStreamSizeInMB);
+	}
+	catch (std::exception& E) {
+		std::cout << "error: " << E.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}